@@ -7,15 +7,28 @@
 #include "../C/lib/structures.h"
 #include "./lib/structuresQ24s.h"
 #include "./lib/structuresQ12s.h"
+#include "./lib/structuresQ24acc.h"
+#include "./lib/structuresQ12acc.h"
+#include "./lib/structuresQ24ef.h"
+#include "./lib/structuresQ12ef.h"
 #include "./lib/fixedpointQ24.h"
 #include "./lib/fixedpointQ12.h"
+#include "./lib/multichannelQ24.h"
+#include "./lib/multichannelQ12.h"
+#include "./lib/satstats.h"
+#include "./lib/structuresQn.h"
+#include "./lib/structuresBFP16.h"
+#include "../C/lib/bufpool.h"
+#include "../C/lib/siggen.h"
 #include "../_filtercoeffs/filtercoeffs.h"
 
 #define N 4096
 
 // Analiza precyzji filtrowania w języku C (reprezentacja stałopozycyjna)
 
-//Kompilacja: gcc -o PrecisionAnalysis_fixed PrecisionAnalysis_fixed.c ./lib/fixedpointQ24.c ./lib/fixedpointQ12.c ./lib/structuresQ12s.c ./lib/structuresQ24s.c ../_filtercoeffs/filtercoeffs.c ../C/lib/structures.c -lm
+//Kompilacja: gcc -o PrecisionAnalysis_fixed PrecisionAnalysis_fixed.c ./lib/fixedpointQ24.c ./lib/fixedpointQ12.c ./lib/structuresQ12s.c ./lib/structuresQ24s.c ./lib/structuresQ12acc.c ./lib/structuresQ24acc.c ./lib/structuresQ12ef.c ./lib/structuresQ24ef.c ../_filtercoeffs/filtercoeffs.c ../C/lib/structures.c ./lib/multichannelQ24.c ./lib/multichannelQ12.c ./lib/satstats.c ./lib/structuresQn.c ./lib/fixedpointBFP16.c ./lib/structuresBFP16.c ../C/lib/bufpool.c ../C/lib/siggen.c -O3 -march=native -lm
+//Telemetria saturacji (kolumny sat_*): -DSAT_TELEMETRY=0 ją wyłącza
+//Wersje bez saturacji: -DFIXED_WRAP oraz ./lib/structuresQ24.c ./lib/structuresQ12.c zamiast *s.c
 
 double rand_signal[N];
 
@@ -74,19 +87,20 @@ void precision_analysis_q(FILE *fp, const char *filter_name, const char *structu
         sscanf(cut_ptr, "_cut%d", &cutoff);
 
     void *x_q, *y_q, *b_q, *a_q;
-    double *x_d = calloc(N, sizeof(double));
-    double *y_d = calloc(N, sizeof(double));
+    sat_stats st;
+    double *x_d = pool_zeroed(POOL_X2, sizeof(double) * N);
+    double *y_d = pool_zeroed(POOL_Y2, sizeof(double) * N);
 
     if (qtype == 24) {
-        x_q = calloc(N, sizeof(q24));
-        y_q = calloc(N, sizeof(q24));
+        x_q = pool_zeroed(POOL_X, sizeof(q24) * N);
+        y_q = pool_zeroed(POOL_Y, sizeof(q24) * N);
         b_q = calloc(order, sizeof(q24));
         a_q = calloc(order, sizeof(q24));
         convert_ba_to_q24(b_d, a_d, (q24*)b_q, (q24*)a_q, order);
         ((q24*)x_q)[0] = double_to_q24(1.0);
     } else {
-        x_q = calloc(N, sizeof(q12));
-        y_q = calloc(N, sizeof(q12));
+        x_q = pool_zeroed(POOL_X, sizeof(q12) * N);
+        y_q = pool_zeroed(POOL_Y, sizeof(q12) * N);
         b_q = calloc(order, sizeof(q12));
         a_q = calloc(order, sizeof(q12));
         convert_ba_to_q12(b_d, a_d, (q12*)b_q, (q12*)a_q, order);
@@ -95,7 +109,10 @@ void precision_analysis_q(FILE *fp, const char *filter_name, const char *structu
 
     x_d[0] = 1.0;
 
+    memset(&st, 0, sizeof(st));
+    sat_begin();
     func_q(x_q, y_q, b_q, a_q, N, order);
+    sat_end(&st);
     func_d(x_d, y_d, b_d, a_d, N, order);
 
     // Zapis impulsu
@@ -106,6 +123,7 @@ void precision_analysis_q(FILE *fp, const char *filter_name, const char *structu
         fprintf(fp, "%.8e", err);
         if (i < N - 1) fprintf(fp, ";");
     }
+    sat_fprint_columns(fp, &st, 1);
     fprintf(fp, "\n");
 
     // Rand test
@@ -119,7 +137,10 @@ void precision_analysis_q(FILE *fp, const char *filter_name, const char *structu
     memset(y_q, 0, N * (qtype == 24 ? sizeof(q24) : sizeof(q12)));
     memset(y_d, 0, sizeof(double) * N);
 
+    memset(&st, 0, sizeof(st));
+    sat_begin();
     func_q(x_q, y_q, b_q, a_q, N, order);
+    sat_end(&st);
     func_d(x_d, y_d, b_d, a_d, N, order);
 
     fprintf(fp, "%s,%s,%s,%d,%d,rand,", filter_type, qstr, structure, cutoff, order - 1);
@@ -129,9 +150,10 @@ void precision_analysis_q(FILE *fp, const char *filter_name, const char *structu
         fprintf(fp, "%.8e", err);
         if (i < N - 1) fprintf(fp, ";");
     }
+    sat_fprint_columns(fp, &st, 1);
     fprintf(fp, "\n");
 
-    free(x_q); free(y_q); free(b_q); free(a_q); free(x_d); free(y_d);
+    free(b_q); free(a_q);
 }
 
 // === Analiza precyzji (SOS) ===
@@ -151,18 +173,19 @@ void precision_analysis_sos(FILE *fp, const char *filter_name, const char *struc
         sscanf(cut_ptr, "_cut%d", &cutoff);
 
     void *x_q, *y_q, *sos_q;
-    double *x_d = calloc(N, sizeof(double));
-    double *y_d = calloc(N, sizeof(double));
+    sat_stats st;
+    double *x_d = pool_zeroed(POOL_X2, sizeof(double) * N);
+    double *y_d = pool_zeroed(POOL_Y2, sizeof(double) * N);
 
     if (qtype == 24) {
-        x_q = calloc(N, sizeof(q24));
-        y_q = calloc(N, sizeof(q24));
+        x_q = pool_zeroed(POOL_X, sizeof(q24) * N);
+        y_q = pool_zeroed(POOL_Y, sizeof(q24) * N);
         sos_q = calloc(sections, sizeof(q24[6]));
         convert_sos_to_q24(sos_d, (q24 (*)[6])sos_q, sections);
         ((q24*)x_q)[0] = double_to_q24(1.0);
     } else {
-        x_q = calloc(N, sizeof(q12));
-        y_q = calloc(N, sizeof(q12));
+        x_q = pool_zeroed(POOL_X, sizeof(q12) * N);
+        y_q = pool_zeroed(POOL_Y, sizeof(q12) * N);
         sos_q = calloc(sections, sizeof(q12[6]));
         convert_sos_to_q12(sos_d, (q12 (*)[6])sos_q, sections);
         ((q12*)x_q)[0] = double_to_q12(1.0);
@@ -170,7 +193,10 @@ void precision_analysis_sos(FILE *fp, const char *filter_name, const char *struc
 
     x_d[0] = 1.0;
 
+    memset(&st, 0, sizeof(st));
+    sat_begin();
     func_q(x_q, y_q, sos_q, N, sections);
+    sat_end(&st);
     func_d(x_d, y_d, sos_d, N, sections);
 
     fprintf(fp, "%s,%s,%s,%d,%d,impulse,", filter_type, qstr, structure, cutoff, 2 * sections);
@@ -180,6 +206,7 @@ void precision_analysis_sos(FILE *fp, const char *filter_name, const char *struc
         fprintf(fp, "%.8e", err);
         if (i < N - 1) fprintf(fp, ";");
     }
+    sat_fprint_columns(fp, &st, sections);
     fprintf(fp, "\n");
 
     // Rand test
@@ -193,7 +220,10 @@ void precision_analysis_sos(FILE *fp, const char *filter_name, const char *struc
     memset(y_q, 0, N * (qtype == 24 ? sizeof(q24) : sizeof(q12)));
     memset(y_d, 0, sizeof(double) * N);
 
+    memset(&st, 0, sizeof(st));
+    sat_begin();
     func_q(x_q, y_q, sos_q, N, sections);
+    sat_end(&st);
     func_d(x_d, y_d, sos_d, N, sections);
 
     fprintf(fp, "%s,%s,%s,%d,%d,rand,", filter_type, qstr, structure, cutoff, 2 * sections);
@@ -203,514 +233,1829 @@ void precision_analysis_sos(FILE *fp, const char *filter_name, const char *struc
         fprintf(fp, "%.8e", err);
         if (i < N - 1) fprintf(fp, ";");
     }
+    sat_fprint_columns(fp, &st, sections);
     fprintf(fp, "\n");
 
-    free(x_q); free(y_q); free(sos_q); free(x_d); free(y_d);
+    free(sos_q);
 }
 
+// === Analiza precyzji (SOS, bfp16) ===
+// Te same sygnały co precision_analysis_sos; typ "bfp16" w kolumnie type
+void precision_analysis_bfp16(FILE *fp, const char *filter_name, const char *structure,
+                              void (*func_b)(bfp16*, bfp16*, bfp16_sos*, int, int),
+                              void (*func_d)(double*, double*, const double[][6], int, int),
+                              const double sos_d[][6], int sections) {
+    int cutoff = -1;
+    char filter_type[32];
 
-int main() {
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    bfp16 x_b, y_b;
+    sat_stats st;
+    bfp16_sos *sos_b = malloc(sizeof(bfp16_sos) * sections);
+    double *x_d = calloc(N, sizeof(double));
+    double *y_d = calloc(N, sizeof(double));
+    double *tmp = calloc(N, sizeof(double));
+
+    bfp16_alloc(&x_b, N);
+    bfp16_alloc(&y_b, N);
+    bfp16_sos_from_double(sos_d, sos_b, sections);
+
+    for (int sig = 0; sig < 2; ++sig) {
+        for (int i = 0; i < N; i++)
+            x_d[i] = sig ? rand_signal[i] : (i == 0 ? 1.0 : 0.0);
+        bfp16_from_double(&x_b, x_d, N);
+
+        memset(&st, 0, sizeof(st));
+        sat_begin();
+        func_b(&x_b, &y_b, sos_b, N, sections);
+        sat_end(&st);
+        memcpy(tmp, x_d, sizeof(double) * N);
+        memset(y_d, 0, sizeof(double) * N);
+        func_d(tmp, y_d, sos_d, N, sections);
+
+        fprintf(fp, "%s,bfp16,%s,%d,%d,%s,", filter_type, structure, cutoff, 2 * sections, sig ? "rand" : "impulse");
+        for (int i = 0; i < N; i++) {
+            double err = y_d[i] - bfp16_to_double(&y_b, i);
+            fprintf(fp, "%.8e", err);
+            if (i < N - 1) fprintf(fp, ";");
+        }
+        sat_fprint_columns(fp, &st, sections);
+        fprintf(fp, "\n");
+    }
+
+    bfp16_free(&x_b); bfp16_free(&y_b);
+    free(sos_b); free(x_d); free(y_d); free(tmp);
+}
+
+
+// === Zgodność jąder wielokanałowych (SIMD) ze skalarnymi ===
+// Każdy kanał filtrowany osobno jądrem skalarnym i porównywany bit w bit z TDF2_mc / CASCADE_mc
+// (oba układy danych). Domyślnie wersje _s (structuresQ24s.c / structuresQ12s.c),
+// z -DFIXED_WRAP wersje bez saturacji. sos != NULL -> CASCADE, w przeciwnym razie TDF2.
+#define MC_CHECK_CHANNELS 19  // celowo niepełna ostatnia grupa wektorowa
+#define MC_CHECK_GAIN 2.0     // wzmocnienie sygnału, żeby saturacja faktycznie występowała
 
-    srand(12345);
+#ifdef FIXED_WRAP
+#define TDF2_MC_Q24    TDF2_mc_q24
+#define CASCADE_MC_Q24 CASCADE_mc_q24
+#define TDF2_MC_Q12    TDF2_mc_q12
+#define CASCADE_MC_Q12 CASCADE_mc_q12
+#else
+#define TDF2_MC_Q24    TDF2_mc_q24_s
+#define CASCADE_MC_Q24 CASCADE_mc_q24_s
+#define TDF2_MC_Q12    TDF2_mc_q12_s
+#define CASCADE_MC_Q12 CASCADE_mc_q12_s
+#endif
+
+static double mc_check_sample(int c, int n) {
+    return MC_CHECK_GAIN * rand_signal[(n + 97 * c) % N];
+}
+
+long mc_exactness_check(FILE *fp, const char *filter_name, int qtype,
+                        double *b_d, double *a_d, int order,
+                        const double sos_d[][6], int sections) {
+    int C = MC_CHECK_CHANNELS;
+    int cutoff = -1;
+    const char *structure = sos_d ? "CASCADE" : "TDF2";
+    int rank = sos_d ? 2 * sections : order - 1;
+    size_t size = (qtype == 24) ? sizeof(q24) : sizeof(q12);
+    char filter_type[32];
+    long total = 0;
+
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    void *b_q = NULL, *a_q = NULL, *sos_q = NULL;
+    void *x_planar = malloc(size * N * C);
+    void *x_inter = malloc(size * N * C);
+    void *y_mc = malloc(size * N * C);
+    void *x_ref = malloc(size * N);
+    void *y_ref = malloc(size * N);
+
+    if (sos_d) {
+        sos_q = calloc(sections, 6 * size);
+        if (qtype == 24) convert_sos_to_q24(sos_d, (q24 (*)[6])sos_q, sections);
+        else convert_sos_to_q12(sos_d, (q12 (*)[6])sos_q, sections);
+    } else {
+        b_q = calloc(order, size);
+        a_q = calloc(order, size);
+        if (qtype == 24) convert_ba_to_q24(b_d, a_d, (q24*)b_q, (q24*)a_q, order);
+        else convert_ba_to_q12(b_d, a_d, (q12*)b_q, (q12*)a_q, order);
+    }
+
+    for (int c = 0; c < C; ++c) {
+        for (int n = 0; n < N; ++n) {
+            double r = mc_check_sample(c, n);
+            if (qtype == 24) {
+                ((q24*)x_planar)[(size_t)c * N + n] = double_to_q24(r);
+                ((q24*)x_inter)[(size_t)n * C + c] = double_to_q24(r);
+            } else {
+                ((q12*)x_planar)[(size_t)c * N + n] = double_to_q12(r);
+                ((q12*)x_inter)[(size_t)n * C + c] = double_to_q12(r);
+            }
+        }
+    }
+
+    for (int layout = MC_INTERLEAVED; layout <= MC_PLANAR; ++layout) {
+        void *x_mc = (layout == MC_PLANAR) ? x_planar : x_inter;
+        long mismatches = 0;
+
+        if (qtype == 24) {
+            if (sos_d) CASCADE_MC_Q24((q24*)x_mc, (q24*)y_mc, (q24*)sos_q, N, sections, C, layout);
+            else TDF2_MC_Q24((q24*)x_mc, (q24*)y_mc, (q24*)b_q, (q24*)a_q, N, order, C, layout);
+        } else {
+            if (sos_d) CASCADE_MC_Q12((q12*)x_mc, (q12*)y_mc, (q12*)sos_q, N, sections, C, layout);
+            else TDF2_MC_Q12((q12*)x_mc, (q12*)y_mc, (q12*)b_q, (q12*)a_q, N, order, C, layout);
+        }
+
+        for (int c = 0; c < C; ++c) {
+            // CASCADE_q24 / CASCADE_q12 nadpisują wejście - osobna kopia kanału
+            memcpy(x_ref, (char*)x_planar + size * N * c, size * N);
+            if (qtype == 24) {
+                if (sos_d) CASCADE_q24((q24*)x_ref, (q24*)y_ref, (q24*)sos_q, N, sections);
+                else TDF2_q24((q24*)x_ref, (q24*)y_ref, (q24*)b_q, (q24*)a_q, N, order);
+            } else {
+                if (sos_d) CASCADE_q12((q12*)x_ref, (q12*)y_ref, (q12*)sos_q, N, sections);
+                else TDF2_q12((q12*)x_ref, (q12*)y_ref, (q12*)b_q, (q12*)a_q, N, order);
+            }
+
+            for (int n = 0; n < N; ++n) {
+                size_t k = (layout == MC_PLANAR) ? (size_t)c * N + n : (size_t)n * C + c;
+                if (qtype == 24) mismatches += ((q24*)y_ref)[n] != ((q24*)y_mc)[k];
+                else mismatches += ((q12*)y_ref)[n] != ((q12*)y_mc)[k];
+            }
+        }
 
+        const char *layout_name = (layout == MC_PLANAR) ? "planar" : "interleaved";
+        fprintf(fp, "%s,q%d,%s,%d,%d,%d,%s,%ld\n", filter_type, qtype, structure, cutoff, rank, C, layout_name, mismatches);
+        printf("[LOG] %s (q%d, %s_mc, cut %d, order %d, %d ch, %s): %ld mismatches\n", filter_type, qtype, structure, cutoff, rank, C, layout_name, mismatches);
+        total += mismatches;
+    }
+
+    free(b_q); free(a_q); free(sos_q);
+    free(x_planar); free(x_inter); free(y_mc); free(x_ref); free(y_ref);
+    return total;
+}
+
+
+
+// === Przegląd formatów Qm.n (structuresQn.h) ===
+// Każdy format i polityka z qn_table na tym samym impulsie i szumie co precision_analysis_*.
+// Zamiast wektora błędu zapisywane są max |e| i RMS - do wyboru najwęższego formatu
+// mieszczącego się w budżecie błędu (c_fixed_qn_precision_results.csv).
+static qn_ba_func qn_ba_kernel(const qn_kernels *k, const char *structure) {
+    if (strcmp(structure, "DF1") == 0) return k->df1;
+    if (strcmp(structure, "DF2") == 0) return k->df2;
+    return k->tdf2;
+}
+
+static void qn_write_errors(FILE *fp, const char *filter_type, const qn_kernels *k, const char *structure,
+                            int cutoff, int rank, const char *signal, const void *y_q, const double *y_d,
+                            const sat_stats *st, int sections) {
+    double max_err = 0.0, sum_sq = 0.0;
     for (int i = 0; i < N; i++) {
-        rand_signal[i] = ((double)rand() / RAND_MAX) * 1.0 - 0.5;
+        double err = y_d[i] - qn_to_double(k, y_q, i, k->frac);
+        if (fabs(err) > max_err) max_err = fabs(err);
+        sum_sq += err * err;
+    }
+
+    fprintf(fp, "%s,%s,%d,%d,%d,%s,%s,%d,%d,%s,%.8e,%.8e", filter_type, k->name, 8 * k->bytes, k->frac, k->cfrac,
+            k->policy, structure, cutoff, rank, signal, max_err, sqrt(sum_sq / N));
+    sat_fprint_columns(fp, st, sections);
+    fprintf(fp, "\n");
+}
+
+// sos_d != NULL -> CASCADE (sections sekcji), w przeciwnym razie structure z b_d / a_d
+void precision_analysis_qn(FILE *fp, const char *filter_name, const char *structure,
+                           void (*func_d)(double*, double*, double*, double*, int, int),
+                           void (*func_sos_d)(double*, double*, const double[][6], int, int),
+                           double *b_d, double *a_d, int order, const double sos_d[][6], int sections) {
+    int cutoff = -1;
+    int rank = sos_d ? 2 * sections : order - 1;
+    int ncoef = sos_d ? 6 * sections : order;
+    char filter_type[32];
+
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    double *x_imp = calloc(N, sizeof(double));
+    double *y_imp = calloc(N, sizeof(double));
+    double *x_rand = calloc(N, sizeof(double));
+    double *y_rand = calloc(N, sizeof(double));
+    double *tmp = calloc(N, sizeof(double));
+
+    x_imp[0] = 1.0;
+    memcpy(x_rand, rand_signal, sizeof(double) * N);
+
+    // Referencja double (CASCADE_d może nadpisywać wejście)
+    memcpy(tmp, x_imp, sizeof(double) * N);
+    if (sos_d) func_sos_d(tmp, y_imp, sos_d, N, sections);
+    else func_d(tmp, y_imp, b_d, a_d, N, order);
+    memcpy(tmp, x_rand, sizeof(double) * N);
+    if (sos_d) func_sos_d(tmp, y_rand, sos_d, N, sections);
+    else func_d(tmp, y_rand, b_d, a_d, N, order);
+
+    const double *coef_d = sos_d ? &sos_d[0][0] : NULL;
+
+    for (int t = 0; t < qn_table_size; ++t) {
+        const qn_kernels *k = &qn_table[t];
+        void *x_q = calloc(N, k->bytes);
+        void *y_q = calloc(N, k->bytes);
+        void *b_q = calloc(ncoef, k->bytes);
+        void *a_q = calloc(ncoef, k->bytes);
+        sat_stats st;
+
+        if (sos_d) qn_from_double(k, b_q, coef_d, ncoef, k->cfrac);
+        else {
+            qn_from_double(k, b_q, b_d, order, k->cfrac);
+            qn_from_double(k, a_q, a_d, order, k->cfrac);
+        }
+
+        for (int sig = 0; sig < 2; ++sig) {
+            qn_from_double(k, x_q, sig ? x_rand : x_imp, N, k->frac);
+            memset(y_q, 0, (size_t)N * k->bytes);
+            memset(&st, 0, sizeof(st));
+
+            sat_begin();
+            if (sos_d) k->cascade(x_q, y_q, b_q, N, sections);
+            else qn_ba_kernel(k, structure)(x_q, y_q, b_q, a_q, N, order);
+            sat_end(&st);
+
+            qn_write_errors(fp, filter_type, k, structure, cutoff, rank, sig ? "rand" : "impulse",
+                            y_q, sig ? y_rand : y_imp, &st, sos_d ? sections : 1);
+        }
+
+        free(x_q); free(y_q); free(b_q); free(a_q);
     }
 
+    free(x_imp); free(y_imp); free(x_rand); free(y_rand); free(tmp);
+}
+
+int main() {
+
+    // Szum równomierny w [-0.5, 0.5), ten sam na każdej platformie
+    siggen g;
+    siggen_init(&g, SG_WHITE, SIGGEN_SEED, 0.5, 0.0, 0.0, 0.0, 0);
+    siggen_block_d(&g, rand_signal, N);
+
     FILE *fp_precision = fopen("c_fixed_precision_results.csv", "w");
     if (!fp_precision) {
         perror("Can't open CSV file");
         return 1;
     }
-    fprintf(fp_precision, "filter_name,type,structure,cutoff,order,signal,error_vector\n");
+    fprintf(fp_precision, "filter_name,type,structure,cutoff,order,signal,error_vector" SAT_CSV_HEADER "\n");
+
+    FILE *fp_qn = fopen("c_fixed_qn_precision_results.csv", "w");
+    if (!fp_qn) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+    fprintf(fp_qn, "filter_name,type,bits,frac,cfrac,policy,structure,cutoff,order,signal,max_abs_error,rms_error" SAT_CSV_HEADER "\n");
     
     // Tu wkleić zawartość pliku generated_calls_precision_fixed.txt
     // === AUTO-GENERATED PRECISION ANALYSIS CALLS ===
     // --- DF1 / DF2 / TDF2 ---
     precision_analysis_q(fp_precision, "butter_df1_order2_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "butter_df1_order2_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_df1_order2_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_df1_order2_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "butter_df1_order2_cut1000", "DF1", DF1_d, NULL, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df2_order2_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "butter_df2_order2_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_df2_order2_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_df2_order2_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "butter_df2_order2_cut1000", "DF2", DF2_d, NULL, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "butter_tdf2_order2_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "butter_tdf2_order2_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_tdf2_order2_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_tdf2_order2_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "butter_tdf2_order2_cut1000", "TDF2", TDF2_d, NULL, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df1_order2_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "butter_df1_order2_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_df1_order2_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_df1_order2_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "butter_df1_order2_cut2000", "DF1", DF1_d, NULL, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df2_order2_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "butter_df2_order2_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_df2_order2_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_df2_order2_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "butter_df2_order2_cut2000", "DF2", DF2_d, NULL, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "butter_tdf2_order2_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "butter_tdf2_order2_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_tdf2_order2_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_tdf2_order2_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "butter_tdf2_order2_cut2000", "TDF2", TDF2_d, NULL, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df1_order2_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "butter_df1_order2_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_df1_order2_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_df1_order2_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "butter_df1_order2_cut5000", "DF1", DF1_d, NULL, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df2_order2_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "butter_df2_order2_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_df2_order2_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_df2_order2_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "butter_df2_order2_cut5000", "DF2", DF2_d, NULL, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "butter_tdf2_order2_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "butter_tdf2_order2_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_tdf2_order2_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "butter_tdf2_order2_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "butter_tdf2_order2_cut5000", "TDF2", TDF2_d, NULL, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df1_order4_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "butter_df1_order4_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_df1_order4_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_df1_order4_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "butter_df1_order4_cut1000", "DF1", DF1_d, NULL, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df2_order4_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "butter_df2_order4_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_df2_order4_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_df2_order4_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "butter_df2_order4_cut1000", "DF2", DF2_d, NULL, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "butter_tdf2_order4_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "butter_tdf2_order4_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_tdf2_order4_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_tdf2_order4_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "butter_tdf2_order4_cut1000", "TDF2", TDF2_d, NULL, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df1_order4_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "butter_df1_order4_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_df1_order4_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_df1_order4_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "butter_df1_order4_cut2000", "DF1", DF1_d, NULL, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df2_order4_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "butter_df2_order4_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_df2_order4_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_df2_order4_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "butter_df2_order4_cut2000", "DF2", DF2_d, NULL, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "butter_tdf2_order4_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "butter_tdf2_order4_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_tdf2_order4_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_tdf2_order4_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "butter_tdf2_order4_cut2000", "TDF2", TDF2_d, NULL, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df1_order4_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "butter_df1_order4_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_df1_order4_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_df1_order4_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "butter_df1_order4_cut5000", "DF1", DF1_d, NULL, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df2_order4_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "butter_df2_order4_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_df2_order4_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_df2_order4_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "butter_df2_order4_cut5000", "DF2", DF2_d, NULL, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "butter_tdf2_order4_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "butter_tdf2_order4_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_tdf2_order4_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "butter_tdf2_order4_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "butter_tdf2_order4_cut5000", "TDF2", TDF2_d, NULL, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df1_order6_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "butter_df1_order6_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_df1_order6_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_df1_order6_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "butter_df1_order6_cut1000", "DF1", DF1_d, NULL, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df2_order6_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "butter_df2_order6_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_df2_order6_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_df2_order6_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "butter_df2_order6_cut1000", "DF2", DF2_d, NULL, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "butter_tdf2_order6_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "butter_tdf2_order6_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_tdf2_order6_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_tdf2_order6_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "butter_tdf2_order6_cut1000", "TDF2", TDF2_d, NULL, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df1_order6_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "butter_df1_order6_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_df1_order6_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_df1_order6_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "butter_df1_order6_cut2000", "DF1", DF1_d, NULL, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df2_order6_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "butter_df2_order6_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_df2_order6_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_df2_order6_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "butter_df2_order6_cut2000", "DF2", DF2_d, NULL, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "butter_tdf2_order6_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "butter_tdf2_order6_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_tdf2_order6_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_tdf2_order6_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "butter_tdf2_order6_cut2000", "TDF2", TDF2_d, NULL, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df1_order6_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "butter_df1_order6_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_df1_order6_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_df1_order6_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "butter_df1_order6_cut5000", "DF1", DF1_d, NULL, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df2_order6_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "butter_df2_order6_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_df2_order6_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_df2_order6_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "butter_df2_order6_cut5000", "DF2", DF2_d, NULL, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "butter_tdf2_order6_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "butter_tdf2_order6_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_tdf2_order6_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "butter_tdf2_order6_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "butter_tdf2_order6_cut5000", "TDF2", TDF2_d, NULL, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df1_order8_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "butter_df1_order8_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_df1_order8_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_df1_order8_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "butter_df1_order8_cut1000", "DF1", DF1_d, NULL, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df2_order8_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "butter_df2_order8_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_df2_order8_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_df2_order8_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "butter_df2_order8_cut1000", "DF2", DF2_d, NULL, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "butter_tdf2_order8_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "butter_tdf2_order8_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_tdf2_order8_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_tdf2_order8_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "butter_tdf2_order8_cut1000", "TDF2", TDF2_d, NULL, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df1_order8_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "butter_df1_order8_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_df1_order8_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_df1_order8_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "butter_df1_order8_cut2000", "DF1", DF1_d, NULL, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df2_order8_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "butter_df2_order8_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_df2_order8_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_df2_order8_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "butter_df2_order8_cut2000", "DF2", DF2_d, NULL, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "butter_tdf2_order8_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "butter_tdf2_order8_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_tdf2_order8_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_tdf2_order8_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "butter_tdf2_order8_cut2000", "TDF2", TDF2_d, NULL, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df1_order8_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "butter_df1_order8_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_df1_order8_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_df1_order8_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "butter_df1_order8_cut5000", "DF1", DF1_d, NULL, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "butter_df2_order8_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "butter_df2_order8_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_df2_order8_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_df2_order8_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "butter_df2_order8_cut5000", "DF2", DF2_d, NULL, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "butter_tdf2_order8_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "butter_tdf2_order8_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_tdf2_order8_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "butter_tdf2_order8_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "butter_tdf2_order8_cut5000", "TDF2", TDF2_d, NULL, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df1_order2_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby1_df1_order2_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_df1_order2_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_df1_order2_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby1_df1_order2_cut1000", "DF1", DF1_d, NULL, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df2_order2_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby1_df2_order2_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_df2_order2_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_df2_order2_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby1_df2_order2_cut1000", "DF2", DF2_d, NULL, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order2_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order2_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order2_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order2_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby1_tdf2_order2_cut1000", "TDF2", TDF2_d, NULL, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df1_order2_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby1_df1_order2_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_df1_order2_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_df1_order2_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby1_df1_order2_cut2000", "DF1", DF1_d, NULL, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df2_order2_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby1_df2_order2_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_df2_order2_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_df2_order2_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby1_df2_order2_cut2000", "DF2", DF2_d, NULL, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order2_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order2_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order2_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order2_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby1_tdf2_order2_cut2000", "TDF2", TDF2_d, NULL, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df1_order2_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby1_df1_order2_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_df1_order2_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_df1_order2_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby1_df1_order2_cut5000", "DF1", DF1_d, NULL, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df2_order2_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby1_df2_order2_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_df2_order2_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_df2_order2_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby1_df2_order2_cut5000", "DF2", DF2_d, NULL, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order2_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order2_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order2_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order2_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby1_tdf2_order2_cut5000", "TDF2", TDF2_d, NULL, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df1_order4_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby1_df1_order4_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_df1_order4_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_df1_order4_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby1_df1_order4_cut1000", "DF1", DF1_d, NULL, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df2_order4_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby1_df2_order4_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_df2_order4_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_df2_order4_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby1_df2_order4_cut1000", "DF2", DF2_d, NULL, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order4_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order4_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order4_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order4_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby1_tdf2_order4_cut1000", "TDF2", TDF2_d, NULL, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df1_order4_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby1_df1_order4_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_df1_order4_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_df1_order4_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby1_df1_order4_cut2000", "DF1", DF1_d, NULL, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df2_order4_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby1_df2_order4_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_df2_order4_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_df2_order4_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby1_df2_order4_cut2000", "DF2", DF2_d, NULL, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order4_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order4_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order4_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order4_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby1_tdf2_order4_cut2000", "TDF2", TDF2_d, NULL, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df1_order4_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby1_df1_order4_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_df1_order4_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_df1_order4_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby1_df1_order4_cut5000", "DF1", DF1_d, NULL, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df2_order4_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby1_df2_order4_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_df2_order4_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_df2_order4_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby1_df2_order4_cut5000", "DF2", DF2_d, NULL, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order4_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order4_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order4_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order4_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby1_tdf2_order4_cut5000", "TDF2", TDF2_d, NULL, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df1_order6_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby1_df1_order6_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_df1_order6_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_df1_order6_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby1_df1_order6_cut1000", "DF1", DF1_d, NULL, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df2_order6_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby1_df2_order6_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_df2_order6_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_df2_order6_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby1_df2_order6_cut1000", "DF2", DF2_d, NULL, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order6_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order6_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order6_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order6_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby1_tdf2_order6_cut1000", "TDF2", TDF2_d, NULL, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df1_order6_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby1_df1_order6_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_df1_order6_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_df1_order6_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby1_df1_order6_cut2000", "DF1", DF1_d, NULL, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df2_order6_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby1_df2_order6_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_df2_order6_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_df2_order6_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby1_df2_order6_cut2000", "DF2", DF2_d, NULL, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order6_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order6_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order6_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order6_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby1_tdf2_order6_cut2000", "TDF2", TDF2_d, NULL, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df1_order6_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby1_df1_order6_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_df1_order6_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_df1_order6_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby1_df1_order6_cut5000", "DF1", DF1_d, NULL, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df2_order6_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby1_df2_order6_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_df2_order6_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_df2_order6_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby1_df2_order6_cut5000", "DF2", DF2_d, NULL, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order6_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order6_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order6_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order6_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby1_tdf2_order6_cut5000", "TDF2", TDF2_d, NULL, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df1_order8_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby1_df1_order8_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_df1_order8_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_df1_order8_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby1_df1_order8_cut1000", "DF1", DF1_d, NULL, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df2_order8_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby1_df2_order8_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_df2_order8_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_df2_order8_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby1_df2_order8_cut1000", "DF2", DF2_d, NULL, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order8_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order8_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order8_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order8_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby1_tdf2_order8_cut1000", "TDF2", TDF2_d, NULL, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df1_order8_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby1_df1_order8_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_df1_order8_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_df1_order8_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby1_df1_order8_cut2000", "DF1", DF1_d, NULL, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df2_order8_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby1_df2_order8_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_df2_order8_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_df2_order8_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby1_df2_order8_cut2000", "DF2", DF2_d, NULL, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order8_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order8_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order8_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order8_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby1_tdf2_order8_cut2000", "TDF2", TDF2_d, NULL, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df1_order8_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby1_df1_order8_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_df1_order8_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_df1_order8_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby1_df1_order8_cut5000", "DF1", DF1_d, NULL, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_df2_order8_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby1_df2_order8_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_df2_order8_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_df2_order8_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby1_df2_order8_cut5000", "DF2", DF2_d, NULL, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order8_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby1_tdf2_order8_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order8_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby1_tdf2_order8_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby1_tdf2_order8_cut5000", "TDF2", TDF2_d, NULL, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df1_order2_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby2_df1_order2_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_df1_order2_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_df1_order2_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby2_df1_order2_cut1000", "DF1", DF1_d, NULL, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df2_order2_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby2_df2_order2_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_df2_order2_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_df2_order2_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby2_df2_order2_cut1000", "DF2", DF2_d, NULL, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order2_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order2_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order2_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order2_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby2_tdf2_order2_cut1000", "TDF2", TDF2_d, NULL, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df1_order2_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby2_df1_order2_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_df1_order2_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_df1_order2_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby2_df1_order2_cut2000", "DF1", DF1_d, NULL, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df2_order2_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby2_df2_order2_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_df2_order2_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_df2_order2_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby2_df2_order2_cut2000", "DF2", DF2_d, NULL, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order2_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order2_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order2_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order2_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby2_tdf2_order2_cut2000", "TDF2", TDF2_d, NULL, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df1_order2_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby2_df1_order2_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_df1_order2_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_df1_order2_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby2_df1_order2_cut5000", "DF1", DF1_d, NULL, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df2_order2_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby2_df2_order2_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_df2_order2_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_df2_order2_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby2_df2_order2_cut5000", "DF2", DF2_d, NULL, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order2_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order2_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order2_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order2_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "cheby2_tdf2_order2_cut5000", "TDF2", TDF2_d, NULL, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df1_order4_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby2_df1_order4_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_df1_order4_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_df1_order4_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby2_df1_order4_cut1000", "DF1", DF1_d, NULL, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df2_order4_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby2_df2_order4_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_df2_order4_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_df2_order4_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby2_df2_order4_cut1000", "DF2", DF2_d, NULL, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order4_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order4_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order4_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order4_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby2_tdf2_order4_cut1000", "TDF2", TDF2_d, NULL, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df1_order4_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby2_df1_order4_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_df1_order4_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_df1_order4_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby2_df1_order4_cut2000", "DF1", DF1_d, NULL, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df2_order4_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby2_df2_order4_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_df2_order4_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_df2_order4_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby2_df2_order4_cut2000", "DF2", DF2_d, NULL, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order4_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order4_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order4_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order4_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby2_tdf2_order4_cut2000", "TDF2", TDF2_d, NULL, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df1_order4_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby2_df1_order4_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_df1_order4_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_df1_order4_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby2_df1_order4_cut5000", "DF1", DF1_d, NULL, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df2_order4_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby2_df2_order4_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_df2_order4_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_df2_order4_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby2_df2_order4_cut5000", "DF2", DF2_d, NULL, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order4_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order4_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order4_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order4_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "cheby2_tdf2_order4_cut5000", "TDF2", TDF2_d, NULL, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df1_order6_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby2_df1_order6_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_df1_order6_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_df1_order6_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby2_df1_order6_cut1000", "DF1", DF1_d, NULL, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df2_order6_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby2_df2_order6_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_df2_order6_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_df2_order6_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby2_df2_order6_cut1000", "DF2", DF2_d, NULL, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order6_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order6_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order6_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order6_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby2_tdf2_order6_cut1000", "TDF2", TDF2_d, NULL, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df1_order6_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby2_df1_order6_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_df1_order6_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_df1_order6_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby2_df1_order6_cut2000", "DF1", DF1_d, NULL, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df2_order6_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby2_df2_order6_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_df2_order6_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_df2_order6_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby2_df2_order6_cut2000", "DF2", DF2_d, NULL, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order6_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order6_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order6_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order6_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby2_tdf2_order6_cut2000", "TDF2", TDF2_d, NULL, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df1_order6_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby2_df1_order6_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_df1_order6_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_df1_order6_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby2_df1_order6_cut5000", "DF1", DF1_d, NULL, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df2_order6_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby2_df2_order6_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_df2_order6_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_df2_order6_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby2_df2_order6_cut5000", "DF2", DF2_d, NULL, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order6_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order6_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order6_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order6_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "cheby2_tdf2_order6_cut5000", "TDF2", TDF2_d, NULL, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df1_order8_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby2_df1_order8_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_df1_order8_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_df1_order8_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby2_df1_order8_cut1000", "DF1", DF1_d, NULL, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df2_order8_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby2_df2_order8_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_df2_order8_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_df2_order8_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby2_df2_order8_cut1000", "DF2", DF2_d, NULL, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order8_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order8_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order8_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order8_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby2_tdf2_order8_cut1000", "TDF2", TDF2_d, NULL, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df1_order8_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby2_df1_order8_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_df1_order8_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_df1_order8_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby2_df1_order8_cut2000", "DF1", DF1_d, NULL, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df2_order8_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby2_df2_order8_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_df2_order8_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_df2_order8_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby2_df2_order8_cut2000", "DF2", DF2_d, NULL, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order8_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order8_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order8_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order8_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby2_tdf2_order8_cut2000", "TDF2", TDF2_d, NULL, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df1_order8_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby2_df1_order8_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_df1_order8_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_df1_order8_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby2_df1_order8_cut5000", "DF1", DF1_d, NULL, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_df2_order8_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby2_df2_order8_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_df2_order8_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_df2_order8_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby2_df2_order8_cut5000", "DF2", DF2_d, NULL, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order8_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "cheby2_tdf2_order8_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order8_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "cheby2_tdf2_order8_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "cheby2_tdf2_order8_cut5000", "TDF2", TDF2_d, NULL, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df1_order2_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "ellip_df1_order2_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_df1_order2_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_df1_order2_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "ellip_df1_order2_cut1000", "DF1", DF1_d, NULL, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df2_order2_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "ellip_df2_order2_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_df2_order2_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_df2_order2_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "ellip_df2_order2_cut1000", "DF2", DF2_d, NULL, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_tdf2_order2_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "ellip_tdf2_order2_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order2_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order2_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "ellip_tdf2_order2_cut1000", "TDF2", TDF2_d, NULL, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df1_order2_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "ellip_df1_order2_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_df1_order2_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_df1_order2_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "ellip_df1_order2_cut2000", "DF1", DF1_d, NULL, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df2_order2_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "ellip_df2_order2_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_df2_order2_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_df2_order2_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "ellip_df2_order2_cut2000", "DF2", DF2_d, NULL, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_tdf2_order2_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "ellip_tdf2_order2_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order2_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order2_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "ellip_tdf2_order2_cut2000", "TDF2", TDF2_d, NULL, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df1_order2_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "ellip_df1_order2_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_df1_order2_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_df1_order2_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "ellip_df1_order2_cut5000", "DF1", DF1_d, NULL, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df2_order2_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "ellip_df2_order2_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_df2_order2_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_df2_order2_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "ellip_df2_order2_cut5000", "DF2", DF2_d, NULL, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_tdf2_order2_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "ellip_tdf2_order2_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order2_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order2_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "ellip_tdf2_order2_cut5000", "TDF2", TDF2_d, NULL, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df1_order4_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "ellip_df1_order4_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_df1_order4_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_df1_order4_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "ellip_df1_order4_cut1000", "DF1", DF1_d, NULL, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df2_order4_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "ellip_df2_order4_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_df2_order4_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_df2_order4_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "ellip_df2_order4_cut1000", "DF2", DF2_d, NULL, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_tdf2_order4_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "ellip_tdf2_order4_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order4_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order4_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "ellip_tdf2_order4_cut1000", "TDF2", TDF2_d, NULL, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df1_order4_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "ellip_df1_order4_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_df1_order4_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_df1_order4_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "ellip_df1_order4_cut2000", "DF1", DF1_d, NULL, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df2_order4_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "ellip_df2_order4_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_df2_order4_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_df2_order4_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "ellip_df2_order4_cut2000", "DF2", DF2_d, NULL, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_tdf2_order4_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "ellip_tdf2_order4_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order4_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order4_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "ellip_tdf2_order4_cut2000", "TDF2", TDF2_d, NULL, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df1_order4_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "ellip_df1_order4_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_df1_order4_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_df1_order4_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "ellip_df1_order4_cut5000", "DF1", DF1_d, NULL, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df2_order4_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "ellip_df2_order4_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_df2_order4_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_df2_order4_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "ellip_df2_order4_cut5000", "DF2", DF2_d, NULL, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_tdf2_order4_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "ellip_tdf2_order4_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order4_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order4_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "ellip_tdf2_order4_cut5000", "TDF2", TDF2_d, NULL, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df1_order6_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "ellip_df1_order6_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_df1_order6_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_df1_order6_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "ellip_df1_order6_cut1000", "DF1", DF1_d, NULL, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df2_order6_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "ellip_df2_order6_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_df2_order6_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_df2_order6_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "ellip_df2_order6_cut1000", "DF2", DF2_d, NULL, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_tdf2_order6_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "ellip_tdf2_order6_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order6_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order6_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "ellip_tdf2_order6_cut1000", "TDF2", TDF2_d, NULL, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df1_order6_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "ellip_df1_order6_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_df1_order6_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_df1_order6_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "ellip_df1_order6_cut2000", "DF1", DF1_d, NULL, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df2_order6_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "ellip_df2_order6_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_df2_order6_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_df2_order6_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "ellip_df2_order6_cut2000", "DF2", DF2_d, NULL, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_tdf2_order6_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "ellip_tdf2_order6_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order6_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order6_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "ellip_tdf2_order6_cut2000", "TDF2", TDF2_d, NULL, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df1_order6_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "ellip_df1_order6_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_df1_order6_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_df1_order6_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "ellip_df1_order6_cut5000", "DF1", DF1_d, NULL, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df2_order6_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "ellip_df2_order6_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_df2_order6_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_df2_order6_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "ellip_df2_order6_cut5000", "DF2", DF2_d, NULL, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_tdf2_order6_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "ellip_tdf2_order6_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order6_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order6_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "ellip_tdf2_order6_cut5000", "TDF2", TDF2_d, NULL, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df1_order8_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "ellip_df1_order8_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_df1_order8_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_df1_order8_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "ellip_df1_order8_cut1000", "DF1", DF1_d, NULL, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df2_order8_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "ellip_df2_order8_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_df2_order8_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_df2_order8_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "ellip_df2_order8_cut1000", "DF2", DF2_d, NULL, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_tdf2_order8_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "ellip_tdf2_order8_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order8_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order8_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "ellip_tdf2_order8_cut1000", "TDF2", TDF2_d, NULL, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df1_order8_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "ellip_df1_order8_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_df1_order8_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_df1_order8_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "ellip_df1_order8_cut2000", "DF1", DF1_d, NULL, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df2_order8_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "ellip_df2_order8_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_df2_order8_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_df2_order8_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "ellip_df2_order8_cut2000", "DF2", DF2_d, NULL, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_tdf2_order8_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "ellip_tdf2_order8_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order8_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order8_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "ellip_tdf2_order8_cut2000", "TDF2", TDF2_d, NULL, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df1_order8_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "ellip_df1_order8_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_df1_order8_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_df1_order8_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "ellip_df1_order8_cut5000", "DF1", DF1_d, NULL, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_df2_order8_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "ellip_df2_order8_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_df2_order8_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_df2_order8_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "ellip_df2_order8_cut5000", "DF2", DF2_d, NULL, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "ellip_tdf2_order8_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "ellip_tdf2_order8_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order8_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "ellip_tdf2_order8_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "ellip_tdf2_order8_cut5000", "TDF2", TDF2_d, NULL, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df1_order2_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "bessel_df1_order2_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_df1_order2_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_df1_order2_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "bessel_df1_order2_cut1000", "DF1", DF1_d, NULL, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df2_order2_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "bessel_df2_order2_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_df2_order2_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_df2_order2_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "bessel_df2_order2_cut1000", "DF2", DF2_d, NULL, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_tdf2_order2_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "bessel_tdf2_order2_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order2_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order2_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "bessel_tdf2_order2_cut1000", "TDF2", TDF2_d, NULL, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df1_order2_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "bessel_df1_order2_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_df1_order2_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_df1_order2_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "bessel_df1_order2_cut2000", "DF1", DF1_d, NULL, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df2_order2_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "bessel_df2_order2_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_df2_order2_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_df2_order2_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "bessel_df2_order2_cut2000", "DF2", DF2_d, NULL, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_tdf2_order2_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "bessel_tdf2_order2_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order2_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order2_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "bessel_tdf2_order2_cut2000", "TDF2", TDF2_d, NULL, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df1_order2_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "bessel_df1_order2_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_df1_order2_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_df1_order2_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "bessel_df1_order2_cut5000", "DF1", DF1_d, NULL, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df2_order2_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "bessel_df2_order2_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_df2_order2_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_df2_order2_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "bessel_df2_order2_cut5000", "DF2", DF2_d, NULL, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_tdf2_order2_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_q(fp_precision, "bessel_tdf2_order2_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order2_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order2_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3);
+    precision_analysis_qn(fp_qn, "bessel_tdf2_order2_cut5000", "TDF2", TDF2_d, NULL, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df1_order4_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "bessel_df1_order4_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_df1_order4_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_df1_order4_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "bessel_df1_order4_cut1000", "DF1", DF1_d, NULL, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df2_order4_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "bessel_df2_order4_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_df2_order4_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_df2_order4_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "bessel_df2_order4_cut1000", "DF2", DF2_d, NULL, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_tdf2_order4_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "bessel_tdf2_order4_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order4_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order4_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "bessel_tdf2_order4_cut1000", "TDF2", TDF2_d, NULL, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df1_order4_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "bessel_df1_order4_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_df1_order4_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_df1_order4_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "bessel_df1_order4_cut2000", "DF1", DF1_d, NULL, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df2_order4_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "bessel_df2_order4_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_df2_order4_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_df2_order4_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "bessel_df2_order4_cut2000", "DF2", DF2_d, NULL, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_tdf2_order4_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "bessel_tdf2_order4_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order4_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order4_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "bessel_tdf2_order4_cut2000", "TDF2", TDF2_d, NULL, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df1_order4_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "bessel_df1_order4_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_df1_order4_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_df1_order4_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "bessel_df1_order4_cut5000", "DF1", DF1_d, NULL, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df2_order4_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "bessel_df2_order4_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_df2_order4_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_df2_order4_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "bessel_df2_order4_cut5000", "DF2", DF2_d, NULL, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_tdf2_order4_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_q(fp_precision, "bessel_tdf2_order4_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order4_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order4_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5);
+    precision_analysis_qn(fp_qn, "bessel_tdf2_order4_cut5000", "TDF2", TDF2_d, NULL, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df1_order6_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "bessel_df1_order6_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_df1_order6_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_df1_order6_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "bessel_df1_order6_cut1000", "DF1", DF1_d, NULL, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df2_order6_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "bessel_df2_order6_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_df2_order6_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_df2_order6_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "bessel_df2_order6_cut1000", "DF2", DF2_d, NULL, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_tdf2_order6_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "bessel_tdf2_order6_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order6_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order6_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "bessel_tdf2_order6_cut1000", "TDF2", TDF2_d, NULL, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df1_order6_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "bessel_df1_order6_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_df1_order6_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_df1_order6_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "bessel_df1_order6_cut2000", "DF1", DF1_d, NULL, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df2_order6_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "bessel_df2_order6_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_df2_order6_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_df2_order6_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "bessel_df2_order6_cut2000", "DF2", DF2_d, NULL, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_tdf2_order6_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "bessel_tdf2_order6_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order6_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order6_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "bessel_tdf2_order6_cut2000", "TDF2", TDF2_d, NULL, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df1_order6_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "bessel_df1_order6_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_df1_order6_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_df1_order6_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "bessel_df1_order6_cut5000", "DF1", DF1_d, NULL, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df2_order6_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "bessel_df2_order6_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_df2_order6_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_df2_order6_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "bessel_df2_order6_cut5000", "DF2", DF2_d, NULL, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_tdf2_order6_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_q(fp_precision, "bessel_tdf2_order6_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order6_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order6_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7);
+    precision_analysis_qn(fp_qn, "bessel_tdf2_order6_cut5000", "TDF2", TDF2_d, NULL, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df1_order8_cut1000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "bessel_df1_order8_cut1000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_df1_order8_cut1000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_df1_order8_cut1000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "bessel_df1_order8_cut1000", "DF1", DF1_d, NULL, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df2_order8_cut1000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "bessel_df2_order8_cut1000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_df2_order8_cut1000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_df2_order8_cut1000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "bessel_df2_order8_cut1000", "DF2", DF2_d, NULL, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_tdf2_order8_cut1000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "bessel_tdf2_order8_cut1000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order8_cut1000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order8_cut1000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "bessel_tdf2_order8_cut1000", "TDF2", TDF2_d, NULL, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df1_order8_cut2000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "bessel_df1_order8_cut2000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_df1_order8_cut2000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_df1_order8_cut2000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "bessel_df1_order8_cut2000", "DF1", DF1_d, NULL, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df2_order8_cut2000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "bessel_df2_order8_cut2000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_df2_order8_cut2000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_df2_order8_cut2000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "bessel_df2_order8_cut2000", "DF2", DF2_d, NULL, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_tdf2_order8_cut2000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "bessel_tdf2_order8_cut2000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order8_cut2000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order8_cut2000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "bessel_tdf2_order8_cut2000", "TDF2", TDF2_d, NULL, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df1_order8_cut5000", "DF1", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24, DF1_d, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "bessel_df1_order8_cut5000", "DF1", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12, DF1_d, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_df1_order8_cut5000", "DF1_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF1_q24_acc, DF1_d, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_df1_order8_cut5000", "DF1_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF1_q12_acc, DF1_d, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "bessel_df1_order8_cut5000", "DF1", DF1_d, NULL, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_df2_order8_cut5000", "DF2", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24, DF2_d, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "bessel_df2_order8_cut5000", "DF2", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12, DF2_d, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_df2_order8_cut5000", "DF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))DF2_q24_acc, DF2_d, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_df2_order8_cut5000", "DF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))DF2_q12_acc, DF2_d, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "bessel_df2_order8_cut5000", "DF2", DF2_d, NULL, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9, NULL, 0);
     precision_analysis_q(fp_precision, "bessel_tdf2_order8_cut5000", "TDF2", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24, TDF2_d, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_q(fp_precision, "bessel_tdf2_order8_cut5000", "TDF2", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12, TDF2_d, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order8_cut5000", "TDF2_ACC", 24, (void (*)(void*, void*, void*, void*, int, int))TDF2_q24_acc, TDF2_d, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_q(fp_precision, "bessel_tdf2_order8_cut5000", "TDF2_ACC", 12, (void (*)(void*, void*, void*, void*, int, int))TDF2_q12_acc, TDF2_d, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9);
+    precision_analysis_qn(fp_qn, "bessel_tdf2_order8_cut5000", "TDF2", TDF2_d, NULL, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9, NULL, 0);
 
     // --- CASCADE (SOS) ---
 
     precision_analysis_sos(fp_precision, "butter_cascade_order2_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "butter_cascade_order2_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "butter_cascade_order2_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "butter_cascade_order2_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, butter_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "butter_cascade_order2_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "butter_cascade_order2_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "butter_cascade_order2_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "butter_cascade_order2_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, butter_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "butter_cascade_order2_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "butter_cascade_order2_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "butter_cascade_order2_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "butter_cascade_order2_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, butter_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "butter_cascade_order4_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "butter_cascade_order4_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "butter_cascade_order4_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "butter_cascade_order4_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, butter_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "butter_cascade_order4_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "butter_cascade_order4_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "butter_cascade_order4_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "butter_cascade_order4_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, butter_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "butter_cascade_order4_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "butter_cascade_order4_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "butter_cascade_order4_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "butter_cascade_order4_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, butter_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "butter_cascade_order6_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "butter_cascade_order6_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "butter_cascade_order6_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "butter_cascade_order6_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, butter_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "butter_cascade_order6_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "butter_cascade_order6_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "butter_cascade_order6_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "butter_cascade_order6_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, butter_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "butter_cascade_order6_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "butter_cascade_order6_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "butter_cascade_order6_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "butter_cascade_order6_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, butter_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "butter_cascade_order8_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "butter_cascade_order8_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "butter_cascade_order8_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "butter_cascade_order8_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, butter_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "butter_cascade_order8_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "butter_cascade_order8_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "butter_cascade_order8_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "butter_cascade_order8_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, butter_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "butter_cascade_order8_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut5000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "butter_cascade_order8_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "butter_cascade_order8_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, butter_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "butter_cascade_order8_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, butter_cascade_order8_cut5000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "cheby1_cascade_order2_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "cheby1_cascade_order2_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby1_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "cheby1_cascade_order2_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "cheby1_cascade_order2_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby1_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "cheby1_cascade_order2_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "cheby1_cascade_order2_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby1_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "cheby1_cascade_order4_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "cheby1_cascade_order4_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby1_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "cheby1_cascade_order4_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "cheby1_cascade_order4_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby1_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "cheby1_cascade_order4_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "cheby1_cascade_order4_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby1_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "cheby1_cascade_order6_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "cheby1_cascade_order6_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby1_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "cheby1_cascade_order6_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "cheby1_cascade_order6_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby1_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "cheby1_cascade_order6_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "cheby1_cascade_order6_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby1_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "cheby1_cascade_order8_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "cheby1_cascade_order8_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby1_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "cheby1_cascade_order8_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "cheby1_cascade_order8_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby1_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut5000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "cheby1_cascade_order8_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby1_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "cheby1_cascade_order8_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby1_cascade_order8_cut5000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "cheby2_cascade_order2_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "cheby2_cascade_order2_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby2_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "cheby2_cascade_order2_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "cheby2_cascade_order2_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby2_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "cheby2_cascade_order2_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "cheby2_cascade_order2_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby2_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "cheby2_cascade_order4_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "cheby2_cascade_order4_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby2_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "cheby2_cascade_order4_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "cheby2_cascade_order4_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby2_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "cheby2_cascade_order4_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "cheby2_cascade_order4_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby2_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "cheby2_cascade_order6_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "cheby2_cascade_order6_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby2_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "cheby2_cascade_order6_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "cheby2_cascade_order6_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby2_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "cheby2_cascade_order6_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "cheby2_cascade_order6_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby2_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "cheby2_cascade_order8_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "cheby2_cascade_order8_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby2_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "cheby2_cascade_order8_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "cheby2_cascade_order8_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby2_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut5000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "cheby2_cascade_order8_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, cheby2_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "cheby2_cascade_order8_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, cheby2_cascade_order8_cut5000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "ellip_cascade_order2_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "ellip_cascade_order2_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, ellip_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "ellip_cascade_order2_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "ellip_cascade_order2_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, ellip_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "ellip_cascade_order2_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "ellip_cascade_order2_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, ellip_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "ellip_cascade_order4_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "ellip_cascade_order4_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, ellip_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "ellip_cascade_order4_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "ellip_cascade_order4_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, ellip_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "ellip_cascade_order4_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "ellip_cascade_order4_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, ellip_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "ellip_cascade_order6_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "ellip_cascade_order6_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, ellip_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "ellip_cascade_order6_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "ellip_cascade_order6_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, ellip_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "ellip_cascade_order6_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "ellip_cascade_order6_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, ellip_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "ellip_cascade_order8_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "ellip_cascade_order8_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, ellip_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "ellip_cascade_order8_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "ellip_cascade_order8_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, ellip_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut5000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "ellip_cascade_order8_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, ellip_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "ellip_cascade_order8_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, ellip_cascade_order8_cut5000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "bessel_cascade_order2_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "bessel_cascade_order2_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, bessel_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "bessel_cascade_order2_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "bessel_cascade_order2_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, bessel_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_bfp16(fp_precision, "bessel_cascade_order2_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_qn(fp_qn, "bessel_cascade_order2_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, bessel_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "bessel_cascade_order4_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "bessel_cascade_order4_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, bessel_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "bessel_cascade_order4_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "bessel_cascade_order4_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, bessel_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_bfp16(fp_precision, "bessel_cascade_order4_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_qn(fp_qn, "bessel_cascade_order4_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, bessel_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "bessel_cascade_order6_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "bessel_cascade_order6_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, bessel_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "bessel_cascade_order6_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "bessel_cascade_order6_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, bessel_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_bfp16(fp_precision, "bessel_cascade_order6_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_qn(fp_qn, "bessel_cascade_order6_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, bessel_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut1000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut1000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut1000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut1000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut1000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut1000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut1000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut1000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "bessel_cascade_order8_cut1000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "bessel_cascade_order8_cut1000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, bessel_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut2000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut2000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut2000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut2000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut2000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut2000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut2000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut2000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "bessel_cascade_order8_cut2000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "bessel_cascade_order8_cut2000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, bessel_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut5000", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut5000_f64_sos, 4);
     precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut5000", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut5000", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut5000", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut5000", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut5000", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut5000", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut5000", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_bfp16(fp_precision, "bessel_cascade_order8_cut5000", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, bessel_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_qn(fp_qn, "bessel_cascade_order8_cut5000", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, bessel_cascade_order8_cut5000_f64_sos, 4);
 
     fclose(fp_precision);
+    fclose(fp_qn);
+
+    FILE *fp_mc = fopen("c_fixed_mc_exactness_results.csv", "w");
+    if (!fp_mc) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+    fprintf(fp_mc, "filter_name,type,structure,cutoff,order,channels,layout,mismatches\n");
+
+    long mc_total = 0;
+    mc_total += mc_exactness_check(fp_mc, "butter_tdf2_order2_cut1000", 24, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3, NULL, 0);
+    mc_total += mc_exactness_check(fp_mc, "butter_tdf2_order2_cut1000", 12, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3, NULL, 0);
+    mc_total += mc_exactness_check(fp_mc, "butter_tdf2_order4_cut1000", 24, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5, NULL, 0);
+    mc_total += mc_exactness_check(fp_mc, "butter_tdf2_order4_cut1000", 12, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5, NULL, 0);
+    mc_total += mc_exactness_check(fp_mc, "ellip_tdf2_order8_cut1000", 24, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9, NULL, 0);
+    mc_total += mc_exactness_check(fp_mc, "ellip_tdf2_order8_cut1000", 12, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9, NULL, 0);
+    mc_total += mc_exactness_check(fp_mc, "butter_cascade_order2_cut1000", 24, NULL, NULL, 0, butter_cascade_order2_cut1000_f64_sos, 1);
+    mc_total += mc_exactness_check(fp_mc, "butter_cascade_order2_cut1000", 12, NULL, NULL, 0, butter_cascade_order2_cut1000_f64_sos, 1);
+    mc_total += mc_exactness_check(fp_mc, "butter_cascade_order4_cut1000", 24, NULL, NULL, 0, butter_cascade_order4_cut1000_f64_sos, 2);
+    mc_total += mc_exactness_check(fp_mc, "butter_cascade_order4_cut1000", 12, NULL, NULL, 0, butter_cascade_order4_cut1000_f64_sos, 2);
+    mc_total += mc_exactness_check(fp_mc, "ellip_cascade_order8_cut1000", 24, NULL, NULL, 0, ellip_cascade_order8_cut1000_f64_sos, 4);
+    mc_total += mc_exactness_check(fp_mc, "ellip_cascade_order8_cut1000", 12, NULL, NULL, 0, ellip_cascade_order8_cut1000_f64_sos, 4);
+
+    fclose(fp_mc);
+    printf("[LOG] SIMD vs scalar: %ld mismatches in total\n", mc_total);
+    pool_release();
     return 0;
 }
\ No newline at end of file
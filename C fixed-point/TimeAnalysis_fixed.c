@@ -2,20 +2,49 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
-#include <windows.h>
 #include "./lib/fixedpointQ24.h"
 #include "./lib/structuresQ24s.h"
 #include "./lib/fixedpointQ12.h"
 #include "./lib/structuresQ12s.h"
+#include "./lib/structuresQ24acc.h"
+#include "./lib/structuresQ12acc.h"
+#include "./lib/structuresQ24ef.h"
+#include "./lib/structuresQ12ef.h"
+#include "./lib/multichannelQ24.h"
+#include "./lib/multichannelQ12.h"
+#include "./lib/satstats.h"
+#include "./lib/structuresQn.h"
+#include "./lib/structuresBFP16.h"
 #include "../_filtercoeffs/filtercoeffs.h"
-
+#include "../C/lib/runtimespec.h"
+#include "../C/lib/timing.h"
+#include "../C/lib/runner.h"
+#include "../C/lib/perfcounters.h"
+#include "../C/lib/benchparams.h"
+#include "../C/lib/siggen.h"
+#include "../C/lib/latency.h"
+#include "../C/lib/rtsim.h"
+
+// Wartości domyślne; n=, fs=, block= w linii poleceń (../C/lib/benchparams.h)
 #define FS 48000
 #define DURATION_MIN 1
 int N = (FS * 60 * DURATION_MIN);
 
 // Analiza szybkości filtrowania w języku C (reprezentacja stałopozycyjna)
 
-//Kompilacja: gcc -o TimeAnalysis_fixed TimeAnalysis_fixed.c ./lib/fixedpointQ24.c ./lib/fixedpointQ12.c ./lib/structuresQ24s.c ./lib/structuresQ12s.c ../_filtercoeffs/filtercoeffs.c
+//Kompilacja: gcc -o TimeAnalysis_fixed TimeAnalysis_fixed.c ./lib/fixedpointQ24.c ./lib/fixedpointQ12.c ./lib/structuresQ24s.c ./lib/structuresQ12s.c ./lib/structuresQ24acc.c ./lib/structuresQ12acc.c ./lib/structuresQ24ef.c ./lib/structuresQ12ef.c ../_filtercoeffs/filtercoeffs.c ../C/lib/runtimespec.c ../C/lib/timing.c ../C/lib/runner.c ../C/lib/perfcounters.c ../C/lib/bufpool.c ../C/lib/benchparams.c ../C/lib/siggen.c ../C/lib/latency.c ../C/lib/rtsim.c ./lib/multichannelQ24.c ./lib/multichannelQ12.c ./lib/satstats.c ./lib/structuresQn.c ./lib/fixedpointBFP16.c ./lib/structuresBFP16.c -O3 -march=native -lpthread -ldl -lm
+//Wersja inline:  dodać -DFIXEDPOINT_INLINE (operacje w nagłówkach, saturacja bez skoków)
+//                 oraz -DFIXEDPOINT_COUNT=0, aby wyłączyć zliczanie przepełnień
+//Telemetria saturacji (kolumny sat_*, poza mierzonym czasem): -DSAT_TELEMETRY=0 ją wyłącza
+
+// Pliki wyników wersji inline dostają przyrostek, żeby oba warianty można było porównać
+#if defined(FIXEDPOINT_INLINE) && FIXEDPOINT_COUNT
+#define RESULTS_SUFFIX "_inline"
+#elif defined(FIXEDPOINT_INLINE)
+#define RESULTS_SUFFIX "_inline_nocount"
+#else
+#define RESULTS_SUFFIX ""
+#endif
 
 // === Globalne liczniki (nieuzywane tu) ===
 int q24_overflow_count = 0;
@@ -25,18 +54,23 @@ int q24_underflow_count = 0;
 int q12_underflow_count = 0;
 
 // === Szum ===
+// Za każdym razem ten sam sygnał (SIGGEN_SEED), niezależnie od platformy
+void generate_white_noise_d(double *x, int N) {
+    siggen g;
+    siggen_init(&g, SG_WHITE, SIGGEN_SEED, 1.0, 0.0, 0.0, 0.0, 0);
+    siggen_block_d(&g, x, N);
+}
+
 void generate_white_noise_q24(q24 *x, int N) {
-    for (int i = 0; i < N; ++i) {
-        double r = 2.0 * ((double)rand() / RAND_MAX) - 1.0;
-        x[i] = double_to_q24(r);
-    }
+    siggen g;
+    siggen_init(&g, SG_WHITE, SIGGEN_SEED, 1.0, 0.0, 0.0, 0.0, 0);
+    siggen_block_q32(&g, x, N, Q24_SHIFT);
 }
 
 void generate_white_noise_q12(q12 *x, int N) {
-    for (int i = 0; i < N; ++i) {
-        double r = 2.0 * ((double)rand() / RAND_MAX) - 1.0;
-        x[i] = double_to_q12(r);
-    }
+    siggen g;
+    siggen_init(&g, SG_WHITE, SIGGEN_SEED, 1.0, 0.0, 0.0, 0.0, 0);
+    siggen_block_q16(&g, x, N, Q12_SHIFT);
 }
 
 // === Konwersje współczynników ===
@@ -75,7 +109,11 @@ void benchmark_fixed_q24(FILE *fp, const char *filter_name, const char *structur
                          void (*func)(q24*, q24*, q24*, q24*, int, int),
                          const double *b_d, const double *a_d, int order) {
     
-    LARGE_INTEGER freq, start, end;
+    timing_t start, end;
+    sat_stats st = {0};
+    perf_sample ps;
+    pool_faults pf0, pf1;
+    int step = bench_step(N);
     double time_spent;
     int cutoff = -1;
 
@@ -85,33 +123,49 @@ void benchmark_fixed_q24(FILE *fp, const char *filter_name, const char *structur
     char *cut_ptr = strstr(filter_name, "_cut");
     if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-    q24 *x = malloc(sizeof(q24) * N);
-    q24 *y = malloc(sizeof(q24) * N);
+    q24 *x = pool_buffer(POOL_X, sizeof(q24) * N);
+    q24 *y = pool_buffer(POOL_Y, sizeof(q24) * N);
     q24 *b_q = malloc(sizeof(q24) * order);
     q24 *a_q = malloc(sizeof(q24) * order);
 
     convert_ba_to_q24(b_d, a_d, b_q, a_q, order);
     generate_white_noise_q24(x, N);
 
-    QueryPerformanceFrequency(&freq);
-    QueryPerformanceCounter(&start);
-
-    func(x, y, b_q, a_q, N, order);
-
-    QueryPerformanceCounter(&end);
-    time_spent = (double)(end.QuadPart - start.QuadPart) / (double)freq.QuadPart;
-
-    fprintf(fp, "%s,q24,%s,%d,%d,%.6f\n", filter_type, structure, cutoff, order - 1, time_spent);
+    sat_begin();
+    pool_faults_now(&pf0);
+    perf_start();
+    start = timing_now();
+
+    for (int off = 0; off < N; off += step)
+        func(x + off, y + off, b_q, a_q, (N - off < step) ? N - off : step, order);
+
+    end = timing_now();
+    perf_stop(&ps);
+    pool_faults_now(&pf1);
+    time_spent = timing_seconds(start, end);
+    sat_end(&st);
+
+    fprintf(fp, "%s,q24,%s,%d,%d,%.6f", filter_type, structure, cutoff, order - 1, time_spent);
+    bench_fprint_columns(fp, time_spent, BLOCK_RESTART, &pf0, &pf1);
+    runner_report(time_spent, "%s,q24,%s,%d,%d", filter_type, structure, cutoff, order - 1);
+    sat_fprint_columns(fp, &st, 1);
+    perf_fprint_columns(fp, &ps, N);
+    fprintf(fp, "\n");
     printf("[LOG] %s (q24, %s, cut %d, order %d): %.6f sec\n", filter_type, structure, cutoff, order - 1, time_spent);
 
-    free(x); free(y); free(b_q); free(a_q);
+    free(b_q); free(a_q);
 }
 
-void benchmark_cascade_q24(FILE *fp, const char *filter_name,
-                            void (*func)(q24*, q24*, q24*, int, int),
-                            const double sos_d[][6], int sections) {
+// Kernel SOS z dowolną etykietą struktury (CASCADE, CASCADE_ACC)
+void benchmark_sos_q24(FILE *fp, const char *filter_name, const char *structure,
+                       void (*func)(q24*, q24*, q24*, int, int),
+                       const double sos_d[][6], int sections) {
     
-    LARGE_INTEGER freq, start, end;
+    timing_t start, end;
+    sat_stats st = {0};
+    perf_sample ps;
+    pool_faults pf0, pf1;
+    int step = bench_step(N);
     double time_spent;
     int cutoff = -1;
 
@@ -121,25 +175,42 @@ void benchmark_cascade_q24(FILE *fp, const char *filter_name,
     char *cut_ptr = strstr(filter_name, "_cut");
     if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-    q24 *x = malloc(sizeof(q24) * N);
-    q24 *y = malloc(sizeof(q24) * N);
+    q24 *x = pool_buffer(POOL_X, sizeof(q24) * N);
+    q24 *y = pool_buffer(POOL_Y, sizeof(q24) * N);
     q24 (*sos_q)[6] = malloc(sizeof(q24) * 6 * sections);
 
     convert_sos_to_q24(sos_d, sos_q, sections);
     generate_white_noise_q24(x, N);
 
-    QueryPerformanceFrequency(&freq);
-    QueryPerformanceCounter(&start);
-
-    func(x, y, (q24*)sos_q, N, sections);
-
-    QueryPerformanceCounter(&end);
-    time_spent = (double)(end.QuadPart - start.QuadPart) / (double)freq.QuadPart;
-
-    fprintf(fp, "%s,q24,CASCADE,%d,%d,%.6f\n", filter_type, cutoff, 2 * sections, time_spent);
-    printf("[LOG] %s (q24, CASCADE, cut %d, order %d): %.6f sec\n", filter_type, cutoff, 2 * sections, time_spent);
+    sat_begin();
+    pool_faults_now(&pf0);
+    perf_start();
+    start = timing_now();
+
+    for (int off = 0; off < N; off += step)
+        func(x + off, y + off, (q24*)sos_q, (N - off < step) ? N - off : step, sections);
+
+    end = timing_now();
+    perf_stop(&ps);
+    pool_faults_now(&pf1);
+    time_spent = timing_seconds(start, end);
+    sat_end(&st);
+
+    fprintf(fp, "%s,q24,%s,%d,%d,%.6f", filter_type, structure, cutoff, 2 * sections, time_spent);
+    bench_fprint_columns(fp, time_spent, BLOCK_RESTART, &pf0, &pf1);
+    runner_report(time_spent, "%s,q24,%s,%d,%d", filter_type, structure, cutoff, 2 * sections);
+    sat_fprint_columns(fp, &st, sections);
+    perf_fprint_columns(fp, &ps, N);
+    fprintf(fp, "\n");
+    printf("[LOG] %s (q24, %s, cut %d, order %d): %.6f sec\n", filter_type, structure, cutoff, 2 * sections, time_spent);
+
+    free(sos_q);
+}
 
-    free(x); free(y); free(sos_q);
+void benchmark_cascade_q24(FILE *fp, const char *filter_name,
+                            void (*func)(q24*, q24*, q24*, int, int),
+                            const double sos_d[][6], int sections) {
+    benchmark_sos_q24(fp, filter_name, "CASCADE", func, sos_d, sections);
 }
 
 // === Q5.11 ===
@@ -147,7 +218,11 @@ void benchmark_fixed_q12(FILE *fp, const char *filter_name, const char *structur
                          void (*func)(q12*, q12*, q12*, q12*, int, int),
                          const double *b_d, const double *a_d, int order) {
     
-    LARGE_INTEGER freq, start, end;
+    timing_t start, end;
+    sat_stats st = {0};
+    perf_sample ps;
+    pool_faults pf0, pf1;
+    int step = bench_step(N);
     double time_spent;
     int cutoff = -1;
 
@@ -157,33 +232,49 @@ void benchmark_fixed_q12(FILE *fp, const char *filter_name, const char *structur
     char *cut_ptr = strstr(filter_name, "_cut");
     if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-    q12 *x = malloc(sizeof(q12) * N);
-    q12 *y = malloc(sizeof(q12) * N);
+    q12 *x = pool_buffer(POOL_X, sizeof(q12) * N);
+    q12 *y = pool_buffer(POOL_Y, sizeof(q12) * N);
     q12 *b_q = malloc(sizeof(q12) * order);
     q12 *a_q = malloc(sizeof(q12) * order);
 
     convert_ba_to_q12(b_d, a_d, b_q, a_q, order);
     generate_white_noise_q12(x, N);
 
-    QueryPerformanceFrequency(&freq);
-    QueryPerformanceCounter(&start);
+    sat_begin();
+    pool_faults_now(&pf0);
+    perf_start();
+    start = timing_now();
 
-    func(x, y, b_q, a_q, N, order);
+    for (int off = 0; off < N; off += step)
+        func(x + off, y + off, b_q, a_q, (N - off < step) ? N - off : step, order);
     
-    QueryPerformanceCounter(&end);
-    time_spent = (double)(end.QuadPart - start.QuadPart) / (double)freq.QuadPart;
-
-    fprintf(fp, "%s,q12,%s,%d,%d,%.6f\n", filter_type, structure, cutoff, order - 1, time_spent);
+    end = timing_now();
+    perf_stop(&ps);
+    pool_faults_now(&pf1);
+    time_spent = timing_seconds(start, end);
+    sat_end(&st);
+
+    fprintf(fp, "%s,q12,%s,%d,%d,%.6f", filter_type, structure, cutoff, order - 1, time_spent);
+    bench_fprint_columns(fp, time_spent, BLOCK_RESTART, &pf0, &pf1);
+    runner_report(time_spent, "%s,q12,%s,%d,%d", filter_type, structure, cutoff, order - 1);
+    sat_fprint_columns(fp, &st, 1);
+    perf_fprint_columns(fp, &ps, N);
+    fprintf(fp, "\n");
     printf("[LOG] %s (q12, %s, cut %d, order %d): %.6f sec\n", filter_type, structure, cutoff, order - 1, time_spent);
 
-    free(x); free(y); free(b_q); free(a_q);
+    free(b_q); free(a_q);
 }
 
-void benchmark_cascade_q12(FILE *fp, const char *filter_name,
-                            void (*func)(q12*, q12*, q12*, int, int),
-                            const double sos_d[][6], int sections) {
+// Kernel SOS z dowolną etykietą struktury (CASCADE, CASCADE_ACC)
+void benchmark_sos_q12(FILE *fp, const char *filter_name, const char *structure,
+                       void (*func)(q12*, q12*, q12*, int, int),
+                       const double sos_d[][6], int sections) {
     
-    LARGE_INTEGER freq, start, end;
+    timing_t start, end;
+    sat_stats st = {0};
+    perf_sample ps;
+    pool_faults pf0, pf1;
+    int step = bench_step(N);
     double time_spent;
     int cutoff = -1;
 
@@ -193,760 +284,2645 @@ void benchmark_cascade_q12(FILE *fp, const char *filter_name,
     char *cut_ptr = strstr(filter_name, "_cut");
     if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-    q12 *x = malloc(sizeof(q12) * N);
-    q12 *y = malloc(sizeof(q12) * N);
+    q12 *x = pool_buffer(POOL_X, sizeof(q12) * N);
+    q12 *y = pool_buffer(POOL_Y, sizeof(q12) * N);
     q12 (*sos_q)[6] = malloc(sizeof(q12) * 6 * sections);
 
     convert_sos_to_q12(sos_d, sos_q, sections);
     generate_white_noise_q12(x, N);
 
-    QueryPerformanceFrequency(&freq);
-    QueryPerformanceCounter(&start);
+    sat_begin();
+    pool_faults_now(&pf0);
+    perf_start();
+    start = timing_now();
 
-    func(x, y, (q12*)sos_q, N, sections);
+    for (int off = 0; off < N; off += step)
+        func(x + off, y + off, (q12*)sos_q, (N - off < step) ? N - off : step, sections);
     
-    QueryPerformanceCounter(&end);
-    time_spent = (double)(end.QuadPart - start.QuadPart) / (double)freq.QuadPart;
-
-    fprintf(fp, "%s,q12,CASCADE,%d,%d,%.6f\n", filter_type, cutoff, 2 * sections, time_spent);
-    printf("[LOG] %s (q12, CASCADE, cut %d, order %d): %.6f sec\n", filter_type, cutoff, 2 * sections, time_spent);
-
-    free(x); free(y); free(sos_q);
+    end = timing_now();
+    perf_stop(&ps);
+    pool_faults_now(&pf1);
+    time_spent = timing_seconds(start, end);
+    sat_end(&st);
+
+    fprintf(fp, "%s,q12,%s,%d,%d,%.6f", filter_type, structure, cutoff, 2 * sections, time_spent);
+    bench_fprint_columns(fp, time_spent, BLOCK_RESTART, &pf0, &pf1);
+    runner_report(time_spent, "%s,q12,%s,%d,%d", filter_type, structure, cutoff, 2 * sections);
+    sat_fprint_columns(fp, &st, sections);
+    perf_fprint_columns(fp, &ps, N);
+    fprintf(fp, "\n");
+    printf("[LOG] %s (q12, %s, cut %d, order %d): %.6f sec\n", filter_type, structure, cutoff, 2 * sections, time_spent);
+
+    free(sos_q);
 }
 
+void benchmark_cascade_q12(FILE *fp, const char *filter_name,
+                            void (*func)(q12*, q12*, q12*, int, int),
+                            const double sos_d[][6], int sections) {
+    benchmark_sos_q12(fp, filter_name, "CASCADE", func, sos_d, sections);
+}
 
-int main() {
-    FILE *fp = fopen("c_fixed_time_results.csv", "w");
-    fprintf(fp, "filter_name,type,structure,cutoff,order,time_seconds\n");
-
-    for (size_t i = 0; i < 20; i++)
-    {
-        // Tu wkleić zawartość pliku generated_calls_time_fixed.txt
-        // === AUTO-GENERATED BENCHMARK CALLS ===
-        // === AUTO-GENERATED BENCHMARK CALLS ===
-        // --- FIXED BA ---
-        benchmark_fixed_q24(fp, "butter_df1_order2_cut1000_f64_ba", "DF1", DF1_q24, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "butter_df1_order2_cut1000_f64_ba", "DF1", DF1_q12, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "butter_df2_order2_cut1000_f64_ba", "DF2", DF2_q24, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "butter_df2_order2_cut1000_f64_ba", "DF2", DF2_q12, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "butter_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "butter_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "butter_df1_order2_cut2000_f64_ba", "DF1", DF1_q24, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "butter_df1_order2_cut2000_f64_ba", "DF1", DF1_q12, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "butter_df2_order2_cut2000_f64_ba", "DF2", DF2_q24, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "butter_df2_order2_cut2000_f64_ba", "DF2", DF2_q12, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "butter_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "butter_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "butter_df1_order2_cut5000_f64_ba", "DF1", DF1_q24, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "butter_df1_order2_cut5000_f64_ba", "DF1", DF1_q12, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "butter_df2_order2_cut5000_f64_ba", "DF2", DF2_q24, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "butter_df2_order2_cut5000_f64_ba", "DF2", DF2_q12, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "butter_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "butter_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "butter_df1_order4_cut1000_f64_ba", "DF1", DF1_q24, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "butter_df1_order4_cut1000_f64_ba", "DF1", DF1_q12, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "butter_df2_order4_cut1000_f64_ba", "DF2", DF2_q24, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "butter_df2_order4_cut1000_f64_ba", "DF2", DF2_q12, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "butter_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "butter_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "butter_df1_order4_cut2000_f64_ba", "DF1", DF1_q24, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "butter_df1_order4_cut2000_f64_ba", "DF1", DF1_q12, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "butter_df2_order4_cut2000_f64_ba", "DF2", DF2_q24, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "butter_df2_order4_cut2000_f64_ba", "DF2", DF2_q12, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "butter_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "butter_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "butter_df1_order4_cut5000_f64_ba", "DF1", DF1_q24, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "butter_df1_order4_cut5000_f64_ba", "DF1", DF1_q12, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "butter_df2_order4_cut5000_f64_ba", "DF2", DF2_q24, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "butter_df2_order4_cut5000_f64_ba", "DF2", DF2_q12, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "butter_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "butter_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "butter_df1_order6_cut1000_f64_ba", "DF1", DF1_q24, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "butter_df1_order6_cut1000_f64_ba", "DF1", DF1_q12, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "butter_df2_order6_cut1000_f64_ba", "DF2", DF2_q24, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "butter_df2_order6_cut1000_f64_ba", "DF2", DF2_q12, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "butter_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "butter_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "butter_df1_order6_cut2000_f64_ba", "DF1", DF1_q24, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "butter_df1_order6_cut2000_f64_ba", "DF1", DF1_q12, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "butter_df2_order6_cut2000_f64_ba", "DF2", DF2_q24, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "butter_df2_order6_cut2000_f64_ba", "DF2", DF2_q12, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "butter_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "butter_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "butter_df1_order6_cut5000_f64_ba", "DF1", DF1_q24, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "butter_df1_order6_cut5000_f64_ba", "DF1", DF1_q12, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "butter_df2_order6_cut5000_f64_ba", "DF2", DF2_q24, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "butter_df2_order6_cut5000_f64_ba", "DF2", DF2_q12, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "butter_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "butter_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "butter_df1_order8_cut1000_f64_ba", "DF1", DF1_q24, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "butter_df1_order8_cut1000_f64_ba", "DF1", DF1_q12, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "butter_df2_order8_cut1000_f64_ba", "DF2", DF2_q24, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "butter_df2_order8_cut1000_f64_ba", "DF2", DF2_q12, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "butter_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "butter_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "butter_df1_order8_cut2000_f64_ba", "DF1", DF1_q24, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "butter_df1_order8_cut2000_f64_ba", "DF1", DF1_q12, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "butter_df2_order8_cut2000_f64_ba", "DF2", DF2_q24, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "butter_df2_order8_cut2000_f64_ba", "DF2", DF2_q12, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "butter_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "butter_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "butter_df1_order8_cut5000_f64_ba", "DF1", DF1_q24, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "butter_df1_order8_cut5000_f64_ba", "DF1", DF1_q12, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "butter_df2_order8_cut5000_f64_ba", "DF2", DF2_q24, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "butter_df2_order8_cut5000_f64_ba", "DF2", DF2_q12, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "butter_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "butter_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "cheby1_df1_order2_cut1000_f64_ba", "DF1", DF1_q24, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby1_df1_order2_cut1000_f64_ba", "DF1", DF1_q12, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby1_df2_order2_cut1000_f64_ba", "DF2", DF2_q24, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby1_df2_order2_cut1000_f64_ba", "DF2", DF2_q12, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby1_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby1_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby1_df1_order2_cut2000_f64_ba", "DF1", DF1_q24, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby1_df1_order2_cut2000_f64_ba", "DF1", DF1_q12, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby1_df2_order2_cut2000_f64_ba", "DF2", DF2_q24, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby1_df2_order2_cut2000_f64_ba", "DF2", DF2_q12, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby1_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby1_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby1_df1_order2_cut5000_f64_ba", "DF1", DF1_q24, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby1_df1_order2_cut5000_f64_ba", "DF1", DF1_q12, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby1_df2_order2_cut5000_f64_ba", "DF2", DF2_q24, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby1_df2_order2_cut5000_f64_ba", "DF2", DF2_q12, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby1_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby1_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby1_df1_order4_cut1000_f64_ba", "DF1", DF1_q24, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby1_df1_order4_cut1000_f64_ba", "DF1", DF1_q12, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "cheby1_df2_order4_cut1000_f64_ba", "DF2", DF2_q24, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby1_df2_order4_cut1000_f64_ba", "DF2", DF2_q12, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "cheby1_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby1_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "cheby1_df1_order4_cut2000_f64_ba", "DF1", DF1_q24, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby1_df1_order4_cut2000_f64_ba", "DF1", DF1_q12, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "cheby1_df2_order4_cut2000_f64_ba", "DF2", DF2_q24, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby1_df2_order4_cut2000_f64_ba", "DF2", DF2_q12, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "cheby1_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby1_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "cheby1_df1_order4_cut5000_f64_ba", "DF1", DF1_q24, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby1_df1_order4_cut5000_f64_ba", "DF1", DF1_q12, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "cheby1_df2_order4_cut5000_f64_ba", "DF2", DF2_q24, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby1_df2_order4_cut5000_f64_ba", "DF2", DF2_q12, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "cheby1_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby1_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5);
-
-        benchmark_fixed_q24(fp, "cheby1_df1_order6_cut1000_f64_ba", "DF1", DF1_q24, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby1_df1_order6_cut1000_f64_ba", "DF1", DF1_q12, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "cheby1_df2_order6_cut1000_f64_ba", "DF2", DF2_q24, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby1_df2_order6_cut1000_f64_ba", "DF2", DF2_q12, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "cheby1_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby1_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "cheby1_df1_order6_cut2000_f64_ba", "DF1", DF1_q24, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby1_df1_order6_cut2000_f64_ba", "DF1", DF1_q12, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "cheby1_df2_order6_cut2000_f64_ba", "DF2", DF2_q24, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby1_df2_order6_cut2000_f64_ba", "DF2", DF2_q12, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "cheby1_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby1_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "cheby1_df1_order6_cut5000_f64_ba", "DF1", DF1_q24, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby1_df1_order6_cut5000_f64_ba", "DF1", DF1_q12, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "cheby1_df2_order6_cut5000_f64_ba", "DF2", DF2_q24, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby1_df2_order6_cut5000_f64_ba", "DF2", DF2_q12, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "cheby1_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby1_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7);
-
-        benchmark_fixed_q24(fp, "cheby1_df1_order8_cut1000_f64_ba", "DF1", DF1_q24, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby1_df1_order8_cut1000_f64_ba", "DF1", DF1_q12, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "cheby1_df2_order8_cut1000_f64_ba", "DF2", DF2_q24, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby1_df2_order8_cut1000_f64_ba", "DF2", DF2_q12, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "cheby1_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby1_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "cheby1_df1_order8_cut2000_f64_ba", "DF1", DF1_q24, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby1_df1_order8_cut2000_f64_ba", "DF1", DF1_q12, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "cheby1_df2_order8_cut2000_f64_ba", "DF2", DF2_q24, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby1_df2_order8_cut2000_f64_ba", "DF2", DF2_q12, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "cheby1_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby1_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "cheby1_df1_order8_cut5000_f64_ba", "DF1", DF1_q24, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby1_df1_order8_cut5000_f64_ba", "DF1", DF1_q12, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "cheby1_df2_order8_cut5000_f64_ba", "DF2", DF2_q24, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby1_df2_order8_cut5000_f64_ba", "DF2", DF2_q12, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "cheby1_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby1_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9);
-
-        benchmark_fixed_q24(fp, "cheby2_df1_order2_cut1000_f64_ba", "DF1", DF1_q24, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby2_df1_order2_cut1000_f64_ba", "DF1", DF1_q12, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby2_df2_order2_cut1000_f64_ba", "DF2", DF2_q24, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby2_df2_order2_cut1000_f64_ba", "DF2", DF2_q12, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby2_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby2_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby2_df1_order2_cut2000_f64_ba", "DF1", DF1_q24, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby2_df1_order2_cut2000_f64_ba", "DF1", DF1_q12, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby2_df2_order2_cut2000_f64_ba", "DF2", DF2_q24, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby2_df2_order2_cut2000_f64_ba", "DF2", DF2_q12, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby2_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby2_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3);
-
-        benchmark_fixed_q24(fp, "cheby2_df1_order2_cut5000_f64_ba", "DF1", DF1_q24, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby2_df1_order2_cut5000_f64_ba", "DF1", DF1_q12, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3);
+// === Blokowy zmiennoprzecinkowy (bfp16) ===
+// Konwersja szumu i współczynników poza mierzonym czasem, jak dla q24 / q12
+void benchmark_sos_bfp16(FILE *fp, const char *filter_name, const char *structure,
+                         void (*func)(bfp16*, bfp16*, bfp16_sos*, int, int),
+                         const double sos_d[][6], int sections) {
+
+    timing_t start, end;
+    sat_stats st = {0};
+    perf_sample ps;
+    pool_faults pf0, pf1;
+    int step = bench_step(N);
+    double time_spent;
+    int cutoff = -1;
 
-        benchmark_fixed_q24(fp, "cheby2_df2_order2_cut5000_f64_ba", "DF2", DF2_q24, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby2_df2_order2_cut5000_f64_ba", "DF2", DF2_q12, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_fixed_q24(fp, "cheby2_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "cheby2_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_fixed_q24(fp, "cheby2_df1_order4_cut1000_f64_ba", "DF1", DF1_q24, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby2_df1_order4_cut1000_f64_ba", "DF1", DF1_q12, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5);
+    double *x_d = pool_buffer(POOL_TMP, sizeof(double) * N);
+    bfp16 x = { pool_buffer(POOL_X, sizeof(int16_t) * N), pool_buffer(POOL_X2, sizeof(int16_t) * bfp16_blocks(N)), N };
+    bfp16 y = { pool_buffer(POOL_Y, sizeof(int16_t) * N), pool_buffer(POOL_Y2, sizeof(int16_t) * bfp16_blocks(N)), N };
+    bfp16_sos *sos_b = malloc(sizeof(bfp16_sos) * sections);
 
-        benchmark_fixed_q24(fp, "cheby2_df2_order4_cut1000_f64_ba", "DF2", DF2_q24, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby2_df2_order4_cut1000_f64_ba", "DF2", DF2_q12, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5);
+    generate_white_noise_d(x_d, N);
+    bfp16_from_double(&x, x_d, N);
+    bfp16_sos_from_double(sos_d, sos_b, sections);
 
-        benchmark_fixed_q24(fp, "cheby2_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby2_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5);
+    // Blok musi zaczynać się na granicy bloku wykładników
+    if (step % BFP16_BLOCK) step = N;
 
-        benchmark_fixed_q24(fp, "cheby2_df1_order4_cut2000_f64_ba", "DF1", DF1_q24, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby2_df1_order4_cut2000_f64_ba", "DF1", DF1_q12, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5);
+    sat_begin();
+    pool_faults_now(&pf0);
+    perf_start();
+    start = timing_now();
 
-        benchmark_fixed_q24(fp, "cheby2_df2_order4_cut2000_f64_ba", "DF2", DF2_q24, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby2_df2_order4_cut2000_f64_ba", "DF2", DF2_q12, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5);
+    for (int off = 0; off < N; off += step) {
+        int len = (N - off < step) ? N - off : step;
+        bfp16 xb = { x.m + off, x.e + off / BFP16_BLOCK, len };
+        bfp16 yb = { y.m + off, y.e + off / BFP16_BLOCK, len };
+        func(&xb, &yb, sos_b, len, sections);
+    }
 
-        benchmark_fixed_q24(fp, "cheby2_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby2_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5);
+    end = timing_now();
+    perf_stop(&ps);
+    pool_faults_now(&pf1);
+    time_spent = timing_seconds(start, end);
+    sat_end(&st);
+
+    fprintf(fp, "%s,bfp16,%s,%d,%d,%.6f", filter_type, structure, cutoff, 2 * sections, time_spent);
+    bench_fprint_columns(fp, time_spent, BLOCK_RESTART, &pf0, &pf1);
+    runner_report(time_spent, "%s,bfp16,%s,%d,%d", filter_type, structure, cutoff, 2 * sections);
+    sat_fprint_columns(fp, &st, sections);
+    perf_fprint_columns(fp, &ps, N);
+    fprintf(fp, "\n");
+    printf("[LOG] %s (bfp16, %s, cut %d, order %d): %.6f sec\n", filter_type, structure, cutoff, 2 * sections, time_spent);
+
+    free(sos_b);
+}
 
-        benchmark_fixed_q24(fp, "cheby2_df1_order4_cut5000_f64_ba", "DF1", DF1_q24, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby2_df1_order4_cut5000_f64_ba", "DF1", DF1_q12, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5);
 
-        benchmark_fixed_q24(fp, "cheby2_df2_order4_cut5000_f64_ba", "DF2", DF2_q24, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby2_df2_order4_cut5000_f64_ba", "DF2", DF2_q12, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5);
+// === CASCADE kafelkowy ===
+// Przyspieszenie CASCADE_tiled względem CASCADE_ip w funkcji rozmiaru kafla
+static const int tile_sizes[] = {64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 65536};
+#define NUM_TILE_SIZES (int)(sizeof(tile_sizes) / sizeof(tile_sizes[0]))
 
-        benchmark_fixed_q24(fp, "cheby2_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "cheby2_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5);
+void benchmark_cascade_tiled_q24(FILE *fp, const char *filter_name,
+                                  const double sos_d[][6], int sections) {
 
-        benchmark_fixed_q24(fp, "cheby2_df1_order6_cut1000_f64_ba", "DF1", DF1_q24, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby2_df1_order6_cut1000_f64_ba", "DF1", DF1_q12, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7);
+    timing_t start, end;
+    double t_ref, t_tile;
+    int cutoff = -1;
 
-        benchmark_fixed_q24(fp, "cheby2_df2_order6_cut1000_f64_ba", "DF2", DF2_q24, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby2_df2_order6_cut1000_f64_ba", "DF2", DF2_q12, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_fixed_q24(fp, "cheby2_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby2_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_fixed_q24(fp, "cheby2_df1_order6_cut2000_f64_ba", "DF1", DF1_q24, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby2_df1_order6_cut2000_f64_ba", "DF1", DF1_q12, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7);
+    q24 *x = malloc(sizeof(q24) * N);
+    q24 *y = malloc(sizeof(q24) * N);
+    q24 (*sos_q)[6] = malloc(sizeof(q24) * 6 * sections);
 
-        benchmark_fixed_q24(fp, "cheby2_df2_order6_cut2000_f64_ba", "DF2", DF2_q24, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby2_df2_order6_cut2000_f64_ba", "DF2", DF2_q12, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7);
+    convert_sos_to_q24(sos_d, sos_q, sections);
+    generate_white_noise_q24(x, N);
+    memset(y, 0, sizeof(q24) * N);
 
-        benchmark_fixed_q24(fp, "cheby2_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby2_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7);
+    start = timing_now();
+    CASCADE_ip_q24(x, y, (q24*)sos_q, N, sections);
+    end = timing_now();
+    t_ref = timing_seconds(start, end);
 
-        benchmark_fixed_q24(fp, "cheby2_df1_order6_cut5000_f64_ba", "DF1", DF1_q24, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby2_df1_order6_cut5000_f64_ba", "DF1", DF1_q12, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7);
+    for (int k = 0; k < NUM_TILE_SIZES; ++k) {
+        start = timing_now();
+        CASCADE_tiled_q24(x, y, (q24*)sos_q, N, sections, tile_sizes[k]);
+        end = timing_now();
+        t_tile = timing_seconds(start, end);
 
-        benchmark_fixed_q24(fp, "cheby2_df2_order6_cut5000_f64_ba", "DF2", DF2_q24, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby2_df2_order6_cut5000_f64_ba", "DF2", DF2_q12, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7);
+        fprintf(fp, "%s,q24,CASCADE_TILED,%d,%d,%d,%.6f,%.4f\n", filter_type, cutoff, 2 * sections, tile_sizes[k], t_tile, t_ref / t_tile);
+        printf("[LOG] %s (q24, CASCADE_TILED, cut %d, order %d, tile %d): %.6f sec, speedup %.3f\n", filter_type, cutoff, 2 * sections, tile_sizes[k], t_tile, t_ref / t_tile);
+    }
+    fprintf(fp, "%s,q24,CASCADE_IP,%d,%d,%d,%.6f,%.4f\n", filter_type, cutoff, 2 * sections, N, t_ref, 1.0);
 
-        benchmark_fixed_q24(fp, "cheby2_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "cheby2_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7);
+    free(x); free(y); free(sos_q);
+}
 
-        benchmark_fixed_q24(fp, "cheby2_df1_order8_cut1000_f64_ba", "DF1", DF1_q24, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby2_df1_order8_cut1000_f64_ba", "DF1", DF1_q12, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9);
+void benchmark_cascade_tiled_q12(FILE *fp, const char *filter_name,
+                                  const double sos_d[][6], int sections) {
 
-        benchmark_fixed_q24(fp, "cheby2_df2_order8_cut1000_f64_ba", "DF2", DF2_q24, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby2_df2_order8_cut1000_f64_ba", "DF2", DF2_q12, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9);
+    timing_t start, end;
+    double t_ref, t_tile;
+    int cutoff = -1;
 
-        benchmark_fixed_q24(fp, "cheby2_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby2_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_fixed_q24(fp, "cheby2_df1_order8_cut2000_f64_ba", "DF1", DF1_q24, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby2_df1_order8_cut2000_f64_ba", "DF1", DF1_q12, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_fixed_q24(fp, "cheby2_df2_order8_cut2000_f64_ba", "DF2", DF2_q24, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby2_df2_order8_cut2000_f64_ba", "DF2", DF2_q12, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9);
+    q12 *x = malloc(sizeof(q12) * N);
+    q12 *y = malloc(sizeof(q12) * N);
+    q12 (*sos_q)[6] = malloc(sizeof(q12) * 6 * sections);
 
-        benchmark_fixed_q24(fp, "cheby2_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby2_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9);
+    convert_sos_to_q12(sos_d, sos_q, sections);
+    generate_white_noise_q12(x, N);
+    memset(y, 0, sizeof(q12) * N);
 
-        benchmark_fixed_q24(fp, "cheby2_df1_order8_cut5000_f64_ba", "DF1", DF1_q24, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby2_df1_order8_cut5000_f64_ba", "DF1", DF1_q12, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9);
+    start = timing_now();
+    CASCADE_ip_q12(x, y, (q12*)sos_q, N, sections);
+    end = timing_now();
+    t_ref = timing_seconds(start, end);
 
-        benchmark_fixed_q24(fp, "cheby2_df2_order8_cut5000_f64_ba", "DF2", DF2_q24, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby2_df2_order8_cut5000_f64_ba", "DF2", DF2_q12, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9);
+    for (int k = 0; k < NUM_TILE_SIZES; ++k) {
+        start = timing_now();
+        CASCADE_tiled_q12(x, y, (q12*)sos_q, N, sections, tile_sizes[k]);
+        end = timing_now();
+        t_tile = timing_seconds(start, end);
 
-        benchmark_fixed_q24(fp, "cheby2_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "cheby2_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9);
+        fprintf(fp, "%s,q12,CASCADE_TILED,%d,%d,%d,%.6f,%.4f\n", filter_type, cutoff, 2 * sections, tile_sizes[k], t_tile, t_ref / t_tile);
+        printf("[LOG] %s (q12, CASCADE_TILED, cut %d, order %d, tile %d): %.6f sec, speedup %.3f\n", filter_type, cutoff, 2 * sections, tile_sizes[k], t_tile, t_ref / t_tile);
+    }
+    fprintf(fp, "%s,q12,CASCADE_IP,%d,%d,%d,%.6f,%.4f\n", filter_type, cutoff, 2 * sections, N, t_ref, 1.0);
 
-        benchmark_fixed_q24(fp, "ellip_df1_order2_cut1000_f64_ba", "DF1", DF1_q24, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "ellip_df1_order2_cut1000_f64_ba", "DF1", DF1_q12, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3);
+    free(x); free(y); free(sos_q);
+}
 
-        benchmark_fixed_q24(fp, "ellip_df2_order2_cut1000_f64_ba", "DF2", DF2_q24, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "ellip_df2_order2_cut1000_f64_ba", "DF2", DF2_q12, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3);
+// Tryb "tile": ./TimeAnalysis_fixed tile
+int run_tile_benchmark(void) {
+    FILE *fp = fopen("c_fixed_tile_results" RESULTS_SUFFIX ".csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
 
-        benchmark_fixed_q24(fp, "ellip_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "ellip_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3);
+    fprintf(fp, "filter_name,type,structure,cutoff,order,tile,time_seconds,speedup\n");
 
-        benchmark_fixed_q24(fp, "ellip_df1_order2_cut2000_f64_ba", "DF1", DF1_q24, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "ellip_df1_order2_cut2000_f64_ba", "DF1", DF1_q12, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3);
+    for (size_t i = 0; i < 20; i++)
+    {
+        benchmark_cascade_tiled_q24(fp, "ellip_cascade_order4_cut1000_f64_sos", ellip_cascade_order4_cut1000_f64_sos, 2);
+        benchmark_cascade_tiled_q24(fp, "ellip_cascade_order6_cut1000_f64_sos", ellip_cascade_order6_cut1000_f64_sos, 3);
+        benchmark_cascade_tiled_q24(fp, "ellip_cascade_order8_cut1000_f64_sos", ellip_cascade_order8_cut1000_f64_sos, 4);
+        benchmark_cascade_tiled_q12(fp, "ellip_cascade_order4_cut1000_f64_sos", ellip_cascade_order4_cut1000_f64_sos, 2);
+        benchmark_cascade_tiled_q12(fp, "ellip_cascade_order6_cut1000_f64_sos", ellip_cascade_order6_cut1000_f64_sos, 3);
+        benchmark_cascade_tiled_q12(fp, "ellip_cascade_order8_cut1000_f64_sos", ellip_cascade_order8_cut1000_f64_sos, 4);
+    }
 
-        benchmark_fixed_q24(fp, "ellip_df2_order2_cut2000_f64_ba", "DF2", DF2_q24, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "ellip_df2_order2_cut2000_f64_ba", "DF2", DF2_q12, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3);
+    fclose(fp);
+    return 0;
+}
 
-        benchmark_fixed_q24(fp, "ellip_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "ellip_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3);
+// Kernel ogólny względem kernela wyspecjalizowanego w czasie działania (runtimespec.c)
+// sos_d != NULL -> CASCADE (order = liczba sekcji), w przeciwnym razie b_d, a_d.
+void benchmark_rtspec_q24(FILE *fp, const char *filter_name, const char *structure,
+                          const double *b_d, const double *a_d, const double sos_d[][6], int order) {
+    timing_t start, end;
+    double t_gen, t_rt, t_spec;
+    int cutoff = -1;
+    int count = sos_d ? 6 * order : order;
+    int rank = sos_d ? 2 * order : order - 1;
 
-        benchmark_fixed_q24(fp, "ellip_df1_order2_cut5000_f64_ba", "DF1", DF1_q24, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "ellip_df1_order2_cut5000_f64_ba", "DF1", DF1_q12, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_fixed_q24(fp, "ellip_df2_order2_cut5000_f64_ba", "DF2", DF2_q24, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "ellip_df2_order2_cut5000_f64_ba", "DF2", DF2_q12, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_fixed_q24(fp, "ellip_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "ellip_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3);
+    rs_structure rs = strcmp(structure, "DF1") == 0 ? RS_DF1 :
+                      strcmp(structure, "DF2") == 0 ? RS_DF2 :
+                      strcmp(structure, "TDF2") == 0 ? RS_TDF2 : RS_CASCADE;
 
-        benchmark_fixed_q24(fp, "ellip_df1_order4_cut1000_f64_ba", "DF1", DF1_q24, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "ellip_df1_order4_cut1000_f64_ba", "DF1", DF1_q12, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5);
+    q24 *b_q = malloc(sizeof(q24) * count);
+    q24 *a_q = malloc(sizeof(q24) * count);
+    if (sos_d) convert_sos_to_q24(sos_d, (q24 (*)[6])b_q, order);
+    else convert_ba_to_q24(b_d, a_d, b_q, a_q, order);
 
-        benchmark_fixed_q24(fp, "ellip_df2_order4_cut1000_f64_ba", "DF2", DF2_q24, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "ellip_df2_order4_cut1000_f64_ba", "DF2", DF2_q12, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5);
+    start = timing_now();
+    rs_kernel k = sos_d ? rs_specialize_sos(RS_Q24, b_q, order) : rs_specialize_ba(rs, RS_Q24, b_q, a_q, order);
+    end = timing_now();
+    t_spec = timing_seconds(start, end);
 
-        benchmark_fixed_q24(fp, "ellip_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "ellip_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5);
+    if (!k) {
+        printf("[LOG] %s (q24, %s): runtime specialization unavailable\n", filter_type, structure);
+        free(b_q); free(a_q);
+        return;
+    }
 
-        benchmark_fixed_q24(fp, "ellip_df1_order4_cut2000_f64_ba", "DF1", DF1_q24, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "ellip_df1_order4_cut2000_f64_ba", "DF1", DF1_q12, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5);
+    q24 *x = malloc(sizeof(q24) * N);
+    q24 *y = malloc(sizeof(q24) * N);
+    q24 *y_rt = malloc(sizeof(q24) * N);
+    generate_white_noise_q24(x, N);
 
-        benchmark_fixed_q24(fp, "ellip_df2_order4_cut2000_f64_ba", "DF2", DF2_q24, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "ellip_df2_order4_cut2000_f64_ba", "DF2", DF2_q12, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5);
+    start = timing_now();
+    if (rs == RS_DF1) DF1_q24(x, y, b_q, a_q, N, order);
+    else if (rs == RS_DF2) DF2_q24(x, y, b_q, a_q, N, order);
+    else if (rs == RS_TDF2) TDF2_q24(x, y, b_q, a_q, N, order);
+    else CASCADE_ip_q24(x, y, b_q, N, order);
+    end = timing_now();
+    t_gen = timing_seconds(start, end);
+
+    start = timing_now();
+    k(x, y_rt, N);
+    end = timing_now();
+    t_rt = timing_seconds(start, end);
+
+    // Czas ma sens tylko dla kernela liczącego to samo co biblioteka
+    int mismatches = 0;
+    for (int n = 0; n < N; ++n) mismatches += y_rt[n] != y[n];
+    if (mismatches) {
+        printf("[LOG] %s (q24, %s): runtime-specialized output differs from library on %d of %d samples, timing skipped\n", filter_type, structure, mismatches, N);
+        free(x); free(y); free(y_rt); free(b_q); free(a_q);
+        return;
+    }
 
-        benchmark_fixed_q24(fp, "ellip_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "ellip_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5);
+    fprintf(fp, "%s,q24,%s,%d,%d,%.6f,%.6f\n", filter_type, structure, cutoff, rank, t_gen, 0.0);
+    fprintf(fp, "%s,q24,%s_RT,%d,%d,%.6f,%.6f\n", filter_type, structure, cutoff, rank, t_rt, t_spec);
+    printf("[LOG] %s (q24, %s, cut %d, order %d): %.6f sec, runtime-specialized %.6f sec (specialize %.3f sec)\n", filter_type, structure, cutoff, rank, t_gen, t_rt, t_spec);
 
-        benchmark_fixed_q24(fp, "ellip_df1_order4_cut5000_f64_ba", "DF1", DF1_q24, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "ellip_df1_order4_cut5000_f64_ba", "DF1", DF1_q12, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5);
+    free(x); free(y); free(y_rt); free(b_q); free(a_q);
+}
 
-        benchmark_fixed_q24(fp, "ellip_df2_order4_cut5000_f64_ba", "DF2", DF2_q24, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "ellip_df2_order4_cut5000_f64_ba", "DF2", DF2_q12, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5);
+// Kernel ogólny względem kernela wyspecjalizowanego w czasie działania (runtimespec.c)
+// sos_d != NULL -> CASCADE (order = liczba sekcji), w przeciwnym razie b_d, a_d.
+void benchmark_rtspec_q12(FILE *fp, const char *filter_name, const char *structure,
+                          const double *b_d, const double *a_d, const double sos_d[][6], int order) {
+    timing_t start, end;
+    double t_gen, t_rt, t_spec;
+    int cutoff = -1;
+    int count = sos_d ? 6 * order : order;
+    int rank = sos_d ? 2 * order : order - 1;
 
-        benchmark_fixed_q24(fp, "ellip_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "ellip_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_fixed_q24(fp, "ellip_df1_order6_cut1000_f64_ba", "DF1", DF1_q24, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "ellip_df1_order6_cut1000_f64_ba", "DF1", DF1_q12, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_fixed_q24(fp, "ellip_df2_order6_cut1000_f64_ba", "DF2", DF2_q24, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "ellip_df2_order6_cut1000_f64_ba", "DF2", DF2_q12, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7);
+    rs_structure rs = strcmp(structure, "DF1") == 0 ? RS_DF1 :
+                      strcmp(structure, "DF2") == 0 ? RS_DF2 :
+                      strcmp(structure, "TDF2") == 0 ? RS_TDF2 : RS_CASCADE;
 
-        benchmark_fixed_q24(fp, "ellip_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "ellip_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7);
+    q12 *b_q = malloc(sizeof(q12) * count);
+    q12 *a_q = malloc(sizeof(q12) * count);
+    if (sos_d) convert_sos_to_q12(sos_d, (q12 (*)[6])b_q, order);
+    else convert_ba_to_q12(b_d, a_d, b_q, a_q, order);
 
-        benchmark_fixed_q24(fp, "ellip_df1_order6_cut2000_f64_ba", "DF1", DF1_q24, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "ellip_df1_order6_cut2000_f64_ba", "DF1", DF1_q12, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7);
+    start = timing_now();
+    rs_kernel k = sos_d ? rs_specialize_sos(RS_Q12, b_q, order) : rs_specialize_ba(rs, RS_Q12, b_q, a_q, order);
+    end = timing_now();
+    t_spec = timing_seconds(start, end);
 
-        benchmark_fixed_q24(fp, "ellip_df2_order6_cut2000_f64_ba", "DF2", DF2_q24, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "ellip_df2_order6_cut2000_f64_ba", "DF2", DF2_q12, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7);
+    if (!k) {
+        printf("[LOG] %s (q12, %s): runtime specialization unavailable\n", filter_type, structure);
+        free(b_q); free(a_q);
+        return;
+    }
 
-        benchmark_fixed_q24(fp, "ellip_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "ellip_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7);
+    q12 *x = malloc(sizeof(q12) * N);
+    q12 *y = malloc(sizeof(q12) * N);
+    q12 *y_rt = malloc(sizeof(q12) * N);
+    generate_white_noise_q12(x, N);
 
-        benchmark_fixed_q24(fp, "ellip_df1_order6_cut5000_f64_ba", "DF1", DF1_q24, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "ellip_df1_order6_cut5000_f64_ba", "DF1", DF1_q12, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7);
+    start = timing_now();
+    if (rs == RS_DF1) DF1_q12(x, y, b_q, a_q, N, order);
+    else if (rs == RS_DF2) DF2_q12(x, y, b_q, a_q, N, order);
+    else if (rs == RS_TDF2) TDF2_q12(x, y, b_q, a_q, N, order);
+    else CASCADE_ip_q12(x, y, b_q, N, order);
+    end = timing_now();
+    t_gen = timing_seconds(start, end);
+
+    start = timing_now();
+    k(x, y_rt, N);
+    end = timing_now();
+    t_rt = timing_seconds(start, end);
+
+    // Czas ma sens tylko dla kernela liczącego to samo co biblioteka
+    int mismatches = 0;
+    for (int n = 0; n < N; ++n) mismatches += y_rt[n] != y[n];
+    if (mismatches) {
+        printf("[LOG] %s (q12, %s): runtime-specialized output differs from library on %d of %d samples, timing skipped\n", filter_type, structure, mismatches, N);
+        free(x); free(y); free(y_rt); free(b_q); free(a_q);
+        return;
+    }
 
-        benchmark_fixed_q24(fp, "ellip_df2_order6_cut5000_f64_ba", "DF2", DF2_q24, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "ellip_df2_order6_cut5000_f64_ba", "DF2", DF2_q12, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7);
+    fprintf(fp, "%s,q12,%s,%d,%d,%.6f,%.6f\n", filter_type, structure, cutoff, rank, t_gen, 0.0);
+    fprintf(fp, "%s,q12,%s_RT,%d,%d,%.6f,%.6f\n", filter_type, structure, cutoff, rank, t_rt, t_spec);
+    printf("[LOG] %s (q12, %s, cut %d, order %d): %.6f sec, runtime-specialized %.6f sec (specialize %.3f sec)\n", filter_type, structure, cutoff, rank, t_gen, t_rt, t_spec);
 
-        benchmark_fixed_q24(fp, "ellip_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "ellip_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7);
+    free(x); free(y); free(y_rt); free(b_q); free(a_q);
+}
 
-        benchmark_fixed_q24(fp, "ellip_df1_order8_cut1000_f64_ba", "DF1", DF1_q24, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "ellip_df1_order8_cut1000_f64_ba", "DF1", DF1_q12, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9);
+// Tryb "rtspec": ./TimeAnalysis_fixed rtspec
+int run_rtspec_benchmark(void) {
+    FILE *fp = fopen("c_fixed_rtspec_results" RESULTS_SUFFIX ".csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
 
-        benchmark_fixed_q24(fp, "ellip_df2_order8_cut1000_f64_ba", "DF2", DF2_q24, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "ellip_df2_order8_cut1000_f64_ba", "DF2", DF2_q12, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9);
+    fprintf(fp, "filter_name,type,structure,cutoff,order,time_seconds,specialize_seconds\n");
 
-        benchmark_fixed_q24(fp, "ellip_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "ellip_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9);
+    for (size_t i = 0; i < 20; i++)
+    {
+        benchmark_rtspec_q24(fp, "butter_df1_order4_cut1000_f64_ba", "DF1", butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], NULL, 5);
+        benchmark_rtspec_q24(fp, "butter_df2_order4_cut1000_f64_ba", "DF2", butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], NULL, 5);
+        benchmark_rtspec_q24(fp, "butter_tdf2_order4_cut1000_f64_ba", "TDF2", butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], NULL, 5);
+        benchmark_rtspec_q24(fp, "butter_cascade_order4_cut1000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order4_cut1000_f64_sos, 2);
+        benchmark_rtspec_q24(fp, "butter_df1_order8_cut1000_f64_ba", "DF1", butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_rtspec_q24(fp, "butter_df2_order8_cut1000_f64_ba", "DF2", butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_rtspec_q24(fp, "butter_tdf2_order8_cut1000_f64_ba", "TDF2", butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_rtspec_q24(fp, "butter_cascade_order8_cut1000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order8_cut1000_f64_sos, 4);
+        benchmark_rtspec_q24(fp, "ellip_df1_order4_cut1000_f64_ba", "DF1", ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], NULL, 5);
+        benchmark_rtspec_q24(fp, "ellip_df2_order4_cut1000_f64_ba", "DF2", ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], NULL, 5);
+        benchmark_rtspec_q24(fp, "ellip_tdf2_order4_cut1000_f64_ba", "TDF2", ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], NULL, 5);
+        benchmark_rtspec_q24(fp, "ellip_cascade_order4_cut1000_f64_sos", "CASCADE", NULL, NULL, ellip_cascade_order4_cut1000_f64_sos, 2);
+        benchmark_rtspec_q24(fp, "ellip_df1_order8_cut1000_f64_ba", "DF1", ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_rtspec_q24(fp, "ellip_df2_order8_cut1000_f64_ba", "DF2", ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_rtspec_q24(fp, "ellip_tdf2_order8_cut1000_f64_ba", "TDF2", ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_rtspec_q24(fp, "ellip_cascade_order8_cut1000_f64_sos", "CASCADE", NULL, NULL, ellip_cascade_order8_cut1000_f64_sos, 4);
+        benchmark_rtspec_q12(fp, "butter_df1_order4_cut1000_f64_ba", "DF1", butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], NULL, 5);
+        benchmark_rtspec_q12(fp, "butter_df2_order4_cut1000_f64_ba", "DF2", butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], NULL, 5);
+        benchmark_rtspec_q12(fp, "butter_tdf2_order4_cut1000_f64_ba", "TDF2", butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], NULL, 5);
+        benchmark_rtspec_q12(fp, "butter_cascade_order4_cut1000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order4_cut1000_f64_sos, 2);
+        benchmark_rtspec_q12(fp, "butter_df1_order8_cut1000_f64_ba", "DF1", butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_rtspec_q12(fp, "butter_df2_order8_cut1000_f64_ba", "DF2", butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_rtspec_q12(fp, "butter_tdf2_order8_cut1000_f64_ba", "TDF2", butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_rtspec_q12(fp, "butter_cascade_order8_cut1000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order8_cut1000_f64_sos, 4);
+        benchmark_rtspec_q12(fp, "ellip_df1_order4_cut1000_f64_ba", "DF1", ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], NULL, 5);
+        benchmark_rtspec_q12(fp, "ellip_df2_order4_cut1000_f64_ba", "DF2", ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], NULL, 5);
+        benchmark_rtspec_q12(fp, "ellip_tdf2_order4_cut1000_f64_ba", "TDF2", ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], NULL, 5);
+        benchmark_rtspec_q12(fp, "ellip_cascade_order4_cut1000_f64_sos", "CASCADE", NULL, NULL, ellip_cascade_order4_cut1000_f64_sos, 2);
+        benchmark_rtspec_q12(fp, "ellip_df1_order8_cut1000_f64_ba", "DF1", ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_rtspec_q12(fp, "ellip_df2_order8_cut1000_f64_ba", "DF2", ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_rtspec_q12(fp, "ellip_tdf2_order8_cut1000_f64_ba", "TDF2", ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_rtspec_q12(fp, "ellip_cascade_order8_cut1000_f64_sos", "CASCADE", NULL, NULL, ellip_cascade_order8_cut1000_f64_sos, 4);
+    }
 
-        benchmark_fixed_q24(fp, "ellip_df1_order8_cut2000_f64_ba", "DF1", DF1_q24, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "ellip_df1_order8_cut2000_f64_ba", "DF1", DF1_q12, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9);
+    fclose(fp);
+    return 0;
+}
 
-        benchmark_fixed_q24(fp, "ellip_df2_order8_cut2000_f64_ba", "DF2", DF2_q24, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "ellip_df2_order8_cut2000_f64_ba", "DF2", DF2_q12, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9);
+// === Analiza czasu (wiele kanałów, SIMD) ===
+// Łączna liczba próbek N rozłożona na channels kanałów; layout: MC_INTERLEAVED / MC_PLANAR,
+// lub -1 = pętla po kanałach z jądrem skalarnym (TDF2_q24 / CASCADE_ip_q24 itd.).
+// sos_d != NULL -> CASCADE (order = liczba sekcji), w przeciwnym razie TDF2.
+static const char *mc_layout_name(int layout) {
+    if (layout == MC_INTERLEAVED) return "interleaved";
+    if (layout == MC_PLANAR) return "planar";
+    return "scalar";
+}
 
-        benchmark_fixed_q24(fp, "ellip_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "ellip_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9);
+void benchmark_mc_q24(FILE *fp, const char *filter_name, const double *b_d, const double *a_d,
+                      const double sos_d[][6], int order, int channels, int layout) {
+    timing_t start, end;
+    double time_spent;
+    int cutoff = -1;
+    int frames = N / channels;
+    const char *structure = sos_d ? "CASCADE" : "TDF2";
+    int rank = sos_d ? 2 * order : order - 1;
 
-        benchmark_fixed_q24(fp, "ellip_df1_order8_cut5000_f64_ba", "DF1", DF1_q24, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "ellip_df1_order8_cut5000_f64_ba", "DF1", DF1_q12, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_fixed_q24(fp, "ellip_df2_order8_cut5000_f64_ba", "DF2", DF2_q24, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "ellip_df2_order8_cut5000_f64_ba", "DF2", DF2_q12, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_fixed_q24(fp, "ellip_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "ellip_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9);
+    q24 *x = malloc(sizeof(q24) * frames * channels);
+    q24 *y = malloc(sizeof(q24) * frames * channels);
+    q24 *b_q = malloc(sizeof(q24) * (sos_d ? 6 * order : order));
+    q24 *a_q = malloc(sizeof(q24) * order);
 
-        benchmark_fixed_q24(fp, "bessel_df1_order2_cut1000_f64_ba", "DF1", DF1_q24, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "bessel_df1_order2_cut1000_f64_ba", "DF1", DF1_q12, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3);
+    if (sos_d) convert_sos_to_q24(sos_d, (q24 (*)[6])b_q, order);
+    else convert_ba_to_q24(b_d, a_d, b_q, a_q, order);
+    generate_white_noise_q24(x, frames * channels);
+    memset(y, 0, sizeof(q24) * frames * channels);
 
-        benchmark_fixed_q24(fp, "bessel_df2_order2_cut1000_f64_ba", "DF2", DF2_q24, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "bessel_df2_order2_cut1000_f64_ba", "DF2", DF2_q12, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3);
+    start = timing_now();
+    if (layout < 0) {
+        for (int c = 0; c < channels; ++c) {
+            if (sos_d) CASCADE_ip_q24(x + (size_t)c * frames, y + (size_t)c * frames, b_q, frames, order);
+            else TDF2_q24(x + (size_t)c * frames, y + (size_t)c * frames, b_q, a_q, frames, order);
+        }
+    } else {
+        if (sos_d) CASCADE_mc_q24_s(x, y, b_q, frames, order, channels, layout);
+        else TDF2_mc_q24_s(x, y, b_q, a_q, frames, order, channels, layout);
+    }
+    end = timing_now();
+    time_spent = timing_seconds(start, end);
+    double sps = (double)frames / time_spent;
 
-        benchmark_fixed_q24(fp, "bessel_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "bessel_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3);
+    fprintf(fp, "%s,q24,%s,%d,%d,%d,%s,%.6f,%.1f\n", filter_type, structure, cutoff, rank, channels, mc_layout_name(layout), time_spent, sps);
+    printf("[LOG] %s (q24, %s, cut %d, order %d, %d ch, %s): %.6f sec, %.3e samples/s/ch\n", filter_type, structure, cutoff, rank, channels, mc_layout_name(layout), time_spent, sps);
 
-        benchmark_fixed_q24(fp, "bessel_df1_order2_cut2000_f64_ba", "DF1", DF1_q24, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "bessel_df1_order2_cut2000_f64_ba", "DF1", DF1_q12, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3);
+    free(x); free(y); free(b_q); free(a_q);
+}
 
-        benchmark_fixed_q24(fp, "bessel_df2_order2_cut2000_f64_ba", "DF2", DF2_q24, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "bessel_df2_order2_cut2000_f64_ba", "DF2", DF2_q12, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3);
+void benchmark_mc_q12(FILE *fp, const char *filter_name, const double *b_d, const double *a_d,
+                      const double sos_d[][6], int order, int channels, int layout) {
+    timing_t start, end;
+    double time_spent;
+    int cutoff = -1;
+    int frames = N / channels;
+    const char *structure = sos_d ? "CASCADE" : "TDF2";
+    int rank = sos_d ? 2 * order : order - 1;
 
-        benchmark_fixed_q24(fp, "bessel_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "bessel_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_fixed_q24(fp, "bessel_df1_order2_cut5000_f64_ba", "DF1", DF1_q24, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "bessel_df1_order2_cut5000_f64_ba", "DF1", DF1_q12, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_fixed_q24(fp, "bessel_df2_order2_cut5000_f64_ba", "DF2", DF2_q24, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "bessel_df2_order2_cut5000_f64_ba", "DF2", DF2_q12, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3);
+    q12 *x = malloc(sizeof(q12) * frames * channels);
+    q12 *y = malloc(sizeof(q12) * frames * channels);
+    q12 *b_q = malloc(sizeof(q12) * (sos_d ? 6 * order : order));
+    q12 *a_q = malloc(sizeof(q12) * order);
 
-        benchmark_fixed_q24(fp, "bessel_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3);
-        benchmark_fixed_q12(fp, "bessel_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3);
+    if (sos_d) convert_sos_to_q12(sos_d, (q12 (*)[6])b_q, order);
+    else convert_ba_to_q12(b_d, a_d, b_q, a_q, order);
+    generate_white_noise_q12(x, frames * channels);
+    memset(y, 0, sizeof(q12) * frames * channels);
 
-        benchmark_fixed_q24(fp, "bessel_df1_order4_cut1000_f64_ba", "DF1", DF1_q24, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "bessel_df1_order4_cut1000_f64_ba", "DF1", DF1_q12, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5);
+    start = timing_now();
+    if (layout < 0) {
+        for (int c = 0; c < channels; ++c) {
+            if (sos_d) CASCADE_ip_q12(x + (size_t)c * frames, y + (size_t)c * frames, b_q, frames, order);
+            else TDF2_q12(x + (size_t)c * frames, y + (size_t)c * frames, b_q, a_q, frames, order);
+        }
+    } else {
+        if (sos_d) CASCADE_mc_q12_s(x, y, b_q, frames, order, channels, layout);
+        else TDF2_mc_q12_s(x, y, b_q, a_q, frames, order, channels, layout);
+    }
+    end = timing_now();
+    time_spent = timing_seconds(start, end);
+    double sps = (double)frames / time_spent;
 
-        benchmark_fixed_q24(fp, "bessel_df2_order4_cut1000_f64_ba", "DF2", DF2_q24, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "bessel_df2_order4_cut1000_f64_ba", "DF2", DF2_q12, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5);
+    fprintf(fp, "%s,q12,%s,%d,%d,%d,%s,%.6f,%.1f\n", filter_type, structure, cutoff, rank, channels, mc_layout_name(layout), time_spent, sps);
+    printf("[LOG] %s (q12, %s, cut %d, order %d, %d ch, %s): %.6f sec, %.3e samples/s/ch\n", filter_type, structure, cutoff, rank, channels, mc_layout_name(layout), time_spent, sps);
 
-        benchmark_fixed_q24(fp, "bessel_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "bessel_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5);
+    free(x); free(y); free(b_q); free(a_q);
+}
 
-        benchmark_fixed_q24(fp, "bessel_df1_order4_cut2000_f64_ba", "DF1", DF1_q24, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "bessel_df1_order4_cut2000_f64_ba", "DF1", DF1_q12, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5);
+// Tryb "mc": ./TimeAnalysis_fixed mc
+int run_mc_benchmark(void) {
+    static const int channel_counts[] = {8, 16, 32, 64};
+    FILE *fp = fopen("c_fixed_mc_results" RESULTS_SUFFIX ".csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
 
-        benchmark_fixed_q24(fp, "bessel_df2_order4_cut2000_f64_ba", "DF2", DF2_q24, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "bessel_df2_order4_cut2000_f64_ba", "DF2", DF2_q12, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5);
+    fprintf(fp, "filter_name,type,structure,cutoff,order,channels,layout,time_seconds,samples_per_sec_per_channel\n");
 
-        benchmark_fixed_q24(fp, "bessel_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "bessel_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5);
+    for (size_t i = 0; i < 20; i++)
+    {
+        for (int k = 0; k < 4; ++k) {
+            int ch = channel_counts[k];
+            for (int layout = -1; layout <= MC_PLANAR; ++layout) {
+                benchmark_mc_q24(fp, "ellip_tdf2_order8_cut1000_f64_ba", ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], NULL, 9, ch, layout);
+                benchmark_mc_q24(fp, "ellip_cascade_order8_cut1000_f64_sos", NULL, NULL, ellip_cascade_order8_cut1000_f64_sos, 4, ch, layout);
+                benchmark_mc_q12(fp, "ellip_tdf2_order8_cut1000_f64_ba", ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], NULL, 9, ch, layout);
+                benchmark_mc_q12(fp, "ellip_cascade_order8_cut1000_f64_sos", NULL, NULL, ellip_cascade_order8_cut1000_f64_sos, 4, ch, layout);
+            }
+        }
+    }
 
-        benchmark_fixed_q24(fp, "bessel_df1_order4_cut5000_f64_ba", "DF1", DF1_q24, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "bessel_df1_order4_cut5000_f64_ba", "DF1", DF1_q12, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5);
+    fclose(fp);
+    return 0;
+}
 
-        benchmark_fixed_q24(fp, "bessel_df2_order4_cut5000_f64_ba", "DF2", DF2_q24, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "bessel_df2_order4_cut5000_f64_ba", "DF2", DF2_q12, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5);
+// === Formaty Qm.n (structuresQn.h) ===
+// Wszystkie formaty i polityki z qn_table dla jednego filtru. sos_d != NULL -> CASCADE
+// (order = liczba sekcji), w przeciwnym razie structure ("DF1" / "DF2" / "TDF2").
+void benchmark_qn(FILE *fp, const char *filter_name, const char *structure,
+                  const double *b_d, const double *a_d, const double sos_d[][6], int order) {
+    timing_t start, end;
+    int cutoff = -1;
+    int rank = sos_d ? 2 * order : order - 1;
+    int ncoef = sos_d ? 6 * order : order;
 
-        benchmark_fixed_q24(fp, "bessel_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5);
-        benchmark_fixed_q12(fp, "bessel_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_fixed_q24(fp, "bessel_df1_order6_cut1000_f64_ba", "DF1", DF1_q24, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "bessel_df1_order6_cut1000_f64_ba", "DF1", DF1_q12, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_fixed_q24(fp, "bessel_df2_order6_cut1000_f64_ba", "DF2", DF2_q24, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "bessel_df2_order6_cut1000_f64_ba", "DF2", DF2_q12, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7);
+    double *noise = malloc(sizeof(double) * N);
+    generate_white_noise_d(noise, N);
+
+    for (int t = 0; t < qn_table_size; ++t) {
+        const qn_kernels *k = &qn_table[t];
+        void *x = malloc((size_t)k->bytes * N);
+        void *y = malloc((size_t)k->bytes * N);
+        void *b_q = calloc(ncoef, k->bytes);
+        void *a_q = calloc(ncoef, k->bytes);
+        sat_stats st = {0};
+
+        if (sos_d) qn_from_double(k, b_q, &sos_d[0][0], ncoef, k->cfrac);
+        else {
+            qn_from_double(k, b_q, b_d, order, k->cfrac);
+            qn_from_double(k, a_q, a_d, order, k->cfrac);
+        }
+        qn_from_double(k, x, noise, N, k->frac);
 
-        benchmark_fixed_q24(fp, "bessel_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "bessel_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7);
+        qn_ba_func ba = (strcmp(structure, "DF1") == 0) ? k->df1 : (strcmp(structure, "DF2") == 0) ? k->df2 : k->tdf2;
 
-        benchmark_fixed_q24(fp, "bessel_df1_order6_cut2000_f64_ba", "DF1", DF1_q24, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "bessel_df1_order6_cut2000_f64_ba", "DF1", DF1_q12, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7);
+        sat_begin();
+        start = timing_now();
 
-        benchmark_fixed_q24(fp, "bessel_df2_order6_cut2000_f64_ba", "DF2", DF2_q24, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "bessel_df2_order6_cut2000_f64_ba", "DF2", DF2_q12, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7);
+        if (sos_d) k->cascade(x, y, b_q, N, order);
+        else ba(x, y, b_q, a_q, N, order);
 
-        benchmark_fixed_q24(fp, "bessel_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "bessel_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7);
+        end = timing_now();
+        double time_spent = timing_seconds(start, end);
+        sat_end(&st);
 
-        benchmark_fixed_q24(fp, "bessel_df1_order6_cut5000_f64_ba", "DF1", DF1_q24, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "bessel_df1_order6_cut5000_f64_ba", "DF1", DF1_q12, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7);
+        fprintf(fp, "%s,%s,%d,%d,%d,%s,%s,%d,%d,%.6f", filter_type, k->name, 8 * k->bytes, k->frac, k->cfrac,
+                k->policy, structure, cutoff, rank, time_spent);
+        sat_fprint_columns(fp, &st, sos_d ? order : 1);
+        fprintf(fp, "\n");
+        printf("[LOG] %s (%s %s, %s, cut %d, order %d): %.6f sec\n", filter_type, k->name, k->policy, structure, cutoff, rank, time_spent);
 
-        benchmark_fixed_q24(fp, "bessel_df2_order6_cut5000_f64_ba", "DF2", DF2_q24, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "bessel_df2_order6_cut5000_f64_ba", "DF2", DF2_q12, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7);
+        free(x); free(y); free(b_q); free(a_q);
+    }
 
-        benchmark_fixed_q24(fp, "bessel_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7);
-        benchmark_fixed_q12(fp, "bessel_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7);
+    free(noise);
+}
 
-        benchmark_fixed_q24(fp, "bessel_df1_order8_cut1000_f64_ba", "DF1", DF1_q24, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "bessel_df1_order8_cut1000_f64_ba", "DF1", DF1_q12, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9);
+// Tryb "qn": ./TimeAnalysis_fixed qn
+int run_qn_benchmark(void) {
+    FILE *fp = fopen("c_fixed_qn_results" RESULTS_SUFFIX ".csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
 
-        benchmark_fixed_q24(fp, "bessel_df2_order8_cut1000_f64_ba", "DF2", DF2_q24, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "bessel_df2_order8_cut1000_f64_ba", "DF2", DF2_q12, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9);
+    fprintf(fp, "filter_name,type,bits,frac,cfrac,policy,structure,cutoff,order,time_seconds" SAT_CSV_HEADER "\n");
 
-        benchmark_fixed_q24(fp, "bessel_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "bessel_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9);
+    for (size_t i = 0; i < 20; i++)
+    {
+        benchmark_qn(fp, "butter_df1_order2_cut1000_f64_ba", "DF1", butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], NULL, 3);
+        benchmark_qn(fp, "butter_df2_order2_cut1000_f64_ba", "DF2", butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], NULL, 3);
+        benchmark_qn(fp, "butter_tdf2_order2_cut1000_f64_ba", "TDF2", butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], NULL, 3);
+        benchmark_qn(fp, "butter_cascade_order2_cut1000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order2_cut1000_f64_sos, 1);
+        benchmark_qn(fp, "ellip_df1_order8_cut1000_f64_ba", "DF1", ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_qn(fp, "ellip_df2_order8_cut1000_f64_ba", "DF2", ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_qn(fp, "ellip_tdf2_order8_cut1000_f64_ba", "TDF2", ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], NULL, 9);
+        benchmark_qn(fp, "ellip_cascade_order8_cut1000_f64_sos", "CASCADE", NULL, NULL, ellip_cascade_order8_cut1000_f64_sos, 4);
+    }
 
-        benchmark_fixed_q24(fp, "bessel_df1_order8_cut2000_f64_ba", "DF1", DF1_q24, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "bessel_df1_order8_cut2000_f64_ba", "DF1", DF1_q12, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9);
+    fclose(fp);
+    return 0;
+}
 
-        benchmark_fixed_q24(fp, "bessel_df2_order8_cut2000_f64_ba", "DF2", DF2_q24, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "bessel_df2_order8_cut2000_f64_ba", "DF2", DF2_q12, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9);
+// === Przegląd hierarchii pamięci ===
+// Zbiór roboczy (wejście + wyjście) od SWEEP_MIN_BYTES do SWEEP_MAX_BYTES, co 2x; przy każdym
+// rozmiarze ta sama liczba próbek (mały bufor filtrowany wielokrotnie), jak w TimeAnalysis.c.
+// Rozmiar, od którego rośnie ns_per_sample, to granica pracy ograniczonej obliczeniami.
+#define SWEEP_MIN_BYTES (4L << 10)
+#define SWEEP_MAX_BYTES (256L << 20)
+#define SWEEP_REPS 3
+
+static void sweep_kernel_q24(const char *structure, q24 *x, q24 *y, q24 *b, q24 *a, q24 *sos, int n, int order) {
+    if (strcmp(structure, "DF1") == 0) DF1_q24(x, y, b, a, n, order);
+    else if (strcmp(structure, "DF2") == 0) DF2_q24(x, y, b, a, n, order);
+    else if (strcmp(structure, "TDF2") == 0) TDF2_q24(x, y, b, a, n, order);
+    else CASCADE_ip_q24(x, y, sos, n, order);
+}
 
-        benchmark_fixed_q24(fp, "bessel_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "bessel_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9);
+// sos_d != NULL -> CASCADE (order = liczba sekcji), w przeciwnym razie b_d, a_d.
+void benchmark_sweep_q24(FILE *fp, const char *filter_name, const char *structure,
+                        const double *b_d, const double *a_d, const double sos_d[][6], int order) {
+    timing_t start, end;
+    int cutoff = -1;
+    int csv_order = sos_d ? 2 * order : order - 1;
+    long total = SWEEP_MAX_BYTES / (2 * sizeof(q24));
 
-        benchmark_fixed_q24(fp, "bessel_df1_order8_cut5000_f64_ba", "DF1", DF1_q24, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "bessel_df1_order8_cut5000_f64_ba", "DF1", DF1_q12, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_fixed_q24(fp, "bessel_df2_order8_cut5000_f64_ba", "DF2", DF2_q24, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "bessel_df2_order8_cut5000_f64_ba", "DF2", DF2_q12, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_fixed_q24(fp, "bessel_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9);
-        benchmark_fixed_q12(fp, "bessel_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9);
+    q24 *x = pool_buffer(POOL_X, sizeof(q24) * total);
+    q24 *y = pool_buffer(POOL_Y, sizeof(q24) * total);
+    q24 *b_q = NULL, *a_q = NULL;
+    q24 (*sos_q)[6] = NULL;
+
+    if (sos_d) {
+        sos_q = malloc(sizeof(q24) * 6 * order);
+        convert_sos_to_q24(sos_d, sos_q, order);
+    } else {
+        b_q = malloc(sizeof(q24) * order);
+        a_q = malloc(sizeof(q24) * order);
+        convert_ba_to_q24(b_d, a_d, b_q, a_q, order);
+    }
+    generate_white_noise_q24(x, (int)total);
 
-        // --- CASCADE SOS ---
-        benchmark_cascade_q24(fp, "butter_cascade_order2_cut1000_f64_sos", CASCADE_q24, butter_cascade_order2_cut1000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "butter_cascade_order2_cut1000_f64_sos", CASCADE_q12, butter_cascade_order2_cut1000_f64_sos, 1);
+    for (long ws = SWEEP_MIN_BYTES; ws <= SWEEP_MAX_BYTES; ws *= 2) {
+        int n = (int)(ws / (2 * sizeof(q24)));
+        long calls = total / n;
 
-        benchmark_cascade_q24(fp, "butter_cascade_order2_cut2000_f64_sos", CASCADE_q24, butter_cascade_order2_cut2000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "butter_cascade_order2_cut2000_f64_sos", CASCADE_q12, butter_cascade_order2_cut2000_f64_sos, 1);
+        if (calls > 1) sweep_kernel_q24(structure, x, y, b_q, a_q, (q24*)sos_q, n, order);  // rozgrzanie cache
 
-        benchmark_cascade_q24(fp, "butter_cascade_order2_cut5000_f64_sos", CASCADE_q24, butter_cascade_order2_cut5000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "butter_cascade_order2_cut5000_f64_sos", CASCADE_q12, butter_cascade_order2_cut5000_f64_sos, 1);
+        start = timing_now();
+        for (long c = 0; c < calls; ++c)
+            sweep_kernel_q24(structure, x, y, b_q, a_q, (q24*)sos_q, n, order);
+        end = timing_now();
+        double t = timing_seconds(start, end);
 
-        benchmark_cascade_q24(fp, "butter_cascade_order4_cut1000_f64_sos", CASCADE_q24, butter_cascade_order4_cut1000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "butter_cascade_order4_cut1000_f64_sos", CASCADE_q12, butter_cascade_order4_cut1000_f64_sos, 2);
+        fprintf(fp, "%s,q24,%s,%d,%d,%ld,%d,%ld,%.6f,%.4f,%.1f,%.3f\n", filter_type, structure, cutoff, csv_order,
+                ws, n, calls, t, t * 1e9 / total, total / t, (double)ws * calls / t / 1e9);
+        printf("[LOG] %s (q24, %s, cut %d, order %d, %ld KB): %.4f ns/sample\n", filter_type, structure, cutoff, csv_order,
+               ws >> 10, t * 1e9 / total);
+    }
 
-        benchmark_cascade_q24(fp, "butter_cascade_order4_cut2000_f64_sos", CASCADE_q24, butter_cascade_order4_cut2000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "butter_cascade_order4_cut2000_f64_sos", CASCADE_q12, butter_cascade_order4_cut2000_f64_sos, 2);
+    free(b_q); free(a_q); free(sos_q);
+}
 
-        benchmark_cascade_q24(fp, "butter_cascade_order4_cut5000_f64_sos", CASCADE_q24, butter_cascade_order4_cut5000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "butter_cascade_order4_cut5000_f64_sos", CASCADE_q12, butter_cascade_order4_cut5000_f64_sos, 2);
+static void sweep_kernel_q12(const char *structure, q12 *x, q12 *y, q12 *b, q12 *a, q12 *sos, int n, int order) {
+    if (strcmp(structure, "DF1") == 0) DF1_q12(x, y, b, a, n, order);
+    else if (strcmp(structure, "DF2") == 0) DF2_q12(x, y, b, a, n, order);
+    else if (strcmp(structure, "TDF2") == 0) TDF2_q12(x, y, b, a, n, order);
+    else CASCADE_ip_q12(x, y, sos, n, order);
+}
 
-        benchmark_cascade_q24(fp, "butter_cascade_order6_cut1000_f64_sos", CASCADE_q24, butter_cascade_order6_cut1000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "butter_cascade_order6_cut1000_f64_sos", CASCADE_q12, butter_cascade_order6_cut1000_f64_sos, 3);
+// sos_d != NULL -> CASCADE (order = liczba sekcji), w przeciwnym razie b_d, a_d.
+void benchmark_sweep_q12(FILE *fp, const char *filter_name, const char *structure,
+                        const double *b_d, const double *a_d, const double sos_d[][6], int order) {
+    timing_t start, end;
+    int cutoff = -1;
+    int csv_order = sos_d ? 2 * order : order - 1;
+    long total = SWEEP_MAX_BYTES / (2 * sizeof(q12));
 
-        benchmark_cascade_q24(fp, "butter_cascade_order6_cut2000_f64_sos", CASCADE_q24, butter_cascade_order6_cut2000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "butter_cascade_order6_cut2000_f64_sos", CASCADE_q12, butter_cascade_order6_cut2000_f64_sos, 3);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_cascade_q24(fp, "butter_cascade_order6_cut5000_f64_sos", CASCADE_q24, butter_cascade_order6_cut5000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "butter_cascade_order6_cut5000_f64_sos", CASCADE_q12, butter_cascade_order6_cut5000_f64_sos, 3);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_cascade_q24(fp, "butter_cascade_order8_cut1000_f64_sos", CASCADE_q24, butter_cascade_order8_cut1000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "butter_cascade_order8_cut1000_f64_sos", CASCADE_q12, butter_cascade_order8_cut1000_f64_sos, 4);
+    q12 *x = pool_buffer(POOL_X, sizeof(q12) * total);
+    q12 *y = pool_buffer(POOL_Y, sizeof(q12) * total);
+    q12 *b_q = NULL, *a_q = NULL;
+    q12 (*sos_q)[6] = NULL;
+
+    if (sos_d) {
+        sos_q = malloc(sizeof(q12) * 6 * order);
+        convert_sos_to_q12(sos_d, sos_q, order);
+    } else {
+        b_q = malloc(sizeof(q12) * order);
+        a_q = malloc(sizeof(q12) * order);
+        convert_ba_to_q12(b_d, a_d, b_q, a_q, order);
+    }
+    generate_white_noise_q12(x, (int)total);
 
-        benchmark_cascade_q24(fp, "butter_cascade_order8_cut2000_f64_sos", CASCADE_q24, butter_cascade_order8_cut2000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "butter_cascade_order8_cut2000_f64_sos", CASCADE_q12, butter_cascade_order8_cut2000_f64_sos, 4);
+    for (long ws = SWEEP_MIN_BYTES; ws <= SWEEP_MAX_BYTES; ws *= 2) {
+        int n = (int)(ws / (2 * sizeof(q12)));
+        long calls = total / n;
 
-        benchmark_cascade_q24(fp, "butter_cascade_order8_cut5000_f64_sos", CASCADE_q24, butter_cascade_order8_cut5000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "butter_cascade_order8_cut5000_f64_sos", CASCADE_q12, butter_cascade_order8_cut5000_f64_sos, 4);
+        if (calls > 1) sweep_kernel_q12(structure, x, y, b_q, a_q, (q12*)sos_q, n, order);  // rozgrzanie cache
 
-        benchmark_cascade_q24(fp, "cheby1_cascade_order2_cut1000_f64_sos", CASCADE_q24, cheby1_cascade_order2_cut1000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "cheby1_cascade_order2_cut1000_f64_sos", CASCADE_q12, cheby1_cascade_order2_cut1000_f64_sos, 1);
+        start = timing_now();
+        for (long c = 0; c < calls; ++c)
+            sweep_kernel_q12(structure, x, y, b_q, a_q, (q12*)sos_q, n, order);
+        end = timing_now();
+        double t = timing_seconds(start, end);
 
-        benchmark_cascade_q24(fp, "cheby1_cascade_order2_cut2000_f64_sos", CASCADE_q24, cheby1_cascade_order2_cut2000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "cheby1_cascade_order2_cut2000_f64_sos", CASCADE_q12, cheby1_cascade_order2_cut2000_f64_sos, 1);
+        fprintf(fp, "%s,q12,%s,%d,%d,%ld,%d,%ld,%.6f,%.4f,%.1f,%.3f\n", filter_type, structure, cutoff, csv_order,
+                ws, n, calls, t, t * 1e9 / total, total / t, (double)ws * calls / t / 1e9);
+        printf("[LOG] %s (q12, %s, cut %d, order %d, %ld KB): %.4f ns/sample\n", filter_type, structure, cutoff, csv_order,
+               ws >> 10, t * 1e9 / total);
+    }
 
-        benchmark_cascade_q24(fp, "cheby1_cascade_order2_cut5000_f64_sos", CASCADE_q24, cheby1_cascade_order2_cut5000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "cheby1_cascade_order2_cut5000_f64_sos", CASCADE_q12, cheby1_cascade_order2_cut5000_f64_sos, 1);
+    free(b_q); free(a_q); free(sos_q);
+}
 
-        benchmark_cascade_q24(fp, "cheby1_cascade_order4_cut1000_f64_sos", CASCADE_q24, cheby1_cascade_order4_cut1000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "cheby1_cascade_order4_cut1000_f64_sos", CASCADE_q12, cheby1_cascade_order4_cut1000_f64_sos, 2);
+// Tryb "sweep": ./TimeAnalysis_fixed sweep
+int run_sweep_benchmark(void) {
+    FILE *fp = fopen("c_fixed_sweep_results" RESULTS_SUFFIX ".csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
 
-        benchmark_cascade_q24(fp, "cheby1_cascade_order4_cut2000_f64_sos", CASCADE_q24, cheby1_cascade_order4_cut2000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "cheby1_cascade_order4_cut2000_f64_sos", CASCADE_q12, cheby1_cascade_order4_cut2000_f64_sos, 2);
+    fprintf(fp, "filter_name,type,structure,cutoff,order,working_set_bytes,n,calls,time_seconds,ns_per_sample,samples_per_sec,gbytes_per_sec\n");
+
+    for (size_t i = 0; i < SWEEP_REPS; i++) {
+        benchmark_sweep_q24(fp, "butter_df1_order2_cut2000_f64_ba", "DF1", butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], NULL, 3);
+        benchmark_sweep_q24(fp, "butter_df2_order2_cut2000_f64_ba", "DF2", butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], NULL, 3);
+        benchmark_sweep_q24(fp, "butter_tdf2_order2_cut2000_f64_ba", "TDF2", butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], NULL, 3);
+        benchmark_sweep_q24(fp, "butter_cascade_order2_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order2_cut2000_f64_sos, 1);
+        benchmark_sweep_q12(fp, "butter_df1_order2_cut2000_f64_ba", "DF1", butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], NULL, 3);
+        benchmark_sweep_q12(fp, "butter_df2_order2_cut2000_f64_ba", "DF2", butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], NULL, 3);
+        benchmark_sweep_q12(fp, "butter_tdf2_order2_cut2000_f64_ba", "TDF2", butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], NULL, 3);
+        benchmark_sweep_q12(fp, "butter_cascade_order2_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order2_cut2000_f64_sos, 1);
+        benchmark_sweep_q24(fp, "butter_df1_order4_cut2000_f64_ba", "DF1", butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], NULL, 5);
+        benchmark_sweep_q24(fp, "butter_df2_order4_cut2000_f64_ba", "DF2", butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], NULL, 5);
+        benchmark_sweep_q24(fp, "butter_tdf2_order4_cut2000_f64_ba", "TDF2", butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], NULL, 5);
+        benchmark_sweep_q24(fp, "butter_cascade_order4_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order4_cut2000_f64_sos, 2);
+        benchmark_sweep_q12(fp, "butter_df1_order4_cut2000_f64_ba", "DF1", butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], NULL, 5);
+        benchmark_sweep_q12(fp, "butter_df2_order4_cut2000_f64_ba", "DF2", butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], NULL, 5);
+        benchmark_sweep_q12(fp, "butter_tdf2_order4_cut2000_f64_ba", "TDF2", butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], NULL, 5);
+        benchmark_sweep_q12(fp, "butter_cascade_order4_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order4_cut2000_f64_sos, 2);
+        benchmark_sweep_q24(fp, "butter_df1_order8_cut2000_f64_ba", "DF1", butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_sweep_q24(fp, "butter_df2_order8_cut2000_f64_ba", "DF2", butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_sweep_q24(fp, "butter_tdf2_order8_cut2000_f64_ba", "TDF2", butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_sweep_q24(fp, "butter_cascade_order8_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order8_cut2000_f64_sos, 4);
+        benchmark_sweep_q12(fp, "butter_df1_order8_cut2000_f64_ba", "DF1", butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_sweep_q12(fp, "butter_df2_order8_cut2000_f64_ba", "DF2", butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_sweep_q12(fp, "butter_tdf2_order8_cut2000_f64_ba", "TDF2", butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_sweep_q12(fp, "butter_cascade_order8_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order8_cut2000_f64_sos, 4);
+    }
 
-        benchmark_cascade_q24(fp, "cheby1_cascade_order4_cut5000_f64_sos", CASCADE_q24, cheby1_cascade_order4_cut5000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "cheby1_cascade_order4_cut5000_f64_sos", CASCADE_q12, cheby1_cascade_order4_cut5000_f64_sos, 2);
+    fclose(fp);
+    return 0;
+}
 
-        benchmark_cascade_q24(fp, "cheby1_cascade_order6_cut1000_f64_sos", CASCADE_q24, cheby1_cascade_order6_cut1000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "cheby1_cascade_order6_cut1000_f64_sos", CASCADE_q12, cheby1_cascade_order6_cut1000_f64_sos, 3);
+// === Opóźnienie pojedynczych bloków ===
+// Jak tryb latency w TimeAnalysis.c, ale jądra stałopozycyjne nie mają wersji strumieniowych:
+// każdy blok to osobne wywołanie od zerowego stanu (jak block= w bench_params). Praca na blok
+// jest ta sama, więc rozkład czasów jest miarodajny, choć wyjście na granicach bloków nie.
+// c_fixed_latency_summary*.csv - p50/p99/p99.9/max, c_fixed_latency_hist*.csv - kubełki histogramu.
+static const int latency_blocks[] = {32, 64, 128, 256, 512};
+#define NUM_LATENCY_BLOCKS (int)(sizeof(latency_blocks) / sizeof(latency_blocks[0]))
+#define LATENCY_WARMUP 64
 
-        benchmark_cascade_q24(fp, "cheby1_cascade_order6_cut2000_f64_sos", CASCADE_q24, cheby1_cascade_order6_cut2000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "cheby1_cascade_order6_cut2000_f64_sos", CASCADE_q12, cheby1_cascade_order6_cut2000_f64_sos, 3);
+static lat_hist lat_h;
 
-        benchmark_cascade_q24(fp, "cheby1_cascade_order6_cut5000_f64_sos", CASCADE_q24, cheby1_cascade_order6_cut5000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "cheby1_cascade_order6_cut5000_f64_sos", CASCADE_q12, cheby1_cascade_order6_cut5000_f64_sos, 3);
+// sos_d != NULL -> CASCADE (order = liczba sekcji), w przeciwnym razie b_d, a_d.
+void benchmark_latency_q24(FILE *fp_sum, FILE *fp_hist, const char *filter_name, const char *structure,
+                          const double *b_d, const double *a_d, const double sos_d[][6], int order) {
+    int cutoff = -1;
+    int csv_order = sos_d ? 2 * order : order - 1;
+    char key[128];
 
-        benchmark_cascade_q24(fp, "cheby1_cascade_order8_cut1000_f64_sos", CASCADE_q24, cheby1_cascade_order8_cut1000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "cheby1_cascade_order8_cut1000_f64_sos", CASCADE_q12, cheby1_cascade_order8_cut1000_f64_sos, 4);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_cascade_q24(fp, "cheby1_cascade_order8_cut2000_f64_sos", CASCADE_q24, cheby1_cascade_order8_cut2000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "cheby1_cascade_order8_cut2000_f64_sos", CASCADE_q12, cheby1_cascade_order8_cut2000_f64_sos, 4);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_cascade_q24(fp, "cheby1_cascade_order8_cut5000_f64_sos", CASCADE_q24, cheby1_cascade_order8_cut5000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "cheby1_cascade_order8_cut5000_f64_sos", CASCADE_q12, cheby1_cascade_order8_cut5000_f64_sos, 4);
+    q24 *x = pool_buffer(POOL_X, sizeof(q24) * N);
+    q24 *y = pool_buffer(POOL_Y, sizeof(q24) * N);
+    q24 *b_q = NULL, *a_q = NULL;
+    q24 (*sos_q)[6] = NULL;
+
+    if (sos_d) {
+        sos_q = malloc(sizeof(q24) * 6 * order);
+        convert_sos_to_q24(sos_d, sos_q, order);
+    } else {
+        b_q = malloc(sizeof(q24) * order);
+        a_q = malloc(sizeof(q24) * order);
+        convert_ba_to_q24(b_d, a_d, b_q, a_q, order);
+    }
+    generate_white_noise_q24(x, N);
 
-        benchmark_cascade_q24(fp, "cheby2_cascade_order2_cut1000_f64_sos", CASCADE_q24, cheby2_cascade_order2_cut1000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "cheby2_cascade_order2_cut1000_f64_sos", CASCADE_q12, cheby2_cascade_order2_cut1000_f64_sos, 1);
+    for (int k = 0; k < NUM_LATENCY_BLOCKS; ++k) {
+        int block = latency_blocks[k];
+        lat_reset(&lat_h);
 
-        benchmark_cascade_q24(fp, "cheby2_cascade_order2_cut2000_f64_sos", CASCADE_q24, cheby2_cascade_order2_cut2000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "cheby2_cascade_order2_cut2000_f64_sos", CASCADE_q12, cheby2_cascade_order2_cut2000_f64_sos, 1);
+        for (int off = 0, i = 0; off + block <= N; off += block, ++i) {
+            timing_t start = timing_now();
+            sweep_kernel_q24(structure, x + off, y + off, b_q, a_q, (q24*)sos_q, block, order);
+            timing_t end = timing_now();
+            if (i >= LATENCY_WARMUP) lat_record(&lat_h, timing_ns(start, end));
+        }
 
-        benchmark_cascade_q24(fp, "cheby2_cascade_order2_cut5000_f64_sos", CASCADE_q24, cheby2_cascade_order2_cut5000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "cheby2_cascade_order2_cut5000_f64_sos", CASCADE_q12, cheby2_cascade_order2_cut5000_f64_sos, 1);
+        snprintf(key, sizeof(key), "%s,q24,%s,%d,%d,%d", filter_type, structure, cutoff, csv_order, block);
+        fprintf(fp_sum, "%s", key);
+        lat_fprint_summary(fp_sum, &lat_h);
+        fprintf(fp_sum, "\n");
+        lat_fprint_buckets(fp_hist, key, &lat_h);
+        printf("[LOG] %s (q24, %s, cut %d, order %d, block %d): p50 %llu ns, p99 %llu ns, p99.9 %llu ns, max %llu ns\n",
+               filter_type, structure, cutoff, csv_order, block, (unsigned long long)lat_quantile(&lat_h, 0.5),
+               (unsigned long long)lat_quantile(&lat_h, 0.99), (unsigned long long)lat_quantile(&lat_h, 0.999),
+               (unsigned long long)lat_h.max);
+    }
 
-        benchmark_cascade_q24(fp, "cheby2_cascade_order4_cut1000_f64_sos", CASCADE_q24, cheby2_cascade_order4_cut1000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "cheby2_cascade_order4_cut1000_f64_sos", CASCADE_q12, cheby2_cascade_order4_cut1000_f64_sos, 2);
+    free(b_q); free(a_q); free(sos_q);
+}
 
-        benchmark_cascade_q24(fp, "cheby2_cascade_order4_cut2000_f64_sos", CASCADE_q24, cheby2_cascade_order4_cut2000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "cheby2_cascade_order4_cut2000_f64_sos", CASCADE_q12, cheby2_cascade_order4_cut2000_f64_sos, 2);
+// sos_d != NULL -> CASCADE (order = liczba sekcji), w przeciwnym razie b_d, a_d.
+void benchmark_latency_q12(FILE *fp_sum, FILE *fp_hist, const char *filter_name, const char *structure,
+                          const double *b_d, const double *a_d, const double sos_d[][6], int order) {
+    int cutoff = -1;
+    int csv_order = sos_d ? 2 * order : order - 1;
+    char key[128];
 
-        benchmark_cascade_q24(fp, "cheby2_cascade_order4_cut5000_f64_sos", CASCADE_q24, cheby2_cascade_order4_cut5000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "cheby2_cascade_order4_cut5000_f64_sos", CASCADE_q12, cheby2_cascade_order4_cut5000_f64_sos, 2);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_cascade_q24(fp, "cheby2_cascade_order6_cut1000_f64_sos", CASCADE_q24, cheby2_cascade_order6_cut1000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "cheby2_cascade_order6_cut1000_f64_sos", CASCADE_q12, cheby2_cascade_order6_cut1000_f64_sos, 3);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_cascade_q24(fp, "cheby2_cascade_order6_cut2000_f64_sos", CASCADE_q24, cheby2_cascade_order6_cut2000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "cheby2_cascade_order6_cut2000_f64_sos", CASCADE_q12, cheby2_cascade_order6_cut2000_f64_sos, 3);
+    q12 *x = pool_buffer(POOL_X, sizeof(q12) * N);
+    q12 *y = pool_buffer(POOL_Y, sizeof(q12) * N);
+    q12 *b_q = NULL, *a_q = NULL;
+    q12 (*sos_q)[6] = NULL;
+
+    if (sos_d) {
+        sos_q = malloc(sizeof(q12) * 6 * order);
+        convert_sos_to_q12(sos_d, sos_q, order);
+    } else {
+        b_q = malloc(sizeof(q12) * order);
+        a_q = malloc(sizeof(q12) * order);
+        convert_ba_to_q12(b_d, a_d, b_q, a_q, order);
+    }
+    generate_white_noise_q12(x, N);
 
-        benchmark_cascade_q24(fp, "cheby2_cascade_order6_cut5000_f64_sos", CASCADE_q24, cheby2_cascade_order6_cut5000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "cheby2_cascade_order6_cut5000_f64_sos", CASCADE_q12, cheby2_cascade_order6_cut5000_f64_sos, 3);
+    for (int k = 0; k < NUM_LATENCY_BLOCKS; ++k) {
+        int block = latency_blocks[k];
+        lat_reset(&lat_h);
 
-        benchmark_cascade_q24(fp, "cheby2_cascade_order8_cut1000_f64_sos", CASCADE_q24, cheby2_cascade_order8_cut1000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "cheby2_cascade_order8_cut1000_f64_sos", CASCADE_q12, cheby2_cascade_order8_cut1000_f64_sos, 4);
+        for (int off = 0, i = 0; off + block <= N; off += block, ++i) {
+            timing_t start = timing_now();
+            sweep_kernel_q12(structure, x + off, y + off, b_q, a_q, (q12*)sos_q, block, order);
+            timing_t end = timing_now();
+            if (i >= LATENCY_WARMUP) lat_record(&lat_h, timing_ns(start, end));
+        }
 
-        benchmark_cascade_q24(fp, "cheby2_cascade_order8_cut2000_f64_sos", CASCADE_q24, cheby2_cascade_order8_cut2000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "cheby2_cascade_order8_cut2000_f64_sos", CASCADE_q12, cheby2_cascade_order8_cut2000_f64_sos, 4);
+        snprintf(key, sizeof(key), "%s,q12,%s,%d,%d,%d", filter_type, structure, cutoff, csv_order, block);
+        fprintf(fp_sum, "%s", key);
+        lat_fprint_summary(fp_sum, &lat_h);
+        fprintf(fp_sum, "\n");
+        lat_fprint_buckets(fp_hist, key, &lat_h);
+        printf("[LOG] %s (q12, %s, cut %d, order %d, block %d): p50 %llu ns, p99 %llu ns, p99.9 %llu ns, max %llu ns\n",
+               filter_type, structure, cutoff, csv_order, block, (unsigned long long)lat_quantile(&lat_h, 0.5),
+               (unsigned long long)lat_quantile(&lat_h, 0.99), (unsigned long long)lat_quantile(&lat_h, 0.999),
+               (unsigned long long)lat_h.max);
+    }
 
-        benchmark_cascade_q24(fp, "cheby2_cascade_order8_cut5000_f64_sos", CASCADE_q24, cheby2_cascade_order8_cut5000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "cheby2_cascade_order8_cut5000_f64_sos", CASCADE_q12, cheby2_cascade_order8_cut5000_f64_sos, 4);
+    free(b_q); free(a_q); free(sos_q);
+}
 
-        benchmark_cascade_q24(fp, "ellip_cascade_order2_cut1000_f64_sos", CASCADE_q24, ellip_cascade_order2_cut1000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "ellip_cascade_order2_cut1000_f64_sos", CASCADE_q12, ellip_cascade_order2_cut1000_f64_sos, 1);
+// Tryb "latency": ./TimeAnalysis_fixed latency
+int run_latency_benchmark(void) {
+    FILE *fp_sum = fopen("c_fixed_latency_summary" RESULTS_SUFFIX ".csv", "w");
+    FILE *fp_hist = fopen("c_fixed_latency_hist" RESULTS_SUFFIX ".csv", "w");
+    if (!fp_sum || !fp_hist) {
+        perror("Can't open CSV file");
+        return 1;
+    }
 
-        benchmark_cascade_q24(fp, "ellip_cascade_order2_cut2000_f64_sos", CASCADE_q24, ellip_cascade_order2_cut2000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "ellip_cascade_order2_cut2000_f64_sos", CASCADE_q12, ellip_cascade_order2_cut2000_f64_sos, 1);
+    fprintf(fp_sum, "filter_name,type,structure,cutoff,order,block" LAT_SUMMARY_CSV_HEADER "\n");
+    fprintf(fp_hist, "filter_name,type,structure,cutoff,order,block" LAT_HIST_CSV_HEADER "\n");
+
+    benchmark_latency_q24(fp_sum, fp_hist, "butter_df1_order2_cut2000_f64_ba", "DF1", butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], NULL, 3);
+    benchmark_latency_q24(fp_sum, fp_hist, "butter_df2_order2_cut2000_f64_ba", "DF2", butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], NULL, 3);
+    benchmark_latency_q24(fp_sum, fp_hist, "butter_tdf2_order2_cut2000_f64_ba", "TDF2", butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], NULL, 3);
+    benchmark_latency_q24(fp_sum, fp_hist, "butter_cascade_order2_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order2_cut2000_f64_sos, 1);
+    benchmark_latency_q12(fp_sum, fp_hist, "butter_df1_order2_cut2000_f64_ba", "DF1", butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], NULL, 3);
+    benchmark_latency_q12(fp_sum, fp_hist, "butter_df2_order2_cut2000_f64_ba", "DF2", butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], NULL, 3);
+    benchmark_latency_q12(fp_sum, fp_hist, "butter_tdf2_order2_cut2000_f64_ba", "TDF2", butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], NULL, 3);
+    benchmark_latency_q12(fp_sum, fp_hist, "butter_cascade_order2_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order2_cut2000_f64_sos, 1);
+    benchmark_latency_q24(fp_sum, fp_hist, "butter_df1_order4_cut2000_f64_ba", "DF1", butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], NULL, 5);
+    benchmark_latency_q24(fp_sum, fp_hist, "butter_df2_order4_cut2000_f64_ba", "DF2", butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], NULL, 5);
+    benchmark_latency_q24(fp_sum, fp_hist, "butter_tdf2_order4_cut2000_f64_ba", "TDF2", butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], NULL, 5);
+    benchmark_latency_q24(fp_sum, fp_hist, "butter_cascade_order4_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order4_cut2000_f64_sos, 2);
+    benchmark_latency_q12(fp_sum, fp_hist, "butter_df1_order4_cut2000_f64_ba", "DF1", butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], NULL, 5);
+    benchmark_latency_q12(fp_sum, fp_hist, "butter_df2_order4_cut2000_f64_ba", "DF2", butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], NULL, 5);
+    benchmark_latency_q12(fp_sum, fp_hist, "butter_tdf2_order4_cut2000_f64_ba", "TDF2", butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], NULL, 5);
+    benchmark_latency_q12(fp_sum, fp_hist, "butter_cascade_order4_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order4_cut2000_f64_sos, 2);
+    benchmark_latency_q24(fp_sum, fp_hist, "butter_df1_order8_cut2000_f64_ba", "DF1", butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], NULL, 9);
+    benchmark_latency_q24(fp_sum, fp_hist, "butter_df2_order8_cut2000_f64_ba", "DF2", butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], NULL, 9);
+    benchmark_latency_q24(fp_sum, fp_hist, "butter_tdf2_order8_cut2000_f64_ba", "TDF2", butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], NULL, 9);
+    benchmark_latency_q24(fp_sum, fp_hist, "butter_cascade_order8_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order8_cut2000_f64_sos, 4);
+    benchmark_latency_q12(fp_sum, fp_hist, "butter_df1_order8_cut2000_f64_ba", "DF1", butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], NULL, 9);
+    benchmark_latency_q12(fp_sum, fp_hist, "butter_df2_order8_cut2000_f64_ba", "DF2", butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], NULL, 9);
+    benchmark_latency_q12(fp_sum, fp_hist, "butter_tdf2_order8_cut2000_f64_ba", "TDF2", butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], NULL, 9);
+    benchmark_latency_q12(fp_sum, fp_hist, "butter_cascade_order8_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order8_cut2000_f64_sos, 4);
+
+    fclose(fp_sum);
+    fclose(fp_hist);
+    return 0;
+}
 
-        benchmark_cascade_q24(fp, "ellip_cascade_order2_cut5000_f64_sos", CASCADE_q24, ellip_cascade_order2_cut5000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "ellip_cascade_order2_cut5000_f64_sos", CASCADE_q12, ellip_cascade_order2_cut5000_f64_sos, 1);
+// === Symulacja wywołania zwrotnego audio ===
+// Jak tryb rtsim w TimeAnalysis.c; blok to osobne wywołanie jądra od zerowego stanu (jak w trybie latency).
+#define RTSIM_SECONDS 5
+#define RTSIM_BLOCK 128
 
-        benchmark_cascade_q24(fp, "ellip_cascade_order4_cut1000_f64_sos", CASCADE_q24, ellip_cascade_order4_cut1000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "ellip_cascade_order4_cut1000_f64_sos", CASCADE_q12, ellip_cascade_order4_cut1000_f64_sos, 2);
+static rtsim_result rtsim_res;
 
-        benchmark_cascade_q24(fp, "ellip_cascade_order4_cut2000_f64_sos", CASCADE_q24, ellip_cascade_order4_cut2000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "ellip_cascade_order4_cut2000_f64_sos", CASCADE_q12, ellip_cascade_order4_cut2000_f64_sos, 2);
+typedef struct {
+    const char *structure;
+    q24 *x, *y, *b, *a, *sos;
+    int order, pos, block;
+} rtsim_ctx_q24;
 
-        benchmark_cascade_q24(fp, "ellip_cascade_order4_cut5000_f64_sos", CASCADE_q24, ellip_cascade_order4_cut5000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "ellip_cascade_order4_cut5000_f64_sos", CASCADE_q12, ellip_cascade_order4_cut5000_f64_sos, 2);
+static void rtsim_process_q24(void *p) {
+    rtsim_ctx_q24 *c = p;
+    sweep_kernel_q24(c->structure, c->x + c->pos, c->y + c->pos, c->b, c->a, c->sos, c->block, c->order);
+    c->pos += c->block;
+    if (c->pos + c->block > N) c->pos = 0;
+}
 
-        benchmark_cascade_q24(fp, "ellip_cascade_order6_cut1000_f64_sos", CASCADE_q24, ellip_cascade_order6_cut1000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "ellip_cascade_order6_cut1000_f64_sos", CASCADE_q12, ellip_cascade_order6_cut1000_f64_sos, 3);
+// sos_d != NULL -> CASCADE (order = liczba sekcji), w przeciwnym razie b_d, a_d.
+void benchmark_rtsim_q24(FILE *fp, const rtsim_config *cfg, const char *filter_name, const char *structure,
+                        const double *b_d, const double *a_d, const double sos_d[][6], int order) {
+    int cutoff = -1;
+    int csv_order = sos_d ? 2 * order : order - 1;
+    rtsim_ctx_q24 c = { structure, NULL, NULL, NULL, NULL, NULL, order, 0, cfg->block };
 
-        benchmark_cascade_q24(fp, "ellip_cascade_order6_cut2000_f64_sos", CASCADE_q24, ellip_cascade_order6_cut2000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "ellip_cascade_order6_cut2000_f64_sos", CASCADE_q12, ellip_cascade_order6_cut2000_f64_sos, 3);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_cascade_q24(fp, "ellip_cascade_order6_cut5000_f64_sos", CASCADE_q24, ellip_cascade_order6_cut5000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "ellip_cascade_order6_cut5000_f64_sos", CASCADE_q12, ellip_cascade_order6_cut5000_f64_sos, 3);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_cascade_q24(fp, "ellip_cascade_order8_cut1000_f64_sos", CASCADE_q24, ellip_cascade_order8_cut1000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "ellip_cascade_order8_cut1000_f64_sos", CASCADE_q12, ellip_cascade_order8_cut1000_f64_sos, 4);
+    c.x = pool_buffer(POOL_X, sizeof(q24) * N);
+    c.y = pool_buffer(POOL_Y, sizeof(q24) * N);
+    if (sos_d) {
+        c.sos = malloc(sizeof(q24) * 6 * order);
+        convert_sos_to_q24(sos_d, (q24 (*)[6])c.sos, order);
+    } else {
+        c.b = malloc(sizeof(q24) * order);
+        c.a = malloc(sizeof(q24) * order);
+        convert_ba_to_q24(b_d, a_d, c.b, c.a, order);
+    }
+    generate_white_noise_q24(c.x, N);
+
+    if (rtsim_run(cfg, rtsim_process_q24, &c, &rtsim_res) != 0) {
+        printf("[LOG] rtsim not supported on this platform\n");
+    } else {
+        fprintf(fp, "%s,q24,%s,%d,%d", filter_type, structure, cutoff, csv_order);
+        rtsim_fprint_columns(fp, cfg, &rtsim_res);
+        fprintf(fp, "\n");
+        printf("[LOG] %s (q24, %s, cut %d, order %d, load %d, %s): %ld/%ld misses, WCET %llu ns, jitter p99 %llu ns\n",
+               filter_type, structure, cutoff, csv_order, cfg->load_threads, rtsim_res.fifo ? "fifo" : "other",
+               rtsim_res.misses, (long)rtsim_res.exec.total, (unsigned long long)rtsim_res.exec.max,
+               (unsigned long long)lat_quantile(&rtsim_res.jitter, 0.99));
+    }
 
-        benchmark_cascade_q24(fp, "ellip_cascade_order8_cut2000_f64_sos", CASCADE_q24, ellip_cascade_order8_cut2000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "ellip_cascade_order8_cut2000_f64_sos", CASCADE_q12, ellip_cascade_order8_cut2000_f64_sos, 4);
+    free(c.b); free(c.a); free(c.sos);
+}
 
-        benchmark_cascade_q24(fp, "ellip_cascade_order8_cut5000_f64_sos", CASCADE_q24, ellip_cascade_order8_cut5000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "ellip_cascade_order8_cut5000_f64_sos", CASCADE_q12, ellip_cascade_order8_cut5000_f64_sos, 4);
+typedef struct {
+    const char *structure;
+    q12 *x, *y, *b, *a, *sos;
+    int order, pos, block;
+} rtsim_ctx_q12;
+
+static void rtsim_process_q12(void *p) {
+    rtsim_ctx_q12 *c = p;
+    sweep_kernel_q12(c->structure, c->x + c->pos, c->y + c->pos, c->b, c->a, c->sos, c->block, c->order);
+    c->pos += c->block;
+    if (c->pos + c->block > N) c->pos = 0;
+}
 
-        benchmark_cascade_q24(fp, "bessel_cascade_order2_cut1000_f64_sos", CASCADE_q24, bessel_cascade_order2_cut1000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "bessel_cascade_order2_cut1000_f64_sos", CASCADE_q12, bessel_cascade_order2_cut1000_f64_sos, 1);
+// sos_d != NULL -> CASCADE (order = liczba sekcji), w przeciwnym razie b_d, a_d.
+void benchmark_rtsim_q12(FILE *fp, const rtsim_config *cfg, const char *filter_name, const char *structure,
+                        const double *b_d, const double *a_d, const double sos_d[][6], int order) {
+    int cutoff = -1;
+    int csv_order = sos_d ? 2 * order : order - 1;
+    rtsim_ctx_q12 c = { structure, NULL, NULL, NULL, NULL, NULL, order, 0, cfg->block };
 
-        benchmark_cascade_q24(fp, "bessel_cascade_order2_cut2000_f64_sos", CASCADE_q24, bessel_cascade_order2_cut2000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "bessel_cascade_order2_cut2000_f64_sos", CASCADE_q12, bessel_cascade_order2_cut2000_f64_sos, 1);
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
 
-        benchmark_cascade_q24(fp, "bessel_cascade_order2_cut5000_f64_sos", CASCADE_q24, bessel_cascade_order2_cut5000_f64_sos, 1);
-        benchmark_cascade_q12(fp, "bessel_cascade_order2_cut5000_f64_sos", CASCADE_q12, bessel_cascade_order2_cut5000_f64_sos, 1);
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr) sscanf(cut_ptr, "_cut%d", &cutoff);
 
-        benchmark_cascade_q24(fp, "bessel_cascade_order4_cut1000_f64_sos", CASCADE_q24, bessel_cascade_order4_cut1000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "bessel_cascade_order4_cut1000_f64_sos", CASCADE_q12, bessel_cascade_order4_cut1000_f64_sos, 2);
+    c.x = pool_buffer(POOL_X, sizeof(q12) * N);
+    c.y = pool_buffer(POOL_Y, sizeof(q12) * N);
+    if (sos_d) {
+        c.sos = malloc(sizeof(q12) * 6 * order);
+        convert_sos_to_q12(sos_d, (q12 (*)[6])c.sos, order);
+    } else {
+        c.b = malloc(sizeof(q12) * order);
+        c.a = malloc(sizeof(q12) * order);
+        convert_ba_to_q12(b_d, a_d, c.b, c.a, order);
+    }
+    generate_white_noise_q12(c.x, N);
+
+    if (rtsim_run(cfg, rtsim_process_q12, &c, &rtsim_res) != 0) {
+        printf("[LOG] rtsim not supported on this platform\n");
+    } else {
+        fprintf(fp, "%s,q12,%s,%d,%d", filter_type, structure, cutoff, csv_order);
+        rtsim_fprint_columns(fp, cfg, &rtsim_res);
+        fprintf(fp, "\n");
+        printf("[LOG] %s (q12, %s, cut %d, order %d, load %d, %s): %ld/%ld misses, WCET %llu ns, jitter p99 %llu ns\n",
+               filter_type, structure, cutoff, csv_order, cfg->load_threads, rtsim_res.fifo ? "fifo" : "other",
+               rtsim_res.misses, (long)rtsim_res.exec.total, (unsigned long long)rtsim_res.exec.max,
+               (unsigned long long)lat_quantile(&rtsim_res.jitter, 0.99));
+    }
 
-        benchmark_cascade_q24(fp, "bessel_cascade_order4_cut2000_f64_sos", CASCADE_q24, bessel_cascade_order4_cut2000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "bessel_cascade_order4_cut2000_f64_sos", CASCADE_q12, bessel_cascade_order4_cut2000_f64_sos, 2);
+    free(c.b); free(c.a); free(c.sos);
+}
 
-        benchmark_cascade_q24(fp, "bessel_cascade_order4_cut5000_f64_sos", CASCADE_q24, bessel_cascade_order4_cut5000_f64_sos, 2);
-        benchmark_cascade_q12(fp, "bessel_cascade_order4_cut5000_f64_sos", CASCADE_q12, bessel_cascade_order4_cut5000_f64_sos, 2);
+// Tryb "rtsim": ./TimeAnalysis_fixed rtsim [load=<wątki>] [block=<próbki>]
+int run_rtsim_benchmark(int argc, char **argv) {
+    rtsim_config cfg;
+    int load = rtsim_default_load();
+    for (int i = 2; i < argc; ++i)
+        if (strncmp(argv[i], "load=", 5) == 0) load = atoi(argv[i] + 5);
+
+    cfg.block = bench.block > 0 ? bench.block : RTSIM_BLOCK;
+    if (cfg.block > N) {
+        // Blok jest wycinkiem sygnału testowego, więc musi się w nim mieścić
+        printf("[LOG] rtsim: block=%d longer than signal n=%d\n", cfg.block, N);
+        return 1;
+    }
+    cfg.fs = bench.fs;
+    cfg.periods = (long)RTSIM_SECONDS * cfg.fs / cfg.block;
+    cfg.fifo = 1;
+
+    FILE *fp = fopen("c_fixed_rtsim_results" RESULTS_SUFFIX ".csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
 
-        benchmark_cascade_q24(fp, "bessel_cascade_order6_cut1000_f64_sos", CASCADE_q24, bessel_cascade_order6_cut1000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "bessel_cascade_order6_cut1000_f64_sos", CASCADE_q12, bessel_cascade_order6_cut1000_f64_sos, 3);
+    fprintf(fp, "filter_name,type,structure,cutoff,order" RTSIM_CSV_HEADER "\n");
+
+    const int loads[] = { 0, load };
+    for (int l = 0; l < (load > 0 ? 2 : 1); l++) {
+        cfg.load_threads = loads[l];
+        benchmark_rtsim_q24(fp, &cfg, "butter_df1_order8_cut2000_f64_ba", "DF1", butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_rtsim_q24(fp, &cfg, "butter_df2_order8_cut2000_f64_ba", "DF2", butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_rtsim_q24(fp, &cfg, "butter_tdf2_order8_cut2000_f64_ba", "TDF2", butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_rtsim_q24(fp, &cfg, "butter_cascade_order8_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order8_cut2000_f64_sos, 4);
+        benchmark_rtsim_q12(fp, &cfg, "butter_df1_order8_cut2000_f64_ba", "DF1", butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_rtsim_q12(fp, &cfg, "butter_df2_order8_cut2000_f64_ba", "DF2", butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_rtsim_q12(fp, &cfg, "butter_tdf2_order8_cut2000_f64_ba", "TDF2", butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_rtsim_q12(fp, &cfg, "butter_cascade_order8_cut2000_f64_sos", "CASCADE", NULL, NULL, butter_cascade_order8_cut2000_f64_sos, 4);
+    }
 
-        benchmark_cascade_q24(fp, "bessel_cascade_order6_cut2000_f64_sos", CASCADE_q24, bessel_cascade_order6_cut2000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "bessel_cascade_order6_cut2000_f64_sos", CASCADE_q12, bessel_cascade_order6_cut2000_f64_sos, 3);
+    fclose(fp);
+    return 0;
+}
 
-        benchmark_cascade_q24(fp, "bessel_cascade_order6_cut5000_f64_sos", CASCADE_q24, bessel_cascade_order6_cut5000_f64_sos, 3);
-        benchmark_cascade_q12(fp, "bessel_cascade_order6_cut5000_f64_sos", CASCADE_q12, bessel_cascade_order6_cut5000_f64_sos, 3);
+// === Konfiguracje pomiaru ===
+// Jedno wywołanie benchmark_* na indeks; kolejność, rozgrzewkę i liczbę powtórzeń wybiera runner.h
+static int run_config(FILE *fp, int idx) {
+    switch (idx) {
+    // Tu wkleić zawartość pliku generated_calls_time_fixed.txt
+    // === AUTO-GENERATED BENCHMARK CALLS ===
+
+    // --- FIXED BA ---
+    case 0: benchmark_fixed_q24(fp, "butter_df1_order2_cut1000_f64_ba", "DF1", DF1_q24, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 1: benchmark_fixed_q12(fp, "butter_df1_order2_cut1000_f64_ba", "DF1", DF1_q12, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 2: benchmark_fixed_q24(fp, "butter_df1_order2_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 3: benchmark_fixed_q12(fp, "butter_df1_order2_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3); break;
+
+    case 4: benchmark_fixed_q24(fp, "butter_df2_order2_cut1000_f64_ba", "DF2", DF2_q24, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 5: benchmark_fixed_q12(fp, "butter_df2_order2_cut1000_f64_ba", "DF2", DF2_q12, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 6: benchmark_fixed_q24(fp, "butter_df2_order2_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 7: benchmark_fixed_q12(fp, "butter_df2_order2_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3); break;
+
+    case 8: benchmark_fixed_q24(fp, "butter_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 9: benchmark_fixed_q12(fp, "butter_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 10: benchmark_fixed_q24(fp, "butter_tdf2_order2_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 11: benchmark_fixed_q12(fp, "butter_tdf2_order2_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3); break;
+
+    case 12: benchmark_fixed_q24(fp, "butter_df1_order2_cut2000_f64_ba", "DF1", DF1_q24, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 13: benchmark_fixed_q12(fp, "butter_df1_order2_cut2000_f64_ba", "DF1", DF1_q12, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 14: benchmark_fixed_q24(fp, "butter_df1_order2_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 15: benchmark_fixed_q12(fp, "butter_df1_order2_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3); break;
+
+    case 16: benchmark_fixed_q24(fp, "butter_df2_order2_cut2000_f64_ba", "DF2", DF2_q24, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 17: benchmark_fixed_q12(fp, "butter_df2_order2_cut2000_f64_ba", "DF2", DF2_q12, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 18: benchmark_fixed_q24(fp, "butter_df2_order2_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 19: benchmark_fixed_q12(fp, "butter_df2_order2_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3); break;
+
+    case 20: benchmark_fixed_q24(fp, "butter_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 21: benchmark_fixed_q12(fp, "butter_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 22: benchmark_fixed_q24(fp, "butter_tdf2_order2_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 23: benchmark_fixed_q12(fp, "butter_tdf2_order2_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3); break;
+
+    case 24: benchmark_fixed_q24(fp, "butter_df1_order2_cut5000_f64_ba", "DF1", DF1_q24, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 25: benchmark_fixed_q12(fp, "butter_df1_order2_cut5000_f64_ba", "DF1", DF1_q12, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 26: benchmark_fixed_q24(fp, "butter_df1_order2_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 27: benchmark_fixed_q12(fp, "butter_df1_order2_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3); break;
+
+    case 28: benchmark_fixed_q24(fp, "butter_df2_order2_cut5000_f64_ba", "DF2", DF2_q24, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 29: benchmark_fixed_q12(fp, "butter_df2_order2_cut5000_f64_ba", "DF2", DF2_q12, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 30: benchmark_fixed_q24(fp, "butter_df2_order2_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 31: benchmark_fixed_q12(fp, "butter_df2_order2_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3); break;
+
+    case 32: benchmark_fixed_q24(fp, "butter_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 33: benchmark_fixed_q12(fp, "butter_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 34: benchmark_fixed_q24(fp, "butter_tdf2_order2_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 35: benchmark_fixed_q12(fp, "butter_tdf2_order2_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3); break;
+
+    case 36: benchmark_fixed_q24(fp, "butter_df1_order4_cut1000_f64_ba", "DF1", DF1_q24, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 37: benchmark_fixed_q12(fp, "butter_df1_order4_cut1000_f64_ba", "DF1", DF1_q12, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 38: benchmark_fixed_q24(fp, "butter_df1_order4_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 39: benchmark_fixed_q12(fp, "butter_df1_order4_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5); break;
+
+    case 40: benchmark_fixed_q24(fp, "butter_df2_order4_cut1000_f64_ba", "DF2", DF2_q24, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 41: benchmark_fixed_q12(fp, "butter_df2_order4_cut1000_f64_ba", "DF2", DF2_q12, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 42: benchmark_fixed_q24(fp, "butter_df2_order4_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 43: benchmark_fixed_q12(fp, "butter_df2_order4_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5); break;
+
+    case 44: benchmark_fixed_q24(fp, "butter_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 45: benchmark_fixed_q12(fp, "butter_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 46: benchmark_fixed_q24(fp, "butter_tdf2_order4_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 47: benchmark_fixed_q12(fp, "butter_tdf2_order4_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5); break;
+
+    case 48: benchmark_fixed_q24(fp, "butter_df1_order4_cut2000_f64_ba", "DF1", DF1_q24, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 49: benchmark_fixed_q12(fp, "butter_df1_order4_cut2000_f64_ba", "DF1", DF1_q12, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 50: benchmark_fixed_q24(fp, "butter_df1_order4_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 51: benchmark_fixed_q12(fp, "butter_df1_order4_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5); break;
+
+    case 52: benchmark_fixed_q24(fp, "butter_df2_order4_cut2000_f64_ba", "DF2", DF2_q24, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 53: benchmark_fixed_q12(fp, "butter_df2_order4_cut2000_f64_ba", "DF2", DF2_q12, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 54: benchmark_fixed_q24(fp, "butter_df2_order4_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 55: benchmark_fixed_q12(fp, "butter_df2_order4_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5); break;
+
+    case 56: benchmark_fixed_q24(fp, "butter_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 57: benchmark_fixed_q12(fp, "butter_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 58: benchmark_fixed_q24(fp, "butter_tdf2_order4_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 59: benchmark_fixed_q12(fp, "butter_tdf2_order4_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5); break;
+
+    case 60: benchmark_fixed_q24(fp, "butter_df1_order4_cut5000_f64_ba", "DF1", DF1_q24, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 61: benchmark_fixed_q12(fp, "butter_df1_order4_cut5000_f64_ba", "DF1", DF1_q12, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 62: benchmark_fixed_q24(fp, "butter_df1_order4_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 63: benchmark_fixed_q12(fp, "butter_df1_order4_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5); break;
+
+    case 64: benchmark_fixed_q24(fp, "butter_df2_order4_cut5000_f64_ba", "DF2", DF2_q24, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 65: benchmark_fixed_q12(fp, "butter_df2_order4_cut5000_f64_ba", "DF2", DF2_q12, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 66: benchmark_fixed_q24(fp, "butter_df2_order4_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 67: benchmark_fixed_q12(fp, "butter_df2_order4_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5); break;
+
+    case 68: benchmark_fixed_q24(fp, "butter_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 69: benchmark_fixed_q12(fp, "butter_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 70: benchmark_fixed_q24(fp, "butter_tdf2_order4_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 71: benchmark_fixed_q12(fp, "butter_tdf2_order4_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5); break;
+
+    case 72: benchmark_fixed_q24(fp, "butter_df1_order6_cut1000_f64_ba", "DF1", DF1_q24, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 73: benchmark_fixed_q12(fp, "butter_df1_order6_cut1000_f64_ba", "DF1", DF1_q12, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 74: benchmark_fixed_q24(fp, "butter_df1_order6_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 75: benchmark_fixed_q12(fp, "butter_df1_order6_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7); break;
+
+    case 76: benchmark_fixed_q24(fp, "butter_df2_order6_cut1000_f64_ba", "DF2", DF2_q24, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 77: benchmark_fixed_q12(fp, "butter_df2_order6_cut1000_f64_ba", "DF2", DF2_q12, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 78: benchmark_fixed_q24(fp, "butter_df2_order6_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 79: benchmark_fixed_q12(fp, "butter_df2_order6_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7); break;
+
+    case 80: benchmark_fixed_q24(fp, "butter_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 81: benchmark_fixed_q12(fp, "butter_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 82: benchmark_fixed_q24(fp, "butter_tdf2_order6_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 83: benchmark_fixed_q12(fp, "butter_tdf2_order6_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7); break;
+
+    case 84: benchmark_fixed_q24(fp, "butter_df1_order6_cut2000_f64_ba", "DF1", DF1_q24, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 85: benchmark_fixed_q12(fp, "butter_df1_order6_cut2000_f64_ba", "DF1", DF1_q12, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 86: benchmark_fixed_q24(fp, "butter_df1_order6_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 87: benchmark_fixed_q12(fp, "butter_df1_order6_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7); break;
+
+    case 88: benchmark_fixed_q24(fp, "butter_df2_order6_cut2000_f64_ba", "DF2", DF2_q24, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 89: benchmark_fixed_q12(fp, "butter_df2_order6_cut2000_f64_ba", "DF2", DF2_q12, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 90: benchmark_fixed_q24(fp, "butter_df2_order6_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 91: benchmark_fixed_q12(fp, "butter_df2_order6_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7); break;
+
+    case 92: benchmark_fixed_q24(fp, "butter_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 93: benchmark_fixed_q12(fp, "butter_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 94: benchmark_fixed_q24(fp, "butter_tdf2_order6_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 95: benchmark_fixed_q12(fp, "butter_tdf2_order6_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7); break;
+
+    case 96: benchmark_fixed_q24(fp, "butter_df1_order6_cut5000_f64_ba", "DF1", DF1_q24, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 97: benchmark_fixed_q12(fp, "butter_df1_order6_cut5000_f64_ba", "DF1", DF1_q12, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 98: benchmark_fixed_q24(fp, "butter_df1_order6_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 99: benchmark_fixed_q12(fp, "butter_df1_order6_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7); break;
+
+    case 100: benchmark_fixed_q24(fp, "butter_df2_order6_cut5000_f64_ba", "DF2", DF2_q24, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 101: benchmark_fixed_q12(fp, "butter_df2_order6_cut5000_f64_ba", "DF2", DF2_q12, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 102: benchmark_fixed_q24(fp, "butter_df2_order6_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 103: benchmark_fixed_q12(fp, "butter_df2_order6_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7); break;
+
+    case 104: benchmark_fixed_q24(fp, "butter_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 105: benchmark_fixed_q12(fp, "butter_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 106: benchmark_fixed_q24(fp, "butter_tdf2_order6_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 107: benchmark_fixed_q12(fp, "butter_tdf2_order6_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7); break;
+
+    case 108: benchmark_fixed_q24(fp, "butter_df1_order8_cut1000_f64_ba", "DF1", DF1_q24, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 109: benchmark_fixed_q12(fp, "butter_df1_order8_cut1000_f64_ba", "DF1", DF1_q12, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 110: benchmark_fixed_q24(fp, "butter_df1_order8_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 111: benchmark_fixed_q12(fp, "butter_df1_order8_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9); break;
+
+    case 112: benchmark_fixed_q24(fp, "butter_df2_order8_cut1000_f64_ba", "DF2", DF2_q24, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 113: benchmark_fixed_q12(fp, "butter_df2_order8_cut1000_f64_ba", "DF2", DF2_q12, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 114: benchmark_fixed_q24(fp, "butter_df2_order8_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 115: benchmark_fixed_q12(fp, "butter_df2_order8_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9); break;
+
+    case 116: benchmark_fixed_q24(fp, "butter_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 117: benchmark_fixed_q12(fp, "butter_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 118: benchmark_fixed_q24(fp, "butter_tdf2_order8_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 119: benchmark_fixed_q12(fp, "butter_tdf2_order8_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9); break;
+
+    case 120: benchmark_fixed_q24(fp, "butter_df1_order8_cut2000_f64_ba", "DF1", DF1_q24, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 121: benchmark_fixed_q12(fp, "butter_df1_order8_cut2000_f64_ba", "DF1", DF1_q12, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 122: benchmark_fixed_q24(fp, "butter_df1_order8_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 123: benchmark_fixed_q12(fp, "butter_df1_order8_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9); break;
+
+    case 124: benchmark_fixed_q24(fp, "butter_df2_order8_cut2000_f64_ba", "DF2", DF2_q24, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 125: benchmark_fixed_q12(fp, "butter_df2_order8_cut2000_f64_ba", "DF2", DF2_q12, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 126: benchmark_fixed_q24(fp, "butter_df2_order8_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 127: benchmark_fixed_q12(fp, "butter_df2_order8_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9); break;
+
+    case 128: benchmark_fixed_q24(fp, "butter_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 129: benchmark_fixed_q12(fp, "butter_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 130: benchmark_fixed_q24(fp, "butter_tdf2_order8_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 131: benchmark_fixed_q12(fp, "butter_tdf2_order8_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9); break;
+
+    case 132: benchmark_fixed_q24(fp, "butter_df1_order8_cut5000_f64_ba", "DF1", DF1_q24, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 133: benchmark_fixed_q12(fp, "butter_df1_order8_cut5000_f64_ba", "DF1", DF1_q12, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 134: benchmark_fixed_q24(fp, "butter_df1_order8_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 135: benchmark_fixed_q12(fp, "butter_df1_order8_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9); break;
+
+    case 136: benchmark_fixed_q24(fp, "butter_df2_order8_cut5000_f64_ba", "DF2", DF2_q24, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 137: benchmark_fixed_q12(fp, "butter_df2_order8_cut5000_f64_ba", "DF2", DF2_q12, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 138: benchmark_fixed_q24(fp, "butter_df2_order8_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 139: benchmark_fixed_q12(fp, "butter_df2_order8_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9); break;
+
+    case 140: benchmark_fixed_q24(fp, "butter_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q24, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 141: benchmark_fixed_q12(fp, "butter_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q12, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 142: benchmark_fixed_q24(fp, "butter_tdf2_order8_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 143: benchmark_fixed_q12(fp, "butter_tdf2_order8_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9); break;
+
+    case 144: benchmark_fixed_q24(fp, "cheby1_df1_order2_cut1000_f64_ba", "DF1", DF1_q24, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 145: benchmark_fixed_q12(fp, "cheby1_df1_order2_cut1000_f64_ba", "DF1", DF1_q12, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 146: benchmark_fixed_q24(fp, "cheby1_df1_order2_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 147: benchmark_fixed_q12(fp, "cheby1_df1_order2_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3); break;
+
+    case 148: benchmark_fixed_q24(fp, "cheby1_df2_order2_cut1000_f64_ba", "DF2", DF2_q24, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 149: benchmark_fixed_q12(fp, "cheby1_df2_order2_cut1000_f64_ba", "DF2", DF2_q12, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 150: benchmark_fixed_q24(fp, "cheby1_df2_order2_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 151: benchmark_fixed_q12(fp, "cheby1_df2_order2_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3); break;
+
+    case 152: benchmark_fixed_q24(fp, "cheby1_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 153: benchmark_fixed_q12(fp, "cheby1_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 154: benchmark_fixed_q24(fp, "cheby1_tdf2_order2_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 155: benchmark_fixed_q12(fp, "cheby1_tdf2_order2_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3); break;
+
+    case 156: benchmark_fixed_q24(fp, "cheby1_df1_order2_cut2000_f64_ba", "DF1", DF1_q24, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 157: benchmark_fixed_q12(fp, "cheby1_df1_order2_cut2000_f64_ba", "DF1", DF1_q12, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 158: benchmark_fixed_q24(fp, "cheby1_df1_order2_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 159: benchmark_fixed_q12(fp, "cheby1_df1_order2_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3); break;
+
+    case 160: benchmark_fixed_q24(fp, "cheby1_df2_order2_cut2000_f64_ba", "DF2", DF2_q24, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 161: benchmark_fixed_q12(fp, "cheby1_df2_order2_cut2000_f64_ba", "DF2", DF2_q12, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 162: benchmark_fixed_q24(fp, "cheby1_df2_order2_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 163: benchmark_fixed_q12(fp, "cheby1_df2_order2_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3); break;
+
+    case 164: benchmark_fixed_q24(fp, "cheby1_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 165: benchmark_fixed_q12(fp, "cheby1_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 166: benchmark_fixed_q24(fp, "cheby1_tdf2_order2_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 167: benchmark_fixed_q12(fp, "cheby1_tdf2_order2_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3); break;
+
+    case 168: benchmark_fixed_q24(fp, "cheby1_df1_order2_cut5000_f64_ba", "DF1", DF1_q24, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 169: benchmark_fixed_q12(fp, "cheby1_df1_order2_cut5000_f64_ba", "DF1", DF1_q12, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 170: benchmark_fixed_q24(fp, "cheby1_df1_order2_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 171: benchmark_fixed_q12(fp, "cheby1_df1_order2_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3); break;
+
+    case 172: benchmark_fixed_q24(fp, "cheby1_df2_order2_cut5000_f64_ba", "DF2", DF2_q24, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 173: benchmark_fixed_q12(fp, "cheby1_df2_order2_cut5000_f64_ba", "DF2", DF2_q12, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 174: benchmark_fixed_q24(fp, "cheby1_df2_order2_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 175: benchmark_fixed_q12(fp, "cheby1_df2_order2_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3); break;
+
+    case 176: benchmark_fixed_q24(fp, "cheby1_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 177: benchmark_fixed_q12(fp, "cheby1_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 178: benchmark_fixed_q24(fp, "cheby1_tdf2_order2_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 179: benchmark_fixed_q12(fp, "cheby1_tdf2_order2_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3); break;
+
+    case 180: benchmark_fixed_q24(fp, "cheby1_df1_order4_cut1000_f64_ba", "DF1", DF1_q24, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 181: benchmark_fixed_q12(fp, "cheby1_df1_order4_cut1000_f64_ba", "DF1", DF1_q12, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 182: benchmark_fixed_q24(fp, "cheby1_df1_order4_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 183: benchmark_fixed_q12(fp, "cheby1_df1_order4_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5); break;
+
+    case 184: benchmark_fixed_q24(fp, "cheby1_df2_order4_cut1000_f64_ba", "DF2", DF2_q24, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 185: benchmark_fixed_q12(fp, "cheby1_df2_order4_cut1000_f64_ba", "DF2", DF2_q12, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 186: benchmark_fixed_q24(fp, "cheby1_df2_order4_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 187: benchmark_fixed_q12(fp, "cheby1_df2_order4_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5); break;
+
+    case 188: benchmark_fixed_q24(fp, "cheby1_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 189: benchmark_fixed_q12(fp, "cheby1_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 190: benchmark_fixed_q24(fp, "cheby1_tdf2_order4_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 191: benchmark_fixed_q12(fp, "cheby1_tdf2_order4_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5); break;
+
+    case 192: benchmark_fixed_q24(fp, "cheby1_df1_order4_cut2000_f64_ba", "DF1", DF1_q24, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 193: benchmark_fixed_q12(fp, "cheby1_df1_order4_cut2000_f64_ba", "DF1", DF1_q12, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 194: benchmark_fixed_q24(fp, "cheby1_df1_order4_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 195: benchmark_fixed_q12(fp, "cheby1_df1_order4_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5); break;
+
+    case 196: benchmark_fixed_q24(fp, "cheby1_df2_order4_cut2000_f64_ba", "DF2", DF2_q24, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 197: benchmark_fixed_q12(fp, "cheby1_df2_order4_cut2000_f64_ba", "DF2", DF2_q12, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 198: benchmark_fixed_q24(fp, "cheby1_df2_order4_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 199: benchmark_fixed_q12(fp, "cheby1_df2_order4_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5); break;
+
+    case 200: benchmark_fixed_q24(fp, "cheby1_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 201: benchmark_fixed_q12(fp, "cheby1_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 202: benchmark_fixed_q24(fp, "cheby1_tdf2_order4_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 203: benchmark_fixed_q12(fp, "cheby1_tdf2_order4_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5); break;
+
+    case 204: benchmark_fixed_q24(fp, "cheby1_df1_order4_cut5000_f64_ba", "DF1", DF1_q24, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 205: benchmark_fixed_q12(fp, "cheby1_df1_order4_cut5000_f64_ba", "DF1", DF1_q12, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 206: benchmark_fixed_q24(fp, "cheby1_df1_order4_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 207: benchmark_fixed_q12(fp, "cheby1_df1_order4_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5); break;
+
+    case 208: benchmark_fixed_q24(fp, "cheby1_df2_order4_cut5000_f64_ba", "DF2", DF2_q24, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 209: benchmark_fixed_q12(fp, "cheby1_df2_order4_cut5000_f64_ba", "DF2", DF2_q12, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 210: benchmark_fixed_q24(fp, "cheby1_df2_order4_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 211: benchmark_fixed_q12(fp, "cheby1_df2_order4_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5); break;
+
+    case 212: benchmark_fixed_q24(fp, "cheby1_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 213: benchmark_fixed_q12(fp, "cheby1_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 214: benchmark_fixed_q24(fp, "cheby1_tdf2_order4_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 215: benchmark_fixed_q12(fp, "cheby1_tdf2_order4_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5); break;
+
+    case 216: benchmark_fixed_q24(fp, "cheby1_df1_order6_cut1000_f64_ba", "DF1", DF1_q24, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 217: benchmark_fixed_q12(fp, "cheby1_df1_order6_cut1000_f64_ba", "DF1", DF1_q12, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 218: benchmark_fixed_q24(fp, "cheby1_df1_order6_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 219: benchmark_fixed_q12(fp, "cheby1_df1_order6_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7); break;
+
+    case 220: benchmark_fixed_q24(fp, "cheby1_df2_order6_cut1000_f64_ba", "DF2", DF2_q24, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 221: benchmark_fixed_q12(fp, "cheby1_df2_order6_cut1000_f64_ba", "DF2", DF2_q12, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 222: benchmark_fixed_q24(fp, "cheby1_df2_order6_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 223: benchmark_fixed_q12(fp, "cheby1_df2_order6_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7); break;
+
+    case 224: benchmark_fixed_q24(fp, "cheby1_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 225: benchmark_fixed_q12(fp, "cheby1_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 226: benchmark_fixed_q24(fp, "cheby1_tdf2_order6_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 227: benchmark_fixed_q12(fp, "cheby1_tdf2_order6_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7); break;
+
+    case 228: benchmark_fixed_q24(fp, "cheby1_df1_order6_cut2000_f64_ba", "DF1", DF1_q24, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 229: benchmark_fixed_q12(fp, "cheby1_df1_order6_cut2000_f64_ba", "DF1", DF1_q12, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 230: benchmark_fixed_q24(fp, "cheby1_df1_order6_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 231: benchmark_fixed_q12(fp, "cheby1_df1_order6_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7); break;
+
+    case 232: benchmark_fixed_q24(fp, "cheby1_df2_order6_cut2000_f64_ba", "DF2", DF2_q24, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 233: benchmark_fixed_q12(fp, "cheby1_df2_order6_cut2000_f64_ba", "DF2", DF2_q12, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 234: benchmark_fixed_q24(fp, "cheby1_df2_order6_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 235: benchmark_fixed_q12(fp, "cheby1_df2_order6_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7); break;
+
+    case 236: benchmark_fixed_q24(fp, "cheby1_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 237: benchmark_fixed_q12(fp, "cheby1_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 238: benchmark_fixed_q24(fp, "cheby1_tdf2_order6_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 239: benchmark_fixed_q12(fp, "cheby1_tdf2_order6_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7); break;
+
+    case 240: benchmark_fixed_q24(fp, "cheby1_df1_order6_cut5000_f64_ba", "DF1", DF1_q24, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 241: benchmark_fixed_q12(fp, "cheby1_df1_order6_cut5000_f64_ba", "DF1", DF1_q12, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 242: benchmark_fixed_q24(fp, "cheby1_df1_order6_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 243: benchmark_fixed_q12(fp, "cheby1_df1_order6_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7); break;
+
+    case 244: benchmark_fixed_q24(fp, "cheby1_df2_order6_cut5000_f64_ba", "DF2", DF2_q24, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 245: benchmark_fixed_q12(fp, "cheby1_df2_order6_cut5000_f64_ba", "DF2", DF2_q12, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 246: benchmark_fixed_q24(fp, "cheby1_df2_order6_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 247: benchmark_fixed_q12(fp, "cheby1_df2_order6_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7); break;
+
+    case 248: benchmark_fixed_q24(fp, "cheby1_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 249: benchmark_fixed_q12(fp, "cheby1_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 250: benchmark_fixed_q24(fp, "cheby1_tdf2_order6_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 251: benchmark_fixed_q12(fp, "cheby1_tdf2_order6_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7); break;
+
+    case 252: benchmark_fixed_q24(fp, "cheby1_df1_order8_cut1000_f64_ba", "DF1", DF1_q24, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 253: benchmark_fixed_q12(fp, "cheby1_df1_order8_cut1000_f64_ba", "DF1", DF1_q12, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 254: benchmark_fixed_q24(fp, "cheby1_df1_order8_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 255: benchmark_fixed_q12(fp, "cheby1_df1_order8_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9); break;
+
+    case 256: benchmark_fixed_q24(fp, "cheby1_df2_order8_cut1000_f64_ba", "DF2", DF2_q24, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 257: benchmark_fixed_q12(fp, "cheby1_df2_order8_cut1000_f64_ba", "DF2", DF2_q12, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 258: benchmark_fixed_q24(fp, "cheby1_df2_order8_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 259: benchmark_fixed_q12(fp, "cheby1_df2_order8_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9); break;
+
+    case 260: benchmark_fixed_q24(fp, "cheby1_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 261: benchmark_fixed_q12(fp, "cheby1_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 262: benchmark_fixed_q24(fp, "cheby1_tdf2_order8_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 263: benchmark_fixed_q12(fp, "cheby1_tdf2_order8_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9); break;
+
+    case 264: benchmark_fixed_q24(fp, "cheby1_df1_order8_cut2000_f64_ba", "DF1", DF1_q24, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 265: benchmark_fixed_q12(fp, "cheby1_df1_order8_cut2000_f64_ba", "DF1", DF1_q12, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 266: benchmark_fixed_q24(fp, "cheby1_df1_order8_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 267: benchmark_fixed_q12(fp, "cheby1_df1_order8_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9); break;
+
+    case 268: benchmark_fixed_q24(fp, "cheby1_df2_order8_cut2000_f64_ba", "DF2", DF2_q24, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 269: benchmark_fixed_q12(fp, "cheby1_df2_order8_cut2000_f64_ba", "DF2", DF2_q12, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 270: benchmark_fixed_q24(fp, "cheby1_df2_order8_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 271: benchmark_fixed_q12(fp, "cheby1_df2_order8_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9); break;
+
+    case 272: benchmark_fixed_q24(fp, "cheby1_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 273: benchmark_fixed_q12(fp, "cheby1_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 274: benchmark_fixed_q24(fp, "cheby1_tdf2_order8_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 275: benchmark_fixed_q12(fp, "cheby1_tdf2_order8_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9); break;
+
+    case 276: benchmark_fixed_q24(fp, "cheby1_df1_order8_cut5000_f64_ba", "DF1", DF1_q24, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 277: benchmark_fixed_q12(fp, "cheby1_df1_order8_cut5000_f64_ba", "DF1", DF1_q12, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 278: benchmark_fixed_q24(fp, "cheby1_df1_order8_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 279: benchmark_fixed_q12(fp, "cheby1_df1_order8_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9); break;
+
+    case 280: benchmark_fixed_q24(fp, "cheby1_df2_order8_cut5000_f64_ba", "DF2", DF2_q24, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 281: benchmark_fixed_q12(fp, "cheby1_df2_order8_cut5000_f64_ba", "DF2", DF2_q12, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 282: benchmark_fixed_q24(fp, "cheby1_df2_order8_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 283: benchmark_fixed_q12(fp, "cheby1_df2_order8_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9); break;
+
+    case 284: benchmark_fixed_q24(fp, "cheby1_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q24, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 285: benchmark_fixed_q12(fp, "cheby1_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q12, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 286: benchmark_fixed_q24(fp, "cheby1_tdf2_order8_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 287: benchmark_fixed_q12(fp, "cheby1_tdf2_order8_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9); break;
+
+    case 288: benchmark_fixed_q24(fp, "cheby2_df1_order2_cut1000_f64_ba", "DF1", DF1_q24, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 289: benchmark_fixed_q12(fp, "cheby2_df1_order2_cut1000_f64_ba", "DF1", DF1_q12, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 290: benchmark_fixed_q24(fp, "cheby2_df1_order2_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 291: benchmark_fixed_q12(fp, "cheby2_df1_order2_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3); break;
+
+    case 292: benchmark_fixed_q24(fp, "cheby2_df2_order2_cut1000_f64_ba", "DF2", DF2_q24, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 293: benchmark_fixed_q12(fp, "cheby2_df2_order2_cut1000_f64_ba", "DF2", DF2_q12, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 294: benchmark_fixed_q24(fp, "cheby2_df2_order2_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 295: benchmark_fixed_q12(fp, "cheby2_df2_order2_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3); break;
+
+    case 296: benchmark_fixed_q24(fp, "cheby2_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 297: benchmark_fixed_q12(fp, "cheby2_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 298: benchmark_fixed_q24(fp, "cheby2_tdf2_order2_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 299: benchmark_fixed_q12(fp, "cheby2_tdf2_order2_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3); break;
+
+    case 300: benchmark_fixed_q24(fp, "cheby2_df1_order2_cut2000_f64_ba", "DF1", DF1_q24, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 301: benchmark_fixed_q12(fp, "cheby2_df1_order2_cut2000_f64_ba", "DF1", DF1_q12, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 302: benchmark_fixed_q24(fp, "cheby2_df1_order2_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 303: benchmark_fixed_q12(fp, "cheby2_df1_order2_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3); break;
+
+    case 304: benchmark_fixed_q24(fp, "cheby2_df2_order2_cut2000_f64_ba", "DF2", DF2_q24, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 305: benchmark_fixed_q12(fp, "cheby2_df2_order2_cut2000_f64_ba", "DF2", DF2_q12, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 306: benchmark_fixed_q24(fp, "cheby2_df2_order2_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 307: benchmark_fixed_q12(fp, "cheby2_df2_order2_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3); break;
+
+    case 308: benchmark_fixed_q24(fp, "cheby2_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 309: benchmark_fixed_q12(fp, "cheby2_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 310: benchmark_fixed_q24(fp, "cheby2_tdf2_order2_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 311: benchmark_fixed_q12(fp, "cheby2_tdf2_order2_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3); break;
+
+    case 312: benchmark_fixed_q24(fp, "cheby2_df1_order2_cut5000_f64_ba", "DF1", DF1_q24, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 313: benchmark_fixed_q12(fp, "cheby2_df1_order2_cut5000_f64_ba", "DF1", DF1_q12, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 314: benchmark_fixed_q24(fp, "cheby2_df1_order2_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 315: benchmark_fixed_q12(fp, "cheby2_df1_order2_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3); break;
+
+    case 316: benchmark_fixed_q24(fp, "cheby2_df2_order2_cut5000_f64_ba", "DF2", DF2_q24, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 317: benchmark_fixed_q12(fp, "cheby2_df2_order2_cut5000_f64_ba", "DF2", DF2_q12, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 318: benchmark_fixed_q24(fp, "cheby2_df2_order2_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 319: benchmark_fixed_q12(fp, "cheby2_df2_order2_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3); break;
+
+    case 320: benchmark_fixed_q24(fp, "cheby2_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 321: benchmark_fixed_q12(fp, "cheby2_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 322: benchmark_fixed_q24(fp, "cheby2_tdf2_order2_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 323: benchmark_fixed_q12(fp, "cheby2_tdf2_order2_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3); break;
+
+    case 324: benchmark_fixed_q24(fp, "cheby2_df1_order4_cut1000_f64_ba", "DF1", DF1_q24, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 325: benchmark_fixed_q12(fp, "cheby2_df1_order4_cut1000_f64_ba", "DF1", DF1_q12, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 326: benchmark_fixed_q24(fp, "cheby2_df1_order4_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 327: benchmark_fixed_q12(fp, "cheby2_df1_order4_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5); break;
+
+    case 328: benchmark_fixed_q24(fp, "cheby2_df2_order4_cut1000_f64_ba", "DF2", DF2_q24, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 329: benchmark_fixed_q12(fp, "cheby2_df2_order4_cut1000_f64_ba", "DF2", DF2_q12, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 330: benchmark_fixed_q24(fp, "cheby2_df2_order4_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 331: benchmark_fixed_q12(fp, "cheby2_df2_order4_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5); break;
+
+    case 332: benchmark_fixed_q24(fp, "cheby2_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 333: benchmark_fixed_q12(fp, "cheby2_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 334: benchmark_fixed_q24(fp, "cheby2_tdf2_order4_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 335: benchmark_fixed_q12(fp, "cheby2_tdf2_order4_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5); break;
+
+    case 336: benchmark_fixed_q24(fp, "cheby2_df1_order4_cut2000_f64_ba", "DF1", DF1_q24, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 337: benchmark_fixed_q12(fp, "cheby2_df1_order4_cut2000_f64_ba", "DF1", DF1_q12, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 338: benchmark_fixed_q24(fp, "cheby2_df1_order4_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 339: benchmark_fixed_q12(fp, "cheby2_df1_order4_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5); break;
+
+    case 340: benchmark_fixed_q24(fp, "cheby2_df2_order4_cut2000_f64_ba", "DF2", DF2_q24, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 341: benchmark_fixed_q12(fp, "cheby2_df2_order4_cut2000_f64_ba", "DF2", DF2_q12, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 342: benchmark_fixed_q24(fp, "cheby2_df2_order4_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 343: benchmark_fixed_q12(fp, "cheby2_df2_order4_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5); break;
+
+    case 344: benchmark_fixed_q24(fp, "cheby2_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 345: benchmark_fixed_q12(fp, "cheby2_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 346: benchmark_fixed_q24(fp, "cheby2_tdf2_order4_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 347: benchmark_fixed_q12(fp, "cheby2_tdf2_order4_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5); break;
+
+    case 348: benchmark_fixed_q24(fp, "cheby2_df1_order4_cut5000_f64_ba", "DF1", DF1_q24, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 349: benchmark_fixed_q12(fp, "cheby2_df1_order4_cut5000_f64_ba", "DF1", DF1_q12, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 350: benchmark_fixed_q24(fp, "cheby2_df1_order4_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 351: benchmark_fixed_q12(fp, "cheby2_df1_order4_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5); break;
+
+    case 352: benchmark_fixed_q24(fp, "cheby2_df2_order4_cut5000_f64_ba", "DF2", DF2_q24, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 353: benchmark_fixed_q12(fp, "cheby2_df2_order4_cut5000_f64_ba", "DF2", DF2_q12, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 354: benchmark_fixed_q24(fp, "cheby2_df2_order4_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 355: benchmark_fixed_q12(fp, "cheby2_df2_order4_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5); break;
+
+    case 356: benchmark_fixed_q24(fp, "cheby2_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 357: benchmark_fixed_q12(fp, "cheby2_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 358: benchmark_fixed_q24(fp, "cheby2_tdf2_order4_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 359: benchmark_fixed_q12(fp, "cheby2_tdf2_order4_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5); break;
+
+    case 360: benchmark_fixed_q24(fp, "cheby2_df1_order6_cut1000_f64_ba", "DF1", DF1_q24, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 361: benchmark_fixed_q12(fp, "cheby2_df1_order6_cut1000_f64_ba", "DF1", DF1_q12, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 362: benchmark_fixed_q24(fp, "cheby2_df1_order6_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 363: benchmark_fixed_q12(fp, "cheby2_df1_order6_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7); break;
+
+    case 364: benchmark_fixed_q24(fp, "cheby2_df2_order6_cut1000_f64_ba", "DF2", DF2_q24, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 365: benchmark_fixed_q12(fp, "cheby2_df2_order6_cut1000_f64_ba", "DF2", DF2_q12, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 366: benchmark_fixed_q24(fp, "cheby2_df2_order6_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 367: benchmark_fixed_q12(fp, "cheby2_df2_order6_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7); break;
+
+    case 368: benchmark_fixed_q24(fp, "cheby2_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 369: benchmark_fixed_q12(fp, "cheby2_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 370: benchmark_fixed_q24(fp, "cheby2_tdf2_order6_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 371: benchmark_fixed_q12(fp, "cheby2_tdf2_order6_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7); break;
+
+    case 372: benchmark_fixed_q24(fp, "cheby2_df1_order6_cut2000_f64_ba", "DF1", DF1_q24, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 373: benchmark_fixed_q12(fp, "cheby2_df1_order6_cut2000_f64_ba", "DF1", DF1_q12, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 374: benchmark_fixed_q24(fp, "cheby2_df1_order6_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 375: benchmark_fixed_q12(fp, "cheby2_df1_order6_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7); break;
+
+    case 376: benchmark_fixed_q24(fp, "cheby2_df2_order6_cut2000_f64_ba", "DF2", DF2_q24, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 377: benchmark_fixed_q12(fp, "cheby2_df2_order6_cut2000_f64_ba", "DF2", DF2_q12, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 378: benchmark_fixed_q24(fp, "cheby2_df2_order6_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 379: benchmark_fixed_q12(fp, "cheby2_df2_order6_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7); break;
+
+    case 380: benchmark_fixed_q24(fp, "cheby2_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 381: benchmark_fixed_q12(fp, "cheby2_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 382: benchmark_fixed_q24(fp, "cheby2_tdf2_order6_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 383: benchmark_fixed_q12(fp, "cheby2_tdf2_order6_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7); break;
+
+    case 384: benchmark_fixed_q24(fp, "cheby2_df1_order6_cut5000_f64_ba", "DF1", DF1_q24, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 385: benchmark_fixed_q12(fp, "cheby2_df1_order6_cut5000_f64_ba", "DF1", DF1_q12, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 386: benchmark_fixed_q24(fp, "cheby2_df1_order6_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 387: benchmark_fixed_q12(fp, "cheby2_df1_order6_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7); break;
+
+    case 388: benchmark_fixed_q24(fp, "cheby2_df2_order6_cut5000_f64_ba", "DF2", DF2_q24, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 389: benchmark_fixed_q12(fp, "cheby2_df2_order6_cut5000_f64_ba", "DF2", DF2_q12, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 390: benchmark_fixed_q24(fp, "cheby2_df2_order6_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 391: benchmark_fixed_q12(fp, "cheby2_df2_order6_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7); break;
+
+    case 392: benchmark_fixed_q24(fp, "cheby2_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 393: benchmark_fixed_q12(fp, "cheby2_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 394: benchmark_fixed_q24(fp, "cheby2_tdf2_order6_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 395: benchmark_fixed_q12(fp, "cheby2_tdf2_order6_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7); break;
+
+    case 396: benchmark_fixed_q24(fp, "cheby2_df1_order8_cut1000_f64_ba", "DF1", DF1_q24, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 397: benchmark_fixed_q12(fp, "cheby2_df1_order8_cut1000_f64_ba", "DF1", DF1_q12, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 398: benchmark_fixed_q24(fp, "cheby2_df1_order8_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 399: benchmark_fixed_q12(fp, "cheby2_df1_order8_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9); break;
+
+    case 400: benchmark_fixed_q24(fp, "cheby2_df2_order8_cut1000_f64_ba", "DF2", DF2_q24, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 401: benchmark_fixed_q12(fp, "cheby2_df2_order8_cut1000_f64_ba", "DF2", DF2_q12, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 402: benchmark_fixed_q24(fp, "cheby2_df2_order8_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 403: benchmark_fixed_q12(fp, "cheby2_df2_order8_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9); break;
+
+    case 404: benchmark_fixed_q24(fp, "cheby2_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 405: benchmark_fixed_q12(fp, "cheby2_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 406: benchmark_fixed_q24(fp, "cheby2_tdf2_order8_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 407: benchmark_fixed_q12(fp, "cheby2_tdf2_order8_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9); break;
+
+    case 408: benchmark_fixed_q24(fp, "cheby2_df1_order8_cut2000_f64_ba", "DF1", DF1_q24, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 409: benchmark_fixed_q12(fp, "cheby2_df1_order8_cut2000_f64_ba", "DF1", DF1_q12, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 410: benchmark_fixed_q24(fp, "cheby2_df1_order8_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 411: benchmark_fixed_q12(fp, "cheby2_df1_order8_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9); break;
+
+    case 412: benchmark_fixed_q24(fp, "cheby2_df2_order8_cut2000_f64_ba", "DF2", DF2_q24, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 413: benchmark_fixed_q12(fp, "cheby2_df2_order8_cut2000_f64_ba", "DF2", DF2_q12, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 414: benchmark_fixed_q24(fp, "cheby2_df2_order8_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 415: benchmark_fixed_q12(fp, "cheby2_df2_order8_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9); break;
+
+    case 416: benchmark_fixed_q24(fp, "cheby2_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 417: benchmark_fixed_q12(fp, "cheby2_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 418: benchmark_fixed_q24(fp, "cheby2_tdf2_order8_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 419: benchmark_fixed_q12(fp, "cheby2_tdf2_order8_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9); break;
+
+    case 420: benchmark_fixed_q24(fp, "cheby2_df1_order8_cut5000_f64_ba", "DF1", DF1_q24, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 421: benchmark_fixed_q12(fp, "cheby2_df1_order8_cut5000_f64_ba", "DF1", DF1_q12, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 422: benchmark_fixed_q24(fp, "cheby2_df1_order8_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 423: benchmark_fixed_q12(fp, "cheby2_df1_order8_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9); break;
+
+    case 424: benchmark_fixed_q24(fp, "cheby2_df2_order8_cut5000_f64_ba", "DF2", DF2_q24, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 425: benchmark_fixed_q12(fp, "cheby2_df2_order8_cut5000_f64_ba", "DF2", DF2_q12, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 426: benchmark_fixed_q24(fp, "cheby2_df2_order8_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 427: benchmark_fixed_q12(fp, "cheby2_df2_order8_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9); break;
+
+    case 428: benchmark_fixed_q24(fp, "cheby2_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q24, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 429: benchmark_fixed_q12(fp, "cheby2_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q12, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 430: benchmark_fixed_q24(fp, "cheby2_tdf2_order8_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 431: benchmark_fixed_q12(fp, "cheby2_tdf2_order8_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9); break;
+
+    case 432: benchmark_fixed_q24(fp, "ellip_df1_order2_cut1000_f64_ba", "DF1", DF1_q24, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 433: benchmark_fixed_q12(fp, "ellip_df1_order2_cut1000_f64_ba", "DF1", DF1_q12, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 434: benchmark_fixed_q24(fp, "ellip_df1_order2_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 435: benchmark_fixed_q12(fp, "ellip_df1_order2_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3); break;
+
+    case 436: benchmark_fixed_q24(fp, "ellip_df2_order2_cut1000_f64_ba", "DF2", DF2_q24, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 437: benchmark_fixed_q12(fp, "ellip_df2_order2_cut1000_f64_ba", "DF2", DF2_q12, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 438: benchmark_fixed_q24(fp, "ellip_df2_order2_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 439: benchmark_fixed_q12(fp, "ellip_df2_order2_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3); break;
+
+    case 440: benchmark_fixed_q24(fp, "ellip_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 441: benchmark_fixed_q12(fp, "ellip_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 442: benchmark_fixed_q24(fp, "ellip_tdf2_order2_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 443: benchmark_fixed_q12(fp, "ellip_tdf2_order2_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3); break;
+
+    case 444: benchmark_fixed_q24(fp, "ellip_df1_order2_cut2000_f64_ba", "DF1", DF1_q24, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 445: benchmark_fixed_q12(fp, "ellip_df1_order2_cut2000_f64_ba", "DF1", DF1_q12, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 446: benchmark_fixed_q24(fp, "ellip_df1_order2_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 447: benchmark_fixed_q12(fp, "ellip_df1_order2_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3); break;
+
+    case 448: benchmark_fixed_q24(fp, "ellip_df2_order2_cut2000_f64_ba", "DF2", DF2_q24, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 449: benchmark_fixed_q12(fp, "ellip_df2_order2_cut2000_f64_ba", "DF2", DF2_q12, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 450: benchmark_fixed_q24(fp, "ellip_df2_order2_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 451: benchmark_fixed_q12(fp, "ellip_df2_order2_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3); break;
+
+    case 452: benchmark_fixed_q24(fp, "ellip_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 453: benchmark_fixed_q12(fp, "ellip_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 454: benchmark_fixed_q24(fp, "ellip_tdf2_order2_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 455: benchmark_fixed_q12(fp, "ellip_tdf2_order2_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3); break;
+
+    case 456: benchmark_fixed_q24(fp, "ellip_df1_order2_cut5000_f64_ba", "DF1", DF1_q24, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 457: benchmark_fixed_q12(fp, "ellip_df1_order2_cut5000_f64_ba", "DF1", DF1_q12, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 458: benchmark_fixed_q24(fp, "ellip_df1_order2_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 459: benchmark_fixed_q12(fp, "ellip_df1_order2_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3); break;
+
+    case 460: benchmark_fixed_q24(fp, "ellip_df2_order2_cut5000_f64_ba", "DF2", DF2_q24, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 461: benchmark_fixed_q12(fp, "ellip_df2_order2_cut5000_f64_ba", "DF2", DF2_q12, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 462: benchmark_fixed_q24(fp, "ellip_df2_order2_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 463: benchmark_fixed_q12(fp, "ellip_df2_order2_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3); break;
+
+    case 464: benchmark_fixed_q24(fp, "ellip_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 465: benchmark_fixed_q12(fp, "ellip_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 466: benchmark_fixed_q24(fp, "ellip_tdf2_order2_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 467: benchmark_fixed_q12(fp, "ellip_tdf2_order2_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3); break;
+
+    case 468: benchmark_fixed_q24(fp, "ellip_df1_order4_cut1000_f64_ba", "DF1", DF1_q24, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 469: benchmark_fixed_q12(fp, "ellip_df1_order4_cut1000_f64_ba", "DF1", DF1_q12, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 470: benchmark_fixed_q24(fp, "ellip_df1_order4_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 471: benchmark_fixed_q12(fp, "ellip_df1_order4_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5); break;
+
+    case 472: benchmark_fixed_q24(fp, "ellip_df2_order4_cut1000_f64_ba", "DF2", DF2_q24, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 473: benchmark_fixed_q12(fp, "ellip_df2_order4_cut1000_f64_ba", "DF2", DF2_q12, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 474: benchmark_fixed_q24(fp, "ellip_df2_order4_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 475: benchmark_fixed_q12(fp, "ellip_df2_order4_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5); break;
+
+    case 476: benchmark_fixed_q24(fp, "ellip_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 477: benchmark_fixed_q12(fp, "ellip_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 478: benchmark_fixed_q24(fp, "ellip_tdf2_order4_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 479: benchmark_fixed_q12(fp, "ellip_tdf2_order4_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5); break;
+
+    case 480: benchmark_fixed_q24(fp, "ellip_df1_order4_cut2000_f64_ba", "DF1", DF1_q24, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 481: benchmark_fixed_q12(fp, "ellip_df1_order4_cut2000_f64_ba", "DF1", DF1_q12, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 482: benchmark_fixed_q24(fp, "ellip_df1_order4_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 483: benchmark_fixed_q12(fp, "ellip_df1_order4_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5); break;
+
+    case 484: benchmark_fixed_q24(fp, "ellip_df2_order4_cut2000_f64_ba", "DF2", DF2_q24, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 485: benchmark_fixed_q12(fp, "ellip_df2_order4_cut2000_f64_ba", "DF2", DF2_q12, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 486: benchmark_fixed_q24(fp, "ellip_df2_order4_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 487: benchmark_fixed_q12(fp, "ellip_df2_order4_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5); break;
+
+    case 488: benchmark_fixed_q24(fp, "ellip_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 489: benchmark_fixed_q12(fp, "ellip_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 490: benchmark_fixed_q24(fp, "ellip_tdf2_order4_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 491: benchmark_fixed_q12(fp, "ellip_tdf2_order4_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5); break;
+
+    case 492: benchmark_fixed_q24(fp, "ellip_df1_order4_cut5000_f64_ba", "DF1", DF1_q24, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 493: benchmark_fixed_q12(fp, "ellip_df1_order4_cut5000_f64_ba", "DF1", DF1_q12, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 494: benchmark_fixed_q24(fp, "ellip_df1_order4_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 495: benchmark_fixed_q12(fp, "ellip_df1_order4_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5); break;
+
+    case 496: benchmark_fixed_q24(fp, "ellip_df2_order4_cut5000_f64_ba", "DF2", DF2_q24, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 497: benchmark_fixed_q12(fp, "ellip_df2_order4_cut5000_f64_ba", "DF2", DF2_q12, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 498: benchmark_fixed_q24(fp, "ellip_df2_order4_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 499: benchmark_fixed_q12(fp, "ellip_df2_order4_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5); break;
+
+    case 500: benchmark_fixed_q24(fp, "ellip_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 501: benchmark_fixed_q12(fp, "ellip_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 502: benchmark_fixed_q24(fp, "ellip_tdf2_order4_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 503: benchmark_fixed_q12(fp, "ellip_tdf2_order4_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5); break;
+
+    case 504: benchmark_fixed_q24(fp, "ellip_df1_order6_cut1000_f64_ba", "DF1", DF1_q24, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 505: benchmark_fixed_q12(fp, "ellip_df1_order6_cut1000_f64_ba", "DF1", DF1_q12, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 506: benchmark_fixed_q24(fp, "ellip_df1_order6_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 507: benchmark_fixed_q12(fp, "ellip_df1_order6_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7); break;
+
+    case 508: benchmark_fixed_q24(fp, "ellip_df2_order6_cut1000_f64_ba", "DF2", DF2_q24, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 509: benchmark_fixed_q12(fp, "ellip_df2_order6_cut1000_f64_ba", "DF2", DF2_q12, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 510: benchmark_fixed_q24(fp, "ellip_df2_order6_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 511: benchmark_fixed_q12(fp, "ellip_df2_order6_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7); break;
+
+    case 512: benchmark_fixed_q24(fp, "ellip_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 513: benchmark_fixed_q12(fp, "ellip_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 514: benchmark_fixed_q24(fp, "ellip_tdf2_order6_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 515: benchmark_fixed_q12(fp, "ellip_tdf2_order6_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7); break;
+
+    case 516: benchmark_fixed_q24(fp, "ellip_df1_order6_cut2000_f64_ba", "DF1", DF1_q24, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 517: benchmark_fixed_q12(fp, "ellip_df1_order6_cut2000_f64_ba", "DF1", DF1_q12, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 518: benchmark_fixed_q24(fp, "ellip_df1_order6_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 519: benchmark_fixed_q12(fp, "ellip_df1_order6_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7); break;
+
+    case 520: benchmark_fixed_q24(fp, "ellip_df2_order6_cut2000_f64_ba", "DF2", DF2_q24, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 521: benchmark_fixed_q12(fp, "ellip_df2_order6_cut2000_f64_ba", "DF2", DF2_q12, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 522: benchmark_fixed_q24(fp, "ellip_df2_order6_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 523: benchmark_fixed_q12(fp, "ellip_df2_order6_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7); break;
+
+    case 524: benchmark_fixed_q24(fp, "ellip_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 525: benchmark_fixed_q12(fp, "ellip_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 526: benchmark_fixed_q24(fp, "ellip_tdf2_order6_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 527: benchmark_fixed_q12(fp, "ellip_tdf2_order6_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7); break;
+
+    case 528: benchmark_fixed_q24(fp, "ellip_df1_order6_cut5000_f64_ba", "DF1", DF1_q24, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 529: benchmark_fixed_q12(fp, "ellip_df1_order6_cut5000_f64_ba", "DF1", DF1_q12, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 530: benchmark_fixed_q24(fp, "ellip_df1_order6_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 531: benchmark_fixed_q12(fp, "ellip_df1_order6_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7); break;
+
+    case 532: benchmark_fixed_q24(fp, "ellip_df2_order6_cut5000_f64_ba", "DF2", DF2_q24, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 533: benchmark_fixed_q12(fp, "ellip_df2_order6_cut5000_f64_ba", "DF2", DF2_q12, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 534: benchmark_fixed_q24(fp, "ellip_df2_order6_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 535: benchmark_fixed_q12(fp, "ellip_df2_order6_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7); break;
+
+    case 536: benchmark_fixed_q24(fp, "ellip_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 537: benchmark_fixed_q12(fp, "ellip_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 538: benchmark_fixed_q24(fp, "ellip_tdf2_order6_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 539: benchmark_fixed_q12(fp, "ellip_tdf2_order6_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7); break;
+
+    case 540: benchmark_fixed_q24(fp, "ellip_df1_order8_cut1000_f64_ba", "DF1", DF1_q24, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 541: benchmark_fixed_q12(fp, "ellip_df1_order8_cut1000_f64_ba", "DF1", DF1_q12, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 542: benchmark_fixed_q24(fp, "ellip_df1_order8_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 543: benchmark_fixed_q12(fp, "ellip_df1_order8_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9); break;
+
+    case 544: benchmark_fixed_q24(fp, "ellip_df2_order8_cut1000_f64_ba", "DF2", DF2_q24, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 545: benchmark_fixed_q12(fp, "ellip_df2_order8_cut1000_f64_ba", "DF2", DF2_q12, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 546: benchmark_fixed_q24(fp, "ellip_df2_order8_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 547: benchmark_fixed_q12(fp, "ellip_df2_order8_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9); break;
+
+    case 548: benchmark_fixed_q24(fp, "ellip_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 549: benchmark_fixed_q12(fp, "ellip_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 550: benchmark_fixed_q24(fp, "ellip_tdf2_order8_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 551: benchmark_fixed_q12(fp, "ellip_tdf2_order8_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9); break;
+
+    case 552: benchmark_fixed_q24(fp, "ellip_df1_order8_cut2000_f64_ba", "DF1", DF1_q24, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 553: benchmark_fixed_q12(fp, "ellip_df1_order8_cut2000_f64_ba", "DF1", DF1_q12, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 554: benchmark_fixed_q24(fp, "ellip_df1_order8_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 555: benchmark_fixed_q12(fp, "ellip_df1_order8_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9); break;
+
+    case 556: benchmark_fixed_q24(fp, "ellip_df2_order8_cut2000_f64_ba", "DF2", DF2_q24, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 557: benchmark_fixed_q12(fp, "ellip_df2_order8_cut2000_f64_ba", "DF2", DF2_q12, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 558: benchmark_fixed_q24(fp, "ellip_df2_order8_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 559: benchmark_fixed_q12(fp, "ellip_df2_order8_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9); break;
+
+    case 560: benchmark_fixed_q24(fp, "ellip_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 561: benchmark_fixed_q12(fp, "ellip_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 562: benchmark_fixed_q24(fp, "ellip_tdf2_order8_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 563: benchmark_fixed_q12(fp, "ellip_tdf2_order8_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9); break;
+
+    case 564: benchmark_fixed_q24(fp, "ellip_df1_order8_cut5000_f64_ba", "DF1", DF1_q24, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 565: benchmark_fixed_q12(fp, "ellip_df1_order8_cut5000_f64_ba", "DF1", DF1_q12, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 566: benchmark_fixed_q24(fp, "ellip_df1_order8_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 567: benchmark_fixed_q12(fp, "ellip_df1_order8_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9); break;
+
+    case 568: benchmark_fixed_q24(fp, "ellip_df2_order8_cut5000_f64_ba", "DF2", DF2_q24, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 569: benchmark_fixed_q12(fp, "ellip_df2_order8_cut5000_f64_ba", "DF2", DF2_q12, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 570: benchmark_fixed_q24(fp, "ellip_df2_order8_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 571: benchmark_fixed_q12(fp, "ellip_df2_order8_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9); break;
+
+    case 572: benchmark_fixed_q24(fp, "ellip_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q24, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 573: benchmark_fixed_q12(fp, "ellip_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q12, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 574: benchmark_fixed_q24(fp, "ellip_tdf2_order8_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 575: benchmark_fixed_q12(fp, "ellip_tdf2_order8_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9); break;
+
+    case 576: benchmark_fixed_q24(fp, "bessel_df1_order2_cut1000_f64_ba", "DF1", DF1_q24, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 577: benchmark_fixed_q12(fp, "bessel_df1_order2_cut1000_f64_ba", "DF1", DF1_q12, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 578: benchmark_fixed_q24(fp, "bessel_df1_order2_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 579: benchmark_fixed_q12(fp, "bessel_df1_order2_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3); break;
+
+    case 580: benchmark_fixed_q24(fp, "bessel_df2_order2_cut1000_f64_ba", "DF2", DF2_q24, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 581: benchmark_fixed_q12(fp, "bessel_df2_order2_cut1000_f64_ba", "DF2", DF2_q12, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 582: benchmark_fixed_q24(fp, "bessel_df2_order2_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 583: benchmark_fixed_q12(fp, "bessel_df2_order2_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3); break;
+
+    case 584: benchmark_fixed_q24(fp, "bessel_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 585: benchmark_fixed_q12(fp, "bessel_tdf2_order2_cut1000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 586: benchmark_fixed_q24(fp, "bessel_tdf2_order2_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 587: benchmark_fixed_q12(fp, "bessel_tdf2_order2_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3); break;
+
+    case 588: benchmark_fixed_q24(fp, "bessel_df1_order2_cut2000_f64_ba", "DF1", DF1_q24, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 589: benchmark_fixed_q12(fp, "bessel_df1_order2_cut2000_f64_ba", "DF1", DF1_q12, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 590: benchmark_fixed_q24(fp, "bessel_df1_order2_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 591: benchmark_fixed_q12(fp, "bessel_df1_order2_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3); break;
+
+    case 592: benchmark_fixed_q24(fp, "bessel_df2_order2_cut2000_f64_ba", "DF2", DF2_q24, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 593: benchmark_fixed_q12(fp, "bessel_df2_order2_cut2000_f64_ba", "DF2", DF2_q12, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 594: benchmark_fixed_q24(fp, "bessel_df2_order2_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 595: benchmark_fixed_q12(fp, "bessel_df2_order2_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3); break;
+
+    case 596: benchmark_fixed_q24(fp, "bessel_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 597: benchmark_fixed_q12(fp, "bessel_tdf2_order2_cut2000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 598: benchmark_fixed_q24(fp, "bessel_tdf2_order2_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 599: benchmark_fixed_q12(fp, "bessel_tdf2_order2_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3); break;
+
+    case 600: benchmark_fixed_q24(fp, "bessel_df1_order2_cut5000_f64_ba", "DF1", DF1_q24, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 601: benchmark_fixed_q12(fp, "bessel_df1_order2_cut5000_f64_ba", "DF1", DF1_q12, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 602: benchmark_fixed_q24(fp, "bessel_df1_order2_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 603: benchmark_fixed_q12(fp, "bessel_df1_order2_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3); break;
+
+    case 604: benchmark_fixed_q24(fp, "bessel_df2_order2_cut5000_f64_ba", "DF2", DF2_q24, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 605: benchmark_fixed_q12(fp, "bessel_df2_order2_cut5000_f64_ba", "DF2", DF2_q12, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 606: benchmark_fixed_q24(fp, "bessel_df2_order2_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 607: benchmark_fixed_q12(fp, "bessel_df2_order2_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3); break;
+
+    case 608: benchmark_fixed_q24(fp, "bessel_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 609: benchmark_fixed_q12(fp, "bessel_tdf2_order2_cut5000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 610: benchmark_fixed_q24(fp, "bessel_tdf2_order2_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 611: benchmark_fixed_q12(fp, "bessel_tdf2_order2_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3); break;
+
+    case 612: benchmark_fixed_q24(fp, "bessel_df1_order4_cut1000_f64_ba", "DF1", DF1_q24, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 613: benchmark_fixed_q12(fp, "bessel_df1_order4_cut1000_f64_ba", "DF1", DF1_q12, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 614: benchmark_fixed_q24(fp, "bessel_df1_order4_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 615: benchmark_fixed_q12(fp, "bessel_df1_order4_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5); break;
+
+    case 616: benchmark_fixed_q24(fp, "bessel_df2_order4_cut1000_f64_ba", "DF2", DF2_q24, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 617: benchmark_fixed_q12(fp, "bessel_df2_order4_cut1000_f64_ba", "DF2", DF2_q12, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 618: benchmark_fixed_q24(fp, "bessel_df2_order4_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 619: benchmark_fixed_q12(fp, "bessel_df2_order4_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5); break;
+
+    case 620: benchmark_fixed_q24(fp, "bessel_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 621: benchmark_fixed_q12(fp, "bessel_tdf2_order4_cut1000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 622: benchmark_fixed_q24(fp, "bessel_tdf2_order4_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 623: benchmark_fixed_q12(fp, "bessel_tdf2_order4_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5); break;
+
+    case 624: benchmark_fixed_q24(fp, "bessel_df1_order4_cut2000_f64_ba", "DF1", DF1_q24, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 625: benchmark_fixed_q12(fp, "bessel_df1_order4_cut2000_f64_ba", "DF1", DF1_q12, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 626: benchmark_fixed_q24(fp, "bessel_df1_order4_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 627: benchmark_fixed_q12(fp, "bessel_df1_order4_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5); break;
+
+    case 628: benchmark_fixed_q24(fp, "bessel_df2_order4_cut2000_f64_ba", "DF2", DF2_q24, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 629: benchmark_fixed_q12(fp, "bessel_df2_order4_cut2000_f64_ba", "DF2", DF2_q12, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 630: benchmark_fixed_q24(fp, "bessel_df2_order4_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 631: benchmark_fixed_q12(fp, "bessel_df2_order4_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5); break;
+
+    case 632: benchmark_fixed_q24(fp, "bessel_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 633: benchmark_fixed_q12(fp, "bessel_tdf2_order4_cut2000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 634: benchmark_fixed_q24(fp, "bessel_tdf2_order4_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 635: benchmark_fixed_q12(fp, "bessel_tdf2_order4_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5); break;
+
+    case 636: benchmark_fixed_q24(fp, "bessel_df1_order4_cut5000_f64_ba", "DF1", DF1_q24, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 637: benchmark_fixed_q12(fp, "bessel_df1_order4_cut5000_f64_ba", "DF1", DF1_q12, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 638: benchmark_fixed_q24(fp, "bessel_df1_order4_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 639: benchmark_fixed_q12(fp, "bessel_df1_order4_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5); break;
+
+    case 640: benchmark_fixed_q24(fp, "bessel_df2_order4_cut5000_f64_ba", "DF2", DF2_q24, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 641: benchmark_fixed_q12(fp, "bessel_df2_order4_cut5000_f64_ba", "DF2", DF2_q12, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 642: benchmark_fixed_q24(fp, "bessel_df2_order4_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 643: benchmark_fixed_q12(fp, "bessel_df2_order4_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5); break;
+
+    case 644: benchmark_fixed_q24(fp, "bessel_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 645: benchmark_fixed_q12(fp, "bessel_tdf2_order4_cut5000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 646: benchmark_fixed_q24(fp, "bessel_tdf2_order4_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 647: benchmark_fixed_q12(fp, "bessel_tdf2_order4_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5); break;
+
+    case 648: benchmark_fixed_q24(fp, "bessel_df1_order6_cut1000_f64_ba", "DF1", DF1_q24, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 649: benchmark_fixed_q12(fp, "bessel_df1_order6_cut1000_f64_ba", "DF1", DF1_q12, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 650: benchmark_fixed_q24(fp, "bessel_df1_order6_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 651: benchmark_fixed_q12(fp, "bessel_df1_order6_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7); break;
+
+    case 652: benchmark_fixed_q24(fp, "bessel_df2_order6_cut1000_f64_ba", "DF2", DF2_q24, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 653: benchmark_fixed_q12(fp, "bessel_df2_order6_cut1000_f64_ba", "DF2", DF2_q12, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 654: benchmark_fixed_q24(fp, "bessel_df2_order6_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 655: benchmark_fixed_q12(fp, "bessel_df2_order6_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7); break;
+
+    case 656: benchmark_fixed_q24(fp, "bessel_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 657: benchmark_fixed_q12(fp, "bessel_tdf2_order6_cut1000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 658: benchmark_fixed_q24(fp, "bessel_tdf2_order6_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 659: benchmark_fixed_q12(fp, "bessel_tdf2_order6_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7); break;
+
+    case 660: benchmark_fixed_q24(fp, "bessel_df1_order6_cut2000_f64_ba", "DF1", DF1_q24, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 661: benchmark_fixed_q12(fp, "bessel_df1_order6_cut2000_f64_ba", "DF1", DF1_q12, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 662: benchmark_fixed_q24(fp, "bessel_df1_order6_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 663: benchmark_fixed_q12(fp, "bessel_df1_order6_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7); break;
+
+    case 664: benchmark_fixed_q24(fp, "bessel_df2_order6_cut2000_f64_ba", "DF2", DF2_q24, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 665: benchmark_fixed_q12(fp, "bessel_df2_order6_cut2000_f64_ba", "DF2", DF2_q12, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 666: benchmark_fixed_q24(fp, "bessel_df2_order6_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 667: benchmark_fixed_q12(fp, "bessel_df2_order6_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7); break;
+
+    case 668: benchmark_fixed_q24(fp, "bessel_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 669: benchmark_fixed_q12(fp, "bessel_tdf2_order6_cut2000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 670: benchmark_fixed_q24(fp, "bessel_tdf2_order6_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 671: benchmark_fixed_q12(fp, "bessel_tdf2_order6_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7); break;
+
+    case 672: benchmark_fixed_q24(fp, "bessel_df1_order6_cut5000_f64_ba", "DF1", DF1_q24, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 673: benchmark_fixed_q12(fp, "bessel_df1_order6_cut5000_f64_ba", "DF1", DF1_q12, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 674: benchmark_fixed_q24(fp, "bessel_df1_order6_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 675: benchmark_fixed_q12(fp, "bessel_df1_order6_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7); break;
+
+    case 676: benchmark_fixed_q24(fp, "bessel_df2_order6_cut5000_f64_ba", "DF2", DF2_q24, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 677: benchmark_fixed_q12(fp, "bessel_df2_order6_cut5000_f64_ba", "DF2", DF2_q12, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 678: benchmark_fixed_q24(fp, "bessel_df2_order6_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 679: benchmark_fixed_q12(fp, "bessel_df2_order6_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7); break;
+
+    case 680: benchmark_fixed_q24(fp, "bessel_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 681: benchmark_fixed_q12(fp, "bessel_tdf2_order6_cut5000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 682: benchmark_fixed_q24(fp, "bessel_tdf2_order6_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 683: benchmark_fixed_q12(fp, "bessel_tdf2_order6_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7); break;
+
+    case 684: benchmark_fixed_q24(fp, "bessel_df1_order8_cut1000_f64_ba", "DF1", DF1_q24, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 685: benchmark_fixed_q12(fp, "bessel_df1_order8_cut1000_f64_ba", "DF1", DF1_q12, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 686: benchmark_fixed_q24(fp, "bessel_df1_order8_cut1000_f64_ba", "DF1_ACC", DF1_q24_acc, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 687: benchmark_fixed_q12(fp, "bessel_df1_order8_cut1000_f64_ba", "DF1_ACC", DF1_q12_acc, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9); break;
+
+    case 688: benchmark_fixed_q24(fp, "bessel_df2_order8_cut1000_f64_ba", "DF2", DF2_q24, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 689: benchmark_fixed_q12(fp, "bessel_df2_order8_cut1000_f64_ba", "DF2", DF2_q12, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 690: benchmark_fixed_q24(fp, "bessel_df2_order8_cut1000_f64_ba", "DF2_ACC", DF2_q24_acc, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 691: benchmark_fixed_q12(fp, "bessel_df2_order8_cut1000_f64_ba", "DF2_ACC", DF2_q12_acc, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9); break;
+
+    case 692: benchmark_fixed_q24(fp, "bessel_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 693: benchmark_fixed_q12(fp, "bessel_tdf2_order8_cut1000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 694: benchmark_fixed_q24(fp, "bessel_tdf2_order8_cut1000_f64_ba", "TDF2_ACC", TDF2_q24_acc, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 695: benchmark_fixed_q12(fp, "bessel_tdf2_order8_cut1000_f64_ba", "TDF2_ACC", TDF2_q12_acc, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9); break;
+
+    case 696: benchmark_fixed_q24(fp, "bessel_df1_order8_cut2000_f64_ba", "DF1", DF1_q24, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 697: benchmark_fixed_q12(fp, "bessel_df1_order8_cut2000_f64_ba", "DF1", DF1_q12, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 698: benchmark_fixed_q24(fp, "bessel_df1_order8_cut2000_f64_ba", "DF1_ACC", DF1_q24_acc, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 699: benchmark_fixed_q12(fp, "bessel_df1_order8_cut2000_f64_ba", "DF1_ACC", DF1_q12_acc, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9); break;
+
+    case 700: benchmark_fixed_q24(fp, "bessel_df2_order8_cut2000_f64_ba", "DF2", DF2_q24, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 701: benchmark_fixed_q12(fp, "bessel_df2_order8_cut2000_f64_ba", "DF2", DF2_q12, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 702: benchmark_fixed_q24(fp, "bessel_df2_order8_cut2000_f64_ba", "DF2_ACC", DF2_q24_acc, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 703: benchmark_fixed_q12(fp, "bessel_df2_order8_cut2000_f64_ba", "DF2_ACC", DF2_q12_acc, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9); break;
+
+    case 704: benchmark_fixed_q24(fp, "bessel_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 705: benchmark_fixed_q12(fp, "bessel_tdf2_order8_cut2000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 706: benchmark_fixed_q24(fp, "bessel_tdf2_order8_cut2000_f64_ba", "TDF2_ACC", TDF2_q24_acc, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 707: benchmark_fixed_q12(fp, "bessel_tdf2_order8_cut2000_f64_ba", "TDF2_ACC", TDF2_q12_acc, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9); break;
+
+    case 708: benchmark_fixed_q24(fp, "bessel_df1_order8_cut5000_f64_ba", "DF1", DF1_q24, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 709: benchmark_fixed_q12(fp, "bessel_df1_order8_cut5000_f64_ba", "DF1", DF1_q12, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 710: benchmark_fixed_q24(fp, "bessel_df1_order8_cut5000_f64_ba", "DF1_ACC", DF1_q24_acc, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 711: benchmark_fixed_q12(fp, "bessel_df1_order8_cut5000_f64_ba", "DF1_ACC", DF1_q12_acc, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9); break;
+
+    case 712: benchmark_fixed_q24(fp, "bessel_df2_order8_cut5000_f64_ba", "DF2", DF2_q24, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 713: benchmark_fixed_q12(fp, "bessel_df2_order8_cut5000_f64_ba", "DF2", DF2_q12, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 714: benchmark_fixed_q24(fp, "bessel_df2_order8_cut5000_f64_ba", "DF2_ACC", DF2_q24_acc, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 715: benchmark_fixed_q12(fp, "bessel_df2_order8_cut5000_f64_ba", "DF2_ACC", DF2_q12_acc, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9); break;
+
+    case 716: benchmark_fixed_q24(fp, "bessel_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q24, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 717: benchmark_fixed_q12(fp, "bessel_tdf2_order8_cut5000_f64_ba", "TDF2", TDF2_q12, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 718: benchmark_fixed_q24(fp, "bessel_tdf2_order8_cut5000_f64_ba", "TDF2_ACC", TDF2_q24_acc, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 719: benchmark_fixed_q12(fp, "bessel_tdf2_order8_cut5000_f64_ba", "TDF2_ACC", TDF2_q12_acc, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9); break;
+
+    // --- CASCADE SOS ---
+    case 720: benchmark_cascade_q24(fp, "butter_cascade_order2_cut1000_f64_sos", CASCADE_q24, butter_cascade_order2_cut1000_f64_sos, 1); break;
+    case 721: benchmark_cascade_q12(fp, "butter_cascade_order2_cut1000_f64_sos", CASCADE_q12, butter_cascade_order2_cut1000_f64_sos, 1); break;
+    case 722: benchmark_sos_q24(fp, "butter_cascade_order2_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, butter_cascade_order2_cut1000_f64_sos, 1); break;
+    case 723: benchmark_sos_q12(fp, "butter_cascade_order2_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, butter_cascade_order2_cut1000_f64_sos, 1); break;
+    case 724: benchmark_sos_q24(fp, "butter_cascade_order2_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, butter_cascade_order2_cut1000_f64_sos, 1); break;
+    case 725: benchmark_sos_q12(fp, "butter_cascade_order2_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, butter_cascade_order2_cut1000_f64_sos, 1); break;
+    case 726: benchmark_sos_q24(fp, "butter_cascade_order2_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, butter_cascade_order2_cut1000_f64_sos, 1); break;
+    case 727: benchmark_sos_q12(fp, "butter_cascade_order2_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, butter_cascade_order2_cut1000_f64_sos, 1); break;
+    case 728: benchmark_sos_bfp16(fp, "butter_cascade_order2_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, butter_cascade_order2_cut1000_f64_sos, 1); break;
+
+    case 729: benchmark_cascade_q24(fp, "butter_cascade_order2_cut2000_f64_sos", CASCADE_q24, butter_cascade_order2_cut2000_f64_sos, 1); break;
+    case 730: benchmark_cascade_q12(fp, "butter_cascade_order2_cut2000_f64_sos", CASCADE_q12, butter_cascade_order2_cut2000_f64_sos, 1); break;
+    case 731: benchmark_sos_q24(fp, "butter_cascade_order2_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, butter_cascade_order2_cut2000_f64_sos, 1); break;
+    case 732: benchmark_sos_q12(fp, "butter_cascade_order2_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, butter_cascade_order2_cut2000_f64_sos, 1); break;
+    case 733: benchmark_sos_q24(fp, "butter_cascade_order2_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, butter_cascade_order2_cut2000_f64_sos, 1); break;
+    case 734: benchmark_sos_q12(fp, "butter_cascade_order2_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, butter_cascade_order2_cut2000_f64_sos, 1); break;
+    case 735: benchmark_sos_q24(fp, "butter_cascade_order2_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, butter_cascade_order2_cut2000_f64_sos, 1); break;
+    case 736: benchmark_sos_q12(fp, "butter_cascade_order2_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, butter_cascade_order2_cut2000_f64_sos, 1); break;
+    case 737: benchmark_sos_bfp16(fp, "butter_cascade_order2_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, butter_cascade_order2_cut2000_f64_sos, 1); break;
+
+    case 738: benchmark_cascade_q24(fp, "butter_cascade_order2_cut5000_f64_sos", CASCADE_q24, butter_cascade_order2_cut5000_f64_sos, 1); break;
+    case 739: benchmark_cascade_q12(fp, "butter_cascade_order2_cut5000_f64_sos", CASCADE_q12, butter_cascade_order2_cut5000_f64_sos, 1); break;
+    case 740: benchmark_sos_q24(fp, "butter_cascade_order2_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, butter_cascade_order2_cut5000_f64_sos, 1); break;
+    case 741: benchmark_sos_q12(fp, "butter_cascade_order2_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, butter_cascade_order2_cut5000_f64_sos, 1); break;
+    case 742: benchmark_sos_q24(fp, "butter_cascade_order2_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, butter_cascade_order2_cut5000_f64_sos, 1); break;
+    case 743: benchmark_sos_q12(fp, "butter_cascade_order2_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, butter_cascade_order2_cut5000_f64_sos, 1); break;
+    case 744: benchmark_sos_q24(fp, "butter_cascade_order2_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, butter_cascade_order2_cut5000_f64_sos, 1); break;
+    case 745: benchmark_sos_q12(fp, "butter_cascade_order2_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, butter_cascade_order2_cut5000_f64_sos, 1); break;
+    case 746: benchmark_sos_bfp16(fp, "butter_cascade_order2_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, butter_cascade_order2_cut5000_f64_sos, 1); break;
+
+    case 747: benchmark_cascade_q24(fp, "butter_cascade_order4_cut1000_f64_sos", CASCADE_q24, butter_cascade_order4_cut1000_f64_sos, 2); break;
+    case 748: benchmark_cascade_q12(fp, "butter_cascade_order4_cut1000_f64_sos", CASCADE_q12, butter_cascade_order4_cut1000_f64_sos, 2); break;
+    case 749: benchmark_sos_q24(fp, "butter_cascade_order4_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, butter_cascade_order4_cut1000_f64_sos, 2); break;
+    case 750: benchmark_sos_q12(fp, "butter_cascade_order4_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, butter_cascade_order4_cut1000_f64_sos, 2); break;
+    case 751: benchmark_sos_q24(fp, "butter_cascade_order4_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, butter_cascade_order4_cut1000_f64_sos, 2); break;
+    case 752: benchmark_sos_q12(fp, "butter_cascade_order4_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, butter_cascade_order4_cut1000_f64_sos, 2); break;
+    case 753: benchmark_sos_q24(fp, "butter_cascade_order4_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, butter_cascade_order4_cut1000_f64_sos, 2); break;
+    case 754: benchmark_sos_q12(fp, "butter_cascade_order4_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, butter_cascade_order4_cut1000_f64_sos, 2); break;
+    case 755: benchmark_sos_bfp16(fp, "butter_cascade_order4_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, butter_cascade_order4_cut1000_f64_sos, 2); break;
+
+    case 756: benchmark_cascade_q24(fp, "butter_cascade_order4_cut2000_f64_sos", CASCADE_q24, butter_cascade_order4_cut2000_f64_sos, 2); break;
+    case 757: benchmark_cascade_q12(fp, "butter_cascade_order4_cut2000_f64_sos", CASCADE_q12, butter_cascade_order4_cut2000_f64_sos, 2); break;
+    case 758: benchmark_sos_q24(fp, "butter_cascade_order4_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, butter_cascade_order4_cut2000_f64_sos, 2); break;
+    case 759: benchmark_sos_q12(fp, "butter_cascade_order4_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, butter_cascade_order4_cut2000_f64_sos, 2); break;
+    case 760: benchmark_sos_q24(fp, "butter_cascade_order4_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, butter_cascade_order4_cut2000_f64_sos, 2); break;
+    case 761: benchmark_sos_q12(fp, "butter_cascade_order4_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, butter_cascade_order4_cut2000_f64_sos, 2); break;
+    case 762: benchmark_sos_q24(fp, "butter_cascade_order4_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, butter_cascade_order4_cut2000_f64_sos, 2); break;
+    case 763: benchmark_sos_q12(fp, "butter_cascade_order4_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, butter_cascade_order4_cut2000_f64_sos, 2); break;
+    case 764: benchmark_sos_bfp16(fp, "butter_cascade_order4_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, butter_cascade_order4_cut2000_f64_sos, 2); break;
+
+    case 765: benchmark_cascade_q24(fp, "butter_cascade_order4_cut5000_f64_sos", CASCADE_q24, butter_cascade_order4_cut5000_f64_sos, 2); break;
+    case 766: benchmark_cascade_q12(fp, "butter_cascade_order4_cut5000_f64_sos", CASCADE_q12, butter_cascade_order4_cut5000_f64_sos, 2); break;
+    case 767: benchmark_sos_q24(fp, "butter_cascade_order4_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, butter_cascade_order4_cut5000_f64_sos, 2); break;
+    case 768: benchmark_sos_q12(fp, "butter_cascade_order4_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, butter_cascade_order4_cut5000_f64_sos, 2); break;
+    case 769: benchmark_sos_q24(fp, "butter_cascade_order4_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, butter_cascade_order4_cut5000_f64_sos, 2); break;
+    case 770: benchmark_sos_q12(fp, "butter_cascade_order4_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, butter_cascade_order4_cut5000_f64_sos, 2); break;
+    case 771: benchmark_sos_q24(fp, "butter_cascade_order4_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, butter_cascade_order4_cut5000_f64_sos, 2); break;
+    case 772: benchmark_sos_q12(fp, "butter_cascade_order4_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, butter_cascade_order4_cut5000_f64_sos, 2); break;
+    case 773: benchmark_sos_bfp16(fp, "butter_cascade_order4_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, butter_cascade_order4_cut5000_f64_sos, 2); break;
+
+    case 774: benchmark_cascade_q24(fp, "butter_cascade_order6_cut1000_f64_sos", CASCADE_q24, butter_cascade_order6_cut1000_f64_sos, 3); break;
+    case 775: benchmark_cascade_q12(fp, "butter_cascade_order6_cut1000_f64_sos", CASCADE_q12, butter_cascade_order6_cut1000_f64_sos, 3); break;
+    case 776: benchmark_sos_q24(fp, "butter_cascade_order6_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, butter_cascade_order6_cut1000_f64_sos, 3); break;
+    case 777: benchmark_sos_q12(fp, "butter_cascade_order6_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, butter_cascade_order6_cut1000_f64_sos, 3); break;
+    case 778: benchmark_sos_q24(fp, "butter_cascade_order6_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, butter_cascade_order6_cut1000_f64_sos, 3); break;
+    case 779: benchmark_sos_q12(fp, "butter_cascade_order6_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, butter_cascade_order6_cut1000_f64_sos, 3); break;
+    case 780: benchmark_sos_q24(fp, "butter_cascade_order6_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, butter_cascade_order6_cut1000_f64_sos, 3); break;
+    case 781: benchmark_sos_q12(fp, "butter_cascade_order6_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, butter_cascade_order6_cut1000_f64_sos, 3); break;
+    case 782: benchmark_sos_bfp16(fp, "butter_cascade_order6_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, butter_cascade_order6_cut1000_f64_sos, 3); break;
+
+    case 783: benchmark_cascade_q24(fp, "butter_cascade_order6_cut2000_f64_sos", CASCADE_q24, butter_cascade_order6_cut2000_f64_sos, 3); break;
+    case 784: benchmark_cascade_q12(fp, "butter_cascade_order6_cut2000_f64_sos", CASCADE_q12, butter_cascade_order6_cut2000_f64_sos, 3); break;
+    case 785: benchmark_sos_q24(fp, "butter_cascade_order6_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, butter_cascade_order6_cut2000_f64_sos, 3); break;
+    case 786: benchmark_sos_q12(fp, "butter_cascade_order6_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, butter_cascade_order6_cut2000_f64_sos, 3); break;
+    case 787: benchmark_sos_q24(fp, "butter_cascade_order6_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, butter_cascade_order6_cut2000_f64_sos, 3); break;
+    case 788: benchmark_sos_q12(fp, "butter_cascade_order6_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, butter_cascade_order6_cut2000_f64_sos, 3); break;
+    case 789: benchmark_sos_q24(fp, "butter_cascade_order6_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, butter_cascade_order6_cut2000_f64_sos, 3); break;
+    case 790: benchmark_sos_q12(fp, "butter_cascade_order6_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, butter_cascade_order6_cut2000_f64_sos, 3); break;
+    case 791: benchmark_sos_bfp16(fp, "butter_cascade_order6_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, butter_cascade_order6_cut2000_f64_sos, 3); break;
+
+    case 792: benchmark_cascade_q24(fp, "butter_cascade_order6_cut5000_f64_sos", CASCADE_q24, butter_cascade_order6_cut5000_f64_sos, 3); break;
+    case 793: benchmark_cascade_q12(fp, "butter_cascade_order6_cut5000_f64_sos", CASCADE_q12, butter_cascade_order6_cut5000_f64_sos, 3); break;
+    case 794: benchmark_sos_q24(fp, "butter_cascade_order6_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, butter_cascade_order6_cut5000_f64_sos, 3); break;
+    case 795: benchmark_sos_q12(fp, "butter_cascade_order6_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, butter_cascade_order6_cut5000_f64_sos, 3); break;
+    case 796: benchmark_sos_q24(fp, "butter_cascade_order6_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, butter_cascade_order6_cut5000_f64_sos, 3); break;
+    case 797: benchmark_sos_q12(fp, "butter_cascade_order6_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, butter_cascade_order6_cut5000_f64_sos, 3); break;
+    case 798: benchmark_sos_q24(fp, "butter_cascade_order6_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, butter_cascade_order6_cut5000_f64_sos, 3); break;
+    case 799: benchmark_sos_q12(fp, "butter_cascade_order6_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, butter_cascade_order6_cut5000_f64_sos, 3); break;
+    case 800: benchmark_sos_bfp16(fp, "butter_cascade_order6_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, butter_cascade_order6_cut5000_f64_sos, 3); break;
+
+    case 801: benchmark_cascade_q24(fp, "butter_cascade_order8_cut1000_f64_sos", CASCADE_q24, butter_cascade_order8_cut1000_f64_sos, 4); break;
+    case 802: benchmark_cascade_q12(fp, "butter_cascade_order8_cut1000_f64_sos", CASCADE_q12, butter_cascade_order8_cut1000_f64_sos, 4); break;
+    case 803: benchmark_sos_q24(fp, "butter_cascade_order8_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, butter_cascade_order8_cut1000_f64_sos, 4); break;
+    case 804: benchmark_sos_q12(fp, "butter_cascade_order8_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, butter_cascade_order8_cut1000_f64_sos, 4); break;
+    case 805: benchmark_sos_q24(fp, "butter_cascade_order8_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, butter_cascade_order8_cut1000_f64_sos, 4); break;
+    case 806: benchmark_sos_q12(fp, "butter_cascade_order8_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, butter_cascade_order8_cut1000_f64_sos, 4); break;
+    case 807: benchmark_sos_q24(fp, "butter_cascade_order8_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, butter_cascade_order8_cut1000_f64_sos, 4); break;
+    case 808: benchmark_sos_q12(fp, "butter_cascade_order8_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, butter_cascade_order8_cut1000_f64_sos, 4); break;
+    case 809: benchmark_sos_bfp16(fp, "butter_cascade_order8_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, butter_cascade_order8_cut1000_f64_sos, 4); break;
+
+    case 810: benchmark_cascade_q24(fp, "butter_cascade_order8_cut2000_f64_sos", CASCADE_q24, butter_cascade_order8_cut2000_f64_sos, 4); break;
+    case 811: benchmark_cascade_q12(fp, "butter_cascade_order8_cut2000_f64_sos", CASCADE_q12, butter_cascade_order8_cut2000_f64_sos, 4); break;
+    case 812: benchmark_sos_q24(fp, "butter_cascade_order8_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, butter_cascade_order8_cut2000_f64_sos, 4); break;
+    case 813: benchmark_sos_q12(fp, "butter_cascade_order8_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, butter_cascade_order8_cut2000_f64_sos, 4); break;
+    case 814: benchmark_sos_q24(fp, "butter_cascade_order8_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, butter_cascade_order8_cut2000_f64_sos, 4); break;
+    case 815: benchmark_sos_q12(fp, "butter_cascade_order8_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, butter_cascade_order8_cut2000_f64_sos, 4); break;
+    case 816: benchmark_sos_q24(fp, "butter_cascade_order8_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, butter_cascade_order8_cut2000_f64_sos, 4); break;
+    case 817: benchmark_sos_q12(fp, "butter_cascade_order8_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, butter_cascade_order8_cut2000_f64_sos, 4); break;
+    case 818: benchmark_sos_bfp16(fp, "butter_cascade_order8_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, butter_cascade_order8_cut2000_f64_sos, 4); break;
+
+    case 819: benchmark_cascade_q24(fp, "butter_cascade_order8_cut5000_f64_sos", CASCADE_q24, butter_cascade_order8_cut5000_f64_sos, 4); break;
+    case 820: benchmark_cascade_q12(fp, "butter_cascade_order8_cut5000_f64_sos", CASCADE_q12, butter_cascade_order8_cut5000_f64_sos, 4); break;
+    case 821: benchmark_sos_q24(fp, "butter_cascade_order8_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, butter_cascade_order8_cut5000_f64_sos, 4); break;
+    case 822: benchmark_sos_q12(fp, "butter_cascade_order8_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, butter_cascade_order8_cut5000_f64_sos, 4); break;
+    case 823: benchmark_sos_q24(fp, "butter_cascade_order8_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, butter_cascade_order8_cut5000_f64_sos, 4); break;
+    case 824: benchmark_sos_q12(fp, "butter_cascade_order8_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, butter_cascade_order8_cut5000_f64_sos, 4); break;
+    case 825: benchmark_sos_q24(fp, "butter_cascade_order8_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, butter_cascade_order8_cut5000_f64_sos, 4); break;
+    case 826: benchmark_sos_q12(fp, "butter_cascade_order8_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, butter_cascade_order8_cut5000_f64_sos, 4); break;
+    case 827: benchmark_sos_bfp16(fp, "butter_cascade_order8_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, butter_cascade_order8_cut5000_f64_sos, 4); break;
+
+    case 828: benchmark_cascade_q24(fp, "cheby1_cascade_order2_cut1000_f64_sos", CASCADE_q24, cheby1_cascade_order2_cut1000_f64_sos, 1); break;
+    case 829: benchmark_cascade_q12(fp, "cheby1_cascade_order2_cut1000_f64_sos", CASCADE_q12, cheby1_cascade_order2_cut1000_f64_sos, 1); break;
+    case 830: benchmark_sos_q24(fp, "cheby1_cascade_order2_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby1_cascade_order2_cut1000_f64_sos, 1); break;
+    case 831: benchmark_sos_q12(fp, "cheby1_cascade_order2_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby1_cascade_order2_cut1000_f64_sos, 1); break;
+    case 832: benchmark_sos_q24(fp, "cheby1_cascade_order2_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby1_cascade_order2_cut1000_f64_sos, 1); break;
+    case 833: benchmark_sos_q12(fp, "cheby1_cascade_order2_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby1_cascade_order2_cut1000_f64_sos, 1); break;
+    case 834: benchmark_sos_q24(fp, "cheby1_cascade_order2_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby1_cascade_order2_cut1000_f64_sos, 1); break;
+    case 835: benchmark_sos_q12(fp, "cheby1_cascade_order2_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby1_cascade_order2_cut1000_f64_sos, 1); break;
+    case 836: benchmark_sos_bfp16(fp, "cheby1_cascade_order2_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, cheby1_cascade_order2_cut1000_f64_sos, 1); break;
+
+    case 837: benchmark_cascade_q24(fp, "cheby1_cascade_order2_cut2000_f64_sos", CASCADE_q24, cheby1_cascade_order2_cut2000_f64_sos, 1); break;
+    case 838: benchmark_cascade_q12(fp, "cheby1_cascade_order2_cut2000_f64_sos", CASCADE_q12, cheby1_cascade_order2_cut2000_f64_sos, 1); break;
+    case 839: benchmark_sos_q24(fp, "cheby1_cascade_order2_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby1_cascade_order2_cut2000_f64_sos, 1); break;
+    case 840: benchmark_sos_q12(fp, "cheby1_cascade_order2_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby1_cascade_order2_cut2000_f64_sos, 1); break;
+    case 841: benchmark_sos_q24(fp, "cheby1_cascade_order2_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby1_cascade_order2_cut2000_f64_sos, 1); break;
+    case 842: benchmark_sos_q12(fp, "cheby1_cascade_order2_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby1_cascade_order2_cut2000_f64_sos, 1); break;
+    case 843: benchmark_sos_q24(fp, "cheby1_cascade_order2_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby1_cascade_order2_cut2000_f64_sos, 1); break;
+    case 844: benchmark_sos_q12(fp, "cheby1_cascade_order2_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby1_cascade_order2_cut2000_f64_sos, 1); break;
+    case 845: benchmark_sos_bfp16(fp, "cheby1_cascade_order2_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, cheby1_cascade_order2_cut2000_f64_sos, 1); break;
+
+    case 846: benchmark_cascade_q24(fp, "cheby1_cascade_order2_cut5000_f64_sos", CASCADE_q24, cheby1_cascade_order2_cut5000_f64_sos, 1); break;
+    case 847: benchmark_cascade_q12(fp, "cheby1_cascade_order2_cut5000_f64_sos", CASCADE_q12, cheby1_cascade_order2_cut5000_f64_sos, 1); break;
+    case 848: benchmark_sos_q24(fp, "cheby1_cascade_order2_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby1_cascade_order2_cut5000_f64_sos, 1); break;
+    case 849: benchmark_sos_q12(fp, "cheby1_cascade_order2_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby1_cascade_order2_cut5000_f64_sos, 1); break;
+    case 850: benchmark_sos_q24(fp, "cheby1_cascade_order2_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby1_cascade_order2_cut5000_f64_sos, 1); break;
+    case 851: benchmark_sos_q12(fp, "cheby1_cascade_order2_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby1_cascade_order2_cut5000_f64_sos, 1); break;
+    case 852: benchmark_sos_q24(fp, "cheby1_cascade_order2_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby1_cascade_order2_cut5000_f64_sos, 1); break;
+    case 853: benchmark_sos_q12(fp, "cheby1_cascade_order2_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby1_cascade_order2_cut5000_f64_sos, 1); break;
+    case 854: benchmark_sos_bfp16(fp, "cheby1_cascade_order2_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, cheby1_cascade_order2_cut5000_f64_sos, 1); break;
+
+    case 855: benchmark_cascade_q24(fp, "cheby1_cascade_order4_cut1000_f64_sos", CASCADE_q24, cheby1_cascade_order4_cut1000_f64_sos, 2); break;
+    case 856: benchmark_cascade_q12(fp, "cheby1_cascade_order4_cut1000_f64_sos", CASCADE_q12, cheby1_cascade_order4_cut1000_f64_sos, 2); break;
+    case 857: benchmark_sos_q24(fp, "cheby1_cascade_order4_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby1_cascade_order4_cut1000_f64_sos, 2); break;
+    case 858: benchmark_sos_q12(fp, "cheby1_cascade_order4_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby1_cascade_order4_cut1000_f64_sos, 2); break;
+    case 859: benchmark_sos_q24(fp, "cheby1_cascade_order4_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby1_cascade_order4_cut1000_f64_sos, 2); break;
+    case 860: benchmark_sos_q12(fp, "cheby1_cascade_order4_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby1_cascade_order4_cut1000_f64_sos, 2); break;
+    case 861: benchmark_sos_q24(fp, "cheby1_cascade_order4_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby1_cascade_order4_cut1000_f64_sos, 2); break;
+    case 862: benchmark_sos_q12(fp, "cheby1_cascade_order4_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby1_cascade_order4_cut1000_f64_sos, 2); break;
+    case 863: benchmark_sos_bfp16(fp, "cheby1_cascade_order4_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, cheby1_cascade_order4_cut1000_f64_sos, 2); break;
+
+    case 864: benchmark_cascade_q24(fp, "cheby1_cascade_order4_cut2000_f64_sos", CASCADE_q24, cheby1_cascade_order4_cut2000_f64_sos, 2); break;
+    case 865: benchmark_cascade_q12(fp, "cheby1_cascade_order4_cut2000_f64_sos", CASCADE_q12, cheby1_cascade_order4_cut2000_f64_sos, 2); break;
+    case 866: benchmark_sos_q24(fp, "cheby1_cascade_order4_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby1_cascade_order4_cut2000_f64_sos, 2); break;
+    case 867: benchmark_sos_q12(fp, "cheby1_cascade_order4_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby1_cascade_order4_cut2000_f64_sos, 2); break;
+    case 868: benchmark_sos_q24(fp, "cheby1_cascade_order4_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby1_cascade_order4_cut2000_f64_sos, 2); break;
+    case 869: benchmark_sos_q12(fp, "cheby1_cascade_order4_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby1_cascade_order4_cut2000_f64_sos, 2); break;
+    case 870: benchmark_sos_q24(fp, "cheby1_cascade_order4_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby1_cascade_order4_cut2000_f64_sos, 2); break;
+    case 871: benchmark_sos_q12(fp, "cheby1_cascade_order4_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby1_cascade_order4_cut2000_f64_sos, 2); break;
+    case 872: benchmark_sos_bfp16(fp, "cheby1_cascade_order4_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, cheby1_cascade_order4_cut2000_f64_sos, 2); break;
+
+    case 873: benchmark_cascade_q24(fp, "cheby1_cascade_order4_cut5000_f64_sos", CASCADE_q24, cheby1_cascade_order4_cut5000_f64_sos, 2); break;
+    case 874: benchmark_cascade_q12(fp, "cheby1_cascade_order4_cut5000_f64_sos", CASCADE_q12, cheby1_cascade_order4_cut5000_f64_sos, 2); break;
+    case 875: benchmark_sos_q24(fp, "cheby1_cascade_order4_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby1_cascade_order4_cut5000_f64_sos, 2); break;
+    case 876: benchmark_sos_q12(fp, "cheby1_cascade_order4_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby1_cascade_order4_cut5000_f64_sos, 2); break;
+    case 877: benchmark_sos_q24(fp, "cheby1_cascade_order4_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby1_cascade_order4_cut5000_f64_sos, 2); break;
+    case 878: benchmark_sos_q12(fp, "cheby1_cascade_order4_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby1_cascade_order4_cut5000_f64_sos, 2); break;
+    case 879: benchmark_sos_q24(fp, "cheby1_cascade_order4_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby1_cascade_order4_cut5000_f64_sos, 2); break;
+    case 880: benchmark_sos_q12(fp, "cheby1_cascade_order4_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby1_cascade_order4_cut5000_f64_sos, 2); break;
+    case 881: benchmark_sos_bfp16(fp, "cheby1_cascade_order4_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, cheby1_cascade_order4_cut5000_f64_sos, 2); break;
+
+    case 882: benchmark_cascade_q24(fp, "cheby1_cascade_order6_cut1000_f64_sos", CASCADE_q24, cheby1_cascade_order6_cut1000_f64_sos, 3); break;
+    case 883: benchmark_cascade_q12(fp, "cheby1_cascade_order6_cut1000_f64_sos", CASCADE_q12, cheby1_cascade_order6_cut1000_f64_sos, 3); break;
+    case 884: benchmark_sos_q24(fp, "cheby1_cascade_order6_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby1_cascade_order6_cut1000_f64_sos, 3); break;
+    case 885: benchmark_sos_q12(fp, "cheby1_cascade_order6_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby1_cascade_order6_cut1000_f64_sos, 3); break;
+    case 886: benchmark_sos_q24(fp, "cheby1_cascade_order6_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby1_cascade_order6_cut1000_f64_sos, 3); break;
+    case 887: benchmark_sos_q12(fp, "cheby1_cascade_order6_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby1_cascade_order6_cut1000_f64_sos, 3); break;
+    case 888: benchmark_sos_q24(fp, "cheby1_cascade_order6_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby1_cascade_order6_cut1000_f64_sos, 3); break;
+    case 889: benchmark_sos_q12(fp, "cheby1_cascade_order6_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby1_cascade_order6_cut1000_f64_sos, 3); break;
+    case 890: benchmark_sos_bfp16(fp, "cheby1_cascade_order6_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, cheby1_cascade_order6_cut1000_f64_sos, 3); break;
+
+    case 891: benchmark_cascade_q24(fp, "cheby1_cascade_order6_cut2000_f64_sos", CASCADE_q24, cheby1_cascade_order6_cut2000_f64_sos, 3); break;
+    case 892: benchmark_cascade_q12(fp, "cheby1_cascade_order6_cut2000_f64_sos", CASCADE_q12, cheby1_cascade_order6_cut2000_f64_sos, 3); break;
+    case 893: benchmark_sos_q24(fp, "cheby1_cascade_order6_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby1_cascade_order6_cut2000_f64_sos, 3); break;
+    case 894: benchmark_sos_q12(fp, "cheby1_cascade_order6_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby1_cascade_order6_cut2000_f64_sos, 3); break;
+    case 895: benchmark_sos_q24(fp, "cheby1_cascade_order6_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby1_cascade_order6_cut2000_f64_sos, 3); break;
+    case 896: benchmark_sos_q12(fp, "cheby1_cascade_order6_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby1_cascade_order6_cut2000_f64_sos, 3); break;
+    case 897: benchmark_sos_q24(fp, "cheby1_cascade_order6_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby1_cascade_order6_cut2000_f64_sos, 3); break;
+    case 898: benchmark_sos_q12(fp, "cheby1_cascade_order6_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby1_cascade_order6_cut2000_f64_sos, 3); break;
+    case 899: benchmark_sos_bfp16(fp, "cheby1_cascade_order6_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, cheby1_cascade_order6_cut2000_f64_sos, 3); break;
+
+    case 900: benchmark_cascade_q24(fp, "cheby1_cascade_order6_cut5000_f64_sos", CASCADE_q24, cheby1_cascade_order6_cut5000_f64_sos, 3); break;
+    case 901: benchmark_cascade_q12(fp, "cheby1_cascade_order6_cut5000_f64_sos", CASCADE_q12, cheby1_cascade_order6_cut5000_f64_sos, 3); break;
+    case 902: benchmark_sos_q24(fp, "cheby1_cascade_order6_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby1_cascade_order6_cut5000_f64_sos, 3); break;
+    case 903: benchmark_sos_q12(fp, "cheby1_cascade_order6_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby1_cascade_order6_cut5000_f64_sos, 3); break;
+    case 904: benchmark_sos_q24(fp, "cheby1_cascade_order6_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby1_cascade_order6_cut5000_f64_sos, 3); break;
+    case 905: benchmark_sos_q12(fp, "cheby1_cascade_order6_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby1_cascade_order6_cut5000_f64_sos, 3); break;
+    case 906: benchmark_sos_q24(fp, "cheby1_cascade_order6_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby1_cascade_order6_cut5000_f64_sos, 3); break;
+    case 907: benchmark_sos_q12(fp, "cheby1_cascade_order6_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby1_cascade_order6_cut5000_f64_sos, 3); break;
+    case 908: benchmark_sos_bfp16(fp, "cheby1_cascade_order6_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, cheby1_cascade_order6_cut5000_f64_sos, 3); break;
+
+    case 909: benchmark_cascade_q24(fp, "cheby1_cascade_order8_cut1000_f64_sos", CASCADE_q24, cheby1_cascade_order8_cut1000_f64_sos, 4); break;
+    case 910: benchmark_cascade_q12(fp, "cheby1_cascade_order8_cut1000_f64_sos", CASCADE_q12, cheby1_cascade_order8_cut1000_f64_sos, 4); break;
+    case 911: benchmark_sos_q24(fp, "cheby1_cascade_order8_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby1_cascade_order8_cut1000_f64_sos, 4); break;
+    case 912: benchmark_sos_q12(fp, "cheby1_cascade_order8_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby1_cascade_order8_cut1000_f64_sos, 4); break;
+    case 913: benchmark_sos_q24(fp, "cheby1_cascade_order8_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby1_cascade_order8_cut1000_f64_sos, 4); break;
+    case 914: benchmark_sos_q12(fp, "cheby1_cascade_order8_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby1_cascade_order8_cut1000_f64_sos, 4); break;
+    case 915: benchmark_sos_q24(fp, "cheby1_cascade_order8_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby1_cascade_order8_cut1000_f64_sos, 4); break;
+    case 916: benchmark_sos_q12(fp, "cheby1_cascade_order8_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby1_cascade_order8_cut1000_f64_sos, 4); break;
+    case 917: benchmark_sos_bfp16(fp, "cheby1_cascade_order8_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, cheby1_cascade_order8_cut1000_f64_sos, 4); break;
+
+    case 918: benchmark_cascade_q24(fp, "cheby1_cascade_order8_cut2000_f64_sos", CASCADE_q24, cheby1_cascade_order8_cut2000_f64_sos, 4); break;
+    case 919: benchmark_cascade_q12(fp, "cheby1_cascade_order8_cut2000_f64_sos", CASCADE_q12, cheby1_cascade_order8_cut2000_f64_sos, 4); break;
+    case 920: benchmark_sos_q24(fp, "cheby1_cascade_order8_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby1_cascade_order8_cut2000_f64_sos, 4); break;
+    case 921: benchmark_sos_q12(fp, "cheby1_cascade_order8_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby1_cascade_order8_cut2000_f64_sos, 4); break;
+    case 922: benchmark_sos_q24(fp, "cheby1_cascade_order8_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby1_cascade_order8_cut2000_f64_sos, 4); break;
+    case 923: benchmark_sos_q12(fp, "cheby1_cascade_order8_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby1_cascade_order8_cut2000_f64_sos, 4); break;
+    case 924: benchmark_sos_q24(fp, "cheby1_cascade_order8_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby1_cascade_order8_cut2000_f64_sos, 4); break;
+    case 925: benchmark_sos_q12(fp, "cheby1_cascade_order8_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby1_cascade_order8_cut2000_f64_sos, 4); break;
+    case 926: benchmark_sos_bfp16(fp, "cheby1_cascade_order8_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, cheby1_cascade_order8_cut2000_f64_sos, 4); break;
+
+    case 927: benchmark_cascade_q24(fp, "cheby1_cascade_order8_cut5000_f64_sos", CASCADE_q24, cheby1_cascade_order8_cut5000_f64_sos, 4); break;
+    case 928: benchmark_cascade_q12(fp, "cheby1_cascade_order8_cut5000_f64_sos", CASCADE_q12, cheby1_cascade_order8_cut5000_f64_sos, 4); break;
+    case 929: benchmark_sos_q24(fp, "cheby1_cascade_order8_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby1_cascade_order8_cut5000_f64_sos, 4); break;
+    case 930: benchmark_sos_q12(fp, "cheby1_cascade_order8_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby1_cascade_order8_cut5000_f64_sos, 4); break;
+    case 931: benchmark_sos_q24(fp, "cheby1_cascade_order8_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby1_cascade_order8_cut5000_f64_sos, 4); break;
+    case 932: benchmark_sos_q12(fp, "cheby1_cascade_order8_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby1_cascade_order8_cut5000_f64_sos, 4); break;
+    case 933: benchmark_sos_q24(fp, "cheby1_cascade_order8_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby1_cascade_order8_cut5000_f64_sos, 4); break;
+    case 934: benchmark_sos_q12(fp, "cheby1_cascade_order8_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby1_cascade_order8_cut5000_f64_sos, 4); break;
+    case 935: benchmark_sos_bfp16(fp, "cheby1_cascade_order8_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, cheby1_cascade_order8_cut5000_f64_sos, 4); break;
+
+    case 936: benchmark_cascade_q24(fp, "cheby2_cascade_order2_cut1000_f64_sos", CASCADE_q24, cheby2_cascade_order2_cut1000_f64_sos, 1); break;
+    case 937: benchmark_cascade_q12(fp, "cheby2_cascade_order2_cut1000_f64_sos", CASCADE_q12, cheby2_cascade_order2_cut1000_f64_sos, 1); break;
+    case 938: benchmark_sos_q24(fp, "cheby2_cascade_order2_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby2_cascade_order2_cut1000_f64_sos, 1); break;
+    case 939: benchmark_sos_q12(fp, "cheby2_cascade_order2_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby2_cascade_order2_cut1000_f64_sos, 1); break;
+    case 940: benchmark_sos_q24(fp, "cheby2_cascade_order2_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby2_cascade_order2_cut1000_f64_sos, 1); break;
+    case 941: benchmark_sos_q12(fp, "cheby2_cascade_order2_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby2_cascade_order2_cut1000_f64_sos, 1); break;
+    case 942: benchmark_sos_q24(fp, "cheby2_cascade_order2_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby2_cascade_order2_cut1000_f64_sos, 1); break;
+    case 943: benchmark_sos_q12(fp, "cheby2_cascade_order2_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby2_cascade_order2_cut1000_f64_sos, 1); break;
+    case 944: benchmark_sos_bfp16(fp, "cheby2_cascade_order2_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, cheby2_cascade_order2_cut1000_f64_sos, 1); break;
+
+    case 945: benchmark_cascade_q24(fp, "cheby2_cascade_order2_cut2000_f64_sos", CASCADE_q24, cheby2_cascade_order2_cut2000_f64_sos, 1); break;
+    case 946: benchmark_cascade_q12(fp, "cheby2_cascade_order2_cut2000_f64_sos", CASCADE_q12, cheby2_cascade_order2_cut2000_f64_sos, 1); break;
+    case 947: benchmark_sos_q24(fp, "cheby2_cascade_order2_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby2_cascade_order2_cut2000_f64_sos, 1); break;
+    case 948: benchmark_sos_q12(fp, "cheby2_cascade_order2_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby2_cascade_order2_cut2000_f64_sos, 1); break;
+    case 949: benchmark_sos_q24(fp, "cheby2_cascade_order2_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby2_cascade_order2_cut2000_f64_sos, 1); break;
+    case 950: benchmark_sos_q12(fp, "cheby2_cascade_order2_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby2_cascade_order2_cut2000_f64_sos, 1); break;
+    case 951: benchmark_sos_q24(fp, "cheby2_cascade_order2_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby2_cascade_order2_cut2000_f64_sos, 1); break;
+    case 952: benchmark_sos_q12(fp, "cheby2_cascade_order2_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby2_cascade_order2_cut2000_f64_sos, 1); break;
+    case 953: benchmark_sos_bfp16(fp, "cheby2_cascade_order2_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, cheby2_cascade_order2_cut2000_f64_sos, 1); break;
+
+    case 954: benchmark_cascade_q24(fp, "cheby2_cascade_order2_cut5000_f64_sos", CASCADE_q24, cheby2_cascade_order2_cut5000_f64_sos, 1); break;
+    case 955: benchmark_cascade_q12(fp, "cheby2_cascade_order2_cut5000_f64_sos", CASCADE_q12, cheby2_cascade_order2_cut5000_f64_sos, 1); break;
+    case 956: benchmark_sos_q24(fp, "cheby2_cascade_order2_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby2_cascade_order2_cut5000_f64_sos, 1); break;
+    case 957: benchmark_sos_q12(fp, "cheby2_cascade_order2_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby2_cascade_order2_cut5000_f64_sos, 1); break;
+    case 958: benchmark_sos_q24(fp, "cheby2_cascade_order2_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby2_cascade_order2_cut5000_f64_sos, 1); break;
+    case 959: benchmark_sos_q12(fp, "cheby2_cascade_order2_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby2_cascade_order2_cut5000_f64_sos, 1); break;
+    case 960: benchmark_sos_q24(fp, "cheby2_cascade_order2_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby2_cascade_order2_cut5000_f64_sos, 1); break;
+    case 961: benchmark_sos_q12(fp, "cheby2_cascade_order2_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby2_cascade_order2_cut5000_f64_sos, 1); break;
+    case 962: benchmark_sos_bfp16(fp, "cheby2_cascade_order2_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, cheby2_cascade_order2_cut5000_f64_sos, 1); break;
+
+    case 963: benchmark_cascade_q24(fp, "cheby2_cascade_order4_cut1000_f64_sos", CASCADE_q24, cheby2_cascade_order4_cut1000_f64_sos, 2); break;
+    case 964: benchmark_cascade_q12(fp, "cheby2_cascade_order4_cut1000_f64_sos", CASCADE_q12, cheby2_cascade_order4_cut1000_f64_sos, 2); break;
+    case 965: benchmark_sos_q24(fp, "cheby2_cascade_order4_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby2_cascade_order4_cut1000_f64_sos, 2); break;
+    case 966: benchmark_sos_q12(fp, "cheby2_cascade_order4_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby2_cascade_order4_cut1000_f64_sos, 2); break;
+    case 967: benchmark_sos_q24(fp, "cheby2_cascade_order4_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby2_cascade_order4_cut1000_f64_sos, 2); break;
+    case 968: benchmark_sos_q12(fp, "cheby2_cascade_order4_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby2_cascade_order4_cut1000_f64_sos, 2); break;
+    case 969: benchmark_sos_q24(fp, "cheby2_cascade_order4_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby2_cascade_order4_cut1000_f64_sos, 2); break;
+    case 970: benchmark_sos_q12(fp, "cheby2_cascade_order4_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby2_cascade_order4_cut1000_f64_sos, 2); break;
+    case 971: benchmark_sos_bfp16(fp, "cheby2_cascade_order4_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, cheby2_cascade_order4_cut1000_f64_sos, 2); break;
+
+    case 972: benchmark_cascade_q24(fp, "cheby2_cascade_order4_cut2000_f64_sos", CASCADE_q24, cheby2_cascade_order4_cut2000_f64_sos, 2); break;
+    case 973: benchmark_cascade_q12(fp, "cheby2_cascade_order4_cut2000_f64_sos", CASCADE_q12, cheby2_cascade_order4_cut2000_f64_sos, 2); break;
+    case 974: benchmark_sos_q24(fp, "cheby2_cascade_order4_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby2_cascade_order4_cut2000_f64_sos, 2); break;
+    case 975: benchmark_sos_q12(fp, "cheby2_cascade_order4_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby2_cascade_order4_cut2000_f64_sos, 2); break;
+    case 976: benchmark_sos_q24(fp, "cheby2_cascade_order4_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby2_cascade_order4_cut2000_f64_sos, 2); break;
+    case 977: benchmark_sos_q12(fp, "cheby2_cascade_order4_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby2_cascade_order4_cut2000_f64_sos, 2); break;
+    case 978: benchmark_sos_q24(fp, "cheby2_cascade_order4_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby2_cascade_order4_cut2000_f64_sos, 2); break;
+    case 979: benchmark_sos_q12(fp, "cheby2_cascade_order4_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby2_cascade_order4_cut2000_f64_sos, 2); break;
+    case 980: benchmark_sos_bfp16(fp, "cheby2_cascade_order4_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, cheby2_cascade_order4_cut2000_f64_sos, 2); break;
+
+    case 981: benchmark_cascade_q24(fp, "cheby2_cascade_order4_cut5000_f64_sos", CASCADE_q24, cheby2_cascade_order4_cut5000_f64_sos, 2); break;
+    case 982: benchmark_cascade_q12(fp, "cheby2_cascade_order4_cut5000_f64_sos", CASCADE_q12, cheby2_cascade_order4_cut5000_f64_sos, 2); break;
+    case 983: benchmark_sos_q24(fp, "cheby2_cascade_order4_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby2_cascade_order4_cut5000_f64_sos, 2); break;
+    case 984: benchmark_sos_q12(fp, "cheby2_cascade_order4_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby2_cascade_order4_cut5000_f64_sos, 2); break;
+    case 985: benchmark_sos_q24(fp, "cheby2_cascade_order4_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby2_cascade_order4_cut5000_f64_sos, 2); break;
+    case 986: benchmark_sos_q12(fp, "cheby2_cascade_order4_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby2_cascade_order4_cut5000_f64_sos, 2); break;
+    case 987: benchmark_sos_q24(fp, "cheby2_cascade_order4_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby2_cascade_order4_cut5000_f64_sos, 2); break;
+    case 988: benchmark_sos_q12(fp, "cheby2_cascade_order4_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby2_cascade_order4_cut5000_f64_sos, 2); break;
+    case 989: benchmark_sos_bfp16(fp, "cheby2_cascade_order4_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, cheby2_cascade_order4_cut5000_f64_sos, 2); break;
+
+    case 990: benchmark_cascade_q24(fp, "cheby2_cascade_order6_cut1000_f64_sos", CASCADE_q24, cheby2_cascade_order6_cut1000_f64_sos, 3); break;
+    case 991: benchmark_cascade_q12(fp, "cheby2_cascade_order6_cut1000_f64_sos", CASCADE_q12, cheby2_cascade_order6_cut1000_f64_sos, 3); break;
+    case 992: benchmark_sos_q24(fp, "cheby2_cascade_order6_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby2_cascade_order6_cut1000_f64_sos, 3); break;
+    case 993: benchmark_sos_q12(fp, "cheby2_cascade_order6_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby2_cascade_order6_cut1000_f64_sos, 3); break;
+    case 994: benchmark_sos_q24(fp, "cheby2_cascade_order6_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby2_cascade_order6_cut1000_f64_sos, 3); break;
+    case 995: benchmark_sos_q12(fp, "cheby2_cascade_order6_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby2_cascade_order6_cut1000_f64_sos, 3); break;
+    case 996: benchmark_sos_q24(fp, "cheby2_cascade_order6_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby2_cascade_order6_cut1000_f64_sos, 3); break;
+    case 997: benchmark_sos_q12(fp, "cheby2_cascade_order6_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby2_cascade_order6_cut1000_f64_sos, 3); break;
+    case 998: benchmark_sos_bfp16(fp, "cheby2_cascade_order6_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, cheby2_cascade_order6_cut1000_f64_sos, 3); break;
+
+    case 999: benchmark_cascade_q24(fp, "cheby2_cascade_order6_cut2000_f64_sos", CASCADE_q24, cheby2_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1000: benchmark_cascade_q12(fp, "cheby2_cascade_order6_cut2000_f64_sos", CASCADE_q12, cheby2_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1001: benchmark_sos_q24(fp, "cheby2_cascade_order6_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby2_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1002: benchmark_sos_q12(fp, "cheby2_cascade_order6_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby2_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1003: benchmark_sos_q24(fp, "cheby2_cascade_order6_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby2_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1004: benchmark_sos_q12(fp, "cheby2_cascade_order6_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby2_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1005: benchmark_sos_q24(fp, "cheby2_cascade_order6_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby2_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1006: benchmark_sos_q12(fp, "cheby2_cascade_order6_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby2_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1007: benchmark_sos_bfp16(fp, "cheby2_cascade_order6_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, cheby2_cascade_order6_cut2000_f64_sos, 3); break;
+
+    case 1008: benchmark_cascade_q24(fp, "cheby2_cascade_order6_cut5000_f64_sos", CASCADE_q24, cheby2_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1009: benchmark_cascade_q12(fp, "cheby2_cascade_order6_cut5000_f64_sos", CASCADE_q12, cheby2_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1010: benchmark_sos_q24(fp, "cheby2_cascade_order6_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby2_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1011: benchmark_sos_q12(fp, "cheby2_cascade_order6_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby2_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1012: benchmark_sos_q24(fp, "cheby2_cascade_order6_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby2_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1013: benchmark_sos_q12(fp, "cheby2_cascade_order6_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby2_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1014: benchmark_sos_q24(fp, "cheby2_cascade_order6_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby2_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1015: benchmark_sos_q12(fp, "cheby2_cascade_order6_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby2_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1016: benchmark_sos_bfp16(fp, "cheby2_cascade_order6_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, cheby2_cascade_order6_cut5000_f64_sos, 3); break;
+
+    case 1017: benchmark_cascade_q24(fp, "cheby2_cascade_order8_cut1000_f64_sos", CASCADE_q24, cheby2_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1018: benchmark_cascade_q12(fp, "cheby2_cascade_order8_cut1000_f64_sos", CASCADE_q12, cheby2_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1019: benchmark_sos_q24(fp, "cheby2_cascade_order8_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby2_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1020: benchmark_sos_q12(fp, "cheby2_cascade_order8_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby2_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1021: benchmark_sos_q24(fp, "cheby2_cascade_order8_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby2_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1022: benchmark_sos_q12(fp, "cheby2_cascade_order8_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby2_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1023: benchmark_sos_q24(fp, "cheby2_cascade_order8_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby2_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1024: benchmark_sos_q12(fp, "cheby2_cascade_order8_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby2_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1025: benchmark_sos_bfp16(fp, "cheby2_cascade_order8_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, cheby2_cascade_order8_cut1000_f64_sos, 4); break;
+
+    case 1026: benchmark_cascade_q24(fp, "cheby2_cascade_order8_cut2000_f64_sos", CASCADE_q24, cheby2_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1027: benchmark_cascade_q12(fp, "cheby2_cascade_order8_cut2000_f64_sos", CASCADE_q12, cheby2_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1028: benchmark_sos_q24(fp, "cheby2_cascade_order8_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby2_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1029: benchmark_sos_q12(fp, "cheby2_cascade_order8_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby2_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1030: benchmark_sos_q24(fp, "cheby2_cascade_order8_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby2_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1031: benchmark_sos_q12(fp, "cheby2_cascade_order8_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby2_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1032: benchmark_sos_q24(fp, "cheby2_cascade_order8_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby2_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1033: benchmark_sos_q12(fp, "cheby2_cascade_order8_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby2_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1034: benchmark_sos_bfp16(fp, "cheby2_cascade_order8_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, cheby2_cascade_order8_cut2000_f64_sos, 4); break;
+
+    case 1035: benchmark_cascade_q24(fp, "cheby2_cascade_order8_cut5000_f64_sos", CASCADE_q24, cheby2_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1036: benchmark_cascade_q12(fp, "cheby2_cascade_order8_cut5000_f64_sos", CASCADE_q12, cheby2_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1037: benchmark_sos_q24(fp, "cheby2_cascade_order8_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, cheby2_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1038: benchmark_sos_q12(fp, "cheby2_cascade_order8_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, cheby2_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1039: benchmark_sos_q24(fp, "cheby2_cascade_order8_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, cheby2_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1040: benchmark_sos_q12(fp, "cheby2_cascade_order8_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, cheby2_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1041: benchmark_sos_q24(fp, "cheby2_cascade_order8_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, cheby2_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1042: benchmark_sos_q12(fp, "cheby2_cascade_order8_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, cheby2_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1043: benchmark_sos_bfp16(fp, "cheby2_cascade_order8_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, cheby2_cascade_order8_cut5000_f64_sos, 4); break;
+
+    case 1044: benchmark_cascade_q24(fp, "ellip_cascade_order2_cut1000_f64_sos", CASCADE_q24, ellip_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1045: benchmark_cascade_q12(fp, "ellip_cascade_order2_cut1000_f64_sos", CASCADE_q12, ellip_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1046: benchmark_sos_q24(fp, "ellip_cascade_order2_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, ellip_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1047: benchmark_sos_q12(fp, "ellip_cascade_order2_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, ellip_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1048: benchmark_sos_q24(fp, "ellip_cascade_order2_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, ellip_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1049: benchmark_sos_q12(fp, "ellip_cascade_order2_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, ellip_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1050: benchmark_sos_q24(fp, "ellip_cascade_order2_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, ellip_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1051: benchmark_sos_q12(fp, "ellip_cascade_order2_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, ellip_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1052: benchmark_sos_bfp16(fp, "ellip_cascade_order2_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, ellip_cascade_order2_cut1000_f64_sos, 1); break;
+
+    case 1053: benchmark_cascade_q24(fp, "ellip_cascade_order2_cut2000_f64_sos", CASCADE_q24, ellip_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1054: benchmark_cascade_q12(fp, "ellip_cascade_order2_cut2000_f64_sos", CASCADE_q12, ellip_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1055: benchmark_sos_q24(fp, "ellip_cascade_order2_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, ellip_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1056: benchmark_sos_q12(fp, "ellip_cascade_order2_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, ellip_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1057: benchmark_sos_q24(fp, "ellip_cascade_order2_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, ellip_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1058: benchmark_sos_q12(fp, "ellip_cascade_order2_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, ellip_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1059: benchmark_sos_q24(fp, "ellip_cascade_order2_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, ellip_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1060: benchmark_sos_q12(fp, "ellip_cascade_order2_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, ellip_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1061: benchmark_sos_bfp16(fp, "ellip_cascade_order2_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, ellip_cascade_order2_cut2000_f64_sos, 1); break;
+
+    case 1062: benchmark_cascade_q24(fp, "ellip_cascade_order2_cut5000_f64_sos", CASCADE_q24, ellip_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1063: benchmark_cascade_q12(fp, "ellip_cascade_order2_cut5000_f64_sos", CASCADE_q12, ellip_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1064: benchmark_sos_q24(fp, "ellip_cascade_order2_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, ellip_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1065: benchmark_sos_q12(fp, "ellip_cascade_order2_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, ellip_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1066: benchmark_sos_q24(fp, "ellip_cascade_order2_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, ellip_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1067: benchmark_sos_q12(fp, "ellip_cascade_order2_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, ellip_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1068: benchmark_sos_q24(fp, "ellip_cascade_order2_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, ellip_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1069: benchmark_sos_q12(fp, "ellip_cascade_order2_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, ellip_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1070: benchmark_sos_bfp16(fp, "ellip_cascade_order2_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, ellip_cascade_order2_cut5000_f64_sos, 1); break;
+
+    case 1071: benchmark_cascade_q24(fp, "ellip_cascade_order4_cut1000_f64_sos", CASCADE_q24, ellip_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1072: benchmark_cascade_q12(fp, "ellip_cascade_order4_cut1000_f64_sos", CASCADE_q12, ellip_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1073: benchmark_sos_q24(fp, "ellip_cascade_order4_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, ellip_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1074: benchmark_sos_q12(fp, "ellip_cascade_order4_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, ellip_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1075: benchmark_sos_q24(fp, "ellip_cascade_order4_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, ellip_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1076: benchmark_sos_q12(fp, "ellip_cascade_order4_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, ellip_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1077: benchmark_sos_q24(fp, "ellip_cascade_order4_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, ellip_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1078: benchmark_sos_q12(fp, "ellip_cascade_order4_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, ellip_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1079: benchmark_sos_bfp16(fp, "ellip_cascade_order4_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, ellip_cascade_order4_cut1000_f64_sos, 2); break;
+
+    case 1080: benchmark_cascade_q24(fp, "ellip_cascade_order4_cut2000_f64_sos", CASCADE_q24, ellip_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1081: benchmark_cascade_q12(fp, "ellip_cascade_order4_cut2000_f64_sos", CASCADE_q12, ellip_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1082: benchmark_sos_q24(fp, "ellip_cascade_order4_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, ellip_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1083: benchmark_sos_q12(fp, "ellip_cascade_order4_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, ellip_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1084: benchmark_sos_q24(fp, "ellip_cascade_order4_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, ellip_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1085: benchmark_sos_q12(fp, "ellip_cascade_order4_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, ellip_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1086: benchmark_sos_q24(fp, "ellip_cascade_order4_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, ellip_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1087: benchmark_sos_q12(fp, "ellip_cascade_order4_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, ellip_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1088: benchmark_sos_bfp16(fp, "ellip_cascade_order4_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, ellip_cascade_order4_cut2000_f64_sos, 2); break;
+
+    case 1089: benchmark_cascade_q24(fp, "ellip_cascade_order4_cut5000_f64_sos", CASCADE_q24, ellip_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1090: benchmark_cascade_q12(fp, "ellip_cascade_order4_cut5000_f64_sos", CASCADE_q12, ellip_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1091: benchmark_sos_q24(fp, "ellip_cascade_order4_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, ellip_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1092: benchmark_sos_q12(fp, "ellip_cascade_order4_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, ellip_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1093: benchmark_sos_q24(fp, "ellip_cascade_order4_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, ellip_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1094: benchmark_sos_q12(fp, "ellip_cascade_order4_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, ellip_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1095: benchmark_sos_q24(fp, "ellip_cascade_order4_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, ellip_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1096: benchmark_sos_q12(fp, "ellip_cascade_order4_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, ellip_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1097: benchmark_sos_bfp16(fp, "ellip_cascade_order4_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, ellip_cascade_order4_cut5000_f64_sos, 2); break;
+
+    case 1098: benchmark_cascade_q24(fp, "ellip_cascade_order6_cut1000_f64_sos", CASCADE_q24, ellip_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1099: benchmark_cascade_q12(fp, "ellip_cascade_order6_cut1000_f64_sos", CASCADE_q12, ellip_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1100: benchmark_sos_q24(fp, "ellip_cascade_order6_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, ellip_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1101: benchmark_sos_q12(fp, "ellip_cascade_order6_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, ellip_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1102: benchmark_sos_q24(fp, "ellip_cascade_order6_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, ellip_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1103: benchmark_sos_q12(fp, "ellip_cascade_order6_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, ellip_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1104: benchmark_sos_q24(fp, "ellip_cascade_order6_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, ellip_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1105: benchmark_sos_q12(fp, "ellip_cascade_order6_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, ellip_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1106: benchmark_sos_bfp16(fp, "ellip_cascade_order6_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, ellip_cascade_order6_cut1000_f64_sos, 3); break;
+
+    case 1107: benchmark_cascade_q24(fp, "ellip_cascade_order6_cut2000_f64_sos", CASCADE_q24, ellip_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1108: benchmark_cascade_q12(fp, "ellip_cascade_order6_cut2000_f64_sos", CASCADE_q12, ellip_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1109: benchmark_sos_q24(fp, "ellip_cascade_order6_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, ellip_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1110: benchmark_sos_q12(fp, "ellip_cascade_order6_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, ellip_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1111: benchmark_sos_q24(fp, "ellip_cascade_order6_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, ellip_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1112: benchmark_sos_q12(fp, "ellip_cascade_order6_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, ellip_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1113: benchmark_sos_q24(fp, "ellip_cascade_order6_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, ellip_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1114: benchmark_sos_q12(fp, "ellip_cascade_order6_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, ellip_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1115: benchmark_sos_bfp16(fp, "ellip_cascade_order6_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, ellip_cascade_order6_cut2000_f64_sos, 3); break;
+
+    case 1116: benchmark_cascade_q24(fp, "ellip_cascade_order6_cut5000_f64_sos", CASCADE_q24, ellip_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1117: benchmark_cascade_q12(fp, "ellip_cascade_order6_cut5000_f64_sos", CASCADE_q12, ellip_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1118: benchmark_sos_q24(fp, "ellip_cascade_order6_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, ellip_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1119: benchmark_sos_q12(fp, "ellip_cascade_order6_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, ellip_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1120: benchmark_sos_q24(fp, "ellip_cascade_order6_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, ellip_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1121: benchmark_sos_q12(fp, "ellip_cascade_order6_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, ellip_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1122: benchmark_sos_q24(fp, "ellip_cascade_order6_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, ellip_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1123: benchmark_sos_q12(fp, "ellip_cascade_order6_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, ellip_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1124: benchmark_sos_bfp16(fp, "ellip_cascade_order6_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, ellip_cascade_order6_cut5000_f64_sos, 3); break;
+
+    case 1125: benchmark_cascade_q24(fp, "ellip_cascade_order8_cut1000_f64_sos", CASCADE_q24, ellip_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1126: benchmark_cascade_q12(fp, "ellip_cascade_order8_cut1000_f64_sos", CASCADE_q12, ellip_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1127: benchmark_sos_q24(fp, "ellip_cascade_order8_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, ellip_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1128: benchmark_sos_q12(fp, "ellip_cascade_order8_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, ellip_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1129: benchmark_sos_q24(fp, "ellip_cascade_order8_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, ellip_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1130: benchmark_sos_q12(fp, "ellip_cascade_order8_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, ellip_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1131: benchmark_sos_q24(fp, "ellip_cascade_order8_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, ellip_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1132: benchmark_sos_q12(fp, "ellip_cascade_order8_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, ellip_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1133: benchmark_sos_bfp16(fp, "ellip_cascade_order8_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, ellip_cascade_order8_cut1000_f64_sos, 4); break;
+
+    case 1134: benchmark_cascade_q24(fp, "ellip_cascade_order8_cut2000_f64_sos", CASCADE_q24, ellip_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1135: benchmark_cascade_q12(fp, "ellip_cascade_order8_cut2000_f64_sos", CASCADE_q12, ellip_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1136: benchmark_sos_q24(fp, "ellip_cascade_order8_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, ellip_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1137: benchmark_sos_q12(fp, "ellip_cascade_order8_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, ellip_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1138: benchmark_sos_q24(fp, "ellip_cascade_order8_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, ellip_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1139: benchmark_sos_q12(fp, "ellip_cascade_order8_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, ellip_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1140: benchmark_sos_q24(fp, "ellip_cascade_order8_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, ellip_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1141: benchmark_sos_q12(fp, "ellip_cascade_order8_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, ellip_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1142: benchmark_sos_bfp16(fp, "ellip_cascade_order8_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, ellip_cascade_order8_cut2000_f64_sos, 4); break;
+
+    case 1143: benchmark_cascade_q24(fp, "ellip_cascade_order8_cut5000_f64_sos", CASCADE_q24, ellip_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1144: benchmark_cascade_q12(fp, "ellip_cascade_order8_cut5000_f64_sos", CASCADE_q12, ellip_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1145: benchmark_sos_q24(fp, "ellip_cascade_order8_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, ellip_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1146: benchmark_sos_q12(fp, "ellip_cascade_order8_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, ellip_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1147: benchmark_sos_q24(fp, "ellip_cascade_order8_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, ellip_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1148: benchmark_sos_q12(fp, "ellip_cascade_order8_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, ellip_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1149: benchmark_sos_q24(fp, "ellip_cascade_order8_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, ellip_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1150: benchmark_sos_q12(fp, "ellip_cascade_order8_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, ellip_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1151: benchmark_sos_bfp16(fp, "ellip_cascade_order8_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, ellip_cascade_order8_cut5000_f64_sos, 4); break;
+
+    case 1152: benchmark_cascade_q24(fp, "bessel_cascade_order2_cut1000_f64_sos", CASCADE_q24, bessel_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1153: benchmark_cascade_q12(fp, "bessel_cascade_order2_cut1000_f64_sos", CASCADE_q12, bessel_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1154: benchmark_sos_q24(fp, "bessel_cascade_order2_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, bessel_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1155: benchmark_sos_q12(fp, "bessel_cascade_order2_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, bessel_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1156: benchmark_sos_q24(fp, "bessel_cascade_order2_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, bessel_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1157: benchmark_sos_q12(fp, "bessel_cascade_order2_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, bessel_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1158: benchmark_sos_q24(fp, "bessel_cascade_order2_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, bessel_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1159: benchmark_sos_q12(fp, "bessel_cascade_order2_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, bessel_cascade_order2_cut1000_f64_sos, 1); break;
+    case 1160: benchmark_sos_bfp16(fp, "bessel_cascade_order2_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, bessel_cascade_order2_cut1000_f64_sos, 1); break;
+
+    case 1161: benchmark_cascade_q24(fp, "bessel_cascade_order2_cut2000_f64_sos", CASCADE_q24, bessel_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1162: benchmark_cascade_q12(fp, "bessel_cascade_order2_cut2000_f64_sos", CASCADE_q12, bessel_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1163: benchmark_sos_q24(fp, "bessel_cascade_order2_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, bessel_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1164: benchmark_sos_q12(fp, "bessel_cascade_order2_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, bessel_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1165: benchmark_sos_q24(fp, "bessel_cascade_order2_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, bessel_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1166: benchmark_sos_q12(fp, "bessel_cascade_order2_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, bessel_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1167: benchmark_sos_q24(fp, "bessel_cascade_order2_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, bessel_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1168: benchmark_sos_q12(fp, "bessel_cascade_order2_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, bessel_cascade_order2_cut2000_f64_sos, 1); break;
+    case 1169: benchmark_sos_bfp16(fp, "bessel_cascade_order2_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, bessel_cascade_order2_cut2000_f64_sos, 1); break;
+
+    case 1170: benchmark_cascade_q24(fp, "bessel_cascade_order2_cut5000_f64_sos", CASCADE_q24, bessel_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1171: benchmark_cascade_q12(fp, "bessel_cascade_order2_cut5000_f64_sos", CASCADE_q12, bessel_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1172: benchmark_sos_q24(fp, "bessel_cascade_order2_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, bessel_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1173: benchmark_sos_q12(fp, "bessel_cascade_order2_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, bessel_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1174: benchmark_sos_q24(fp, "bessel_cascade_order2_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, bessel_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1175: benchmark_sos_q12(fp, "bessel_cascade_order2_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, bessel_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1176: benchmark_sos_q24(fp, "bessel_cascade_order2_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, bessel_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1177: benchmark_sos_q12(fp, "bessel_cascade_order2_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, bessel_cascade_order2_cut5000_f64_sos, 1); break;
+    case 1178: benchmark_sos_bfp16(fp, "bessel_cascade_order2_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, bessel_cascade_order2_cut5000_f64_sos, 1); break;
+
+    case 1179: benchmark_cascade_q24(fp, "bessel_cascade_order4_cut1000_f64_sos", CASCADE_q24, bessel_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1180: benchmark_cascade_q12(fp, "bessel_cascade_order4_cut1000_f64_sos", CASCADE_q12, bessel_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1181: benchmark_sos_q24(fp, "bessel_cascade_order4_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, bessel_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1182: benchmark_sos_q12(fp, "bessel_cascade_order4_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, bessel_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1183: benchmark_sos_q24(fp, "bessel_cascade_order4_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, bessel_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1184: benchmark_sos_q12(fp, "bessel_cascade_order4_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, bessel_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1185: benchmark_sos_q24(fp, "bessel_cascade_order4_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, bessel_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1186: benchmark_sos_q12(fp, "bessel_cascade_order4_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, bessel_cascade_order4_cut1000_f64_sos, 2); break;
+    case 1187: benchmark_sos_bfp16(fp, "bessel_cascade_order4_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, bessel_cascade_order4_cut1000_f64_sos, 2); break;
+
+    case 1188: benchmark_cascade_q24(fp, "bessel_cascade_order4_cut2000_f64_sos", CASCADE_q24, bessel_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1189: benchmark_cascade_q12(fp, "bessel_cascade_order4_cut2000_f64_sos", CASCADE_q12, bessel_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1190: benchmark_sos_q24(fp, "bessel_cascade_order4_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, bessel_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1191: benchmark_sos_q12(fp, "bessel_cascade_order4_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, bessel_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1192: benchmark_sos_q24(fp, "bessel_cascade_order4_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, bessel_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1193: benchmark_sos_q12(fp, "bessel_cascade_order4_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, bessel_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1194: benchmark_sos_q24(fp, "bessel_cascade_order4_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, bessel_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1195: benchmark_sos_q12(fp, "bessel_cascade_order4_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, bessel_cascade_order4_cut2000_f64_sos, 2); break;
+    case 1196: benchmark_sos_bfp16(fp, "bessel_cascade_order4_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, bessel_cascade_order4_cut2000_f64_sos, 2); break;
+
+    case 1197: benchmark_cascade_q24(fp, "bessel_cascade_order4_cut5000_f64_sos", CASCADE_q24, bessel_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1198: benchmark_cascade_q12(fp, "bessel_cascade_order4_cut5000_f64_sos", CASCADE_q12, bessel_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1199: benchmark_sos_q24(fp, "bessel_cascade_order4_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, bessel_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1200: benchmark_sos_q12(fp, "bessel_cascade_order4_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, bessel_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1201: benchmark_sos_q24(fp, "bessel_cascade_order4_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, bessel_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1202: benchmark_sos_q12(fp, "bessel_cascade_order4_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, bessel_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1203: benchmark_sos_q24(fp, "bessel_cascade_order4_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, bessel_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1204: benchmark_sos_q12(fp, "bessel_cascade_order4_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, bessel_cascade_order4_cut5000_f64_sos, 2); break;
+    case 1205: benchmark_sos_bfp16(fp, "bessel_cascade_order4_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, bessel_cascade_order4_cut5000_f64_sos, 2); break;
+
+    case 1206: benchmark_cascade_q24(fp, "bessel_cascade_order6_cut1000_f64_sos", CASCADE_q24, bessel_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1207: benchmark_cascade_q12(fp, "bessel_cascade_order6_cut1000_f64_sos", CASCADE_q12, bessel_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1208: benchmark_sos_q24(fp, "bessel_cascade_order6_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, bessel_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1209: benchmark_sos_q12(fp, "bessel_cascade_order6_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, bessel_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1210: benchmark_sos_q24(fp, "bessel_cascade_order6_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, bessel_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1211: benchmark_sos_q12(fp, "bessel_cascade_order6_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, bessel_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1212: benchmark_sos_q24(fp, "bessel_cascade_order6_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, bessel_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1213: benchmark_sos_q12(fp, "bessel_cascade_order6_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, bessel_cascade_order6_cut1000_f64_sos, 3); break;
+    case 1214: benchmark_sos_bfp16(fp, "bessel_cascade_order6_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, bessel_cascade_order6_cut1000_f64_sos, 3); break;
+
+    case 1215: benchmark_cascade_q24(fp, "bessel_cascade_order6_cut2000_f64_sos", CASCADE_q24, bessel_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1216: benchmark_cascade_q12(fp, "bessel_cascade_order6_cut2000_f64_sos", CASCADE_q12, bessel_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1217: benchmark_sos_q24(fp, "bessel_cascade_order6_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, bessel_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1218: benchmark_sos_q12(fp, "bessel_cascade_order6_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, bessel_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1219: benchmark_sos_q24(fp, "bessel_cascade_order6_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, bessel_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1220: benchmark_sos_q12(fp, "bessel_cascade_order6_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, bessel_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1221: benchmark_sos_q24(fp, "bessel_cascade_order6_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, bessel_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1222: benchmark_sos_q12(fp, "bessel_cascade_order6_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, bessel_cascade_order6_cut2000_f64_sos, 3); break;
+    case 1223: benchmark_sos_bfp16(fp, "bessel_cascade_order6_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, bessel_cascade_order6_cut2000_f64_sos, 3); break;
+
+    case 1224: benchmark_cascade_q24(fp, "bessel_cascade_order6_cut5000_f64_sos", CASCADE_q24, bessel_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1225: benchmark_cascade_q12(fp, "bessel_cascade_order6_cut5000_f64_sos", CASCADE_q12, bessel_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1226: benchmark_sos_q24(fp, "bessel_cascade_order6_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, bessel_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1227: benchmark_sos_q12(fp, "bessel_cascade_order6_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, bessel_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1228: benchmark_sos_q24(fp, "bessel_cascade_order6_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, bessel_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1229: benchmark_sos_q12(fp, "bessel_cascade_order6_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, bessel_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1230: benchmark_sos_q24(fp, "bessel_cascade_order6_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, bessel_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1231: benchmark_sos_q12(fp, "bessel_cascade_order6_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, bessel_cascade_order6_cut5000_f64_sos, 3); break;
+    case 1232: benchmark_sos_bfp16(fp, "bessel_cascade_order6_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, bessel_cascade_order6_cut5000_f64_sos, 3); break;
+
+    case 1233: benchmark_cascade_q24(fp, "bessel_cascade_order8_cut1000_f64_sos", CASCADE_q24, bessel_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1234: benchmark_cascade_q12(fp, "bessel_cascade_order8_cut1000_f64_sos", CASCADE_q12, bessel_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1235: benchmark_sos_q24(fp, "bessel_cascade_order8_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, bessel_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1236: benchmark_sos_q12(fp, "bessel_cascade_order8_cut1000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, bessel_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1237: benchmark_sos_q24(fp, "bessel_cascade_order8_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, bessel_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1238: benchmark_sos_q12(fp, "bessel_cascade_order8_cut1000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, bessel_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1239: benchmark_sos_q24(fp, "bessel_cascade_order8_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, bessel_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1240: benchmark_sos_q12(fp, "bessel_cascade_order8_cut1000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, bessel_cascade_order8_cut1000_f64_sos, 4); break;
+    case 1241: benchmark_sos_bfp16(fp, "bessel_cascade_order8_cut1000_f64_sos", "CASCADE", CASCADE_bfp16, bessel_cascade_order8_cut1000_f64_sos, 4); break;
+
+    case 1242: benchmark_cascade_q24(fp, "bessel_cascade_order8_cut2000_f64_sos", CASCADE_q24, bessel_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1243: benchmark_cascade_q12(fp, "bessel_cascade_order8_cut2000_f64_sos", CASCADE_q12, bessel_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1244: benchmark_sos_q24(fp, "bessel_cascade_order8_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, bessel_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1245: benchmark_sos_q12(fp, "bessel_cascade_order8_cut2000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, bessel_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1246: benchmark_sos_q24(fp, "bessel_cascade_order8_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, bessel_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1247: benchmark_sos_q12(fp, "bessel_cascade_order8_cut2000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, bessel_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1248: benchmark_sos_q24(fp, "bessel_cascade_order8_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, bessel_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1249: benchmark_sos_q12(fp, "bessel_cascade_order8_cut2000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, bessel_cascade_order8_cut2000_f64_sos, 4); break;
+    case 1250: benchmark_sos_bfp16(fp, "bessel_cascade_order8_cut2000_f64_sos", "CASCADE", CASCADE_bfp16, bessel_cascade_order8_cut2000_f64_sos, 4); break;
+
+    case 1251: benchmark_cascade_q24(fp, "bessel_cascade_order8_cut5000_f64_sos", CASCADE_q24, bessel_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1252: benchmark_cascade_q12(fp, "bessel_cascade_order8_cut5000_f64_sos", CASCADE_q12, bessel_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1253: benchmark_sos_q24(fp, "bessel_cascade_order8_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, bessel_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1254: benchmark_sos_q12(fp, "bessel_cascade_order8_cut5000_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, bessel_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1255: benchmark_sos_q24(fp, "bessel_cascade_order8_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, bessel_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1256: benchmark_sos_q12(fp, "bessel_cascade_order8_cut5000_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, bessel_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1257: benchmark_sos_q24(fp, "bessel_cascade_order8_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, bessel_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1258: benchmark_sos_q12(fp, "bessel_cascade_order8_cut5000_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, bessel_cascade_order8_cut5000_f64_sos, 4); break;
+    case 1259: benchmark_sos_bfp16(fp, "bessel_cascade_order8_cut5000_f64_sos", "CASCADE", CASCADE_bfp16, bessel_cascade_order8_cut5000_f64_sos, 4); break;
+    default: return 0;
+    }
+    return 1;
+}
 
-        benchmark_cascade_q24(fp, "bessel_cascade_order8_cut1000_f64_sos", CASCADE_q24, bessel_cascade_order8_cut1000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "bessel_cascade_order8_cut1000_f64_sos", CASCADE_q12, bessel_cascade_order8_cut1000_f64_sos, 4);
+int main(int argc, char **argv) {
+    timing_init();
+    printf("[LOG] Timer: %s, %.3f MHz, overhead %.1f ns, resolution %.1f ns\n", timing_source_name(),
+           timing_frequency() / 1e6, timing_overhead_ns(), timing_resolution_ns());
+    perf_init();
+    argc = bench_parse_args(argc, argv, FS, 60.0 * DURATION_MIN);
+    N = bench.n;
+
+    if (argc > 1 && strcmp(argv[1], "tile") == 0)
+        return run_tile_benchmark();
+    if (argc > 1 && strcmp(argv[1], "rtspec") == 0)
+        return run_rtspec_benchmark();
+    if (argc > 1 && strcmp(argv[1], "mc") == 0)
+        return run_mc_benchmark();
+    if (argc > 1 && strcmp(argv[1], "qn") == 0)
+        return run_qn_benchmark();
+    if (argc > 1 && strcmp(argv[1], "sweep") == 0)
+        return run_sweep_benchmark();
+    if (argc > 1 && strcmp(argv[1], "latency") == 0)
+        return run_latency_benchmark();
+    if (argc > 1 && strcmp(argv[1], "rtsim") == 0)
+        return run_rtsim_benchmark(argc, argv);
+
+    FILE *fp = fopen("c_fixed_time_results" RESULTS_SUFFIX ".csv", "w");
+    fprintf(fp, "filter_name,type,structure,cutoff,order,time_seconds" BENCH_CSV_HEADER SAT_CSV_HEADER PERF_CSV_HEADER "\n");
+
+    FILE *fp_summary = fopen("c_fixed_time_summary" RESULTS_SUFFIX ".csv", "w");
+    if (!fp_summary) {
+        perror("Can't open summary CSV file");
+        fclose(fp);
+        return 1;
+    }
 
-        benchmark_cascade_q24(fp, "bessel_cascade_order8_cut2000_f64_sos", CASCADE_q24, bessel_cascade_order8_cut2000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "bessel_cascade_order8_cut2000_f64_sos", CASCADE_q12, bessel_cascade_order8_cut2000_f64_sos, 4);
+    runner_run(fp, fp_summary, "filter_name,type,structure,cutoff,order", run_config);
 
-        benchmark_cascade_q24(fp, "bessel_cascade_order8_cut5000_f64_sos", CASCADE_q24, bessel_cascade_order8_cut5000_f64_sos, 4);
-        benchmark_cascade_q12(fp, "bessel_cascade_order8_cut5000_f64_sos", CASCADE_q12, bessel_cascade_order8_cut5000_f64_sos, 4);
-    }
+    fclose(fp_summary);
 
     fclose(fp);
+    pool_release();
     return 0;
 }
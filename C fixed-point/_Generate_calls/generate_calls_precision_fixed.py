@@ -18,13 +18,24 @@ def generate_precision_ba(name, order):
     structure = struct_match.group(1).upper() if struct_match else "UNKNOWN"
     call_q24 = f'precision_analysis_q(fp_precision, "{name}", "{structure}", 24, (void (*)(void*, void*, void*, void*, int, int)){structure}_q24, {structure}_d, {name}_f64_ba[0], {name}_f64_ba[1], {order + 1});'
     call_q511 = f'precision_analysis_q(fp_precision, "{name}", "{structure}", 12, (void (*)(void*, void*, void*, void*, int, int)){structure}_q12, {structure}_d, {name}_f64_ba[0], {name}_f64_ba[1], {order + 1});'
-    return call_q24 + "\n" + call_q511
+    acc_q24 = f'precision_analysis_q(fp_precision, "{name}", "{structure}_ACC", 24, (void (*)(void*, void*, void*, void*, int, int)){structure}_q24_acc, {structure}_d, {name}_f64_ba[0], {name}_f64_ba[1], {order + 1});'
+    acc_q12 = f'precision_analysis_q(fp_precision, "{name}", "{structure}_ACC", 12, (void (*)(void*, void*, void*, void*, int, int)){structure}_q12_acc, {structure}_d, {name}_f64_ba[0], {name}_f64_ba[1], {order + 1});'
+    qn = f'precision_analysis_qn(fp_qn, "{name}", "{structure}", {structure}_d, NULL, {name}_f64_ba[0], {name}_f64_ba[1], {order + 1}, NULL, 0);'
+    return call_q24 + "\n" + call_q511 + "\n" + acc_q24 + "\n" + acc_q12 + "\n" + qn
 
 # Generowanie wywołań precision_analysis_sos (jednoliniowe)
 def generate_precision_sos(name, sections):
     call_q24 = f'precision_analysis_sos(fp_precision, "{name}", "CASCADE", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, {name}_f64_sos, {sections});'
     call_q511 = f'precision_analysis_sos(fp_precision, "{name}", "CASCADE", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, {name}_f64_sos, {sections});'
-    return call_q24 + "\n" + call_q511
+    acc_q24 = f'precision_analysis_sos(fp_precision, "{name}", "CASCADE_ACC", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, {name}_f64_sos, {sections});'
+    acc_q12 = f'precision_analysis_sos(fp_precision, "{name}", "CASCADE_ACC", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_acc, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, {name}_f64_sos, {sections});'
+    ef1_q24 = f'precision_analysis_sos(fp_precision, "{name}", "CASCADE_EF1", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, {name}_f64_sos, {sections});'
+    ef1_q12 = f'precision_analysis_sos(fp_precision, "{name}", "CASCADE_EF1", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef1, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, {name}_f64_sos, {sections});'
+    ef2_q24 = f'precision_analysis_sos(fp_precision, "{name}", "CASCADE_EF2", 24, (void (*)(void*, void*, void*, int, int))CASCADE_q24_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, {name}_f64_sos, {sections});'
+    ef2_q12 = f'precision_analysis_sos(fp_precision, "{name}", "CASCADE_EF2", 12, (void (*)(void*, void*, void*, int, int))CASCADE_q12_ef2, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, {name}_f64_sos, {sections});'
+    bfp = f'precision_analysis_bfp16(fp_precision, "{name}", "CASCADE", CASCADE_bfp16, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, {name}_f64_sos, {sections});'
+    qn = f'precision_analysis_qn(fp_qn, "{name}", "CASCADE", NULL, (void (*)(double*, double*, const double[][6], int, int))CASCADE_d, NULL, NULL, 0, {name}_f64_sos, {sections});'
+    return call_q24 + "\n" + call_q511 + "\n" + acc_q24 + "\n" + acc_q12 + "\n" + ef1_q24 + "\n" + ef1_q12 + "\n" + ef2_q24 + "\n" + ef2_q12 + "\n" + bfp + "\n" + qn
 
 # Zbieranie wszystkich BA
 ba_calls = []
@@ -17,12 +17,21 @@ def generate_fixed(name, order):
     struct_match = re.search(r"_(df1|df2|tdf2)_", name)
     structure = struct_match.group(1).upper() if struct_match else "UNKNOWN"
     return f"""benchmark_fixed_q24(fp, "{name}_f64_ba", "{structure}", {structure}_q24, {name}_f64_ba[0], {name}_f64_ba[1], {order + 1});
-benchmark_fixed_q12(fp, "{name}_f64_ba", "{structure}", {structure}_q12, {name}_f64_ba[0], {name}_f64_ba[1], {order + 1});"""
+benchmark_fixed_q12(fp, "{name}_f64_ba", "{structure}", {structure}_q12, {name}_f64_ba[0], {name}_f64_ba[1], {order + 1});
+benchmark_fixed_q24(fp, "{name}_f64_ba", "{structure}_ACC", {structure}_q24_acc, {name}_f64_ba[0], {name}_f64_ba[1], {order + 1});
+benchmark_fixed_q12(fp, "{name}_f64_ba", "{structure}_ACC", {structure}_q12_acc, {name}_f64_ba[0], {name}_f64_ba[1], {order + 1});"""
 
 # Generowanie CASCADE
 def generate_cascade(name, sections):
     return f"""benchmark_cascade_q24(fp, "{name}_f64_sos", CASCADE_q24, {name}_f64_sos, {sections});
-benchmark_cascade_q12(fp, "{name}_f64_sos", CASCADE_q12, {name}_f64_sos, {sections});"""
+benchmark_cascade_q12(fp, "{name}_f64_sos", CASCADE_q12, {name}_f64_sos, {sections});
+benchmark_sos_q24(fp, "{name}_f64_sos", "CASCADE_ACC", CASCADE_q24_acc, {name}_f64_sos, {sections});
+benchmark_sos_q12(fp, "{name}_f64_sos", "CASCADE_ACC", CASCADE_q12_acc, {name}_f64_sos, {sections});
+benchmark_sos_q24(fp, "{name}_f64_sos", "CASCADE_EF1", CASCADE_q24_ef1, {name}_f64_sos, {sections});
+benchmark_sos_q12(fp, "{name}_f64_sos", "CASCADE_EF1", CASCADE_q12_ef1, {name}_f64_sos, {sections});
+benchmark_sos_q24(fp, "{name}_f64_sos", "CASCADE_EF2", CASCADE_q24_ef2, {name}_f64_sos, {sections});
+benchmark_sos_q12(fp, "{name}_f64_sos", "CASCADE_EF2", CASCADE_q12_ef2, {name}_f64_sos, {sections});
+benchmark_sos_bfp16(fp, "{name}_f64_sos", "CASCADE", CASCADE_bfp16, {name}_f64_sos, {sections});"""
 
 # FIXED
 fixed_calls = []
@@ -48,6 +57,14 @@ output += "\n\n".join(fixed_calls)
 output += "\n\n// --- CASCADE SOS ---\n"
 output += "\n\n".join(cascade_calls)
 
+# Każde wywołanie jako osobny przypadek run_config (runner.h losuje ich kolejność)
+cases = []
+for line in output.split("\n"):
+    if line.strip() and not line.startswith("//"):
+        line = f"case {sum(c.startswith('case ') for c in cases)}: {line} break;"
+    cases.append(line)
+output = "\n".join(cases)
+
 # Zapis do pliku
 with open(OUTPUT_FILE, "w") as f:
     f.write(output)
@@ -0,0 +1,61 @@
+#include <stdlib.h>
+#include <math.h>
+#include "fixedpointBFP16.h"
+
+// === Bufory ===
+int bfp16_alloc(bfp16 *x, int N) {
+    int blocks = bfp16_blocks(N);
+
+    x->N = N;
+    x->m = calloc(N > 0 ? N : 1, sizeof(int16_t));
+    x->e = malloc(sizeof(int16_t) * (blocks > 0 ? blocks : 1));
+    if (!x->m || !x->e) {
+        bfp16_free(x);
+        return -1;
+    }
+    for (int b = 0; b < blocks; ++b) x->e[b] = BFP16_EXP_MIN;
+    return 0;
+}
+
+void bfp16_free(bfp16 *x) {
+    free(x->m);
+    free(x->e);
+    x->m = NULL;
+    x->e = NULL;
+    x->N = 0;
+}
+
+// === Konwersje ===
+void bfp16_from_double(bfp16 *dst, const double *src, int N) {
+    for (int start = 0, b = 0; start < N; start += BFP16_BLOCK, ++b) {
+        int len = (N - start < BFP16_BLOCK) ? N - start : BFP16_BLOCK;
+        double peak = 0.0;
+        int p;
+
+        for (int i = 0; i < len; ++i)
+            if (fabs(src[start + i]) > peak) peak = fabs(src[start + i]);
+
+        if (peak == 0.0) {
+            dst->e[b] = BFP16_EXP_MIN;
+            for (int i = 0; i < len; ++i) dst->m[start + i] = 0;
+            continue;
+        }
+
+        // peak < 2^p -> |m| < 2^15
+        frexp(peak, &p);
+        int e = p - 15;
+        if (e < BFP16_EXP_MIN) e = BFP16_EXP_MIN;
+        dst->e[b] = (int16_t)e;
+
+        for (int i = 0; i < len; ++i) {
+            long v = lround(ldexp(src[start + i], -e));
+            if (v > BFP16_MANT_MAX) v = BFP16_MANT_MAX;
+            if (v < BFP16_MANT_MIN) v = BFP16_MANT_MIN;
+            dst->m[start + i] = (int16_t)v;
+        }
+    }
+}
+
+double bfp16_to_double(const bfp16 *src, int i) {
+    return ldexp((double)src->m[i], src->e[i / BFP16_BLOCK]);
+}
@@ -0,0 +1,35 @@
+#ifndef FIXEDPOINTBFP16_H
+#define FIXEDPOINTBFP16_H
+
+#include <stdint.h>
+
+// === Blokowy zmiennoprzecinkowy (block floating point) ===
+// Mantysy 16-bit, jeden wykładnik na blok BFP16_BLOCK próbek:
+//   x[n] = m[n] * 2^e[n / BFP16_BLOCK]
+// Wykładnik dobierany do szczytu bloku (mantysy wykorzystują pełne 15 bitów), więc zakres
+// dynamiki jest zbliżony do float, a arytmetyka wewnątrz bloku pozostaje całkowitoliczbowa.
+#ifndef BFP16_BLOCK
+#define BFP16_BLOCK 64
+#endif
+
+#define BFP16_MANT_MAX  32767
+#define BFP16_MANT_MIN  -32768
+#define BFP16_EXP_MIN   -512   // wykładnik bloku zerowego; mniejsze wartości są zerowane
+
+typedef struct {
+    int16_t *m;   // N mantys
+    int16_t *e;   // bfp16_blocks(N) wykładników
+    int N;
+} bfp16;
+
+static inline int bfp16_blocks(int N) { return (N + BFP16_BLOCK - 1) / BFP16_BLOCK; }
+
+// 0 albo -1 przy braku pamięci; bufor wyzerowany (bloki zerowe)
+int bfp16_alloc(bfp16 *x, int N);
+void bfp16_free(bfp16 *x);
+
+// Wykładnik każdego bloku z jego szczytu, mantysy zaokrąglane z saturacją
+void bfp16_from_double(bfp16 *dst, const double *src, int N);
+double bfp16_to_double(const bfp16 *src, int i);
+
+#endif
@@ -1,4 +1,8 @@
 #include "fixedpointQ12.h"
+#include "satstats.h"
+
+// W trybie FIXEDPOINT_INLINE definicje są w nagłówku
+#ifndef FIXEDPOINT_INLINE
 
 // === Licznik przepełnień ===
 extern int q12_overflow_count; 
@@ -22,18 +26,25 @@ double q12_to_double(q12 x) {
 }
 
 // === Operacje ===
-q12 q12_saturate(int32_t value) {
+// Wspólna saturacja; op trafia do telemetrii (satstats.h) tylko przy przepełnieniu
+static q12 q12_saturate_op(int32_t value, sat_op op) {
     if (value > Q12_MAX) {
         q12_overflow_count++; 
+        SAT_RECORD(op, SAT_OVER);
         return Q12_MAX;
     }
     if (value < Q12_MIN) {
         q12_underflow_count++; 
+        SAT_RECORD(op, SAT_UNDER);
         return Q12_MIN;
     }
     return (q12)value;
 }
 
+q12 q12_saturate(int32_t value) {
+    return q12_saturate_op(value, SAT_OUT);
+}
+
 q12 q12_add(q12 a, q12 b) {
     int32_t temp = (int32_t)a + (int32_t)b;
     return temp;
@@ -52,16 +63,18 @@ q12 q12_mul(q12 a, q12 b) {
 
 q12 q12_add_s(q12 a, q12 b) {
     int32_t temp = (int32_t)a + (int32_t)b;
-    return q12_saturate(temp);
+    return q12_saturate_op(temp, SAT_ADD);
 }
 
 q12 q12_sub_s(q12 a, q12 b) {
     int32_t temp = (int32_t)a - (int32_t)b;
-    return q12_saturate(temp);
+    return q12_saturate_op(temp, SAT_SUB);
 }
 
 q12 q12_mul_s(q12 a, q12 b) {
     int32_t temp = (int32_t)a * (int32_t)b;
     temp >>= Q12_SHIFT;
-    return q12_saturate(temp);
-}
\ No newline at end of file
+    return q12_saturate_op(temp, SAT_MUL);
+}
+
+#endif // FIXEDPOINT_INLINE
@@ -10,6 +10,54 @@
 
 typedef int16_t q12;
 
+// === Wersja inline (-DFIXEDPOINT_INLINE) ===
+// Operacje jako static inline w nagłówku (bez wywołań funkcji w pętlach kerneli),
+// saturacja bez skoków (porównania zamieniane na cmov/min/max). Zliczanie
+// przepełnień włączane w czasie kompilacji: -DFIXEDPOINT_COUNT=0 je wyłącza.
+// Wyniki identyczne z wersją z fixedpointQ12.c.
+#ifdef FIXEDPOINT_INLINE
+
+#include "satstats.h"
+
+#ifndef FIXEDPOINT_COUNT
+#define FIXEDPOINT_COUNT 1
+#endif
+
+extern int q12_overflow_count;
+extern int q12_underflow_count;
+
+static inline q12 float_to_q12(float x) { return (q12)(x * (float)Q12_ONE); }
+static inline float q12_to_float(q12 x) { return (float)x / (float)Q12_ONE; }
+static inline q12 double_to_q12(double x) { return (q12)(x * (double)Q12_ONE); }
+static inline double q12_to_double(q12 x) { return (double)x / (double)Q12_ONE; }
+
+static inline q12 q12_saturate_op(int32_t value, sat_op op) {
+    int32_t clamped = (value > Q12_MAX) ? Q12_MAX : value;
+    clamped = (clamped < Q12_MIN) ? Q12_MIN : clamped;
+#if FIXEDPOINT_COUNT
+    // Liczniki są globalne (mogą aliasować z buforami), więc dotykane tylko przy przepełnieniu
+    if (__builtin_expect(clamped != value, 0)) {
+        q12_overflow_count += (value > Q12_MAX);
+        q12_underflow_count += (value < Q12_MIN);
+        SAT_RECORD(op, value > Q12_MAX ? SAT_OVER : SAT_UNDER);
+    }
+#else
+    (void)op;
+#endif
+    return (q12)clamped;
+}
+
+static inline q12 q12_saturate(int32_t value) { return q12_saturate_op(value, SAT_OUT); }
+
+static inline q12 q12_add(q12 a, q12 b) { return (q12)((int32_t)a + (int32_t)b); }
+static inline q12 q12_sub(q12 a, q12 b) { return (q12)((int32_t)a - (int32_t)b); }
+static inline q12 q12_mul(q12 a, q12 b) { return (q12)(((int32_t)a * (int32_t)b) >> Q12_SHIFT); }
+static inline q12 q12_add_s(q12 a, q12 b) { return q12_saturate_op((int32_t)a + (int32_t)b, SAT_ADD); }
+static inline q12 q12_sub_s(q12 a, q12 b) { return q12_saturate_op((int32_t)a - (int32_t)b, SAT_SUB); }
+static inline q12 q12_mul_s(q12 a, q12 b) { return q12_saturate_op(((int32_t)a * (int32_t)b) >> Q12_SHIFT, SAT_MUL); }
+
+#else
+
 // === Konwersje ===
 q12 float_to_q12(float x);
 float q12_to_float(q12 x);
@@ -25,4 +73,6 @@ q12 q12_sub_s(q12 a, q12 b);
 q12 q12_mul_s(q12 a, q12 b);
 q12 q12_saturate(int32_t value);
 
+#endif // FIXEDPOINT_INLINE
+
 #endif // FIXEDPOINTQ12_H
\ No newline at end of file
@@ -1,6 +1,10 @@
 #include <stdint.h>
 #include <limits.h>
 #include "fixedpointQ24.h"
+#include "satstats.h"
+
+// W trybie FIXEDPOINT_INLINE definicje są w nagłówku
+#ifndef FIXEDPOINT_INLINE
 
 // === Licznik przepełnienia ===
 extern int q24_overflow_count;
@@ -25,18 +29,25 @@ double q24_to_double(q24 x) {
 
 // === Operacje ===
 
-q24 q24_saturate(int64_t value) {
+// Wspólna saturacja; op trafia do telemetrii (satstats.h) tylko przy przepełnieniu
+static q24 q24_saturate_op(int64_t value, sat_op op) {
     if (value > Q24_MAX) {
         q24_overflow_count++; 
+        SAT_RECORD(op, SAT_OVER);
         return Q24_MAX;
     }
     if (value < Q24_MIN) {
         q24_underflow_count++; 
+        SAT_RECORD(op, SAT_UNDER);
         return Q24_MIN;
     }
     return (q24)value;
 }
 
+q24 q24_saturate(int64_t value) {
+    return q24_saturate_op(value, SAT_OUT);
+}
+
 q24 q24_add(q24 a, q24 b) {
     int64_t temp = (int64_t)a + b;
     return temp;
@@ -55,16 +66,18 @@ q24 q24_mul(q24 a, q24 b) {
 
 q24 q24_add_s(q24 a, q24 b) {
     int64_t temp = (int64_t)a + b;
-    return q24_saturate(temp);
+    return q24_saturate_op(temp, SAT_ADD);
 }
 
 q24 q24_sub_s(q24 a, q24 b) {
     int64_t temp = (int64_t)a - b;
-    return q24_saturate(temp);
+    return q24_saturate_op(temp, SAT_SUB);
 }
 
 q24 q24_mul_s(q24 a, q24 b) {
     int64_t temp = (int64_t)a * b;
     temp >>= Q24_SHIFT;
-    return q24_saturate(temp);
-}
\ No newline at end of file
+    return q24_saturate_op(temp, SAT_MUL);
+}
+
+#endif // FIXEDPOINT_INLINE
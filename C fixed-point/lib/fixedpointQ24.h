@@ -12,6 +12,54 @@ typedef int32_t q24;
 
 //extern int q411_overflow_count;
 
+// === Wersja inline (-DFIXEDPOINT_INLINE) ===
+// Operacje jako static inline w nagłówku (bez wywołań funkcji w pętlach kerneli),
+// saturacja bez skoków (porównania zamieniane na cmov/min/max). Zliczanie
+// przepełnień włączane w czasie kompilacji: -DFIXEDPOINT_COUNT=0 je wyłącza.
+// Wyniki identyczne z wersją z fixedpointQ24.c.
+#ifdef FIXEDPOINT_INLINE
+
+#include "satstats.h"
+
+#ifndef FIXEDPOINT_COUNT
+#define FIXEDPOINT_COUNT 1
+#endif
+
+extern int q24_overflow_count;
+extern int q24_underflow_count;
+
+static inline q24 float_to_q24(float x) { return (q24)(x * (float)Q24_ONE); }
+static inline float q24_to_float(q24 x) { return (float)x / (float)Q24_ONE; }
+static inline q24 double_to_q24(double x) { return (q24)(x * (double)Q24_ONE); }
+static inline double q24_to_double(q24 x) { return (double)x / (double)Q24_ONE; }
+
+static inline q24 q24_saturate_op(int64_t value, sat_op op) {
+    int64_t clamped = (value > Q24_MAX) ? Q24_MAX : value;
+    clamped = (clamped < Q24_MIN) ? Q24_MIN : clamped;
+#if FIXEDPOINT_COUNT
+    // Liczniki są globalne (mogą aliasować z buforami), więc dotykane tylko przy przepełnieniu
+    if (__builtin_expect(clamped != value, 0)) {
+        q24_overflow_count += (value > Q24_MAX);
+        q24_underflow_count += (value < Q24_MIN);
+        SAT_RECORD(op, value > Q24_MAX ? SAT_OVER : SAT_UNDER);
+    }
+#else
+    (void)op;
+#endif
+    return (q24)clamped;
+}
+
+static inline q24 q24_saturate(int64_t value) { return q24_saturate_op(value, SAT_OUT); }
+
+static inline q24 q24_add(q24 a, q24 b) { return (q24)((int64_t)a + (int64_t)b); }
+static inline q24 q24_sub(q24 a, q24 b) { return (q24)((int64_t)a - (int64_t)b); }
+static inline q24 q24_mul(q24 a, q24 b) { return (q24)(((int64_t)a * (int64_t)b) >> Q24_SHIFT); }
+static inline q24 q24_add_s(q24 a, q24 b) { return q24_saturate_op((int64_t)a + (int64_t)b, SAT_ADD); }
+static inline q24 q24_sub_s(q24 a, q24 b) { return q24_saturate_op((int64_t)a - (int64_t)b, SAT_SUB); }
+static inline q24 q24_mul_s(q24 a, q24 b) { return q24_saturate_op(((int64_t)a * (int64_t)b) >> Q24_SHIFT, SAT_MUL); }
+
+#else
+
 // === Konwersje ===
 q24 float_to_q24(float x);
 float q24_to_float(q24 x);
@@ -28,4 +76,6 @@ q24 q24_sub_s(q24 a, q24 b);
 q24 q24_mul_s(q24 a, q24 b);
 q24 q24_saturate(int64_t value);
 
+#endif // FIXEDPOINT_INLINE
+
 #endif
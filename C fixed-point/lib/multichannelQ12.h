@@ -0,0 +1,36 @@
+#ifndef MULTICHANNELQ12_H
+#define MULTICHANNELQ12_H
+
+#include "fixedpointQ12.h"
+
+// Wielokanałowe (SIMD) wersje TDF2 i CASCADE w Q12: jeden wektor = kilka kanałów int16,
+// iloczyny rozszerzane do int32 (16x16 -> 32, jak q12_mul).
+// Wersje _s odtwarzają bit w bit structuresQ12s.c, pozostałe structuresQ12.c.
+// Liczniki przepełnień (q12_overflow_count) nie są tu aktualizowane.
+// Kompilacja: gcc -O3 -march=native ... ./lib/multichannelQ12.c
+
+// Liczba kanałów w wektorze dobrana tak, by iloczyny rozszerzone do int32 mieściły się
+// w jednym rejestrze (szersze wektory kompilator rozbija i saturację liczy skalarnie).
+// AVX-512: 16, AVX2: 8, pozostałe: 4.
+#if defined(__AVX512F__)
+#define MC_LANES_Q12 16
+#elif defined(__AVX2__)
+#define MC_LANES_Q12 8
+#else
+#define MC_LANES_Q12 4
+#endif
+
+// Układ danych jak w C/lib/multichannel.h
+#ifndef MC_INTERLEAVED
+#define MC_INTERLEAVED 0
+#define MC_PLANAR      1
+#endif
+
+// N = liczba próbek na kanał, order jak w structuresQ12.h (liczba współczynników)
+void TDF2_mc_q12(q12 *x, q12 *y, q12 *b, q12 *a, int N, int order, int channels, int layout);
+void CASCADE_mc_q12(q12 *x, q12 *y, q12 *sos, int N, int sections, int channels, int layout);
+
+void TDF2_mc_q12_s(q12 *x, q12 *y, q12 *b, q12 *a, int N, int order, int channels, int layout);
+void CASCADE_mc_q12_s(q12 *x, q12 *y, q12 *sos, int N, int sections, int channels, int layout);
+
+#endif // MULTICHANNELQ12_H
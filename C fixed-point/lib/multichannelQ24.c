@@ -0,0 +1,177 @@
+#include <stddef.h>
+#include <string.h>
+#include "multichannelQ24.h"
+
+#define MC_TILE 256  // kafel (próbki na kanał) dla układu MC_PLANAR
+
+typedef int32_t  mc_vq __attribute__((vector_size(MC_LANES_Q24 * sizeof(int32_t))));
+typedef uint32_t mc_vu __attribute__((vector_size(MC_LANES_Q24 * sizeof(uint32_t))));
+typedef int64_t  mc_vw __attribute__((vector_size(MC_LANES_Q24 * sizeof(int64_t))));
+
+// === Operacje (odpowiedniki q24_* z fixedpointQ24.c dla całego wektora) ===
+// Dodawanie bez saturacji zawija się w int32 - liczone na typie bez znaku
+static inline mc_vq v_add(mc_vq a, mc_vq b) { return (mc_vq)((mc_vu)a + (mc_vu)b); }
+static inline mc_vq v_sub(mc_vq a, mc_vq b) { return (mc_vq)((mc_vu)a - (mc_vu)b); }
+
+// Saturacja bez rozszerzania: przepełnienie tylko, gdy znak wyniku różni się od znaku
+// obu składników; wtedy wynik to Q24_MAX / Q24_MIN zależnie od znaku a
+static inline mc_vq v_add_s(mc_vq a, mc_vq b) {
+    mc_vq s = v_add(a, b);
+    mc_vq ovf = ((a ^ s) & (b ^ s)) >> 31;
+    mc_vq sat = (a >> 31) ^ Q24_MAX;
+    return (s & ~ovf) | (sat & ovf);
+}
+
+static inline mc_vq v_sub_s(mc_vq a, mc_vq b) {
+    mc_vq s = v_sub(a, b);
+    mc_vq ovf = ((a ^ b) & (a ^ s)) >> 31;
+    mc_vq sat = (a >> 31) ^ Q24_MAX;
+    return (s & ~ovf) | (sat & ovf);
+}
+
+// Iloczyn współczynnika i wektora: 32x32 -> 64, przesunięcie o Q24_SHIFT
+static inline mc_vw v_prod(q24 c, mc_vq v) {
+    return (__builtin_convertvector(v, mc_vw) * (int64_t)c) >> Q24_SHIFT;
+}
+
+static inline mc_vq v_mul(q24 c, mc_vq v) {
+    return __builtin_convertvector(v_prod(c, v), mc_vq);
+}
+
+static inline mc_vq v_mul_s(q24 c, mc_vq v) {
+    mc_vw p = v_prod(c, v);
+    mc_vw hi = p > Q24_MAX;
+    mc_vw lo = p < Q24_MIN;
+    p = (p & ~hi) | (hi & (int64_t)Q24_MAX);
+    p = (p & ~lo) | (lo & (int64_t)Q24_MIN);
+    return __builtin_convertvector(p, mc_vq);
+}
+
+// Odczyt/zapis w kanałów (w <= MC_LANES_Q24); niepełna grupa uzupełniana zerami
+static inline mc_vq load_q24(const q24 *p, int w) {
+    mc_vq v = {0};
+    if (w == MC_LANES_Q24) memcpy(&v, p, sizeof(v));
+    else memcpy(&v, p, sizeof(q24) * w);
+    return v;
+}
+
+static inline void store_q24(q24 *p, mc_vq v, int w) {
+    if (w == MC_LANES_Q24) memcpy(p, &v, sizeof(v));
+    else memcpy(p, &v, sizeof(q24) * w);
+}
+
+// Jądra grupowe: jedna grupa MC_LANES_Q24 kanałów, próbki co stride elementów.
+// Stan st (wyzerowany przez wywołującego) przenoszony jest między wywołaniami.
+// Dozwolone x == y. Kolejność operacji jak w jądrach skalarnych.
+static void TDF2_group_q24(mc_vq *w_st, q24 *x, q24 *y, int frames, int stride, int w, q24 *b, q24 *a, int order) {
+    for (int n = 0; n < frames; ++n) {
+        mc_vq xn = load_q24(x + (size_t)n * stride, w);
+        mc_vq acc = v_add(w_st[0], v_mul(b[0], xn));
+
+        for (int i = 0; i < order - 2; ++i)
+            w_st[i] = v_add(v_sub(w_st[i + 1], v_mul(a[i + 1], acc)), v_mul(b[i + 1], xn));
+        w_st[order - 2] = v_sub(v_mul(b[order - 1], xn), v_mul(a[order - 1], acc));
+
+        store_q24(y + (size_t)n * stride, acc, w);
+    }
+}
+
+static void TDF2_group_q24_s(mc_vq *w_st, q24 *x, q24 *y, int frames, int stride, int w, q24 *b, q24 *a, int order) {
+    for (int n = 0; n < frames; ++n) {
+        mc_vq xn = load_q24(x + (size_t)n * stride, w);
+        mc_vq acc = v_add_s(w_st[0], v_mul_s(b[0], xn));
+
+        for (int i = 0; i < order - 2; ++i)
+            w_st[i] = v_add_s(v_sub_s(w_st[i + 1], v_mul_s(a[i + 1], acc)), v_mul_s(b[i + 1], xn));
+        w_st[order - 2] = v_sub_s(v_mul_s(b[order - 1], xn), v_mul_s(a[order - 1], acc));
+
+        store_q24(y + (size_t)n * stride, acc, w);
+    }
+}
+
+// Próbka przechodzi przez wszystkie sekcje od razu - stan sekcji zostaje w rejestrach
+// Wspólna sygnatura z pozostałymi jądrami: sos przekazywane jako b, sections jako order
+static void CASCADE_group_q24(mc_vq *st, q24 *x, q24 *y, int frames, int stride, int w, q24 *sos, q24 *a, int sections) {
+    (void)a;
+    mc_vq *w1 = st;
+    mc_vq *w2 = st + sections;
+
+    for (int n = 0; n < frames; ++n) {
+        mc_vq v = load_q24(x + (size_t)n * stride, w);
+        for (int s = 0; s < sections; ++s) {
+            q24 *c = sos + s * 6;
+            mc_vq wn = v_sub(v, v_add(v_mul(c[4], w1[s]), v_mul(c[5], w2[s])));
+            v = v_add(v_add(v_mul(c[0], wn), v_mul(c[1], w1[s])), v_mul(c[2], w2[s]));
+            w2[s] = w1[s];
+            w1[s] = wn;
+        }
+        store_q24(y + (size_t)n * stride, v, w);
+    }
+}
+
+// structuresQ24s.c saturuje wybiórczo (a1 * w1, b0 * wn i suma wyjściowa bez saturacji)
+static void CASCADE_group_q24_s(mc_vq *st, q24 *x, q24 *y, int frames, int stride, int w, q24 *sos, q24 *a, int sections) {
+    (void)a;
+    mc_vq *w1 = st;
+    mc_vq *w2 = st + sections;
+
+    for (int n = 0; n < frames; ++n) {
+        mc_vq v = load_q24(x + (size_t)n * stride, w);
+        for (int s = 0; s < sections; ++s) {
+            q24 *c = sos + s * 6;
+            mc_vq wn = v_sub_s(v, v_add_s(v_mul(c[4], w1[s]), v_mul_s(c[5], w2[s])));
+            v = v_add(v_add_s(v_mul(c[0], wn), v_mul_s(c[1], w1[s])), v_mul_s(c[2], w2[s]));
+            w2[s] = w1[s];
+            w1[s] = wn;
+        }
+        store_q24(y + (size_t)n * stride, v, w);
+    }
+}
+
+// Wspólny szkielet: grupy po MC_LANES_Q24 kanałów. Dla MC_PLANAR kafle MC_TILE próbek
+// przepisywane są do bufora z przeplotem, filtrowane w miejscu i zapisywane z powrotem.
+static void run_mc_q24(void (*group)(mc_vq*, q24*, q24*, int, int, int, q24*, q24*, int),
+                       q24 *x, q24 *y, q24 *b, q24 *a, int N, int order, int channels, int layout) {
+    mc_vq st[2 * 64];  // max: TDF2 order - 1, CASCADE 2 * sections
+    q24 buf[MC_TILE * MC_LANES_Q24];
+
+    for (int c0 = 0; c0 < channels; c0 += MC_LANES_Q24) {
+        int w = (channels - c0 < MC_LANES_Q24) ? channels - c0 : MC_LANES_Q24;
+        memset(st, 0, sizeof(st));
+
+        if (layout == MC_INTERLEAVED) {
+            group(st, x + c0, y + c0, N, channels, w, b, a, order);
+            continue;
+        }
+
+        for (int t = 0; t < N; t += MC_TILE) {
+            int frames = (N - t < MC_TILE) ? N - t : MC_TILE;
+            memset(buf, 0, sizeof(buf));
+            for (int l = 0; l < w; ++l)
+                for (int k = 0; k < frames; ++k)
+                    buf[k * MC_LANES_Q24 + l] = x[(size_t)(c0 + l) * N + t + k];
+
+            group(st, buf, buf, frames, MC_LANES_Q24, MC_LANES_Q24, b, a, order);
+
+            for (int l = 0; l < w; ++l)
+                for (int k = 0; k < frames; ++k)
+                    y[(size_t)(c0 + l) * N + t + k] = buf[k * MC_LANES_Q24 + l];
+        }
+    }
+}
+
+void TDF2_mc_q24(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order, int channels, int layout) {
+    run_mc_q24(TDF2_group_q24, x, y, b, a, N, order, channels, layout);
+}
+
+void CASCADE_mc_q24(q24 *x, q24 *y, q24 *sos, int N, int sections, int channels, int layout) {
+    run_mc_q24(CASCADE_group_q24, x, y, sos, NULL, N, sections, channels, layout);
+}
+
+void TDF2_mc_q24_s(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order, int channels, int layout) {
+    run_mc_q24(TDF2_group_q24_s, x, y, b, a, N, order, channels, layout);
+}
+
+void CASCADE_mc_q24_s(q24 *x, q24 *y, q24 *sos, int N, int sections, int channels, int layout) {
+    run_mc_q24(CASCADE_group_q24_s, x, y, sos, NULL, N, sections, channels, layout);
+}
@@ -0,0 +1,36 @@
+#ifndef MULTICHANNELQ24_H
+#define MULTICHANNELQ24_H
+
+#include "fixedpointQ24.h"
+
+// Wielokanałowe (SIMD) wersje TDF2 i CASCADE w Q24: jeden wektor = kilka kanałów int32,
+// iloczyny rozszerzane do int64 (32x32 -> 64, jak q24_mul).
+// Wersje _s odtwarzają bit w bit structuresQ24s.c, pozostałe structuresQ24.c.
+// Liczniki przepełnień (q24_overflow_count) nie są tu aktualizowane.
+// Kompilacja: gcc -O3 -march=native ... ./lib/multichannelQ24.c
+
+// Liczba kanałów w wektorze dobrana tak, by iloczyny rozszerzone do int64 mieściły się
+// w jednym rejestrze (szersze wektory kompilator rozbija i saturację liczy skalarnie).
+// AVX-512: 8, AVX2: 4, pozostałe: 2.
+#if defined(__AVX512F__)
+#define MC_LANES_Q24 8
+#elif defined(__AVX2__)
+#define MC_LANES_Q24 4
+#else
+#define MC_LANES_Q24 2
+#endif
+
+// Układ danych jak w C/lib/multichannel.h
+#ifndef MC_INTERLEAVED
+#define MC_INTERLEAVED 0
+#define MC_PLANAR      1
+#endif
+
+// N = liczba próbek na kanał, order jak w structuresQ24.h (liczba współczynników)
+void TDF2_mc_q24(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order, int channels, int layout);
+void CASCADE_mc_q24(q24 *x, q24 *y, q24 *sos, int N, int sections, int channels, int layout);
+
+void TDF2_mc_q24_s(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order, int channels, int layout);
+void CASCADE_mc_q24_s(q24 *x, q24 *y, q24 *sos, int N, int sections, int channels, int layout);
+
+#endif // MULTICHANNELQ24_H
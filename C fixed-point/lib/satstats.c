@@ -0,0 +1,77 @@
+#include <string.h>
+#include "satstats.h"
+
+#if SAT_TELEMETRY
+_Thread_local int sat_section = 0;
+static _Thread_local sat_stats sat_local;
+
+void sat_record(sat_op op, sat_dir dir) {
+    int s = sat_section;
+    if (s < 0 || s >= SAT_MAX_SECTIONS) s = SAT_MAX_SECTIONS - 1;
+    sat_local.count[s][op][dir]++;
+}
+
+void sat_begin(void) {
+    memset(&sat_local, 0, sizeof(sat_local));
+    sat_section = 0;
+}
+
+void sat_end(sat_stats *instance) {
+    for (int s = 0; s < SAT_MAX_SECTIONS; ++s)
+        for (int op = 0; op < SAT_OPS; ++op)
+            for (int d = 0; d < 2; ++d)
+                if (sat_local.count[s][op][d])
+                    __atomic_fetch_add(&instance->count[s][op][d], sat_local.count[s][op][d], __ATOMIC_RELAXED);
+    sat_section = 0;
+}
+#endif
+
+unsigned long sat_total(const sat_stats *st, int op, int dir) {
+    unsigned long sum = 0;
+    for (int s = 0; s < SAT_MAX_SECTIONS; ++s)
+        for (int o = 0; o < SAT_OPS; ++o)
+            for (int d = 0; d < 2; ++d)
+                if ((op < 0 || op == o) && (dir < 0 || dir == d))
+                    sum += st->count[s][o][d];
+    return sum;
+}
+
+unsigned long sat_section_total(const sat_stats *st, int section) {
+    unsigned long sum = 0;
+    for (int o = 0; o < SAT_OPS; ++o)
+        sum += st->count[section][o][SAT_OVER] + st->count[section][o][SAT_UNDER];
+    return sum;
+}
+
+int sat_worst_section(const sat_stats *st, int sections) {
+    int worst = -1;
+    unsigned long max = 0;
+    for (int s = 0; s < sections && s < SAT_MAX_SECTIONS; ++s) {
+        unsigned long c = sat_section_total(st, s);
+        if (c > max) {
+            max = c;
+            worst = s;
+        }
+    }
+    return worst;
+}
+
+void sat_fprint_columns(FILE *fp, const sat_stats *st, int sections) {
+#if SAT_TELEMETRY
+    if (sections < 1) sections = 1;
+    if (sections > SAT_MAX_SECTIONS) sections = SAT_MAX_SECTIONS;
+
+    fprintf(fp, ",%lu,%lu,%lu,%lu,%lu,%lu,%d,",
+            sat_total(st, -1, SAT_OVER), sat_total(st, -1, SAT_UNDER),
+            sat_total(st, SAT_ADD, -1), sat_total(st, SAT_SUB, -1),
+            sat_total(st, SAT_MUL, -1), sat_total(st, SAT_OUT, -1),
+            sat_worst_section(st, sections));
+    for (int s = 0; s < sections; ++s) {
+        fprintf(fp, "%lu", sat_section_total(st, s));
+        if (s < sections - 1) fprintf(fp, ";");
+    }
+#else
+    (void)st; (void)sections;
+    fprintf(fp, ",,,,,,,,");
+#endif
+}
@@ -0,0 +1,51 @@
+#ifndef SATSTATS_H
+#define SATSTATS_H
+
+#include <stdio.h>
+
+// === Telemetria saturacji ===
+// Liczniki przepełnień dla instancji filtru, z podziałem na sekcję i operację.
+// Zliczanie trafia do bufora lokalnego wątku (_Thread_local) i tylko na ścieżce przepełnienia;
+// sat_end() dodaje bufor do instancji atomowo, więc kilka wątków może raportować do jednej.
+// -DSAT_TELEMETRY=0 usuwa zliczanie całkowicie (kolumny CSV zostają puste).
+
+#ifndef SAT_TELEMETRY
+#define SAT_TELEMETRY 1
+#endif
+
+#define SAT_MAX_SECTIONS 32
+
+typedef enum { SAT_ADD, SAT_SUB, SAT_MUL, SAT_OUT, SAT_OPS } sat_op;  // SAT_OUT: q*_saturate
+typedef enum { SAT_OVER, SAT_UNDER } sat_dir;
+
+typedef struct {
+    unsigned long count[SAT_MAX_SECTIONS][SAT_OPS][2];
+} sat_stats;
+
+#if SAT_TELEMETRY
+extern _Thread_local int sat_section;      // bieżąca sekcja, ustawiana przez jądra kaskadowe
+
+void sat_record(sat_op op, sat_dir dir);   // wołane z q*_saturate tylko przy przepełnieniu
+void sat_begin(void);                       // zeruje bufor wątku i sekcję
+void sat_end(sat_stats *instance);          // dodaje bufor wątku do instancji
+
+#define SAT_SECTION(s) (sat_section = (s))
+#define SAT_RECORD(op, dir) sat_record((op), (dir))
+#else
+#define SAT_SECTION(s) ((void)0)
+#define SAT_RECORD(op, dir) ((void)(op), (void)(dir))  // op/dir bez ostrzeżeń -Wunused-parameter
+static inline void sat_begin(void) {}
+static inline void sat_end(sat_stats *instance) { (void)instance; }
+#endif
+
+// === Agregaty ===
+// op / dir = -1: suma po wszystkich
+unsigned long sat_total(const sat_stats *st, int op, int dir);
+unsigned long sat_section_total(const sat_stats *st, int section);
+int sat_worst_section(const sat_stats *st, int sections);  // -1, gdy brak przepełnień
+
+// Kolumny CSV (dopisywane na końcu wiersza, z przecinkiem na początku)
+#define SAT_CSV_HEADER ",sat_over,sat_under,sat_add,sat_sub,sat_mul,sat_out,sat_worst_section,sat_per_section"
+void sat_fprint_columns(FILE *fp, const sat_stats *st, int sections);
+
+#endif // SATSTATS_H
@@ -0,0 +1,152 @@
+#include <math.h>
+#include "satstats.h"
+#include "structuresBFP16.h"
+
+// === Współczynniki ===
+void bfp16_sos_from_double(const double sos_d[][6], bfp16_sos *sos, int sections) {
+    for (int s = 0; s < sections; ++s) {
+        double peak = 0.0;
+        for (int k = 0; k < 3; ++k)
+            if (fabs(sos_d[s][k]) > peak) peak = fabs(sos_d[s][k]);
+
+        // max |b| w [2^29, 2^30)
+        int p = 0;
+        if (peak > 0.0) frexp(peak, &p);
+        sos[s].bfrac = 30 - p;
+
+        for (int k = 0; k < 3; ++k)
+            sos[s].b[k] = (int32_t)lround(ldexp(sos_d[s][k], sos[s].bfrac));
+        for (int k = 0; k < 2; ++k) {
+            long v = lround(ldexp(sos_d[s][4 + k], BFP16_CFRAC));
+            if (v > INT32_MAX) v = INT32_MAX;
+            if (v < INT32_MIN) v = INT32_MIN;
+            sos[s].a[k] = (int32_t)v;
+        }
+    }
+}
+
+// === Pomocnicze ===
+static inline int bitlen(uint64_t v) {
+    return v ? 64 - __builtin_clzll(v) : 0;
+}
+
+static inline uint64_t iabs(int64_t v) {
+    return v < 0 ? -(uint64_t)v : (uint64_t)v;
+}
+
+// v * 2^d, przy d < 0 z zaokrągleniem do najbliższej
+static inline int64_t shift_round(int64_t v, int d) {
+    if (d >= 0) return (d > 62) ? 0 : (int64_t)((uint64_t)v << d);
+    d = -d;
+    if (d > 62) return 0;
+    return (v + ((int64_t)1 << (d - 1))) >> d;
+}
+
+static inline int imax(int a, int b) { return a > b ? a : b; }
+static inline uint64_t umax(uint64_t a, uint64_t b) { return a > b ? a : b; }
+
+// Stan sekcji DF1: x1, x2 jako mantysy w skali 2^ex, y1, y2 (int32) w skali 2^ey
+typedef struct {
+    int32_t x1, x2, y1, y2;
+    int ex, ey;
+} bfp16_state;
+
+// === Jedna sekcja na jednym bloku ===
+// in: len mantys w skali 2^ein, out: mantysy wyjścia, zwraca wykładnik wyjścia
+static int section_block(bfp16_state *st, const bfp16_sos *c, const int16_t *in, int ein,
+                         int16_t *out, int len) {
+    int64_t ext[BFP16_BLOCK + 2];
+    int64_t w[BFP16_BLOCK];
+
+    // Wykładnik strony x: stany mogą zejść niżej, wejście nie może zejść poniżej ein
+    uint64_t px = umax(iabs(st->x1), iabs(st->x2));
+    int ex = imax(imax(ein, st->ex - (15 - bitlen(px))), BFP16_EXP_MIN);
+
+    ext[0] = shift_round(st->x2, st->ex - ex);
+    ext[1] = shift_round(st->x1, st->ex - ex);
+    for (int n = 0; n < len; ++n) ext[n + 2] = shift_round(in[n], ein - ex);
+
+    // Część FIR dla całego bloku w skali 2^(ex - bfrac) (|b| < 2^30, |m| <= 2^15 -> < 2^47)
+    int64_t b0 = c->b[0], b1 = c->b[1], b2 = c->b[2];
+    uint64_t pw = 0;
+    for (int n = 0; n < len; ++n) {
+        w[n] = b0 * ext[n + 2] + b1 * ext[n + 1] + b2 * ext[n];
+        pw = umax(pw, iabs(w[n]));
+    }
+
+    // Wykładnik strony y z szczytu FIR i szczytu stanów: oba do 2^(31 - HEADROOM), reszta
+    // zakresu int32 na wzrost w rekursji. Niezależny od ex, więc sekcja o bardzo małym b
+    // (np. pierwsza sekcja Butterwortha 8. rzędu) nie gubi swojego wyjścia poniżej LSB.
+    uint64_t py = umax(iabs(st->y1), iabs(st->y2));
+    int ey = BFP16_EXP_MIN;
+    if (pw) ey = imax(ey, bitlen(pw) + ex - c->bfrac - (31 - BFP16_HEADROOM));
+    if (py) ey = imax(ey, bitlen(py) + st->ey - (31 - BFP16_HEADROOM));
+
+    int64_t y1 = shift_round(st->y1, st->ey - ey);
+    int64_t y2 = shift_round(st->y2, st->ey - ey);
+
+    // Rekursja w skali 2^(ey - CFRAC): FIR < 2^(31 - HEADROOM + CFRAC), |a| < 2^30, |y| < 2^31
+    int sh = ex - c->bfrac - ey + BFP16_CFRAC;
+    int64_t a1 = c->a[0], a2 = c->a[1];
+    uint64_t peak = 0;
+    for (int n = 0; n < len; ++n) {
+        int64_t acc = shift_round(w[n], sh);
+        acc -= a1 * y1 + a2 * y2;
+        acc = (acc + ((int64_t)1 << (BFP16_CFRAC - 1))) >> BFP16_CFRAC;
+        if (__builtin_expect(acc > INT32_MAX || acc < INT32_MIN, 0)) {
+            SAT_RECORD(SAT_OUT, acc > INT32_MAX ? SAT_OVER : SAT_UNDER);
+            acc = (acc > INT32_MAX) ? INT32_MAX : INT32_MIN;
+        }
+        y2 = y1;
+        y1 = acc;
+        w[n] = acc;
+        peak = umax(peak, iabs(acc));
+    }
+
+    st->x1 = (int32_t)ext[len + 1];
+    st->x2 = (int32_t)ext[len];
+    st->ex = ex;
+    st->y1 = (int32_t)y1;
+    st->y2 = (int32_t)y2;
+    st->ey = ey;
+
+    // Normalizacja wyjścia do szczytu bloku (mantysy na pełnych 15 bitach)
+    if (peak == 0) {
+        for (int n = 0; n < len; ++n) out[n] = 0;
+        return BFP16_EXP_MIN;
+    }
+
+    int k = bitlen(peak) - 15;
+    for (int n = 0; n < len; ++n) {
+        int64_t v = shift_round(w[n], -k);
+        out[n] = (int16_t)(v > BFP16_MANT_MAX ? BFP16_MANT_MAX : v);
+    }
+    return ey + k;
+}
+
+void CASCADE_bfp16(bfp16 *x, bfp16 *y, bfp16_sos *sos, int N, int sections) {
+    bfp16_state st[32];  // max 32 sekcje
+    int16_t buf[BFP16_BLOCK];
+
+    for (int s = 0; s < sections; ++s) {
+        st[s].x1 = st[s].x2 = st[s].y1 = st[s].y2 = 0;
+        st[s].ex = st[s].ey = BFP16_EXP_MIN;
+    }
+    for (int start = 0, b = 0; start < N; start += BFP16_BLOCK, ++b) {
+        int len = (N - start < BFP16_BLOCK) ? N - start : BFP16_BLOCK;
+        const int16_t *in = x->m + start;
+        int e = x->e[b];
+
+        for (int s = 0; s < sections; ++s) {
+            SAT_SECTION(s);
+            int16_t *out = (s == sections - 1) ? y->m + start : buf;
+            e = section_block(&st[s], &sos[s], in, e, out, len);
+            in = out;
+        }
+
+        if (sections == 0) {
+            for (int n = 0; n < len; ++n) y->m[start + n] = in[n];
+        }
+        y->e[b] = (int16_t)e;
+    }
+}
@@ -0,0 +1,31 @@
+#ifndef STRUCTURESBFP16_H
+#define STRUCTURESBFP16_H
+
+#include "fixedpointBFP16.h"
+
+// Zapas stanów y (int32): na początku bloku |y| < 2^(31 - HEADROOM), wzrost w bloku do 2^HEADROOM
+#define BFP16_HEADROOM 8
+// Współczynniki 32-bit: mantysa próbki ma 16 bitów, ale zera i bieguny eliptycznego 8. rzędu
+// przy 1 kHz wymagają więcej (przy 14 bitach sam błąd kwantyzacji b lub a ogranicza SNR do ~30 dB)
+// a1, a2 w Q3.28 (|a1| < 2 dla stabilnej sekcji)
+#define BFP16_CFRAC 28
+
+// Sekcja: b z własnym wykładnikiem (b_k = b[k] * 2^-bfrac, 2^29 <= max |b[k]| < 2^30), żeby małe
+// współczynniki licznika filtrów o niskiej częstotliwości granicznej nie znikały jak w Q12
+typedef struct {
+    int32_t b[3];
+    int32_t a[2];
+    int bfrac;
+} bfp16_sos;
+
+void bfp16_sos_from_double(const double sos_d[][6], bfp16_sos *sos, int sections);
+
+// Kaskada sekcji DF1 w trybie blokowym. Dla każdego bloku i sekcji:
+//   - wykładnik strony x = max(wykładnik wejścia, wykładnik wymagany przez stany x),
+//   - część FIR liczona dla całego bloku (wektoryzowalna), z niej i ze stanów y wykładnik y,
+//   - rekursja w int64 na stanach int32, wyjście normalizowane do 16-bitowych mantys
+//     według zmierzonego szczytu bloku (wykładnik przekazywany do następnej sekcji).
+// Sekcje przetwarzane blok po bloku (dane bloku zostają w L1). Wejście x nie jest nadpisywane.
+void CASCADE_bfp16(bfp16 *x, bfp16 *y, bfp16_sos *sos, int N, int sections);
+
+#endif
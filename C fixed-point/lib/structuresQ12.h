@@ -7,5 +7,8 @@ void DF1_q12(q12 *x, q12 *y, q12 *b, q12 *a, int N, int order);
 void DF2_q12(q12 *x, q12 *y, q12 *b, q12 *a, int N, int order);
 void TDF2_q12(q12 *x, q12 *y, q12 *b, q12 *a, int N, int order);
 void CASCADE_q12(q12 *x, q12 *y, q12 *sos, int N, int sections);
+void CASCADE_ws_q12(q12 *x, q12 *y, q12 *sos, int N, int sections, q12 *work);
+void CASCADE_ip_q12(q12 *x, q12 *y, q12 *sos, int N, int sections);
+void CASCADE_tiled_q12(q12 *x, q12 *y, q12 *sos, int N, int sections, int tile);
 
 #endif
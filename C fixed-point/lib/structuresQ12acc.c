@@ -0,0 +1,95 @@
+#include <stddef.h>
+#include "fixedpointQ12.h"
+#include "satstats.h"
+#include "structuresQ12acc.h"
+
+// === Akumulator ===
+// Wartości w skali 2^(2 * Q12_SHIFT). Sumowanie na typie bez znaku: przepełnienia pośrednie
+// znoszą się, jeśli wynik końcowy mieści się w int32 (jak bity ochronne akumulatora DSP).
+typedef uint32_t acc_t;   // akumulator
+typedef int32_t wide_t;   // sygnał wewnętrzny w skali Q12, bez saturacji do 16 bitów
+
+static inline acc_t mac(acc_t acc, q12 c, wide_t v) {
+    return acc + (acc_t)c * (acc_t)v;
+}
+
+static inline acc_t msub(acc_t acc, q12 c, wide_t v) {
+    return acc - (acc_t)c * (acc_t)v;
+}
+
+// Jedyne zaokrąglenie: do najbliższej, połówki w górę
+static inline wide_t acc_round(acc_t acc) {
+    return (wide_t)(acc + (1u << (Q12_SHIFT - 1))) >> Q12_SHIFT;
+}
+
+void DF1_q12_acc(q12 *x, q12 *y, q12 *b, q12 *a, int N, int order) {
+    for (int n = 0; n < N; ++n) {
+        acc_t acc = 0;
+        for (int i = 0; i < order; ++i) {
+            if (n - i >= 0)
+                acc = mac(acc, b[i], x[n - i]);
+            if (i > 0 && n - i >= 0)
+                acc = msub(acc, a[i], y[n - i]);
+        }
+        y[n] = q12_saturate(acc_round(acc));
+    }
+}
+
+// Stan w zaokrąglany raz na próbkę (w[0]) i trzymany w int32
+void DF2_q12_acc(q12 *x, q12 *y, q12 *b, q12 *a, int N, int order) {
+    wide_t w[64] = {0};  // max order 64
+
+    for (int n = 0; n < N; ++n) {
+        acc_t acc = (acc_t)(wide_t)x[n] << Q12_SHIFT;
+        for (int i = 1; i < order; ++i)
+            acc = msub(acc, a[i], w[i]);
+        w[0] = acc_round(acc);
+
+        acc = 0;
+        for (int i = 0; i < order; ++i)
+            acc = mac(acc, b[i], w[i]);
+
+        y[n] = q12_saturate(acc_round(acc));
+
+        for (int i = order - 1; i > 0; --i)
+            w[i] = w[i - 1];
+    }
+}
+
+// Stany w formacie akumulatora - zaokrąglane jest tylko wyjście
+void TDF2_q12_acc(q12 *x, q12 *y, q12 *b, q12 *a, int N, int order) {
+    acc_t w[64] = {0};  // max order 64
+
+    for (int n = 0; n < N; ++n) {
+        q12 yn = q12_saturate(acc_round(mac(w[0], b[0], x[n])));
+
+        for (int i = 0; i < order - 2; ++i)
+            w[i] = msub(mac(w[i + 1], b[i + 1], x[n]), a[i + 1], yn);
+        w[order - 2] = msub(mac(0, b[order - 1], x[n]), a[order - 1], yn);
+
+        y[n] = yn;
+    }
+}
+
+// Sekcje DF2 jak w CASCADE_q12; sygnał między sekcjami nie jest zaokrąglany - kolejna
+// sekcja dostaje gotowy akumulator. Zaokrąglane są tylko stany w1/w2 (trzymane w int32)
+// i wyjście, saturacja tylko na wyjściu.
+void CASCADE_q12_acc(q12 *x, q12 *y, q12 *sos, int N, int sections) {
+    wide_t w1[32] = {0}, w2[32] = {0};  // max 32 sekcje
+    SAT_SECTION(sections - 1);  // jedyna saturacja - na wyjściu ostatniej sekcji
+
+    for (int n = 0; n < N; ++n) {
+        acc_t v = (acc_t)(wide_t)x[n] << Q12_SHIFT;
+
+        for (int s = 0; s < sections; ++s) {
+            q12 *c = sos + s * 6;
+            wide_t wn = acc_round(msub(msub(v, c[4], w1[s]), c[5], w2[s]));
+
+            v = mac(mac(mac(0, c[0], wn), c[1], w1[s]), c[2], w2[s]);
+            w2[s] = w1[s];
+            w1[s] = wn;
+        }
+
+        y[n] = q12_saturate(acc_round(v));
+    }
+}
@@ -0,0 +1,15 @@
+#ifndef STRUCTURESQ12ACC_H
+#define STRUCTURESQ12ACC_H
+
+#include "fixedpointQ12.h"
+
+// Tryb z szerokim akumulatorem (jak MAC procesora DSP): iloczyny 16x16 -> 32 bez obcinania,
+// suma w int32 (24 bity ułamkowe), jedno zaokrąglenie i saturacja na próbkę wyjściową.
+// Stany TDF2 i sygnał między sekcjami kaskady w formacie akumulatora, stany DF2 w int32
+// (bez saturacji do 16 bitów). Wejście x nie jest nadpisywane.
+void DF1_q12_acc(q12 *x, q12 *y, q12 *b, q12 *a, int N, int order);
+void DF2_q12_acc(q12 *x, q12 *y, q12 *b, q12 *a, int N, int order);
+void TDF2_q12_acc(q12 *x, q12 *y, q12 *b, q12 *a, int N, int order);
+void CASCADE_q12_acc(q12 *x, q12 *y, q12 *sos, int N, int sections);
+
+#endif
@@ -0,0 +1,86 @@
+#include <stddef.h>
+#include <math.h>
+#include "fixedpointQ12.h"
+#include "satstats.h"
+#include "structuresQ12ef.h"
+
+// === Akumulator ===
+// Wartości w skali 2^(2 * Q12_SHIFT), suma na typie bez znaku (jak w structuresQ12acc.c)
+typedef uint32_t acc_t;
+
+static inline acc_t mac(acc_t acc, q12 c, int32_t v) {
+    return acc + (acc_t)c * (acc_t)v;
+}
+
+static inline acc_t msub(acc_t acc, q12 c, int32_t v) {
+    return acc - (acc_t)c * (acc_t)v;
+}
+
+// Zaokrąglenie do najbliższej (połówki w górę) z saturacją do Q12
+static inline q12 acc_round_s(acc_t acc) {
+    return q12_saturate((int32_t)(acc + (1u << (Q12_SHIFT - 1))) >> Q12_SHIFT);
+}
+
+// Wagi sprzężenia dla sekcji c (b0 b1 b2 a0 a1 a2)
+static void ef_weights(const q12 *c, int ef, int *h1, int *h2) {
+    double a1 = q12_to_double(c[4]);
+    double a2 = q12_to_double(c[5]);
+
+    *h1 = 0;
+    *h2 = 0;
+    if (ef == 1) {
+        *h1 = (int)lround(-a1 / 2.0);
+    } else if (ef == 2) {
+        *h1 = (int)lround(-a1);
+        *h2 = (int)lround(-a2);
+    }
+}
+
+void CASCADE_q12_ef(q12 *x, q12 *y, q12 *sos, int N, int sections, const int *ef_order) {
+    q12 x1[32] = {0}, x2[32] = {0}, y1[32] = {0}, y2[32] = {0};  // max 32 sekcje
+    int32_t e1[32] = {0}, e2[32] = {0};  // błąd zaokrąglenia z próbek n-1, n-2 (skala akumulatora)
+    int h1[32], h2[32];
+
+    for (int s = 0; s < sections; ++s)
+        ef_weights(sos + s * 6, ef_order ? ef_order[s] : 0, &h1[s], &h2[s]);
+
+    for (int n = 0; n < N; ++n) {
+        q12 v = x[n];
+
+        for (int s = 0; s < sections; ++s) {
+            SAT_SECTION(s);
+            q12 *c = sos + s * 6;
+
+            acc_t acc = mac(mac(mac(0, c[0], v), c[1], x1[s]), c[2], x2[s]);
+            acc = msub(msub(acc, c[4], y1[s]), c[5], y2[s]);
+            acc += (acc_t)(h1[s] * e1[s]) + (acc_t)(h2[s] * e2[s]);
+
+            q12 yn = acc_round_s(acc);
+            int32_t e = (int32_t)(acc - ((acc_t)(int32_t)yn << Q12_SHIFT));
+            // Po saturacji błąd nie mieści się w jednym LSB - nie jest zawracany
+            if (e < -(1 << (Q12_SHIFT - 1)) || e >= (1 << (Q12_SHIFT - 1))) e = 0;
+            e2[s] = e1[s];
+            e1[s] = e;
+
+            x2[s] = x1[s];
+            x1[s] = v;
+            y2[s] = y1[s];
+            y1[s] = yn;
+            v = yn;
+        }
+
+        y[n] = v;
+    }
+}
+
+void CASCADE_q12_ef1(q12 *x, q12 *y, q12 *sos, int N, int sections) {
+    int ef[32];
+    for (int s = 0; s < sections; ++s) ef[s] = 1;
+    CASCADE_q12_ef(x, y, sos, N, sections, ef);
+}
+
+void CASCADE_q12_ef2(q12 *x, q12 *y, q12 *sos, int N, int sections) {
+    int ef[32];
+    for (int s = 0; s < sections; ++s) ef[s] = 2;
+    CASCADE_q12_ef(x, y, sos, N, sections, ef);
+}
@@ -1,6 +1,7 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include "fixedpointQ12.h"
+#include "satstats.h"
 #include "structuresQ12.h"
 
 void DF1_q12(q12 *x, q12 *y, q12 *b, q12 *a, int N, int order) {
@@ -64,6 +65,7 @@ void CASCADE_q12(q12 *x, q12 *y, q12 *sos, int N, int sections) {
     q12 *out = temp;
 
     for (int s = 0; s < sections; ++s) {
+        SAT_SECTION(s);
         q12 b0 = sos[s * 6 + 0];
         q12 b1 = sos[s * 6 + 1];
         q12 b2 = sos[s * 6 + 2];
@@ -96,4 +98,121 @@ void CASCADE_q12(q12 *x, q12 *y, q12 *sos, int N, int sections) {
     }
 
     free(temp);
-}
\ No newline at end of file
+}
+
+// Wariant bez alokacji: bufor roboczy (N próbek) podaje wywołujący.
+// Ostatnia sekcja zapisuje do y, x nie jest nadpisywane.
+void CASCADE_ws_q12(q12 *x, q12 *y, q12 *sos, int N, int sections, q12 *work) {
+    q12 *in = x;
+
+    for (int s = 0; s < sections; ++s) {
+        SAT_SECTION(s);
+        q12 b0 = sos[s * 6 + 0];
+        q12 b1 = sos[s * 6 + 1];
+        q12 b2 = sos[s * 6 + 2];
+        q12 a1 = sos[s * 6 + 4];
+        q12 a2 = sos[s * 6 + 5];
+
+        int32_t w1 = 0, w2 = 0;
+        q12 *out = ((sections - 1 - s) % 2 == 0) ? y : work;
+
+        for (int n = 0; n < N; ++n) {
+            int32_t wn = q12_sub_s(in[n],
+                               q12_add_s(q12_mul_s(a1, w1), q12_mul_s(a2, w2)));
+
+            out[n] = q12_add_s(
+                         q12_add_s(q12_mul_s(b0, wn), q12_mul_s(b1, w1)),
+                         q12_mul_s(b2, w2)
+                     );
+
+            w2 = w1;
+            w1 = wn;
+        }
+
+        in = out;
+    }
+
+    if (in != y) {
+        for (int i = 0; i < N; ++i) y[i] = in[i];
+    }
+}
+
+// Wariant w miejscu: pierwsza sekcja x -> y, kolejne na y (dozwolone x == y)
+void CASCADE_ip_q12(q12 *x, q12 *y, q12 *sos, int N, int sections) {
+    q12 *in = x;
+
+    for (int s = 0; s < sections; ++s) {
+        SAT_SECTION(s);
+        q12 b0 = sos[s * 6 + 0];
+        q12 b1 = sos[s * 6 + 1];
+        q12 b2 = sos[s * 6 + 2];
+        q12 a1 = sos[s * 6 + 4];
+        q12 a2 = sos[s * 6 + 5];
+
+        int32_t w1 = 0, w2 = 0;
+
+        for (int n = 0; n < N; ++n) {
+            int32_t wn = q12_sub_s(in[n],
+                               q12_add_s(q12_mul_s(a1, w1), q12_mul_s(a2, w2)));
+
+            y[n] = q12_add_s(
+                         q12_add_s(q12_mul_s(b0, wn), q12_mul_s(b1, w1)),
+                         q12_mul_s(b2, w2)
+                     );
+
+            w2 = w1;
+            w1 = wn;
+        }
+
+        in = y;
+    }
+
+    if (in != y) {
+        for (int i = 0; i < N; ++i) y[i] = in[i];
+    }
+}
+
+// Wariant kafelkowy: kafel tile próbek przechodzi przez wszystkie sekcje,
+// stan w1/w2 sekcji przenoszony jest między kaflami (wynik jak CASCADE_q12)
+void CASCADE_tiled_q12(q12 *x, q12 *y, q12 *sos, int N, int sections, int tile) {
+    int32_t w1[32] = {0}, w2[32] = {0};  // max 32 sekcje
+
+    if (tile <= 0) tile = N;
+
+    for (int t = 0; t < N; t += tile) {
+        int end = (t + tile < N) ? t + tile : N;
+        q12 *in = x;
+
+        for (int s = 0; s < sections; ++s) {
+            SAT_SECTION(s);
+            q12 b0 = sos[s * 6 + 0];
+            q12 b1 = sos[s * 6 + 1];
+            q12 b2 = sos[s * 6 + 2];
+            q12 a1 = sos[s * 6 + 4];
+            q12 a2 = sos[s * 6 + 5];
+
+            int32_t s1 = w1[s], s2 = w2[s];
+
+            for (int n = t; n < end; ++n) {
+                int32_t wn = q12_sub_s(in[n],
+                                   q12_add_s(q12_mul_s(a1, s1), q12_mul_s(a2, s2)));
+
+                y[n] = q12_add_s(
+                             q12_add_s(q12_mul_s(b0, wn), q12_mul_s(b1, s1)),
+                             q12_mul_s(b2, s2)
+                         );
+
+                s2 = s1;
+                s1 = wn;
+            }
+
+            w1[s] = s1;
+            w2[s] = s2;
+            in = y;
+        }
+
+        if (in != y) {
+            for (int i = t; i < end; ++i) y[i] = in[i];
+        }
+    }
+}
@@ -1,36 +1,36 @@
 #include <stddef.h>
 #include <stdlib.h>
-#include "fixedpointQ31.h"
-#include "structuresQ31.h"
+#include "fixedpointQ24.h"
+#include "structuresQ24.h"
 
-void DF1_q31(q31 *x, q31 *y, q31 *b, q31 *a, int N, int order) {
+void DF1_q24(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order) {
     for (int n = 0; n < N; ++n) {
         int64_t acc = 0;
         for (int i = 0; i < order; ++i) {
             if (n - i >= 0) 
-                acc = q31_add(acc, q31_mul(b[i], x[n - i]));
+                acc = q24_add(acc, q24_mul(b[i], x[n - i]));
             if (i > 0 && n - i >= 0) 
-                acc = q31_sub(acc, q31_mul(a[i], y[n - i]));
+                acc = q24_sub(acc, q24_mul(a[i], y[n - i]));
         }
-        y[n] = q31_saturate(acc >> Q31_SHIFT);
+        y[n] = q24_saturate(acc);
     }
 }
 
-void DF2_q31(q31 *x, q31 *y, q31 *b, q31 *a, int N, int order) {
+void DF2_q24(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order) {
     int64_t w[64] = {0};  //max order 64
 
     for (int n = 0; n < N; ++n) {
         w[0] = x[n];
         for (int i = 1; i < order; ++i) {
-            w[0] = q31_sub(w[0], q31_mul(a[i], w[i]));
+            w[0] = q24_sub(w[0], q24_mul(a[i], w[i]));
         }
 
         int64_t acc = 0;
         for (int i = 0; i < order; ++i) {
-            acc = q31_add(acc, q31_mul(b[i], w[i]));
+            acc = q24_add(acc, q24_mul(b[i], w[i]));
         }
 
-        y[n] = (q31)acc;
+        y[n] = q24_saturate(acc);
 
         for (int i = order - 1; i > 0; --i) {
             w[i] = w[i - 1];
@@ -38,55 +38,55 @@ void DF2_q31(q31 *x, q31 *y, q31 *b, q31 *a, int N, int order) {
     }
 }
 
-void TDF2_q31(q31 *x, q31 *y, q31 *b, q31 *a, int N, int order) {
+void TDF2_q24(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order) {
     int64_t w[64] = {0};  // max order 64
 
     for (int n = 0; n < N; ++n) {
-        int64_t yn = q31_add(w[0], q31_mul(b[0], x[n]));
+        int64_t acc = q24_add(w[0], q24_mul(b[0], x[n]));
 
         for (int i = 0; i < order - 2; ++i) {
-            w[i] = q31_add(
-                        q31_sub(w[i + 1], q31_mul(a[i + 1], yn)),
-                        q31_mul(b[i + 1], x[n])
+            w[i] = q24_add(
+                        q24_sub(w[i + 1], q24_mul(a[i + 1], acc)),
+                        q24_mul(b[i + 1], x[n])
                     );
         }
 
-        w[order - 2] = q31_sub(q31_mul(b[order - 1], x[n]),
-                               q31_mul(a[order - 1], yn));
+        w[order - 2] = q24_sub(q24_mul(b[order - 1], x[n]),
+                               q24_mul(a[order - 1], acc));
 
-        y[n] = q31_saturate(yn >> Q31_SHIFT);
+        y[n] = q24_saturate(acc);
     }
 }
 
-void CASCADE_q31(q31 *x, q31 *y, q31 *sos, int N, int sections) {
-    q31 *temp = malloc(N * sizeof(q31));
-    q31 *in = x;
-    q31 *out = temp;
+void CASCADE_q24(q24 *x, q24 *y, q24 *sos, int N, int sections) {
+    q24 *temp = malloc(N * sizeof(q24));
+    q24 *in = x;
+    q24 *out = temp;
 
     for (int s = 0; s < sections; ++s) {
-        q31 b0 = sos[s * 6 + 0];
-        q31 b1 = sos[s * 6 + 1];
-        q31 b2 = sos[s * 6 + 2];
-        q31 a0 = sos[s * 6 + 3];  // zazwyczaj == 1
-        q31 a1 = sos[s * 6 + 4];
-        q31 a2 = sos[s * 6 + 5];
+        q24 b0 = sos[s * 6 + 0];
+        q24 b1 = sos[s * 6 + 1];
+        q24 b2 = sos[s * 6 + 2];
+        q24 a0 = sos[s * 6 + 3];
+        q24 a1 = sos[s * 6 + 4];
+        q24 a2 = sos[s * 6 + 5];
 
         int64_t w1 = 0, w2 = 0;
 
         for (int n = 0; n < N; ++n) {
-            int64_t wn = q31_sub(in[n],
-                               q31_add(q31_mul(a1, w1), q31_mul(a2, w2)));
+            int64_t wn = q24_sub(in[n],
+                               q24_add(q24_mul(a1, w1), q24_mul(a2, w2)));
 
-            out[n] = q31_add(
-                         q31_add(q31_mul(b0, wn), q31_mul(b1, w1)),
-                         q31_mul(b2, w2)
+            out[n] = q24_add(
+                         q24_add(q24_mul(b0, wn), q24_mul(b1, w1)),
+                         q24_mul(b2, w2)
                      );
 
             w2 = w1;
             w1 = wn;
         }
 
-        q31 *tmp = in;
+        q24 *tmp = in;
         in = out;
         out = tmp;
     }
@@ -96,4 +96,118 @@ void CASCADE_q31(q31 *x, q31 *y, q31 *sos, int N, int sections) {
     }
 
     free(temp);
-}
\ No newline at end of file
+}
+
+// Wariant bez alokacji: bufor roboczy (N próbek) podaje wywołujący.
+// Ostatnia sekcja zapisuje do y, x nie jest nadpisywane.
+void CASCADE_ws_q24(q24 *x, q24 *y, q24 *sos, int N, int sections, q24 *work) {
+    q24 *in = x;
+
+    for (int s = 0; s < sections; ++s) {
+        q24 b0 = sos[s * 6 + 0];
+        q24 b1 = sos[s * 6 + 1];
+        q24 b2 = sos[s * 6 + 2];
+        q24 a1 = sos[s * 6 + 4];
+        q24 a2 = sos[s * 6 + 5];
+
+        int64_t w1 = 0, w2 = 0;
+        q24 *out = ((sections - 1 - s) % 2 == 0) ? y : work;
+
+        for (int n = 0; n < N; ++n) {
+            int64_t wn = q24_sub(in[n],
+                               q24_add(q24_mul(a1, w1), q24_mul(a2, w2)));
+
+            out[n] = q24_add(
+                         q24_add(q24_mul(b0, wn), q24_mul(b1, w1)),
+                         q24_mul(b2, w2)
+                     );
+
+            w2 = w1;
+            w1 = wn;
+        }
+
+        in = out;
+    }
+
+    if (in != y) {
+        for (int i = 0; i < N; ++i) y[i] = in[i];
+    }
+}
+
+// Wariant w miejscu: pierwsza sekcja x -> y, kolejne na y (dozwolone x == y)
+void CASCADE_ip_q24(q24 *x, q24 *y, q24 *sos, int N, int sections) {
+    q24 *in = x;
+
+    for (int s = 0; s < sections; ++s) {
+        q24 b0 = sos[s * 6 + 0];
+        q24 b1 = sos[s * 6 + 1];
+        q24 b2 = sos[s * 6 + 2];
+        q24 a1 = sos[s * 6 + 4];
+        q24 a2 = sos[s * 6 + 5];
+
+        int64_t w1 = 0, w2 = 0;
+
+        for (int n = 0; n < N; ++n) {
+            int64_t wn = q24_sub(in[n],
+                               q24_add(q24_mul(a1, w1), q24_mul(a2, w2)));
+
+            y[n] = q24_add(
+                         q24_add(q24_mul(b0, wn), q24_mul(b1, w1)),
+                         q24_mul(b2, w2)
+                     );
+
+            w2 = w1;
+            w1 = wn;
+        }
+
+        in = y;
+    }
+
+    if (in != y) {
+        for (int i = 0; i < N; ++i) y[i] = in[i];
+    }
+}
+
+// Wariant kafelkowy: kafel tile próbek przechodzi przez wszystkie sekcje,
+// stan w1/w2 sekcji przenoszony jest między kaflami (wynik jak CASCADE_q24)
+void CASCADE_tiled_q24(q24 *x, q24 *y, q24 *sos, int N, int sections, int tile) {
+    int64_t w1[32] = {0}, w2[32] = {0};  // max 32 sekcje
+
+    if (tile <= 0) tile = N;
+
+    for (int t = 0; t < N; t += tile) {
+        int end = (t + tile < N) ? t + tile : N;
+        q24 *in = x;
+
+        for (int s = 0; s < sections; ++s) {
+            q24 b0 = sos[s * 6 + 0];
+            q24 b1 = sos[s * 6 + 1];
+            q24 b2 = sos[s * 6 + 2];
+            q24 a1 = sos[s * 6 + 4];
+            q24 a2 = sos[s * 6 + 5];
+
+            int64_t s1 = w1[s], s2 = w2[s];
+
+            for (int n = t; n < end; ++n) {
+                int64_t wn = q24_sub(in[n],
+                                   q24_add(q24_mul(a1, s1), q24_mul(a2, s2)));
+
+                y[n] = q24_add(
+                             q24_add(q24_mul(b0, wn), q24_mul(b1, s1)),
+                             q24_mul(b2, s2)
+                         );
+
+                s2 = s1;
+                s1 = wn;
+            }
+
+            w1[s] = s1;
+            w2[s] = s2;
+            in = y;
+        }
+
+        if (in != y) {
+            for (int i = t; i < end; ++i) y[i] = in[i];
+        }
+    }
+}
@@ -1,11 +1,14 @@
-#ifndef STRUCTURESQ31_H
-#define STRUCTURESQ31_H
+#ifndef STRUCTURESQ24_H
+#define STRUCTURESQ24_H
 
-#include "fixedpointQ31.h"
+#include "fixedpointQ24.h"
 
-void DF1_q31(q31 *x, q31 *y, q31 *b, q31 *a, int N, int order);
-void DF2_q31(q31 *x, q31 *y, q31 *b, q31 *a, int N, int order);
-void TDF2_q31(q31 *x, q31 *y, q31 *b, q31 *a, int N, int order);
-void CASCADE_q31(q31 *x, q31 *y, q31 *sos, int N, int sections);
+void DF1_q24(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order);
+void DF2_q24(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order);
+void TDF2_q24(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order);
+void CASCADE_q24(q24 *x, q24 *y, q24 *sos, int N, int sections);
+void CASCADE_ws_q24(q24 *x, q24 *y, q24 *sos, int N, int sections, q24 *work);
+void CASCADE_ip_q24(q24 *x, q24 *y, q24 *sos, int N, int sections);
+void CASCADE_tiled_q24(q24 *x, q24 *y, q24 *sos, int N, int sections, int tile);
 
 #endif
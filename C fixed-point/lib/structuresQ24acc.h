@@ -0,0 +1,15 @@
+#ifndef STRUCTURESQ24ACC_H
+#define STRUCTURESQ24ACC_H
+
+#include "fixedpointQ24.h"
+
+// Tryb z szerokim akumulatorem (jak MAC procesora DSP): iloczyny 32x32 -> 64 bez obcinania,
+// suma w int64 (48 bitów ułamkowych), jedno zaokrąglenie i saturacja na próbkę wyjściową.
+// Stany TDF2 i sygnał między sekcjami kaskady w formacie akumulatora, stany DF2 w int64
+// (bez saturacji do 32 bitów). Wejście x nie jest nadpisywane.
+void DF1_q24_acc(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order);
+void DF2_q24_acc(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order);
+void TDF2_q24_acc(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order);
+void CASCADE_q24_acc(q24 *x, q24 *y, q24 *sos, int N, int sections);
+
+#endif
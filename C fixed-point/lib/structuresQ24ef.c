@@ -0,0 +1,86 @@
+#include <stddef.h>
+#include <math.h>
+#include "fixedpointQ24.h"
+#include "satstats.h"
+#include "structuresQ24ef.h"
+
+// === Akumulator ===
+// Wartości w skali 2^(2 * Q24_SHIFT), suma na typie bez znaku (jak w structuresQ24acc.c)
+typedef uint64_t acc_t;
+
+static inline acc_t mac(acc_t acc, q24 c, int64_t v) {
+    return acc + (acc_t)c * (acc_t)v;
+}
+
+static inline acc_t msub(acc_t acc, q24 c, int64_t v) {
+    return acc - (acc_t)c * (acc_t)v;
+}
+
+// Zaokrąglenie do najbliższej (połówki w górę) z saturacją do Q24
+static inline q24 acc_round_s(acc_t acc) {
+    return q24_saturate((int64_t)(acc + ((acc_t)1 << (Q24_SHIFT - 1))) >> Q24_SHIFT);
+}
+
+// Wagi sprzężenia dla sekcji c (b0 b1 b2 a0 a1 a2)
+static void ef_weights(const q24 *c, int ef, int *h1, int *h2) {
+    double a1 = q24_to_double(c[4]);
+    double a2 = q24_to_double(c[5]);
+
+    *h1 = 0;
+    *h2 = 0;
+    if (ef == 1) {
+        *h1 = (int)lround(-a1 / 2.0);
+    } else if (ef == 2) {
+        *h1 = (int)lround(-a1);
+        *h2 = (int)lround(-a2);
+    }
+}
+
+void CASCADE_q24_ef(q24 *x, q24 *y, q24 *sos, int N, int sections, const int *ef_order) {
+    q24 x1[32] = {0}, x2[32] = {0}, y1[32] = {0}, y2[32] = {0};  // max 32 sekcje
+    int64_t e1[32] = {0}, e2[32] = {0};  // błąd zaokrąglenia z próbek n-1, n-2 (skala akumulatora)
+    int h1[32], h2[32];
+
+    for (int s = 0; s < sections; ++s)
+        ef_weights(sos + s * 6, ef_order ? ef_order[s] : 0, &h1[s], &h2[s]);
+
+    for (int n = 0; n < N; ++n) {
+        q24 v = x[n];
+
+        for (int s = 0; s < sections; ++s) {
+            SAT_SECTION(s);
+            q24 *c = sos + s * 6;
+
+            acc_t acc = mac(mac(mac(0, c[0], v), c[1], x1[s]), c[2], x2[s]);
+            acc = msub(msub(acc, c[4], y1[s]), c[5], y2[s]);
+            acc += (acc_t)(h1[s] * e1[s]) + (acc_t)(h2[s] * e2[s]);
+
+            q24 yn = acc_round_s(acc);
+            int64_t e = (int64_t)(acc - ((acc_t)(int64_t)yn << Q24_SHIFT));
+            // Po saturacji błąd nie mieści się w jednym LSB - nie jest zawracany
+            if (e < -((int64_t)1 << (Q24_SHIFT - 1)) || e >= ((int64_t)1 << (Q24_SHIFT - 1))) e = 0;
+            e2[s] = e1[s];
+            e1[s] = e;
+
+            x2[s] = x1[s];
+            x1[s] = v;
+            y2[s] = y1[s];
+            y1[s] = yn;
+            v = yn;
+        }
+
+        y[n] = v;
+    }
+}
+
+void CASCADE_q24_ef1(q24 *x, q24 *y, q24 *sos, int N, int sections) {
+    int ef[32];
+    for (int s = 0; s < sections; ++s) ef[s] = 1;
+    CASCADE_q24_ef(x, y, sos, N, sections, ef);
+}
+
+void CASCADE_q24_ef2(q24 *x, q24 *y, q24 *sos, int N, int sections) {
+    int ef[32];
+    for (int s = 0; s < sections; ++s) ef[s] = 2;
+    CASCADE_q24_ef(x, y, sos, N, sections, ef);
+}
@@ -0,0 +1,20 @@
+#ifndef STRUCTURESQ24EF_H
+#define STRUCTURESQ24EF_H
+
+#include "fixedpointQ24.h"
+
+// Kaskada sekcji DF1 ze sprzężeniem zwrotnym błędu kwantyzacji (noise shaping).
+// Sekcja liczona w akumulatorze 64-bit i zaokrąglana raz; stany x1/x2/y1/y2 i sygnał między
+// sekcjami w Q24 (32 bity). DF1, bo stany DF2 przy biegunach blisko z = 1 wychodzą poza zakres
+// formatu próbki. Błąd zaokrąglenia wyjścia sekcji wraca do kolejnych próbek z wagami całkowitymi:
+//   ef = 0 - bez sprzężenia
+//   ef = 1 - pierwszego rzędu, 1 - h1 z^-1, h1 = round(-a1 / 2) (zero przy DC lub Nyquiście)
+//   ef = 2 - drugiego rzędu, 1 - h1 z^-1 - h2 z^-2, h1 = round(-a1), h2 = round(-a2) (≈ A(z) sekcji)
+// ef_order[s] wybiera rodzaj dla sekcji s (NULL = 0 dla wszystkich). Wejście x nie jest nadpisywane.
+void CASCADE_q24_ef(q24 *x, q24 *y, q24 *sos, int N, int sections, const int *ef_order);
+
+// Wspólna sygnatura z pozostałymi jądrami: ten sam rodzaj sprzężenia we wszystkich sekcjach
+void CASCADE_q24_ef1(q24 *x, q24 *y, q24 *sos, int N, int sections);
+void CASCADE_q24_ef2(q24 *x, q24 *y, q24 *sos, int N, int sections);
+
+#endif
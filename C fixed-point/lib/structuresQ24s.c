@@ -1,6 +1,7 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include "fixedpointQ24.h"
+#include "satstats.h"
 #include "structuresQ24s.h"
 
 void DF1_q24(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order) {
@@ -63,6 +64,7 @@ void CASCADE_q24(q24 *x, q24 *y, q24 *sos, int N, int sections) {
     q24 *out = temp;
 
     for (int s = 0; s < sections; ++s) {
+        SAT_SECTION(s);
         q24 b0 = sos[s * 6 + 0];
         q24 b1 = sos[s * 6 + 1];
         q24 b2 = sos[s * 6 + 2];
@@ -95,4 +97,121 @@ void CASCADE_q24(q24 *x, q24 *y, q24 *sos, int N, int sections) {
     }
 
     free(temp);
-}
\ No newline at end of file
+}
+
+// Wariant bez alokacji: bufor roboczy (N próbek) podaje wywołujący.
+// Ostatnia sekcja zapisuje do y, x nie jest nadpisywane.
+void CASCADE_ws_q24(q24 *x, q24 *y, q24 *sos, int N, int sections, q24 *work) {
+    q24 *in = x;
+
+    for (int s = 0; s < sections; ++s) {
+        SAT_SECTION(s);
+        q24 b0 = sos[s * 6 + 0];
+        q24 b1 = sos[s * 6 + 1];
+        q24 b2 = sos[s * 6 + 2];
+        q24 a1 = sos[s * 6 + 4];
+        q24 a2 = sos[s * 6 + 5];
+
+        int64_t w1 = 0, w2 = 0;
+        q24 *out = ((sections - 1 - s) % 2 == 0) ? y : work;
+
+        for (int n = 0; n < N; ++n) {
+            int64_t wn = q24_sub_s(in[n],
+                               q24_add_s(q24_mul(a1, w1), q24_mul_s(a2, w2)));
+
+            out[n] = q24_add(
+                         q24_add_s(q24_mul(b0, wn), q24_mul_s(b1, w1)),
+                         q24_mul_s(b2, w2)
+                     );
+
+            w2 = w1;
+            w1 = wn;
+        }
+
+        in = out;
+    }
+
+    if (in != y) {
+        for (int i = 0; i < N; ++i) y[i] = in[i];
+    }
+}
+
+// Wariant w miejscu: pierwsza sekcja x -> y, kolejne na y (dozwolone x == y)
+void CASCADE_ip_q24(q24 *x, q24 *y, q24 *sos, int N, int sections) {
+    q24 *in = x;
+
+    for (int s = 0; s < sections; ++s) {
+        SAT_SECTION(s);
+        q24 b0 = sos[s * 6 + 0];
+        q24 b1 = sos[s * 6 + 1];
+        q24 b2 = sos[s * 6 + 2];
+        q24 a1 = sos[s * 6 + 4];
+        q24 a2 = sos[s * 6 + 5];
+
+        int64_t w1 = 0, w2 = 0;
+
+        for (int n = 0; n < N; ++n) {
+            int64_t wn = q24_sub_s(in[n],
+                               q24_add_s(q24_mul(a1, w1), q24_mul_s(a2, w2)));
+
+            y[n] = q24_add(
+                         q24_add_s(q24_mul(b0, wn), q24_mul_s(b1, w1)),
+                         q24_mul_s(b2, w2)
+                     );
+
+            w2 = w1;
+            w1 = wn;
+        }
+
+        in = y;
+    }
+
+    if (in != y) {
+        for (int i = 0; i < N; ++i) y[i] = in[i];
+    }
+}
+
+// Wariant kafelkowy: kafel tile próbek przechodzi przez wszystkie sekcje,
+// stan w1/w2 sekcji przenoszony jest między kaflami (wynik jak CASCADE_q24)
+void CASCADE_tiled_q24(q24 *x, q24 *y, q24 *sos, int N, int sections, int tile) {
+    int64_t w1[32] = {0}, w2[32] = {0};  // max 32 sekcje
+
+    if (tile <= 0) tile = N;
+
+    for (int t = 0; t < N; t += tile) {
+        int end = (t + tile < N) ? t + tile : N;
+        q24 *in = x;
+
+        for (int s = 0; s < sections; ++s) {
+            SAT_SECTION(s);
+            q24 b0 = sos[s * 6 + 0];
+            q24 b1 = sos[s * 6 + 1];
+            q24 b2 = sos[s * 6 + 2];
+            q24 a1 = sos[s * 6 + 4];
+            q24 a2 = sos[s * 6 + 5];
+
+            int64_t s1 = w1[s], s2 = w2[s];
+
+            for (int n = t; n < end; ++n) {
+                int64_t wn = q24_sub_s(in[n],
+                                   q24_add_s(q24_mul(a1, s1), q24_mul_s(a2, s2)));
+
+                y[n] = q24_add(
+                             q24_add_s(q24_mul(b0, wn), q24_mul_s(b1, s1)),
+                             q24_mul_s(b2, s2)
+                         );
+
+                s2 = s1;
+                s1 = wn;
+            }
+
+            w1[s] = s1;
+            w2[s] = s2;
+            in = y;
+        }
+
+        if (in != y) {
+            for (int i = t; i < end; ++i) y[i] = in[i];
+        }
+    }
+}
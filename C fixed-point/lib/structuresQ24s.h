@@ -7,5 +7,8 @@ void DF1_q24(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order);
 void DF2_q24(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order);
 void TDF2_q24(q24 *x, q24 *y, q24 *b, q24 *a, int N, int order);
 void CASCADE_q24(q24 *x, q24 *y, q24 *sos, int N, int sections);
+void CASCADE_ws_q24(q24 *x, q24 *y, q24 *sos, int N, int sections, q24 *work);
+void CASCADE_ip_q24(q24 *x, q24 *y, q24 *sos, int N, int sections);
+void CASCADE_tiled_q24(q24 *x, q24 *y, q24 *sos, int N, int sections, int tile);
 
 #endif
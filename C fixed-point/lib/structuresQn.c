@@ -0,0 +1,113 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include "satstats.h"
+#include "structuresQn.h"
+
+// === Instancje szablonu ===
+#define QN_CAT_(base, name, pol) base##_##name##_##pol
+#define QN_CAT(base, name, pol) QN_CAT_(base, name, pol)
+#define QN_FN(base) QN_CAT(base, QN_NAME, QN_PSUFFIX)
+
+// Q0.15
+#define QN_NAME q15
+#define QN_T int16_t
+#define QN_WIDE int32_t
+#define QN_FRAC 15
+#define QN_CFRAC 12
+#include "structuresQn_policies.h"
+#undef QN_NAME
+#undef QN_T
+#undef QN_WIDE
+#undef QN_FRAC
+#undef QN_CFRAC
+
+// Q0.31 - iloczyny i sumy w 128 bitach
+#define QN_NAME q31
+#define QN_T int32_t
+#define QN_WIDE __int128
+#define QN_FRAC 31
+#define QN_CFRAC 24
+#include "structuresQn_policies.h"
+#undef QN_NAME
+#undef QN_T
+#undef QN_WIDE
+#undef QN_FRAC
+#undef QN_CFRAC
+
+// Q3.12 (jak fixedpointQ12.h)
+#define QN_NAME q12
+#define QN_T int16_t
+#define QN_WIDE int32_t
+#define QN_FRAC 12
+#define QN_CFRAC 12
+#include "structuresQn_policies.h"
+#undef QN_NAME
+#undef QN_T
+#undef QN_WIDE
+#undef QN_FRAC
+#undef QN_CFRAC
+
+// Q7.24 (jak fixedpointQ24.h)
+#define QN_NAME q24
+#define QN_T int32_t
+#define QN_WIDE int64_t
+#define QN_FRAC 24
+#define QN_CFRAC 24
+#include "structuresQn_policies.h"
+#undef QN_NAME
+#undef QN_T
+#undef QN_WIDE
+#undef QN_FRAC
+#undef QN_CFRAC
+
+// Format własny (structuresQn.h: QN_CUSTOM_*)
+#define QN_NAME qc
+#define QN_T QN_CUSTOM_T
+#define QN_WIDE QN_CUSTOM_WIDE
+#define QN_FRAC QN_CUSTOM_FRAC
+#define QN_CFRAC QN_CUSTOM_CFRAC
+#include "structuresQn_policies.h"
+#undef QN_NAME
+#undef QN_T
+#undef QN_WIDE
+#undef QN_FRAC
+#undef QN_CFRAC
+
+// === Tabela ===
+#define QN_ENTRY(name, T, W, frac, cfrac, pol) \
+    { #name, #pol, sizeof(T), frac, cfrac, \
+      (qn_ba_func)DF1_##name##_##pol, (qn_ba_func)DF2_##name##_##pol, \
+      (qn_ba_func)TDF2_##name##_##pol, (qn_sos_func)CASCADE_##name##_##pol },
+
+#define QN_ENTRIES(name, T, W, frac, cfrac) \
+    QN_ENTRY(name, T, W, frac, cfrac, wrap) \
+    QN_ENTRY(name, T, W, frac, cfrac, sat) \
+    QN_ENTRY(name, T, W, frac, cfrac, satcnt)
+
+const qn_kernels qn_table[] = {
+    QN_FORMATS(QN_ENTRIES)
+};
+
+const int qn_table_size = sizeof(qn_table) / sizeof(qn_table[0]);
+
+// === Konwersje ===
+void qn_from_double(const qn_kernels *k, void *dst, const double *src, int n, int frac) {
+    double max = ldexp(1.0, 8 * k->bytes - 1) - 1.0;
+    for (int i = 0; i < n; ++i) {
+        double v = src[i] * ldexp(1.0, frac);
+        if (v > max) v = max;
+        if (v < -max - 1.0) v = -max - 1.0;
+        if (k->bytes == 2) ((int16_t*)dst)[i] = (int16_t)v;
+        else if (k->bytes == 4) ((int32_t*)dst)[i] = (int32_t)v;
+        else ((int64_t*)dst)[i] = (int64_t)v;
+    }
+}
+
+double qn_to_double(const qn_kernels *k, const void *src, int i, int frac) {
+    double v;
+    if (k->bytes == 2) v = ((const int16_t*)src)[i];
+    else if (k->bytes == 4) v = ((const int32_t*)src)[i];
+    else v = (double)((const int64_t*)src)[i];
+    return ldexp(v, -frac);
+}
@@ -0,0 +1,73 @@
+#ifndef STRUCTURESQN_H
+#define STRUCTURESQN_H
+
+#include <stdint.h>
+
+// === Jądra dla dowolnego formatu Qm.n i polityki przepełnienia ===
+// Jeden szablon (structuresQn_impl.h) zamiast czterech plików structuresQ12/Q12s/Q24/Q24s.
+// Funkcje: DF1_<format>_<polityka>, DF2_..., TDF2_..., CASCADE_..., np. TDF2_q15_sat.
+// Polityki: wrap (zawijanie), sat (saturacja), satcnt (saturacja + telemetria satstats.h).
+// Współczynniki mają własną liczbę bitów ułamkowych (Q15 i Q31 nie mieszczą |a| >= 1),
+// iloczyn współczynnika i próbki przesuwany jest o cfrac i wraca do formatu sygnału.
+
+#define QN_WRAP     0
+#define QN_SAT      1
+#define QN_SATCOUNT 2
+
+// Format własny (qc), np. -DQN_CUSTOM_T=int32_t -DQN_CUSTOM_FRAC=20 -DQN_CUSTOM_CFRAC=20
+#ifndef QN_CUSTOM_T
+#define QN_CUSTOM_T int32_t
+#endif
+#ifndef QN_CUSTOM_WIDE
+#define QN_CUSTOM_WIDE int64_t
+#endif
+#ifndef QN_CUSTOM_FRAC
+#define QN_CUSTOM_FRAC 20
+#endif
+#ifndef QN_CUSTOM_CFRAC
+#define QN_CUSTOM_CFRAC QN_CUSTOM_FRAC
+#endif
+
+// X(nazwa, typ próbki, typ pośredni, bity ułamkowe sygnału, bity ułamkowe współczynników)
+// Q15 ma współczynniki jak q12 (Q3.12), Q31 jak q24 (Q7.24); q12 / q24 jak w fixedpointQ*.h
+#define QN_FORMATS(X) \
+    X(q15, int16_t, int32_t,  15, 12) \
+    X(q31, int32_t, __int128, 31, 24) \
+    X(q12, int16_t, int32_t,  12, 12) \
+    X(q24, int32_t, int64_t,  24, 24) \
+    X(qc,  QN_CUSTOM_T, QN_CUSTOM_WIDE, QN_CUSTOM_FRAC, QN_CUSTOM_CFRAC)
+
+#define QN_DECLARE_POLICY(name, T, pol) \
+    void DF1_##name##_##pol(T *x, T *y, T *b, T *a, int N, int order); \
+    void DF2_##name##_##pol(T *x, T *y, T *b, T *a, int N, int order); \
+    void TDF2_##name##_##pol(T *x, T *y, T *b, T *a, int N, int order); \
+    void CASCADE_##name##_##pol(T *x, T *y, T *sos, int N, int sections);
+
+#define QN_DECLARE(name, T, W, frac, cfrac) \
+    QN_DECLARE_POLICY(name, T, wrap) \
+    QN_DECLARE_POLICY(name, T, sat) \
+    QN_DECLARE_POLICY(name, T, satcnt)
+
+QN_FORMATS(QN_DECLARE)
+
+// === Tabela wariantów (do przeglądu we wszystkich programach analizy) ===
+typedef void (*qn_ba_func)(void*, void*, void*, void*, int, int);
+typedef void (*qn_sos_func)(void*, void*, void*, int, int);
+
+typedef struct {
+    const char *name;     // "q15", "q31", ...
+    const char *policy;   // "wrap", "sat", "satcnt"
+    int bytes;            // rozmiar próbki
+    int frac, cfrac;
+    qn_ba_func df1, df2, tdf2;
+    qn_sos_func cascade;
+} qn_kernels;
+
+extern const qn_kernels qn_table[];
+extern const int qn_table_size;
+
+// Konwersje z saturacją (np. impuls 1.0 w Q15 -> 32767)
+void qn_from_double(const qn_kernels *k, void *dst, const double *src, int n, int frac);
+double qn_to_double(const qn_kernels *k, const void *src, int i, int frac);
+
+#endif
@@ -0,0 +1,119 @@
+// === Szablon jąder DF1 / DF2 / TDF2 / CASCADE dla dowolnego formatu Qm.n ===
+// Plik dołączany wielokrotnie przez structuresQn.c (bez strażnika nagłówka). Przed dołączeniem:
+//   QN_NAME    - nazwa formatu w nazwach funkcji (q15, q31, ...)
+//   QN_T       - typ próbki (int16_t, int32_t, ...)
+//   QN_WIDE    - typ pośredni pojedynczej operacji (iloczyn, suma)
+//   QN_FRAC    - bity ułamkowe sygnału
+//   QN_CFRAC   - bity ułamkowe współczynników (iloczyn c * v przesuwany o QN_CFRAC)
+//   QN_POLICY  - QN_WRAP / QN_SAT / QN_SATCOUNT, QN_PSUFFIX - wrap / sat / satcnt
+// Kolejność operacji jak w structuresQ12s.c: każdy wynik pośredni wraca do formatu próbki
+// (zawinięcie albo saturacja). Wejście x nie jest nadpisywane.
+
+#define QN_MAX_ ((QN_WIDE)(((uint64_t)1 << (8 * sizeof(QN_T) - 1)) - 1))
+#define QN_MIN_ (-QN_MAX_ - 1)
+
+static inline QN_T QN_FN(qn_fit)(QN_WIDE v, sat_op op) {
+#if QN_POLICY == QN_WRAP
+    (void)op;
+    return (QN_T)v;
+#else
+    QN_WIDE c = (v > QN_MAX_) ? QN_MAX_ : v;
+    c = (c < QN_MIN_) ? QN_MIN_ : c;
+#if QN_POLICY == QN_SATCOUNT
+    if (__builtin_expect(c != v, 0))
+        SAT_RECORD(op, v > QN_MAX_ ? SAT_OVER : SAT_UNDER);
+#else
+    (void)op;
+#endif
+    return (QN_T)c;
+#endif
+}
+
+static inline QN_T QN_FN(qn_add)(QN_T a, QN_T b) { return QN_FN(qn_fit)((QN_WIDE)a + b, SAT_ADD); }
+static inline QN_T QN_FN(qn_sub)(QN_T a, QN_T b) { return QN_FN(qn_fit)((QN_WIDE)a - b, SAT_SUB); }
+static inline QN_T QN_FN(qn_mul)(QN_T c, QN_T v) { return QN_FN(qn_fit)(((QN_WIDE)c * v) >> QN_CFRAC, SAT_MUL); }
+
+#define ADD_ QN_FN(qn_add)
+#define SUB_ QN_FN(qn_sub)
+#define MUL_ QN_FN(qn_mul)
+
+void QN_FN(DF1)(QN_T *x, QN_T *y, QN_T *b, QN_T *a, int N, int order) {
+    for (int n = 0; n < N; ++n) {
+        QN_T acc = 0;
+        for (int i = 0; i < order; ++i) {
+            if (n - i >= 0)
+                acc = ADD_(acc, MUL_(b[i], x[n - i]));
+            if (i > 0 && n - i >= 0)
+                acc = SUB_(acc, MUL_(a[i], y[n - i]));
+        }
+        y[n] = acc;
+    }
+}
+
+void QN_FN(DF2)(QN_T *x, QN_T *y, QN_T *b, QN_T *a, int N, int order) {
+    QN_T w[64] = {0};  // max order 64
+
+    for (int n = 0; n < N; ++n) {
+        w[0] = x[n];
+        for (int i = 1; i < order; ++i)
+            w[0] = SUB_(w[0], MUL_(a[i], w[i]));
+
+        QN_T acc = 0;
+        for (int i = 0; i < order; ++i)
+            acc = ADD_(acc, MUL_(b[i], w[i]));
+
+        y[n] = acc;
+
+        for (int i = order - 1; i > 0; --i)
+            w[i] = w[i - 1];
+    }
+}
+
+void QN_FN(TDF2)(QN_T *x, QN_T *y, QN_T *b, QN_T *a, int N, int order) {
+    QN_T w[64] = {0};  // max order 64
+
+    for (int n = 0; n < N; ++n) {
+        QN_T acc = ADD_(w[0], MUL_(b[0], x[n]));
+
+        for (int i = 0; i < order - 2; ++i)
+            w[i] = ADD_(SUB_(w[i + 1], MUL_(a[i + 1], acc)), MUL_(b[i + 1], x[n]));
+        w[order - 2] = SUB_(MUL_(b[order - 1], x[n]), MUL_(a[order - 1], acc));
+
+        y[n] = acc;
+    }
+}
+
+// Pierwsza sekcja x -> y, kolejne w miejscu na y (jak CASCADE_ip_q12)
+void QN_FN(CASCADE)(QN_T *x, QN_T *y, QN_T *sos, int N, int sections) {
+    QN_T *in = x;
+
+    for (int s = 0; s < sections; ++s) {
+        SAT_SECTION(s);
+        QN_T b0 = sos[s * 6 + 0];
+        QN_T b1 = sos[s * 6 + 1];
+        QN_T b2 = sos[s * 6 + 2];
+        QN_T a1 = sos[s * 6 + 4];
+        QN_T a2 = sos[s * 6 + 5];
+
+        QN_T w1 = 0, w2 = 0;
+
+        for (int n = 0; n < N; ++n) {
+            QN_T wn = SUB_(in[n], ADD_(MUL_(a1, w1), MUL_(a2, w2)));
+            y[n] = ADD_(ADD_(MUL_(b0, wn), MUL_(b1, w1)), MUL_(b2, w2));
+            w2 = w1;
+            w1 = wn;
+        }
+
+        in = y;
+    }
+
+    if (in != y) {
+        for (int i = 0; i < N; ++i) y[i] = in[i];
+    }
+}
+
+#undef ADD_
+#undef SUB_
+#undef MUL_
+#undef QN_MAX_
+#undef QN_MIN_
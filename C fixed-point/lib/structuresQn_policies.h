@@ -0,0 +1,19 @@
+// Dołączany przez structuresQn.c raz na format: szablon dla trzech polityk przepełnienia
+
+#define QN_POLICY QN_WRAP
+#define QN_PSUFFIX wrap
+#include "structuresQn_impl.h"
+#undef QN_POLICY
+#undef QN_PSUFFIX
+
+#define QN_POLICY QN_SAT
+#define QN_PSUFFIX sat
+#include "structuresQn_impl.h"
+#undef QN_POLICY
+#undef QN_PSUFFIX
+
+#define QN_POLICY QN_SATCOUNT
+#define QN_PSUFFIX satcnt
+#include "structuresQn_impl.h"
+#undef QN_POLICY
+#undef QN_PSUFFIX
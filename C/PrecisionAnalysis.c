@@ -4,12 +4,15 @@
 #include <time.h>
 #include <math.h>
 #include "./lib/structures.h"
+#include "./lib/bufpool.h"
+#include "./lib/siggen.h"
+#include "./lib/denormal.h"
 #include "../_filtercoeffs/filtercoeffs.h"
 
 #define N 4096 //dlugosc impulse i rand
 
 // Analiza precyzji filtrowania w języku C (reprezentacja zmiennopozycyjna)
-//Kompilacja: gcc -o PrecisionAnalysis PrecisionAnalysis.c ./lib/structures.c ../_filtercoeffs/filtercoeffs.c
+//Kompilacja: gcc -o PrecisionAnalysis PrecisionAnalysis.c ./lib/structures.c ./lib/bufpool.c ./lib/siggen.c ./lib/denormal.c ../_filtercoeffs/filtercoeffs.c -lm
 
 double rand_signal[N];
 
@@ -27,10 +30,10 @@ void precision_analysis(FILE *fp, const char *filter_name, const char *structure
     if (cut_ptr != NULL)
         sscanf(cut_ptr, "_cut%d", &cutoff);
 
-    float *x_f = calloc(N, sizeof(float));
-    float *y_f = calloc(N, sizeof(float));
-    double *x_d = calloc(N, sizeof(double));
-    double *y_d = calloc(N, sizeof(double));
+    float *x_f = pool_zeroed(POOL_X, sizeof(float) * N);
+    float *y_f = pool_zeroed(POOL_Y, sizeof(float) * N);
+    double *x_d = pool_zeroed(POOL_X2, sizeof(double) * N);
+    double *y_d = pool_zeroed(POOL_Y2, sizeof(double) * N);
 
     // === impulse ===
     x_f[0] = 1.0f;
@@ -66,14 +69,13 @@ void precision_analysis(FILE *fp, const char *filter_name, const char *structure
     }
     fprintf(fp, "\n");
 
-    free(x_f); free(y_f); free(x_d); free(y_d);
 }
 
-// === Analiza precyzji (SOS) ===
-void precision_analysis_cascade(FILE *fp, const char *filter_name,
-                                 void (*func_f)(float*, float*, float*, int, int),
-                                 void (*func_d)(double*, double*, double*, int, int),
-                                 float *sos_f, double *sos_d, int sections) {
+// === Analiza precyzji (SOS: CASCADE, BLOCKSS) ===
+void precision_analysis_sos(FILE *fp, const char *filter_name, const char *structure,
+                            void (*func_f)(float*, float*, float*, int, int),
+                            void (*func_d)(double*, double*, double*, int, int),
+                            float *sos_f, double *sos_d, int sections) {
 
     int cutoff = -1;
     char filter_type[32];
@@ -83,10 +85,10 @@ void precision_analysis_cascade(FILE *fp, const char *filter_name,
     if (cut_ptr != NULL)
         sscanf(cut_ptr, "_cut%d", &cutoff);
 
-    float *x_f = calloc(N, sizeof(float));
-    float *y_f = calloc(N, sizeof(float));
-    double *x_d = calloc(N, sizeof(double));
-    double *y_d = calloc(N, sizeof(double));
+    float *x_f = pool_zeroed(POOL_X, sizeof(float) * N);
+    float *y_f = pool_zeroed(POOL_Y, sizeof(float) * N);
+    double *x_d = pool_zeroed(POOL_X2, sizeof(double) * N);
+    double *y_d = pool_zeroed(POOL_Y2, sizeof(double) * N);
 
     // === impulse ===
     x_f[0] = 1.0f;
@@ -95,7 +97,7 @@ void precision_analysis_cascade(FILE *fp, const char *filter_name,
     func_f(x_f, y_f, sos_f, N, sections);
     func_d(x_d, y_d, sos_d, N, sections);
 
-    fprintf(fp, "%s,float,CASCADE,%d,%d,impulse,", filter_type, cutoff, 2 * sections);
+    fprintf(fp, "%s,float,%s,%d,%d,impulse,", filter_type, structure, cutoff, 2 * sections);
     for (int i = 0; i < N; i++) {
         double err = y_d[i] - y_f[i];
         fprintf(fp, "%.8e", err);
@@ -114,7 +116,7 @@ void precision_analysis_cascade(FILE *fp, const char *filter_name,
     func_f(x_f, y_f, sos_f, N, sections);
     func_d(x_d, y_d, sos_d, N, sections);
 
-    fprintf(fp, "%s,float,CASCADE,%d,%d,rand,", filter_type, cutoff, 2 * sections);
+    fprintf(fp, "%s,float,%s,%d,%d,rand,", filter_type, structure, cutoff, 2 * sections);
     for (int i = 0; i < N; i++) {
         double err = y_d[i] - y_f[i];
         fprintf(fp, "%.8e", err);
@@ -122,16 +124,126 @@ void precision_analysis_cascade(FILE *fp, const char *filter_name,
     }
     fprintf(fp, "\n");
 
-    free(x_f); free(y_f); free(x_d); free(y_d);
 }
 
 
-int main() {
+void precision_analysis_cascade(FILE *fp, const char *filter_name,
+                                 void (*func_f)(float*, float*, float*, int, int),
+                                 void (*func_d)(double*, double*, double*, int, int),
+                                 float *sos_f, double *sos_d, int sections) {
+    precision_analysis_sos(fp, filter_name, "CASCADE", func_f, func_d, sos_f, sos_d, sections);
+}
 
-    srand(12345);
-    for (int i = 0; i < N; i++) {
-        rand_signal[i] = ((double)rand() / RAND_MAX) * 1.0 - 0.5;
+// === Liczby podnormalne ===
+// Odpowiedź impulsowa długości N_DENORMAL (ogon schodzi do liczb podnormalnych) w trybach z denormal.h.
+// Błąd liczony względem double bez zmian trybu; subnormal_outputs: próbki podnormalne na wyjściu.
+#define N_DENORMAL 48000
+
+static void denormal_log_errors(FILE *fp, const char *filter_type, const char *type, const char *structure,
+                                int cutoff, int order, denormal_mode mode, const double *ref,
+                                const float *y_f, const double *y_d) {
+    double max_err = 0.0, sum_sq = 0.0;
+    for (int i = 0; i < N_DENORMAL; i++) {
+        double err = ref[i] - (y_f ? (double)y_f[i] : y_d[i]);
+        if (fabs(err) > max_err) max_err = fabs(err);
+        sum_sq += err * err;
+    }
+    long subnormals = y_f ? denormal_count_f(y_f, N_DENORMAL) : denormal_count_d(y_d, N_DENORMAL);
+
+    fprintf(fp, "%s,%s,%s,%d,%d,%s,%.8e,%.8e,%ld\n", filter_type, type, structure, cutoff, order,
+            denormal_mode_name(mode), max_err, sqrt(sum_sq / N_DENORMAL), subnormals);
+}
+
+// Impuls w x_f / x_d w danym trybie; przy DENORMAL_OFFSET offset dodany do całego wejścia
+static void denormal_impulse(float *x_f, double *x_d, denormal_mode mode) {
+    memset(x_f, 0, sizeof(float) * N_DENORMAL);
+    memset(x_d, 0, sizeof(double) * N_DENORMAL);
+    x_f[0] = 1.0f;
+    x_d[0] = 1.0;
+    if (mode == DENORMAL_OFFSET) {
+        denormal_offset_f(x_f, N_DENORMAL);
+        denormal_offset_d(x_d, N_DENORMAL);
+    }
+}
+
+void precision_denormal(FILE *fp, const char *filter_name, const char *structure,
+                        void (*func_f)(float*, float*, float*, float*, int, int),
+                        void (*func_d)(double*, double*, double*, double*, int, int),
+                        float *b_f, float *a_f, double *b_d, double *a_d, int order) {
+
+    int cutoff = -1;
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    float *x_f = pool_buffer(POOL_X, sizeof(float) * N_DENORMAL);
+    float *y_f = pool_buffer(POOL_Y, sizeof(float) * N_DENORMAL);
+    double *x_d = pool_buffer(POOL_X2, sizeof(double) * N_DENORMAL);
+    double *y_d = pool_buffer(POOL_Y2, sizeof(double) * N_DENORMAL);
+    double *ref = pool_buffer(POOL_TMP, sizeof(double) * N_DENORMAL);
+
+    denormal_impulse(x_f, x_d, DENORMAL_NONE);
+    func_d(x_d, ref, b_d, a_d, N_DENORMAL, order);
+
+    for (int m = 0; m < DENORMAL_MODES; m++) {
+        denormal_state st;
+        denormal_impulse(x_f, x_d, (denormal_mode)m);
+
+        denormal_enter((denormal_mode)m, &st);
+        func_f(x_f, y_f, b_f, a_f, N_DENORMAL, order);
+        func_d(x_d, y_d, b_d, a_d, N_DENORMAL, order);
+        denormal_leave(&st);
+
+        denormal_log_errors(fp, filter_type, "float", structure, cutoff, order - 1, (denormal_mode)m, ref, y_f, NULL);
+        denormal_log_errors(fp, filter_type, "double", structure, cutoff, order - 1, (denormal_mode)m, ref, NULL, y_d);
     }
+}
+
+void precision_denormal_sos(FILE *fp, const char *filter_name, const char *structure,
+                            void (*func_f)(float*, float*, float*, int, int),
+                            void (*func_d)(double*, double*, double*, int, int),
+                            float *sos_f, double *sos_d, int sections) {
+
+    int cutoff = -1;
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    float *x_f = pool_buffer(POOL_X, sizeof(float) * N_DENORMAL);
+    float *y_f = pool_buffer(POOL_Y, sizeof(float) * N_DENORMAL);
+    double *x_d = pool_buffer(POOL_X2, sizeof(double) * N_DENORMAL);
+    double *y_d = pool_buffer(POOL_Y2, sizeof(double) * N_DENORMAL);
+    double *ref = pool_buffer(POOL_TMP, sizeof(double) * N_DENORMAL);
+
+    denormal_impulse(x_f, x_d, DENORMAL_NONE);
+    func_d(x_d, ref, sos_d, N_DENORMAL, sections);
+
+    for (int m = 0; m < DENORMAL_MODES; m++) {
+        denormal_state st;
+        denormal_impulse(x_f, x_d, (denormal_mode)m);
+
+        denormal_enter((denormal_mode)m, &st);
+        func_f(x_f, y_f, sos_f, N_DENORMAL, sections);
+        func_d(x_d, y_d, sos_d, N_DENORMAL, sections);
+        denormal_leave(&st);
+
+        denormal_log_errors(fp, filter_type, "float", structure, cutoff, 2 * sections, (denormal_mode)m, ref, y_f, NULL);
+        denormal_log_errors(fp, filter_type, "double", structure, cutoff, 2 * sections, (denormal_mode)m, ref, NULL, y_d);
+    }
+}
+
+int main() {
+
+    // Szum równomierny w [-0.5, 0.5), ten sam na każdej platformie
+    siggen g;
+    siggen_init(&g, SG_WHITE, SIGGEN_SEED, 0.5, 0.0, 0.0, 0.0, 0);
+    siggen_block_d(&g, rand_signal, N);
 
     FILE *fp_precision = fopen("c_floating_precision_results.csv", "w");
     if (!fp_precision) {
@@ -146,242 +258,318 @@ int main() {
     precision_analysis(fp_precision, "butter_df2_order2_cut1000_ba", "DF2", DF2_f, DF2_d, butter_df2_order2_cut1000_f32_ba[0], butter_df2_order2_cut1000_f32_ba[1], butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3);
     precision_analysis(fp_precision, "butter_tdf2_order2_cut1000_ba", "TDF2", TDF2_f, TDF2_d, butter_tdf2_order2_cut1000_f32_ba[0], butter_tdf2_order2_cut1000_f32_ba[1], butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "butter_cascade_order2_cut1000_sos", CASCADE_f, CASCADE_d, (float*)butter_cascade_order2_cut1000_f32_sos, (double*)butter_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)butter_cascade_order2_cut1000_f32_sos, (double*)butter_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis(fp_precision, "butter_df1_order2_cut2000_ba", "DF1", DF1_f, DF1_d, butter_df1_order2_cut2000_f32_ba[0], butter_df1_order2_cut2000_f32_ba[1], butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3);
     precision_analysis(fp_precision, "butter_df2_order2_cut2000_ba", "DF2", DF2_f, DF2_d, butter_df2_order2_cut2000_f32_ba[0], butter_df2_order2_cut2000_f32_ba[1], butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3);
     precision_analysis(fp_precision, "butter_tdf2_order2_cut2000_ba", "TDF2", TDF2_f, TDF2_d, butter_tdf2_order2_cut2000_f32_ba[0], butter_tdf2_order2_cut2000_f32_ba[1], butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "butter_cascade_order2_cut2000_sos", CASCADE_f, CASCADE_d, (float*)butter_cascade_order2_cut2000_f32_sos, (double*)butter_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)butter_cascade_order2_cut2000_f32_sos, (double*)butter_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis(fp_precision, "butter_df1_order2_cut5000_ba", "DF1", DF1_f, DF1_d, butter_df1_order2_cut5000_f32_ba[0], butter_df1_order2_cut5000_f32_ba[1], butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3);
     precision_analysis(fp_precision, "butter_df2_order2_cut5000_ba", "DF2", DF2_f, DF2_d, butter_df2_order2_cut5000_f32_ba[0], butter_df2_order2_cut5000_f32_ba[1], butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3);
     precision_analysis(fp_precision, "butter_tdf2_order2_cut5000_ba", "TDF2", TDF2_f, TDF2_d, butter_tdf2_order2_cut5000_f32_ba[0], butter_tdf2_order2_cut5000_f32_ba[1], butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "butter_cascade_order2_cut5000_sos", CASCADE_f, CASCADE_d, (float*)butter_cascade_order2_cut5000_f32_sos, (double*)butter_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "butter_cascade_order2_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)butter_cascade_order2_cut5000_f32_sos, (double*)butter_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis(fp_precision, "butter_df1_order4_cut1000_ba", "DF1", DF1_f, DF1_d, butter_df1_order4_cut1000_f32_ba[0], butter_df1_order4_cut1000_f32_ba[1], butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5);
     precision_analysis(fp_precision, "butter_df2_order4_cut1000_ba", "DF2", DF2_f, DF2_d, butter_df2_order4_cut1000_f32_ba[0], butter_df2_order4_cut1000_f32_ba[1], butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5);
     precision_analysis(fp_precision, "butter_tdf2_order4_cut1000_ba", "TDF2", TDF2_f, TDF2_d, butter_tdf2_order4_cut1000_f32_ba[0], butter_tdf2_order4_cut1000_f32_ba[1], butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "butter_cascade_order4_cut1000_sos", CASCADE_f, CASCADE_d, (float*)butter_cascade_order4_cut1000_f32_sos, (double*)butter_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)butter_cascade_order4_cut1000_f32_sos, (double*)butter_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis(fp_precision, "butter_df1_order4_cut2000_ba", "DF1", DF1_f, DF1_d, butter_df1_order4_cut2000_f32_ba[0], butter_df1_order4_cut2000_f32_ba[1], butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5);
     precision_analysis(fp_precision, "butter_df2_order4_cut2000_ba", "DF2", DF2_f, DF2_d, butter_df2_order4_cut2000_f32_ba[0], butter_df2_order4_cut2000_f32_ba[1], butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5);
     precision_analysis(fp_precision, "butter_tdf2_order4_cut2000_ba", "TDF2", TDF2_f, TDF2_d, butter_tdf2_order4_cut2000_f32_ba[0], butter_tdf2_order4_cut2000_f32_ba[1], butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "butter_cascade_order4_cut2000_sos", CASCADE_f, CASCADE_d, (float*)butter_cascade_order4_cut2000_f32_sos, (double*)butter_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)butter_cascade_order4_cut2000_f32_sos, (double*)butter_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis(fp_precision, "butter_df1_order4_cut5000_ba", "DF1", DF1_f, DF1_d, butter_df1_order4_cut5000_f32_ba[0], butter_df1_order4_cut5000_f32_ba[1], butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5);
     precision_analysis(fp_precision, "butter_df2_order4_cut5000_ba", "DF2", DF2_f, DF2_d, butter_df2_order4_cut5000_f32_ba[0], butter_df2_order4_cut5000_f32_ba[1], butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5);
     precision_analysis(fp_precision, "butter_tdf2_order4_cut5000_ba", "TDF2", TDF2_f, TDF2_d, butter_tdf2_order4_cut5000_f32_ba[0], butter_tdf2_order4_cut5000_f32_ba[1], butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "butter_cascade_order4_cut5000_sos", CASCADE_f, CASCADE_d, (float*)butter_cascade_order4_cut5000_f32_sos, (double*)butter_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "butter_cascade_order4_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)butter_cascade_order4_cut5000_f32_sos, (double*)butter_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis(fp_precision, "butter_df1_order6_cut1000_ba", "DF1", DF1_f, DF1_d, butter_df1_order6_cut1000_f32_ba[0], butter_df1_order6_cut1000_f32_ba[1], butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7);
     precision_analysis(fp_precision, "butter_df2_order6_cut1000_ba", "DF2", DF2_f, DF2_d, butter_df2_order6_cut1000_f32_ba[0], butter_df2_order6_cut1000_f32_ba[1], butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7);
     precision_analysis(fp_precision, "butter_tdf2_order6_cut1000_ba", "TDF2", TDF2_f, TDF2_d, butter_tdf2_order6_cut1000_f32_ba[0], butter_tdf2_order6_cut1000_f32_ba[1], butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "butter_cascade_order6_cut1000_sos", CASCADE_f, CASCADE_d, (float*)butter_cascade_order6_cut1000_f32_sos, (double*)butter_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)butter_cascade_order6_cut1000_f32_sos, (double*)butter_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis(fp_precision, "butter_df1_order6_cut2000_ba", "DF1", DF1_f, DF1_d, butter_df1_order6_cut2000_f32_ba[0], butter_df1_order6_cut2000_f32_ba[1], butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7);
     precision_analysis(fp_precision, "butter_df2_order6_cut2000_ba", "DF2", DF2_f, DF2_d, butter_df2_order6_cut2000_f32_ba[0], butter_df2_order6_cut2000_f32_ba[1], butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7);
     precision_analysis(fp_precision, "butter_tdf2_order6_cut2000_ba", "TDF2", TDF2_f, TDF2_d, butter_tdf2_order6_cut2000_f32_ba[0], butter_tdf2_order6_cut2000_f32_ba[1], butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "butter_cascade_order6_cut2000_sos", CASCADE_f, CASCADE_d, (float*)butter_cascade_order6_cut2000_f32_sos, (double*)butter_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)butter_cascade_order6_cut2000_f32_sos, (double*)butter_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis(fp_precision, "butter_df1_order6_cut5000_ba", "DF1", DF1_f, DF1_d, butter_df1_order6_cut5000_f32_ba[0], butter_df1_order6_cut5000_f32_ba[1], butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7);
     precision_analysis(fp_precision, "butter_df2_order6_cut5000_ba", "DF2", DF2_f, DF2_d, butter_df2_order6_cut5000_f32_ba[0], butter_df2_order6_cut5000_f32_ba[1], butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7);
     precision_analysis(fp_precision, "butter_tdf2_order6_cut5000_ba", "TDF2", TDF2_f, TDF2_d, butter_tdf2_order6_cut5000_f32_ba[0], butter_tdf2_order6_cut5000_f32_ba[1], butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "butter_cascade_order6_cut5000_sos", CASCADE_f, CASCADE_d, (float*)butter_cascade_order6_cut5000_f32_sos, (double*)butter_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "butter_cascade_order6_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)butter_cascade_order6_cut5000_f32_sos, (double*)butter_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis(fp_precision, "butter_df1_order8_cut1000_ba", "DF1", DF1_f, DF1_d, butter_df1_order8_cut1000_f32_ba[0], butter_df1_order8_cut1000_f32_ba[1], butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9);
     precision_analysis(fp_precision, "butter_df2_order8_cut1000_ba", "DF2", DF2_f, DF2_d, butter_df2_order8_cut1000_f32_ba[0], butter_df2_order8_cut1000_f32_ba[1], butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9);
     precision_analysis(fp_precision, "butter_tdf2_order8_cut1000_ba", "TDF2", TDF2_f, TDF2_d, butter_tdf2_order8_cut1000_f32_ba[0], butter_tdf2_order8_cut1000_f32_ba[1], butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "butter_cascade_order8_cut1000_sos", CASCADE_f, CASCADE_d, (float*)butter_cascade_order8_cut1000_f32_sos, (double*)butter_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)butter_cascade_order8_cut1000_f32_sos, (double*)butter_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis(fp_precision, "butter_df1_order8_cut2000_ba", "DF1", DF1_f, DF1_d, butter_df1_order8_cut2000_f32_ba[0], butter_df1_order8_cut2000_f32_ba[1], butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9);
     precision_analysis(fp_precision, "butter_df2_order8_cut2000_ba", "DF2", DF2_f, DF2_d, butter_df2_order8_cut2000_f32_ba[0], butter_df2_order8_cut2000_f32_ba[1], butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9);
     precision_analysis(fp_precision, "butter_tdf2_order8_cut2000_ba", "TDF2", TDF2_f, TDF2_d, butter_tdf2_order8_cut2000_f32_ba[0], butter_tdf2_order8_cut2000_f32_ba[1], butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "butter_cascade_order8_cut2000_sos", CASCADE_f, CASCADE_d, (float*)butter_cascade_order8_cut2000_f32_sos, (double*)butter_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)butter_cascade_order8_cut2000_f32_sos, (double*)butter_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis(fp_precision, "butter_df1_order8_cut5000_ba", "DF1", DF1_f, DF1_d, butter_df1_order8_cut5000_f32_ba[0], butter_df1_order8_cut5000_f32_ba[1], butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9);
     precision_analysis(fp_precision, "butter_df2_order8_cut5000_ba", "DF2", DF2_f, DF2_d, butter_df2_order8_cut5000_f32_ba[0], butter_df2_order8_cut5000_f32_ba[1], butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9);
     precision_analysis(fp_precision, "butter_tdf2_order8_cut5000_ba", "TDF2", TDF2_f, TDF2_d, butter_tdf2_order8_cut5000_f32_ba[0], butter_tdf2_order8_cut5000_f32_ba[1], butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "butter_cascade_order8_cut5000_sos", CASCADE_f, CASCADE_d, (float*)butter_cascade_order8_cut5000_f32_sos, (double*)butter_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "butter_cascade_order8_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)butter_cascade_order8_cut5000_f32_sos, (double*)butter_cascade_order8_cut5000_f64_sos, 4);
     precision_analysis(fp_precision, "cheby1_df1_order2_cut1000_ba", "DF1", DF1_f, DF1_d, cheby1_df1_order2_cut1000_f32_ba[0], cheby1_df1_order2_cut1000_f32_ba[1], cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3);
     precision_analysis(fp_precision, "cheby1_df2_order2_cut1000_ba", "DF2", DF2_f, DF2_d, cheby1_df2_order2_cut1000_f32_ba[0], cheby1_df2_order2_cut1000_f32_ba[1], cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3);
     precision_analysis(fp_precision, "cheby1_tdf2_order2_cut1000_ba", "TDF2", TDF2_f, TDF2_d, cheby1_tdf2_order2_cut1000_f32_ba[0], cheby1_tdf2_order2_cut1000_f32_ba[1], cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "cheby1_cascade_order2_cut1000_sos", CASCADE_f, CASCADE_d, (float*)cheby1_cascade_order2_cut1000_f32_sos, (double*)cheby1_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby1_cascade_order2_cut1000_f32_sos, (double*)cheby1_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis(fp_precision, "cheby1_df1_order2_cut2000_ba", "DF1", DF1_f, DF1_d, cheby1_df1_order2_cut2000_f32_ba[0], cheby1_df1_order2_cut2000_f32_ba[1], cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3);
     precision_analysis(fp_precision, "cheby1_df2_order2_cut2000_ba", "DF2", DF2_f, DF2_d, cheby1_df2_order2_cut2000_f32_ba[0], cheby1_df2_order2_cut2000_f32_ba[1], cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3);
     precision_analysis(fp_precision, "cheby1_tdf2_order2_cut2000_ba", "TDF2", TDF2_f, TDF2_d, cheby1_tdf2_order2_cut2000_f32_ba[0], cheby1_tdf2_order2_cut2000_f32_ba[1], cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "cheby1_cascade_order2_cut2000_sos", CASCADE_f, CASCADE_d, (float*)cheby1_cascade_order2_cut2000_f32_sos, (double*)cheby1_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby1_cascade_order2_cut2000_f32_sos, (double*)cheby1_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis(fp_precision, "cheby1_df1_order2_cut5000_ba", "DF1", DF1_f, DF1_d, cheby1_df1_order2_cut5000_f32_ba[0], cheby1_df1_order2_cut5000_f32_ba[1], cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3);
     precision_analysis(fp_precision, "cheby1_df2_order2_cut5000_ba", "DF2", DF2_f, DF2_d, cheby1_df2_order2_cut5000_f32_ba[0], cheby1_df2_order2_cut5000_f32_ba[1], cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3);
     precision_analysis(fp_precision, "cheby1_tdf2_order2_cut5000_ba", "TDF2", TDF2_f, TDF2_d, cheby1_tdf2_order2_cut5000_f32_ba[0], cheby1_tdf2_order2_cut5000_f32_ba[1], cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "cheby1_cascade_order2_cut5000_sos", CASCADE_f, CASCADE_d, (float*)cheby1_cascade_order2_cut5000_f32_sos, (double*)cheby1_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order2_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby1_cascade_order2_cut5000_f32_sos, (double*)cheby1_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis(fp_precision, "cheby1_df1_order4_cut1000_ba", "DF1", DF1_f, DF1_d, cheby1_df1_order4_cut1000_f32_ba[0], cheby1_df1_order4_cut1000_f32_ba[1], cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5);
     precision_analysis(fp_precision, "cheby1_df2_order4_cut1000_ba", "DF2", DF2_f, DF2_d, cheby1_df2_order4_cut1000_f32_ba[0], cheby1_df2_order4_cut1000_f32_ba[1], cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5);
     precision_analysis(fp_precision, "cheby1_tdf2_order4_cut1000_ba", "TDF2", TDF2_f, TDF2_d, cheby1_tdf2_order4_cut1000_f32_ba[0], cheby1_tdf2_order4_cut1000_f32_ba[1], cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "cheby1_cascade_order4_cut1000_sos", CASCADE_f, CASCADE_d, (float*)cheby1_cascade_order4_cut1000_f32_sos, (double*)cheby1_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby1_cascade_order4_cut1000_f32_sos, (double*)cheby1_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis(fp_precision, "cheby1_df1_order4_cut2000_ba", "DF1", DF1_f, DF1_d, cheby1_df1_order4_cut2000_f32_ba[0], cheby1_df1_order4_cut2000_f32_ba[1], cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5);
     precision_analysis(fp_precision, "cheby1_df2_order4_cut2000_ba", "DF2", DF2_f, DF2_d, cheby1_df2_order4_cut2000_f32_ba[0], cheby1_df2_order4_cut2000_f32_ba[1], cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5);
     precision_analysis(fp_precision, "cheby1_tdf2_order4_cut2000_ba", "TDF2", TDF2_f, TDF2_d, cheby1_tdf2_order4_cut2000_f32_ba[0], cheby1_tdf2_order4_cut2000_f32_ba[1], cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "cheby1_cascade_order4_cut2000_sos", CASCADE_f, CASCADE_d, (float*)cheby1_cascade_order4_cut2000_f32_sos, (double*)cheby1_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby1_cascade_order4_cut2000_f32_sos, (double*)cheby1_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis(fp_precision, "cheby1_df1_order4_cut5000_ba", "DF1", DF1_f, DF1_d, cheby1_df1_order4_cut5000_f32_ba[0], cheby1_df1_order4_cut5000_f32_ba[1], cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5);
     precision_analysis(fp_precision, "cheby1_df2_order4_cut5000_ba", "DF2", DF2_f, DF2_d, cheby1_df2_order4_cut5000_f32_ba[0], cheby1_df2_order4_cut5000_f32_ba[1], cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5);
     precision_analysis(fp_precision, "cheby1_tdf2_order4_cut5000_ba", "TDF2", TDF2_f, TDF2_d, cheby1_tdf2_order4_cut5000_f32_ba[0], cheby1_tdf2_order4_cut5000_f32_ba[1], cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "cheby1_cascade_order4_cut5000_sos", CASCADE_f, CASCADE_d, (float*)cheby1_cascade_order4_cut5000_f32_sos, (double*)cheby1_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order4_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby1_cascade_order4_cut5000_f32_sos, (double*)cheby1_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis(fp_precision, "cheby1_df1_order6_cut1000_ba", "DF1", DF1_f, DF1_d, cheby1_df1_order6_cut1000_f32_ba[0], cheby1_df1_order6_cut1000_f32_ba[1], cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7);
     precision_analysis(fp_precision, "cheby1_df2_order6_cut1000_ba", "DF2", DF2_f, DF2_d, cheby1_df2_order6_cut1000_f32_ba[0], cheby1_df2_order6_cut1000_f32_ba[1], cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7);
     precision_analysis(fp_precision, "cheby1_tdf2_order6_cut1000_ba", "TDF2", TDF2_f, TDF2_d, cheby1_tdf2_order6_cut1000_f32_ba[0], cheby1_tdf2_order6_cut1000_f32_ba[1], cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "cheby1_cascade_order6_cut1000_sos", CASCADE_f, CASCADE_d, (float*)cheby1_cascade_order6_cut1000_f32_sos, (double*)cheby1_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby1_cascade_order6_cut1000_f32_sos, (double*)cheby1_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis(fp_precision, "cheby1_df1_order6_cut2000_ba", "DF1", DF1_f, DF1_d, cheby1_df1_order6_cut2000_f32_ba[0], cheby1_df1_order6_cut2000_f32_ba[1], cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7);
     precision_analysis(fp_precision, "cheby1_df2_order6_cut2000_ba", "DF2", DF2_f, DF2_d, cheby1_df2_order6_cut2000_f32_ba[0], cheby1_df2_order6_cut2000_f32_ba[1], cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7);
     precision_analysis(fp_precision, "cheby1_tdf2_order6_cut2000_ba", "TDF2", TDF2_f, TDF2_d, cheby1_tdf2_order6_cut2000_f32_ba[0], cheby1_tdf2_order6_cut2000_f32_ba[1], cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "cheby1_cascade_order6_cut2000_sos", CASCADE_f, CASCADE_d, (float*)cheby1_cascade_order6_cut2000_f32_sos, (double*)cheby1_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby1_cascade_order6_cut2000_f32_sos, (double*)cheby1_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis(fp_precision, "cheby1_df1_order6_cut5000_ba", "DF1", DF1_f, DF1_d, cheby1_df1_order6_cut5000_f32_ba[0], cheby1_df1_order6_cut5000_f32_ba[1], cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7);
     precision_analysis(fp_precision, "cheby1_df2_order6_cut5000_ba", "DF2", DF2_f, DF2_d, cheby1_df2_order6_cut5000_f32_ba[0], cheby1_df2_order6_cut5000_f32_ba[1], cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7);
     precision_analysis(fp_precision, "cheby1_tdf2_order6_cut5000_ba", "TDF2", TDF2_f, TDF2_d, cheby1_tdf2_order6_cut5000_f32_ba[0], cheby1_tdf2_order6_cut5000_f32_ba[1], cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "cheby1_cascade_order6_cut5000_sos", CASCADE_f, CASCADE_d, (float*)cheby1_cascade_order6_cut5000_f32_sos, (double*)cheby1_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order6_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby1_cascade_order6_cut5000_f32_sos, (double*)cheby1_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis(fp_precision, "cheby1_df1_order8_cut1000_ba", "DF1", DF1_f, DF1_d, cheby1_df1_order8_cut1000_f32_ba[0], cheby1_df1_order8_cut1000_f32_ba[1], cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9);
     precision_analysis(fp_precision, "cheby1_df2_order8_cut1000_ba", "DF2", DF2_f, DF2_d, cheby1_df2_order8_cut1000_f32_ba[0], cheby1_df2_order8_cut1000_f32_ba[1], cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9);
     precision_analysis(fp_precision, "cheby1_tdf2_order8_cut1000_ba", "TDF2", TDF2_f, TDF2_d, cheby1_tdf2_order8_cut1000_f32_ba[0], cheby1_tdf2_order8_cut1000_f32_ba[1], cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "cheby1_cascade_order8_cut1000_sos", CASCADE_f, CASCADE_d, (float*)cheby1_cascade_order8_cut1000_f32_sos, (double*)cheby1_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby1_cascade_order8_cut1000_f32_sos, (double*)cheby1_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis(fp_precision, "cheby1_df1_order8_cut2000_ba", "DF1", DF1_f, DF1_d, cheby1_df1_order8_cut2000_f32_ba[0], cheby1_df1_order8_cut2000_f32_ba[1], cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9);
     precision_analysis(fp_precision, "cheby1_df2_order8_cut2000_ba", "DF2", DF2_f, DF2_d, cheby1_df2_order8_cut2000_f32_ba[0], cheby1_df2_order8_cut2000_f32_ba[1], cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9);
     precision_analysis(fp_precision, "cheby1_tdf2_order8_cut2000_ba", "TDF2", TDF2_f, TDF2_d, cheby1_tdf2_order8_cut2000_f32_ba[0], cheby1_tdf2_order8_cut2000_f32_ba[1], cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "cheby1_cascade_order8_cut2000_sos", CASCADE_f, CASCADE_d, (float*)cheby1_cascade_order8_cut2000_f32_sos, (double*)cheby1_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby1_cascade_order8_cut2000_f32_sos, (double*)cheby1_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis(fp_precision, "cheby1_df1_order8_cut5000_ba", "DF1", DF1_f, DF1_d, cheby1_df1_order8_cut5000_f32_ba[0], cheby1_df1_order8_cut5000_f32_ba[1], cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9);
     precision_analysis(fp_precision, "cheby1_df2_order8_cut5000_ba", "DF2", DF2_f, DF2_d, cheby1_df2_order8_cut5000_f32_ba[0], cheby1_df2_order8_cut5000_f32_ba[1], cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9);
     precision_analysis(fp_precision, "cheby1_tdf2_order8_cut5000_ba", "TDF2", TDF2_f, TDF2_d, cheby1_tdf2_order8_cut5000_f32_ba[0], cheby1_tdf2_order8_cut5000_f32_ba[1], cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "cheby1_cascade_order8_cut5000_sos", CASCADE_f, CASCADE_d, (float*)cheby1_cascade_order8_cut5000_f32_sos, (double*)cheby1_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby1_cascade_order8_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby1_cascade_order8_cut5000_f32_sos, (double*)cheby1_cascade_order8_cut5000_f64_sos, 4);
     precision_analysis(fp_precision, "cheby2_df1_order2_cut1000_ba", "DF1", DF1_f, DF1_d, cheby2_df1_order2_cut1000_f32_ba[0], cheby2_df1_order2_cut1000_f32_ba[1], cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3);
     precision_analysis(fp_precision, "cheby2_df2_order2_cut1000_ba", "DF2", DF2_f, DF2_d, cheby2_df2_order2_cut1000_f32_ba[0], cheby2_df2_order2_cut1000_f32_ba[1], cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3);
     precision_analysis(fp_precision, "cheby2_tdf2_order2_cut1000_ba", "TDF2", TDF2_f, TDF2_d, cheby2_tdf2_order2_cut1000_f32_ba[0], cheby2_tdf2_order2_cut1000_f32_ba[1], cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "cheby2_cascade_order2_cut1000_sos", CASCADE_f, CASCADE_d, (float*)cheby2_cascade_order2_cut1000_f32_sos, (double*)cheby2_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby2_cascade_order2_cut1000_f32_sos, (double*)cheby2_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis(fp_precision, "cheby2_df1_order2_cut2000_ba", "DF1", DF1_f, DF1_d, cheby2_df1_order2_cut2000_f32_ba[0], cheby2_df1_order2_cut2000_f32_ba[1], cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3);
     precision_analysis(fp_precision, "cheby2_df2_order2_cut2000_ba", "DF2", DF2_f, DF2_d, cheby2_df2_order2_cut2000_f32_ba[0], cheby2_df2_order2_cut2000_f32_ba[1], cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3);
     precision_analysis(fp_precision, "cheby2_tdf2_order2_cut2000_ba", "TDF2", TDF2_f, TDF2_d, cheby2_tdf2_order2_cut2000_f32_ba[0], cheby2_tdf2_order2_cut2000_f32_ba[1], cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "cheby2_cascade_order2_cut2000_sos", CASCADE_f, CASCADE_d, (float*)cheby2_cascade_order2_cut2000_f32_sos, (double*)cheby2_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby2_cascade_order2_cut2000_f32_sos, (double*)cheby2_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis(fp_precision, "cheby2_df1_order2_cut5000_ba", "DF1", DF1_f, DF1_d, cheby2_df1_order2_cut5000_f32_ba[0], cheby2_df1_order2_cut5000_f32_ba[1], cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3);
     precision_analysis(fp_precision, "cheby2_df2_order2_cut5000_ba", "DF2", DF2_f, DF2_d, cheby2_df2_order2_cut5000_f32_ba[0], cheby2_df2_order2_cut5000_f32_ba[1], cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3);
     precision_analysis(fp_precision, "cheby2_tdf2_order2_cut5000_ba", "TDF2", TDF2_f, TDF2_d, cheby2_tdf2_order2_cut5000_f32_ba[0], cheby2_tdf2_order2_cut5000_f32_ba[1], cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "cheby2_cascade_order2_cut5000_sos", CASCADE_f, CASCADE_d, (float*)cheby2_cascade_order2_cut5000_f32_sos, (double*)cheby2_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order2_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby2_cascade_order2_cut5000_f32_sos, (double*)cheby2_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis(fp_precision, "cheby2_df1_order4_cut1000_ba", "DF1", DF1_f, DF1_d, cheby2_df1_order4_cut1000_f32_ba[0], cheby2_df1_order4_cut1000_f32_ba[1], cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5);
     precision_analysis(fp_precision, "cheby2_df2_order4_cut1000_ba", "DF2", DF2_f, DF2_d, cheby2_df2_order4_cut1000_f32_ba[0], cheby2_df2_order4_cut1000_f32_ba[1], cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5);
     precision_analysis(fp_precision, "cheby2_tdf2_order4_cut1000_ba", "TDF2", TDF2_f, TDF2_d, cheby2_tdf2_order4_cut1000_f32_ba[0], cheby2_tdf2_order4_cut1000_f32_ba[1], cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "cheby2_cascade_order4_cut1000_sos", CASCADE_f, CASCADE_d, (float*)cheby2_cascade_order4_cut1000_f32_sos, (double*)cheby2_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby2_cascade_order4_cut1000_f32_sos, (double*)cheby2_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis(fp_precision, "cheby2_df1_order4_cut2000_ba", "DF1", DF1_f, DF1_d, cheby2_df1_order4_cut2000_f32_ba[0], cheby2_df1_order4_cut2000_f32_ba[1], cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5);
     precision_analysis(fp_precision, "cheby2_df2_order4_cut2000_ba", "DF2", DF2_f, DF2_d, cheby2_df2_order4_cut2000_f32_ba[0], cheby2_df2_order4_cut2000_f32_ba[1], cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5);
     precision_analysis(fp_precision, "cheby2_tdf2_order4_cut2000_ba", "TDF2", TDF2_f, TDF2_d, cheby2_tdf2_order4_cut2000_f32_ba[0], cheby2_tdf2_order4_cut2000_f32_ba[1], cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "cheby2_cascade_order4_cut2000_sos", CASCADE_f, CASCADE_d, (float*)cheby2_cascade_order4_cut2000_f32_sos, (double*)cheby2_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby2_cascade_order4_cut2000_f32_sos, (double*)cheby2_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis(fp_precision, "cheby2_df1_order4_cut5000_ba", "DF1", DF1_f, DF1_d, cheby2_df1_order4_cut5000_f32_ba[0], cheby2_df1_order4_cut5000_f32_ba[1], cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5);
     precision_analysis(fp_precision, "cheby2_df2_order4_cut5000_ba", "DF2", DF2_f, DF2_d, cheby2_df2_order4_cut5000_f32_ba[0], cheby2_df2_order4_cut5000_f32_ba[1], cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5);
     precision_analysis(fp_precision, "cheby2_tdf2_order4_cut5000_ba", "TDF2", TDF2_f, TDF2_d, cheby2_tdf2_order4_cut5000_f32_ba[0], cheby2_tdf2_order4_cut5000_f32_ba[1], cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "cheby2_cascade_order4_cut5000_sos", CASCADE_f, CASCADE_d, (float*)cheby2_cascade_order4_cut5000_f32_sos, (double*)cheby2_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order4_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby2_cascade_order4_cut5000_f32_sos, (double*)cheby2_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis(fp_precision, "cheby2_df1_order6_cut1000_ba", "DF1", DF1_f, DF1_d, cheby2_df1_order6_cut1000_f32_ba[0], cheby2_df1_order6_cut1000_f32_ba[1], cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7);
     precision_analysis(fp_precision, "cheby2_df2_order6_cut1000_ba", "DF2", DF2_f, DF2_d, cheby2_df2_order6_cut1000_f32_ba[0], cheby2_df2_order6_cut1000_f32_ba[1], cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7);
     precision_analysis(fp_precision, "cheby2_tdf2_order6_cut1000_ba", "TDF2", TDF2_f, TDF2_d, cheby2_tdf2_order6_cut1000_f32_ba[0], cheby2_tdf2_order6_cut1000_f32_ba[1], cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "cheby2_cascade_order6_cut1000_sos", CASCADE_f, CASCADE_d, (float*)cheby2_cascade_order6_cut1000_f32_sos, (double*)cheby2_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby2_cascade_order6_cut1000_f32_sos, (double*)cheby2_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis(fp_precision, "cheby2_df1_order6_cut2000_ba", "DF1", DF1_f, DF1_d, cheby2_df1_order6_cut2000_f32_ba[0], cheby2_df1_order6_cut2000_f32_ba[1], cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7);
     precision_analysis(fp_precision, "cheby2_df2_order6_cut2000_ba", "DF2", DF2_f, DF2_d, cheby2_df2_order6_cut2000_f32_ba[0], cheby2_df2_order6_cut2000_f32_ba[1], cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7);
     precision_analysis(fp_precision, "cheby2_tdf2_order6_cut2000_ba", "TDF2", TDF2_f, TDF2_d, cheby2_tdf2_order6_cut2000_f32_ba[0], cheby2_tdf2_order6_cut2000_f32_ba[1], cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "cheby2_cascade_order6_cut2000_sos", CASCADE_f, CASCADE_d, (float*)cheby2_cascade_order6_cut2000_f32_sos, (double*)cheby2_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby2_cascade_order6_cut2000_f32_sos, (double*)cheby2_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis(fp_precision, "cheby2_df1_order6_cut5000_ba", "DF1", DF1_f, DF1_d, cheby2_df1_order6_cut5000_f32_ba[0], cheby2_df1_order6_cut5000_f32_ba[1], cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7);
     precision_analysis(fp_precision, "cheby2_df2_order6_cut5000_ba", "DF2", DF2_f, DF2_d, cheby2_df2_order6_cut5000_f32_ba[0], cheby2_df2_order6_cut5000_f32_ba[1], cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7);
     precision_analysis(fp_precision, "cheby2_tdf2_order6_cut5000_ba", "TDF2", TDF2_f, TDF2_d, cheby2_tdf2_order6_cut5000_f32_ba[0], cheby2_tdf2_order6_cut5000_f32_ba[1], cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "cheby2_cascade_order6_cut5000_sos", CASCADE_f, CASCADE_d, (float*)cheby2_cascade_order6_cut5000_f32_sos, (double*)cheby2_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order6_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby2_cascade_order6_cut5000_f32_sos, (double*)cheby2_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis(fp_precision, "cheby2_df1_order8_cut1000_ba", "DF1", DF1_f, DF1_d, cheby2_df1_order8_cut1000_f32_ba[0], cheby2_df1_order8_cut1000_f32_ba[1], cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9);
     precision_analysis(fp_precision, "cheby2_df2_order8_cut1000_ba", "DF2", DF2_f, DF2_d, cheby2_df2_order8_cut1000_f32_ba[0], cheby2_df2_order8_cut1000_f32_ba[1], cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9);
     precision_analysis(fp_precision, "cheby2_tdf2_order8_cut1000_ba", "TDF2", TDF2_f, TDF2_d, cheby2_tdf2_order8_cut1000_f32_ba[0], cheby2_tdf2_order8_cut1000_f32_ba[1], cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "cheby2_cascade_order8_cut1000_sos", CASCADE_f, CASCADE_d, (float*)cheby2_cascade_order8_cut1000_f32_sos, (double*)cheby2_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby2_cascade_order8_cut1000_f32_sos, (double*)cheby2_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis(fp_precision, "cheby2_df1_order8_cut2000_ba", "DF1", DF1_f, DF1_d, cheby2_df1_order8_cut2000_f32_ba[0], cheby2_df1_order8_cut2000_f32_ba[1], cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9);
     precision_analysis(fp_precision, "cheby2_df2_order8_cut2000_ba", "DF2", DF2_f, DF2_d, cheby2_df2_order8_cut2000_f32_ba[0], cheby2_df2_order8_cut2000_f32_ba[1], cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9);
     precision_analysis(fp_precision, "cheby2_tdf2_order8_cut2000_ba", "TDF2", TDF2_f, TDF2_d, cheby2_tdf2_order8_cut2000_f32_ba[0], cheby2_tdf2_order8_cut2000_f32_ba[1], cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "cheby2_cascade_order8_cut2000_sos", CASCADE_f, CASCADE_d, (float*)cheby2_cascade_order8_cut2000_f32_sos, (double*)cheby2_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby2_cascade_order8_cut2000_f32_sos, (double*)cheby2_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis(fp_precision, "cheby2_df1_order8_cut5000_ba", "DF1", DF1_f, DF1_d, cheby2_df1_order8_cut5000_f32_ba[0], cheby2_df1_order8_cut5000_f32_ba[1], cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9);
     precision_analysis(fp_precision, "cheby2_df2_order8_cut5000_ba", "DF2", DF2_f, DF2_d, cheby2_df2_order8_cut5000_f32_ba[0], cheby2_df2_order8_cut5000_f32_ba[1], cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9);
     precision_analysis(fp_precision, "cheby2_tdf2_order8_cut5000_ba", "TDF2", TDF2_f, TDF2_d, cheby2_tdf2_order8_cut5000_f32_ba[0], cheby2_tdf2_order8_cut5000_f32_ba[1], cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "cheby2_cascade_order8_cut5000_sos", CASCADE_f, CASCADE_d, (float*)cheby2_cascade_order8_cut5000_f32_sos, (double*)cheby2_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "cheby2_cascade_order8_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)cheby2_cascade_order8_cut5000_f32_sos, (double*)cheby2_cascade_order8_cut5000_f64_sos, 4);
     precision_analysis(fp_precision, "ellip_df1_order2_cut1000_ba", "DF1", DF1_f, DF1_d, ellip_df1_order2_cut1000_f32_ba[0], ellip_df1_order2_cut1000_f32_ba[1], ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3);
     precision_analysis(fp_precision, "ellip_df2_order2_cut1000_ba", "DF2", DF2_f, DF2_d, ellip_df2_order2_cut1000_f32_ba[0], ellip_df2_order2_cut1000_f32_ba[1], ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3);
     precision_analysis(fp_precision, "ellip_tdf2_order2_cut1000_ba", "TDF2", TDF2_f, TDF2_d, ellip_tdf2_order2_cut1000_f32_ba[0], ellip_tdf2_order2_cut1000_f32_ba[1], ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "ellip_cascade_order2_cut1000_sos", CASCADE_f, CASCADE_d, (float*)ellip_cascade_order2_cut1000_f32_sos, (double*)ellip_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)ellip_cascade_order2_cut1000_f32_sos, (double*)ellip_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis(fp_precision, "ellip_df1_order2_cut2000_ba", "DF1", DF1_f, DF1_d, ellip_df1_order2_cut2000_f32_ba[0], ellip_df1_order2_cut2000_f32_ba[1], ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3);
     precision_analysis(fp_precision, "ellip_df2_order2_cut2000_ba", "DF2", DF2_f, DF2_d, ellip_df2_order2_cut2000_f32_ba[0], ellip_df2_order2_cut2000_f32_ba[1], ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3);
     precision_analysis(fp_precision, "ellip_tdf2_order2_cut2000_ba", "TDF2", TDF2_f, TDF2_d, ellip_tdf2_order2_cut2000_f32_ba[0], ellip_tdf2_order2_cut2000_f32_ba[1], ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "ellip_cascade_order2_cut2000_sos", CASCADE_f, CASCADE_d, (float*)ellip_cascade_order2_cut2000_f32_sos, (double*)ellip_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)ellip_cascade_order2_cut2000_f32_sos, (double*)ellip_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis(fp_precision, "ellip_df1_order2_cut5000_ba", "DF1", DF1_f, DF1_d, ellip_df1_order2_cut5000_f32_ba[0], ellip_df1_order2_cut5000_f32_ba[1], ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3);
     precision_analysis(fp_precision, "ellip_df2_order2_cut5000_ba", "DF2", DF2_f, DF2_d, ellip_df2_order2_cut5000_f32_ba[0], ellip_df2_order2_cut5000_f32_ba[1], ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3);
     precision_analysis(fp_precision, "ellip_tdf2_order2_cut5000_ba", "TDF2", TDF2_f, TDF2_d, ellip_tdf2_order2_cut5000_f32_ba[0], ellip_tdf2_order2_cut5000_f32_ba[1], ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "ellip_cascade_order2_cut5000_sos", CASCADE_f, CASCADE_d, (float*)ellip_cascade_order2_cut5000_f32_sos, (double*)ellip_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order2_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)ellip_cascade_order2_cut5000_f32_sos, (double*)ellip_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis(fp_precision, "ellip_df1_order4_cut1000_ba", "DF1", DF1_f, DF1_d, ellip_df1_order4_cut1000_f32_ba[0], ellip_df1_order4_cut1000_f32_ba[1], ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5);
     precision_analysis(fp_precision, "ellip_df2_order4_cut1000_ba", "DF2", DF2_f, DF2_d, ellip_df2_order4_cut1000_f32_ba[0], ellip_df2_order4_cut1000_f32_ba[1], ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5);
     precision_analysis(fp_precision, "ellip_tdf2_order4_cut1000_ba", "TDF2", TDF2_f, TDF2_d, ellip_tdf2_order4_cut1000_f32_ba[0], ellip_tdf2_order4_cut1000_f32_ba[1], ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "ellip_cascade_order4_cut1000_sos", CASCADE_f, CASCADE_d, (float*)ellip_cascade_order4_cut1000_f32_sos, (double*)ellip_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)ellip_cascade_order4_cut1000_f32_sos, (double*)ellip_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis(fp_precision, "ellip_df1_order4_cut2000_ba", "DF1", DF1_f, DF1_d, ellip_df1_order4_cut2000_f32_ba[0], ellip_df1_order4_cut2000_f32_ba[1], ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5);
     precision_analysis(fp_precision, "ellip_df2_order4_cut2000_ba", "DF2", DF2_f, DF2_d, ellip_df2_order4_cut2000_f32_ba[0], ellip_df2_order4_cut2000_f32_ba[1], ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5);
     precision_analysis(fp_precision, "ellip_tdf2_order4_cut2000_ba", "TDF2", TDF2_f, TDF2_d, ellip_tdf2_order4_cut2000_f32_ba[0], ellip_tdf2_order4_cut2000_f32_ba[1], ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "ellip_cascade_order4_cut2000_sos", CASCADE_f, CASCADE_d, (float*)ellip_cascade_order4_cut2000_f32_sos, (double*)ellip_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)ellip_cascade_order4_cut2000_f32_sos, (double*)ellip_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis(fp_precision, "ellip_df1_order4_cut5000_ba", "DF1", DF1_f, DF1_d, ellip_df1_order4_cut5000_f32_ba[0], ellip_df1_order4_cut5000_f32_ba[1], ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5);
     precision_analysis(fp_precision, "ellip_df2_order4_cut5000_ba", "DF2", DF2_f, DF2_d, ellip_df2_order4_cut5000_f32_ba[0], ellip_df2_order4_cut5000_f32_ba[1], ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5);
     precision_analysis(fp_precision, "ellip_tdf2_order4_cut5000_ba", "TDF2", TDF2_f, TDF2_d, ellip_tdf2_order4_cut5000_f32_ba[0], ellip_tdf2_order4_cut5000_f32_ba[1], ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "ellip_cascade_order4_cut5000_sos", CASCADE_f, CASCADE_d, (float*)ellip_cascade_order4_cut5000_f32_sos, (double*)ellip_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order4_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)ellip_cascade_order4_cut5000_f32_sos, (double*)ellip_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis(fp_precision, "ellip_df1_order6_cut1000_ba", "DF1", DF1_f, DF1_d, ellip_df1_order6_cut1000_f32_ba[0], ellip_df1_order6_cut1000_f32_ba[1], ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7);
     precision_analysis(fp_precision, "ellip_df2_order6_cut1000_ba", "DF2", DF2_f, DF2_d, ellip_df2_order6_cut1000_f32_ba[0], ellip_df2_order6_cut1000_f32_ba[1], ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7);
     precision_analysis(fp_precision, "ellip_tdf2_order6_cut1000_ba", "TDF2", TDF2_f, TDF2_d, ellip_tdf2_order6_cut1000_f32_ba[0], ellip_tdf2_order6_cut1000_f32_ba[1], ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "ellip_cascade_order6_cut1000_sos", CASCADE_f, CASCADE_d, (float*)ellip_cascade_order6_cut1000_f32_sos, (double*)ellip_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)ellip_cascade_order6_cut1000_f32_sos, (double*)ellip_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis(fp_precision, "ellip_df1_order6_cut2000_ba", "DF1", DF1_f, DF1_d, ellip_df1_order6_cut2000_f32_ba[0], ellip_df1_order6_cut2000_f32_ba[1], ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7);
     precision_analysis(fp_precision, "ellip_df2_order6_cut2000_ba", "DF2", DF2_f, DF2_d, ellip_df2_order6_cut2000_f32_ba[0], ellip_df2_order6_cut2000_f32_ba[1], ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7);
     precision_analysis(fp_precision, "ellip_tdf2_order6_cut2000_ba", "TDF2", TDF2_f, TDF2_d, ellip_tdf2_order6_cut2000_f32_ba[0], ellip_tdf2_order6_cut2000_f32_ba[1], ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "ellip_cascade_order6_cut2000_sos", CASCADE_f, CASCADE_d, (float*)ellip_cascade_order6_cut2000_f32_sos, (double*)ellip_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)ellip_cascade_order6_cut2000_f32_sos, (double*)ellip_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis(fp_precision, "ellip_df1_order6_cut5000_ba", "DF1", DF1_f, DF1_d, ellip_df1_order6_cut5000_f32_ba[0], ellip_df1_order6_cut5000_f32_ba[1], ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7);
     precision_analysis(fp_precision, "ellip_df2_order6_cut5000_ba", "DF2", DF2_f, DF2_d, ellip_df2_order6_cut5000_f32_ba[0], ellip_df2_order6_cut5000_f32_ba[1], ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7);
     precision_analysis(fp_precision, "ellip_tdf2_order6_cut5000_ba", "TDF2", TDF2_f, TDF2_d, ellip_tdf2_order6_cut5000_f32_ba[0], ellip_tdf2_order6_cut5000_f32_ba[1], ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "ellip_cascade_order6_cut5000_sos", CASCADE_f, CASCADE_d, (float*)ellip_cascade_order6_cut5000_f32_sos, (double*)ellip_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order6_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)ellip_cascade_order6_cut5000_f32_sos, (double*)ellip_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis(fp_precision, "ellip_df1_order8_cut1000_ba", "DF1", DF1_f, DF1_d, ellip_df1_order8_cut1000_f32_ba[0], ellip_df1_order8_cut1000_f32_ba[1], ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9);
     precision_analysis(fp_precision, "ellip_df2_order8_cut1000_ba", "DF2", DF2_f, DF2_d, ellip_df2_order8_cut1000_f32_ba[0], ellip_df2_order8_cut1000_f32_ba[1], ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9);
     precision_analysis(fp_precision, "ellip_tdf2_order8_cut1000_ba", "TDF2", TDF2_f, TDF2_d, ellip_tdf2_order8_cut1000_f32_ba[0], ellip_tdf2_order8_cut1000_f32_ba[1], ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "ellip_cascade_order8_cut1000_sos", CASCADE_f, CASCADE_d, (float*)ellip_cascade_order8_cut1000_f32_sos, (double*)ellip_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)ellip_cascade_order8_cut1000_f32_sos, (double*)ellip_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis(fp_precision, "ellip_df1_order8_cut2000_ba", "DF1", DF1_f, DF1_d, ellip_df1_order8_cut2000_f32_ba[0], ellip_df1_order8_cut2000_f32_ba[1], ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9);
     precision_analysis(fp_precision, "ellip_df2_order8_cut2000_ba", "DF2", DF2_f, DF2_d, ellip_df2_order8_cut2000_f32_ba[0], ellip_df2_order8_cut2000_f32_ba[1], ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9);
     precision_analysis(fp_precision, "ellip_tdf2_order8_cut2000_ba", "TDF2", TDF2_f, TDF2_d, ellip_tdf2_order8_cut2000_f32_ba[0], ellip_tdf2_order8_cut2000_f32_ba[1], ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "ellip_cascade_order8_cut2000_sos", CASCADE_f, CASCADE_d, (float*)ellip_cascade_order8_cut2000_f32_sos, (double*)ellip_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)ellip_cascade_order8_cut2000_f32_sos, (double*)ellip_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis(fp_precision, "ellip_df1_order8_cut5000_ba", "DF1", DF1_f, DF1_d, ellip_df1_order8_cut5000_f32_ba[0], ellip_df1_order8_cut5000_f32_ba[1], ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9);
     precision_analysis(fp_precision, "ellip_df2_order8_cut5000_ba", "DF2", DF2_f, DF2_d, ellip_df2_order8_cut5000_f32_ba[0], ellip_df2_order8_cut5000_f32_ba[1], ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9);
     precision_analysis(fp_precision, "ellip_tdf2_order8_cut5000_ba", "TDF2", TDF2_f, TDF2_d, ellip_tdf2_order8_cut5000_f32_ba[0], ellip_tdf2_order8_cut5000_f32_ba[1], ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "ellip_cascade_order8_cut5000_sos", CASCADE_f, CASCADE_d, (float*)ellip_cascade_order8_cut5000_f32_sos, (double*)ellip_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "ellip_cascade_order8_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)ellip_cascade_order8_cut5000_f32_sos, (double*)ellip_cascade_order8_cut5000_f64_sos, 4);
     precision_analysis(fp_precision, "bessel_df1_order2_cut1000_ba", "DF1", DF1_f, DF1_d, bessel_df1_order2_cut1000_f32_ba[0], bessel_df1_order2_cut1000_f32_ba[1], bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3);
     precision_analysis(fp_precision, "bessel_df2_order2_cut1000_ba", "DF2", DF2_f, DF2_d, bessel_df2_order2_cut1000_f32_ba[0], bessel_df2_order2_cut1000_f32_ba[1], bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3);
     precision_analysis(fp_precision, "bessel_tdf2_order2_cut1000_ba", "TDF2", TDF2_f, TDF2_d, bessel_tdf2_order2_cut1000_f32_ba[0], bessel_tdf2_order2_cut1000_f32_ba[1], bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "bessel_cascade_order2_cut1000_sos", CASCADE_f, CASCADE_d, (float*)bessel_cascade_order2_cut1000_f32_sos, (double*)bessel_cascade_order2_cut1000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)bessel_cascade_order2_cut1000_f32_sos, (double*)bessel_cascade_order2_cut1000_f64_sos, 1);
     precision_analysis(fp_precision, "bessel_df1_order2_cut2000_ba", "DF1", DF1_f, DF1_d, bessel_df1_order2_cut2000_f32_ba[0], bessel_df1_order2_cut2000_f32_ba[1], bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3);
     precision_analysis(fp_precision, "bessel_df2_order2_cut2000_ba", "DF2", DF2_f, DF2_d, bessel_df2_order2_cut2000_f32_ba[0], bessel_df2_order2_cut2000_f32_ba[1], bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3);
     precision_analysis(fp_precision, "bessel_tdf2_order2_cut2000_ba", "TDF2", TDF2_f, TDF2_d, bessel_tdf2_order2_cut2000_f32_ba[0], bessel_tdf2_order2_cut2000_f32_ba[1], bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "bessel_cascade_order2_cut2000_sos", CASCADE_f, CASCADE_d, (float*)bessel_cascade_order2_cut2000_f32_sos, (double*)bessel_cascade_order2_cut2000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)bessel_cascade_order2_cut2000_f32_sos, (double*)bessel_cascade_order2_cut2000_f64_sos, 1);
     precision_analysis(fp_precision, "bessel_df1_order2_cut5000_ba", "DF1", DF1_f, DF1_d, bessel_df1_order2_cut5000_f32_ba[0], bessel_df1_order2_cut5000_f32_ba[1], bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3);
     precision_analysis(fp_precision, "bessel_df2_order2_cut5000_ba", "DF2", DF2_f, DF2_d, bessel_df2_order2_cut5000_f32_ba[0], bessel_df2_order2_cut5000_f32_ba[1], bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3);
     precision_analysis(fp_precision, "bessel_tdf2_order2_cut5000_ba", "TDF2", TDF2_f, TDF2_d, bessel_tdf2_order2_cut5000_f32_ba[0], bessel_tdf2_order2_cut5000_f32_ba[1], bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3);
     precision_analysis_cascade(fp_precision, "bessel_cascade_order2_cut5000_sos", CASCADE_f, CASCADE_d, (float*)bessel_cascade_order2_cut5000_f32_sos, (double*)bessel_cascade_order2_cut5000_f64_sos, 1);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order2_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)bessel_cascade_order2_cut5000_f32_sos, (double*)bessel_cascade_order2_cut5000_f64_sos, 1);
     precision_analysis(fp_precision, "bessel_df1_order4_cut1000_ba", "DF1", DF1_f, DF1_d, bessel_df1_order4_cut1000_f32_ba[0], bessel_df1_order4_cut1000_f32_ba[1], bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5);
     precision_analysis(fp_precision, "bessel_df2_order4_cut1000_ba", "DF2", DF2_f, DF2_d, bessel_df2_order4_cut1000_f32_ba[0], bessel_df2_order4_cut1000_f32_ba[1], bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5);
     precision_analysis(fp_precision, "bessel_tdf2_order4_cut1000_ba", "TDF2", TDF2_f, TDF2_d, bessel_tdf2_order4_cut1000_f32_ba[0], bessel_tdf2_order4_cut1000_f32_ba[1], bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "bessel_cascade_order4_cut1000_sos", CASCADE_f, CASCADE_d, (float*)bessel_cascade_order4_cut1000_f32_sos, (double*)bessel_cascade_order4_cut1000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)bessel_cascade_order4_cut1000_f32_sos, (double*)bessel_cascade_order4_cut1000_f64_sos, 2);
     precision_analysis(fp_precision, "bessel_df1_order4_cut2000_ba", "DF1", DF1_f, DF1_d, bessel_df1_order4_cut2000_f32_ba[0], bessel_df1_order4_cut2000_f32_ba[1], bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5);
     precision_analysis(fp_precision, "bessel_df2_order4_cut2000_ba", "DF2", DF2_f, DF2_d, bessel_df2_order4_cut2000_f32_ba[0], bessel_df2_order4_cut2000_f32_ba[1], bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5);
     precision_analysis(fp_precision, "bessel_tdf2_order4_cut2000_ba", "TDF2", TDF2_f, TDF2_d, bessel_tdf2_order4_cut2000_f32_ba[0], bessel_tdf2_order4_cut2000_f32_ba[1], bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "bessel_cascade_order4_cut2000_sos", CASCADE_f, CASCADE_d, (float*)bessel_cascade_order4_cut2000_f32_sos, (double*)bessel_cascade_order4_cut2000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)bessel_cascade_order4_cut2000_f32_sos, (double*)bessel_cascade_order4_cut2000_f64_sos, 2);
     precision_analysis(fp_precision, "bessel_df1_order4_cut5000_ba", "DF1", DF1_f, DF1_d, bessel_df1_order4_cut5000_f32_ba[0], bessel_df1_order4_cut5000_f32_ba[1], bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5);
     precision_analysis(fp_precision, "bessel_df2_order4_cut5000_ba", "DF2", DF2_f, DF2_d, bessel_df2_order4_cut5000_f32_ba[0], bessel_df2_order4_cut5000_f32_ba[1], bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5);
     precision_analysis(fp_precision, "bessel_tdf2_order4_cut5000_ba", "TDF2", TDF2_f, TDF2_d, bessel_tdf2_order4_cut5000_f32_ba[0], bessel_tdf2_order4_cut5000_f32_ba[1], bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5);
     precision_analysis_cascade(fp_precision, "bessel_cascade_order4_cut5000_sos", CASCADE_f, CASCADE_d, (float*)bessel_cascade_order4_cut5000_f32_sos, (double*)bessel_cascade_order4_cut5000_f64_sos, 2);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order4_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)bessel_cascade_order4_cut5000_f32_sos, (double*)bessel_cascade_order4_cut5000_f64_sos, 2);
     precision_analysis(fp_precision, "bessel_df1_order6_cut1000_ba", "DF1", DF1_f, DF1_d, bessel_df1_order6_cut1000_f32_ba[0], bessel_df1_order6_cut1000_f32_ba[1], bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7);
     precision_analysis(fp_precision, "bessel_df2_order6_cut1000_ba", "DF2", DF2_f, DF2_d, bessel_df2_order6_cut1000_f32_ba[0], bessel_df2_order6_cut1000_f32_ba[1], bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7);
     precision_analysis(fp_precision, "bessel_tdf2_order6_cut1000_ba", "TDF2", TDF2_f, TDF2_d, bessel_tdf2_order6_cut1000_f32_ba[0], bessel_tdf2_order6_cut1000_f32_ba[1], bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "bessel_cascade_order6_cut1000_sos", CASCADE_f, CASCADE_d, (float*)bessel_cascade_order6_cut1000_f32_sos, (double*)bessel_cascade_order6_cut1000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)bessel_cascade_order6_cut1000_f32_sos, (double*)bessel_cascade_order6_cut1000_f64_sos, 3);
     precision_analysis(fp_precision, "bessel_df1_order6_cut2000_ba", "DF1", DF1_f, DF1_d, bessel_df1_order6_cut2000_f32_ba[0], bessel_df1_order6_cut2000_f32_ba[1], bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7);
     precision_analysis(fp_precision, "bessel_df2_order6_cut2000_ba", "DF2", DF2_f, DF2_d, bessel_df2_order6_cut2000_f32_ba[0], bessel_df2_order6_cut2000_f32_ba[1], bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7);
     precision_analysis(fp_precision, "bessel_tdf2_order6_cut2000_ba", "TDF2", TDF2_f, TDF2_d, bessel_tdf2_order6_cut2000_f32_ba[0], bessel_tdf2_order6_cut2000_f32_ba[1], bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "bessel_cascade_order6_cut2000_sos", CASCADE_f, CASCADE_d, (float*)bessel_cascade_order6_cut2000_f32_sos, (double*)bessel_cascade_order6_cut2000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)bessel_cascade_order6_cut2000_f32_sos, (double*)bessel_cascade_order6_cut2000_f64_sos, 3);
     precision_analysis(fp_precision, "bessel_df1_order6_cut5000_ba", "DF1", DF1_f, DF1_d, bessel_df1_order6_cut5000_f32_ba[0], bessel_df1_order6_cut5000_f32_ba[1], bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7);
     precision_analysis(fp_precision, "bessel_df2_order6_cut5000_ba", "DF2", DF2_f, DF2_d, bessel_df2_order6_cut5000_f32_ba[0], bessel_df2_order6_cut5000_f32_ba[1], bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7);
     precision_analysis(fp_precision, "bessel_tdf2_order6_cut5000_ba", "TDF2", TDF2_f, TDF2_d, bessel_tdf2_order6_cut5000_f32_ba[0], bessel_tdf2_order6_cut5000_f32_ba[1], bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7);
     precision_analysis_cascade(fp_precision, "bessel_cascade_order6_cut5000_sos", CASCADE_f, CASCADE_d, (float*)bessel_cascade_order6_cut5000_f32_sos, (double*)bessel_cascade_order6_cut5000_f64_sos, 3);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order6_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)bessel_cascade_order6_cut5000_f32_sos, (double*)bessel_cascade_order6_cut5000_f64_sos, 3);
     precision_analysis(fp_precision, "bessel_df1_order8_cut1000_ba", "DF1", DF1_f, DF1_d, bessel_df1_order8_cut1000_f32_ba[0], bessel_df1_order8_cut1000_f32_ba[1], bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9);
     precision_analysis(fp_precision, "bessel_df2_order8_cut1000_ba", "DF2", DF2_f, DF2_d, bessel_df2_order8_cut1000_f32_ba[0], bessel_df2_order8_cut1000_f32_ba[1], bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9);
     precision_analysis(fp_precision, "bessel_tdf2_order8_cut1000_ba", "TDF2", TDF2_f, TDF2_d, bessel_tdf2_order8_cut1000_f32_ba[0], bessel_tdf2_order8_cut1000_f32_ba[1], bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "bessel_cascade_order8_cut1000_sos", CASCADE_f, CASCADE_d, (float*)bessel_cascade_order8_cut1000_f32_sos, (double*)bessel_cascade_order8_cut1000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut1000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)bessel_cascade_order8_cut1000_f32_sos, (double*)bessel_cascade_order8_cut1000_f64_sos, 4);
     precision_analysis(fp_precision, "bessel_df1_order8_cut2000_ba", "DF1", DF1_f, DF1_d, bessel_df1_order8_cut2000_f32_ba[0], bessel_df1_order8_cut2000_f32_ba[1], bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9);
     precision_analysis(fp_precision, "bessel_df2_order8_cut2000_ba", "DF2", DF2_f, DF2_d, bessel_df2_order8_cut2000_f32_ba[0], bessel_df2_order8_cut2000_f32_ba[1], bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9);
     precision_analysis(fp_precision, "bessel_tdf2_order8_cut2000_ba", "TDF2", TDF2_f, TDF2_d, bessel_tdf2_order8_cut2000_f32_ba[0], bessel_tdf2_order8_cut2000_f32_ba[1], bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "bessel_cascade_order8_cut2000_sos", CASCADE_f, CASCADE_d, (float*)bessel_cascade_order8_cut2000_f32_sos, (double*)bessel_cascade_order8_cut2000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut2000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)bessel_cascade_order8_cut2000_f32_sos, (double*)bessel_cascade_order8_cut2000_f64_sos, 4);
     precision_analysis(fp_precision, "bessel_df1_order8_cut5000_ba", "DF1", DF1_f, DF1_d, bessel_df1_order8_cut5000_f32_ba[0], bessel_df1_order8_cut5000_f32_ba[1], bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9);
     precision_analysis(fp_precision, "bessel_df2_order8_cut5000_ba", "DF2", DF2_f, DF2_d, bessel_df2_order8_cut5000_f32_ba[0], bessel_df2_order8_cut5000_f32_ba[1], bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9);
     precision_analysis(fp_precision, "bessel_tdf2_order8_cut5000_ba", "TDF2", TDF2_f, TDF2_d, bessel_tdf2_order8_cut5000_f32_ba[0], bessel_tdf2_order8_cut5000_f32_ba[1], bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9);
     precision_analysis_cascade(fp_precision, "bessel_cascade_order8_cut5000_sos", CASCADE_f, CASCADE_d, (float*)bessel_cascade_order8_cut5000_f32_sos, (double*)bessel_cascade_order8_cut5000_f64_sos, 4);
+    precision_analysis_sos(fp_precision, "bessel_cascade_order8_cut5000_sos", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, (float*)bessel_cascade_order8_cut5000_f32_sos, (double*)bessel_cascade_order8_cut5000_f64_sos, 4);
     
     fclose(fp_precision);
+
+    FILE *fp_denormal = fopen("c_floating_denormal_precision.csv", "w");
+    if (!fp_denormal) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+    fprintf(fp_denormal, "filter_name,type,structure,cutoff,order,mode,max_abs_err,rms_err,subnormal_outputs\n");
+
+    precision_denormal(fp_denormal, "butter_df1_order4_cut1000_ba", "DF1", DF1_f, DF1_d, butter_df1_order4_cut1000_f32_ba[0], butter_df1_order4_cut1000_f32_ba[1], butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5);
+    precision_denormal(fp_denormal, "butter_df2_order4_cut1000_ba", "DF2", DF2_f, DF2_d, butter_df2_order4_cut1000_f32_ba[0], butter_df2_order4_cut1000_f32_ba[1], butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5);
+    precision_denormal(fp_denormal, "butter_tdf2_order4_cut1000_ba", "TDF2", TDF2_f, TDF2_d, butter_tdf2_order4_cut1000_f32_ba[0], butter_tdf2_order4_cut1000_f32_ba[1], butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5);
+    precision_denormal_sos(fp_denormal, "butter_cascade_order8_cut2000_sos", "CASCADE", CASCADE_f, CASCADE_d, (float*)butter_cascade_order8_cut2000_f32_sos, (double*)butter_cascade_order8_cut2000_f64_sos, 4);
+    precision_denormal_sos(fp_denormal, "bessel_cascade_order8_cut2000_sos", "CASCADE", CASCADE_f, CASCADE_d, (float*)bessel_cascade_order8_cut2000_f32_sos, (double*)bessel_cascade_order8_cut2000_f64_sos, 4);
+
+    fclose(fp_denormal);
+    pool_release();
 }
@@ -2,35 +2,70 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
-#include <windows.h>
+#include <math.h>
 #include "./lib/structures.h"
+#include "./lib/multichannel.h"
+#include "./lib/parallel.h"
+#include "./lib/specialized.h"
+#include "./lib/runtimespec.h"
+#include "./lib/timing.h"
+#include "./lib/runner.h"
+#include "./lib/perfcounters.h"
+#include "./lib/benchparams.h"
+#include "./lib/siggen.h"
+#include "./lib/denormal.h"
+#include "./lib/streaming.h"
+#include "./lib/latency.h"
+#include "./lib/rtsim.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "../_filtercoeffs/filtercoeffs.h"
+#include "../_filtercoeffs/filterkernels.h"
 
+// Wartości domyślne; n=, fs=, block= w linii poleceń (./lib/benchparams.h)
 #define FS 48000
 #define DURATION_MIN 1
 int N = (FS * 60 * DURATION_MIN);
 
 // Analiza szybkości filtrowania w języku C (reprezentacja zmiennopozycyjna)
-//Kompilacja: gcc -o TimeAnalysis TimeAnalysis.c ./lib/structures.c ../_filtercoeffs/filtercoeffs.c
+//Kompilacja: gcc -O3 -march=native -o TimeAnalysis TimeAnalysis.c ./lib/structures.c ./lib/multichannel.c ./lib/streaming.c ./lib/parallel.c ./lib/specialized.c ../_filtercoeffs/filtercoeffs.c ../_filtercoeffs/filterkernels.c ./lib/runtimespec.c ./lib/timing.c ./lib/runner.c ./lib/perfcounters.c ./lib/bufpool.c ./lib/benchparams.c ./lib/siggen.c ./lib/denormal.c ./lib/latency.c ./lib/rtsim.c -fopenmp -lpthread -ldl -lm
 
 // === Generowanie szumu ===
+// Za każdym razem ten sam sygnał (SIGGEN_SEED), niezależnie od platformy
 void generate_white_noise_f(float *x, int N) {
-    for (int i = 0; i < N; ++i)
-        x[i] = 2.0f * ((float)rand() / RAND_MAX) - 1.0f;
+    siggen g;
+    siggen_init(&g, SG_WHITE, SIGGEN_SEED, 1.0, 0.0, 0.0, 0.0, 0);
+    siggen_block_f(&g, x, N);
 }
 
 void generate_white_noise_d(double *x, int N) {
-    for (int i = 0; i < N; ++i)
-        x[i] = 2.0 * ((double)rand() / RAND_MAX) - 1.0;
+    siggen g;
+    siggen_init(&g, SG_WHITE, SIGGEN_SEED, 1.0, 0.0, 0.0, 0.0, 0);
+    siggen_block_d(&g, x, N);
 }
 
 // === Analiza czasu ===
+// Przy block= jądra z odpowiednikiem w streaming.h liczone są strumieniowo (stan zachowany
+// między blokami, wynik jak dla całego sygnału); pozostałe dostają każdy blok od zerowego stanu.
+// Zwraca 0 DF1, 1 DF2, 2 TDF2 albo -1 (brak wersji strumieniowej); CASCADE_f w benchmark_sos_and_log.
+static int stream_structure_f(void (*func_f)(float*, float*, float*, float*, int, int)) {
+    return func_f == DF1_f ? 0 : func_f == DF2_f ? 1 : func_f == TDF2_f ? 2 : -1;
+}
+
+static int stream_structure_d(void (*func_d)(double*, double*, double*, double*, int, int)) {
+    return func_d == DF1_d ? 0 : func_d == DF2_d ? 1 : func_d == TDF2_d ? 2 : -1;
+}
+
 void benchmark_and_log(FILE *fp, const char *filter_name, const char *type, const char *structure,
                        void (*func_f)(float*, float*, float*, float*, int, int),
                        void (*func_d)(double*, double*, double*, double*, int, int),
                        float *b_f, float *a_f, double *b_d, double *a_d, int order) {
 
-    LARGE_INTEGER freq, start, end;
+    timing_t start, end;
+    perf_sample ps;
+    pool_faults pf0, pf1;
+    int step = bench_step(N);
     double time_spent;
     int cutoff = -1;
 
@@ -42,48 +77,100 @@ void benchmark_and_log(FILE *fp, const char *filter_name, const char *type, cons
         sscanf(cut_ptr, "_cut%d", &cutoff);
     
     if (strcmp(type, "float") == 0 && func_f) {
-        float *x = malloc(sizeof(float) * N);
-        float *y = malloc(sizeof(float) * N);
+        float *x = pool_buffer(POOL_X, sizeof(float) * N);
+        float *y = pool_buffer(POOL_Y, sizeof(float) * N);
         generate_white_noise_f(x, N);
 
-        QueryPerformanceFrequency(&freq);
-        QueryPerformanceCounter(&start);
+        int s = step < N ? stream_structure_f(func_f) : -1;
+        DF1_state_f df1;
+        DF2_state_f df2;
+        TDF2_state_f tdf2;
+        switch (s) {
+        case 0: DF1_init_f(&df1, b_f, a_f, order); break;
+        case 1: DF2_init_f(&df2, b_f, a_f, order); break;
+        case 2: TDF2_init_f(&tdf2, b_f, a_f, order); break;
+        }
 
-        func_f(x, y, b_f, a_f, N, order);
+        pool_faults_now(&pf0);
+        perf_start();
+        start = timing_now();
 
-        QueryPerformanceCounter(&end);
-        time_spent = (double)(end.QuadPart - start.QuadPart) / (double)freq.QuadPart;
+        for (int off = 0; off < N; off += step) {
+            int len = (N - off < step) ? N - off : step;
+            switch (s) {
+            case 0: DF1_block_f(&df1, x + off, y + off, len); break;
+            case 1: DF2_block_f(&df2, x + off, y + off, len); break;
+            case 2: TDF2_block_f(&tdf2, x + off, y + off, len); break;
+            default: func_f(x + off, y + off, b_f, a_f, len, order); break;
+            }
+        }
 
-        fprintf(fp, "%s,float,%s,%d,%d,%.6f\n", filter_type, structure, cutoff, order - 1, time_spent);
+        end = timing_now();
+        perf_stop(&ps);
+        pool_faults_now(&pf1);
+        time_spent = timing_seconds(start, end);
+
+        fprintf(fp, "%s,float,%s,%d,%d,%.6f", filter_type, structure, cutoff, order - 1, time_spent);
+        bench_fprint_columns(fp, time_spent, s >= 0 ? BLOCK_STREAM : BLOCK_RESTART, &pf0, &pf1);
+        perf_fprint_columns(fp, &ps, N);
+        fprintf(fp, "\n");
+        runner_report(time_spent, "%s,float,%s,%d,%d", filter_type, structure, cutoff, order - 1);
         printf("[LOG] %s (float, %s, cut %d, order %d): %.6f sec\n", filter_type, structure, cutoff, order - 1, time_spent);
-        free(x); free(y);
     }
 
     if (strcmp(type, "double") == 0 && func_d) {
-        double *x = malloc(sizeof(double) * N);
-        double *y = malloc(sizeof(double) * N);
+        double *x = pool_buffer(POOL_X, sizeof(double) * N);
+        double *y = pool_buffer(POOL_Y, sizeof(double) * N);
         generate_white_noise_d(x, N);
 
-        QueryPerformanceFrequency(&freq);
-        QueryPerformanceCounter(&start);
+        int s = step < N ? stream_structure_d(func_d) : -1;
+        DF1_state_d df1;
+        DF2_state_d df2;
+        TDF2_state_d tdf2;
+        switch (s) {
+        case 0: DF1_init_d(&df1, b_d, a_d, order); break;
+        case 1: DF2_init_d(&df2, b_d, a_d, order); break;
+        case 2: TDF2_init_d(&tdf2, b_d, a_d, order); break;
+        }
 
-        func_d(x, y, b_d, a_d, N, order);
+        pool_faults_now(&pf0);
+        perf_start();
+        start = timing_now();
 
-        QueryPerformanceCounter(&end);
-        time_spent = (double)(end.QuadPart - start.QuadPart) / (double)freq.QuadPart;
+        for (int off = 0; off < N; off += step) {
+            int len = (N - off < step) ? N - off : step;
+            switch (s) {
+            case 0: DF1_block_d(&df1, x + off, y + off, len); break;
+            case 1: DF2_block_d(&df2, x + off, y + off, len); break;
+            case 2: TDF2_block_d(&tdf2, x + off, y + off, len); break;
+            default: func_d(x + off, y + off, b_d, a_d, len, order); break;
+            }
+        }
 
-        fprintf(fp, "%s,double,%s,%d,%d,%.6f\n", filter_type, structure, cutoff, order - 1, time_spent);
+        end = timing_now();
+        perf_stop(&ps);
+        pool_faults_now(&pf1);
+        time_spent = timing_seconds(start, end);
+
+        fprintf(fp, "%s,double,%s,%d,%d,%.6f", filter_type, structure, cutoff, order - 1, time_spent);
+        bench_fprint_columns(fp, time_spent, s >= 0 ? BLOCK_STREAM : BLOCK_RESTART, &pf0, &pf1);
+        perf_fprint_columns(fp, &ps, N);
+        fprintf(fp, "\n");
+        runner_report(time_spent, "%s,double,%s,%d,%d", filter_type, structure, cutoff, order - 1);
         printf("[LOG] %s (double, %s, cut %d, order %d): %.6f sec\n", filter_type, structure, cutoff, order - 1, time_spent);
-        free(x); free(y);
     }
 }
 
-void benchmark_cascade_and_log(FILE *fp, const char *filter_name, const char *type,
-                                void (*func_f)(float*, float*, float*, int, int),
-                                void (*func_d)(double*, double*, double*, int, int),
-                                float *sos_f, double *sos_d, int sections) {
+// Struktury oparte na SOS (CASCADE, BLOCKSS); structure trafia do kolumny CSV
+void benchmark_sos_and_log(FILE *fp, const char *filter_name, const char *type, const char *structure,
+                           void (*func_f)(float*, float*, float*, int, int),
+                           void (*func_d)(double*, double*, double*, int, int),
+                           float *sos_f, double *sos_d, int sections) {
 
-    LARGE_INTEGER freq, start, end;
+    timing_t start, end;
+    perf_sample ps;
+    pool_faults pf0, pf1;
+    int step = bench_step(N);
     double time_spent;
     int cutoff = -1;
 
@@ -97,537 +184,2303 @@ void benchmark_cascade_and_log(FILE *fp, const char *filter_name, const char *ty
         sscanf(cut_ptr, "_cut%d", &cutoff);
 
     if (strcmp(type, "float") == 0 && func_f) {
-        float *x = malloc(sizeof(float) * N);
-        float *y = malloc(sizeof(float) * N);
+        float *x = pool_buffer(POOL_X, sizeof(float) * N);
+        float *y = pool_buffer(POOL_Y, sizeof(float) * N);
+        generate_white_noise_f(x, N);
 
-        QueryPerformanceFrequency(&freq);
-        QueryPerformanceCounter(&start);
+        int s = step < N && func_f == CASCADE_f ? 3 : -1;
+        CASCADE_state_f cascade;
+        if (s == 3) CASCADE_init_f(&cascade, sos_f, sections);
 
-        func_f(x, y, sos_f, N, sections);
+        pool_faults_now(&pf0);
+        perf_start();
+        start = timing_now();
 
-        QueryPerformanceCounter(&end);
-        time_spent = (double)(end.QuadPart - start.QuadPart) / (double)freq.QuadPart;
+        for (int off = 0; off < N; off += step) {
+            int len = (N - off < step) ? N - off : step;
+            if (s == 3) CASCADE_block_f(&cascade, x + off, y + off, len);
+            else func_f(x + off, y + off, sos_f, len, sections);
+        }
 
-        fprintf(fp, "%s,float,CASCADE,%d,%d,%.6f\n", filter_type, cutoff, 2 * sections, time_spent);
-        printf("[LOG] %s (float, CASCADE, cut %d, order %d): %.6f sec\n", filter_type, cutoff, 2 * sections, time_spent);
-        free(x); free(y);
+        end = timing_now();
+        perf_stop(&ps);
+        pool_faults_now(&pf1);
+        time_spent = timing_seconds(start, end);
+
+        fprintf(fp, "%s,float,%s,%d,%d,%.6f", filter_type, structure, cutoff, 2 * sections, time_spent);
+        bench_fprint_columns(fp, time_spent, s >= 0 ? BLOCK_STREAM : BLOCK_RESTART, &pf0, &pf1);
+        perf_fprint_columns(fp, &ps, N);
+        fprintf(fp, "\n");
+        runner_report(time_spent, "%s,float,%s,%d,%d", filter_type, structure, cutoff, 2 * sections);
+        printf("[LOG] %s (float, %s, cut %d, order %d): %.6f sec\n", filter_type, structure, cutoff, 2 * sections, time_spent);
     }
 
     if (strcmp(type, "double") == 0 && func_d) {
+        double *x = pool_buffer(POOL_X, sizeof(double) * N);
+        double *y = pool_buffer(POOL_Y, sizeof(double) * N);
+        generate_white_noise_d(x, N);
+
+        int s = step < N && func_d == CASCADE_d ? 3 : -1;
+        CASCADE_state_d cascade;
+        if (s == 3) CASCADE_init_d(&cascade, sos_d, sections);
+
+        pool_faults_now(&pf0);
+        perf_start();
+        start = timing_now();
+
+        for (int off = 0; off < N; off += step) {
+            int len = (N - off < step) ? N - off : step;
+            if (s == 3) CASCADE_block_d(&cascade, x + off, y + off, len);
+            else func_d(x + off, y + off, sos_d, len, sections);
+        }
+
+        end = timing_now();
+        perf_stop(&ps);
+        pool_faults_now(&pf1);
+        time_spent = timing_seconds(start, end);
+
+        fprintf(fp, "%s,double,%s,%d,%d,%.6f", filter_type, structure, cutoff, 2 * sections, time_spent);
+        bench_fprint_columns(fp, time_spent, s >= 0 ? BLOCK_STREAM : BLOCK_RESTART, &pf0, &pf1);
+        perf_fprint_columns(fp, &ps, N);
+        fprintf(fp, "\n");
+        runner_report(time_spent, "%s,double,%s,%d,%d", filter_type, structure, cutoff, 2 * sections);
+        printf("[LOG] %s (double, %s, cut %d, order %d): %.6f sec\n", filter_type, structure, cutoff, 2 * sections, time_spent);
+    }
+}
+
+void benchmark_cascade_and_log(FILE *fp, const char *filter_name, const char *type,
+                                void (*func_f)(float*, float*, float*, int, int),
+                                void (*func_d)(double*, double*, double*, int, int),
+                                float *sos_f, double *sos_d, int sections) {
+    benchmark_sos_and_log(fp, filter_name, type, "CASCADE", func_f, func_d, sos_f, sos_d, sections);
+}
+
+// === Analiza czasu (wiele kanałów) ===
+// Łączna liczba próbek jak w benchmark_and_log (N), rozłożona na channels kanałów.
+// layout: MC_INTERLEAVED / MC_PLANAR, lub -1 = pętla po kanałach z jądrem skalarnym.
+// Wynik: próbki na sekundę na kanał.
+static const char *mc_layout_name(int layout) {
+    if (layout == MC_INTERLEAVED) return "interleaved";
+    if (layout == MC_PLANAR) return "planar";
+    return "scalar";
+}
+
+void benchmark_mc_and_log(FILE *fp, const char *filter_name, const char *type, const char *structure,
+                          void (*func_f)(float*, float*, float*, float*, int, int, int, int),
+                          void (*func_d)(double*, double*, double*, double*, int, int, int, int),
+                          void (*scalar_f)(float*, float*, float*, float*, int, int),
+                          void (*scalar_d)(double*, double*, double*, double*, int, int),
+                          float *b_f, float *a_f, double *b_d, double *a_d, int order,
+                          int channels, int layout) {
+
+    timing_t start, end;
+    double time_spent;
+    int cutoff = -1;
+    int frames = N / channels;
+
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+
+    if (strcmp(type, "float") == 0) {
+        float *x = malloc(sizeof(float) * frames * channels);
+        float *y = malloc(sizeof(float) * frames * channels);
+        generate_white_noise_f(x, frames * channels);
+        memset(y, 0, sizeof(float) * frames * channels);
+
+        start = timing_now();
+        if (layout < 0)
+            for (int c = 0; c < channels; ++c)
+                scalar_f(x + (size_t)c * frames, y + (size_t)c * frames, b_f, a_f, frames, order);
+        else
+            func_f(x, y, b_f, a_f, frames, order, channels, layout);
+        end = timing_now();
+        free(x); free(y);
+    } else {
+        double *x = malloc(sizeof(double) * frames * channels);
+        double *y = malloc(sizeof(double) * frames * channels);
+        generate_white_noise_d(x, frames * channels);
+        memset(y, 0, sizeof(double) * frames * channels);
+
+        start = timing_now();
+        if (layout < 0)
+            for (int c = 0; c < channels; ++c)
+                scalar_d(x + (size_t)c * frames, y + (size_t)c * frames, b_d, a_d, frames, order);
+        else
+            func_d(x, y, b_d, a_d, frames, order, channels, layout);
+        end = timing_now();
+        free(x); free(y);
+    }
+
+    time_spent = timing_seconds(start, end);
+    double sps = (double)frames / time_spent;
+
+    fprintf(fp, "%s,%s,%s,%d,%d,%d,%s,%.6f,%.1f\n", filter_type, type, structure, cutoff, order - 1, channels, mc_layout_name(layout), time_spent, sps);
+    printf("[LOG] %s (%s, %s, cut %d, order %d, %d ch, %s): %.6f sec, %.3e samples/s/ch\n", filter_type, type, structure, cutoff, order - 1, channels, mc_layout_name(layout), time_spent, sps);
+}
+
+void benchmark_mc_cascade_and_log(FILE *fp, const char *filter_name, const char *type,
+                                  float *sos_f, double *sos_d, int sections,
+                                  int channels, int layout) {
+
+    timing_t start, end;
+    double time_spent;
+    int cutoff = -1;
+    int frames = N / channels;
+
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+
+    if (strcmp(type, "float") == 0) {
+        float *x = malloc(sizeof(float) * frames * channels);
+        float *y = malloc(sizeof(float) * frames * channels);
+        generate_white_noise_f(x, frames * channels);
+        memset(y, 0, sizeof(float) * frames * channels);
+
+        start = timing_now();
+        if (layout < 0)
+            for (int c = 0; c < channels; ++c)
+                CASCADE_ip_f(x + (size_t)c * frames, y + (size_t)c * frames, sos_f, frames, sections);
+        else
+            CASCADE_mc_f(x, y, sos_f, frames, sections, channels, layout);
+        end = timing_now();
+        free(x); free(y);
+    } else {
+        double *x = malloc(sizeof(double) * frames * channels);
+        double *y = malloc(sizeof(double) * frames * channels);
+        generate_white_noise_d(x, frames * channels);
+        memset(y, 0, sizeof(double) * frames * channels);
+
+        start = timing_now();
+        if (layout < 0)
+            for (int c = 0; c < channels; ++c)
+                CASCADE_ip_d(x + (size_t)c * frames, y + (size_t)c * frames, sos_d, frames, sections);
+        else
+            CASCADE_mc_d(x, y, sos_d, frames, sections, channels, layout);
+        end = timing_now();
+        free(x); free(y);
+    }
+
+    time_spent = timing_seconds(start, end);
+    double sps = (double)frames / time_spent;
+
+    fprintf(fp, "%s,%s,CASCADE,%d,%d,%d,%s,%.6f,%.1f\n", filter_type, type, cutoff, 2 * sections, channels, mc_layout_name(layout), time_spent, sps);
+    printf("[LOG] %s (%s, CASCADE, cut %d, order %d, %d ch, %s): %.6f sec, %.3e samples/s/ch\n", filter_type, type, cutoff, 2 * sections, channels, mc_layout_name(layout), time_spent, sps);
+}
+
+// === Zgodność jąder wielokanałowych (SIMD) ze skalarnymi ===
+// Każdy kanał filtrowany osobno jądrem skalarnym i porównywany bit w bit z *_mc (oba układy danych).
+// DF1 / TDF2 / CASCADE: zgodne przy każdych flagach; DF2 tylko z -ffp-contract=off
+// (patrz multichannel.h) - przy -march=native różnice w DF2 są oczekiwane.
+#define MC_CHECK_CHANNELS 19  // celowo niepełna ostatnia grupa wektorowa
+
+long mc_exactness_check_f(FILE *fp, const char *filter_name, const char *structure,
+                          float *b, float *a, int order, float *sos, int sections) {
+    int C = MC_CHECK_CHANNELS;
+    int frames = N / C;
+    int cutoff = -1;
+    int rank = sos ? 2 * sections : order - 1;
+    char filter_type[32];
+    long total = 0;
+
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    float *x_planar = malloc(sizeof(float) * frames * C);
+    float *x_inter = malloc(sizeof(float) * frames * C);
+    float *y_mc = malloc(sizeof(float) * frames * C);
+    float *y_ref = malloc(sizeof(float) * frames);
+
+    generate_white_noise_f(x_planar, frames * C);
+    for (int c = 0; c < C; ++c)
+        for (int n = 0; n < frames; ++n)
+            x_inter[(size_t)n * C + c] = x_planar[(size_t)c * frames + n];
+
+    for (int layout = MC_INTERLEAVED; layout <= MC_PLANAR; ++layout) {
+        float *x_mc = (layout == MC_PLANAR) ? x_planar : x_inter;
+        long mismatches = 0;
+
+        if (strcmp(structure, "DF1") == 0) DF1_mc_f(x_mc, y_mc, b, a, frames, order, C, layout);
+        else if (strcmp(structure, "DF2") == 0) DF2_mc_f(x_mc, y_mc, b, a, frames, order, C, layout);
+        else if (strcmp(structure, "TDF2") == 0) TDF2_mc_f(x_mc, y_mc, b, a, frames, order, C, layout);
+        else CASCADE_mc_f(x_mc, y_mc, sos, frames, sections, C, layout);
+
+        for (int c = 0; c < C; ++c) {
+            float *x_ref = x_planar + (size_t)c * frames;
+            if (strcmp(structure, "DF1") == 0) DF1_f(x_ref, y_ref, b, a, frames, order);
+            else if (strcmp(structure, "DF2") == 0) DF2_f(x_ref, y_ref, b, a, frames, order);
+            else if (strcmp(structure, "TDF2") == 0) TDF2_f(x_ref, y_ref, b, a, frames, order);
+            else CASCADE_ip_f(x_ref, y_ref, sos, frames, sections);
+
+            for (int n = 0; n < frames; ++n) {
+                size_t k = (layout == MC_PLANAR) ? (size_t)c * frames + n : (size_t)n * C + c;
+                mismatches += y_ref[n] != y_mc[k];
+            }
+        }
+
+        fprintf(fp, "%s,float,%s,%d,%d,%d,%s,%ld\n", filter_type, structure, cutoff, rank, C, mc_layout_name(layout), mismatches);
+        printf("[LOG] %s (float, %s_mc, cut %d, order %d, %d ch, %s): %ld mismatches\n", filter_type, structure, cutoff, rank, C, mc_layout_name(layout), mismatches);
+        total += mismatches;
+    }
+
+    free(x_planar); free(x_inter); free(y_mc); free(y_ref);
+    return total;
+}
+
+long mc_exactness_check_d(FILE *fp, const char *filter_name, const char *structure,
+                          double *b, double *a, int order, double *sos, int sections) {
+    int C = MC_CHECK_CHANNELS;
+    int frames = N / C;
+    int cutoff = -1;
+    int rank = sos ? 2 * sections : order - 1;
+    char filter_type[32];
+    long total = 0;
+
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    double *x_planar = malloc(sizeof(double) * frames * C);
+    double *x_inter = malloc(sizeof(double) * frames * C);
+    double *y_mc = malloc(sizeof(double) * frames * C);
+    double *y_ref = malloc(sizeof(double) * frames);
+
+    generate_white_noise_d(x_planar, frames * C);
+    for (int c = 0; c < C; ++c)
+        for (int n = 0; n < frames; ++n)
+            x_inter[(size_t)n * C + c] = x_planar[(size_t)c * frames + n];
+
+    for (int layout = MC_INTERLEAVED; layout <= MC_PLANAR; ++layout) {
+        double *x_mc = (layout == MC_PLANAR) ? x_planar : x_inter;
+        long mismatches = 0;
+
+        if (strcmp(structure, "DF1") == 0) DF1_mc_d(x_mc, y_mc, b, a, frames, order, C, layout);
+        else if (strcmp(structure, "DF2") == 0) DF2_mc_d(x_mc, y_mc, b, a, frames, order, C, layout);
+        else if (strcmp(structure, "TDF2") == 0) TDF2_mc_d(x_mc, y_mc, b, a, frames, order, C, layout);
+        else CASCADE_mc_d(x_mc, y_mc, sos, frames, sections, C, layout);
+
+        for (int c = 0; c < C; ++c) {
+            double *x_ref = x_planar + (size_t)c * frames;
+            if (strcmp(structure, "DF1") == 0) DF1_d(x_ref, y_ref, b, a, frames, order);
+            else if (strcmp(structure, "DF2") == 0) DF2_d(x_ref, y_ref, b, a, frames, order);
+            else if (strcmp(structure, "TDF2") == 0) TDF2_d(x_ref, y_ref, b, a, frames, order);
+            else CASCADE_ip_d(x_ref, y_ref, sos, frames, sections);
+
+            for (int n = 0; n < frames; ++n) {
+                size_t k = (layout == MC_PLANAR) ? (size_t)c * frames + n : (size_t)n * C + c;
+                mismatches += y_ref[n] != y_mc[k];
+            }
+        }
+
+        fprintf(fp, "%s,double,%s,%d,%d,%d,%s,%ld\n", filter_type, structure, cutoff, rank, C, mc_layout_name(layout), mismatches);
+        printf("[LOG] %s (double, %s_mc, cut %d, order %d, %d ch, %s): %ld mismatches\n", filter_type, structure, cutoff, rank, C, mc_layout_name(layout), mismatches);
+        total += mismatches;
+    }
+
+    free(x_planar); free(x_inter); free(y_mc); free(y_ref);
+    return total;
+}
+
+// === Koszt alokacji w CASCADE ===
+// Porównanie CASCADE (malloc przy każdym wywołaniu) z wariantem z buforem roboczym
+// (CASCADE_ws) i wariantem w miejscu (CASCADE_ip); MALLOC to sam koszt malloc + zapis + free.
+void benchmark_cascade_alloc_and_log(FILE *fp, const char *filter_name, const char *type,
+                                     float *sos_f, double *sos_d, int sections) {
+
+    timing_t start, end;
+    double t_malloc, t_cascade, t_ws, t_ip;
+    int cutoff = -1;
+
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+
+    if (strcmp(type, "float") == 0) {
+        float *x = malloc(sizeof(float) * N);
+        float *y = malloc(sizeof(float) * N);
+        float *work = malloc(sizeof(float) * N);
+        memset(y, 0, sizeof(float) * N);
+        memset(work, 0, sizeof(float) * N);
+
+        start = timing_now();
+        volatile float *tmp = malloc(sizeof(float) * N);  // volatile: kompilator nie usunie alokacji
+        for (int i = 0; i < N; ++i) tmp[i] = 0.0f;
+        free((void *)tmp);
+        end = timing_now();
+        t_malloc = timing_seconds(start, end);
+
+        generate_white_noise_f(x, N);  // CASCADE_f nadpisuje x przy sections >= 2
+        start = timing_now();
+        CASCADE_f(x, y, sos_f, N, sections);
+        end = timing_now();
+        t_cascade = timing_seconds(start, end);
+
+        generate_white_noise_f(x, N);
+        start = timing_now();
+        CASCADE_ws_f(x, y, sos_f, N, sections, work);
+        end = timing_now();
+        t_ws = timing_seconds(start, end);
+
+        start = timing_now();
+        CASCADE_ip_f(x, y, sos_f, N, sections);
+        end = timing_now();
+        t_ip = timing_seconds(start, end);
+
+        free(x); free(y); free(work);
+    } else {
         double *x = malloc(sizeof(double) * N);
         double *y = malloc(sizeof(double) * N);
+        double *work = malloc(sizeof(double) * N);
+        memset(y, 0, sizeof(double) * N);
+        memset(work, 0, sizeof(double) * N);
+
+        start = timing_now();
+        volatile double *tmp = malloc(sizeof(double) * N);  // volatile: kompilator nie usunie alokacji
+        for (int i = 0; i < N; ++i) tmp[i] = 0.0;
+        free((void *)tmp);
+        end = timing_now();
+        t_malloc = timing_seconds(start, end);
+
         generate_white_noise_d(x, N);
+        start = timing_now();
+        CASCADE_d(x, y, sos_d, N, sections);
+        end = timing_now();
+        t_cascade = timing_seconds(start, end);
+
+        generate_white_noise_d(x, N);
+        start = timing_now();
+        CASCADE_ws_d(x, y, sos_d, N, sections, work);
+        end = timing_now();
+        t_ws = timing_seconds(start, end);
+
+        start = timing_now();
+        CASCADE_ip_d(x, y, sos_d, N, sections);
+        end = timing_now();
+        t_ip = timing_seconds(start, end);
+
+        free(x); free(y); free(work);
+    }
+
+    fprintf(fp, "%s,%s,MALLOC,%d,%d,%.6f\n", filter_type, type, cutoff, 2 * sections, t_malloc);
+    fprintf(fp, "%s,%s,CASCADE,%d,%d,%.6f\n", filter_type, type, cutoff, 2 * sections, t_cascade);
+    fprintf(fp, "%s,%s,CASCADE_WS,%d,%d,%.6f\n", filter_type, type, cutoff, 2 * sections, t_ws);
+    fprintf(fp, "%s,%s,CASCADE_IP,%d,%d,%.6f\n", filter_type, type, cutoff, 2 * sections, t_ip);
+    printf("[LOG] %s (%s, cut %d, order %d): malloc %.6f, CASCADE %.6f, WS %.6f, IP %.6f sec\n",
+           filter_type, type, cutoff, 2 * sections, t_malloc, t_cascade, t_ws, t_ip);
+}
+
+// Tryb "alloc": ./TimeAnalysis alloc
+int run_alloc_benchmark(void) {
+    FILE *fp = fopen("c_floating_alloc_results.csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+
+    fprintf(fp, "filter_name,type,structure,cutoff,order,time_seconds\n");
+
+    for (size_t i = 0; i < 20; i++)
+    {
+        benchmark_cascade_alloc_and_log(fp, "butter_cascade_order2_cut1000_f64_sos", "double", NULL, *butter_cascade_order2_cut1000_f64_sos, 1);
+        benchmark_cascade_alloc_and_log(fp, "butter_cascade_order4_cut1000_f64_sos", "double", NULL, *butter_cascade_order4_cut1000_f64_sos, 2);
+        benchmark_cascade_alloc_and_log(fp, "butter_cascade_order6_cut1000_f64_sos", "double", NULL, *butter_cascade_order6_cut1000_f64_sos, 3);
+        benchmark_cascade_alloc_and_log(fp, "butter_cascade_order8_cut1000_f64_sos", "double", NULL, *butter_cascade_order8_cut1000_f64_sos, 4);
+        benchmark_cascade_alloc_and_log(fp, "butter_cascade_order2_cut1000_f32_sos", "float", *butter_cascade_order2_cut1000_f32_sos, NULL, 1);
+        benchmark_cascade_alloc_and_log(fp, "butter_cascade_order4_cut1000_f32_sos", "float", *butter_cascade_order4_cut1000_f32_sos, NULL, 2);
+        benchmark_cascade_alloc_and_log(fp, "butter_cascade_order6_cut1000_f32_sos", "float", *butter_cascade_order6_cut1000_f32_sos, NULL, 3);
+        benchmark_cascade_alloc_and_log(fp, "butter_cascade_order8_cut1000_f32_sos", "float", *butter_cascade_order8_cut1000_f32_sos, NULL, 4);
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+// === CASCADE kafelkowy ===
+// Przyspieszenie CASCADE_tiled względem CASCADE_ip (sekcja po sekcji na całym sygnale)
+// w funkcji rozmiaru kafla.
+static const int tile_sizes[] = {64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 65536};
+#define NUM_TILE_SIZES (int)(sizeof(tile_sizes) / sizeof(tile_sizes[0]))
+
+void benchmark_cascade_tiled_and_log(FILE *fp, const char *filter_name, const char *type,
+                                     float *sos_f, double *sos_d, int sections) {
+
+    timing_t start, end;
+    double t_ref, t_tile;
+    int cutoff = -1;
+
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+
+    if (strcmp(type, "float") == 0) {
+        float *x = malloc(sizeof(float) * N);
+        float *y = malloc(sizeof(float) * N);
+        generate_white_noise_f(x, N);
+        memset(y, 0, sizeof(float) * N);
+
+        start = timing_now();
+        CASCADE_ip_f(x, y, sos_f, N, sections);
+        end = timing_now();
+        t_ref = timing_seconds(start, end);
+
+        for (int k = 0; k < NUM_TILE_SIZES; ++k) {
+            start = timing_now();
+            CASCADE_tiled_f(x, y, sos_f, N, sections, tile_sizes[k]);
+            end = timing_now();
+            t_tile = timing_seconds(start, end);
 
-        QueryPerformanceFrequency(&freq);
-        QueryPerformanceCounter(&start);
+            fprintf(fp, "%s,float,CASCADE_TILED,%d,%d,%d,%.6f,%.4f\n", filter_type, cutoff, 2 * sections, tile_sizes[k], t_tile, t_ref / t_tile);
+            printf("[LOG] %s (float, CASCADE_TILED, cut %d, order %d, tile %d): %.6f sec, speedup %.3f\n", filter_type, cutoff, 2 * sections, tile_sizes[k], t_tile, t_ref / t_tile);
+        }
+        fprintf(fp, "%s,float,CASCADE_IP,%d,%d,%d,%.6f,%.4f\n", filter_type, cutoff, 2 * sections, N, t_ref, 1.0);
+        free(x); free(y);
+    } else {
+        double *x = malloc(sizeof(double) * N);
+        double *y = malloc(sizeof(double) * N);
+        generate_white_noise_d(x, N);
+        memset(y, 0, sizeof(double) * N);
 
-        func_d(x, y, sos_d, N, sections);
+        start = timing_now();
+        CASCADE_ip_d(x, y, sos_d, N, sections);
+        end = timing_now();
+        t_ref = timing_seconds(start, end);
 
-        QueryPerformanceCounter(&end);
-        time_spent = (double)(end.QuadPart - start.QuadPart) / (double)freq.QuadPart;
+        for (int k = 0; k < NUM_TILE_SIZES; ++k) {
+            start = timing_now();
+            CASCADE_tiled_d(x, y, sos_d, N, sections, tile_sizes[k]);
+            end = timing_now();
+            t_tile = timing_seconds(start, end);
 
-        fprintf(fp, "%s,double,CASCADE,%d,%d,%.6f\n", filter_type, cutoff, 2 * sections, time_spent);
-        printf("[LOG] %s (double, CASCADE, cut %d, order %d): %.6f sec\n", filter_type, cutoff, 2 * sections, time_spent);
+            fprintf(fp, "%s,double,CASCADE_TILED,%d,%d,%d,%.6f,%.4f\n", filter_type, cutoff, 2 * sections, tile_sizes[k], t_tile, t_ref / t_tile);
+            printf("[LOG] %s (double, CASCADE_TILED, cut %d, order %d, tile %d): %.6f sec, speedup %.3f\n", filter_type, cutoff, 2 * sections, tile_sizes[k], t_tile, t_ref / t_tile);
+        }
+        fprintf(fp, "%s,double,CASCADE_IP,%d,%d,%d,%.6f,%.4f\n", filter_type, cutoff, 2 * sections, N, t_ref, 1.0);
         free(x); free(y);
     }
 }
 
-int main() {
-    FILE *fp = fopen("c_floating_time_results.csv", "w");
+// Tryb "tile": ./TimeAnalysis tile
+int run_tile_benchmark(void) {
+    FILE *fp = fopen("c_floating_tile_results.csv", "w");
     if (!fp) {
         perror("Can't open CSV file");
         return 1;
     }
 
-    fprintf(fp, "filter_name,type,structure,cutoff,order,time_seconds\n");
-    
+    fprintf(fp, "filter_name,type,structure,cutoff,order,tile,time_seconds,speedup\n");
+
     for (size_t i = 0; i < 20; i++)
     {
-        // Tu wkleić zawartość pliku generated_calls_time_floating.txt
-        benchmark_and_log(fp, "butter_df1_order2_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3);
-        benchmark_and_log(fp, "butter_df2_order2_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3);
-        benchmark_and_log(fp, "butter_tdf2_order2_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "butter_cascade_order2_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order2_cut1000_f64_sos, 1);
-        benchmark_and_log(fp, "butter_df1_order2_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order2_cut1000_f32_ba[0], butter_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "butter_df2_order2_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order2_cut1000_f32_ba[0], butter_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "butter_tdf2_order2_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order2_cut1000_f32_ba[0], butter_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "butter_cascade_order2_cut1000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order2_cut1000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "butter_df1_order2_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3);
-        benchmark_and_log(fp, "butter_df2_order2_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3);
-        benchmark_and_log(fp, "butter_tdf2_order2_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "butter_cascade_order2_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order2_cut2000_f64_sos, 1);
-        benchmark_and_log(fp, "butter_df1_order2_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order2_cut2000_f32_ba[0], butter_df1_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "butter_df2_order2_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order2_cut2000_f32_ba[0], butter_df2_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "butter_tdf2_order2_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order2_cut2000_f32_ba[0], butter_tdf2_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "butter_cascade_order2_cut2000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order2_cut2000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "butter_df1_order2_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3);
-        benchmark_and_log(fp, "butter_df2_order2_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3);
-        benchmark_and_log(fp, "butter_tdf2_order2_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "butter_cascade_order2_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order2_cut5000_f64_sos, 1);
-        benchmark_and_log(fp, "butter_df1_order2_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order2_cut5000_f32_ba[0], butter_df1_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "butter_df2_order2_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order2_cut5000_f32_ba[0], butter_df2_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "butter_tdf2_order2_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order2_cut5000_f32_ba[0], butter_tdf2_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "butter_cascade_order2_cut5000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order2_cut5000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "butter_df1_order4_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5);
-        benchmark_and_log(fp, "butter_df2_order4_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5);
-        benchmark_and_log(fp, "butter_tdf2_order4_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "butter_cascade_order4_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order4_cut1000_f64_sos, 2);
-        benchmark_and_log(fp, "butter_df1_order4_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order4_cut1000_f32_ba[0], butter_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "butter_df2_order4_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order4_cut1000_f32_ba[0], butter_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "butter_tdf2_order4_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order4_cut1000_f32_ba[0], butter_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "butter_cascade_order4_cut1000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order4_cut1000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "butter_df1_order4_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5);
-        benchmark_and_log(fp, "butter_df2_order4_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5);
-        benchmark_and_log(fp, "butter_tdf2_order4_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "butter_cascade_order4_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order4_cut2000_f64_sos, 2);
-        benchmark_and_log(fp, "butter_df1_order4_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order4_cut2000_f32_ba[0], butter_df1_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "butter_df2_order4_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order4_cut2000_f32_ba[0], butter_df2_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "butter_tdf2_order4_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order4_cut2000_f32_ba[0], butter_tdf2_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "butter_cascade_order4_cut2000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order4_cut2000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "butter_df1_order4_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5);
-        benchmark_and_log(fp, "butter_df2_order4_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5);
-        benchmark_and_log(fp, "butter_tdf2_order4_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "butter_cascade_order4_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order4_cut5000_f64_sos, 2);
-        benchmark_and_log(fp, "butter_df1_order4_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order4_cut5000_f32_ba[0], butter_df1_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "butter_df2_order4_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order4_cut5000_f32_ba[0], butter_df2_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "butter_tdf2_order4_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order4_cut5000_f32_ba[0], butter_tdf2_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "butter_cascade_order4_cut5000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order4_cut5000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "butter_df1_order6_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7);
-        benchmark_and_log(fp, "butter_df2_order6_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7);
-        benchmark_and_log(fp, "butter_tdf2_order6_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "butter_cascade_order6_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order6_cut1000_f64_sos, 3);
-        benchmark_and_log(fp, "butter_df1_order6_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order6_cut1000_f32_ba[0], butter_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "butter_df2_order6_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order6_cut1000_f32_ba[0], butter_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "butter_tdf2_order6_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order6_cut1000_f32_ba[0], butter_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "butter_cascade_order6_cut1000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order6_cut1000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "butter_df1_order6_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7);
-        benchmark_and_log(fp, "butter_df2_order6_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7);
-        benchmark_and_log(fp, "butter_tdf2_order6_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "butter_cascade_order6_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order6_cut2000_f64_sos, 3);
-        benchmark_and_log(fp, "butter_df1_order6_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order6_cut2000_f32_ba[0], butter_df1_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "butter_df2_order6_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order6_cut2000_f32_ba[0], butter_df2_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "butter_tdf2_order6_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order6_cut2000_f32_ba[0], butter_tdf2_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "butter_cascade_order6_cut2000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order6_cut2000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "butter_df1_order6_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7);
-        benchmark_and_log(fp, "butter_df2_order6_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7);
-        benchmark_and_log(fp, "butter_tdf2_order6_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "butter_cascade_order6_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order6_cut5000_f64_sos, 3);
-        benchmark_and_log(fp, "butter_df1_order6_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order6_cut5000_f32_ba[0], butter_df1_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "butter_df2_order6_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order6_cut5000_f32_ba[0], butter_df2_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "butter_tdf2_order6_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order6_cut5000_f32_ba[0], butter_tdf2_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "butter_cascade_order6_cut5000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order6_cut5000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "butter_df1_order8_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9);
-        benchmark_and_log(fp, "butter_df2_order8_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9);
-        benchmark_and_log(fp, "butter_tdf2_order8_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "butter_cascade_order8_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order8_cut1000_f64_sos, 4);
-        benchmark_and_log(fp, "butter_df1_order8_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order8_cut1000_f32_ba[0], butter_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "butter_df2_order8_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order8_cut1000_f32_ba[0], butter_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "butter_tdf2_order8_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order8_cut1000_f32_ba[0], butter_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "butter_cascade_order8_cut1000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order8_cut1000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "butter_df1_order8_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9);
-        benchmark_and_log(fp, "butter_df2_order8_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9);
-        benchmark_and_log(fp, "butter_tdf2_order8_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "butter_cascade_order8_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order8_cut2000_f64_sos, 4);
-        benchmark_and_log(fp, "butter_df1_order8_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order8_cut2000_f32_ba[0], butter_df1_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "butter_df2_order8_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order8_cut2000_f32_ba[0], butter_df2_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "butter_tdf2_order8_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order8_cut2000_f32_ba[0], butter_tdf2_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "butter_cascade_order8_cut2000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order8_cut2000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "butter_df1_order8_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9);
-        benchmark_and_log(fp, "butter_df2_order8_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9);
-        benchmark_and_log(fp, "butter_tdf2_order8_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "butter_cascade_order8_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order8_cut5000_f64_sos, 4);
-        benchmark_and_log(fp, "butter_df1_order8_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order8_cut5000_f32_ba[0], butter_df1_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "butter_df2_order8_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order8_cut5000_f32_ba[0], butter_df2_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "butter_tdf2_order8_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order8_cut5000_f32_ba[0], butter_tdf2_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "butter_cascade_order8_cut5000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order8_cut5000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "cheby1_df1_order2_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3);
-        benchmark_and_log(fp, "cheby1_df2_order2_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3);
-        benchmark_and_log(fp, "cheby1_tdf2_order2_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order2_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order2_cut1000_f64_sos, 1);
-        benchmark_and_log(fp, "cheby1_df1_order2_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order2_cut1000_f32_ba[0], cheby1_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "cheby1_df2_order2_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order2_cut1000_f32_ba[0], cheby1_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "cheby1_tdf2_order2_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order2_cut1000_f32_ba[0], cheby1_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order2_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order2_cut1000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "cheby1_df1_order2_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3);
-        benchmark_and_log(fp, "cheby1_df2_order2_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3);
-        benchmark_and_log(fp, "cheby1_tdf2_order2_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order2_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order2_cut2000_f64_sos, 1);
-        benchmark_and_log(fp, "cheby1_df1_order2_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order2_cut2000_f32_ba[0], cheby1_df1_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "cheby1_df2_order2_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order2_cut2000_f32_ba[0], cheby1_df2_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "cheby1_tdf2_order2_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order2_cut2000_f32_ba[0], cheby1_tdf2_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order2_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order2_cut2000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "cheby1_df1_order2_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3);
-        benchmark_and_log(fp, "cheby1_df2_order2_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3);
-        benchmark_and_log(fp, "cheby1_tdf2_order2_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order2_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order2_cut5000_f64_sos, 1);
-        benchmark_and_log(fp, "cheby1_df1_order2_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order2_cut5000_f32_ba[0], cheby1_df1_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "cheby1_df2_order2_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order2_cut5000_f32_ba[0], cheby1_df2_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "cheby1_tdf2_order2_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order2_cut5000_f32_ba[0], cheby1_tdf2_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order2_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order2_cut5000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "cheby1_df1_order4_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5);
-        benchmark_and_log(fp, "cheby1_df2_order4_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5);
-        benchmark_and_log(fp, "cheby1_tdf2_order4_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order4_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order4_cut1000_f64_sos, 2);
-        benchmark_and_log(fp, "cheby1_df1_order4_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order4_cut1000_f32_ba[0], cheby1_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "cheby1_df2_order4_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order4_cut1000_f32_ba[0], cheby1_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "cheby1_tdf2_order4_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order4_cut1000_f32_ba[0], cheby1_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order4_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order4_cut1000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "cheby1_df1_order4_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5);
-        benchmark_and_log(fp, "cheby1_df2_order4_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5);
-        benchmark_and_log(fp, "cheby1_tdf2_order4_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order4_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order4_cut2000_f64_sos, 2);
-        benchmark_and_log(fp, "cheby1_df1_order4_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order4_cut2000_f32_ba[0], cheby1_df1_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "cheby1_df2_order4_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order4_cut2000_f32_ba[0], cheby1_df2_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "cheby1_tdf2_order4_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order4_cut2000_f32_ba[0], cheby1_tdf2_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order4_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order4_cut2000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "cheby1_df1_order4_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5);
-        benchmark_and_log(fp, "cheby1_df2_order4_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5);
-        benchmark_and_log(fp, "cheby1_tdf2_order4_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order4_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order4_cut5000_f64_sos, 2);
-        benchmark_and_log(fp, "cheby1_df1_order4_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order4_cut5000_f32_ba[0], cheby1_df1_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "cheby1_df2_order4_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order4_cut5000_f32_ba[0], cheby1_df2_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "cheby1_tdf2_order4_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order4_cut5000_f32_ba[0], cheby1_tdf2_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order4_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order4_cut5000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "cheby1_df1_order6_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7);
-        benchmark_and_log(fp, "cheby1_df2_order6_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7);
-        benchmark_and_log(fp, "cheby1_tdf2_order6_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order6_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order6_cut1000_f64_sos, 3);
-        benchmark_and_log(fp, "cheby1_df1_order6_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order6_cut1000_f32_ba[0], cheby1_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "cheby1_df2_order6_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order6_cut1000_f32_ba[0], cheby1_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "cheby1_tdf2_order6_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order6_cut1000_f32_ba[0], cheby1_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order6_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order6_cut1000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "cheby1_df1_order6_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7);
-        benchmark_and_log(fp, "cheby1_df2_order6_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7);
-        benchmark_and_log(fp, "cheby1_tdf2_order6_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order6_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order6_cut2000_f64_sos, 3);
-        benchmark_and_log(fp, "cheby1_df1_order6_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order6_cut2000_f32_ba[0], cheby1_df1_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "cheby1_df2_order6_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order6_cut2000_f32_ba[0], cheby1_df2_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "cheby1_tdf2_order6_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order6_cut2000_f32_ba[0], cheby1_tdf2_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order6_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order6_cut2000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "cheby1_df1_order6_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7);
-        benchmark_and_log(fp, "cheby1_df2_order6_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7);
-        benchmark_and_log(fp, "cheby1_tdf2_order6_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order6_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order6_cut5000_f64_sos, 3);
-        benchmark_and_log(fp, "cheby1_df1_order6_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order6_cut5000_f32_ba[0], cheby1_df1_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "cheby1_df2_order6_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order6_cut5000_f32_ba[0], cheby1_df2_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "cheby1_tdf2_order6_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order6_cut5000_f32_ba[0], cheby1_tdf2_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order6_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order6_cut5000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "cheby1_df1_order8_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9);
-        benchmark_and_log(fp, "cheby1_df2_order8_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9);
-        benchmark_and_log(fp, "cheby1_tdf2_order8_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order8_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order8_cut1000_f64_sos, 4);
-        benchmark_and_log(fp, "cheby1_df1_order8_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order8_cut1000_f32_ba[0], cheby1_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "cheby1_df2_order8_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order8_cut1000_f32_ba[0], cheby1_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "cheby1_tdf2_order8_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order8_cut1000_f32_ba[0], cheby1_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order8_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order8_cut1000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "cheby1_df1_order8_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9);
-        benchmark_and_log(fp, "cheby1_df2_order8_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9);
-        benchmark_and_log(fp, "cheby1_tdf2_order8_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order8_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order8_cut2000_f64_sos, 4);
-        benchmark_and_log(fp, "cheby1_df1_order8_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order8_cut2000_f32_ba[0], cheby1_df1_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "cheby1_df2_order8_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order8_cut2000_f32_ba[0], cheby1_df2_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "cheby1_tdf2_order8_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order8_cut2000_f32_ba[0], cheby1_tdf2_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order8_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order8_cut2000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "cheby1_df1_order8_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9);
-        benchmark_and_log(fp, "cheby1_df2_order8_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9);
-        benchmark_and_log(fp, "cheby1_tdf2_order8_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order8_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order8_cut5000_f64_sos, 4);
-        benchmark_and_log(fp, "cheby1_df1_order8_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order8_cut5000_f32_ba[0], cheby1_df1_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "cheby1_df2_order8_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order8_cut5000_f32_ba[0], cheby1_df2_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "cheby1_tdf2_order8_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order8_cut5000_f32_ba[0], cheby1_tdf2_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "cheby1_cascade_order8_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order8_cut5000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "cheby2_df1_order2_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3);
-        benchmark_and_log(fp, "cheby2_df2_order2_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3);
-        benchmark_and_log(fp, "cheby2_tdf2_order2_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order2_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order2_cut1000_f64_sos, 1);
-        benchmark_and_log(fp, "cheby2_df1_order2_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order2_cut1000_f32_ba[0], cheby2_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "cheby2_df2_order2_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order2_cut1000_f32_ba[0], cheby2_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "cheby2_tdf2_order2_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order2_cut1000_f32_ba[0], cheby2_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order2_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order2_cut1000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "cheby2_df1_order2_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3);
-        benchmark_and_log(fp, "cheby2_df2_order2_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3);
-        benchmark_and_log(fp, "cheby2_tdf2_order2_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order2_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order2_cut2000_f64_sos, 1);
-        benchmark_and_log(fp, "cheby2_df1_order2_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order2_cut2000_f32_ba[0], cheby2_df1_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "cheby2_df2_order2_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order2_cut2000_f32_ba[0], cheby2_df2_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "cheby2_tdf2_order2_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order2_cut2000_f32_ba[0], cheby2_tdf2_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order2_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order2_cut2000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "cheby2_df1_order2_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3);
-        benchmark_and_log(fp, "cheby2_df2_order2_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3);
-        benchmark_and_log(fp, "cheby2_tdf2_order2_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order2_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order2_cut5000_f64_sos, 1);
-        benchmark_and_log(fp, "cheby2_df1_order2_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order2_cut5000_f32_ba[0], cheby2_df1_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "cheby2_df2_order2_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order2_cut5000_f32_ba[0], cheby2_df2_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "cheby2_tdf2_order2_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order2_cut5000_f32_ba[0], cheby2_tdf2_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order2_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order2_cut5000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "cheby2_df1_order4_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5);
-        benchmark_and_log(fp, "cheby2_df2_order4_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5);
-        benchmark_and_log(fp, "cheby2_tdf2_order4_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order4_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order4_cut1000_f64_sos, 2);
-        benchmark_and_log(fp, "cheby2_df1_order4_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order4_cut1000_f32_ba[0], cheby2_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "cheby2_df2_order4_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order4_cut1000_f32_ba[0], cheby2_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "cheby2_tdf2_order4_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order4_cut1000_f32_ba[0], cheby2_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order4_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order4_cut1000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "cheby2_df1_order4_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5);
-        benchmark_and_log(fp, "cheby2_df2_order4_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5);
-        benchmark_and_log(fp, "cheby2_tdf2_order4_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order4_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order4_cut2000_f64_sos, 2);
-        benchmark_and_log(fp, "cheby2_df1_order4_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order4_cut2000_f32_ba[0], cheby2_df1_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "cheby2_df2_order4_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order4_cut2000_f32_ba[0], cheby2_df2_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "cheby2_tdf2_order4_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order4_cut2000_f32_ba[0], cheby2_tdf2_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order4_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order4_cut2000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "cheby2_df1_order4_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5);
-        benchmark_and_log(fp, "cheby2_df2_order4_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5);
-        benchmark_and_log(fp, "cheby2_tdf2_order4_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order4_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order4_cut5000_f64_sos, 2);
-        benchmark_and_log(fp, "cheby2_df1_order4_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order4_cut5000_f32_ba[0], cheby2_df1_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "cheby2_df2_order4_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order4_cut5000_f32_ba[0], cheby2_df2_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "cheby2_tdf2_order4_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order4_cut5000_f32_ba[0], cheby2_tdf2_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order4_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order4_cut5000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "cheby2_df1_order6_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7);
-        benchmark_and_log(fp, "cheby2_df2_order6_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7);
-        benchmark_and_log(fp, "cheby2_tdf2_order6_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order6_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order6_cut1000_f64_sos, 3);
-        benchmark_and_log(fp, "cheby2_df1_order6_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order6_cut1000_f32_ba[0], cheby2_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "cheby2_df2_order6_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order6_cut1000_f32_ba[0], cheby2_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "cheby2_tdf2_order6_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order6_cut1000_f32_ba[0], cheby2_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order6_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order6_cut1000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "cheby2_df1_order6_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7);
-        benchmark_and_log(fp, "cheby2_df2_order6_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7);
-        benchmark_and_log(fp, "cheby2_tdf2_order6_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order6_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order6_cut2000_f64_sos, 3);
-        benchmark_and_log(fp, "cheby2_df1_order6_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order6_cut2000_f32_ba[0], cheby2_df1_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "cheby2_df2_order6_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order6_cut2000_f32_ba[0], cheby2_df2_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "cheby2_tdf2_order6_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order6_cut2000_f32_ba[0], cheby2_tdf2_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order6_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order6_cut2000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "cheby2_df1_order6_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7);
-        benchmark_and_log(fp, "cheby2_df2_order6_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7);
-        benchmark_and_log(fp, "cheby2_tdf2_order6_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order6_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order6_cut5000_f64_sos, 3);
-        benchmark_and_log(fp, "cheby2_df1_order6_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order6_cut5000_f32_ba[0], cheby2_df1_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "cheby2_df2_order6_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order6_cut5000_f32_ba[0], cheby2_df2_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "cheby2_tdf2_order6_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order6_cut5000_f32_ba[0], cheby2_tdf2_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order6_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order6_cut5000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "cheby2_df1_order8_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9);
-        benchmark_and_log(fp, "cheby2_df2_order8_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9);
-        benchmark_and_log(fp, "cheby2_tdf2_order8_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order8_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order8_cut1000_f64_sos, 4);
-        benchmark_and_log(fp, "cheby2_df1_order8_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order8_cut1000_f32_ba[0], cheby2_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "cheby2_df2_order8_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order8_cut1000_f32_ba[0], cheby2_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "cheby2_tdf2_order8_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order8_cut1000_f32_ba[0], cheby2_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order8_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order8_cut1000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "cheby2_df1_order8_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9);
-        benchmark_and_log(fp, "cheby2_df2_order8_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9);
-        benchmark_and_log(fp, "cheby2_tdf2_order8_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order8_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order8_cut2000_f64_sos, 4);
-        benchmark_and_log(fp, "cheby2_df1_order8_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order8_cut2000_f32_ba[0], cheby2_df1_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "cheby2_df2_order8_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order8_cut2000_f32_ba[0], cheby2_df2_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "cheby2_tdf2_order8_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order8_cut2000_f32_ba[0], cheby2_tdf2_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order8_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order8_cut2000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "cheby2_df1_order8_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9);
-        benchmark_and_log(fp, "cheby2_df2_order8_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9);
-        benchmark_and_log(fp, "cheby2_tdf2_order8_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order8_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order8_cut5000_f64_sos, 4);
-        benchmark_and_log(fp, "cheby2_df1_order8_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order8_cut5000_f32_ba[0], cheby2_df1_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "cheby2_df2_order8_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order8_cut5000_f32_ba[0], cheby2_df2_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "cheby2_tdf2_order8_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order8_cut5000_f32_ba[0], cheby2_tdf2_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "cheby2_cascade_order8_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order8_cut5000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "ellip_df1_order2_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3);
-        benchmark_and_log(fp, "ellip_df2_order2_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3);
-        benchmark_and_log(fp, "ellip_tdf2_order2_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order2_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order2_cut1000_f64_sos, 1);
-        benchmark_and_log(fp, "ellip_df1_order2_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order2_cut1000_f32_ba[0], ellip_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "ellip_df2_order2_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order2_cut1000_f32_ba[0], ellip_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "ellip_tdf2_order2_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order2_cut1000_f32_ba[0], ellip_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order2_cut1000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order2_cut1000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "ellip_df1_order2_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3);
-        benchmark_and_log(fp, "ellip_df2_order2_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3);
-        benchmark_and_log(fp, "ellip_tdf2_order2_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order2_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order2_cut2000_f64_sos, 1);
-        benchmark_and_log(fp, "ellip_df1_order2_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order2_cut2000_f32_ba[0], ellip_df1_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "ellip_df2_order2_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order2_cut2000_f32_ba[0], ellip_df2_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "ellip_tdf2_order2_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order2_cut2000_f32_ba[0], ellip_tdf2_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order2_cut2000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order2_cut2000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "ellip_df1_order2_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3);
-        benchmark_and_log(fp, "ellip_df2_order2_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3);
-        benchmark_and_log(fp, "ellip_tdf2_order2_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order2_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order2_cut5000_f64_sos, 1);
-        benchmark_and_log(fp, "ellip_df1_order2_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order2_cut5000_f32_ba[0], ellip_df1_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "ellip_df2_order2_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order2_cut5000_f32_ba[0], ellip_df2_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "ellip_tdf2_order2_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order2_cut5000_f32_ba[0], ellip_tdf2_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order2_cut5000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order2_cut5000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "ellip_df1_order4_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5);
-        benchmark_and_log(fp, "ellip_df2_order4_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5);
-        benchmark_and_log(fp, "ellip_tdf2_order4_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order4_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order4_cut1000_f64_sos, 2);
-        benchmark_and_log(fp, "ellip_df1_order4_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order4_cut1000_f32_ba[0], ellip_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "ellip_df2_order4_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order4_cut1000_f32_ba[0], ellip_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "ellip_tdf2_order4_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order4_cut1000_f32_ba[0], ellip_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order4_cut1000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order4_cut1000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "ellip_df1_order4_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5);
-        benchmark_and_log(fp, "ellip_df2_order4_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5);
-        benchmark_and_log(fp, "ellip_tdf2_order4_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order4_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order4_cut2000_f64_sos, 2);
-        benchmark_and_log(fp, "ellip_df1_order4_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order4_cut2000_f32_ba[0], ellip_df1_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "ellip_df2_order4_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order4_cut2000_f32_ba[0], ellip_df2_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "ellip_tdf2_order4_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order4_cut2000_f32_ba[0], ellip_tdf2_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order4_cut2000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order4_cut2000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "ellip_df1_order4_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5);
-        benchmark_and_log(fp, "ellip_df2_order4_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5);
-        benchmark_and_log(fp, "ellip_tdf2_order4_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order4_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order4_cut5000_f64_sos, 2);
-        benchmark_and_log(fp, "ellip_df1_order4_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order4_cut5000_f32_ba[0], ellip_df1_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "ellip_df2_order4_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order4_cut5000_f32_ba[0], ellip_df2_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "ellip_tdf2_order4_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order4_cut5000_f32_ba[0], ellip_tdf2_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order4_cut5000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order4_cut5000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "ellip_df1_order6_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7);
-        benchmark_and_log(fp, "ellip_df2_order6_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7);
-        benchmark_and_log(fp, "ellip_tdf2_order6_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order6_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order6_cut1000_f64_sos, 3);
-        benchmark_and_log(fp, "ellip_df1_order6_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order6_cut1000_f32_ba[0], ellip_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "ellip_df2_order6_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order6_cut1000_f32_ba[0], ellip_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "ellip_tdf2_order6_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order6_cut1000_f32_ba[0], ellip_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order6_cut1000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order6_cut1000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "ellip_df1_order6_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7);
-        benchmark_and_log(fp, "ellip_df2_order6_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7);
-        benchmark_and_log(fp, "ellip_tdf2_order6_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order6_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order6_cut2000_f64_sos, 3);
-        benchmark_and_log(fp, "ellip_df1_order6_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order6_cut2000_f32_ba[0], ellip_df1_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "ellip_df2_order6_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order6_cut2000_f32_ba[0], ellip_df2_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "ellip_tdf2_order6_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order6_cut2000_f32_ba[0], ellip_tdf2_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order6_cut2000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order6_cut2000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "ellip_df1_order6_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7);
-        benchmark_and_log(fp, "ellip_df2_order6_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7);
-        benchmark_and_log(fp, "ellip_tdf2_order6_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order6_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order6_cut5000_f64_sos, 3);
-        benchmark_and_log(fp, "ellip_df1_order6_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order6_cut5000_f32_ba[0], ellip_df1_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "ellip_df2_order6_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order6_cut5000_f32_ba[0], ellip_df2_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "ellip_tdf2_order6_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order6_cut5000_f32_ba[0], ellip_tdf2_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order6_cut5000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order6_cut5000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "ellip_df1_order8_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9);
-        benchmark_and_log(fp, "ellip_df2_order8_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9);
-        benchmark_and_log(fp, "ellip_tdf2_order8_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order8_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order8_cut1000_f64_sos, 4);
-        benchmark_and_log(fp, "ellip_df1_order8_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order8_cut1000_f32_ba[0], ellip_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "ellip_df2_order8_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order8_cut1000_f32_ba[0], ellip_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "ellip_tdf2_order8_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order8_cut1000_f32_ba[0], ellip_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order8_cut1000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order8_cut1000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "ellip_df1_order8_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9);
-        benchmark_and_log(fp, "ellip_df2_order8_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9);
-        benchmark_and_log(fp, "ellip_tdf2_order8_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order8_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order8_cut2000_f64_sos, 4);
-        benchmark_and_log(fp, "ellip_df1_order8_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order8_cut2000_f32_ba[0], ellip_df1_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "ellip_df2_order8_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order8_cut2000_f32_ba[0], ellip_df2_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "ellip_tdf2_order8_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order8_cut2000_f32_ba[0], ellip_tdf2_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order8_cut2000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order8_cut2000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "ellip_df1_order8_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9);
-        benchmark_and_log(fp, "ellip_df2_order8_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9);
-        benchmark_and_log(fp, "ellip_tdf2_order8_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order8_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order8_cut5000_f64_sos, 4);
-        benchmark_and_log(fp, "ellip_df1_order8_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order8_cut5000_f32_ba[0], ellip_df1_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "ellip_df2_order8_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order8_cut5000_f32_ba[0], ellip_df2_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "ellip_tdf2_order8_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order8_cut5000_f32_ba[0], ellip_tdf2_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "ellip_cascade_order8_cut5000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order8_cut5000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "bessel_df1_order2_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3);
-        benchmark_and_log(fp, "bessel_df2_order2_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3);
-        benchmark_and_log(fp, "bessel_tdf2_order2_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order2_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order2_cut1000_f64_sos, 1);
-        benchmark_and_log(fp, "bessel_df1_order2_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order2_cut1000_f32_ba[0], bessel_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "bessel_df2_order2_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order2_cut1000_f32_ba[0], bessel_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "bessel_tdf2_order2_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order2_cut1000_f32_ba[0], bessel_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order2_cut1000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order2_cut1000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "bessel_df1_order2_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3);
-        benchmark_and_log(fp, "bessel_df2_order2_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3);
-        benchmark_and_log(fp, "bessel_tdf2_order2_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order2_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order2_cut2000_f64_sos, 1);
-        benchmark_and_log(fp, "bessel_df1_order2_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order2_cut2000_f32_ba[0], bessel_df1_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "bessel_df2_order2_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order2_cut2000_f32_ba[0], bessel_df2_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "bessel_tdf2_order2_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order2_cut2000_f32_ba[0], bessel_tdf2_order2_cut2000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order2_cut2000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order2_cut2000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "bessel_df1_order2_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3);
-        benchmark_and_log(fp, "bessel_df2_order2_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3);
-        benchmark_and_log(fp, "bessel_tdf2_order2_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order2_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order2_cut5000_f64_sos, 1);
-        benchmark_and_log(fp, "bessel_df1_order2_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order2_cut5000_f32_ba[0], bessel_df1_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "bessel_df2_order2_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order2_cut5000_f32_ba[0], bessel_df2_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_and_log(fp, "bessel_tdf2_order2_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order2_cut5000_f32_ba[0], bessel_tdf2_order2_cut5000_f32_ba[1], NULL, NULL, 3);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order2_cut5000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order2_cut5000_f32_sos, NULL, 1);
-        benchmark_and_log(fp, "bessel_df1_order4_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5);
-        benchmark_and_log(fp, "bessel_df2_order4_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5);
-        benchmark_and_log(fp, "bessel_tdf2_order4_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order4_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order4_cut1000_f64_sos, 2);
-        benchmark_and_log(fp, "bessel_df1_order4_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order4_cut1000_f32_ba[0], bessel_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "bessel_df2_order4_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order4_cut1000_f32_ba[0], bessel_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "bessel_tdf2_order4_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order4_cut1000_f32_ba[0], bessel_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order4_cut1000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order4_cut1000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "bessel_df1_order4_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5);
-        benchmark_and_log(fp, "bessel_df2_order4_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5);
-        benchmark_and_log(fp, "bessel_tdf2_order4_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order4_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order4_cut2000_f64_sos, 2);
-        benchmark_and_log(fp, "bessel_df1_order4_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order4_cut2000_f32_ba[0], bessel_df1_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "bessel_df2_order4_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order4_cut2000_f32_ba[0], bessel_df2_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "bessel_tdf2_order4_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order4_cut2000_f32_ba[0], bessel_tdf2_order4_cut2000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order4_cut2000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order4_cut2000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "bessel_df1_order4_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5);
-        benchmark_and_log(fp, "bessel_df2_order4_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5);
-        benchmark_and_log(fp, "bessel_tdf2_order4_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order4_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order4_cut5000_f64_sos, 2);
-        benchmark_and_log(fp, "bessel_df1_order4_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order4_cut5000_f32_ba[0], bessel_df1_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "bessel_df2_order4_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order4_cut5000_f32_ba[0], bessel_df2_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_and_log(fp, "bessel_tdf2_order4_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order4_cut5000_f32_ba[0], bessel_tdf2_order4_cut5000_f32_ba[1], NULL, NULL, 5);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order4_cut5000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order4_cut5000_f32_sos, NULL, 2);
-        benchmark_and_log(fp, "bessel_df1_order6_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7);
-        benchmark_and_log(fp, "bessel_df2_order6_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7);
-        benchmark_and_log(fp, "bessel_tdf2_order6_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order6_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order6_cut1000_f64_sos, 3);
-        benchmark_and_log(fp, "bessel_df1_order6_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order6_cut1000_f32_ba[0], bessel_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "bessel_df2_order6_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order6_cut1000_f32_ba[0], bessel_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "bessel_tdf2_order6_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order6_cut1000_f32_ba[0], bessel_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order6_cut1000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order6_cut1000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "bessel_df1_order6_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7);
-        benchmark_and_log(fp, "bessel_df2_order6_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7);
-        benchmark_and_log(fp, "bessel_tdf2_order6_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order6_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order6_cut2000_f64_sos, 3);
-        benchmark_and_log(fp, "bessel_df1_order6_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order6_cut2000_f32_ba[0], bessel_df1_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "bessel_df2_order6_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order6_cut2000_f32_ba[0], bessel_df2_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "bessel_tdf2_order6_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order6_cut2000_f32_ba[0], bessel_tdf2_order6_cut2000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order6_cut2000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order6_cut2000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "bessel_df1_order6_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7);
-        benchmark_and_log(fp, "bessel_df2_order6_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7);
-        benchmark_and_log(fp, "bessel_tdf2_order6_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order6_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order6_cut5000_f64_sos, 3);
-        benchmark_and_log(fp, "bessel_df1_order6_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order6_cut5000_f32_ba[0], bessel_df1_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "bessel_df2_order6_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order6_cut5000_f32_ba[0], bessel_df2_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_and_log(fp, "bessel_tdf2_order6_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order6_cut5000_f32_ba[0], bessel_tdf2_order6_cut5000_f32_ba[1], NULL, NULL, 7);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order6_cut5000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order6_cut5000_f32_sos, NULL, 3);
-        benchmark_and_log(fp, "bessel_df1_order8_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9);
-        benchmark_and_log(fp, "bessel_df2_order8_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9);
-        benchmark_and_log(fp, "bessel_tdf2_order8_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order8_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order8_cut1000_f64_sos, 4);
-        benchmark_and_log(fp, "bessel_df1_order8_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order8_cut1000_f32_ba[0], bessel_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "bessel_df2_order8_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order8_cut1000_f32_ba[0], bessel_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "bessel_tdf2_order8_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order8_cut1000_f32_ba[0], bessel_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order8_cut1000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order8_cut1000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "bessel_df1_order8_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9);
-        benchmark_and_log(fp, "bessel_df2_order8_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9);
-        benchmark_and_log(fp, "bessel_tdf2_order8_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order8_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order8_cut2000_f64_sos, 4);
-        benchmark_and_log(fp, "bessel_df1_order8_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order8_cut2000_f32_ba[0], bessel_df1_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "bessel_df2_order8_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order8_cut2000_f32_ba[0], bessel_df2_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "bessel_tdf2_order8_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order8_cut2000_f32_ba[0], bessel_tdf2_order8_cut2000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order8_cut2000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order8_cut2000_f32_sos, NULL, 4);
-        benchmark_and_log(fp, "bessel_df1_order8_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9);
-        benchmark_and_log(fp, "bessel_df2_order8_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9);
-        benchmark_and_log(fp, "bessel_tdf2_order8_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order8_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order8_cut5000_f64_sos, 4);
-        benchmark_and_log(fp, "bessel_df1_order8_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order8_cut5000_f32_ba[0], bessel_df1_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "bessel_df2_order8_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order8_cut5000_f32_ba[0], bessel_df2_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_and_log(fp, "bessel_tdf2_order8_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order8_cut5000_f32_ba[0], bessel_tdf2_order8_cut5000_f32_ba[1], NULL, NULL, 9);
-        benchmark_cascade_and_log(fp, "bessel_cascade_order8_cut5000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order8_cut5000_f32_sos, NULL, 4);
+        benchmark_cascade_tiled_and_log(fp, "ellip_cascade_order4_cut1000_f64_sos", "double", NULL, *ellip_cascade_order4_cut1000_f64_sos, 2);
+        benchmark_cascade_tiled_and_log(fp, "ellip_cascade_order6_cut1000_f64_sos", "double", NULL, *ellip_cascade_order6_cut1000_f64_sos, 3);
+        benchmark_cascade_tiled_and_log(fp, "ellip_cascade_order8_cut1000_f64_sos", "double", NULL, *ellip_cascade_order8_cut1000_f64_sos, 4);
+        benchmark_cascade_tiled_and_log(fp, "ellip_cascade_order4_cut1000_f32_sos", "float", *ellip_cascade_order4_cut1000_f32_sos, NULL, 2);
+        benchmark_cascade_tiled_and_log(fp, "ellip_cascade_order6_cut1000_f32_sos", "float", *ellip_cascade_order6_cut1000_f32_sos, NULL, 3);
+        benchmark_cascade_tiled_and_log(fp, "ellip_cascade_order8_cut1000_f32_sos", "float", *ellip_cascade_order8_cut1000_f32_sos, NULL, 4);
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+// Tryb "mc": ./TimeAnalysis mc
+int run_mc_benchmark(void) {
+    static const int channel_counts[] = {8, 16, 32, 64};
+    FILE *fp = fopen("c_floating_mc_results.csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+
+    FILE *fp_exact = fopen("c_floating_mc_exactness_results.csv", "w");
+    if (!fp_exact) {
+        perror("Can't open CSV file");
+        fclose(fp);
+        return 1;
+    }
+    fprintf(fp_exact, "filter_name,type,structure,cutoff,order,channels,layout,mismatches\n");
+
+    // f32: rząd 4 - ellip rzędu 8 w float daje NaN (NaN != NaN)
+    long mc_total = 0;
+    mc_total += mc_exactness_check_d(fp_exact, "ellip_df1_order8_cut1000_f64_ba", "DF1", ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9, NULL, 0);
+    mc_total += mc_exactness_check_d(fp_exact, "ellip_df2_order8_cut1000_f64_ba", "DF2", ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9, NULL, 0);
+    mc_total += mc_exactness_check_d(fp_exact, "ellip_tdf2_order8_cut1000_f64_ba", "TDF2", ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9, NULL, 0);
+    mc_total += mc_exactness_check_d(fp_exact, "ellip_cascade_order8_cut1000_f64_sos", "CASCADE", NULL, NULL, 0, *ellip_cascade_order8_cut1000_f64_sos, 4);
+    mc_total += mc_exactness_check_f(fp_exact, "ellip_df1_order4_cut1000_f32_ba", "DF1", ellip_df1_order4_cut1000_f32_ba[0], ellip_df1_order4_cut1000_f32_ba[1], 5, NULL, 0);
+    mc_total += mc_exactness_check_f(fp_exact, "ellip_df2_order4_cut1000_f32_ba", "DF2", ellip_df2_order4_cut1000_f32_ba[0], ellip_df2_order4_cut1000_f32_ba[1], 5, NULL, 0);
+    mc_total += mc_exactness_check_f(fp_exact, "ellip_tdf2_order4_cut1000_f32_ba", "TDF2", ellip_tdf2_order4_cut1000_f32_ba[0], ellip_tdf2_order4_cut1000_f32_ba[1], 5, NULL, 0);
+    mc_total += mc_exactness_check_f(fp_exact, "ellip_cascade_order4_cut1000_f32_sos", "CASCADE", NULL, NULL, 0, *ellip_cascade_order4_cut1000_f32_sos, 2);
+    fclose(fp_exact);
+    printf("[LOG] SIMD vs scalar: %ld mismatches in total\n", mc_total);
+
+    fprintf(fp, "filter_name,type,structure,cutoff,order,channels,layout,time_seconds,samples_per_sec_per_channel\n");
+
+    for (size_t i = 0; i < 20; i++)
+    {
+        for (int k = 0; k < 4; ++k) {
+            int ch = channel_counts[k];
+            for (int layout = -1; layout <= MC_PLANAR; ++layout) {
+                benchmark_mc_and_log(fp, "ellip_df1_order8_cut1000_f64_ba", "double", "DF1", NULL, DF1_mc_d, NULL, DF1_d, NULL, NULL, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9, ch, layout);
+                benchmark_mc_and_log(fp, "ellip_df2_order8_cut1000_f64_ba", "double", "DF2", NULL, DF2_mc_d, NULL, DF2_d, NULL, NULL, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9, ch, layout);
+                benchmark_mc_and_log(fp, "ellip_tdf2_order8_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_mc_d, NULL, TDF2_d, NULL, NULL, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9, ch, layout);
+                benchmark_mc_cascade_and_log(fp, "ellip_cascade_order8_cut1000_f64_sos", "double", NULL, *ellip_cascade_order8_cut1000_f64_sos, 4, ch, layout);
+                benchmark_mc_and_log(fp, "ellip_df1_order8_cut1000_f32_ba", "float", "DF1", DF1_mc_f, NULL, DF1_f, NULL, ellip_df1_order8_cut1000_f32_ba[0], ellip_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9, ch, layout);
+                benchmark_mc_and_log(fp, "ellip_df2_order8_cut1000_f32_ba", "float", "DF2", DF2_mc_f, NULL, DF2_f, NULL, ellip_df2_order8_cut1000_f32_ba[0], ellip_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9, ch, layout);
+                benchmark_mc_and_log(fp, "ellip_tdf2_order8_cut1000_f32_ba", "float", "TDF2", TDF2_mc_f, NULL, TDF2_f, NULL, ellip_tdf2_order8_cut1000_f32_ba[0], ellip_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9, ch, layout);
+                benchmark_mc_cascade_and_log(fp, "ellip_cascade_order8_cut1000_f32_sos", "float", *ellip_cascade_order8_cut1000_f32_sos, NULL, 4, ch, layout);
+            }
+        }
     }
+
+    fclose(fp);
+    return 0;
+}
+
+#define PAR_CHECK_TOL 1e-5  // względem szczytu wyniku szeregowego
+
+// Przyspieszenie wielowątkowych TDF2_par_d / CASCADE_par_d względem wersji szeregowej
+// dla 1..max_threads wątków; max_abs_err - maksymalna różnica względem wyniku szeregowego,
+// check - "ok" albo "FAIL" (max_abs_err powyżej PAR_CHECK_TOL). Zwraca liczbę błędnych.
+// sos != NULL -> CASCADE, w przeciwnym razie TDF2 (b, a, order).
+int benchmark_par_and_log(FILE *fp, const char *filter_name, double *b, double *a, int order,
+                           double *sos, int sections, int max_threads) {
+
+    timing_t start, end;
+    double t_ref, t_par;
+    int cutoff = -1;
+    const char *structure = sos ? "CASCADE" : "TDF2";
+    int rank = sos ? 2 * sections : order - 1;
+
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    double *x = malloc(sizeof(double) * N);
+    double *y_ref = malloc(sizeof(double) * N);
+    double *y = malloc(sizeof(double) * N);
+    generate_white_noise_d(x, N);
+
+    start = timing_now();
+    if (sos) CASCADE_ip_d(x, y_ref, sos, N, sections);
+    else TDF2_d(x, y_ref, b, a, N, order);
+    end = timing_now();
+    t_ref = timing_seconds(start, end);
+
+    double peak = 0.0;
+    for (int n = 0; n < N; ++n)
+        if (fabs(y_ref[n]) > peak) peak = fabs(y_ref[n]);
+
+    int failed = 0;
+    for (int t = 1; t <= max_threads; ++t) {
+        start = timing_now();
+        if (sos) CASCADE_par_d(x, y, sos, N, sections, t);
+        else TDF2_par_d(x, y, b, a, N, order, t);
+        end = timing_now();
+        t_par = timing_seconds(start, end);
+
+        double err = 0.0;
+        for (int n = 0; n < N; ++n) {
+            double e = fabs(y[n] - y_ref[n]);
+            if (!(e <= err)) err = e;
+        }
+        int ok = err <= PAR_CHECK_TOL * peak;
+        failed += !ok;
+
+        fprintf(fp, "%s,double,%s,%d,%d,%d,%.6f,%.4f,%.3e,%s\n", filter_type, structure, cutoff, rank, t, t_par, t_ref / t_par, err, ok ? "ok" : "FAIL");
+        printf("[LOG] %s (double, %s, cut %d, order %d, threads %d): %.6f sec, speedup %.3f, max err %.3e%s\n", filter_type, structure, cutoff, rank, t, t_par, t_ref / t_par, err,
+               ok ? "" : " - FAIL: differs from serial result");
+    }
+
+    free(x); free(y_ref); free(y);
+    return failed;
+}
+
+// Tryb "par": ./TimeAnalysis par [max_threads]
+int run_par_benchmark(int max_threads) {
+    if (max_threads < 1) {
+#ifdef _OPENMP
+        max_threads = omp_get_max_threads();
+#else
+        max_threads = 1;
+#endif
+    }
+
+    FILE *fp = fopen("c_floating_par_results.csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+
+    fprintf(fp, "filter_name,type,structure,cutoff,order,threads,time_seconds,speedup,max_abs_err,check\n");
+
+    int failed = 0;
+    for (size_t i = 0; i < 20; i++)
+    {
+        failed += benchmark_par_and_log(fp, "butter_tdf2_order8_cut1000_f64_ba", butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9, NULL, 0, max_threads);
+        failed += benchmark_par_and_log(fp, "ellip_tdf2_order8_cut1000_f64_ba", ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9, NULL, 0, max_threads);
+        failed += benchmark_par_and_log(fp, "butter_cascade_order8_cut1000_f64_sos", NULL, NULL, 0, *butter_cascade_order8_cut1000_f64_sos, 4, max_threads);
+        failed += benchmark_par_and_log(fp, "ellip_cascade_order8_cut1000_f64_sos", NULL, NULL, 0, *ellip_cascade_order8_cut1000_f64_sos, 4, max_threads);
+    }
+
+    fclose(fp);
+    if (failed) printf("[LOG] par: %d runs differ from the serial result beyond tolerance\n", failed);
+    return failed ? 1 : 0;
+}
+
+// Tryb "spec": ./TimeAnalysis spec
+// Kernele ogólne (DF1/DF2/TDF2) i wyspecjalizowane dla rzędu (*_SPEC) na tych samych projektach
+int run_spec_benchmark(void) {
+    FILE *fp = fopen("c_floating_spec_results.csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+
+    fprintf(fp, "filter_name,type,structure,cutoff,order,time_seconds" BENCH_CSV_HEADER PERF_CSV_HEADER "\n");
+
+    for (size_t i = 0; i < 20; i++)
+    {
+        benchmark_and_log(fp, "butter_df1_order2_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3);
+        benchmark_and_log(fp, "butter_df1_order2_cut1000_f64_ba", "double", "DF1_SPEC", NULL, DF1_spec_d, NULL, NULL, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3);
+        benchmark_and_log(fp, "butter_df1_order2_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order2_cut1000_f32_ba[0], butter_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3);
+        benchmark_and_log(fp, "butter_df1_order2_cut1000_f32_ba", "float", "DF1_SPEC", DF1_spec_f, NULL, butter_df1_order2_cut1000_f32_ba[0], butter_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3);
+        benchmark_and_log(fp, "butter_df2_order2_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3);
+        benchmark_and_log(fp, "butter_df2_order2_cut1000_f64_ba", "double", "DF2_SPEC", NULL, DF2_spec_d, NULL, NULL, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3);
+        benchmark_and_log(fp, "butter_df2_order2_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order2_cut1000_f32_ba[0], butter_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
+        benchmark_and_log(fp, "butter_df2_order2_cut1000_f32_ba", "float", "DF2_SPEC", DF2_spec_f, NULL, butter_df2_order2_cut1000_f32_ba[0], butter_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
+        benchmark_and_log(fp, "butter_tdf2_order2_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3);
+        benchmark_and_log(fp, "butter_tdf2_order2_cut1000_f64_ba", "double", "TDF2_SPEC", NULL, TDF2_spec_d, NULL, NULL, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3);
+        benchmark_and_log(fp, "butter_tdf2_order2_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order2_cut1000_f32_ba[0], butter_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
+        benchmark_and_log(fp, "butter_tdf2_order2_cut1000_f32_ba", "float", "TDF2_SPEC", TDF2_spec_f, NULL, butter_tdf2_order2_cut1000_f32_ba[0], butter_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
+        benchmark_and_log(fp, "butter_df1_order4_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5);
+        benchmark_and_log(fp, "butter_df1_order4_cut1000_f64_ba", "double", "DF1_SPEC", NULL, DF1_spec_d, NULL, NULL, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5);
+        benchmark_and_log(fp, "butter_df1_order4_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order4_cut1000_f32_ba[0], butter_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5);
+        benchmark_and_log(fp, "butter_df1_order4_cut1000_f32_ba", "float", "DF1_SPEC", DF1_spec_f, NULL, butter_df1_order4_cut1000_f32_ba[0], butter_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5);
+        benchmark_and_log(fp, "butter_df2_order4_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5);
+        benchmark_and_log(fp, "butter_df2_order4_cut1000_f64_ba", "double", "DF2_SPEC", NULL, DF2_spec_d, NULL, NULL, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5);
+        benchmark_and_log(fp, "butter_df2_order4_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order4_cut1000_f32_ba[0], butter_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
+        benchmark_and_log(fp, "butter_df2_order4_cut1000_f32_ba", "float", "DF2_SPEC", DF2_spec_f, NULL, butter_df2_order4_cut1000_f32_ba[0], butter_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
+        benchmark_and_log(fp, "butter_tdf2_order4_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5);
+        benchmark_and_log(fp, "butter_tdf2_order4_cut1000_f64_ba", "double", "TDF2_SPEC", NULL, TDF2_spec_d, NULL, NULL, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5);
+        benchmark_and_log(fp, "butter_tdf2_order4_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order4_cut1000_f32_ba[0], butter_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
+        benchmark_and_log(fp, "butter_tdf2_order4_cut1000_f32_ba", "float", "TDF2_SPEC", TDF2_spec_f, NULL, butter_tdf2_order4_cut1000_f32_ba[0], butter_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
+        benchmark_and_log(fp, "butter_df1_order6_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7);
+        benchmark_and_log(fp, "butter_df1_order6_cut1000_f64_ba", "double", "DF1_SPEC", NULL, DF1_spec_d, NULL, NULL, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7);
+        benchmark_and_log(fp, "butter_df1_order6_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order6_cut1000_f32_ba[0], butter_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7);
+        benchmark_and_log(fp, "butter_df1_order6_cut1000_f32_ba", "float", "DF1_SPEC", DF1_spec_f, NULL, butter_df1_order6_cut1000_f32_ba[0], butter_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7);
+        benchmark_and_log(fp, "butter_df2_order6_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7);
+        benchmark_and_log(fp, "butter_df2_order6_cut1000_f64_ba", "double", "DF2_SPEC", NULL, DF2_spec_d, NULL, NULL, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7);
+        benchmark_and_log(fp, "butter_df2_order6_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order6_cut1000_f32_ba[0], butter_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
+        benchmark_and_log(fp, "butter_df2_order6_cut1000_f32_ba", "float", "DF2_SPEC", DF2_spec_f, NULL, butter_df2_order6_cut1000_f32_ba[0], butter_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
+        benchmark_and_log(fp, "butter_tdf2_order6_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7);
+        benchmark_and_log(fp, "butter_tdf2_order6_cut1000_f64_ba", "double", "TDF2_SPEC", NULL, TDF2_spec_d, NULL, NULL, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7);
+        benchmark_and_log(fp, "butter_tdf2_order6_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order6_cut1000_f32_ba[0], butter_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
+        benchmark_and_log(fp, "butter_tdf2_order6_cut1000_f32_ba", "float", "TDF2_SPEC", TDF2_spec_f, NULL, butter_tdf2_order6_cut1000_f32_ba[0], butter_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
+        benchmark_and_log(fp, "butter_df1_order8_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9);
+        benchmark_and_log(fp, "butter_df1_order8_cut1000_f64_ba", "double", "DF1_SPEC", NULL, DF1_spec_d, NULL, NULL, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9);
+        benchmark_and_log(fp, "butter_df1_order8_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order8_cut1000_f32_ba[0], butter_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9);
+        benchmark_and_log(fp, "butter_df1_order8_cut1000_f32_ba", "float", "DF1_SPEC", DF1_spec_f, NULL, butter_df1_order8_cut1000_f32_ba[0], butter_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9);
+        benchmark_and_log(fp, "butter_df2_order8_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9);
+        benchmark_and_log(fp, "butter_df2_order8_cut1000_f64_ba", "double", "DF2_SPEC", NULL, DF2_spec_d, NULL, NULL, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9);
+        benchmark_and_log(fp, "butter_df2_order8_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order8_cut1000_f32_ba[0], butter_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
+        benchmark_and_log(fp, "butter_df2_order8_cut1000_f32_ba", "float", "DF2_SPEC", DF2_spec_f, NULL, butter_df2_order8_cut1000_f32_ba[0], butter_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
+        benchmark_and_log(fp, "butter_tdf2_order8_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9);
+        benchmark_and_log(fp, "butter_tdf2_order8_cut1000_f64_ba", "double", "TDF2_SPEC", NULL, TDF2_spec_d, NULL, NULL, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9);
+        benchmark_and_log(fp, "butter_tdf2_order8_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order8_cut1000_f32_ba[0], butter_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
+        benchmark_and_log(fp, "butter_tdf2_order8_cut1000_f32_ba", "float", "TDF2_SPEC", TDF2_spec_f, NULL, butter_tdf2_order8_cut1000_f32_ba[0], butter_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
+        benchmark_and_log(fp, "ellip_df1_order2_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3);
+        benchmark_and_log(fp, "ellip_df1_order2_cut1000_f64_ba", "double", "DF1_SPEC", NULL, DF1_spec_d, NULL, NULL, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3);
+        benchmark_and_log(fp, "ellip_df1_order2_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order2_cut1000_f32_ba[0], ellip_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3);
+        benchmark_and_log(fp, "ellip_df1_order2_cut1000_f32_ba", "float", "DF1_SPEC", DF1_spec_f, NULL, ellip_df1_order2_cut1000_f32_ba[0], ellip_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3);
+        benchmark_and_log(fp, "ellip_df2_order2_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3);
+        benchmark_and_log(fp, "ellip_df2_order2_cut1000_f64_ba", "double", "DF2_SPEC", NULL, DF2_spec_d, NULL, NULL, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3);
+        benchmark_and_log(fp, "ellip_df2_order2_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order2_cut1000_f32_ba[0], ellip_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
+        benchmark_and_log(fp, "ellip_df2_order2_cut1000_f32_ba", "float", "DF2_SPEC", DF2_spec_f, NULL, ellip_df2_order2_cut1000_f32_ba[0], ellip_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
+        benchmark_and_log(fp, "ellip_tdf2_order2_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3);
+        benchmark_and_log(fp, "ellip_tdf2_order2_cut1000_f64_ba", "double", "TDF2_SPEC", NULL, TDF2_spec_d, NULL, NULL, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3);
+        benchmark_and_log(fp, "ellip_tdf2_order2_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order2_cut1000_f32_ba[0], ellip_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
+        benchmark_and_log(fp, "ellip_tdf2_order2_cut1000_f32_ba", "float", "TDF2_SPEC", TDF2_spec_f, NULL, ellip_tdf2_order2_cut1000_f32_ba[0], ellip_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3);
+        benchmark_and_log(fp, "ellip_df1_order4_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5);
+        benchmark_and_log(fp, "ellip_df1_order4_cut1000_f64_ba", "double", "DF1_SPEC", NULL, DF1_spec_d, NULL, NULL, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5);
+        benchmark_and_log(fp, "ellip_df1_order4_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order4_cut1000_f32_ba[0], ellip_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5);
+        benchmark_and_log(fp, "ellip_df1_order4_cut1000_f32_ba", "float", "DF1_SPEC", DF1_spec_f, NULL, ellip_df1_order4_cut1000_f32_ba[0], ellip_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5);
+        benchmark_and_log(fp, "ellip_df2_order4_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5);
+        benchmark_and_log(fp, "ellip_df2_order4_cut1000_f64_ba", "double", "DF2_SPEC", NULL, DF2_spec_d, NULL, NULL, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5);
+        benchmark_and_log(fp, "ellip_df2_order4_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order4_cut1000_f32_ba[0], ellip_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
+        benchmark_and_log(fp, "ellip_df2_order4_cut1000_f32_ba", "float", "DF2_SPEC", DF2_spec_f, NULL, ellip_df2_order4_cut1000_f32_ba[0], ellip_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
+        benchmark_and_log(fp, "ellip_tdf2_order4_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5);
+        benchmark_and_log(fp, "ellip_tdf2_order4_cut1000_f64_ba", "double", "TDF2_SPEC", NULL, TDF2_spec_d, NULL, NULL, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5);
+        benchmark_and_log(fp, "ellip_tdf2_order4_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order4_cut1000_f32_ba[0], ellip_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
+        benchmark_and_log(fp, "ellip_tdf2_order4_cut1000_f32_ba", "float", "TDF2_SPEC", TDF2_spec_f, NULL, ellip_tdf2_order4_cut1000_f32_ba[0], ellip_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5);
+        benchmark_and_log(fp, "ellip_df1_order6_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7);
+        benchmark_and_log(fp, "ellip_df1_order6_cut1000_f64_ba", "double", "DF1_SPEC", NULL, DF1_spec_d, NULL, NULL, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7);
+        benchmark_and_log(fp, "ellip_df1_order6_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order6_cut1000_f32_ba[0], ellip_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7);
+        benchmark_and_log(fp, "ellip_df1_order6_cut1000_f32_ba", "float", "DF1_SPEC", DF1_spec_f, NULL, ellip_df1_order6_cut1000_f32_ba[0], ellip_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7);
+        benchmark_and_log(fp, "ellip_df2_order6_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7);
+        benchmark_and_log(fp, "ellip_df2_order6_cut1000_f64_ba", "double", "DF2_SPEC", NULL, DF2_spec_d, NULL, NULL, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7);
+        benchmark_and_log(fp, "ellip_df2_order6_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order6_cut1000_f32_ba[0], ellip_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
+        benchmark_and_log(fp, "ellip_df2_order6_cut1000_f32_ba", "float", "DF2_SPEC", DF2_spec_f, NULL, ellip_df2_order6_cut1000_f32_ba[0], ellip_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
+        benchmark_and_log(fp, "ellip_tdf2_order6_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7);
+        benchmark_and_log(fp, "ellip_tdf2_order6_cut1000_f64_ba", "double", "TDF2_SPEC", NULL, TDF2_spec_d, NULL, NULL, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7);
+        benchmark_and_log(fp, "ellip_tdf2_order6_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order6_cut1000_f32_ba[0], ellip_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
+        benchmark_and_log(fp, "ellip_tdf2_order6_cut1000_f32_ba", "float", "TDF2_SPEC", TDF2_spec_f, NULL, ellip_tdf2_order6_cut1000_f32_ba[0], ellip_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7);
+        benchmark_and_log(fp, "ellip_df1_order8_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9);
+        benchmark_and_log(fp, "ellip_df1_order8_cut1000_f64_ba", "double", "DF1_SPEC", NULL, DF1_spec_d, NULL, NULL, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9);
+        benchmark_and_log(fp, "ellip_df1_order8_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order8_cut1000_f32_ba[0], ellip_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9);
+        benchmark_and_log(fp, "ellip_df1_order8_cut1000_f32_ba", "float", "DF1_SPEC", DF1_spec_f, NULL, ellip_df1_order8_cut1000_f32_ba[0], ellip_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9);
+        benchmark_and_log(fp, "ellip_df2_order8_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9);
+        benchmark_and_log(fp, "ellip_df2_order8_cut1000_f64_ba", "double", "DF2_SPEC", NULL, DF2_spec_d, NULL, NULL, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9);
+        benchmark_and_log(fp, "ellip_df2_order8_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order8_cut1000_f32_ba[0], ellip_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
+        benchmark_and_log(fp, "ellip_df2_order8_cut1000_f32_ba", "float", "DF2_SPEC", DF2_spec_f, NULL, ellip_df2_order8_cut1000_f32_ba[0], ellip_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
+        benchmark_and_log(fp, "ellip_tdf2_order8_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9);
+        benchmark_and_log(fp, "ellip_tdf2_order8_cut1000_f64_ba", "double", "TDF2_SPEC", NULL, TDF2_spec_d, NULL, NULL, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9);
+        benchmark_and_log(fp, "ellip_tdf2_order8_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order8_cut1000_f32_ba[0], ellip_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
+        benchmark_and_log(fp, "ellip_tdf2_order8_cut1000_f32_ba", "float", "TDF2_SPEC", TDF2_spec_f, NULL, ellip_tdf2_order8_cut1000_f32_ba[0], ellip_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9);
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+// Kernel ze stałymi współczynnikami (filterkernels.c) względem ogólnego kernela
+// czytającego współczynniki przez wskaźniki; oba na tym samym sygnale.
+void benchmark_baked_and_log_f(FILE *fp, baked_kernel_f *k) {
+    timing_t start, end;
+    double t_gen, t_baked;
+    int cutoff = -1;
+    int order = strcmp(k->structure, "CASCADE") == 0 ? 2 * k->order : k->order - 1;
+
+    char filter_type[32];
+    sscanf(k->name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(k->name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    float *x = malloc(sizeof(float) * N);
+    float *y = malloc(sizeof(float) * N);
+    generate_white_noise_f(x, N);
+
+    start = timing_now();
+    if (strcmp(k->structure, "DF1") == 0) DF1_f(x, y, k->b, k->a, N, k->order);
+    else if (strcmp(k->structure, "DF2") == 0) DF2_f(x, y, k->b, k->a, N, k->order);
+    else if (strcmp(k->structure, "TDF2") == 0) TDF2_f(x, y, k->b, k->a, N, k->order);
+    else CASCADE_ip_f(x, y, k->sos, N, k->order);
+    end = timing_now();
+    t_gen = timing_seconds(start, end);
+
+    start = timing_now();
+    k->kernel(x, y, N);
+    end = timing_now();
+    t_baked = timing_seconds(start, end);
+
+    fprintf(fp, "%s,float,%s,%d,%d,%.6f\n", filter_type, k->structure, cutoff, order, t_gen);
+    fprintf(fp, "%s,float,%s_BAKED,%d,%d,%.6f\n", filter_type, k->structure, cutoff, order, t_baked);
+    printf("[LOG] %s (float, %s, cut %d, order %d): %.6f sec, baked %.6f sec\n", filter_type, k->structure, cutoff, order, t_gen, t_baked);
+    free(x); free(y);
+}
+
+void benchmark_baked_and_log_d(FILE *fp, baked_kernel_d *k) {
+    timing_t start, end;
+    double t_gen, t_baked;
+    int cutoff = -1;
+    int order = strcmp(k->structure, "CASCADE") == 0 ? 2 * k->order : k->order - 1;
+
+    char filter_type[32];
+    sscanf(k->name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(k->name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    double *x = malloc(sizeof(double) * N);
+    double *y = malloc(sizeof(double) * N);
+    generate_white_noise_d(x, N);
+
+    start = timing_now();
+    if (strcmp(k->structure, "DF1") == 0) DF1_d(x, y, k->b, k->a, N, k->order);
+    else if (strcmp(k->structure, "DF2") == 0) DF2_d(x, y, k->b, k->a, N, k->order);
+    else if (strcmp(k->structure, "TDF2") == 0) TDF2_d(x, y, k->b, k->a, N, k->order);
+    else CASCADE_ip_d(x, y, k->sos, N, k->order);
+    end = timing_now();
+    t_gen = timing_seconds(start, end);
+
+    start = timing_now();
+    k->kernel(x, y, N);
+    end = timing_now();
+    t_baked = timing_seconds(start, end);
+
+    fprintf(fp, "%s,double,%s,%d,%d,%.6f\n", filter_type, k->structure, cutoff, order, t_gen);
+    fprintf(fp, "%s,double,%s_BAKED,%d,%d,%.6f\n", filter_type, k->structure, cutoff, order, t_baked);
+    printf("[LOG] %s (double, %s, cut %d, order %d): %.6f sec, baked %.6f sec\n", filter_type, k->structure, cutoff, order, t_gen, t_baked);
+    free(x); free(y);
+}
+
+// Tryb "baked": ./TimeAnalysis baked
+int run_baked_benchmark(void) {
+    FILE *fp = fopen("c_floating_baked_results.csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+
+    fprintf(fp, "filter_name,type,structure,cutoff,order,time_seconds\n");
+
+    for (size_t i = 0; i < 20; i++)
+    {
+        for (int k = 0; k < NUM_BAKED_KERNELS_D; ++k)
+            benchmark_baked_and_log_d(fp, &baked_kernels_d[k]);
+        for (int k = 0; k < NUM_BAKED_KERNELS_F; ++k)
+            benchmark_baked_and_log_f(fp, &baked_kernels_f[k]);
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+#define RS_FLOAT_TOL 1e-2
+
+// Kernel ogólny względem kernela wyspecjalizowanego w czasie działania (runtimespec.c).
+// specialize_seconds: czas generowania i kompilacji (lub samego załadowania z cache).
+// sos != NULL -> CASCADE (order = liczba sekcji), w przeciwnym razie b, a.
+void benchmark_rtspec_and_log(FILE *fp, const char *filter_name, const char *structure,
+                              float *b, float *a, float *sos, int order) {
+    timing_t start, end;
+    double t_gen, t_rt, t_spec;
+    int cutoff = -1;
+    int rank = sos ? 2 * order : order - 1;
+
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    rs_structure rs = strcmp(structure, "DF1") == 0 ? RS_DF1 :
+                      strcmp(structure, "DF2") == 0 ? RS_DF2 :
+                      strcmp(structure, "TDF2") == 0 ? RS_TDF2 : RS_CASCADE;
+
+    start = timing_now();
+    rs_kernel k = sos ? rs_specialize_sos(RS_FLOAT, sos, order) : rs_specialize_ba(rs, RS_FLOAT, b, a, order);
+    end = timing_now();
+    t_spec = timing_seconds(start, end);
+
+    if (!k) {
+        printf("[LOG] %s (float, %s): runtime specialization unavailable\n", filter_type, structure);
+        return;
+    }
+
+    float *x = malloc(sizeof(float) * N);
+    float *y = malloc(sizeof(float) * N);
+    float *y_rt = malloc(sizeof(float) * N);
+    generate_white_noise_f(x, N);
+
+    start = timing_now();
+    if (rs == RS_DF1) DF1_f(x, y, b, a, N, order);
+    else if (rs == RS_DF2) DF2_f(x, y, b, a, N, order);
+    else if (rs == RS_TDF2) TDF2_f(x, y, b, a, N, order);
+    else CASCADE_ip_f(x, y, sos, N, order);
+    end = timing_now();
+    t_gen = timing_seconds(start, end);
+
+    start = timing_now();
+    k(x, y_rt, N);
+    end = timing_now();
+    t_rt = timing_seconds(start, end);
+
+    // Czas ma sens tylko dla kernela liczącego to samo co biblioteka. Bit w bit nie musi
+    // (stałe współczynniki pozwalają kompilatorowi inaczej łączyć mnożenia w FMA, a wysokie
+    // rzędy DF1/DF2 wzmacniają te różnice), więc błąd względem szczytu sygnału do RS_FLOAT_TOL.
+    // Filtry niestabilne w float porównywane do pierwszej próbki inf/nan biblioteki.
+    double peak = 0.0, max_err = 0.0;
+    for (int n = 0; n < N && isfinite(y[n]); ++n) {
+        if (fabs(y[n]) > peak) peak = fabs(y[n]);
+        double e = fabs((double)y_rt[n] - y[n]);
+        if (!(e <= max_err)) max_err = e;
+    }
+    if (!(max_err <= RS_FLOAT_TOL * peak)) {
+        printf("[LOG] %s (float, %s): runtime-specialized output differs from library (max error %.3e, peak %.3e), timing skipped\n", filter_type, structure, max_err, peak);
+        free(x); free(y); free(y_rt);
+        return;
+    }
+
+    fprintf(fp, "%s,float,%s,%d,%d,%.6f,%.6f\n", filter_type, structure, cutoff, rank, t_gen, 0.0);
+    fprintf(fp, "%s,float,%s_RT,%d,%d,%.6f,%.6f\n", filter_type, structure, cutoff, rank, t_rt, t_spec);
+    printf("[LOG] %s (float, %s, cut %d, order %d): %.6f sec, runtime-specialized %.6f sec (specialize %.3f sec)\n", filter_type, structure, cutoff, rank, t_gen, t_rt, t_spec);
+    free(x); free(y); free(y_rt);
+}
+
+// Tryb "rtspec": ./TimeAnalysis rtspec
+// Pierwsza iteracja kompiluje kernele, kolejne ładują je z cache (RS_CACHE_DIR).
+int run_rtspec_benchmark(void) {
+    FILE *fp = fopen("c_floating_rtspec_results.csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+
+    fprintf(fp, "filter_name,type,structure,cutoff,order,time_seconds,specialize_seconds\n");
+
+    for (size_t i = 0; i < 20; i++)
+    {
+        benchmark_rtspec_and_log(fp, "butter_df1_order4_cut1000_f32_ba", "DF1", butter_df1_order4_cut1000_f32_ba[0], butter_df1_order4_cut1000_f32_ba[1], NULL, 5);
+        benchmark_rtspec_and_log(fp, "butter_df2_order4_cut1000_f32_ba", "DF2", butter_df2_order4_cut1000_f32_ba[0], butter_df2_order4_cut1000_f32_ba[1], NULL, 5);
+        benchmark_rtspec_and_log(fp, "butter_tdf2_order4_cut1000_f32_ba", "TDF2", butter_tdf2_order4_cut1000_f32_ba[0], butter_tdf2_order4_cut1000_f32_ba[1], NULL, 5);
+        benchmark_rtspec_and_log(fp, "butter_cascade_order4_cut1000_f32_sos", "CASCADE", NULL, NULL, *butter_cascade_order4_cut1000_f32_sos, 2);
+        benchmark_rtspec_and_log(fp, "butter_df1_order8_cut1000_f32_ba", "DF1", butter_df1_order8_cut1000_f32_ba[0], butter_df1_order8_cut1000_f32_ba[1], NULL, 9);
+        benchmark_rtspec_and_log(fp, "butter_df2_order8_cut1000_f32_ba", "DF2", butter_df2_order8_cut1000_f32_ba[0], butter_df2_order8_cut1000_f32_ba[1], NULL, 9);
+        benchmark_rtspec_and_log(fp, "butter_tdf2_order8_cut1000_f32_ba", "TDF2", butter_tdf2_order8_cut1000_f32_ba[0], butter_tdf2_order8_cut1000_f32_ba[1], NULL, 9);
+        benchmark_rtspec_and_log(fp, "butter_cascade_order8_cut1000_f32_sos", "CASCADE", NULL, NULL, *butter_cascade_order8_cut1000_f32_sos, 4);
+        benchmark_rtspec_and_log(fp, "ellip_df1_order4_cut1000_f32_ba", "DF1", ellip_df1_order4_cut1000_f32_ba[0], ellip_df1_order4_cut1000_f32_ba[1], NULL, 5);
+        benchmark_rtspec_and_log(fp, "ellip_df2_order4_cut1000_f32_ba", "DF2", ellip_df2_order4_cut1000_f32_ba[0], ellip_df2_order4_cut1000_f32_ba[1], NULL, 5);
+        benchmark_rtspec_and_log(fp, "ellip_tdf2_order4_cut1000_f32_ba", "TDF2", ellip_tdf2_order4_cut1000_f32_ba[0], ellip_tdf2_order4_cut1000_f32_ba[1], NULL, 5);
+        benchmark_rtspec_and_log(fp, "ellip_cascade_order4_cut1000_f32_sos", "CASCADE", NULL, NULL, *ellip_cascade_order4_cut1000_f32_sos, 2);
+        benchmark_rtspec_and_log(fp, "ellip_df1_order8_cut1000_f32_ba", "DF1", ellip_df1_order8_cut1000_f32_ba[0], ellip_df1_order8_cut1000_f32_ba[1], NULL, 9);
+        benchmark_rtspec_and_log(fp, "ellip_df2_order8_cut1000_f32_ba", "DF2", ellip_df2_order8_cut1000_f32_ba[0], ellip_df2_order8_cut1000_f32_ba[1], NULL, 9);
+        benchmark_rtspec_and_log(fp, "ellip_tdf2_order8_cut1000_f32_ba", "TDF2", ellip_tdf2_order8_cut1000_f32_ba[0], ellip_tdf2_order8_cut1000_f32_ba[1], NULL, 9);
+        benchmark_rtspec_and_log(fp, "ellip_cascade_order8_cut1000_f32_sos", "CASCADE", NULL, NULL, *ellip_cascade_order8_cut1000_f32_sos, 4);
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+// === Liczby podnormalne ===
+// Impuls, a potem cisza: ogon odpowiedzi IIR schodzi do liczb podnormalnych.
+// Każdy filtr w trybach z denormal.h na impulsie i, dla odniesienia, na szumie białym.
+// Offset jest dodawany do wejścia w mierzonym czasie (to koszt tej metody).
+// slowdown: czas względem szumu białego w trybie none; subnormal_outputs: próbki podnormalne na wyjściu.
+#define DENORMAL_REPS 5
+
+typedef struct {
+    const char *filter_name;
+    const char *type;
+    const char *structure;
+    void (*ba_f)(float*, float*, float*, float*, int, int);
+    void (*ba_d)(double*, double*, double*, double*, int, int);
+    void (*sos_f)(float*, float*, float*, int, int);
+    void (*sos_d)(double*, double*, double*, int, int);
+    float *b_f, *a_f, *sos_f_coef;
+    double *b_d, *a_d, *sos_d_coef;
+    int order;   // BA: liczba współczynników, SOS: liczba sekcji
+} denormal_case;
+
+static double denormal_run(const denormal_case *c, sg_kind signal, denormal_mode mode, long *subnormals) {
+    timing_t start, end;
+    denormal_state st;
+    siggen g;
+    int is_float = strcmp(c->type, "float") == 0;
+    size_t size = is_float ? sizeof(float) : sizeof(double);
+    void *x = pool_buffer(POOL_X, size * N);
+    void *y = pool_buffer(POOL_Y, size * N);
+
+    siggen_init(&g, signal, SIGGEN_SEED, 1.0, 0.0, 0.0, 0.0, 0);
+    if (is_float) siggen_block_f(&g, x, N);
+    else siggen_block_d(&g, x, N);
+
+    denormal_enter(mode, &st);
+    start = timing_now();
+
+    if (mode == DENORMAL_OFFSET) {
+        if (is_float) denormal_offset_f(x, N);
+        else denormal_offset_d(x, N);
+    }
+    if (c->ba_f) c->ba_f(x, y, c->b_f, c->a_f, N, c->order);
+    else if (c->ba_d) c->ba_d(x, y, c->b_d, c->a_d, N, c->order);
+    else if (c->sos_f) c->sos_f(x, y, c->sos_f_coef, N, c->order);
+    else c->sos_d(x, y, c->sos_d_coef, N, c->order);
+
+    end = timing_now();
+    denormal_leave(&st);
+
+    *subnormals = is_float ? denormal_count_f(y, N) : denormal_count_d(y, N);
+    return timing_seconds(start, end);
+}
+
+void benchmark_denormal_and_log(FILE *fp, const denormal_case *c) {
+    int cutoff = -1;
+    int order = (c->sos_f || c->sos_d) ? 2 * c->order : c->order - 1;
+    long subnormals;
+
+    char filter_type[32];
+    sscanf(c->filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(c->filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    double t_ref = denormal_run(c, SG_WHITE, DENORMAL_NONE, &subnormals);
+    fprintf(fp, "%s,%s,%s,%d,%d,white,none,%.6f,%.4f,%.3f,%ld\n", filter_type, c->type, c->structure, cutoff, order,
+            t_ref, t_ref * 1e9 / N, 1.0, subnormals);
+
+    for (int m = 0; m < DENORMAL_MODES; ++m) {
+        double t = denormal_run(c, SG_IMPULSE, (denormal_mode)m, &subnormals);
+        fprintf(fp, "%s,%s,%s,%d,%d,impulse,%s,%.6f,%.4f,%.3f,%ld\n", filter_type, c->type, c->structure, cutoff, order,
+                denormal_mode_name((denormal_mode)m), t, t * 1e9 / N, t / t_ref, subnormals);
+        printf("[LOG] %s (%s, %s, cut %d, order %d, impulse, %s): %.6f sec, %.2fx vs noise, %ld subnormal outputs\n",
+               filter_type, c->type, c->structure, cutoff, order, denormal_mode_name((denormal_mode)m), t, t / t_ref, subnormals);
+    }
+}
+
+int run_denormal_benchmark(void) {
+    const denormal_case cases[] = {
+        { "butter_df1_order4_cut1000_f32_ba", "float", "DF1", .ba_f = DF1_f,
+          .b_f = butter_df1_order4_cut1000_f32_ba[0], .a_f = butter_df1_order4_cut1000_f32_ba[1], .order = 5 },
+        { "butter_df2_order4_cut1000_f32_ba", "float", "DF2", .ba_f = DF2_f,
+          .b_f = butter_df2_order4_cut1000_f32_ba[0], .a_f = butter_df2_order4_cut1000_f32_ba[1], .order = 5 },
+        { "butter_tdf2_order4_cut1000_f32_ba", "float", "TDF2", .ba_f = TDF2_f,
+          .b_f = butter_tdf2_order4_cut1000_f32_ba[0], .a_f = butter_tdf2_order4_cut1000_f32_ba[1], .order = 5 },
+        { "butter_cascade_order8_cut2000_f32_sos", "float", "CASCADE", .sos_f = CASCADE_f,
+          .sos_f_coef = *butter_cascade_order8_cut2000_f32_sos, .order = 4 },
+        { "butter_df1_order4_cut1000_f64_ba", "double", "DF1", .ba_d = DF1_d,
+          .b_d = butter_df1_order4_cut1000_f64_ba[0], .a_d = butter_df1_order4_cut1000_f64_ba[1], .order = 5 },
+        { "butter_df2_order4_cut1000_f64_ba", "double", "DF2", .ba_d = DF2_d,
+          .b_d = butter_df2_order4_cut1000_f64_ba[0], .a_d = butter_df2_order4_cut1000_f64_ba[1], .order = 5 },
+        { "butter_tdf2_order4_cut1000_f64_ba", "double", "TDF2", .ba_d = TDF2_d,
+          .b_d = butter_tdf2_order4_cut1000_f64_ba[0], .a_d = butter_tdf2_order4_cut1000_f64_ba[1], .order = 5 },
+        { "butter_cascade_order8_cut2000_f64_sos", "double", "CASCADE", .sos_d = CASCADE_d,
+          .sos_d_coef = *butter_cascade_order8_cut2000_f64_sos, .order = 4 },
+    };
+
+    FILE *fp = fopen("c_floating_denormal_results.csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+
+    if (!denormal_ftz_supported())
+        printf("[LOG] FTZ/DAZ not supported on this CPU, mode ftz behaves like none\n");
+
+    fprintf(fp, "filter_name,type,structure,cutoff,order,signal,mode,time_seconds,ns_per_sample,slowdown,subnormal_outputs\n");
+
+    for (size_t i = 0; i < DENORMAL_REPS; i++)
+        for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+            benchmark_denormal_and_log(fp, &cases[c]);
+
+    fclose(fp);
+    return 0;
+}
+
+// === Przegląd hierarchii pamięci ===
+// Zbiór roboczy (wejście + wyjście) od SWEEP_MIN_BYTES do SWEEP_MAX_BYTES, co 2x.
+// Praca przy każdym rozmiarze ta sama: SWEEP_MAX_BYTES / (2 * sizeof(typ)) próbek, czyli
+// mały bufor filtrowany calls razy (stan filtru od zera w każdym wywołaniu).
+// Rozmiar, od którego rośnie ns_per_sample, to granica pracy ograniczonej obliczeniami.
+// CASCADE liczony jak CASCADE_ip_* (bez bufora roboczego, zbiór roboczy to też 2 bufory).
+#define SWEEP_MIN_BYTES (4L << 10)
+#define SWEEP_MAX_BYTES (256L << 20)
+#define SWEEP_REPS 3
+
+static void sweep_kernel_f(const char *structure, float *x, float *y, float *b, float *a, float *sos, int n, int order) {
+    if (strcmp(structure, "DF1") == 0) DF1_f(x, y, b, a, n, order);
+    else if (strcmp(structure, "DF2") == 0) DF2_f(x, y, b, a, n, order);
+    else if (strcmp(structure, "TDF2") == 0) TDF2_f(x, y, b, a, n, order);
+    else CASCADE_ip_f(x, y, sos, n, order);
+}
+
+void benchmark_sweep_and_log_f(FILE *fp, const char *filter_name, const char *structure,
+                                float *b, float *a, float *sos, int order) {
+    timing_t start, end;
+    int cutoff = -1;
+    int csv_order = strcmp(structure, "CASCADE") == 0 ? 2 * order : order - 1;
+    long total = SWEEP_MAX_BYTES / (2 * sizeof(float));
+
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    float *x = pool_buffer(POOL_X, sizeof(float) * total);
+    float *y = pool_buffer(POOL_Y, sizeof(float) * total);
+    generate_white_noise_f(x, (int)total);
+
+    for (long ws = SWEEP_MIN_BYTES; ws <= SWEEP_MAX_BYTES; ws *= 2) {
+        int n = (int)(ws / (2 * sizeof(float)));
+        long calls = total / n;
+
+        if (calls > 1) sweep_kernel_f(structure, x, y, b, a, sos, n, order);  // rozgrzanie cache
+
+        start = timing_now();
+        for (long c = 0; c < calls; ++c)
+            sweep_kernel_f(structure, x, y, b, a, sos, n, order);
+        end = timing_now();
+        double t = timing_seconds(start, end);
+
+        fprintf(fp, "%s,float,%s,%d,%d,%ld,%d,%ld,%.6f,%.4f,%.1f,%.3f\n", filter_type, structure, cutoff, csv_order,
+                ws, n, calls, t, t * 1e9 / total, total / t, (double)ws * calls / t / 1e9);
+        printf("[LOG] %s (float, %s, cut %d, order %d, %ld KB): %.4f ns/sample\n", filter_type, structure, cutoff, csv_order,
+               ws >> 10, t * 1e9 / total);
+    }
+}
+
+static void sweep_kernel_d(const char *structure, double *x, double *y, double *b, double *a, double *sos, int n, int order) {
+    if (strcmp(structure, "DF1") == 0) DF1_d(x, y, b, a, n, order);
+    else if (strcmp(structure, "DF2") == 0) DF2_d(x, y, b, a, n, order);
+    else if (strcmp(structure, "TDF2") == 0) TDF2_d(x, y, b, a, n, order);
+    else CASCADE_ip_d(x, y, sos, n, order);
+}
+
+void benchmark_sweep_and_log_d(FILE *fp, const char *filter_name, const char *structure,
+                                double *b, double *a, double *sos, int order) {
+    timing_t start, end;
+    int cutoff = -1;
+    int csv_order = strcmp(structure, "CASCADE") == 0 ? 2 * order : order - 1;
+    long total = SWEEP_MAX_BYTES / (2 * sizeof(double));
+
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    double *x = pool_buffer(POOL_X, sizeof(double) * total);
+    double *y = pool_buffer(POOL_Y, sizeof(double) * total);
+    generate_white_noise_d(x, (int)total);
+
+    for (long ws = SWEEP_MIN_BYTES; ws <= SWEEP_MAX_BYTES; ws *= 2) {
+        int n = (int)(ws / (2 * sizeof(double)));
+        long calls = total / n;
+
+        if (calls > 1) sweep_kernel_d(structure, x, y, b, a, sos, n, order);  // rozgrzanie cache
+
+        start = timing_now();
+        for (long c = 0; c < calls; ++c)
+            sweep_kernel_d(structure, x, y, b, a, sos, n, order);
+        end = timing_now();
+        double t = timing_seconds(start, end);
+
+        fprintf(fp, "%s,double,%s,%d,%d,%ld,%d,%ld,%.6f,%.4f,%.1f,%.3f\n", filter_type, structure, cutoff, csv_order,
+                ws, n, calls, t, t * 1e9 / total, total / t, (double)ws * calls / t / 1e9);
+        printf("[LOG] %s (double, %s, cut %d, order %d, %ld KB): %.4f ns/sample\n", filter_type, structure, cutoff, csv_order,
+               ws >> 10, t * 1e9 / total);
+    }
+}
+
+// Tryb "sweep": ./TimeAnalysis sweep
+int run_sweep_benchmark(void) {
+    FILE *fp = fopen("c_floating_sweep_results.csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+
+    fprintf(fp, "filter_name,type,structure,cutoff,order,working_set_bytes,n,calls,time_seconds,ns_per_sample,samples_per_sec,gbytes_per_sec\n");
+
+    for (size_t i = 0; i < SWEEP_REPS; i++) {
+        benchmark_sweep_and_log_d(fp, "butter_df1_order2_cut2000_f64_ba", "DF1", butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], NULL, 3);
+        benchmark_sweep_and_log_d(fp, "butter_df2_order2_cut2000_f64_ba", "DF2", butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], NULL, 3);
+        benchmark_sweep_and_log_d(fp, "butter_tdf2_order2_cut2000_f64_ba", "TDF2", butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], NULL, 3);
+        benchmark_sweep_and_log_d(fp, "butter_cascade_order2_cut2000_f64_sos", "CASCADE", NULL, NULL, *butter_cascade_order2_cut2000_f64_sos, 1);
+        benchmark_sweep_and_log_f(fp, "butter_df1_order2_cut2000_f32_ba", "DF1", butter_df1_order2_cut2000_f32_ba[0], butter_df1_order2_cut2000_f32_ba[1], NULL, 3);
+        benchmark_sweep_and_log_f(fp, "butter_df2_order2_cut2000_f32_ba", "DF2", butter_df2_order2_cut2000_f32_ba[0], butter_df2_order2_cut2000_f32_ba[1], NULL, 3);
+        benchmark_sweep_and_log_f(fp, "butter_tdf2_order2_cut2000_f32_ba", "TDF2", butter_tdf2_order2_cut2000_f32_ba[0], butter_tdf2_order2_cut2000_f32_ba[1], NULL, 3);
+        benchmark_sweep_and_log_f(fp, "butter_cascade_order2_cut2000_f32_sos", "CASCADE", NULL, NULL, *butter_cascade_order2_cut2000_f32_sos, 1);
+        benchmark_sweep_and_log_d(fp, "butter_df1_order4_cut2000_f64_ba", "DF1", butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], NULL, 5);
+        benchmark_sweep_and_log_d(fp, "butter_df2_order4_cut2000_f64_ba", "DF2", butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], NULL, 5);
+        benchmark_sweep_and_log_d(fp, "butter_tdf2_order4_cut2000_f64_ba", "TDF2", butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], NULL, 5);
+        benchmark_sweep_and_log_d(fp, "butter_cascade_order4_cut2000_f64_sos", "CASCADE", NULL, NULL, *butter_cascade_order4_cut2000_f64_sos, 2);
+        benchmark_sweep_and_log_f(fp, "butter_df1_order4_cut2000_f32_ba", "DF1", butter_df1_order4_cut2000_f32_ba[0], butter_df1_order4_cut2000_f32_ba[1], NULL, 5);
+        benchmark_sweep_and_log_f(fp, "butter_df2_order4_cut2000_f32_ba", "DF2", butter_df2_order4_cut2000_f32_ba[0], butter_df2_order4_cut2000_f32_ba[1], NULL, 5);
+        benchmark_sweep_and_log_f(fp, "butter_tdf2_order4_cut2000_f32_ba", "TDF2", butter_tdf2_order4_cut2000_f32_ba[0], butter_tdf2_order4_cut2000_f32_ba[1], NULL, 5);
+        benchmark_sweep_and_log_f(fp, "butter_cascade_order4_cut2000_f32_sos", "CASCADE", NULL, NULL, *butter_cascade_order4_cut2000_f32_sos, 2);
+        benchmark_sweep_and_log_d(fp, "butter_df1_order8_cut2000_f64_ba", "DF1", butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_sweep_and_log_d(fp, "butter_df2_order8_cut2000_f64_ba", "DF2", butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_sweep_and_log_d(fp, "butter_tdf2_order8_cut2000_f64_ba", "TDF2", butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_sweep_and_log_d(fp, "butter_cascade_order8_cut2000_f64_sos", "CASCADE", NULL, NULL, *butter_cascade_order8_cut2000_f64_sos, 4);
+        benchmark_sweep_and_log_f(fp, "butter_df1_order8_cut2000_f32_ba", "DF1", butter_df1_order8_cut2000_f32_ba[0], butter_df1_order8_cut2000_f32_ba[1], NULL, 9);
+        benchmark_sweep_and_log_f(fp, "butter_df2_order8_cut2000_f32_ba", "DF2", butter_df2_order8_cut2000_f32_ba[0], butter_df2_order8_cut2000_f32_ba[1], NULL, 9);
+        benchmark_sweep_and_log_f(fp, "butter_tdf2_order8_cut2000_f32_ba", "TDF2", butter_tdf2_order8_cut2000_f32_ba[0], butter_tdf2_order8_cut2000_f32_ba[1], NULL, 9);
+        benchmark_sweep_and_log_f(fp, "butter_cascade_order8_cut2000_f32_sos", "CASCADE", NULL, NULL, *butter_cascade_order8_cut2000_f32_sos, 4);
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+// === Opóźnienie pojedynczych bloków ===
+// Sygnał podawany strukturom strumieniowym (streaming.h) w blokach jak w wywołaniu zwrotnym
+// audio: stan filtru przechodzi z bloku na blok. Czas każdego bloku trafia do histogramu
+// (latency.h); pierwsze LATENCY_WARMUP bloków nie jest zapisywane.
+// c_floating_latency_summary.csv - p50/p99/p99.9/max na konfigurację oraz stream_mismatches
+// (próbki różne od jednego wywołania jądra z structures.c na całym sygnale; oczekiwane 0),
+// c_floating_latency_hist.csv - niepuste kubełki histogramu (_Analiza(python)/TimeHistogram.py).
+static const int latency_blocks[] = {32, 64, 128, 256, 512};
+#define NUM_LATENCY_BLOCKS (int)(sizeof(latency_blocks) / sizeof(latency_blocks[0]))
+#define LATENCY_WARMUP 64
+
+static lat_hist lat_h;
+
+static int latency_structure(const char *structure) {
+    if (strcmp(structure, "DF1") == 0) return 0;
+    if (strcmp(structure, "DF2") == 0) return 1;
+    if (strcmp(structure, "TDF2") == 0) return 2;
+    return 3;
+}
+
+void benchmark_latency_and_log_f(FILE *fp_sum, FILE *fp_hist, const char *filter_name, const char *structure,
+                                 float *b, float *a, float *sos, int order) {
+    int cutoff = -1;
+    int csv_order = strcmp(structure, "CASCADE") == 0 ? 2 * order : order - 1;
+    int s = latency_structure(structure);
+    char key[128];
+
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    float *x = pool_buffer(POOL_X, sizeof(float) * N);
+    float *y = pool_buffer(POOL_Y, sizeof(float) * N);
+    float *x_ref = pool_buffer(POOL_X2, sizeof(float) * N);
+    float *y_ref = pool_buffer(POOL_Y2, sizeof(float) * N);
+    generate_white_noise_f(x, N);
+
+    // Odniesienie: jedno wywołanie jądra z structures.c (CASCADE_f nadpisuje wejście - kopia)
+    memcpy(x_ref, x, sizeof(float) * N);
+    switch (s) {
+    case 0: DF1_f(x_ref, y_ref, b, a, N, order); break;
+    case 1: DF2_f(x_ref, y_ref, b, a, N, order); break;
+    case 2: TDF2_f(x_ref, y_ref, b, a, N, order); break;
+    default: CASCADE_f(x_ref, y_ref, sos, N, order); break;
+    }
+
+    for (int k = 0; k < NUM_LATENCY_BLOCKS; ++k) {
+        int block = latency_blocks[k];
+        DF1_state_f df1;
+        DF2_state_f df2;
+        TDF2_state_f tdf2;
+        CASCADE_state_f cascade;
+
+        switch (s) {
+        case 0: DF1_init_f(&df1, b, a, order); break;
+        case 1: DF2_init_f(&df2, b, a, order); break;
+        case 2: TDF2_init_f(&tdf2, b, a, order); break;
+        default: CASCADE_init_f(&cascade, sos, order); break;
+        }
+        lat_reset(&lat_h);
+
+        for (int off = 0, i = 0; off + block <= N; off += block, ++i) {
+            timing_t start = timing_now();
+            switch (s) {
+            case 0: DF1_block_f(&df1, x + off, y + off, block); break;
+            case 1: DF2_block_f(&df2, x + off, y + off, block); break;
+            case 2: TDF2_block_f(&tdf2, x + off, y + off, block); break;
+            default: CASCADE_block_f(&cascade, x + off, y + off, block); break;
+            }
+            timing_t end = timing_now();
+            if (i >= LATENCY_WARMUP) lat_record(&lat_h, timing_ns(start, end));
+        }
+
+        long mismatches = 0;
+        for (int n = 0; n < N / block * block; ++n)
+            mismatches += y[n] != y_ref[n];
+        if (mismatches)
+            printf("[LOG] %s (float, %s, block %d): streaming output differs from whole-signal call on %ld samples\n",
+                   filter_type, structure, block, mismatches);
+
+        snprintf(key, sizeof(key), "%s,float,%s,%d,%d,%d", filter_type, structure, cutoff, csv_order, block);
+        fprintf(fp_sum, "%s", key);
+        lat_fprint_summary(fp_sum, &lat_h);
+        fprintf(fp_sum, ",%ld\n", mismatches);
+        lat_fprint_buckets(fp_hist, key, &lat_h);
+        printf("[LOG] %s (float, %s, cut %d, order %d, block %d): p50 %llu ns, p99 %llu ns, p99.9 %llu ns, max %llu ns\n",
+               filter_type, structure, cutoff, csv_order, block, (unsigned long long)lat_quantile(&lat_h, 0.5),
+               (unsigned long long)lat_quantile(&lat_h, 0.99), (unsigned long long)lat_quantile(&lat_h, 0.999),
+               (unsigned long long)lat_h.max);
+    }
+}
+
+void benchmark_latency_and_log_d(FILE *fp_sum, FILE *fp_hist, const char *filter_name, const char *structure,
+                                 double *b, double *a, double *sos, int order) {
+    int cutoff = -1;
+    int csv_order = strcmp(structure, "CASCADE") == 0 ? 2 * order : order - 1;
+    int s = latency_structure(structure);
+    char key[128];
+
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    double *x = pool_buffer(POOL_X, sizeof(double) * N);
+    double *y = pool_buffer(POOL_Y, sizeof(double) * N);
+    double *x_ref = pool_buffer(POOL_X2, sizeof(double) * N);
+    double *y_ref = pool_buffer(POOL_Y2, sizeof(double) * N);
+    generate_white_noise_d(x, N);
+
+    // Odniesienie: jedno wywołanie jądra z structures.c (CASCADE_d nadpisuje wejście - kopia)
+    memcpy(x_ref, x, sizeof(double) * N);
+    switch (s) {
+    case 0: DF1_d(x_ref, y_ref, b, a, N, order); break;
+    case 1: DF2_d(x_ref, y_ref, b, a, N, order); break;
+    case 2: TDF2_d(x_ref, y_ref, b, a, N, order); break;
+    default: CASCADE_d(x_ref, y_ref, sos, N, order); break;
+    }
+
+    for (int k = 0; k < NUM_LATENCY_BLOCKS; ++k) {
+        int block = latency_blocks[k];
+        DF1_state_d df1;
+        DF2_state_d df2;
+        TDF2_state_d tdf2;
+        CASCADE_state_d cascade;
+
+        switch (s) {
+        case 0: DF1_init_d(&df1, b, a, order); break;
+        case 1: DF2_init_d(&df2, b, a, order); break;
+        case 2: TDF2_init_d(&tdf2, b, a, order); break;
+        default: CASCADE_init_d(&cascade, sos, order); break;
+        }
+        lat_reset(&lat_h);
+
+        for (int off = 0, i = 0; off + block <= N; off += block, ++i) {
+            timing_t start = timing_now();
+            switch (s) {
+            case 0: DF1_block_d(&df1, x + off, y + off, block); break;
+            case 1: DF2_block_d(&df2, x + off, y + off, block); break;
+            case 2: TDF2_block_d(&tdf2, x + off, y + off, block); break;
+            default: CASCADE_block_d(&cascade, x + off, y + off, block); break;
+            }
+            timing_t end = timing_now();
+            if (i >= LATENCY_WARMUP) lat_record(&lat_h, timing_ns(start, end));
+        }
+
+        long mismatches = 0;
+        for (int n = 0; n < N / block * block; ++n)
+            mismatches += y[n] != y_ref[n];
+        if (mismatches)
+            printf("[LOG] %s (double, %s, block %d): streaming output differs from whole-signal call on %ld samples\n",
+                   filter_type, structure, block, mismatches);
+
+        snprintf(key, sizeof(key), "%s,double,%s,%d,%d,%d", filter_type, structure, cutoff, csv_order, block);
+        fprintf(fp_sum, "%s", key);
+        lat_fprint_summary(fp_sum, &lat_h);
+        fprintf(fp_sum, ",%ld\n", mismatches);
+        lat_fprint_buckets(fp_hist, key, &lat_h);
+        printf("[LOG] %s (double, %s, cut %d, order %d, block %d): p50 %llu ns, p99 %llu ns, p99.9 %llu ns, max %llu ns\n",
+               filter_type, structure, cutoff, csv_order, block, (unsigned long long)lat_quantile(&lat_h, 0.5),
+               (unsigned long long)lat_quantile(&lat_h, 0.99), (unsigned long long)lat_quantile(&lat_h, 0.999),
+               (unsigned long long)lat_h.max);
+    }
+}
+
+// Tryb "latency": ./TimeAnalysis latency
+int run_latency_benchmark(void) {
+    FILE *fp_sum = fopen("c_floating_latency_summary.csv", "w");
+    FILE *fp_hist = fopen("c_floating_latency_hist.csv", "w");
+    if (!fp_sum || !fp_hist) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+
+    fprintf(fp_sum, "filter_name,type,structure,cutoff,order,block" LAT_SUMMARY_CSV_HEADER ",stream_mismatches\n");
+    fprintf(fp_hist, "filter_name,type,structure,cutoff,order,block" LAT_HIST_CSV_HEADER "\n");
+
+    benchmark_latency_and_log_d(fp_sum, fp_hist, "butter_df1_order2_cut2000_f64_ba", "DF1", butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], NULL, 3);
+    benchmark_latency_and_log_d(fp_sum, fp_hist, "butter_df2_order2_cut2000_f64_ba", "DF2", butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], NULL, 3);
+    benchmark_latency_and_log_d(fp_sum, fp_hist, "butter_tdf2_order2_cut2000_f64_ba", "TDF2", butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], NULL, 3);
+    benchmark_latency_and_log_d(fp_sum, fp_hist, "butter_cascade_order2_cut2000_f64_sos", "CASCADE", NULL, NULL, *butter_cascade_order2_cut2000_f64_sos, 1);
+    benchmark_latency_and_log_f(fp_sum, fp_hist, "butter_df1_order2_cut2000_f32_ba", "DF1", butter_df1_order2_cut2000_f32_ba[0], butter_df1_order2_cut2000_f32_ba[1], NULL, 3);
+    benchmark_latency_and_log_f(fp_sum, fp_hist, "butter_df2_order2_cut2000_f32_ba", "DF2", butter_df2_order2_cut2000_f32_ba[0], butter_df2_order2_cut2000_f32_ba[1], NULL, 3);
+    benchmark_latency_and_log_f(fp_sum, fp_hist, "butter_tdf2_order2_cut2000_f32_ba", "TDF2", butter_tdf2_order2_cut2000_f32_ba[0], butter_tdf2_order2_cut2000_f32_ba[1], NULL, 3);
+    benchmark_latency_and_log_f(fp_sum, fp_hist, "butter_cascade_order2_cut2000_f32_sos", "CASCADE", NULL, NULL, *butter_cascade_order2_cut2000_f32_sos, 1);
+    benchmark_latency_and_log_d(fp_sum, fp_hist, "butter_df1_order4_cut2000_f64_ba", "DF1", butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], NULL, 5);
+    benchmark_latency_and_log_d(fp_sum, fp_hist, "butter_df2_order4_cut2000_f64_ba", "DF2", butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], NULL, 5);
+    benchmark_latency_and_log_d(fp_sum, fp_hist, "butter_tdf2_order4_cut2000_f64_ba", "TDF2", butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], NULL, 5);
+    benchmark_latency_and_log_d(fp_sum, fp_hist, "butter_cascade_order4_cut2000_f64_sos", "CASCADE", NULL, NULL, *butter_cascade_order4_cut2000_f64_sos, 2);
+    benchmark_latency_and_log_f(fp_sum, fp_hist, "butter_df1_order4_cut2000_f32_ba", "DF1", butter_df1_order4_cut2000_f32_ba[0], butter_df1_order4_cut2000_f32_ba[1], NULL, 5);
+    benchmark_latency_and_log_f(fp_sum, fp_hist, "butter_df2_order4_cut2000_f32_ba", "DF2", butter_df2_order4_cut2000_f32_ba[0], butter_df2_order4_cut2000_f32_ba[1], NULL, 5);
+    benchmark_latency_and_log_f(fp_sum, fp_hist, "butter_tdf2_order4_cut2000_f32_ba", "TDF2", butter_tdf2_order4_cut2000_f32_ba[0], butter_tdf2_order4_cut2000_f32_ba[1], NULL, 5);
+    benchmark_latency_and_log_f(fp_sum, fp_hist, "butter_cascade_order4_cut2000_f32_sos", "CASCADE", NULL, NULL, *butter_cascade_order4_cut2000_f32_sos, 2);
+    benchmark_latency_and_log_d(fp_sum, fp_hist, "butter_df1_order8_cut2000_f64_ba", "DF1", butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], NULL, 9);
+    benchmark_latency_and_log_d(fp_sum, fp_hist, "butter_df2_order8_cut2000_f64_ba", "DF2", butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], NULL, 9);
+    benchmark_latency_and_log_d(fp_sum, fp_hist, "butter_tdf2_order8_cut2000_f64_ba", "TDF2", butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], NULL, 9);
+    benchmark_latency_and_log_d(fp_sum, fp_hist, "butter_cascade_order8_cut2000_f64_sos", "CASCADE", NULL, NULL, *butter_cascade_order8_cut2000_f64_sos, 4);
+    benchmark_latency_and_log_f(fp_sum, fp_hist, "butter_df1_order8_cut2000_f32_ba", "DF1", butter_df1_order8_cut2000_f32_ba[0], butter_df1_order8_cut2000_f32_ba[1], NULL, 9);
+    benchmark_latency_and_log_f(fp_sum, fp_hist, "butter_df2_order8_cut2000_f32_ba", "DF2", butter_df2_order8_cut2000_f32_ba[0], butter_df2_order8_cut2000_f32_ba[1], NULL, 9);
+    benchmark_latency_and_log_f(fp_sum, fp_hist, "butter_tdf2_order8_cut2000_f32_ba", "TDF2", butter_tdf2_order8_cut2000_f32_ba[0], butter_tdf2_order8_cut2000_f32_ba[1], NULL, 9);
+    benchmark_latency_and_log_f(fp_sum, fp_hist, "butter_cascade_order8_cut2000_f32_sos", "CASCADE", NULL, NULL, *butter_cascade_order8_cut2000_f32_sos, 4);
+
+    fclose(fp_sum);
+    fclose(fp_hist);
+    return 0;
+}
+
+// === Symulacja wywołania zwrotnego audio ===
+// Wątek okresowy (rtsim.h) przetwarza co okres jeden blok strukturą strumieniową, bez obciążenia
+// i z wątkami obciążenia pamięci. Blok z block= (domyślnie 128, czyli 2.67 ms przy 48 kHz),
+// liczba wątków obciążenia z load= (domyślnie liczba rdzeni - 1, co najmniej 1).
+// Każda konfiguracja trwa RTSIM_SECONDS; wynik w c_floating_rtsim_results.csv.
+#define RTSIM_SECONDS 5
+#define RTSIM_BLOCK 128
+
+static rtsim_result rtsim_res;
+
+typedef struct {
+    int s;   // latency_structure()
+    DF1_state_f df1;
+    DF2_state_f df2;
+    TDF2_state_f tdf2;
+    CASCADE_state_f cascade;
+    float *x, *y;
+    int pos, block;
+} rtsim_ctx_f;
+
+static void rtsim_process_f(void *p) {
+    rtsim_ctx_f *c = p;
+    float *x = c->x + c->pos, *y = c->y + c->pos;
+
+    switch (c->s) {
+    case 0: DF1_block_f(&c->df1, x, y, c->block); break;
+    case 1: DF2_block_f(&c->df2, x, y, c->block); break;
+    case 2: TDF2_block_f(&c->tdf2, x, y, c->block); break;
+    default: CASCADE_block_f(&c->cascade, x, y, c->block); break;
+    }
+    c->pos += c->block;
+    if (c->pos + c->block > N) c->pos = 0;
+}
+
+void benchmark_rtsim_and_log_f(FILE *fp, const rtsim_config *cfg, const char *filter_name, const char *structure,
+                               float *b, float *a, float *sos, int order) {
+    int cutoff = -1;
+    int csv_order = strcmp(structure, "CASCADE") == 0 ? 2 * order : order - 1;
+    rtsim_ctx_f c = { 0 };
+
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    c.s = latency_structure(structure);
+    c.x = pool_buffer(POOL_X, sizeof(float) * N);
+    c.y = pool_buffer(POOL_Y, sizeof(float) * N);
+    c.block = cfg->block;
+    generate_white_noise_f(c.x, N);
+
+    switch (c.s) {
+    case 0: DF1_init_f(&c.df1, b, a, order); break;
+    case 1: DF2_init_f(&c.df2, b, a, order); break;
+    case 2: TDF2_init_f(&c.tdf2, b, a, order); break;
+    default: CASCADE_init_f(&c.cascade, sos, order); break;
+    }
+
+    if (rtsim_run(cfg, rtsim_process_f, &c, &rtsim_res) != 0) {
+        printf("[LOG] rtsim not supported on this platform\n");
+        return;
+    }
+
+    fprintf(fp, "%s,float,%s,%d,%d", filter_type, structure, cutoff, csv_order);
+    rtsim_fprint_columns(fp, cfg, &rtsim_res);
+    fprintf(fp, "\n");
+    printf("[LOG] %s (float, %s, cut %d, order %d, load %d, %s): %ld/%ld misses, WCET %llu ns, jitter p99 %llu ns\n",
+           filter_type, structure, cutoff, csv_order, cfg->load_threads, rtsim_res.fifo ? "fifo" : "other",
+           rtsim_res.misses, (long)rtsim_res.exec.total, (unsigned long long)rtsim_res.exec.max,
+           (unsigned long long)lat_quantile(&rtsim_res.jitter, 0.99));
+}
+
+typedef struct {
+    int s;   // latency_structure()
+    DF1_state_d df1;
+    DF2_state_d df2;
+    TDF2_state_d tdf2;
+    CASCADE_state_d cascade;
+    double *x, *y;
+    int pos, block;
+} rtsim_ctx_d;
+
+static void rtsim_process_d(void *p) {
+    rtsim_ctx_d *c = p;
+    double *x = c->x + c->pos, *y = c->y + c->pos;
+
+    switch (c->s) {
+    case 0: DF1_block_d(&c->df1, x, y, c->block); break;
+    case 1: DF2_block_d(&c->df2, x, y, c->block); break;
+    case 2: TDF2_block_d(&c->tdf2, x, y, c->block); break;
+    default: CASCADE_block_d(&c->cascade, x, y, c->block); break;
+    }
+    c->pos += c->block;
+    if (c->pos + c->block > N) c->pos = 0;
+}
+
+void benchmark_rtsim_and_log_d(FILE *fp, const rtsim_config *cfg, const char *filter_name, const char *structure,
+                               double *b, double *a, double *sos, int order) {
+    int cutoff = -1;
+    int csv_order = strcmp(structure, "CASCADE") == 0 ? 2 * order : order - 1;
+    rtsim_ctx_d c = { 0 };
+
+    char filter_type[32];
+    sscanf(filter_name, "%[^_]", filter_type);
+
+    char *cut_ptr = strstr(filter_name, "_cut");
+    if (cut_ptr != NULL)
+        sscanf(cut_ptr, "_cut%d", &cutoff);
+
+    c.s = latency_structure(structure);
+    c.x = pool_buffer(POOL_X, sizeof(double) * N);
+    c.y = pool_buffer(POOL_Y, sizeof(double) * N);
+    c.block = cfg->block;
+    generate_white_noise_d(c.x, N);
+
+    switch (c.s) {
+    case 0: DF1_init_d(&c.df1, b, a, order); break;
+    case 1: DF2_init_d(&c.df2, b, a, order); break;
+    case 2: TDF2_init_d(&c.tdf2, b, a, order); break;
+    default: CASCADE_init_d(&c.cascade, sos, order); break;
+    }
+
+    if (rtsim_run(cfg, rtsim_process_d, &c, &rtsim_res) != 0) {
+        printf("[LOG] rtsim not supported on this platform\n");
+        return;
+    }
+
+    fprintf(fp, "%s,double,%s,%d,%d", filter_type, structure, cutoff, csv_order);
+    rtsim_fprint_columns(fp, cfg, &rtsim_res);
+    fprintf(fp, "\n");
+    printf("[LOG] %s (double, %s, cut %d, order %d, load %d, %s): %ld/%ld misses, WCET %llu ns, jitter p99 %llu ns\n",
+           filter_type, structure, cutoff, csv_order, cfg->load_threads, rtsim_res.fifo ? "fifo" : "other",
+           rtsim_res.misses, (long)rtsim_res.exec.total, (unsigned long long)rtsim_res.exec.max,
+           (unsigned long long)lat_quantile(&rtsim_res.jitter, 0.99));
+}
+
+// Tryb "rtsim": ./TimeAnalysis rtsim [load=<wątki>] [block=<próbki>]
+int run_rtsim_benchmark(int argc, char **argv) {
+    rtsim_config cfg;
+    int load = rtsim_default_load();
+    for (int i = 2; i < argc; ++i)
+        if (strncmp(argv[i], "load=", 5) == 0) load = atoi(argv[i] + 5);
+
+    cfg.block = bench.block > 0 ? bench.block : RTSIM_BLOCK;
+    if (cfg.block > N) {
+        // Blok jest wycinkiem sygnału testowego, więc musi się w nim mieścić
+        printf("[LOG] rtsim: block=%d longer than signal n=%d\n", cfg.block, N);
+        return 1;
+    }
+    cfg.fs = bench.fs;
+    cfg.periods = (long)RTSIM_SECONDS * cfg.fs / cfg.block;
+    cfg.fifo = 1;
+
+    FILE *fp = fopen("c_floating_rtsim_results.csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+
+    fprintf(fp, "filter_name,type,structure,cutoff,order" RTSIM_CSV_HEADER "\n");
+
+    const int loads[] = { 0, load };
+    for (int l = 0; l < (load > 0 ? 2 : 1); l++) {
+        cfg.load_threads = loads[l];
+        benchmark_rtsim_and_log_d(fp, &cfg, "butter_df1_order8_cut2000_f64_ba", "DF1", butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_rtsim_and_log_d(fp, &cfg, "butter_df2_order8_cut2000_f64_ba", "DF2", butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_rtsim_and_log_d(fp, &cfg, "butter_tdf2_order8_cut2000_f64_ba", "TDF2", butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], NULL, 9);
+        benchmark_rtsim_and_log_d(fp, &cfg, "butter_cascade_order8_cut2000_f64_sos", "CASCADE", NULL, NULL, *butter_cascade_order8_cut2000_f64_sos, 4);
+        benchmark_rtsim_and_log_f(fp, &cfg, "butter_df1_order8_cut2000_f32_ba", "DF1", butter_df1_order8_cut2000_f32_ba[0], butter_df1_order8_cut2000_f32_ba[1], NULL, 9);
+        benchmark_rtsim_and_log_f(fp, &cfg, "butter_df2_order8_cut2000_f32_ba", "DF2", butter_df2_order8_cut2000_f32_ba[0], butter_df2_order8_cut2000_f32_ba[1], NULL, 9);
+        benchmark_rtsim_and_log_f(fp, &cfg, "butter_tdf2_order8_cut2000_f32_ba", "TDF2", butter_tdf2_order8_cut2000_f32_ba[0], butter_tdf2_order8_cut2000_f32_ba[1], NULL, 9);
+        benchmark_rtsim_and_log_f(fp, &cfg, "butter_cascade_order8_cut2000_f32_sos", "CASCADE", NULL, NULL, *butter_cascade_order8_cut2000_f32_sos, 4);
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+// === Konfiguracje pomiaru ===
+// Jedno wywołanie benchmark_* na indeks; kolejność, rozgrzewkę i liczbę powtórzeń wybiera runner.h
+static int run_config(FILE *fp, int idx) {
+    switch (idx) {
+    // Tu wkleić zawartość pliku generated_calls_time_floating.txt
+    case 0: benchmark_and_log(fp, "butter_df1_order2_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 1: benchmark_and_log(fp, "butter_df2_order2_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 2: benchmark_and_log(fp, "butter_tdf2_order2_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 3: benchmark_cascade_and_log(fp, "butter_cascade_order2_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order2_cut1000_f64_sos, 1); break;
+    case 4: benchmark_sos_and_log(fp, "butter_cascade_order2_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *butter_cascade_order2_cut1000_f64_sos, 1); break;
+    case 5: benchmark_and_log(fp, "butter_df1_order2_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order2_cut1000_f32_ba[0], butter_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 6: benchmark_and_log(fp, "butter_df2_order2_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order2_cut1000_f32_ba[0], butter_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 7: benchmark_and_log(fp, "butter_tdf2_order2_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order2_cut1000_f32_ba[0], butter_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 8: benchmark_cascade_and_log(fp, "butter_cascade_order2_cut1000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order2_cut1000_f32_sos, NULL, 1); break;
+    case 9: benchmark_sos_and_log(fp, "butter_cascade_order2_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *butter_cascade_order2_cut1000_f32_sos, NULL, 1); break;
+    case 10: benchmark_and_log(fp, "butter_df1_order2_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 11: benchmark_and_log(fp, "butter_df2_order2_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 12: benchmark_and_log(fp, "butter_tdf2_order2_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 13: benchmark_cascade_and_log(fp, "butter_cascade_order2_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order2_cut2000_f64_sos, 1); break;
+    case 14: benchmark_sos_and_log(fp, "butter_cascade_order2_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *butter_cascade_order2_cut2000_f64_sos, 1); break;
+    case 15: benchmark_and_log(fp, "butter_df1_order2_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order2_cut2000_f32_ba[0], butter_df1_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 16: benchmark_and_log(fp, "butter_df2_order2_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order2_cut2000_f32_ba[0], butter_df2_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 17: benchmark_and_log(fp, "butter_tdf2_order2_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order2_cut2000_f32_ba[0], butter_tdf2_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 18: benchmark_cascade_and_log(fp, "butter_cascade_order2_cut2000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order2_cut2000_f32_sos, NULL, 1); break;
+    case 19: benchmark_sos_and_log(fp, "butter_cascade_order2_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *butter_cascade_order2_cut2000_f32_sos, NULL, 1); break;
+    case 20: benchmark_and_log(fp, "butter_df1_order2_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 21: benchmark_and_log(fp, "butter_df2_order2_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 22: benchmark_and_log(fp, "butter_tdf2_order2_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 23: benchmark_cascade_and_log(fp, "butter_cascade_order2_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order2_cut5000_f64_sos, 1); break;
+    case 24: benchmark_sos_and_log(fp, "butter_cascade_order2_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *butter_cascade_order2_cut5000_f64_sos, 1); break;
+    case 25: benchmark_and_log(fp, "butter_df1_order2_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order2_cut5000_f32_ba[0], butter_df1_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 26: benchmark_and_log(fp, "butter_df2_order2_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order2_cut5000_f32_ba[0], butter_df2_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 27: benchmark_and_log(fp, "butter_tdf2_order2_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order2_cut5000_f32_ba[0], butter_tdf2_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 28: benchmark_cascade_and_log(fp, "butter_cascade_order2_cut5000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order2_cut5000_f32_sos, NULL, 1); break;
+    case 29: benchmark_sos_and_log(fp, "butter_cascade_order2_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *butter_cascade_order2_cut5000_f32_sos, NULL, 1); break;
+    case 30: benchmark_and_log(fp, "butter_df1_order4_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 31: benchmark_and_log(fp, "butter_df2_order4_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 32: benchmark_and_log(fp, "butter_tdf2_order4_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 33: benchmark_cascade_and_log(fp, "butter_cascade_order4_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order4_cut1000_f64_sos, 2); break;
+    case 34: benchmark_sos_and_log(fp, "butter_cascade_order4_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *butter_cascade_order4_cut1000_f64_sos, 2); break;
+    case 35: benchmark_and_log(fp, "butter_df1_order4_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order4_cut1000_f32_ba[0], butter_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 36: benchmark_and_log(fp, "butter_df2_order4_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order4_cut1000_f32_ba[0], butter_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 37: benchmark_and_log(fp, "butter_tdf2_order4_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order4_cut1000_f32_ba[0], butter_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 38: benchmark_cascade_and_log(fp, "butter_cascade_order4_cut1000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order4_cut1000_f32_sos, NULL, 2); break;
+    case 39: benchmark_sos_and_log(fp, "butter_cascade_order4_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *butter_cascade_order4_cut1000_f32_sos, NULL, 2); break;
+    case 40: benchmark_and_log(fp, "butter_df1_order4_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 41: benchmark_and_log(fp, "butter_df2_order4_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 42: benchmark_and_log(fp, "butter_tdf2_order4_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 43: benchmark_cascade_and_log(fp, "butter_cascade_order4_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order4_cut2000_f64_sos, 2); break;
+    case 44: benchmark_sos_and_log(fp, "butter_cascade_order4_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *butter_cascade_order4_cut2000_f64_sos, 2); break;
+    case 45: benchmark_and_log(fp, "butter_df1_order4_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order4_cut2000_f32_ba[0], butter_df1_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 46: benchmark_and_log(fp, "butter_df2_order4_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order4_cut2000_f32_ba[0], butter_df2_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 47: benchmark_and_log(fp, "butter_tdf2_order4_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order4_cut2000_f32_ba[0], butter_tdf2_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 48: benchmark_cascade_and_log(fp, "butter_cascade_order4_cut2000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order4_cut2000_f32_sos, NULL, 2); break;
+    case 49: benchmark_sos_and_log(fp, "butter_cascade_order4_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *butter_cascade_order4_cut2000_f32_sos, NULL, 2); break;
+    case 50: benchmark_and_log(fp, "butter_df1_order4_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 51: benchmark_and_log(fp, "butter_df2_order4_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 52: benchmark_and_log(fp, "butter_tdf2_order4_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 53: benchmark_cascade_and_log(fp, "butter_cascade_order4_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order4_cut5000_f64_sos, 2); break;
+    case 54: benchmark_sos_and_log(fp, "butter_cascade_order4_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *butter_cascade_order4_cut5000_f64_sos, 2); break;
+    case 55: benchmark_and_log(fp, "butter_df1_order4_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order4_cut5000_f32_ba[0], butter_df1_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 56: benchmark_and_log(fp, "butter_df2_order4_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order4_cut5000_f32_ba[0], butter_df2_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 57: benchmark_and_log(fp, "butter_tdf2_order4_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order4_cut5000_f32_ba[0], butter_tdf2_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 58: benchmark_cascade_and_log(fp, "butter_cascade_order4_cut5000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order4_cut5000_f32_sos, NULL, 2); break;
+    case 59: benchmark_sos_and_log(fp, "butter_cascade_order4_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *butter_cascade_order4_cut5000_f32_sos, NULL, 2); break;
+    case 60: benchmark_and_log(fp, "butter_df1_order6_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 61: benchmark_and_log(fp, "butter_df2_order6_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 62: benchmark_and_log(fp, "butter_tdf2_order6_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 63: benchmark_cascade_and_log(fp, "butter_cascade_order6_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order6_cut1000_f64_sos, 3); break;
+    case 64: benchmark_sos_and_log(fp, "butter_cascade_order6_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *butter_cascade_order6_cut1000_f64_sos, 3); break;
+    case 65: benchmark_and_log(fp, "butter_df1_order6_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order6_cut1000_f32_ba[0], butter_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 66: benchmark_and_log(fp, "butter_df2_order6_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order6_cut1000_f32_ba[0], butter_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 67: benchmark_and_log(fp, "butter_tdf2_order6_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order6_cut1000_f32_ba[0], butter_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 68: benchmark_cascade_and_log(fp, "butter_cascade_order6_cut1000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order6_cut1000_f32_sos, NULL, 3); break;
+    case 69: benchmark_sos_and_log(fp, "butter_cascade_order6_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *butter_cascade_order6_cut1000_f32_sos, NULL, 3); break;
+    case 70: benchmark_and_log(fp, "butter_df1_order6_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 71: benchmark_and_log(fp, "butter_df2_order6_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 72: benchmark_and_log(fp, "butter_tdf2_order6_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 73: benchmark_cascade_and_log(fp, "butter_cascade_order6_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order6_cut2000_f64_sos, 3); break;
+    case 74: benchmark_sos_and_log(fp, "butter_cascade_order6_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *butter_cascade_order6_cut2000_f64_sos, 3); break;
+    case 75: benchmark_and_log(fp, "butter_df1_order6_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order6_cut2000_f32_ba[0], butter_df1_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 76: benchmark_and_log(fp, "butter_df2_order6_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order6_cut2000_f32_ba[0], butter_df2_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 77: benchmark_and_log(fp, "butter_tdf2_order6_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order6_cut2000_f32_ba[0], butter_tdf2_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 78: benchmark_cascade_and_log(fp, "butter_cascade_order6_cut2000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order6_cut2000_f32_sos, NULL, 3); break;
+    case 79: benchmark_sos_and_log(fp, "butter_cascade_order6_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *butter_cascade_order6_cut2000_f32_sos, NULL, 3); break;
+    case 80: benchmark_and_log(fp, "butter_df1_order6_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 81: benchmark_and_log(fp, "butter_df2_order6_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 82: benchmark_and_log(fp, "butter_tdf2_order6_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 83: benchmark_cascade_and_log(fp, "butter_cascade_order6_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order6_cut5000_f64_sos, 3); break;
+    case 84: benchmark_sos_and_log(fp, "butter_cascade_order6_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *butter_cascade_order6_cut5000_f64_sos, 3); break;
+    case 85: benchmark_and_log(fp, "butter_df1_order6_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order6_cut5000_f32_ba[0], butter_df1_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 86: benchmark_and_log(fp, "butter_df2_order6_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order6_cut5000_f32_ba[0], butter_df2_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 87: benchmark_and_log(fp, "butter_tdf2_order6_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order6_cut5000_f32_ba[0], butter_tdf2_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 88: benchmark_cascade_and_log(fp, "butter_cascade_order6_cut5000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order6_cut5000_f32_sos, NULL, 3); break;
+    case 89: benchmark_sos_and_log(fp, "butter_cascade_order6_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *butter_cascade_order6_cut5000_f32_sos, NULL, 3); break;
+    case 90: benchmark_and_log(fp, "butter_df1_order8_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 91: benchmark_and_log(fp, "butter_df2_order8_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 92: benchmark_and_log(fp, "butter_tdf2_order8_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 93: benchmark_cascade_and_log(fp, "butter_cascade_order8_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order8_cut1000_f64_sos, 4); break;
+    case 94: benchmark_sos_and_log(fp, "butter_cascade_order8_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *butter_cascade_order8_cut1000_f64_sos, 4); break;
+    case 95: benchmark_and_log(fp, "butter_df1_order8_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order8_cut1000_f32_ba[0], butter_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 96: benchmark_and_log(fp, "butter_df2_order8_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order8_cut1000_f32_ba[0], butter_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 97: benchmark_and_log(fp, "butter_tdf2_order8_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order8_cut1000_f32_ba[0], butter_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 98: benchmark_cascade_and_log(fp, "butter_cascade_order8_cut1000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order8_cut1000_f32_sos, NULL, 4); break;
+    case 99: benchmark_sos_and_log(fp, "butter_cascade_order8_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *butter_cascade_order8_cut1000_f32_sos, NULL, 4); break;
+    case 100: benchmark_and_log(fp, "butter_df1_order8_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 101: benchmark_and_log(fp, "butter_df2_order8_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 102: benchmark_and_log(fp, "butter_tdf2_order8_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 103: benchmark_cascade_and_log(fp, "butter_cascade_order8_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order8_cut2000_f64_sos, 4); break;
+    case 104: benchmark_sos_and_log(fp, "butter_cascade_order8_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *butter_cascade_order8_cut2000_f64_sos, 4); break;
+    case 105: benchmark_and_log(fp, "butter_df1_order8_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order8_cut2000_f32_ba[0], butter_df1_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 106: benchmark_and_log(fp, "butter_df2_order8_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order8_cut2000_f32_ba[0], butter_df2_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 107: benchmark_and_log(fp, "butter_tdf2_order8_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order8_cut2000_f32_ba[0], butter_tdf2_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 108: benchmark_cascade_and_log(fp, "butter_cascade_order8_cut2000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order8_cut2000_f32_sos, NULL, 4); break;
+    case 109: benchmark_sos_and_log(fp, "butter_cascade_order8_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *butter_cascade_order8_cut2000_f32_sos, NULL, 4); break;
+    case 110: benchmark_and_log(fp, "butter_df1_order8_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 111: benchmark_and_log(fp, "butter_df2_order8_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 112: benchmark_and_log(fp, "butter_tdf2_order8_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 113: benchmark_cascade_and_log(fp, "butter_cascade_order8_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *butter_cascade_order8_cut5000_f64_sos, 4); break;
+    case 114: benchmark_sos_and_log(fp, "butter_cascade_order8_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *butter_cascade_order8_cut5000_f64_sos, 4); break;
+    case 115: benchmark_and_log(fp, "butter_df1_order8_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, butter_df1_order8_cut5000_f32_ba[0], butter_df1_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 116: benchmark_and_log(fp, "butter_df2_order8_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, butter_df2_order8_cut5000_f32_ba[0], butter_df2_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 117: benchmark_and_log(fp, "butter_tdf2_order8_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, butter_tdf2_order8_cut5000_f32_ba[0], butter_tdf2_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 118: benchmark_cascade_and_log(fp, "butter_cascade_order8_cut5000_f32_sos", "float", CASCADE_f, NULL, *butter_cascade_order8_cut5000_f32_sos, NULL, 4); break;
+    case 119: benchmark_sos_and_log(fp, "butter_cascade_order8_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *butter_cascade_order8_cut5000_f32_sos, NULL, 4); break;
+    case 120: benchmark_and_log(fp, "cheby1_df1_order2_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 121: benchmark_and_log(fp, "cheby1_df2_order2_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 122: benchmark_and_log(fp, "cheby1_tdf2_order2_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 123: benchmark_cascade_and_log(fp, "cheby1_cascade_order2_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order2_cut1000_f64_sos, 1); break;
+    case 124: benchmark_sos_and_log(fp, "cheby1_cascade_order2_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby1_cascade_order2_cut1000_f64_sos, 1); break;
+    case 125: benchmark_and_log(fp, "cheby1_df1_order2_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order2_cut1000_f32_ba[0], cheby1_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 126: benchmark_and_log(fp, "cheby1_df2_order2_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order2_cut1000_f32_ba[0], cheby1_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 127: benchmark_and_log(fp, "cheby1_tdf2_order2_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order2_cut1000_f32_ba[0], cheby1_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 128: benchmark_cascade_and_log(fp, "cheby1_cascade_order2_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order2_cut1000_f32_sos, NULL, 1); break;
+    case 129: benchmark_sos_and_log(fp, "cheby1_cascade_order2_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby1_cascade_order2_cut1000_f32_sos, NULL, 1); break;
+    case 130: benchmark_and_log(fp, "cheby1_df1_order2_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 131: benchmark_and_log(fp, "cheby1_df2_order2_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 132: benchmark_and_log(fp, "cheby1_tdf2_order2_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 133: benchmark_cascade_and_log(fp, "cheby1_cascade_order2_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order2_cut2000_f64_sos, 1); break;
+    case 134: benchmark_sos_and_log(fp, "cheby1_cascade_order2_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby1_cascade_order2_cut2000_f64_sos, 1); break;
+    case 135: benchmark_and_log(fp, "cheby1_df1_order2_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order2_cut2000_f32_ba[0], cheby1_df1_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 136: benchmark_and_log(fp, "cheby1_df2_order2_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order2_cut2000_f32_ba[0], cheby1_df2_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 137: benchmark_and_log(fp, "cheby1_tdf2_order2_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order2_cut2000_f32_ba[0], cheby1_tdf2_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 138: benchmark_cascade_and_log(fp, "cheby1_cascade_order2_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order2_cut2000_f32_sos, NULL, 1); break;
+    case 139: benchmark_sos_and_log(fp, "cheby1_cascade_order2_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby1_cascade_order2_cut2000_f32_sos, NULL, 1); break;
+    case 140: benchmark_and_log(fp, "cheby1_df1_order2_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 141: benchmark_and_log(fp, "cheby1_df2_order2_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 142: benchmark_and_log(fp, "cheby1_tdf2_order2_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 143: benchmark_cascade_and_log(fp, "cheby1_cascade_order2_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order2_cut5000_f64_sos, 1); break;
+    case 144: benchmark_sos_and_log(fp, "cheby1_cascade_order2_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby1_cascade_order2_cut5000_f64_sos, 1); break;
+    case 145: benchmark_and_log(fp, "cheby1_df1_order2_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order2_cut5000_f32_ba[0], cheby1_df1_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 146: benchmark_and_log(fp, "cheby1_df2_order2_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order2_cut5000_f32_ba[0], cheby1_df2_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 147: benchmark_and_log(fp, "cheby1_tdf2_order2_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order2_cut5000_f32_ba[0], cheby1_tdf2_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 148: benchmark_cascade_and_log(fp, "cheby1_cascade_order2_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order2_cut5000_f32_sos, NULL, 1); break;
+    case 149: benchmark_sos_and_log(fp, "cheby1_cascade_order2_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby1_cascade_order2_cut5000_f32_sos, NULL, 1); break;
+    case 150: benchmark_and_log(fp, "cheby1_df1_order4_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 151: benchmark_and_log(fp, "cheby1_df2_order4_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 152: benchmark_and_log(fp, "cheby1_tdf2_order4_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 153: benchmark_cascade_and_log(fp, "cheby1_cascade_order4_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order4_cut1000_f64_sos, 2); break;
+    case 154: benchmark_sos_and_log(fp, "cheby1_cascade_order4_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby1_cascade_order4_cut1000_f64_sos, 2); break;
+    case 155: benchmark_and_log(fp, "cheby1_df1_order4_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order4_cut1000_f32_ba[0], cheby1_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 156: benchmark_and_log(fp, "cheby1_df2_order4_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order4_cut1000_f32_ba[0], cheby1_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 157: benchmark_and_log(fp, "cheby1_tdf2_order4_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order4_cut1000_f32_ba[0], cheby1_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 158: benchmark_cascade_and_log(fp, "cheby1_cascade_order4_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order4_cut1000_f32_sos, NULL, 2); break;
+    case 159: benchmark_sos_and_log(fp, "cheby1_cascade_order4_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby1_cascade_order4_cut1000_f32_sos, NULL, 2); break;
+    case 160: benchmark_and_log(fp, "cheby1_df1_order4_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 161: benchmark_and_log(fp, "cheby1_df2_order4_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 162: benchmark_and_log(fp, "cheby1_tdf2_order4_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 163: benchmark_cascade_and_log(fp, "cheby1_cascade_order4_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order4_cut2000_f64_sos, 2); break;
+    case 164: benchmark_sos_and_log(fp, "cheby1_cascade_order4_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby1_cascade_order4_cut2000_f64_sos, 2); break;
+    case 165: benchmark_and_log(fp, "cheby1_df1_order4_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order4_cut2000_f32_ba[0], cheby1_df1_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 166: benchmark_and_log(fp, "cheby1_df2_order4_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order4_cut2000_f32_ba[0], cheby1_df2_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 167: benchmark_and_log(fp, "cheby1_tdf2_order4_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order4_cut2000_f32_ba[0], cheby1_tdf2_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 168: benchmark_cascade_and_log(fp, "cheby1_cascade_order4_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order4_cut2000_f32_sos, NULL, 2); break;
+    case 169: benchmark_sos_and_log(fp, "cheby1_cascade_order4_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby1_cascade_order4_cut2000_f32_sos, NULL, 2); break;
+    case 170: benchmark_and_log(fp, "cheby1_df1_order4_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 171: benchmark_and_log(fp, "cheby1_df2_order4_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 172: benchmark_and_log(fp, "cheby1_tdf2_order4_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 173: benchmark_cascade_and_log(fp, "cheby1_cascade_order4_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order4_cut5000_f64_sos, 2); break;
+    case 174: benchmark_sos_and_log(fp, "cheby1_cascade_order4_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby1_cascade_order4_cut5000_f64_sos, 2); break;
+    case 175: benchmark_and_log(fp, "cheby1_df1_order4_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order4_cut5000_f32_ba[0], cheby1_df1_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 176: benchmark_and_log(fp, "cheby1_df2_order4_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order4_cut5000_f32_ba[0], cheby1_df2_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 177: benchmark_and_log(fp, "cheby1_tdf2_order4_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order4_cut5000_f32_ba[0], cheby1_tdf2_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 178: benchmark_cascade_and_log(fp, "cheby1_cascade_order4_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order4_cut5000_f32_sos, NULL, 2); break;
+    case 179: benchmark_sos_and_log(fp, "cheby1_cascade_order4_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby1_cascade_order4_cut5000_f32_sos, NULL, 2); break;
+    case 180: benchmark_and_log(fp, "cheby1_df1_order6_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 181: benchmark_and_log(fp, "cheby1_df2_order6_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 182: benchmark_and_log(fp, "cheby1_tdf2_order6_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 183: benchmark_cascade_and_log(fp, "cheby1_cascade_order6_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order6_cut1000_f64_sos, 3); break;
+    case 184: benchmark_sos_and_log(fp, "cheby1_cascade_order6_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby1_cascade_order6_cut1000_f64_sos, 3); break;
+    case 185: benchmark_and_log(fp, "cheby1_df1_order6_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order6_cut1000_f32_ba[0], cheby1_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 186: benchmark_and_log(fp, "cheby1_df2_order6_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order6_cut1000_f32_ba[0], cheby1_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 187: benchmark_and_log(fp, "cheby1_tdf2_order6_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order6_cut1000_f32_ba[0], cheby1_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 188: benchmark_cascade_and_log(fp, "cheby1_cascade_order6_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order6_cut1000_f32_sos, NULL, 3); break;
+    case 189: benchmark_sos_and_log(fp, "cheby1_cascade_order6_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby1_cascade_order6_cut1000_f32_sos, NULL, 3); break;
+    case 190: benchmark_and_log(fp, "cheby1_df1_order6_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 191: benchmark_and_log(fp, "cheby1_df2_order6_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 192: benchmark_and_log(fp, "cheby1_tdf2_order6_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 193: benchmark_cascade_and_log(fp, "cheby1_cascade_order6_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order6_cut2000_f64_sos, 3); break;
+    case 194: benchmark_sos_and_log(fp, "cheby1_cascade_order6_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby1_cascade_order6_cut2000_f64_sos, 3); break;
+    case 195: benchmark_and_log(fp, "cheby1_df1_order6_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order6_cut2000_f32_ba[0], cheby1_df1_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 196: benchmark_and_log(fp, "cheby1_df2_order6_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order6_cut2000_f32_ba[0], cheby1_df2_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 197: benchmark_and_log(fp, "cheby1_tdf2_order6_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order6_cut2000_f32_ba[0], cheby1_tdf2_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 198: benchmark_cascade_and_log(fp, "cheby1_cascade_order6_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order6_cut2000_f32_sos, NULL, 3); break;
+    case 199: benchmark_sos_and_log(fp, "cheby1_cascade_order6_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby1_cascade_order6_cut2000_f32_sos, NULL, 3); break;
+    case 200: benchmark_and_log(fp, "cheby1_df1_order6_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 201: benchmark_and_log(fp, "cheby1_df2_order6_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 202: benchmark_and_log(fp, "cheby1_tdf2_order6_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 203: benchmark_cascade_and_log(fp, "cheby1_cascade_order6_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order6_cut5000_f64_sos, 3); break;
+    case 204: benchmark_sos_and_log(fp, "cheby1_cascade_order6_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby1_cascade_order6_cut5000_f64_sos, 3); break;
+    case 205: benchmark_and_log(fp, "cheby1_df1_order6_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order6_cut5000_f32_ba[0], cheby1_df1_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 206: benchmark_and_log(fp, "cheby1_df2_order6_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order6_cut5000_f32_ba[0], cheby1_df2_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 207: benchmark_and_log(fp, "cheby1_tdf2_order6_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order6_cut5000_f32_ba[0], cheby1_tdf2_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 208: benchmark_cascade_and_log(fp, "cheby1_cascade_order6_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order6_cut5000_f32_sos, NULL, 3); break;
+    case 209: benchmark_sos_and_log(fp, "cheby1_cascade_order6_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby1_cascade_order6_cut5000_f32_sos, NULL, 3); break;
+    case 210: benchmark_and_log(fp, "cheby1_df1_order8_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 211: benchmark_and_log(fp, "cheby1_df2_order8_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 212: benchmark_and_log(fp, "cheby1_tdf2_order8_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 213: benchmark_cascade_and_log(fp, "cheby1_cascade_order8_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order8_cut1000_f64_sos, 4); break;
+    case 214: benchmark_sos_and_log(fp, "cheby1_cascade_order8_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby1_cascade_order8_cut1000_f64_sos, 4); break;
+    case 215: benchmark_and_log(fp, "cheby1_df1_order8_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order8_cut1000_f32_ba[0], cheby1_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 216: benchmark_and_log(fp, "cheby1_df2_order8_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order8_cut1000_f32_ba[0], cheby1_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 217: benchmark_and_log(fp, "cheby1_tdf2_order8_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order8_cut1000_f32_ba[0], cheby1_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 218: benchmark_cascade_and_log(fp, "cheby1_cascade_order8_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order8_cut1000_f32_sos, NULL, 4); break;
+    case 219: benchmark_sos_and_log(fp, "cheby1_cascade_order8_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby1_cascade_order8_cut1000_f32_sos, NULL, 4); break;
+    case 220: benchmark_and_log(fp, "cheby1_df1_order8_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 221: benchmark_and_log(fp, "cheby1_df2_order8_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 222: benchmark_and_log(fp, "cheby1_tdf2_order8_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 223: benchmark_cascade_and_log(fp, "cheby1_cascade_order8_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order8_cut2000_f64_sos, 4); break;
+    case 224: benchmark_sos_and_log(fp, "cheby1_cascade_order8_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby1_cascade_order8_cut2000_f64_sos, 4); break;
+    case 225: benchmark_and_log(fp, "cheby1_df1_order8_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order8_cut2000_f32_ba[0], cheby1_df1_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 226: benchmark_and_log(fp, "cheby1_df2_order8_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order8_cut2000_f32_ba[0], cheby1_df2_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 227: benchmark_and_log(fp, "cheby1_tdf2_order8_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order8_cut2000_f32_ba[0], cheby1_tdf2_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 228: benchmark_cascade_and_log(fp, "cheby1_cascade_order8_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order8_cut2000_f32_sos, NULL, 4); break;
+    case 229: benchmark_sos_and_log(fp, "cheby1_cascade_order8_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby1_cascade_order8_cut2000_f32_sos, NULL, 4); break;
+    case 230: benchmark_and_log(fp, "cheby1_df1_order8_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 231: benchmark_and_log(fp, "cheby1_df2_order8_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 232: benchmark_and_log(fp, "cheby1_tdf2_order8_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 233: benchmark_cascade_and_log(fp, "cheby1_cascade_order8_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby1_cascade_order8_cut5000_f64_sos, 4); break;
+    case 234: benchmark_sos_and_log(fp, "cheby1_cascade_order8_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby1_cascade_order8_cut5000_f64_sos, 4); break;
+    case 235: benchmark_and_log(fp, "cheby1_df1_order8_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby1_df1_order8_cut5000_f32_ba[0], cheby1_df1_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 236: benchmark_and_log(fp, "cheby1_df2_order8_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby1_df2_order8_cut5000_f32_ba[0], cheby1_df2_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 237: benchmark_and_log(fp, "cheby1_tdf2_order8_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby1_tdf2_order8_cut5000_f32_ba[0], cheby1_tdf2_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 238: benchmark_cascade_and_log(fp, "cheby1_cascade_order8_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby1_cascade_order8_cut5000_f32_sos, NULL, 4); break;
+    case 239: benchmark_sos_and_log(fp, "cheby1_cascade_order8_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby1_cascade_order8_cut5000_f32_sos, NULL, 4); break;
+    case 240: benchmark_and_log(fp, "cheby2_df1_order2_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 241: benchmark_and_log(fp, "cheby2_df2_order2_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 242: benchmark_and_log(fp, "cheby2_tdf2_order2_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 243: benchmark_cascade_and_log(fp, "cheby2_cascade_order2_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order2_cut1000_f64_sos, 1); break;
+    case 244: benchmark_sos_and_log(fp, "cheby2_cascade_order2_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby2_cascade_order2_cut1000_f64_sos, 1); break;
+    case 245: benchmark_and_log(fp, "cheby2_df1_order2_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order2_cut1000_f32_ba[0], cheby2_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 246: benchmark_and_log(fp, "cheby2_df2_order2_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order2_cut1000_f32_ba[0], cheby2_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 247: benchmark_and_log(fp, "cheby2_tdf2_order2_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order2_cut1000_f32_ba[0], cheby2_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 248: benchmark_cascade_and_log(fp, "cheby2_cascade_order2_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order2_cut1000_f32_sos, NULL, 1); break;
+    case 249: benchmark_sos_and_log(fp, "cheby2_cascade_order2_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby2_cascade_order2_cut1000_f32_sos, NULL, 1); break;
+    case 250: benchmark_and_log(fp, "cheby2_df1_order2_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 251: benchmark_and_log(fp, "cheby2_df2_order2_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 252: benchmark_and_log(fp, "cheby2_tdf2_order2_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 253: benchmark_cascade_and_log(fp, "cheby2_cascade_order2_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order2_cut2000_f64_sos, 1); break;
+    case 254: benchmark_sos_and_log(fp, "cheby2_cascade_order2_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby2_cascade_order2_cut2000_f64_sos, 1); break;
+    case 255: benchmark_and_log(fp, "cheby2_df1_order2_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order2_cut2000_f32_ba[0], cheby2_df1_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 256: benchmark_and_log(fp, "cheby2_df2_order2_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order2_cut2000_f32_ba[0], cheby2_df2_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 257: benchmark_and_log(fp, "cheby2_tdf2_order2_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order2_cut2000_f32_ba[0], cheby2_tdf2_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 258: benchmark_cascade_and_log(fp, "cheby2_cascade_order2_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order2_cut2000_f32_sos, NULL, 1); break;
+    case 259: benchmark_sos_and_log(fp, "cheby2_cascade_order2_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby2_cascade_order2_cut2000_f32_sos, NULL, 1); break;
+    case 260: benchmark_and_log(fp, "cheby2_df1_order2_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 261: benchmark_and_log(fp, "cheby2_df2_order2_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 262: benchmark_and_log(fp, "cheby2_tdf2_order2_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 263: benchmark_cascade_and_log(fp, "cheby2_cascade_order2_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order2_cut5000_f64_sos, 1); break;
+    case 264: benchmark_sos_and_log(fp, "cheby2_cascade_order2_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby2_cascade_order2_cut5000_f64_sos, 1); break;
+    case 265: benchmark_and_log(fp, "cheby2_df1_order2_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order2_cut5000_f32_ba[0], cheby2_df1_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 266: benchmark_and_log(fp, "cheby2_df2_order2_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order2_cut5000_f32_ba[0], cheby2_df2_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 267: benchmark_and_log(fp, "cheby2_tdf2_order2_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order2_cut5000_f32_ba[0], cheby2_tdf2_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 268: benchmark_cascade_and_log(fp, "cheby2_cascade_order2_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order2_cut5000_f32_sos, NULL, 1); break;
+    case 269: benchmark_sos_and_log(fp, "cheby2_cascade_order2_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby2_cascade_order2_cut5000_f32_sos, NULL, 1); break;
+    case 270: benchmark_and_log(fp, "cheby2_df1_order4_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 271: benchmark_and_log(fp, "cheby2_df2_order4_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 272: benchmark_and_log(fp, "cheby2_tdf2_order4_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 273: benchmark_cascade_and_log(fp, "cheby2_cascade_order4_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order4_cut1000_f64_sos, 2); break;
+    case 274: benchmark_sos_and_log(fp, "cheby2_cascade_order4_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby2_cascade_order4_cut1000_f64_sos, 2); break;
+    case 275: benchmark_and_log(fp, "cheby2_df1_order4_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order4_cut1000_f32_ba[0], cheby2_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 276: benchmark_and_log(fp, "cheby2_df2_order4_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order4_cut1000_f32_ba[0], cheby2_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 277: benchmark_and_log(fp, "cheby2_tdf2_order4_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order4_cut1000_f32_ba[0], cheby2_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 278: benchmark_cascade_and_log(fp, "cheby2_cascade_order4_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order4_cut1000_f32_sos, NULL, 2); break;
+    case 279: benchmark_sos_and_log(fp, "cheby2_cascade_order4_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby2_cascade_order4_cut1000_f32_sos, NULL, 2); break;
+    case 280: benchmark_and_log(fp, "cheby2_df1_order4_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 281: benchmark_and_log(fp, "cheby2_df2_order4_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 282: benchmark_and_log(fp, "cheby2_tdf2_order4_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 283: benchmark_cascade_and_log(fp, "cheby2_cascade_order4_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order4_cut2000_f64_sos, 2); break;
+    case 284: benchmark_sos_and_log(fp, "cheby2_cascade_order4_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby2_cascade_order4_cut2000_f64_sos, 2); break;
+    case 285: benchmark_and_log(fp, "cheby2_df1_order4_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order4_cut2000_f32_ba[0], cheby2_df1_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 286: benchmark_and_log(fp, "cheby2_df2_order4_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order4_cut2000_f32_ba[0], cheby2_df2_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 287: benchmark_and_log(fp, "cheby2_tdf2_order4_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order4_cut2000_f32_ba[0], cheby2_tdf2_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 288: benchmark_cascade_and_log(fp, "cheby2_cascade_order4_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order4_cut2000_f32_sos, NULL, 2); break;
+    case 289: benchmark_sos_and_log(fp, "cheby2_cascade_order4_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby2_cascade_order4_cut2000_f32_sos, NULL, 2); break;
+    case 290: benchmark_and_log(fp, "cheby2_df1_order4_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 291: benchmark_and_log(fp, "cheby2_df2_order4_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 292: benchmark_and_log(fp, "cheby2_tdf2_order4_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 293: benchmark_cascade_and_log(fp, "cheby2_cascade_order4_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order4_cut5000_f64_sos, 2); break;
+    case 294: benchmark_sos_and_log(fp, "cheby2_cascade_order4_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby2_cascade_order4_cut5000_f64_sos, 2); break;
+    case 295: benchmark_and_log(fp, "cheby2_df1_order4_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order4_cut5000_f32_ba[0], cheby2_df1_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 296: benchmark_and_log(fp, "cheby2_df2_order4_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order4_cut5000_f32_ba[0], cheby2_df2_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 297: benchmark_and_log(fp, "cheby2_tdf2_order4_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order4_cut5000_f32_ba[0], cheby2_tdf2_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 298: benchmark_cascade_and_log(fp, "cheby2_cascade_order4_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order4_cut5000_f32_sos, NULL, 2); break;
+    case 299: benchmark_sos_and_log(fp, "cheby2_cascade_order4_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby2_cascade_order4_cut5000_f32_sos, NULL, 2); break;
+    case 300: benchmark_and_log(fp, "cheby2_df1_order6_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 301: benchmark_and_log(fp, "cheby2_df2_order6_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 302: benchmark_and_log(fp, "cheby2_tdf2_order6_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 303: benchmark_cascade_and_log(fp, "cheby2_cascade_order6_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order6_cut1000_f64_sos, 3); break;
+    case 304: benchmark_sos_and_log(fp, "cheby2_cascade_order6_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby2_cascade_order6_cut1000_f64_sos, 3); break;
+    case 305: benchmark_and_log(fp, "cheby2_df1_order6_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order6_cut1000_f32_ba[0], cheby2_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 306: benchmark_and_log(fp, "cheby2_df2_order6_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order6_cut1000_f32_ba[0], cheby2_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 307: benchmark_and_log(fp, "cheby2_tdf2_order6_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order6_cut1000_f32_ba[0], cheby2_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 308: benchmark_cascade_and_log(fp, "cheby2_cascade_order6_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order6_cut1000_f32_sos, NULL, 3); break;
+    case 309: benchmark_sos_and_log(fp, "cheby2_cascade_order6_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby2_cascade_order6_cut1000_f32_sos, NULL, 3); break;
+    case 310: benchmark_and_log(fp, "cheby2_df1_order6_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 311: benchmark_and_log(fp, "cheby2_df2_order6_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 312: benchmark_and_log(fp, "cheby2_tdf2_order6_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 313: benchmark_cascade_and_log(fp, "cheby2_cascade_order6_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order6_cut2000_f64_sos, 3); break;
+    case 314: benchmark_sos_and_log(fp, "cheby2_cascade_order6_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby2_cascade_order6_cut2000_f64_sos, 3); break;
+    case 315: benchmark_and_log(fp, "cheby2_df1_order6_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order6_cut2000_f32_ba[0], cheby2_df1_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 316: benchmark_and_log(fp, "cheby2_df2_order6_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order6_cut2000_f32_ba[0], cheby2_df2_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 317: benchmark_and_log(fp, "cheby2_tdf2_order6_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order6_cut2000_f32_ba[0], cheby2_tdf2_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 318: benchmark_cascade_and_log(fp, "cheby2_cascade_order6_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order6_cut2000_f32_sos, NULL, 3); break;
+    case 319: benchmark_sos_and_log(fp, "cheby2_cascade_order6_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby2_cascade_order6_cut2000_f32_sos, NULL, 3); break;
+    case 320: benchmark_and_log(fp, "cheby2_df1_order6_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 321: benchmark_and_log(fp, "cheby2_df2_order6_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 322: benchmark_and_log(fp, "cheby2_tdf2_order6_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 323: benchmark_cascade_and_log(fp, "cheby2_cascade_order6_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order6_cut5000_f64_sos, 3); break;
+    case 324: benchmark_sos_and_log(fp, "cheby2_cascade_order6_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby2_cascade_order6_cut5000_f64_sos, 3); break;
+    case 325: benchmark_and_log(fp, "cheby2_df1_order6_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order6_cut5000_f32_ba[0], cheby2_df1_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 326: benchmark_and_log(fp, "cheby2_df2_order6_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order6_cut5000_f32_ba[0], cheby2_df2_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 327: benchmark_and_log(fp, "cheby2_tdf2_order6_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order6_cut5000_f32_ba[0], cheby2_tdf2_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 328: benchmark_cascade_and_log(fp, "cheby2_cascade_order6_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order6_cut5000_f32_sos, NULL, 3); break;
+    case 329: benchmark_sos_and_log(fp, "cheby2_cascade_order6_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby2_cascade_order6_cut5000_f32_sos, NULL, 3); break;
+    case 330: benchmark_and_log(fp, "cheby2_df1_order8_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 331: benchmark_and_log(fp, "cheby2_df2_order8_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 332: benchmark_and_log(fp, "cheby2_tdf2_order8_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 333: benchmark_cascade_and_log(fp, "cheby2_cascade_order8_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order8_cut1000_f64_sos, 4); break;
+    case 334: benchmark_sos_and_log(fp, "cheby2_cascade_order8_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby2_cascade_order8_cut1000_f64_sos, 4); break;
+    case 335: benchmark_and_log(fp, "cheby2_df1_order8_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order8_cut1000_f32_ba[0], cheby2_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 336: benchmark_and_log(fp, "cheby2_df2_order8_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order8_cut1000_f32_ba[0], cheby2_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 337: benchmark_and_log(fp, "cheby2_tdf2_order8_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order8_cut1000_f32_ba[0], cheby2_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 338: benchmark_cascade_and_log(fp, "cheby2_cascade_order8_cut1000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order8_cut1000_f32_sos, NULL, 4); break;
+    case 339: benchmark_sos_and_log(fp, "cheby2_cascade_order8_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby2_cascade_order8_cut1000_f32_sos, NULL, 4); break;
+    case 340: benchmark_and_log(fp, "cheby2_df1_order8_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 341: benchmark_and_log(fp, "cheby2_df2_order8_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 342: benchmark_and_log(fp, "cheby2_tdf2_order8_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 343: benchmark_cascade_and_log(fp, "cheby2_cascade_order8_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order8_cut2000_f64_sos, 4); break;
+    case 344: benchmark_sos_and_log(fp, "cheby2_cascade_order8_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby2_cascade_order8_cut2000_f64_sos, 4); break;
+    case 345: benchmark_and_log(fp, "cheby2_df1_order8_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order8_cut2000_f32_ba[0], cheby2_df1_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 346: benchmark_and_log(fp, "cheby2_df2_order8_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order8_cut2000_f32_ba[0], cheby2_df2_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 347: benchmark_and_log(fp, "cheby2_tdf2_order8_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order8_cut2000_f32_ba[0], cheby2_tdf2_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 348: benchmark_cascade_and_log(fp, "cheby2_cascade_order8_cut2000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order8_cut2000_f32_sos, NULL, 4); break;
+    case 349: benchmark_sos_and_log(fp, "cheby2_cascade_order8_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby2_cascade_order8_cut2000_f32_sos, NULL, 4); break;
+    case 350: benchmark_and_log(fp, "cheby2_df1_order8_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 351: benchmark_and_log(fp, "cheby2_df2_order8_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 352: benchmark_and_log(fp, "cheby2_tdf2_order8_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 353: benchmark_cascade_and_log(fp, "cheby2_cascade_order8_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *cheby2_cascade_order8_cut5000_f64_sos, 4); break;
+    case 354: benchmark_sos_and_log(fp, "cheby2_cascade_order8_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *cheby2_cascade_order8_cut5000_f64_sos, 4); break;
+    case 355: benchmark_and_log(fp, "cheby2_df1_order8_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, cheby2_df1_order8_cut5000_f32_ba[0], cheby2_df1_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 356: benchmark_and_log(fp, "cheby2_df2_order8_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, cheby2_df2_order8_cut5000_f32_ba[0], cheby2_df2_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 357: benchmark_and_log(fp, "cheby2_tdf2_order8_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, cheby2_tdf2_order8_cut5000_f32_ba[0], cheby2_tdf2_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 358: benchmark_cascade_and_log(fp, "cheby2_cascade_order8_cut5000_f32_sos", "float", CASCADE_f, NULL, *cheby2_cascade_order8_cut5000_f32_sos, NULL, 4); break;
+    case 359: benchmark_sos_and_log(fp, "cheby2_cascade_order8_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *cheby2_cascade_order8_cut5000_f32_sos, NULL, 4); break;
+    case 360: benchmark_and_log(fp, "ellip_df1_order2_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 361: benchmark_and_log(fp, "ellip_df2_order2_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 362: benchmark_and_log(fp, "ellip_tdf2_order2_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 363: benchmark_cascade_and_log(fp, "ellip_cascade_order2_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order2_cut1000_f64_sos, 1); break;
+    case 364: benchmark_sos_and_log(fp, "ellip_cascade_order2_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *ellip_cascade_order2_cut1000_f64_sos, 1); break;
+    case 365: benchmark_and_log(fp, "ellip_df1_order2_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order2_cut1000_f32_ba[0], ellip_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 366: benchmark_and_log(fp, "ellip_df2_order2_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order2_cut1000_f32_ba[0], ellip_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 367: benchmark_and_log(fp, "ellip_tdf2_order2_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order2_cut1000_f32_ba[0], ellip_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 368: benchmark_cascade_and_log(fp, "ellip_cascade_order2_cut1000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order2_cut1000_f32_sos, NULL, 1); break;
+    case 369: benchmark_sos_and_log(fp, "ellip_cascade_order2_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *ellip_cascade_order2_cut1000_f32_sos, NULL, 1); break;
+    case 370: benchmark_and_log(fp, "ellip_df1_order2_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 371: benchmark_and_log(fp, "ellip_df2_order2_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 372: benchmark_and_log(fp, "ellip_tdf2_order2_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 373: benchmark_cascade_and_log(fp, "ellip_cascade_order2_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order2_cut2000_f64_sos, 1); break;
+    case 374: benchmark_sos_and_log(fp, "ellip_cascade_order2_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *ellip_cascade_order2_cut2000_f64_sos, 1); break;
+    case 375: benchmark_and_log(fp, "ellip_df1_order2_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order2_cut2000_f32_ba[0], ellip_df1_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 376: benchmark_and_log(fp, "ellip_df2_order2_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order2_cut2000_f32_ba[0], ellip_df2_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 377: benchmark_and_log(fp, "ellip_tdf2_order2_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order2_cut2000_f32_ba[0], ellip_tdf2_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 378: benchmark_cascade_and_log(fp, "ellip_cascade_order2_cut2000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order2_cut2000_f32_sos, NULL, 1); break;
+    case 379: benchmark_sos_and_log(fp, "ellip_cascade_order2_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *ellip_cascade_order2_cut2000_f32_sos, NULL, 1); break;
+    case 380: benchmark_and_log(fp, "ellip_df1_order2_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 381: benchmark_and_log(fp, "ellip_df2_order2_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 382: benchmark_and_log(fp, "ellip_tdf2_order2_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 383: benchmark_cascade_and_log(fp, "ellip_cascade_order2_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order2_cut5000_f64_sos, 1); break;
+    case 384: benchmark_sos_and_log(fp, "ellip_cascade_order2_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *ellip_cascade_order2_cut5000_f64_sos, 1); break;
+    case 385: benchmark_and_log(fp, "ellip_df1_order2_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order2_cut5000_f32_ba[0], ellip_df1_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 386: benchmark_and_log(fp, "ellip_df2_order2_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order2_cut5000_f32_ba[0], ellip_df2_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 387: benchmark_and_log(fp, "ellip_tdf2_order2_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order2_cut5000_f32_ba[0], ellip_tdf2_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 388: benchmark_cascade_and_log(fp, "ellip_cascade_order2_cut5000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order2_cut5000_f32_sos, NULL, 1); break;
+    case 389: benchmark_sos_and_log(fp, "ellip_cascade_order2_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *ellip_cascade_order2_cut5000_f32_sos, NULL, 1); break;
+    case 390: benchmark_and_log(fp, "ellip_df1_order4_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 391: benchmark_and_log(fp, "ellip_df2_order4_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 392: benchmark_and_log(fp, "ellip_tdf2_order4_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 393: benchmark_cascade_and_log(fp, "ellip_cascade_order4_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order4_cut1000_f64_sos, 2); break;
+    case 394: benchmark_sos_and_log(fp, "ellip_cascade_order4_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *ellip_cascade_order4_cut1000_f64_sos, 2); break;
+    case 395: benchmark_and_log(fp, "ellip_df1_order4_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order4_cut1000_f32_ba[0], ellip_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 396: benchmark_and_log(fp, "ellip_df2_order4_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order4_cut1000_f32_ba[0], ellip_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 397: benchmark_and_log(fp, "ellip_tdf2_order4_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order4_cut1000_f32_ba[0], ellip_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 398: benchmark_cascade_and_log(fp, "ellip_cascade_order4_cut1000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order4_cut1000_f32_sos, NULL, 2); break;
+    case 399: benchmark_sos_and_log(fp, "ellip_cascade_order4_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *ellip_cascade_order4_cut1000_f32_sos, NULL, 2); break;
+    case 400: benchmark_and_log(fp, "ellip_df1_order4_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 401: benchmark_and_log(fp, "ellip_df2_order4_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 402: benchmark_and_log(fp, "ellip_tdf2_order4_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 403: benchmark_cascade_and_log(fp, "ellip_cascade_order4_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order4_cut2000_f64_sos, 2); break;
+    case 404: benchmark_sos_and_log(fp, "ellip_cascade_order4_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *ellip_cascade_order4_cut2000_f64_sos, 2); break;
+    case 405: benchmark_and_log(fp, "ellip_df1_order4_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order4_cut2000_f32_ba[0], ellip_df1_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 406: benchmark_and_log(fp, "ellip_df2_order4_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order4_cut2000_f32_ba[0], ellip_df2_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 407: benchmark_and_log(fp, "ellip_tdf2_order4_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order4_cut2000_f32_ba[0], ellip_tdf2_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 408: benchmark_cascade_and_log(fp, "ellip_cascade_order4_cut2000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order4_cut2000_f32_sos, NULL, 2); break;
+    case 409: benchmark_sos_and_log(fp, "ellip_cascade_order4_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *ellip_cascade_order4_cut2000_f32_sos, NULL, 2); break;
+    case 410: benchmark_and_log(fp, "ellip_df1_order4_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 411: benchmark_and_log(fp, "ellip_df2_order4_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 412: benchmark_and_log(fp, "ellip_tdf2_order4_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 413: benchmark_cascade_and_log(fp, "ellip_cascade_order4_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order4_cut5000_f64_sos, 2); break;
+    case 414: benchmark_sos_and_log(fp, "ellip_cascade_order4_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *ellip_cascade_order4_cut5000_f64_sos, 2); break;
+    case 415: benchmark_and_log(fp, "ellip_df1_order4_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order4_cut5000_f32_ba[0], ellip_df1_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 416: benchmark_and_log(fp, "ellip_df2_order4_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order4_cut5000_f32_ba[0], ellip_df2_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 417: benchmark_and_log(fp, "ellip_tdf2_order4_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order4_cut5000_f32_ba[0], ellip_tdf2_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 418: benchmark_cascade_and_log(fp, "ellip_cascade_order4_cut5000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order4_cut5000_f32_sos, NULL, 2); break;
+    case 419: benchmark_sos_and_log(fp, "ellip_cascade_order4_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *ellip_cascade_order4_cut5000_f32_sos, NULL, 2); break;
+    case 420: benchmark_and_log(fp, "ellip_df1_order6_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 421: benchmark_and_log(fp, "ellip_df2_order6_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 422: benchmark_and_log(fp, "ellip_tdf2_order6_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 423: benchmark_cascade_and_log(fp, "ellip_cascade_order6_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order6_cut1000_f64_sos, 3); break;
+    case 424: benchmark_sos_and_log(fp, "ellip_cascade_order6_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *ellip_cascade_order6_cut1000_f64_sos, 3); break;
+    case 425: benchmark_and_log(fp, "ellip_df1_order6_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order6_cut1000_f32_ba[0], ellip_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 426: benchmark_and_log(fp, "ellip_df2_order6_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order6_cut1000_f32_ba[0], ellip_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 427: benchmark_and_log(fp, "ellip_tdf2_order6_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order6_cut1000_f32_ba[0], ellip_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 428: benchmark_cascade_and_log(fp, "ellip_cascade_order6_cut1000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order6_cut1000_f32_sos, NULL, 3); break;
+    case 429: benchmark_sos_and_log(fp, "ellip_cascade_order6_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *ellip_cascade_order6_cut1000_f32_sos, NULL, 3); break;
+    case 430: benchmark_and_log(fp, "ellip_df1_order6_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 431: benchmark_and_log(fp, "ellip_df2_order6_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 432: benchmark_and_log(fp, "ellip_tdf2_order6_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 433: benchmark_cascade_and_log(fp, "ellip_cascade_order6_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order6_cut2000_f64_sos, 3); break;
+    case 434: benchmark_sos_and_log(fp, "ellip_cascade_order6_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *ellip_cascade_order6_cut2000_f64_sos, 3); break;
+    case 435: benchmark_and_log(fp, "ellip_df1_order6_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order6_cut2000_f32_ba[0], ellip_df1_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 436: benchmark_and_log(fp, "ellip_df2_order6_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order6_cut2000_f32_ba[0], ellip_df2_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 437: benchmark_and_log(fp, "ellip_tdf2_order6_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order6_cut2000_f32_ba[0], ellip_tdf2_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 438: benchmark_cascade_and_log(fp, "ellip_cascade_order6_cut2000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order6_cut2000_f32_sos, NULL, 3); break;
+    case 439: benchmark_sos_and_log(fp, "ellip_cascade_order6_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *ellip_cascade_order6_cut2000_f32_sos, NULL, 3); break;
+    case 440: benchmark_and_log(fp, "ellip_df1_order6_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 441: benchmark_and_log(fp, "ellip_df2_order6_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 442: benchmark_and_log(fp, "ellip_tdf2_order6_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 443: benchmark_cascade_and_log(fp, "ellip_cascade_order6_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order6_cut5000_f64_sos, 3); break;
+    case 444: benchmark_sos_and_log(fp, "ellip_cascade_order6_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *ellip_cascade_order6_cut5000_f64_sos, 3); break;
+    case 445: benchmark_and_log(fp, "ellip_df1_order6_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order6_cut5000_f32_ba[0], ellip_df1_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 446: benchmark_and_log(fp, "ellip_df2_order6_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order6_cut5000_f32_ba[0], ellip_df2_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 447: benchmark_and_log(fp, "ellip_tdf2_order6_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order6_cut5000_f32_ba[0], ellip_tdf2_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 448: benchmark_cascade_and_log(fp, "ellip_cascade_order6_cut5000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order6_cut5000_f32_sos, NULL, 3); break;
+    case 449: benchmark_sos_and_log(fp, "ellip_cascade_order6_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *ellip_cascade_order6_cut5000_f32_sos, NULL, 3); break;
+    case 450: benchmark_and_log(fp, "ellip_df1_order8_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 451: benchmark_and_log(fp, "ellip_df2_order8_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 452: benchmark_and_log(fp, "ellip_tdf2_order8_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 453: benchmark_cascade_and_log(fp, "ellip_cascade_order8_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order8_cut1000_f64_sos, 4); break;
+    case 454: benchmark_sos_and_log(fp, "ellip_cascade_order8_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *ellip_cascade_order8_cut1000_f64_sos, 4); break;
+    case 455: benchmark_and_log(fp, "ellip_df1_order8_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order8_cut1000_f32_ba[0], ellip_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 456: benchmark_and_log(fp, "ellip_df2_order8_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order8_cut1000_f32_ba[0], ellip_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 457: benchmark_and_log(fp, "ellip_tdf2_order8_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order8_cut1000_f32_ba[0], ellip_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 458: benchmark_cascade_and_log(fp, "ellip_cascade_order8_cut1000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order8_cut1000_f32_sos, NULL, 4); break;
+    case 459: benchmark_sos_and_log(fp, "ellip_cascade_order8_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *ellip_cascade_order8_cut1000_f32_sos, NULL, 4); break;
+    case 460: benchmark_and_log(fp, "ellip_df1_order8_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 461: benchmark_and_log(fp, "ellip_df2_order8_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 462: benchmark_and_log(fp, "ellip_tdf2_order8_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 463: benchmark_cascade_and_log(fp, "ellip_cascade_order8_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order8_cut2000_f64_sos, 4); break;
+    case 464: benchmark_sos_and_log(fp, "ellip_cascade_order8_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *ellip_cascade_order8_cut2000_f64_sos, 4); break;
+    case 465: benchmark_and_log(fp, "ellip_df1_order8_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order8_cut2000_f32_ba[0], ellip_df1_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 466: benchmark_and_log(fp, "ellip_df2_order8_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order8_cut2000_f32_ba[0], ellip_df2_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 467: benchmark_and_log(fp, "ellip_tdf2_order8_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order8_cut2000_f32_ba[0], ellip_tdf2_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 468: benchmark_cascade_and_log(fp, "ellip_cascade_order8_cut2000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order8_cut2000_f32_sos, NULL, 4); break;
+    case 469: benchmark_sos_and_log(fp, "ellip_cascade_order8_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *ellip_cascade_order8_cut2000_f32_sos, NULL, 4); break;
+    case 470: benchmark_and_log(fp, "ellip_df1_order8_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 471: benchmark_and_log(fp, "ellip_df2_order8_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 472: benchmark_and_log(fp, "ellip_tdf2_order8_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 473: benchmark_cascade_and_log(fp, "ellip_cascade_order8_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *ellip_cascade_order8_cut5000_f64_sos, 4); break;
+    case 474: benchmark_sos_and_log(fp, "ellip_cascade_order8_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *ellip_cascade_order8_cut5000_f64_sos, 4); break;
+    case 475: benchmark_and_log(fp, "ellip_df1_order8_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, ellip_df1_order8_cut5000_f32_ba[0], ellip_df1_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 476: benchmark_and_log(fp, "ellip_df2_order8_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, ellip_df2_order8_cut5000_f32_ba[0], ellip_df2_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 477: benchmark_and_log(fp, "ellip_tdf2_order8_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, ellip_tdf2_order8_cut5000_f32_ba[0], ellip_tdf2_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 478: benchmark_cascade_and_log(fp, "ellip_cascade_order8_cut5000_f32_sos", "float", CASCADE_f, NULL, *ellip_cascade_order8_cut5000_f32_sos, NULL, 4); break;
+    case 479: benchmark_sos_and_log(fp, "ellip_cascade_order8_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *ellip_cascade_order8_cut5000_f32_sos, NULL, 4); break;
+    case 480: benchmark_and_log(fp, "bessel_df1_order2_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], 3); break;
+    case 481: benchmark_and_log(fp, "bessel_df2_order2_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], 3); break;
+    case 482: benchmark_and_log(fp, "bessel_tdf2_order2_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], 3); break;
+    case 483: benchmark_cascade_and_log(fp, "bessel_cascade_order2_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order2_cut1000_f64_sos, 1); break;
+    case 484: benchmark_sos_and_log(fp, "bessel_cascade_order2_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *bessel_cascade_order2_cut1000_f64_sos, 1); break;
+    case 485: benchmark_and_log(fp, "bessel_df1_order2_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order2_cut1000_f32_ba[0], bessel_df1_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 486: benchmark_and_log(fp, "bessel_df2_order2_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order2_cut1000_f32_ba[0], bessel_df2_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 487: benchmark_and_log(fp, "bessel_tdf2_order2_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order2_cut1000_f32_ba[0], bessel_tdf2_order2_cut1000_f32_ba[1], NULL, NULL, 3); break;
+    case 488: benchmark_cascade_and_log(fp, "bessel_cascade_order2_cut1000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order2_cut1000_f32_sos, NULL, 1); break;
+    case 489: benchmark_sos_and_log(fp, "bessel_cascade_order2_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *bessel_cascade_order2_cut1000_f32_sos, NULL, 1); break;
+    case 490: benchmark_and_log(fp, "bessel_df1_order2_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], 3); break;
+    case 491: benchmark_and_log(fp, "bessel_df2_order2_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], 3); break;
+    case 492: benchmark_and_log(fp, "bessel_tdf2_order2_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], 3); break;
+    case 493: benchmark_cascade_and_log(fp, "bessel_cascade_order2_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order2_cut2000_f64_sos, 1); break;
+    case 494: benchmark_sos_and_log(fp, "bessel_cascade_order2_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *bessel_cascade_order2_cut2000_f64_sos, 1); break;
+    case 495: benchmark_and_log(fp, "bessel_df1_order2_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order2_cut2000_f32_ba[0], bessel_df1_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 496: benchmark_and_log(fp, "bessel_df2_order2_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order2_cut2000_f32_ba[0], bessel_df2_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 497: benchmark_and_log(fp, "bessel_tdf2_order2_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order2_cut2000_f32_ba[0], bessel_tdf2_order2_cut2000_f32_ba[1], NULL, NULL, 3); break;
+    case 498: benchmark_cascade_and_log(fp, "bessel_cascade_order2_cut2000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order2_cut2000_f32_sos, NULL, 1); break;
+    case 499: benchmark_sos_and_log(fp, "bessel_cascade_order2_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *bessel_cascade_order2_cut2000_f32_sos, NULL, 1); break;
+    case 500: benchmark_and_log(fp, "bessel_df1_order2_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], 3); break;
+    case 501: benchmark_and_log(fp, "bessel_df2_order2_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], 3); break;
+    case 502: benchmark_and_log(fp, "bessel_tdf2_order2_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], 3); break;
+    case 503: benchmark_cascade_and_log(fp, "bessel_cascade_order2_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order2_cut5000_f64_sos, 1); break;
+    case 504: benchmark_sos_and_log(fp, "bessel_cascade_order2_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *bessel_cascade_order2_cut5000_f64_sos, 1); break;
+    case 505: benchmark_and_log(fp, "bessel_df1_order2_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order2_cut5000_f32_ba[0], bessel_df1_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 506: benchmark_and_log(fp, "bessel_df2_order2_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order2_cut5000_f32_ba[0], bessel_df2_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 507: benchmark_and_log(fp, "bessel_tdf2_order2_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order2_cut5000_f32_ba[0], bessel_tdf2_order2_cut5000_f32_ba[1], NULL, NULL, 3); break;
+    case 508: benchmark_cascade_and_log(fp, "bessel_cascade_order2_cut5000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order2_cut5000_f32_sos, NULL, 1); break;
+    case 509: benchmark_sos_and_log(fp, "bessel_cascade_order2_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *bessel_cascade_order2_cut5000_f32_sos, NULL, 1); break;
+    case 510: benchmark_and_log(fp, "bessel_df1_order4_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], 5); break;
+    case 511: benchmark_and_log(fp, "bessel_df2_order4_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], 5); break;
+    case 512: benchmark_and_log(fp, "bessel_tdf2_order4_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], 5); break;
+    case 513: benchmark_cascade_and_log(fp, "bessel_cascade_order4_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order4_cut1000_f64_sos, 2); break;
+    case 514: benchmark_sos_and_log(fp, "bessel_cascade_order4_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *bessel_cascade_order4_cut1000_f64_sos, 2); break;
+    case 515: benchmark_and_log(fp, "bessel_df1_order4_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order4_cut1000_f32_ba[0], bessel_df1_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 516: benchmark_and_log(fp, "bessel_df2_order4_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order4_cut1000_f32_ba[0], bessel_df2_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 517: benchmark_and_log(fp, "bessel_tdf2_order4_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order4_cut1000_f32_ba[0], bessel_tdf2_order4_cut1000_f32_ba[1], NULL, NULL, 5); break;
+    case 518: benchmark_cascade_and_log(fp, "bessel_cascade_order4_cut1000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order4_cut1000_f32_sos, NULL, 2); break;
+    case 519: benchmark_sos_and_log(fp, "bessel_cascade_order4_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *bessel_cascade_order4_cut1000_f32_sos, NULL, 2); break;
+    case 520: benchmark_and_log(fp, "bessel_df1_order4_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], 5); break;
+    case 521: benchmark_and_log(fp, "bessel_df2_order4_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], 5); break;
+    case 522: benchmark_and_log(fp, "bessel_tdf2_order4_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], 5); break;
+    case 523: benchmark_cascade_and_log(fp, "bessel_cascade_order4_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order4_cut2000_f64_sos, 2); break;
+    case 524: benchmark_sos_and_log(fp, "bessel_cascade_order4_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *bessel_cascade_order4_cut2000_f64_sos, 2); break;
+    case 525: benchmark_and_log(fp, "bessel_df1_order4_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order4_cut2000_f32_ba[0], bessel_df1_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 526: benchmark_and_log(fp, "bessel_df2_order4_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order4_cut2000_f32_ba[0], bessel_df2_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 527: benchmark_and_log(fp, "bessel_tdf2_order4_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order4_cut2000_f32_ba[0], bessel_tdf2_order4_cut2000_f32_ba[1], NULL, NULL, 5); break;
+    case 528: benchmark_cascade_and_log(fp, "bessel_cascade_order4_cut2000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order4_cut2000_f32_sos, NULL, 2); break;
+    case 529: benchmark_sos_and_log(fp, "bessel_cascade_order4_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *bessel_cascade_order4_cut2000_f32_sos, NULL, 2); break;
+    case 530: benchmark_and_log(fp, "bessel_df1_order4_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], 5); break;
+    case 531: benchmark_and_log(fp, "bessel_df2_order4_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], 5); break;
+    case 532: benchmark_and_log(fp, "bessel_tdf2_order4_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], 5); break;
+    case 533: benchmark_cascade_and_log(fp, "bessel_cascade_order4_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order4_cut5000_f64_sos, 2); break;
+    case 534: benchmark_sos_and_log(fp, "bessel_cascade_order4_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *bessel_cascade_order4_cut5000_f64_sos, 2); break;
+    case 535: benchmark_and_log(fp, "bessel_df1_order4_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order4_cut5000_f32_ba[0], bessel_df1_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 536: benchmark_and_log(fp, "bessel_df2_order4_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order4_cut5000_f32_ba[0], bessel_df2_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 537: benchmark_and_log(fp, "bessel_tdf2_order4_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order4_cut5000_f32_ba[0], bessel_tdf2_order4_cut5000_f32_ba[1], NULL, NULL, 5); break;
+    case 538: benchmark_cascade_and_log(fp, "bessel_cascade_order4_cut5000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order4_cut5000_f32_sos, NULL, 2); break;
+    case 539: benchmark_sos_and_log(fp, "bessel_cascade_order4_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *bessel_cascade_order4_cut5000_f32_sos, NULL, 2); break;
+    case 540: benchmark_and_log(fp, "bessel_df1_order6_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], 7); break;
+    case 541: benchmark_and_log(fp, "bessel_df2_order6_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], 7); break;
+    case 542: benchmark_and_log(fp, "bessel_tdf2_order6_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], 7); break;
+    case 543: benchmark_cascade_and_log(fp, "bessel_cascade_order6_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order6_cut1000_f64_sos, 3); break;
+    case 544: benchmark_sos_and_log(fp, "bessel_cascade_order6_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *bessel_cascade_order6_cut1000_f64_sos, 3); break;
+    case 545: benchmark_and_log(fp, "bessel_df1_order6_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order6_cut1000_f32_ba[0], bessel_df1_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 546: benchmark_and_log(fp, "bessel_df2_order6_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order6_cut1000_f32_ba[0], bessel_df2_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 547: benchmark_and_log(fp, "bessel_tdf2_order6_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order6_cut1000_f32_ba[0], bessel_tdf2_order6_cut1000_f32_ba[1], NULL, NULL, 7); break;
+    case 548: benchmark_cascade_and_log(fp, "bessel_cascade_order6_cut1000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order6_cut1000_f32_sos, NULL, 3); break;
+    case 549: benchmark_sos_and_log(fp, "bessel_cascade_order6_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *bessel_cascade_order6_cut1000_f32_sos, NULL, 3); break;
+    case 550: benchmark_and_log(fp, "bessel_df1_order6_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], 7); break;
+    case 551: benchmark_and_log(fp, "bessel_df2_order6_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], 7); break;
+    case 552: benchmark_and_log(fp, "bessel_tdf2_order6_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], 7); break;
+    case 553: benchmark_cascade_and_log(fp, "bessel_cascade_order6_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order6_cut2000_f64_sos, 3); break;
+    case 554: benchmark_sos_and_log(fp, "bessel_cascade_order6_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *bessel_cascade_order6_cut2000_f64_sos, 3); break;
+    case 555: benchmark_and_log(fp, "bessel_df1_order6_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order6_cut2000_f32_ba[0], bessel_df1_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 556: benchmark_and_log(fp, "bessel_df2_order6_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order6_cut2000_f32_ba[0], bessel_df2_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 557: benchmark_and_log(fp, "bessel_tdf2_order6_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order6_cut2000_f32_ba[0], bessel_tdf2_order6_cut2000_f32_ba[1], NULL, NULL, 7); break;
+    case 558: benchmark_cascade_and_log(fp, "bessel_cascade_order6_cut2000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order6_cut2000_f32_sos, NULL, 3); break;
+    case 559: benchmark_sos_and_log(fp, "bessel_cascade_order6_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *bessel_cascade_order6_cut2000_f32_sos, NULL, 3); break;
+    case 560: benchmark_and_log(fp, "bessel_df1_order6_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], 7); break;
+    case 561: benchmark_and_log(fp, "bessel_df2_order6_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], 7); break;
+    case 562: benchmark_and_log(fp, "bessel_tdf2_order6_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], 7); break;
+    case 563: benchmark_cascade_and_log(fp, "bessel_cascade_order6_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order6_cut5000_f64_sos, 3); break;
+    case 564: benchmark_sos_and_log(fp, "bessel_cascade_order6_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *bessel_cascade_order6_cut5000_f64_sos, 3); break;
+    case 565: benchmark_and_log(fp, "bessel_df1_order6_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order6_cut5000_f32_ba[0], bessel_df1_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 566: benchmark_and_log(fp, "bessel_df2_order6_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order6_cut5000_f32_ba[0], bessel_df2_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 567: benchmark_and_log(fp, "bessel_tdf2_order6_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order6_cut5000_f32_ba[0], bessel_tdf2_order6_cut5000_f32_ba[1], NULL, NULL, 7); break;
+    case 568: benchmark_cascade_and_log(fp, "bessel_cascade_order6_cut5000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order6_cut5000_f32_sos, NULL, 3); break;
+    case 569: benchmark_sos_and_log(fp, "bessel_cascade_order6_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *bessel_cascade_order6_cut5000_f32_sos, NULL, 3); break;
+    case 570: benchmark_and_log(fp, "bessel_df1_order8_cut1000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], 9); break;
+    case 571: benchmark_and_log(fp, "bessel_df2_order8_cut1000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], 9); break;
+    case 572: benchmark_and_log(fp, "bessel_tdf2_order8_cut1000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], 9); break;
+    case 573: benchmark_cascade_and_log(fp, "bessel_cascade_order8_cut1000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order8_cut1000_f64_sos, 4); break;
+    case 574: benchmark_sos_and_log(fp, "bessel_cascade_order8_cut1000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *bessel_cascade_order8_cut1000_f64_sos, 4); break;
+    case 575: benchmark_and_log(fp, "bessel_df1_order8_cut1000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order8_cut1000_f32_ba[0], bessel_df1_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 576: benchmark_and_log(fp, "bessel_df2_order8_cut1000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order8_cut1000_f32_ba[0], bessel_df2_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 577: benchmark_and_log(fp, "bessel_tdf2_order8_cut1000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order8_cut1000_f32_ba[0], bessel_tdf2_order8_cut1000_f32_ba[1], NULL, NULL, 9); break;
+    case 578: benchmark_cascade_and_log(fp, "bessel_cascade_order8_cut1000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order8_cut1000_f32_sos, NULL, 4); break;
+    case 579: benchmark_sos_and_log(fp, "bessel_cascade_order8_cut1000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *bessel_cascade_order8_cut1000_f32_sos, NULL, 4); break;
+    case 580: benchmark_and_log(fp, "bessel_df1_order8_cut2000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], 9); break;
+    case 581: benchmark_and_log(fp, "bessel_df2_order8_cut2000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], 9); break;
+    case 582: benchmark_and_log(fp, "bessel_tdf2_order8_cut2000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], 9); break;
+    case 583: benchmark_cascade_and_log(fp, "bessel_cascade_order8_cut2000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order8_cut2000_f64_sos, 4); break;
+    case 584: benchmark_sos_and_log(fp, "bessel_cascade_order8_cut2000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *bessel_cascade_order8_cut2000_f64_sos, 4); break;
+    case 585: benchmark_and_log(fp, "bessel_df1_order8_cut2000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order8_cut2000_f32_ba[0], bessel_df1_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 586: benchmark_and_log(fp, "bessel_df2_order8_cut2000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order8_cut2000_f32_ba[0], bessel_df2_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 587: benchmark_and_log(fp, "bessel_tdf2_order8_cut2000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order8_cut2000_f32_ba[0], bessel_tdf2_order8_cut2000_f32_ba[1], NULL, NULL, 9); break;
+    case 588: benchmark_cascade_and_log(fp, "bessel_cascade_order8_cut2000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order8_cut2000_f32_sos, NULL, 4); break;
+    case 589: benchmark_sos_and_log(fp, "bessel_cascade_order8_cut2000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *bessel_cascade_order8_cut2000_f32_sos, NULL, 4); break;
+    case 590: benchmark_and_log(fp, "bessel_df1_order8_cut5000_f64_ba", "double", "DF1", NULL, DF1_d, NULL, NULL, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], 9); break;
+    case 591: benchmark_and_log(fp, "bessel_df2_order8_cut5000_f64_ba", "double", "DF2", NULL, DF2_d, NULL, NULL, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], 9); break;
+    case 592: benchmark_and_log(fp, "bessel_tdf2_order8_cut5000_f64_ba", "double", "TDF2", NULL, TDF2_d, NULL, NULL, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], 9); break;
+    case 593: benchmark_cascade_and_log(fp, "bessel_cascade_order8_cut5000_f64_sos", "double", NULL, CASCADE_d, NULL, *bessel_cascade_order8_cut5000_f64_sos, 4); break;
+    case 594: benchmark_sos_and_log(fp, "bessel_cascade_order8_cut5000_f64_sos", "double", "BLOCKSS", NULL, BLOCKSS_d, NULL, *bessel_cascade_order8_cut5000_f64_sos, 4); break;
+    case 595: benchmark_and_log(fp, "bessel_df1_order8_cut5000_f32_ba", "float", "DF1", DF1_f, NULL, bessel_df1_order8_cut5000_f32_ba[0], bessel_df1_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 596: benchmark_and_log(fp, "bessel_df2_order8_cut5000_f32_ba", "float", "DF2", DF2_f, NULL, bessel_df2_order8_cut5000_f32_ba[0], bessel_df2_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 597: benchmark_and_log(fp, "bessel_tdf2_order8_cut5000_f32_ba", "float", "TDF2", TDF2_f, NULL, bessel_tdf2_order8_cut5000_f32_ba[0], bessel_tdf2_order8_cut5000_f32_ba[1], NULL, NULL, 9); break;
+    case 598: benchmark_cascade_and_log(fp, "bessel_cascade_order8_cut5000_f32_sos", "float", CASCADE_f, NULL, *bessel_cascade_order8_cut5000_f32_sos, NULL, 4); break;
+    case 599: benchmark_sos_and_log(fp, "bessel_cascade_order8_cut5000_f32_sos", "float", "BLOCKSS", BLOCKSS_f, NULL, *bessel_cascade_order8_cut5000_f32_sos, NULL, 4); break;
+    default: return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    timing_init();
+    printf("[LOG] Timer: %s, %.3f MHz, overhead %.1f ns, resolution %.1f ns\n", timing_source_name(),
+           timing_frequency() / 1e6, timing_overhead_ns(), timing_resolution_ns());
+    perf_init();
+    argc = bench_parse_args(argc, argv, FS, 60.0 * DURATION_MIN);
+    N = bench.n;
+
+    if (argc > 1 && strcmp(argv[1], "alloc") == 0)
+        return run_alloc_benchmark();
+    if (argc > 1 && strcmp(argv[1], "tile") == 0)
+        return run_tile_benchmark();
+    if (argc > 1 && strcmp(argv[1], "mc") == 0)
+        return run_mc_benchmark();
+    if (argc > 1 && strcmp(argv[1], "par") == 0)
+        return run_par_benchmark(argc > 2 ? atoi(argv[2]) : 0);
+    if (argc > 1 && strcmp(argv[1], "spec") == 0)
+        return run_spec_benchmark();
+    if (argc > 1 && strcmp(argv[1], "baked") == 0)
+        return run_baked_benchmark();
+    if (argc > 1 && strcmp(argv[1], "rtspec") == 0)
+        return run_rtspec_benchmark();
+    if (argc > 1 && strcmp(argv[1], "denormal") == 0)
+        return run_denormal_benchmark();
+    if (argc > 1 && strcmp(argv[1], "sweep") == 0)
+        return run_sweep_benchmark();
+    if (argc > 1 && strcmp(argv[1], "latency") == 0)
+        return run_latency_benchmark();
+    if (argc > 1 && strcmp(argv[1], "rtsim") == 0)
+        return run_rtsim_benchmark(argc, argv);
+
+    FILE *fp = fopen("c_floating_time_results.csv", "w");
+    if (!fp) {
+        perror("Can't open CSV file");
+        return 1;
+    }
+
+    fprintf(fp, "filter_name,type,structure,cutoff,order,time_seconds" BENCH_CSV_HEADER PERF_CSV_HEADER "\n");
+    
+    FILE *fp_summary = fopen("c_floating_time_summary.csv", "w");
+    if (!fp_summary) {
+        perror("Can't open summary CSV file");
+        fclose(fp);
+        return 1;
+    }
+
+    runner_run(fp, fp_summary, "filter_name,type,structure,cutoff,order", run_config);
+
+    fclose(fp_summary);
     
     
 
     fclose(fp);
+    pool_release();
     return 0;
 }
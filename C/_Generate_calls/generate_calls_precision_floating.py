@@ -65,6 +65,12 @@ for base_name, variants in groups.items():
             f'precision_analysis_cascade(fp_precision, "{base_name}", {func_f}, {func_d}, '
             f'(float*){dtype_f}, (double*){dtype_d}, {sections});'
         )
+        output_lines.append(line)
+        # Ta sama macierz SOS w postaci blokowej przestrzeni stanów
+        line = (
+            f'precision_analysis_sos(fp_precision, "{base_name}", "BLOCKSS", BLOCKSS_f, BLOCKSS_d, '
+            f'(float*){dtype_f}, (double*){dtype_d}, {sections});'
+        )
     else:
         line = (
             f'precision_analysis(fp_precision, "{base_name}", "{struct}", {func_f}, {func_d}, '
@@ -52,6 +52,14 @@ for line in lines:
             line = f'benchmark_cascade_and_log(fp, "{name}", "{dtype}", {func_name}, NULL, *{name}, NULL, {sections});'
         else:  # double
             line = f'benchmark_cascade_and_log(fp, "{name}", "{dtype}", NULL, {func_name}, NULL, *{name}, {sections});'
+        output_lines.append(line)
+
+        # Ta sama macierz SOS w postaci blokowej przestrzeni stanów
+        blockss = func_name.replace("CASCADE", "BLOCKSS")
+        if dtype == "float":
+            line = f'benchmark_sos_and_log(fp, "{name}", "{dtype}", "BLOCKSS", {blockss}, NULL, *{name}, NULL, {sections});'
+        else:
+            line = f'benchmark_sos_and_log(fp, "{name}", "{dtype}", "BLOCKSS", NULL, {blockss}, NULL, *{name}, {sections});'
     else:
         if dtype == "float":
             b_f = f"{name}[0]"
@@ -66,6 +74,9 @@ for line in lines:
 
     output_lines.append(line)
 
+# Każde wywołanie jako osobny przypadek run_config (runner.h losuje ich kolejność)
+output_lines = [f"case {i}: {line} break;" for i, line in enumerate(output_lines)]
+
 with open(output_filename, "w") as f:
     f.write("\n".join(output_lines))
 
@@ -0,0 +1,65 @@
+#include <stdlib.h>
+#include <string.h>
+#include "benchparams.h"
+#include "timing.h"
+
+bench_params bench = { 0, 0, 0, 0 };
+
+// === Linia poleceń ===
+static int parse_int(const char *arg, const char *key, int *out) {
+    size_t len = strlen(key);
+    if (strncmp(arg, key, len) != 0 || arg[len] != '=') return 0;
+    *out = atoi(arg + len + 1);
+    return 1;
+}
+
+int bench_parse_args(int argc, char **argv, int default_fs, double default_seconds) {
+    int n = 0, fs = default_fs, block = 0, flags = 0;
+    int out = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *a = argv[i];
+        if (parse_int(a, "n", &n) || parse_int(a, "fs", &fs) || parse_int(a, "block", &block)) continue;
+        if (strcmp(a, "thp") == 0) { flags |= POOL_THP; continue; }
+        if (strcmp(a, "hugetlb") == 0) { flags |= POOL_HUGETLB; continue; }
+        if (strcmp(a, "mlock") == 0) { flags |= POOL_MLOCK; continue; }
+        argv[out++] = argv[i];
+    }
+    argv[out] = NULL;
+
+    if (fs <= 0) fs = default_fs;
+    if (n <= 0) n = (int)(fs * default_seconds);
+    if (block < 0) block = 0;
+
+    bench.n = n;
+    bench.fs = fs;
+    bench.block = block;
+    bench.pool_flags = flags;
+    pool_init(flags);
+
+    printf("[LOG] Run: n=%d, fs=%d, block=%d, buffers %s\n", n, fs, block, pool_mode_name());
+    return out;
+}
+
+// === CSV ===
+void bench_fprint_columns(FILE *fp, double seconds, bench_block_mode mode,
+                          const pool_faults *before, const pool_faults *after) {
+    const char *block_mode = bench_step(bench.n) >= bench.n ? "whole" : (mode == BLOCK_STREAM ? "stream" : "restart");
+    fprintf(fp, ",%d,%d,%d,%s", bench.n, bench.fs, bench.block, block_mode);
+
+    if (seconds > 0.0 && bench.n > 0) {
+        fprintf(fp, ",%.4f", seconds * 1e9 / bench.n);
+        if (timing_src == TIMING_SRC_TSC) fprintf(fp, ",%.4f", seconds * timing_frequency() / bench.n);
+        else fprintf(fp, ",");
+        fprintf(fp, ",%.1f", bench.n / seconds);
+    } else {
+        fprintf(fp, ",,,");
+    }
+
+    fprintf(fp, ",%.1f", timing_overhead_ns());
+
+    if (before->minor >= 0 && after->minor >= 0)
+        fprintf(fp, ",%ld,%ld", after->minor - before->minor, after->major - before->major);
+    else
+        fprintf(fp, ",,");
+}
@@ -0,0 +1,44 @@
+#ifndef BENCHPARAMS_H
+#define BENCHPARAMS_H
+
+#include <stdio.h>
+#include "bufpool.h"
+
+// Parametry przebiegu programów TimeAnalysis, podawane w linii poleceń obok trybu:
+//   n=<próbki>      długość sygnału (domyślnie fs * czas domyślny programu)
+//   fs=<Hz>         częstotliwość próbkowania (zapisywana w CSV, wyznacza domyślne n)
+//   block=<próbki>  sygnał podawany jądru w blokach tej długości (0 - całość naraz);
+//                   mierzy też koszt wywołania. Kolumna block_mode: stream - stan zachowany
+//                   między blokami (streaming.h), restart - każdy blok od zerowego stanu
+//                   (jądra bez wersji strumieniowej; stany przejściowe na początku bloków)
+//   thp / hugetlb / mlock - opcje puli buforów (bufpool.h)
+// np. ./TimeAnalysis n=480000 fs=96000 block=256 thp
+
+typedef struct {
+    int n;
+    int fs;
+    int block;
+    int pool_flags;
+} bench_params;
+
+extern bench_params bench;
+
+// Usuwa rozpoznane opcje z argv (argv[1] zostaje trybem) i zwraca nowe argc
+int bench_parse_args(int argc, char **argv, int default_fs, double default_seconds);
+
+// Długość bloku dla pętli po sygnale długości n
+static inline int bench_step(int n) {
+    return (bench.block > 0 && bench.block < n) ? bench.block : n;
+}
+
+// Kolumny CSV (dopisywane po time_seconds, z przecinkiem na początku).
+// tsc_cycles_per_sample tylko przy źródle tsc (cykle zegara odniesienia, nie rdzenia).
+// block_mode "whole", gdy sygnał szedł jednym wywołaniem.
+typedef enum { BLOCK_RESTART, BLOCK_STREAM } bench_block_mode;
+
+#define BENCH_CSV_HEADER ",n,fs,block,block_mode,ns_per_sample,tsc_cycles_per_sample,samples_per_sec,timer_overhead_ns" \
+                         ",minor_faults,major_faults"
+void bench_fprint_columns(FILE *fp, double seconds, bench_block_mode mode,
+                          const pool_faults *before, const pool_faults *after);
+
+#endif // BENCHPARAMS_H
@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bufpool.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/resource.h>
+#define POOL_MMAP 1
+#define POOL_HUGE_PAGE (2u << 20)
+#elif !defined(_WIN32)
+#include <sys/resource.h>
+#else
+#include <malloc.h>
+#endif
+
+typedef struct {
+    void *p;
+    size_t mapped;   // rozmiar przydziału (>= żądany)
+} pool_slot;
+
+static pool_slot slots[POOL_SLOTS];
+static int pool_flags = 0;
+
+void pool_init(int flags) {
+    pool_flags = flags;
+}
+
+const char *pool_mode_name(void) {
+    static char name[32];
+    snprintf(name, sizeof(name), "%s%s",
+             (pool_flags & POOL_HUGETLB) ? "hugetlb" : (pool_flags & POOL_THP) ? "thp" : "4k",
+             (pool_flags & POOL_MLOCK) ? "+mlock" : "");
+    return name;
+}
+
+// === Przydział ===
+static void slot_free(pool_slot *s) {
+    if (!s->p) return;
+#ifdef POOL_MMAP
+    munmap(s->p, s->mapped);
+#elif defined(_WIN32)
+    _aligned_free(s->p);
+#else
+    free(s->p);
+#endif
+    s->p = NULL;
+    s->mapped = 0;
+}
+
+static int slot_alloc(pool_slot *s, size_t bytes) {
+#ifdef POOL_MMAP
+    size_t huge = (bytes + POOL_HUGE_PAGE - 1) & ~(size_t)(POOL_HUGE_PAGE - 1);
+    void *p = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+    if (pool_flags & POOL_HUGETLB) {
+        p = mmap(NULL, huge, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p == MAP_FAILED)
+            printf("[POOL] MAP_HUGETLB failed for %zu bytes, using regular pages\n", bytes);
+        else
+            s->mapped = huge;
+    }
+#endif
+    if (p == MAP_FAILED) {
+        // Przy THP rozmiar zaokrąglony do dużej strony, żeby koniec bufora też mógł nią być
+        s->mapped = (pool_flags & POOL_THP) ? huge : bytes;
+        p = mmap(NULL, s->mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) return -1;
+#ifdef MADV_HUGEPAGE
+        if (pool_flags & POOL_THP) madvise(p, s->mapped, MADV_HUGEPAGE);
+#endif
+    }
+#elif defined(_WIN32)
+    void *p = _aligned_malloc(bytes, POOL_ALIGN);
+    if (!p) return -1;
+    s->mapped = bytes;
+#else
+    void *p = NULL;
+    if (posix_memalign(&p, POOL_ALIGN, bytes) != 0) return -1;
+    s->mapped = bytes;
+#endif
+
+    // Wstępne dotknięcie wszystkich stron (zapis, więc strony są prywatne, nie współdzielona strona zer)
+    memset(p, 0, s->mapped);
+
+#ifdef POOL_MMAP
+    if ((pool_flags & POOL_MLOCK) && mlock(p, s->mapped) != 0)
+        perror("[POOL] mlock");
+#endif
+
+    s->p = p;
+    return 0;
+}
+
+void *pool_buffer(int slot, size_t bytes) {
+    if (slot < 0 || slot >= POOL_SLOTS) return NULL;
+    pool_slot *s = &slots[slot];
+
+    if (bytes == 0) bytes = 1;
+    if (s->p && s->mapped >= bytes) return s->p;
+
+    slot_free(s);
+    if (slot_alloc(s, bytes) != 0) {
+        fprintf(stderr, "[POOL] Can't allocate %zu bytes for slot %d\n", bytes, slot);
+        exit(1);
+    }
+    return s->p;
+}
+
+void *pool_zeroed(int slot, size_t bytes) {
+    void *p = pool_buffer(slot, bytes);
+    memset(p, 0, bytes);
+    return p;
+}
+
+void pool_release(void) {
+    for (int i = 0; i < POOL_SLOTS; ++i) slot_free(&slots[i]);
+}
+
+// === Błędy stron ===
+void pool_faults_now(pool_faults *f) {
+#ifndef _WIN32
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) == 0) {
+        f->minor = ru.ru_minflt;
+        f->major = ru.ru_majflt;
+        return;
+    }
+#endif
+    f->minor = -1;
+    f->major = -1;
+}
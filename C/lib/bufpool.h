@@ -0,0 +1,39 @@
+#ifndef BUFPOOL_H
+#define BUFPOOL_H
+
+#include <stddef.h>
+
+// Pula buforów sygnałów wspólna dla programów TimeAnalysis i PrecisionAnalysis.
+// Bufor wybierany numerem slotu; przydzielany raz (ponownie tylko, gdy potrzeba większego),
+// wyrównany co najmniej do POOL_ALIGN bajtów i wstępnie zapisany w całości, więc
+// błędy stron pierwszego dotknięcia nie trafiają do mierzonego czasu.
+// Opcje (pool_init, w TimeAnalysis z linii poleceń):
+//   POOL_THP     - madvise(MADV_HUGEPAGE), przezroczyste duże strony (Linux)
+//   POOL_HUGETLB - mmap(MAP_HUGETLB), jawne duże strony z puli jądra; przy braku
+//                  wolnych stron powrót do zwykłych stron z komunikatem
+//   POOL_MLOCK   - mlock() buforów (błąd, np. przez RLIMIT_MEMLOCK, tylko zgłaszany)
+
+#define POOL_ALIGN 64
+#define POOL_SLOTS 8
+
+enum { POOL_THP = 1, POOL_HUGETLB = 2, POOL_MLOCK = 4 };
+
+// Umowne przydziały slotów
+enum { POOL_X = 0, POOL_Y = 1, POOL_X2 = 2, POOL_Y2 = 3, POOL_TMP = 4 };
+
+void pool_init(int flags);
+void *pool_buffer(int slot, size_t bytes);   // zawartość nieokreślona (poprzednie dane)
+void *pool_zeroed(int slot, size_t bytes);   // zamiast calloc: wyzerowane bytes bajtów
+void pool_release(void);
+const char *pool_mode_name(void);
+
+// === Liczniki błędów stron (getrusage) ===
+// Na Windows pola mają wartość -1 (kolumny CSV zostają puste).
+typedef struct {
+    long minor;
+    long major;
+} pool_faults;
+
+void pool_faults_now(pool_faults *f);
+
+#endif // BUFPOOL_H
@@ -0,0 +1,85 @@
+#include <float.h>
+#include <math.h>
+#include "denormal.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <xmmintrin.h>
+#define DENORMAL_X86 1
+#define MXCSR_DAZ 0x0040u
+#define MXCSR_FTZ 0x8000u
+#elif defined(__aarch64__)
+#define DENORMAL_ARM64 1
+#define FPCR_FZ (1ull << 24)
+#endif
+
+int denormal_ftz_supported(void) {
+#if defined(DENORMAL_X86) || defined(DENORMAL_ARM64)
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+const char *denormal_mode_name(denormal_mode mode) {
+    switch (mode) {
+    case DENORMAL_FTZ: return "ftz";
+    case DENORMAL_OFFSET: return "offset";
+    default: return "none";
+    }
+}
+
+// === Tryb FPU ===
+void denormal_enter(denormal_mode mode, denormal_state *st) {
+    st->changed = 0;
+    if (mode != DENORMAL_FTZ) return;
+
+#if defined(DENORMAL_X86)
+    unsigned int csr = _mm_getcsr();
+    st->saved = csr;
+    _mm_setcsr(csr | MXCSR_FTZ | MXCSR_DAZ);
+    st->changed = 1;
+#elif defined(DENORMAL_ARM64)
+    unsigned long long fpcr;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+    st->saved = fpcr;
+    fpcr |= FPCR_FZ;
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+    st->changed = 1;
+#endif
+}
+
+void denormal_leave(denormal_state *st) {
+    if (!st->changed) return;
+
+#if defined(DENORMAL_X86)
+    _mm_setcsr((unsigned int)st->saved);
+#elif defined(DENORMAL_ARM64)
+    unsigned long long fpcr = st->saved;
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+#endif
+    st->changed = 0;
+}
+
+// === Offset ===
+void denormal_offset_f(float *x, int n) {
+    for (int i = 0; i < n; ++i) x[i] += DENORMAL_OFFSET_F;
+}
+
+void denormal_offset_d(double *x, int n) {
+    for (int i = 0; i < n; ++i) x[i] += DENORMAL_OFFSET_D;
+}
+
+// === Zliczanie ===
+long denormal_count_f(const float *x, int n) {
+    long count = 0;
+    for (int i = 0; i < n; ++i)
+        if (x[i] != 0.0f && fabsf(x[i]) < FLT_MIN) ++count;
+    return count;
+}
+
+long denormal_count_d(const double *x, int n) {
+    long count = 0;
+    for (int i = 0; i < n; ++i)
+        if (x[i] != 0.0 && fabs(x[i]) < DBL_MIN) ++count;
+    return count;
+}
@@ -0,0 +1,41 @@
+#ifndef DENORMAL_H
+#define DENORMAL_H
+
+// Obsługa liczb podnormalnych wokół wywołań jąder zmiennoprzecinkowych.
+// Ogon odpowiedzi IIR na impuls / ciszę schodzi do liczb podnormalnych, a działania na nich
+// są na wielu procesorach wielokrotnie wolniejsze (mikrokod).
+// Tryby:
+//   DENORMAL_NONE   - bez zmian
+//   DENORMAL_FTZ    - x86: MXCSR FTZ + DAZ; ARM64: FPCR.FZ; poza tym jak NONE
+//                     (denormal_ftz_supported() == 0). Ustawienie dotyczy bieżącego wątku.
+//   DENORMAL_OFFSET - do wejścia dodawana stała DENORMAL_OFFSET_F / _D; stan filtru ustala
+//                     się na poziomie offset * wzmocnienie, daleko od zakresu podnormalnego.
+//                     Dla sygnału rzędu 1 offset ginie w zaokrągleniu; na wyjściu zostaje
+//                     składowa stała offset * wzmocnienie DC filtru.
+
+#define DENORMAL_OFFSET_F 1e-20f
+#define DENORMAL_OFFSET_D 1e-20
+
+typedef enum { DENORMAL_NONE, DENORMAL_FTZ, DENORMAL_OFFSET, DENORMAL_MODES } denormal_mode;
+
+typedef struct {
+    unsigned long long saved;
+    int changed;
+} denormal_state;
+
+int denormal_ftz_supported(void);
+const char *denormal_mode_name(denormal_mode mode);
+
+// DENORMAL_FTZ: zapamiętuje i ustawia tryb FPU; pozostałe tryby nic nie zmieniają
+void denormal_enter(denormal_mode mode, denormal_state *st);
+void denormal_leave(denormal_state *st);
+
+// DENORMAL_OFFSET: x += offset (w miejscu)
+void denormal_offset_f(float *x, int n);
+void denormal_offset_d(double *x, int n);
+
+// Liczba próbek podnormalnych (różnych od zera i mniejszych od najmniejszej normalnej)
+long denormal_count_f(const float *x, int n);
+long denormal_count_d(const double *x, int n);
+
+#endif // DENORMAL_H
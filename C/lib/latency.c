@@ -0,0 +1,87 @@
+#include <string.h>
+#include "latency.h"
+#include "timing.h"
+
+// === Indeksy kubełków ===
+// v < 2S: indeks v (szerokość 1); dalej e = msb(v) - LAT_SUB_BITS, indeks e * S + (v >> e),
+// gdzie v >> e leży w [S, 2S) - kolejne przedziały potęg 2 stykają się bez luk.
+static inline int msb64(uint64_t v) {
+    int r = 0;
+    while (v >>= 1) ++r;
+    return r;
+}
+
+static int bucket_index(uint64_t v) {
+    if (v < 2 * LAT_SUB_BUCKETS) return (int)v;
+    int e = msb64(v) - LAT_SUB_BITS;
+    int i = e * LAT_SUB_BUCKETS + (int)(v >> e);
+    return i < LAT_BUCKETS ? i : LAT_BUCKETS - 1;
+}
+
+uint64_t lat_bucket_low(int i) {
+    if (i < 2 * LAT_SUB_BUCKETS) return (uint64_t)i;
+    int e = i / LAT_SUB_BUCKETS - 1;
+    return (uint64_t)(i - e * LAT_SUB_BUCKETS) << e;
+}
+
+uint64_t lat_bucket_high(int i) {
+    if (i < 2 * LAT_SUB_BUCKETS) return (uint64_t)i;
+    int e = i / LAT_SUB_BUCKETS - 1;
+    return lat_bucket_low(i) + ((uint64_t)1 << e) - 1;
+}
+
+// === Zapis ===
+void lat_reset(lat_hist *h) {
+    memset(h, 0, sizeof(*h));
+    h->min = UINT64_MAX;
+}
+
+void lat_record(lat_hist *h, double ns) {
+    uint64_t v = ns > 0.0 ? (uint64_t)(ns + 0.5) : 0;
+    h->count[bucket_index(v)]++;
+    h->total++;
+    h->sum += ns;
+    if (v < h->min) h->min = v;
+    if (v > h->max) h->max = v;
+}
+
+// === Statystyki ===
+uint64_t lat_quantile(const lat_hist *h, double q) {
+    if (h->total == 0) return 0;
+
+    uint64_t rank = (uint64_t)(q * h->total + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > h->total) rank = h->total;
+
+    uint64_t seen = 0;
+    for (int i = 0; i < LAT_BUCKETS; ++i) {
+        seen += h->count[i];
+        if (seen >= rank) {
+            uint64_t v = lat_bucket_high(i);
+            return v < h->max ? v : h->max;
+        }
+    }
+    return h->max;
+}
+
+double lat_mean(const lat_hist *h) {
+    return h->total ? h->sum / h->total : 0.0;
+}
+
+// === CSV ===
+void lat_fprint_summary(FILE *fp, const lat_hist *h) {
+    fprintf(fp, ",%llu,%llu,%llu,%llu,%llu,%llu,%llu,%.1f,%.1f",
+            (unsigned long long)h->total, (unsigned long long)(h->total ? h->min : 0),
+            (unsigned long long)lat_quantile(h, 0.5), (unsigned long long)lat_quantile(h, 0.9),
+            (unsigned long long)lat_quantile(h, 0.99), (unsigned long long)lat_quantile(h, 0.999),
+            (unsigned long long)h->max, lat_mean(h), timing_overhead_ns());
+}
+
+void lat_fprint_buckets(FILE *fp, const char *key, const lat_hist *h) {
+    for (int i = 0; i < LAT_BUCKETS; ++i) {
+        if (h->count[i] == 0) continue;
+        uint64_t lo = lat_bucket_low(i), hi = lat_bucket_high(i);
+        fprintf(fp, "%s,%.4e,%llu,%llu,%llu\n", key, (lo + hi) * 0.5e-9, (unsigned long long)h->count[i],
+                (unsigned long long)lo, (unsigned long long)hi);
+    }
+}
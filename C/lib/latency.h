@@ -0,0 +1,48 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+// Histogram czasów pojedynczych bloków (tryb latency programów TimeAnalysis).
+// Układ jak w HdrHistogram: przedziały logarytmiczne (potęgi 2), każdy podzielony na
+// LAT_SUB_BUCKETS równych części. Do 2 * LAT_SUB_BUCKETS ns szerokość kubełka to 1 ns,
+// dalej błąd względny wartości jest nie większy niż 1 / LAT_SUB_BUCKETS (~1.6%).
+// Zakres do 2^LAT_MAX_BITS ns (~68 s), większe wartości trafiają do ostatniego kubełka.
+// Pamięć stała (LAT_BUCKETS liczników), zapis O(1) - można zapisać miliony bloków.
+
+#define LAT_SUB_BITS    6
+#define LAT_SUB_BUCKETS (1 << LAT_SUB_BITS)
+#define LAT_MAX_BITS    36
+#define LAT_BUCKETS     ((LAT_MAX_BITS - LAT_SUB_BITS + 1) * LAT_SUB_BUCKETS)
+
+typedef struct {
+    uint64_t count[LAT_BUCKETS];
+    uint64_t total;
+    uint64_t min, max;   // dokładne wartości skrajne [ns]
+    double sum;          // do średniej [ns]
+} lat_hist;
+
+void lat_reset(lat_hist *h);
+void lat_record(lat_hist *h, double ns);
+
+// Wartość, poniżej której (włącznie) jest ułamek q zapisów, q w [0, 1].
+// Zwraca górną granicę kubełka (jak HdrHistogram), ale nie więcej niż max.
+uint64_t lat_quantile(const lat_hist *h, double q);
+double lat_mean(const lat_hist *h);
+
+// Granice kubełka i: [lat_bucket_low(i), lat_bucket_high(i)] w ns
+uint64_t lat_bucket_low(int i);
+uint64_t lat_bucket_high(int i);
+
+// === CSV ===
+// Podsumowanie (dopisywane po kolumnach konfiguracji, z przecinkiem na początku)
+#define LAT_SUMMARY_CSV_HEADER ",blocks,min_ns,p50_ns,p90_ns,p99_ns,p999_ns,max_ns,mean_ns,timer_overhead_ns"
+void lat_fprint_summary(FILE *fp, const lat_hist *h);
+
+// Histogram: jeden wiersz na niepusty kubełek, key - kolumny konfiguracji (bez przecinka na końcu).
+// time_seconds to środek kubełka, count jego liczebność (wagi dla TimeHistogram.py).
+#define LAT_HIST_CSV_HEADER ",time_seconds,count,bucket_low_ns,bucket_high_ns"
+void lat_fprint_buckets(FILE *fp, const char *key, const lat_hist *h);
+
+#endif // LATENCY_H
@@ -0,0 +1,285 @@
+#include "multichannel.h"
+#include <stddef.h>
+#include <string.h>
+
+#define MC_TILE 256  // kafel (próbki na kanał) dla układu MC_PLANAR
+
+// ========================= float =========================
+
+typedef float mc_vf __attribute__((vector_size(MC_LANES_F * sizeof(float))));
+
+// Odczyt/zapis w kanałów (w <= MC_LANES_F); niepełna grupa uzupełniana zerami
+static inline mc_vf load_f(const float *p, int w) {
+    mc_vf v = {0};
+    if (w == MC_LANES_F) memcpy(&v, p, sizeof(v));
+    else memcpy(&v, p, sizeof(float) * w);
+    return v;
+}
+
+static inline void store_f(float *p, mc_vf v, int w) {
+    if (w == MC_LANES_F) memcpy(p, &v, sizeof(v));
+    else memcpy(p, &v, sizeof(float) * w);
+}
+
+// Jądra grupowe: jedna grupa MC_LANES_F kanałów, próbki co stride elementów.
+// Stan st (wyzerowany przez wywołującego) przenoszony jest między wywołaniami.
+// Dozwolone x == y.
+static void DF1_group_f(mc_vf *st, float *x, float *y, int frames, int stride, int w, float *b, float *a, int order) {
+    mc_vf *xh = st;          // xh[i] = x[n - i]
+    mc_vf *yh = st + order;  // yh[i] = y[n - i]
+
+    for (int n = 0; n < frames; ++n) {
+        for (int i = order - 1; i > 0; --i)
+            xh[i] = xh[i - 1];
+        xh[0] = load_f(x + (size_t)n * stride, w);
+
+        mc_vf yn = {0};
+        for (int i = 0; i < order; ++i) {
+            yn += b[i] * xh[i];
+            if (i > 0) yn -= a[i] * yh[i];
+        }
+
+        for (int i = order - 1; i > 1; --i)
+            yh[i] = yh[i - 1];
+        yh[1] = yn;
+        store_f(y + (size_t)n * stride, yn, w);
+    }
+}
+
+static void DF2_group_f(mc_vf *w_st, float *x, float *y, int frames, int stride, int w, float *b, float *a, int order) {
+    for (int n = 0; n < frames; ++n) {
+        mc_vf w0 = load_f(x + (size_t)n * stride, w);
+        for (int i = 1; i < order; ++i)
+            w0 -= a[i] * w_st[i];
+        w_st[0] = w0;
+
+        mc_vf yn = {0};
+        for (int i = 0; i < order; ++i)
+            yn += b[i] * w_st[i];
+        store_f(y + (size_t)n * stride, yn, w);
+
+        for (int i = order - 1; i > 0; --i)
+            w_st[i] = w_st[i - 1];
+    }
+}
+
+static void TDF2_group_f(mc_vf *w_st, float *x, float *y, int frames, int stride, int w, float *b, float *a, int order) {
+    for (int n = 0; n < frames; ++n) {
+        mc_vf xn = load_f(x + (size_t)n * stride, w);
+        mc_vf yn = w_st[0] + b[0] * xn;
+
+        for (int i = 0; i < order - 2; ++i)
+            w_st[i] = w_st[i + 1] + b[i + 1] * xn - a[i + 1] * yn;
+        w_st[order - 2] = b[order - 1] * xn - a[order - 1] * yn;
+
+        store_f(y + (size_t)n * stride, yn, w);
+    }
+}
+
+// Próbka przechodzi przez wszystkie sekcje od razu - stan sekcji zostaje w rejestrach
+// Wspólna sygnatura z pozostałymi jądrami: sos przekazywane jako b, sections jako order
+static void CASCADE_group_f(mc_vf *st, float *x, float *y, int frames, int stride, int w, float *sos, float *a, int sections) {
+    (void)a;
+    mc_vf *w1 = st;
+    mc_vf *w2 = st + sections;
+
+    for (int n = 0; n < frames; ++n) {
+        mc_vf v = load_f(x + (size_t)n * stride, w);
+        for (int s = 0; s < sections; ++s) {
+            float *c = sos + s * 6;
+            mc_vf wn = v - c[4] * w1[s] - c[5] * w2[s];
+            v = c[0] * wn + c[1] * w1[s] + c[2] * w2[s];
+            w2[s] = w1[s];
+            w1[s] = wn;
+        }
+        store_f(y + (size_t)n * stride, v, w);
+    }
+}
+
+// Wspólny szkielet: grupy po MC_LANES_F kanałów. Dla MC_PLANAR kafle MC_TILE próbek
+// przepisywane są do bufora z przeplotem, filtrowane w miejscu i zapisywane z powrotem.
+static void run_mc_f(void (*group)(mc_vf*, float*, float*, int, int, int, float*, float*, int),
+                     float *x, float *y, float *b, float *a, int N, int order, int channels, int layout) {
+    mc_vf st[2 * 64];  // max: DF1 2 * order, CASCADE 2 * sections
+    float buf[MC_TILE * MC_LANES_F];
+
+    for (int c0 = 0; c0 < channels; c0 += MC_LANES_F) {
+        int w = (channels - c0 < MC_LANES_F) ? channels - c0 : MC_LANES_F;
+        memset(st, 0, sizeof(st));
+
+        if (layout == MC_INTERLEAVED) {
+            group(st, x + c0, y + c0, N, channels, w, b, a, order);
+            continue;
+        }
+
+        for (int t = 0; t < N; t += MC_TILE) {
+            int frames = (N - t < MC_TILE) ? N - t : MC_TILE;
+            memset(buf, 0, sizeof(buf));
+            for (int l = 0; l < w; ++l)
+                for (int k = 0; k < frames; ++k)
+                    buf[k * MC_LANES_F + l] = x[(size_t)(c0 + l) * N + t + k];
+
+            group(st, buf, buf, frames, MC_LANES_F, MC_LANES_F, b, a, order);
+
+            for (int l = 0; l < w; ++l)
+                for (int k = 0; k < frames; ++k)
+                    y[(size_t)(c0 + l) * N + t + k] = buf[k * MC_LANES_F + l];
+        }
+    }
+}
+
+void DF1_mc_f(float *x, float *y, float *b, float *a, int N, int order, int channels, int layout) {
+    run_mc_f(DF1_group_f, x, y, b, a, N, order, channels, layout);
+}
+
+void DF2_mc_f(float *x, float *y, float *b, float *a, int N, int order, int channels, int layout) {
+    run_mc_f(DF2_group_f, x, y, b, a, N, order, channels, layout);
+}
+
+void TDF2_mc_f(float *x, float *y, float *b, float *a, int N, int order, int channels, int layout) {
+    run_mc_f(TDF2_group_f, x, y, b, a, N, order, channels, layout);
+}
+
+void CASCADE_mc_f(float *x, float *y, float *sos, int N, int sections, int channels, int layout) {
+    run_mc_f(CASCADE_group_f, x, y, sos, NULL, N, sections, channels, layout);
+}
+
+// ========================= double =========================
+
+typedef double mc_vd __attribute__((vector_size(MC_LANES_D * sizeof(double))));
+
+// Odczyt/zapis w kanałów (w <= MC_LANES_D); niepełna grupa uzupełniana zerami
+static inline mc_vd load_d(const double *p, int w) {
+    mc_vd v = {0};
+    if (w == MC_LANES_D) memcpy(&v, p, sizeof(v));
+    else memcpy(&v, p, sizeof(double) * w);
+    return v;
+}
+
+static inline void store_d(double *p, mc_vd v, int w) {
+    if (w == MC_LANES_D) memcpy(p, &v, sizeof(v));
+    else memcpy(p, &v, sizeof(double) * w);
+}
+
+// Jądra grupowe: jedna grupa MC_LANES_D kanałów, próbki co stride elementów.
+// Stan st (wyzerowany przez wywołującego) przenoszony jest między wywołaniami.
+// Dozwolone x == y.
+static void DF1_group_d(mc_vd *st, double *x, double *y, int frames, int stride, int w, double *b, double *a, int order) {
+    mc_vd *xh = st;          // xh[i] = x[n - i]
+    mc_vd *yh = st + order;  // yh[i] = y[n - i]
+
+    for (int n = 0; n < frames; ++n) {
+        for (int i = order - 1; i > 0; --i)
+            xh[i] = xh[i - 1];
+        xh[0] = load_d(x + (size_t)n * stride, w);
+
+        mc_vd yn = {0};
+        for (int i = 0; i < order; ++i) {
+            yn += b[i] * xh[i];
+            if (i > 0) yn -= a[i] * yh[i];
+        }
+
+        for (int i = order - 1; i > 1; --i)
+            yh[i] = yh[i - 1];
+        yh[1] = yn;
+        store_d(y + (size_t)n * stride, yn, w);
+    }
+}
+
+static void DF2_group_d(mc_vd *w_st, double *x, double *y, int frames, int stride, int w, double *b, double *a, int order) {
+    for (int n = 0; n < frames; ++n) {
+        mc_vd w0 = load_d(x + (size_t)n * stride, w);
+        for (int i = 1; i < order; ++i)
+            w0 -= a[i] * w_st[i];
+        w_st[0] = w0;
+
+        mc_vd yn = {0};
+        for (int i = 0; i < order; ++i)
+            yn += b[i] * w_st[i];
+        store_d(y + (size_t)n * stride, yn, w);
+
+        for (int i = order - 1; i > 0; --i)
+            w_st[i] = w_st[i - 1];
+    }
+}
+
+static void TDF2_group_d(mc_vd *w_st, double *x, double *y, int frames, int stride, int w, double *b, double *a, int order) {
+    for (int n = 0; n < frames; ++n) {
+        mc_vd xn = load_d(x + (size_t)n * stride, w);
+        mc_vd yn = w_st[0] + b[0] * xn;
+
+        for (int i = 0; i < order - 2; ++i)
+            w_st[i] = w_st[i + 1] + b[i + 1] * xn - a[i + 1] * yn;
+        w_st[order - 2] = b[order - 1] * xn - a[order - 1] * yn;
+
+        store_d(y + (size_t)n * stride, yn, w);
+    }
+}
+
+// Próbka przechodzi przez wszystkie sekcje od razu - stan sekcji zostaje w rejestrach
+// Wspólna sygnatura z pozostałymi jądrami: sos przekazywane jako b, sections jako order
+static void CASCADE_group_d(mc_vd *st, double *x, double *y, int frames, int stride, int w, double *sos, double *a, int sections) {
+    (void)a;
+    mc_vd *w1 = st;
+    mc_vd *w2 = st + sections;
+
+    for (int n = 0; n < frames; ++n) {
+        mc_vd v = load_d(x + (size_t)n * stride, w);
+        for (int s = 0; s < sections; ++s) {
+            double *c = sos + s * 6;
+            mc_vd wn = v - c[4] * w1[s] - c[5] * w2[s];
+            v = c[0] * wn + c[1] * w1[s] + c[2] * w2[s];
+            w2[s] = w1[s];
+            w1[s] = wn;
+        }
+        store_d(y + (size_t)n * stride, v, w);
+    }
+}
+
+// Wspólny szkielet: grupy po MC_LANES_D kanałów. Dla MC_PLANAR kafle MC_TILE próbek
+// przepisywane są do bufora z przeplotem, filtrowane w miejscu i zapisywane z powrotem.
+static void run_mc_d(void (*group)(mc_vd*, double*, double*, int, int, int, double*, double*, int),
+                     double *x, double *y, double *b, double *a, int N, int order, int channels, int layout) {
+    mc_vd st[2 * 64];  // max: DF1 2 * order, CASCADE 2 * sections
+    double buf[MC_TILE * MC_LANES_D];
+
+    for (int c0 = 0; c0 < channels; c0 += MC_LANES_D) {
+        int w = (channels - c0 < MC_LANES_D) ? channels - c0 : MC_LANES_D;
+        memset(st, 0, sizeof(st));
+
+        if (layout == MC_INTERLEAVED) {
+            group(st, x + c0, y + c0, N, channels, w, b, a, order);
+            continue;
+        }
+
+        for (int t = 0; t < N; t += MC_TILE) {
+            int frames = (N - t < MC_TILE) ? N - t : MC_TILE;
+            memset(buf, 0, sizeof(buf));
+            for (int l = 0; l < w; ++l)
+                for (int k = 0; k < frames; ++k)
+                    buf[k * MC_LANES_D + l] = x[(size_t)(c0 + l) * N + t + k];
+
+            group(st, buf, buf, frames, MC_LANES_D, MC_LANES_D, b, a, order);
+
+            for (int l = 0; l < w; ++l)
+                for (int k = 0; k < frames; ++k)
+                    y[(size_t)(c0 + l) * N + t + k] = buf[k * MC_LANES_D + l];
+        }
+    }
+}
+
+void DF1_mc_d(double *x, double *y, double *b, double *a, int N, int order, int channels, int layout) {
+    run_mc_d(DF1_group_d, x, y, b, a, N, order, channels, layout);
+}
+
+void DF2_mc_d(double *x, double *y, double *b, double *a, int N, int order, int channels, int layout) {
+    run_mc_d(DF2_group_d, x, y, b, a, N, order, channels, layout);
+}
+
+void TDF2_mc_d(double *x, double *y, double *b, double *a, int N, int order, int channels, int layout) {
+    run_mc_d(TDF2_group_d, x, y, b, a, N, order, channels, layout);
+}
+
+void CASCADE_mc_d(double *x, double *y, double *sos, int N, int sections, int channels, int layout) {
+    run_mc_d(CASCADE_group_d, x, y, sos, NULL, N, sections, channels, layout);
+}
@@ -0,0 +1,46 @@
+#ifndef MULTICHANNEL_H
+#define MULTICHANNEL_H
+
+#include <stddef.h>
+
+// Wielokanałowe wersje struktur z structures.h: jeden wektor SIMD = kilka kanałów.
+// Szerokość wektora wybierana przy kompilacji (-march=native / -mavx2 / -mavx512f):
+// AVX-512: 16 float / 8 double, AVX/AVX2: 8 / 4, pozostałe: 4 / 2.
+// Kompilacja: gcc -O3 -march=native ... ./lib/multichannel.c
+//
+// Każdy kanał liczony w tej samej kolejności co jądro skalarne. DF1 / TDF2 / CASCADE
+// dają wynik bit w bit jak structures.c. DF2 tylko z -ffp-contract=off: przy FMA
+// (-march=native) kompilator skleja mnożenia z odejmowaniem w DF2_d / DF2_f tylko
+// w części pętli (zależnie od wektoryzacji), czego nie da się odtworzyć w wektorze
+// kanałów - różnice rzędu 1e-5 względem DF2_d. Sprawdzenie: ./TimeAnalysis mc
+// (c_floating_mc_exactness_results.csv).
+
+#if defined(__AVX512F__)
+#define MC_LANES_F 16
+#define MC_LANES_D 8
+#elif defined(__AVX__)
+#define MC_LANES_F 8
+#define MC_LANES_D 4
+#else
+#define MC_LANES_F 4
+#define MC_LANES_D 2
+#endif
+
+// Układ danych:
+// MC_INTERLEAVED: x[n * channels + c]  (próbki kanałów przeplecione)
+// MC_PLANAR:      x[c * N + n]         (każdy kanał w osobnym, ciągłym bloku)
+#define MC_INTERLEAVED 0
+#define MC_PLANAR      1
+
+// N = liczba próbek na kanał, order jak w structures.h (liczba współczynników)
+void DF1_mc_f(float *x, float *y, float *b, float *a, int N, int order, int channels, int layout);
+void DF2_mc_f(float *x, float *y, float *b, float *a, int N, int order, int channels, int layout);
+void TDF2_mc_f(float *x, float *y, float *b, float *a, int N, int order, int channels, int layout);
+void CASCADE_mc_f(float *x, float *y, float *sos, int N, int sections, int channels, int layout);
+
+void DF1_mc_d(double *x, double *y, double *b, double *a, int N, int order, int channels, int layout);
+void DF2_mc_d(double *x, double *y, double *b, double *a, int N, int order, int channels, int layout);
+void TDF2_mc_d(double *x, double *y, double *b, double *a, int N, int order, int channels, int layout);
+void CASCADE_mc_d(double *x, double *y, double *sos, int N, int sections, int channels, int layout);
+
+#endif // MULTICHANNEL_H
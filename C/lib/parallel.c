@@ -0,0 +1,263 @@
+#include "parallel.h"
+#include "structures.h"
+#include "streaming.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+#define PAR_MAX_DIM 64
+#define PAR_MIN_CHUNK 1024   // krótszych fragmentów nie opłaca się zrównoleglać
+#define PAR_TAIL_EPS 1e-24   // odpowiedź swobodna pomijalna poniżej tego progu (względnie)
+#define PAR_MAX_AMPLIFY 1e-9 // dopuszczalny względny błąd sklejenia (oszacowanie z par_amplify)
+
+// Macierz A^L liczona jest kolumnami: kolumna j to stan po L krokach bez wejścia,
+// startując z wektora bazowego e_j. Potęgowanie przez kwadraty nie nadaje się dla
+// postaci bezpośrednich wysokiego rzędu (A^n ma wyrazy rzędu 1e10, każde mnożenie
+// traci ~10 cyfr), natomiast rekurencja ma ten sam charakter zaokrągleń co filtr.
+// Kolumny liczone są równolegle z fragmentami sygnału i kończone, gdy stan wygaśnie.
+
+// Ścieżka sklejania (kolumny A^L, stany S, odpowiedź swobodna) liczona jest w long double:
+// dla TDF2 wysokiego rzędu stan swobodny przechodzi przez wartości ~1e10 i w double
+// błąd sklejenia przewyższałby błąd samego filtru szeregowego.
+typedef long double par_t;
+
+static par_t max_abs(const par_t *v, int M) {
+    par_t m = 0.0L;
+    for (int i = 0; i < M; ++i)
+        if (fabsl(v[i]) > m) m = fabsl(v[i]);
+    return m;
+}
+
+// Zeruje składowe poniżej progu i zwraca maksimum |v|. Bez tego w kaskadzie szybko
+// wygasające sekcje schodzą do liczb zdenormalizowanych (bardzo wolnych na x87),
+// podczas gdy najwolniejsza sekcja wciąż podtrzymuje pętlę.
+static par_t flush_tiny(par_t *v, int M, par_t limit) {
+    par_t m = 0.0L;
+    for (int i = 0; i < M; ++i) {
+        if (fabsl(v[i]) <= limit) v[i] = 0.0L;
+        else if (fabsl(v[i]) > m) m = fabsl(v[i]);
+    }
+    return m;
+}
+
+// out = A * v + f
+static void mat_vec_add(const par_t *A, const par_t *v, const par_t *f, par_t *out, int M) {
+    for (int i = 0; i < M; ++i) {
+        par_t acc = f[i];
+        for (int k = 0; k < M; ++k)
+            acc += A[i * M + k] * v[k];
+        out[i] = acc;
+    }
+}
+
+// Oszacowanie błędu sklejenia względem wyniku: błąd zaokrąglenia S[k + 1] = A^L * S[k] + F[k]
+// rośnie z ||A^L|| (rząd składników, które się znoszą), a do wyniku trafia wzmocniony przez
+// największą odpowiedź swobodną w ciągu L kroków (peak). Dla ellip rzędu 8 w TDF2 (biegun
+// tuż przy okręgu jednostkowym) oba czynniki sięgają ~1e10 i nawet long double nie wystarcza
+// - wtedy zostaje wersja szeregowa. Gdy A^L wygasło (kolumny wyzerowane), błąd jest pomijalny.
+static int stitch_unstable(const par_t *AL, const par_t *peak, int M) {
+    par_t g = max_abs(peak, M);
+    return g * max_abs(AL, M * M) * LDBL_EPSILON > PAR_MAX_AMPLIFY;
+}
+
+static int chunk_count(int N, int threads) {
+    int P = threads;
+    if (P > N / PAR_MIN_CHUNK) P = N / PAR_MIN_CHUNK;
+    return (P < 1) ? 1 : P;
+}
+
+// === TDF2 ===
+// Stan w (wymiar M = order - 1); bez wejścia: y = w[0], w'[i] = w[i + 1] - a[i + 1] * y
+static par_t tdf2_zero_step(double *a, int M, par_t *w) {
+    par_t yc = w[0];
+    for (int i = 0; i < M - 1; ++i)
+        w[i] = w[i + 1] - a[i + 1] * yc;
+    w[M - 1] = -a[M] * yc;
+    return yc;
+}
+
+// Odpowiedź swobodna ze stanu w dodawana do y (y == NULL: tylko stan po len krokach).
+// peak (może być NULL) - największe |w| po drodze. Zwraca 0, gdy stan wygasł przed końcem
+// (wtedy w jest pomijalne).
+static int tdf2_zero_input(double *a, int M, par_t *w, double *y, int len, par_t *peak) {
+    par_t limit = PAR_TAIL_EPS * max_abs(w, M);
+    par_t m = 0.0L;
+
+    for (int n = 0; n < len; ++n) {
+        par_t yc = tdf2_zero_step(a, M, w);
+        if (y) y[n] = (double)(y[n] + yc);
+        if ((n & 63) == 63) {
+            par_t v = flush_tiny(w, M, limit);
+            if (v > m) m = v;
+            if (v == 0.0L) {
+                if (peak) *peak = m;
+                return 0;
+            }
+        }
+    }
+    if (peak) *peak = (max_abs(w, M) > m) ? max_abs(w, M) : m;
+    return 1;
+}
+
+// Fragment od stanu zerowego ze stanem w long double (jak TDF2_d). Stan końcowy F trafia
+// do sklejenia i dalej mnożony przez A^L; policzony w double niósłby błąd zaokrąglenia
+// stanów przejściowych ~1e10, który wzmocniony dawał dla ellip rzędu 8 błąd >> sygnału.
+static void tdf2_chunk(double *x, double *y, double *b, double *a, int M, int len, par_t *w) {
+    for (int n = 0; n < len; ++n) {
+        par_t yn = w[0] + b[0] * (par_t)x[n];
+        for (int i = 0; i < M - 1; ++i)
+            w[i] = w[i + 1] + b[i + 1] * (par_t)x[n] - a[i + 1] * yn;
+        w[M - 1] = b[M] * (par_t)x[n] - a[M] * yn;
+        y[n] = (double)yn;
+    }
+}
+
+void TDF2_par_d(double *x, double *y, double *b, double *a, int N, int order, int threads) {
+    int M = order - 1;
+    int P = chunk_count(N, threads);
+
+    if (P == 1 || M < 1 || M > PAR_MAX_DIM) {
+        TDF2_d(x, y, b, a, N, order);
+        return;
+    }
+
+    int L = (N + P - 1) / P;
+    par_t *F = calloc((size_t)P * M, sizeof(par_t));   // stan końcowy fragmentu od zera
+    par_t *S = calloc((size_t)P * M, sizeof(par_t));   // stan początkowy fragmentu
+    par_t *AL = calloc((size_t)M * M, sizeof(par_t));  // A^L, kolumnami (AL[j * M + i])
+    par_t *ALr = calloc((size_t)M * M, sizeof(par_t));
+    par_t *G = calloc((size_t)M, sizeof(par_t));       // szczyt odpowiedzi swobodnej kolumn
+
+    // 1. Fragmenty od stanu zerowego + kolumny A^L
+    #pragma omp parallel for num_threads(threads) schedule(dynamic, 1)
+    for (int k = 0; k < P + M; ++k) {
+        if (k < P) {
+            int lo = k * L, len = (lo + L < N) ? L : N - lo;
+            tdf2_chunk(x + lo, y + lo, b, a, M, len, F + (size_t)k * M);
+        } else {
+            par_t *col = AL + (size_t)(k - P) * M;
+            col[k - P] = 1.0L;
+            if (!tdf2_zero_input(a, M, col, NULL, L, G + (k - P)))
+                memset(col, 0, sizeof(par_t) * M);
+        }
+    }
+
+    // Sklejenie źle uwarunkowane: wynik szeregowy (fragmenty z kroku 1 nadpisane)
+    if (stitch_unstable(AL, G, M)) {
+        TDF2_d(x, y, b, a, N, order);
+        free(F); free(S); free(AL); free(ALr); free(G);
+        return;
+    }
+
+    // 2. Sklejenie stanów: S[k + 1] = A^L * S[k] + F[k]
+    for (int i = 0; i < M; ++i)
+        for (int j = 0; j < M; ++j)
+            ALr[i * M + j] = AL[j * M + i];
+    for (int k = 0; k + 1 < P; ++k)
+        mat_vec_add(ALr, S + (size_t)k * M, F + (size_t)k * M, S + (size_t)(k + 1) * M, M);
+
+    // 3. Odpowiedź swobodna na stan początkowy fragmentu
+    #pragma omp parallel for num_threads(threads) schedule(static)
+    for (int k = 1; k < P; ++k) {
+        int lo = k * L, len = (lo + L < N) ? L : N - lo;
+        tdf2_zero_input(a, M, S + (size_t)k * M, y + lo, len, NULL);
+    }
+
+    free(F); free(S); free(AL); free(ALr); free(G);
+}
+
+// === CASCADE ===
+// Stan z = [w1[0..S-1], w2[0..S-1]]; jeden krok kaskady bez wejścia
+static par_t cascade_zero_step(double *sos, int sections, par_t *z) {
+    par_t *w1 = z, *w2 = z + sections;
+    par_t v = 0.0L;
+    for (int s = 0; s < sections; ++s) {
+        double *c = sos + s * 6;
+        par_t wn = v - c[4] * w1[s] - c[5] * w2[s];
+        v = c[0] * wn + c[1] * w1[s] + c[2] * w2[s];
+        w2[s] = w1[s];
+        w1[s] = wn;
+    }
+    return v;
+}
+
+static int cascade_zero_input(double *sos, int sections, par_t *z, double *y, int len, par_t *peak) {
+    int M = 2 * sections;
+    par_t limit = PAR_TAIL_EPS * max_abs(z, M);
+    par_t m = 0.0L;
+
+    for (int n = 0; n < len; ++n) {
+        par_t v = cascade_zero_step(sos, sections, z);
+        if (y) y[n] = (double)(y[n] + v);
+        if ((n & 63) == 63) {
+            par_t u = flush_tiny(z, M, limit);
+            if (u > m) m = u;
+            if (u == 0.0L) {
+                if (peak) *peak = m;
+                return 0;
+            }
+        }
+    }
+    if (peak) *peak = (max_abs(z, M) > m) ? max_abs(z, M) : m;
+    return 1;
+}
+
+void CASCADE_par_d(double *x, double *y, double *sos, int N, int sections, int threads) {
+    int M = 2 * sections;
+    int P = chunk_count(N, threads);
+
+    if (P == 1 || sections < 1 || M > PAR_MAX_DIM) {
+        CASCADE_ip_d(x, y, sos, N, sections);
+        return;
+    }
+
+    int L = (N + P - 1) / P;
+    par_t *F = calloc((size_t)P * M, sizeof(par_t));
+    par_t *S = calloc((size_t)P * M, sizeof(par_t));
+    par_t *AL = calloc((size_t)M * M, sizeof(par_t));
+    par_t *ALr = calloc((size_t)M * M, sizeof(par_t));
+    par_t *G = calloc((size_t)M, sizeof(par_t));       // szczyt odpowiedzi swobodnej kolumn
+
+    // 1. Fragmenty od stanu zerowego + kolumny A^L
+    #pragma omp parallel for num_threads(threads) schedule(dynamic, 1)
+    for (int k = 0; k < P + M; ++k) {
+        if (k < P) {
+            int lo = k * L, len = (lo + L < N) ? L : N - lo;
+            CASCADE_state_d st;
+            CASCADE_init_d(&st, sos, sections);
+            CASCADE_block_d(&st, x + lo, y + lo, len);
+            for (int s = 0; s < sections; ++s) {
+                F[(size_t)k * M + s] = st.w1[s];
+                F[(size_t)k * M + sections + s] = st.w2[s];
+            }
+        } else {
+            par_t *col = AL + (size_t)(k - P) * M;
+            col[k - P] = 1.0L;
+            if (!cascade_zero_input(sos, sections, col, NULL, L, G + (k - P)))
+                memset(col, 0, sizeof(par_t) * M);
+        }
+    }
+
+    if (stitch_unstable(AL, G, M)) {
+        CASCADE_ip_d(x, y, sos, N, sections);
+        free(F); free(S); free(AL); free(ALr); free(G);
+        return;
+    }
+
+    // 2. Sklejenie stanów: S[k + 1] = A^L * S[k] + F[k]
+    for (int i = 0; i < M; ++i)
+        for (int j = 0; j < M; ++j)
+            ALr[i * M + j] = AL[j * M + i];
+    for (int k = 0; k + 1 < P; ++k)
+        mat_vec_add(ALr, S + (size_t)k * M, F + (size_t)k * M, S + (size_t)(k + 1) * M, M);
+
+    // 3. Odpowiedź swobodna na stan początkowy fragmentu
+    #pragma omp parallel for num_threads(threads) schedule(static)
+    for (int k = 1; k < P; ++k) {
+        int lo = k * L, len = (lo + L < N) ? L : N - lo;
+        cascade_zero_input(sos, sections, S + (size_t)k * M, y + lo, len, NULL);
+    }
+
+    free(F); free(S); free(AL); free(ALr); free(G);
+}
@@ -0,0 +1,19 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stddef.h>
+
+// Wielowątkowe TDF2_d / CASCADE_d dla jednego długiego sygnału.
+// Sygnał dzielony jest na threads fragmentów filtrowanych równolegle od stanu zerowego;
+// następnie stany początkowe fragmentów wyznaczane są z potęg macierzy przejścia stanu
+// (S[k+1] = A^L * S[k] + F[k]), a odpowiedź na stan początkowy dodawana jest równolegle
+// do wyniku. Fragmenty TDF2 i sklejanie liczone w long double; wynik zgodny z wersją
+// szeregową z dokładnością do jej własnych zaokrągleń double (nie bit w bit).
+// Gdy sklejenie jest źle uwarunkowane (duże wzmocnienie A^L, np. ellip rzędu 8 w TDF2),
+// funkcje liczą szeregowo.
+// Kompilacja z -fopenmp; bez OpenMP funkcje działają poprawnie, ale szeregowo.
+
+void TDF2_par_d(double *x, double *y, double *b, double *a, int N, int order, int threads);
+void CASCADE_par_d(double *x, double *y, double *sos, int N, int sections, int threads);
+
+#endif // PARALLEL_H
@@ -0,0 +1,116 @@
+#include <string.h>
+#include "perfcounters.h"
+
+#if PERF_COUNTERS
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+static const char *perf_names[PERF_EVENTS] = {
+    "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses", "stalled_frontend", "stalled_backend"
+};
+
+static int perf_fd[PERF_EVENTS];
+static int perf_open_count = 0;
+
+// === Otwieranie ===
+#if PERF_COUNTERS
+static int perf_open(unsigned int type, unsigned long long config) {
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+#define PERF_CACHE(cache, op, result) \
+    ((cache) | ((op) << 8) | ((result) << 16))
+#endif
+
+void perf_init(void) {
+    for (int e = 0; e < PERF_EVENTS; ++e) perf_fd[e] = -1;
+    perf_open_count = 0;
+
+#if PERF_COUNTERS
+    perf_fd[PERF_CYCLES] = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    perf_fd[PERF_INSTRUCTIONS] = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    perf_fd[PERF_L1D_MISSES] = perf_open(PERF_TYPE_HW_CACHE,
+        PERF_CACHE(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS));
+    perf_fd[PERF_LLC_MISSES] = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    perf_fd[PERF_BRANCH_MISSES] = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    perf_fd[PERF_STALLED_FRONTEND] = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_FRONTEND);
+    perf_fd[PERF_STALLED_BACKEND] = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_BACKEND);
+#endif
+
+    printf("[LOG] Perf counters:");
+    for (int e = 0; e < PERF_EVENTS; ++e) {
+        if (perf_fd[e] >= 0) {
+            printf(" %s", perf_names[e]);
+            ++perf_open_count;
+        }
+    }
+    printf(perf_open_count ? "\n" : " none (CSV columns left empty)\n");
+}
+
+int perf_available(void) {
+    return perf_open_count;
+}
+
+// === Pomiar ===
+void perf_start(void) {
+#if PERF_COUNTERS
+    for (int e = 0; e < PERF_EVENTS; ++e) {
+        if (perf_fd[e] < 0) continue;
+        ioctl(perf_fd[e], PERF_EVENT_IOC_RESET, 0);
+        ioctl(perf_fd[e], PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+void perf_stop(perf_sample *s) {
+#if PERF_COUNTERS
+    for (int e = 0; e < PERF_EVENTS; ++e)
+        if (perf_fd[e] >= 0) ioctl(perf_fd[e], PERF_EVENT_IOC_DISABLE, 0);
+#endif
+
+    for (int e = 0; e < PERF_EVENTS; ++e) {
+        s->value[e] = 0.0;
+        s->valid[e] = 0;
+#if PERF_COUNTERS
+        unsigned long long buf[3];  // value, time_enabled, time_running
+        if (perf_fd[e] < 0 || read(perf_fd[e], buf, sizeof(buf)) != (ssize_t)sizeof(buf) || buf[2] == 0)
+            continue;
+        s->value[e] = (buf[2] < buf[1]) ? (double)buf[0] * (double)buf[1] / (double)buf[2] : (double)buf[0];
+        s->valid[e] = 1;
+#endif
+    }
+}
+
+// === CSV ===
+void perf_fprint_columns(FILE *fp, const perf_sample *s, long samples) {
+    for (int e = 0; e < PERF_EVENTS; ++e) {
+        if (s->valid[e]) fprintf(fp, ",%.0f", s->value[e]);
+        else fprintf(fp, ",");
+
+        // IPC zaraz po instructions
+        if (e == PERF_INSTRUCTIONS) {
+            if (s->valid[PERF_CYCLES] && s->valid[PERF_INSTRUCTIONS] && s->value[PERF_CYCLES] > 0.0)
+                fprintf(fp, ",%.4f", s->value[PERF_INSTRUCTIONS] / s->value[PERF_CYCLES]);
+            else fprintf(fp, ",");
+        }
+    }
+
+    for (int e = 0; e < PERF_EVENTS; ++e) {
+        if (s->valid[e] && samples > 0) fprintf(fp, ",%.4f", s->value[e] / (double)samples);
+        else fprintf(fp, ",");
+    }
+}
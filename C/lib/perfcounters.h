@@ -0,0 +1,50 @@
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+
+#include <stdio.h>
+
+// Liczniki sprzętowe dla programów TimeAnalysis (Linux perf_event_open).
+// Każde zdarzenie otwierane osobno dla bieżącego wątku, tylko przestrzeń użytkownika
+// (exclude_kernel / exclude_hv, działa przy perf_event_paranoid <= 2).
+// Zdarzenie, którego nie da się otworzyć (brak PMU w maszynie wirtualnej, brak uprawnień,
+// zdarzenie nieobsługiwane przez procesor), jest pomijane - jego kolumny CSV zostają puste.
+// Przy multipleksowaniu wartość skalowana przez time_enabled / time_running.
+// Poza Linuksem lub z -DPERF_COUNTERS=0 wszystkie kolumny są puste.
+
+#ifndef PERF_COUNTERS
+#ifdef __linux__
+#define PERF_COUNTERS 1
+#else
+#define PERF_COUNTERS 0
+#endif
+#endif
+
+typedef enum {
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_MISSES,
+    PERF_LLC_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_STALLED_FRONTEND,
+    PERF_STALLED_BACKEND,
+    PERF_EVENTS
+} perf_event_id;
+
+typedef struct {
+    double value[PERF_EVENTS];
+    int valid[PERF_EVENTS];
+} perf_sample;
+
+void perf_init(void);               // otwiera liczniki i wypisuje, które są dostępne
+void perf_start(void);              // zeruje i włącza liczniki
+void perf_stop(perf_sample *s);     // wyłącza liczniki i odczytuje wartości
+int perf_available(void);           // liczba otwartych zdarzeń
+
+// Kolumny CSV (dopisywane na końcu wiersza, z przecinkiem na początku):
+// wartości bezwzględne, IPC i wartości na próbkę
+#define PERF_CSV_HEADER ",cycles,instructions,ipc,l1d_misses,llc_misses,branch_misses,stalled_frontend,stalled_backend" \
+                        ",cycles_per_sample,instructions_per_sample,l1d_misses_per_sample,llc_misses_per_sample" \
+                        ",branch_misses_per_sample,stalled_frontend_per_sample,stalled_backend_per_sample"
+void perf_fprint_columns(FILE *fp, const perf_sample *s, long samples);
+
+#endif // PERFCOUNTERS_H
@@ -0,0 +1,159 @@
+#if defined(__linux__)
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include "rtsim.h"
+
+#if defined(__linux__)
+
+// === Czas ===
+static inline long long ts_ns(const struct timespec *ts) {
+    return (long long)ts->tv_sec * 1000000000LL + ts->tv_nsec;
+}
+
+static inline long long now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts_ns(&ts);
+}
+
+static inline void ts_add(struct timespec *ts, long long ns) {
+    ns += ts->tv_nsec;
+    ts->tv_sec += ns / 1000000000LL;
+    ts->tv_nsec = ns % 1000000000LL;
+}
+
+// === Obciążenie pamięci ===
+static volatile int load_stop;
+
+static void *load_thread(void *p) {
+    char *buf = p;
+    size_t half = RTSIM_LOAD_BYTES / 2;
+    while (!load_stop) {
+        memcpy(buf + half, buf, half);
+        memcpy(buf, buf + half, half);
+    }
+    return NULL;
+}
+
+// === Wątek okresowy ===
+typedef struct {
+    const rtsim_config *cfg;
+    rtsim_callback process;
+    void *ctx;
+    rtsim_result *res;
+} rt_args;
+
+static void *rt_thread(void *p) {
+    rt_args *a = p;
+    rtsim_result *res = a->res;
+    long long period = (long long)(res->period_ns + 0.5);
+    struct timespec next;
+
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    ts_add(&next, period);
+
+    for (long k = 0; k < a->cfg->periods + RTSIM_WARMUP; ++k) {
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+        long long release = ts_ns(&next);
+        long long t0 = now_ns();
+        a->process(a->ctx);
+        long long t1 = now_ns();
+
+        if (k >= RTSIM_WARMUP) {
+            lat_record(&res->jitter, (double)(t0 - release));
+            lat_record(&res->exec, (double)(t1 - t0));
+            lat_record(&res->response, (double)(t1 - release));
+            if (t1 - release > period) res->misses++;
+        }
+        ts_add(&next, period);
+    }
+    return NULL;
+}
+
+int rtsim_run(const rtsim_config *cfg, rtsim_callback process, void *ctx, rtsim_result *res) {
+    pthread_t rt, *load = NULL;
+    char **load_buf = NULL;
+    rt_args args = { cfg, process, ctx, res };
+    int started = 0;
+
+    lat_reset(&res->exec);
+    lat_reset(&res->jitter);
+    lat_reset(&res->response);
+    res->misses = 0;
+    res->period_ns = 1e9 * cfg->block / cfg->fs;
+    res->fifo = 0;
+
+    // Wątki obciążenia (bufory zapisane przed startem, bez błędów stron w trakcie)
+    load_stop = 0;
+    if (cfg->load_threads > 0) {
+        load = malloc(sizeof(pthread_t) * cfg->load_threads);
+        load_buf = calloc(cfg->load_threads, sizeof(char *));
+    }
+    for (int i = 0; i < cfg->load_threads; ++i) {
+        load_buf[i] = malloc(RTSIM_LOAD_BYTES);
+        if (!load_buf[i]) break;
+        memset(load_buf[i], i + 1, RTSIM_LOAD_BYTES);
+        if (pthread_create(&load[i], NULL, load_thread, load_buf[i]) != 0) break;
+        started++;
+    }
+
+    // Wątek okresowy: najpierw SCHED_FIFO, przy braku uprawnień zwykły
+    if (cfg->fifo) {
+        pthread_attr_t attr;
+        struct sched_param sp;
+        pthread_attr_init(&attr);
+        pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+        sp.sched_priority = sched_get_priority_max(SCHED_FIFO) - 1;
+        pthread_attr_setschedparam(&attr, &sp);
+        res->fifo = pthread_create(&rt, &attr, rt_thread, &args) == 0;
+        pthread_attr_destroy(&attr);
+    }
+    int ok = res->fifo || pthread_create(&rt, NULL, rt_thread, &args) == 0;
+    if (ok) pthread_join(rt, NULL);
+
+    load_stop = 1;
+    for (int i = 0; i < started; ++i) pthread_join(load[i], NULL);
+    for (int i = 0; i < cfg->load_threads && load_buf; ++i) free(load_buf[i]);
+    free(load_buf);
+    free(load);
+
+    return ok ? 0 : -1;
+}
+
+int rtsim_default_load(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores > 2 ? (int)cores - 1 : 1;
+}
+
+#else
+
+int rtsim_default_load(void) {
+    return 1;
+}
+
+int rtsim_run(const rtsim_config *cfg, rtsim_callback process, void *ctx, rtsim_result *res) {
+    (void)cfg; (void)process; (void)ctx; (void)res;
+    return -1;
+}
+
+#endif
+
+// === CSV ===
+void rtsim_fprint_columns(FILE *fp, const rtsim_config *cfg, const rtsim_result *res) {
+    long periods = (long)res->exec.total;
+    fprintf(fp, ",%d,%d,%.2f,%d,%s,%ld,%ld,%.6f", cfg->block, cfg->fs, res->period_ns * 1e-3, cfg->load_threads,
+            res->fifo ? "fifo" : "other", periods, res->misses, periods ? (double)res->misses / periods : 0.0);
+    fprintf(fp, ",%llu,%llu,%llu,%llu", (unsigned long long)res->exec.max,
+            (unsigned long long)lat_quantile(&res->exec, 0.5), (unsigned long long)lat_quantile(&res->exec, 0.99),
+            (unsigned long long)lat_quantile(&res->exec, 0.999));
+    fprintf(fp, ",%llu,%llu,%llu,%llu,%.4f", (unsigned long long)lat_quantile(&res->jitter, 0.5),
+            (unsigned long long)lat_quantile(&res->jitter, 0.99), (unsigned long long)res->jitter.max,
+            (unsigned long long)res->response.max, lat_mean(&res->exec) / res->period_ns);
+}
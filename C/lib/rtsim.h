@@ -0,0 +1,52 @@
+#ifndef RTSIM_H
+#define RTSIM_H
+
+#include <stdio.h>
+#include "latency.h"
+
+// Symulacja wywołania zwrotnego audio (tryb rtsim programów TimeAnalysis).
+// Wątek okresowy budzony co block / fs sekund (clock_nanosleep, czas bezwzględny) wywołuje
+// process(ctx), czyli przetworzenie jednego bloku. Dostaje SCHED_FIFO, gdy system pozwala
+// (root, CAP_SYS_NICE albo RLIMIT_RTPRIO), w przeciwnym razie zwykły priorytet (sched "other").
+// Wątki obciążenia kopiują w pętli własny bufor RTSIM_LOAD_BYTES, zajmując przepustowość
+// pamięci i wspólny cache (oraz rdzenie, jeśli jest ich mniej niż wątków).
+// Termin: koniec bloku przed kolejnym wyzwoleniem (wyzwolenie + okres). Wyzwolenia zostają
+// w siatce okresu także po przekroczeniu, więc spóźnienie przenosi się na następne bloki (xrun).
+// Mierzone (histogramy latency.h, ns):
+//   exec     - czas process(); WCET to maksimum
+//   jitter   - opóźnienie wybudzenia względem wyzwolenia
+//   response - od wyzwolenia do końca bloku; > okres => przekroczenie terminu
+// Tylko Linux (pthreads); gdzie indziej rtsim_run zwraca -1.
+
+#define RTSIM_LOAD_BYTES (64 << 20)
+#define RTSIM_WARMUP 16   // pierwsze okresy bez zapisu
+
+typedef void (*rtsim_callback)(void *ctx);
+
+typedef struct {
+    int block;          // próbki na okres
+    int fs;
+    long periods;
+    int load_threads;
+    int fifo;           // próbować SCHED_FIFO
+} rtsim_config;
+
+typedef struct {
+    lat_hist exec, jitter, response;
+    long misses;
+    double period_ns;
+    int fifo;           // czy wątek faktycznie działał z SCHED_FIFO
+} rtsim_result;
+
+int rtsim_run(const rtsim_config *cfg, rtsim_callback process, void *ctx, rtsim_result *res);
+
+// Domyślna liczba wątków obciążenia: liczba rdzeni - 1, co najmniej 1
+int rtsim_default_load(void);
+
+// Kolumny CSV (dopisywane po kolumnach konfiguracji, z przecinkiem na początku)
+#define RTSIM_CSV_HEADER ",block,fs,period_us,load_threads,sched,periods,misses,miss_ratio" \
+                         ",wcet_ns,exec_p50_ns,exec_p99_ns,exec_p999_ns" \
+                         ",jitter_p50_ns,jitter_p99_ns,jitter_max_ns,response_max_ns,utilization"
+void rtsim_fprint_columns(FILE *fp, const rtsim_config *cfg, const rtsim_result *res);
+
+#endif // RTSIM_H
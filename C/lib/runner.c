@@ -0,0 +1,157 @@
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "runner.h"
+
+#ifdef _WIN32
+#define RUNNER_NULL_DEVICE "NUL"
+#else
+#define RUNNER_NULL_DEVICE "/dev/null"
+#endif
+
+// === Ostatni zgłoszony pomiar ===
+static char last_key[RUNNER_KEY_LEN];
+static double last_seconds;
+static int reported;
+
+void runner_report(double seconds, const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(last_key, RUNNER_KEY_LEN, fmt, ap);
+    va_end(ap);
+    last_seconds = seconds;
+    reported = 1;
+}
+
+// === Losowa kolejność ===
+static unsigned long long rng_state = RUNNER_SEED;
+
+static unsigned long long rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void shuffle(int *v, int n) {
+    for (int i = n - 1; i > 0; --i) {
+        int j = (int)(rng_next() % (unsigned long long)(i + 1));
+        int t = v[i];
+        v[i] = v[j];
+        v[j] = t;
+    }
+}
+
+// === Statystyki ===
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Percentyl z interpolacją liniową (v posortowane)
+static double percentile(const double *v, int n, double p) {
+    double pos = p * (n - 1);
+    int i = (int)pos;
+    if (i >= n - 1) return v[n - 1];
+    return v[i] + (pos - i) * (v[i + 1] - v[i]);
+}
+
+// Względna połowa 95% przedziału ufności mediany z rang j, k (v posortowane)
+static double median_ci_rel(const double *v, int n) {
+    double med = percentile(v, n, 0.5);
+    int j = (int)floor((n - 1.96 * sqrt(n)) / 2.0);
+    int k = (int)ceil(1.0 + (n + 1.96 * sqrt(n)) / 2.0);
+    if (j < 1) j = 1;
+    if (k > n) k = n;
+    if (med <= 0.0) return 0.0;
+    return (v[k - 1] - v[j - 1]) / (2.0 * med);
+}
+
+static void write_summary(FILE *fp, const char *key, const double *samples, int n) {
+    double *v = malloc(sizeof(double) * n);
+    double *dev = malloc(sizeof(double) * n);
+    double sum = 0.0;
+
+    memcpy(v, samples, sizeof(double) * n);
+    qsort(v, n, sizeof(double), cmp_double);
+    double med = percentile(v, n, 0.5);
+    for (int i = 0; i < n; ++i) {
+        dev[i] = fabs(v[i] - med);
+        sum += v[i];
+    }
+    qsort(dev, n, sizeof(double), cmp_double);
+
+    fprintf(fp, "%s,%d,%.9f,%.9f,%.9f,%.9f,%.9f,%.9f,%.9f,%.9f,%.9f,%.6f\n", key, n, med,
+            percentile(dev, n, 0.5), v[0], percentile(v, n, 0.05), percentile(v, n, 0.25),
+            percentile(v, n, 0.75), percentile(v, n, 0.95), v[n - 1], sum / n, median_ci_rel(v, n));
+
+    free(v); free(dev);
+}
+
+// === Przebieg ===
+int runner_run(FILE *fp_raw, FILE *fp_summary, const char *key_header, runner_config config) {
+    FILE *sink = fopen(RUNNER_NULL_DEVICE, "w");
+    if (!sink) {
+        perror("Can't open " RUNNER_NULL_DEVICE);
+        return -1;
+    }
+
+    // Rozgrzewka; pierwszy przebieg po kolei wyznacza liczbę konfiguracji
+    int count = 0;
+    while (config(sink, count)) ++count;
+    for (int w = 1; w < RUNNER_WARMUP; ++w)
+        for (int c = 0; c < count; ++c) config(sink, c);
+    fclose(sink);
+
+    double *samples = malloc(sizeof(double) * (size_t)count * RUNNER_MAX_REPS);
+    char (*keys)[RUNNER_KEY_LEN] = calloc(count, RUNNER_KEY_LEN);
+    int *reps = calloc(count, sizeof(int));
+    int *done = calloc(count, sizeof(int));
+    int *order = malloc(sizeof(int) * count);
+    double *sorted = malloc(sizeof(double) * RUNNER_MAX_REPS);
+
+    int active = count;
+    for (int round = 0; active > 0; ++round) {
+        int n = 0;
+        for (int c = 0; c < count; ++c)
+            if (!done[c]) order[n++] = c;
+        shuffle(order, n);
+
+        for (int i = 0; i < n; ++i) {
+            int c = order[i];
+            reported = 0;
+            config(fp_raw, c);
+            if (!reported) {
+                // Konfiguracja bez runner_report - tylko surowy wiersz
+                done[c] = 1;
+                --active;
+                continue;
+            }
+            memcpy(keys[c], last_key, RUNNER_KEY_LEN);
+            samples[(size_t)c * RUNNER_MAX_REPS + reps[c]++] = last_seconds;
+        }
+
+        if (round + 1 < RUNNER_MIN_REPS) continue;
+
+        for (int c = 0; c < count; ++c) {
+            if (done[c]) continue;
+            memcpy(sorted, samples + (size_t)c * RUNNER_MAX_REPS, sizeof(double) * reps[c]);
+            qsort(sorted, reps[c], sizeof(double), cmp_double);
+            if (reps[c] >= RUNNER_MAX_REPS || median_ci_rel(sorted, reps[c]) <= RUNNER_CI_REL) {
+                done[c] = 1;
+                --active;
+            }
+        }
+        printf("[RUNNER] round %d: %d/%d configurations still running\n", round + 1, active, count);
+        fflush(fp_raw);
+    }
+
+    fprintf(fp_summary, "%s" RUNNER_SUMMARY_HEADER "\n", key_header);
+    for (int c = 0; c < count; ++c)
+        if (reps[c] > 0)
+            write_summary(fp_summary, keys[c], samples + (size_t)c * RUNNER_MAX_REPS, reps[c]);
+
+    free(samples); free(keys); free(reps); free(done); free(order); free(sorted);
+    return count;
+}
@@ -0,0 +1,49 @@
+#ifndef RUNNER_H
+#define RUNNER_H
+
+#include <stdio.h>
+
+// Runner pomiarów czasu dla programów TimeAnalysis.
+// Konfiguracja to jedno wywołanie benchmark_* wybierane indeksem (run_config w programie),
+// które dopisuje wiersz do surowego CSV i zgłasza wynik przez runner_report().
+// Przebieg:
+//   1. rozgrzewka: RUNNER_WARMUP przebiegów wszystkich konfiguracji (wyniki odrzucane;
+//      pierwszy przebieg wyznacza też liczbę konfiguracji),
+//   2. rundy: aktywne konfiguracje w losowej kolejności (xorshift, ziarno RUNNER_SEED),
+//   3. po RUNNER_MIN_REPS rundach konfiguracja kończy, gdy połowa 95% przedziału ufności
+//      mediany (z rang, bez założeń o rozkładzie) spadnie do RUNNER_CI_REL mediany,
+//      najpóźniej po RUNNER_MAX_REPS powtórzeniach.
+// Podsumowanie na konfigurację: liczba powtórzeń, mediana, MAD, min, percentyle 5/25/75/95,
+// max, średnia i względna połowa przedziału ufności mediany.
+// Wartości domyślne można zmienić przy kompilacji, np. -DRUNNER_MAX_REPS=100.
+#ifndef RUNNER_WARMUP
+#define RUNNER_WARMUP 2
+#endif
+#ifndef RUNNER_MIN_REPS
+#define RUNNER_MIN_REPS 10
+#endif
+#ifndef RUNNER_MAX_REPS
+#define RUNNER_MAX_REPS 50
+#endif
+#ifndef RUNNER_CI_REL
+#define RUNNER_CI_REL 0.01
+#endif
+#ifndef RUNNER_SEED
+#define RUNNER_SEED 12345u
+#endif
+
+#define RUNNER_KEY_LEN 160
+#define RUNNER_SUMMARY_HEADER ",runs,median,mad,min,p05,p25,p75,p95,max,mean,ci95_rel"
+
+// Zwraca 0, gdy konfiguracja idx nie istnieje (koniec listy)
+typedef int (*runner_config)(FILE *fp, int idx);
+
+// Wywoływane przez benchmark_* po pomiarze: seconds to zmierzony czas, fmt / ... tworzą klucz,
+// czyli kolumny identyfikujące wiersz CSV (np. "butter,float,DF1,1000,2")
+void runner_report(double seconds, const char *fmt, ...);
+
+// key_header: nagłówek kolumn klucza w podsumowaniu (np. "filter_name,type,structure,cutoff,order").
+// Zwraca liczbę konfiguracji albo -1 przy błędzie.
+int runner_run(FILE *fp_raw, FILE *fp_summary, const char *key_header, runner_config config);
+
+#endif // RUNNER_H
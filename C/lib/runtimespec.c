@@ -0,0 +1,278 @@
+#include "runtimespec.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
+#define RS_VERSION "rs2"  // zmienić po każdej zmianie szablonów (unieważnia cache)
+
+// === Szablony kodu ===
+// Ciała funkcji są przepisane z structures.c / structuresQ*s.c; ORDER, SECTIONS
+// oraz tablice b, a, sos są stałymi w wygenerowanym pliku.
+static const char *prelude_float =
+    "typedef float T;\n";
+
+static const char *prelude_q12 =
+    "#include <stdint.h>\n"
+    "typedef int16_t T;\n"
+    "typedef int32_t ACC;\n"
+    "static inline T sat(int32_t v) { return v > 32767 ? 32767 : (v < -32768 ? -32768 : (T)v); }\n"
+    "static inline T add_s(T a, T b) { return sat((int32_t)a + (int32_t)b); }\n"
+    "static inline T sub_s(T a, T b) { return sat((int32_t)a - (int32_t)b); }\n"
+    "static inline T mul_s(T a, T b) { return sat(((int32_t)a * (int32_t)b) >> 12); }\n";
+
+static const char *prelude_q24 =
+    "#include <stdint.h>\n"
+    "typedef int32_t T;\n"
+    "typedef int64_t ACC;\n"
+    "static inline T sat(int64_t v) { return v > 2147483647 ? 2147483647 : (v < -2147483648LL ? (T)-2147483648LL : (T)v); }\n"
+    "static inline T add_s(T a, T b) { return sat((int64_t)a + b); }\n"
+    "static inline T sub_s(T a, T b) { return sat((int64_t)a - b); }\n"
+    "static inline T mul_s(T a, T b) { return sat(((int64_t)a * b) >> 24); }\n"
+    "static inline T add(T a, T b) { return (T)((int64_t)a + b); }\n"
+    "static inline T mul(T a, T b) { return (T)(((int64_t)a * b) >> 24); }\n";
+
+static const char *body_float[4] = {
+    // DF1
+    "void rs_kernel(T *x, T *y, int N) {\n"
+    "    for (int n = 0; n < N; ++n) {\n"
+    "        y[n] = 0.0f;\n"
+    "        for (int i = 0; i < ORDER; ++i) {\n"
+    "            if (n - i >= 0) y[n] += b[i] * x[n - i];\n"
+    "            if (i > 0 && n - i >= 0) y[n] -= a[i] * y[n - i];\n"
+    "        }\n"
+    "    }\n"
+    "}\n",
+    // DF2
+    "void rs_kernel(T *x, T *y, int N) {\n"
+    "    T w[ORDER] = {0};\n"
+    "    for (int n = 0; n < N; ++n) {\n"
+    "        w[0] = x[n];\n"
+    "        for (int i = 1; i < ORDER; ++i)\n"
+    "            w[0] -= a[i] * w[i];\n"
+    "        y[n] = 0.0f;\n"
+    "        for (int i = 0; i < ORDER; ++i)\n"
+    "            y[n] += b[i] * w[i];\n"
+    "        for (int i = ORDER - 1; i > 0; --i)\n"
+    "            w[i] = w[i - 1];\n"
+    "    }\n"
+    "}\n",
+    // TDF2
+    "void rs_kernel(T *x, T *y, int N) {\n"
+    "    T w[ORDER] = {0};\n"
+    "    for (int n = 0; n < N; ++n) {\n"
+    "        T yn = w[0] + b[0] * x[n];\n"
+    "        for (int i = 0; i < ORDER - 2; ++i)\n"
+    "            w[i] = w[i + 1] + b[i + 1] * x[n] - a[i + 1] * yn;\n"
+    "        w[ORDER - 2] = b[ORDER - 1] * x[n] - a[ORDER - 1] * yn;\n"
+    "        y[n] = yn;\n"
+    "    }\n"
+    "}\n",
+    // CASCADE (jak CASCADE_ip_f)
+    "void rs_kernel(T *x, T *y, int N) {\n"
+    "    T *in = x;\n"
+    "    for (int s = 0; s < SECTIONS; ++s) {\n"
+    "        T b0 = sos[s * 6 + 0], b1 = sos[s * 6 + 1], b2 = sos[s * 6 + 2];\n"
+    "        T a1 = sos[s * 6 + 4], a2 = sos[s * 6 + 5];\n"
+    "        T w1 = 0.0f, w2 = 0.0f;\n"
+    "        for (int n = 0; n < N; ++n) {\n"
+    "            T wn = in[n] - a1 * w1 - a2 * w2;\n"
+    "            y[n] = b0 * wn + b1 * w1 + b2 * w2;\n"
+    "            w2 = w1;\n"
+    "            w1 = wn;\n"
+    "        }\n"
+    "        in = y;\n"
+    "    }\n"
+    "}\n",
+};
+
+static const char *body_fixed[4] = {
+    // DF1
+    "void rs_kernel(T *x, T *y, int N) {\n"
+    "    for (int n = 0; n < N; ++n) {\n"
+    "        ACC acc = 0;\n"
+    "        for (int i = 0; i < ORDER; ++i) {\n"
+    "            if (n - i >= 0)\n"
+    "                acc = add_s(acc, mul_s(b[i], x[n - i]));\n"
+    "            if (i > 0 && n - i >= 0)\n"
+    "                acc = sub_s(acc, mul_s(a[i], y[n - i]));\n"
+    "        }\n"
+    "        y[n] = sat(acc);\n"
+    "    }\n"
+    "}\n",
+    // DF2
+    "void rs_kernel(T *x, T *y, int N) {\n"
+    "    ACC w[ORDER] = {0};\n"
+    "    for (int n = 0; n < N; ++n) {\n"
+    "        w[0] = x[n];\n"
+    "        for (int i = 1; i < ORDER; ++i)\n"
+    "            w[0] = sub_s(w[0], mul_s(a[i], w[i]));\n"
+    "        ACC acc = 0;\n"
+    "        for (int i = 0; i < ORDER; ++i)\n"
+    "            acc = add_s(acc, mul_s(b[i], w[i]));\n"
+    "        y[n] = sat(acc);\n"
+    "        for (int i = ORDER - 1; i > 0; --i)\n"
+    "            w[i] = w[i - 1];\n"
+    "    }\n"
+    "}\n",
+    // TDF2
+    "void rs_kernel(T *x, T *y, int N) {\n"
+    "    ACC w[ORDER] = {0};\n"
+    "    for (int n = 0; n < N; ++n) {\n"
+    "        ACC acc = add_s(w[0], mul_s(b[0], x[n]));\n"
+    "        for (int i = 0; i < ORDER - 2; ++i)\n"
+    "            w[i] = add_s(sub_s(w[i + 1], mul_s(a[i + 1], acc)), mul_s(b[i + 1], x[n]));\n"
+    "        w[ORDER - 2] = sub_s(mul_s(b[ORDER - 1], x[n]), mul_s(a[ORDER - 1], acc));\n"
+    "        y[n] = sat(acc);\n"
+    "    }\n"
+    "}\n",
+    // CASCADE (jak CASCADE_ip_q12; dla Q24 body_cascade_q24)
+    "void rs_kernel(T *x, T *y, int N) {\n"
+    "    T *in = x;\n"
+    "    for (int s = 0; s < SECTIONS; ++s) {\n"
+    "        T b0 = sos[s * 6 + 0], b1 = sos[s * 6 + 1], b2 = sos[s * 6 + 2];\n"
+    "        T a1 = sos[s * 6 + 4], a2 = sos[s * 6 + 5];\n"
+    "        ACC w1 = 0, w2 = 0;\n"
+    "        for (int n = 0; n < N; ++n) {\n"
+    "            ACC wn = sub_s(in[n], add_s(mul_s(a1, w1), mul_s(a2, w2)));\n"
+    "            y[n] = add_s(add_s(mul_s(b0, wn), mul_s(b1, w1)), mul_s(b2, w2));\n"
+    "            w2 = w1;\n"
+    "            w1 = wn;\n"
+    "        }\n"
+    "        in = y;\n"
+    "    }\n"
+    "}\n",
+};
+
+// CASCADE_ip_q24 saturuje tylko część operacji (a1 * w1, b0 * wn i suma wyjściowa
+// bez saturacji, z zawijaniem) - osobny szablon, żeby wynik był identyczny z biblioteką
+static const char *body_cascade_q24 =
+    "void rs_kernel(T *x, T *y, int N) {\n"
+    "    T *in = x;\n"
+    "    for (int s = 0; s < SECTIONS; ++s) {\n"
+    "        T b0 = sos[s * 6 + 0], b1 = sos[s * 6 + 1], b2 = sos[s * 6 + 2];\n"
+    "        T a1 = sos[s * 6 + 4], a2 = sos[s * 6 + 5];\n"
+    "        ACC w1 = 0, w2 = 0;\n"
+    "        for (int n = 0; n < N; ++n) {\n"
+    "            ACC wn = sub_s(in[n], add_s(mul(a1, w1), mul_s(a2, w2)));\n"
+    "            y[n] = add(add_s(mul(b0, wn), mul_s(b1, w1)), mul_s(b2, w2));\n"
+    "            w2 = w1;\n"
+    "            w1 = wn;\n"
+    "        }\n"
+    "        in = y;\n"
+    "    }\n"
+    "}\n";
+
+// === Pomocnicze ===
+static size_t dtype_size(rs_dtype dtype) {
+    switch (dtype) {
+        case RS_FLOAT: return sizeof(float);
+        case RS_Q12:   return sizeof(int16_t);
+        default:       return sizeof(int32_t);
+    }
+}
+
+static const char *env_or(const char *name, const char *def) {
+    const char *v = getenv(name);
+    return (v && *v) ? v : def;
+}
+
+// FNV-1a 64
+static uint64_t fnv1a(uint64_t h, const void *data, size_t len) {
+    const unsigned char *p = data;
+    for (size_t i = 0; i < len; ++i) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// Tablica współczynników jako inicjalizator C (float w zapisie szesnastkowym - dokładnie)
+static void write_array(FILE *f, const char *name, rs_dtype dtype, const void *v, int n) {
+    static const char *ctype[] = {"float", "int16_t", "int32_t"};
+    fprintf(f, "static const %s %s[%d] = {", ctype[dtype], name, n);
+    for (int i = 0; i < n; ++i) {
+        if (i) fprintf(f, ", ");
+        if (dtype == RS_FLOAT) fprintf(f, "%af", ((const float *)v)[i]);
+        else if (dtype == RS_Q12) fprintf(f, "%d", ((const int16_t *)v)[i]);
+        else fprintf(f, "%ld", (long)((const int32_t *)v)[i]);
+    }
+    fprintf(f, "};\n");
+}
+
+static rs_kernel rs_build(rs_structure structure, rs_dtype dtype,
+                          const void *c0, const void *c1, int count, int order) {
+#ifdef _WIN32
+    (void)structure; (void)dtype; (void)c0; (void)c1; (void)count; (void)order;
+    return NULL;
+#else
+    const char *dir = env_or("RS_CACHE_DIR", "./rs_cache");
+    const char *cc = env_or("RS_CC", "cc");
+    const char *cflags = env_or("RS_CFLAGS", "-O3 -march=native");
+    size_t bytes = dtype_size(dtype) * (size_t)count;
+
+    // Klucz: wersja szablonów, kompilator i flagi, konfiguracja, współczynniki
+    uint64_t h = 14695981039346656037ULL;
+    int cfg[3] = {(int)structure, (int)dtype, order};
+    h = fnv1a(h, RS_VERSION, strlen(RS_VERSION));
+    h = fnv1a(h, cc, strlen(cc));
+    h = fnv1a(h, cflags, strlen(cflags));
+    h = fnv1a(h, cfg, sizeof(cfg));
+    h = fnv1a(h, c0, bytes);
+    if (c1) h = fnv1a(h, c1, bytes);
+
+    char so_path[1024], tmp_so[1100], src_path[1100], cmd[4096];
+    snprintf(so_path, sizeof(so_path), "%s/rs_%016llx.so", dir, (unsigned long long)h);
+
+    if (access(so_path, R_OK) != 0) {
+        mkdir(dir, 0755);
+        snprintf(src_path, sizeof(src_path), "%s/rs_%016llx_%d.c", dir, (unsigned long long)h, (int)getpid());
+        snprintf(tmp_so, sizeof(tmp_so), "%s/rs_%016llx_%d.so", dir, (unsigned long long)h, (int)getpid());
+
+        FILE *f = fopen(src_path, "w");
+        if (!f) return NULL;
+        fprintf(f, "%s", dtype == RS_FLOAT ? prelude_float : (dtype == RS_Q12 ? prelude_q12 : prelude_q24));
+        if (structure == RS_CASCADE) {
+            fprintf(f, "#define SECTIONS %d\n", order);
+            write_array(f, "sos", dtype, c0, count);
+        } else {
+            fprintf(f, "#define ORDER %d\n", order);
+            write_array(f, "b", dtype, c0, count);
+            write_array(f, "a", dtype, c1, count);
+        }
+        if (dtype == RS_FLOAT) fprintf(f, "%s", body_float[structure]);
+        else if (dtype == RS_Q24 && structure == RS_CASCADE) fprintf(f, "%s", body_cascade_q24);
+        else fprintf(f, "%s", body_fixed[structure]);
+        fclose(f);
+
+        snprintf(cmd, sizeof(cmd), "%s %s -shared -fPIC -o \"%s\" \"%s\"", cc, cflags, tmp_so, src_path);
+        int rc = system(cmd);
+        remove(src_path);
+        // rename jest atomowe, więc równoległe procesy nie zobaczą niepełnego pliku
+        if (rc != 0 || rename(tmp_so, so_path) != 0) {
+            remove(tmp_so);
+            return NULL;
+        }
+    }
+
+    void *lib = dlopen(so_path, RTLD_NOW | RTLD_LOCAL);
+    if (!lib) return NULL;
+    return (rs_kernel)dlsym(lib, "rs_kernel");
+#endif
+}
+
+rs_kernel rs_specialize_ba(rs_structure structure, rs_dtype dtype, const void *b, const void *a, int order) {
+    if (structure == RS_CASCADE || order < 2) return NULL;
+    return rs_build(structure, dtype, b, a, order, order);
+}
+
+rs_kernel rs_specialize_sos(rs_dtype dtype, const void *sos, int sections) {
+    if (sections < 1) return NULL;
+    return rs_build(RS_CASCADE, dtype, sos, NULL, 6 * sections, sections);
+}
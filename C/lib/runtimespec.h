@@ -0,0 +1,34 @@
+#ifndef RUNTIMESPEC_H
+#define RUNTIMESPEC_H
+
+#include <stddef.h>
+
+// Specjalizacja kerneli w czasie działania programu.
+// Dla jednej konfiguracji (struktura, typ, rząd, współczynniki) generowany jest kod C
+// ze współczynnikami jako stałymi, kompilowany lokalnym kompilatorem do biblioteki
+// współdzielonej i ładowany przez dlopen. Biblioteki trzymane są w katalogu cache
+// pod nazwą z hasza konfiguracji, więc kolejne uruchomienia tylko je ładują.
+//
+// Kod generowany jest według kerneli z structures.c (float) oraz structuresQ12s.c /
+// structuresQ24s.c (z saturacją; liczniki przepełnień nie są aktualizowane).
+// CASCADE liczony jak CASCADE_ip_* (x nie jest nadpisywane).
+//
+// Zmienne środowiskowe:
+//   RS_CACHE_DIR - katalog cache (domyślnie ./rs_cache)
+//   RS_CC        - kompilator (domyślnie cc)
+//   RS_CFLAGS    - flagi kompilacji (domyślnie -O3 -march=native)
+// Gdy specjalizacja się nie powiedzie (brak kompilatora, Windows), zwracane jest NULL
+// i wywołujący powinien użyć kernela ogólnego.
+
+typedef enum { RS_DF1, RS_DF2, RS_TDF2, RS_CASCADE } rs_structure;
+typedef enum { RS_FLOAT, RS_Q12, RS_Q24 } rs_dtype;
+
+// x, y typu float / q12 / q24 zgodnie z dtype
+typedef void (*rs_kernel)(void *x, void *y, int N);
+
+// b, a: order współczynników (konwencja jak w structures.h) typu zgodnego z dtype
+rs_kernel rs_specialize_ba(rs_structure structure, rs_dtype dtype, const void *b, const void *a, int order);
+// sos: sections * 6 współczynników
+rs_kernel rs_specialize_sos(rs_dtype dtype, const void *sos, int sections);
+
+#endif // RUNTIMESPEC_H
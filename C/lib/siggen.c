@@ -0,0 +1,261 @@
+#include <math.h>
+#include <string.h>
+#include "siggen.h"
+
+// Bez łączenia a * b + c w FMA - inaczej wynik zależałby od -march i kompilatora
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#elif defined(_MSC_VER)
+#pragma fp_contract(off)
+#endif
+
+#define SG_CHUNK 256           // bufor pośredni dla float / Q
+#define SG_PINK_GAIN 0.3294    // RMS szumu różowego = RMS szumu białego [-1, 1) (1 / sqrt(3))
+#define SG_2PI 6.28318530717958647692
+
+// === xoshiro256+ ===
+static inline uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static void rng_seed(sg_rng *r, uint64_t seed) {
+    uint64_t sm = seed;
+    for (int l = 0; l < SG_LANES; ++l)
+        for (int w = 0; w < 4; ++w)
+            r->s[w][l] = splitmix64(&sm);
+}
+
+// Jeden krok wszystkich strumieni: out[l] = wyjście strumienia l
+static inline void rng_step(sg_rng *r, uint64_t *out) {
+    for (int l = 0; l < SG_LANES; ++l) {
+        uint64_t t = r->s[1][l] << 17;
+        out[l] = r->s[0][l] + r->s[3][l];
+        r->s[2][l] ^= r->s[0][l];
+        r->s[3][l] ^= r->s[1][l];
+        r->s[1][l] ^= r->s[2][l];
+        r->s[0][l] ^= r->s[3][l];
+        r->s[2][l] ^= t;
+        r->s[3][l] = rotl(r->s[3][l], 45);
+    }
+}
+
+static void rng_fill(siggen *g, uint64_t *out, int n) {
+    int i = 0;
+    while (i < n && g->npend > 0) out[i++] = g->pend[SG_LANES - g->npend--];
+    for (; i + SG_LANES <= n; i += SG_LANES) rng_step(&g->rng, out + i);
+    if (i < n) {
+        rng_step(&g->rng, g->pend);
+        g->npend = SG_LANES;
+        while (i < n) out[i++] = g->pend[SG_LANES - g->npend--];
+    }
+}
+
+// 53 górne bity -> [-1, 1), dokładnie
+static inline double u_signed(uint64_t u) {
+    return (double)(int64_t)(u >> 11) * 0x1.0p-52 - 1.0;
+}
+
+// 53 górne bity -> (0, 1], dokładnie
+static inline double u_open0(uint64_t u) {
+    return (double)(int64_t)((u >> 11) + 1) * 0x1.0p-53;
+}
+
+// === Funkcje elementarne (bez libm) ===
+// sin / cos kąta t w okresach; redukcja do ćwiartki jest dokładna
+static void sincos_turns(double t, double *s, double *c) {
+    t -= floor(t);
+    double q = floor(t * 4.0 + 0.5);
+    double x = (t - q * 0.25) * SG_2PI;   // |x| <= pi / 4
+    double x2 = x * x;
+
+    double ps = x * (1.0 + x2 * (-1.0 / 6 + x2 * (1.0 / 120 + x2 * (-1.0 / 5040 + x2 * (1.0 / 362880
+              + x2 * (-1.0 / 39916800 + x2 * (1.0 / 6227020800.0)))))));
+    double pc = 1.0 + x2 * (-0.5 + x2 * (1.0 / 24 + x2 * (-1.0 / 720 + x2 * (1.0 / 40320
+              + x2 * (-1.0 / 3628800 + x2 * (1.0 / 479001600.0 + x2 * (-1.0 / 87178291200.0)))))));
+
+    switch ((int)q & 3) {
+    case 0: *s = ps;  *c = pc;  break;
+    case 1: *s = pc;  *c = -ps; break;
+    case 2: *s = -ps; *c = -pc; break;
+    default: *s = -pc; *c = ps; break;
+    }
+}
+
+#define SG_LN2_HI 6.93147180369123816490e-01  // 32 bity mantysy, k * LN2_HI dokładne
+#define SG_LN2_LO 1.90821492927058770002e-10
+
+static double sg_exp(double x) {
+    double k = floor(x * 1.44269504088896338700 + 0.5);
+    double r = (x - k * SG_LN2_HI) - k * SG_LN2_LO;   // |r| <= ln2 / 2
+    double p = 1.0;
+    for (int i = 13; i >= 1; --i) p = 1.0 + p * r / i;
+    return ldexp(p, (int)k);
+}
+
+static double sg_log(double x) {
+    int e;
+    double m = frexp(x, &e);
+    if (m < 0.70710678118654752440) {
+        m *= 2.0;
+        --e;
+    }
+    double s = (m - 1.0) / (m + 1.0);   // |s| <= 0.172
+    double s2 = s * s;
+    double p = 0.0;
+    for (int i = 19; i >= 1; i -= 2) p = 1.0 / i + s2 * p;
+    return e * SG_LN2_HI + (e * SG_LN2_LO + 2.0 * s * p);
+}
+
+// === Inicjalizacja ===
+void siggen_init(siggen *g, sg_kind kind, uint64_t seed, double amp,
+                 double f0, double f1, double fs, long length) {
+    memset(g, 0, sizeof(*g));
+    g->kind = kind;
+    g->amp = amp;
+    g->length = length > 1 ? length : 1;
+    rng_seed(&g->rng, seed);
+
+    if (fs > 0.0) {
+        g->freq0 = g->freq = f0 / fs;
+        g->ratio = 1.0;
+        if (kind == SG_CHIRP && f0 > 0.0 && f1 > 0.0 && length > 1)
+            g->ratio = sg_exp(sg_log(f1 / f0) / (double)(length - 1));
+    }
+}
+
+const char *siggen_kind_name(sg_kind kind) {
+    switch (kind) {
+    case SG_WHITE: return "white";
+    case SG_PINK: return "pink";
+    case SG_GAUSS: return "gauss";
+    case SG_SINE: return "sine";
+    case SG_CHIRP: return "chirp";
+    case SG_IMPULSE: return "impulse";
+    default: return "step";
+    }
+}
+
+// === Generowanie (double) ===
+static void gen_white(siggen *g, double *x, int n, double gain) {
+    uint64_t u[SG_CHUNK];
+    for (int i = 0; i < n; i += SG_CHUNK) {
+        int len = (n - i < SG_CHUNK) ? n - i : SG_CHUNK;
+        rng_fill(g, u, len);
+        for (int k = 0; k < len; ++k) x[i + k] = gain * u_signed(u[k]);
+    }
+}
+
+static void gen_pink(siggen *g, double *x, int n) {
+    double *b = g->pink;
+    gen_white(g, x, n, 1.0);
+    for (int i = 0; i < n; ++i) {
+        double w = x[i];
+        b[0] = 0.99886 * b[0] + w * 0.0555179;
+        b[1] = 0.99332 * b[1] + w * 0.0750759;
+        b[2] = 0.96900 * b[2] + w * 0.1538520;
+        b[3] = 0.86650 * b[3] + w * 0.3104856;
+        b[4] = 0.55000 * b[4] + w * 0.5329522;
+        b[5] = -0.7616 * b[5] + w * -0.0168980;  // nie "- w * c": GCC skleja add/sub w vfmsubadd
+        double p = b[0] + b[1] + b[2] + b[3] + b[4] + b[5] + b[6] + w * 0.5362;
+        b[6] = w * 0.115926;
+        x[i] = g->amp * SG_PINK_GAIN * p;
+    }
+}
+
+static void gen_gauss(siggen *g, double *x, int n) {
+    uint64_t u[2];
+    int i = 0;
+    if (i < n && g->has_spare) {
+        x[i++] = g->spare;
+        g->has_spare = 0;
+    }
+    while (i < n) {
+        double s, c;
+        rng_fill(g, u, 2);
+        double r = g->amp * sqrt(-2.0 * sg_log(u_open0(u[0])));
+        sincos_turns((double)(int64_t)(u[1] >> 11) * 0x1.0p-53, &s, &c);
+        x[i++] = r * c;
+        if (i < n) {
+            x[i++] = r * s;
+        } else {
+            g->spare = r * s;
+            g->has_spare = 1;
+        }
+    }
+}
+
+static void gen_tone(siggen *g, double *x, int n) {
+    for (int i = 0; i < n; ++i) {
+        double s, c;
+        sincos_turns(g->phase, &s, &c);
+        x[i] = g->amp * s;
+
+        g->phase += g->freq;
+        g->phase -= floor(g->phase);
+        if (g->kind == SG_CHIRP) {
+            g->freq *= g->ratio;
+            if ((g->pos + i + 1) % g->length == 0) g->freq = g->freq0;
+        }
+    }
+}
+
+void siggen_block_d(siggen *g, double *x, int n) {
+    if (n <= 0) return;
+
+    switch (g->kind) {
+    case SG_WHITE: gen_white(g, x, n, g->amp); break;
+    case SG_PINK: gen_pink(g, x, n); break;
+    case SG_GAUSS: gen_gauss(g, x, n); break;
+    case SG_SINE:
+    case SG_CHIRP: gen_tone(g, x, n); break;
+    case SG_IMPULSE:
+        for (int i = 0; i < n; ++i) x[i] = (g->pos + i == 0) ? g->amp : 0.0;
+        break;
+    case SG_STEP:
+        for (int i = 0; i < n; ++i) x[i] = g->amp;
+        break;
+    }
+    g->pos += n;
+}
+
+// === Inne formaty ===
+void siggen_block_f(siggen *g, float *x, int n) {
+    double tmp[SG_CHUNK];
+    for (int i = 0; i < n; i += SG_CHUNK) {
+        int len = (n - i < SG_CHUNK) ? n - i : SG_CHUNK;
+        siggen_block_d(g, tmp, len);
+        for (int k = 0; k < len; ++k) x[i + k] = (float)tmp[k];
+    }
+}
+
+static inline double to_fixed(double v, int frac, double lo, double hi) {
+    v = floor(ldexp(v, frac) + 0.5);
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+void siggen_block_q32(siggen *g, int32_t *x, int n, int frac) {
+    double tmp[SG_CHUNK];
+    for (int i = 0; i < n; i += SG_CHUNK) {
+        int len = (n - i < SG_CHUNK) ? n - i : SG_CHUNK;
+        siggen_block_d(g, tmp, len);
+        for (int k = 0; k < len; ++k) x[i + k] = (int32_t)to_fixed(tmp[k], frac, INT32_MIN, INT32_MAX);
+    }
+}
+
+void siggen_block_q16(siggen *g, int16_t *x, int n, int frac) {
+    double tmp[SG_CHUNK];
+    for (int i = 0; i < n; i += SG_CHUNK) {
+        int len = (n - i < SG_CHUNK) ? n - i : SG_CHUNK;
+        siggen_block_d(g, tmp, len);
+        for (int k = 0; k < len; ++k) x[i + k] = (int16_t)to_fixed(tmp[k], frac, INT16_MIN, INT16_MAX);
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef SIGGEN_H
+#define SIGGEN_H
+
+#include <stdint.h>
+
+// Generator sygnałów testowych dla programów TimeAnalysis i PrecisionAnalysis (zamiast rand()).
+// Losowość: xoshiro256+ w SG_LANES niezależnych strumieniach (ziarna z splitmix64),
+// stan w układzie struktura-tablic, więc krok wszystkich strumieni kompilator wektoryzuje.
+// Próbka i pochodzi ze strumienia i % SG_LANES - SG_LANES jest częścią definicji sekwencji.
+// Wynik jest bitowo identyczny na każdej platformie z arytmetyką IEEE 754 (SSE2, ARM64):
+//   - liczby losowe to operacje całkowite, zamiana na double jest dokładna,
+//   - sin/cos/exp/log to własne wielomiany (bez libm), kolejność działań ustalona,
+//   - siggen.c jest kompilowany bez łączenia mnożenia i dodawania w FMA.
+// Sygnał zależy tylko od ziarna i parametrów, nie od podziału na bloki:
+// kilka wywołań siggen_block_* po kolei daje to samo, co jedno wywołanie na całość.
+
+#define SG_LANES 4
+#define SIGGEN_SEED 12345u
+
+typedef enum {
+    SG_WHITE,    // równomierny w [-amp, amp)
+    SG_PINK,     // 1/f (filtr Kelleta na szumie białym), RMS jak SG_WHITE
+    SG_GAUSS,    // normalny (Box-Muller), odchylenie standardowe amp
+    SG_SINE,     // amp * sin(2 pi f0 n / fs)
+    SG_CHIRP,    // przemiatanie logarytmiczne f0 -> f1 w length próbkach, potem od nowa
+    SG_IMPULSE,  // amp w n = 0, potem 0
+    SG_STEP      // amp od n = 0
+} sg_kind;
+
+typedef struct {
+    uint64_t s[4][SG_LANES];
+} sg_rng;
+
+typedef struct {
+    sg_kind kind;
+    double amp;
+    long pos;                     // numer następnej próbki
+    long length;                  // SG_CHIRP: długość przemiatania
+    double phase;                 // SG_SINE / SG_CHIRP: faza w okresach, [0, 1)
+    double freq, freq0, ratio;    // okresy na próbkę; SG_CHIRP: freq *= ratio co próbkę
+    double pink[7];
+    double spare;                 // SG_GAUSS: druga wartość pary Box-Mullera
+    int has_spare;
+    sg_rng rng;
+    uint64_t pend[SG_LANES];      // niewykorzystane wyjścia ostatniego kroku strumieni
+    int npend;
+} siggen;
+
+// f0, f1 [Hz], fs i length używane tylko przez SG_SINE (f0, fs) i SG_CHIRP
+void siggen_init(siggen *g, sg_kind kind, uint64_t seed, double amp,
+                 double f0, double f1, double fs, long length);
+
+void siggen_block_d(siggen *g, double *x, int n);
+void siggen_block_f(siggen *g, float *x, int n);
+// Formaty Q: x * 2^frac, zaokrąglenie do najbliższej, nasycenie do zakresu typu
+void siggen_block_q32(siggen *g, int32_t *x, int n, int frac);
+void siggen_block_q16(siggen *g, int16_t *x, int n, int frac);
+
+const char *siggen_kind_name(sg_kind kind);
+
+#endif // SIGGEN_H
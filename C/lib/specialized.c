@@ -0,0 +1,292 @@
+#include "specialized.h"
+#include "structures.h"
+
+// Ciała kernelów przyjmują liczbę współczynników K jako argument; wywołane ze stałą
+// i wymuszonym inline'owaniem dają osobną, rozwiniętą kopię dla każdego rzędu
+// (odpowiednik szablonu). Tablice lokalne o stałym rozmiarze kompilator trzyma w rejestrach.
+#define SPEC_INLINE static inline __attribute__((always_inline))
+#define SPEC_UNROLL _Pragma("GCC unroll 16")
+
+// === DF1 (float) ===
+SPEC_INLINE void df1_body_f(float *x, float *y, float *b, float *a, int N, const int K) {
+    float bc[K], ac[K];
+    SPEC_UNROLL
+    for (int i = 0; i < K; ++i) {
+        bc[i] = b[i];
+        ac[i] = a[i];
+    }
+
+    // Prolog: próbki bez pełnej historii, dokładnie jak w DF1_f
+    int n0 = (N < K - 1) ? N : K - 1;
+    for (int n = 0; n < n0; ++n) {
+        float yn = 0.0f;
+        for (int i = 0; i <= n; ++i) {
+            yn += bc[i] * x[n - i];
+            if (i > 0) yn -= ac[i] * y[n - i];
+        }
+        y[n] = yn;
+    }
+    if (n0 < K - 1) return;
+
+    // Historia w rejestrach: xh[i] = x[n - i], yh[i] = y[n - i]
+    float xh[K], yh[K];
+    yh[0] = 0.0f;  // nieużywane, ale przesuwane do yh[1] przed nadpisaniem
+    SPEC_UNROLL
+    for (int i = 1; i < K; ++i) {
+        xh[i] = x[K - 1 - i];
+        yh[i] = y[K - 1 - i];
+    }
+
+    for (int n = K - 1; n < N; ++n) {
+        xh[0] = x[n];
+        float yn = 0.0f;
+        SPEC_UNROLL
+        for (int i = 0; i < K; ++i) {
+            yn += bc[i] * xh[i];
+            if (i > 0) yn -= ac[i] * yh[i];
+        }
+        y[n] = yn;
+        SPEC_UNROLL
+        for (int i = K - 1; i > 0; --i) {
+            xh[i] = xh[i - 1];
+            yh[i] = yh[i - 1];
+        }
+        yh[1] = yn;
+    }
+}
+
+// === DF2 (float) ===
+SPEC_INLINE void df2_body_f(float *x, float *y, float *b, float *a, int N, const int K) {
+    float bc[K], ac[K], w[K];
+    SPEC_UNROLL
+    for (int i = 0; i < K; ++i) {
+        bc[i] = b[i];
+        ac[i] = a[i];
+        w[i] = 0.0f;
+    }
+
+    for (int n = 0; n < N; ++n) {
+        w[0] = x[n];
+        SPEC_UNROLL
+        for (int i = 1; i < K; ++i)
+            w[0] -= ac[i] * w[i];
+        float yn = 0.0f;
+        SPEC_UNROLL
+        for (int i = 0; i < K; ++i)
+            yn += bc[i] * w[i];
+        y[n] = yn;
+        SPEC_UNROLL
+        for (int i = K - 1; i > 0; --i)
+            w[i] = w[i - 1];
+    }
+}
+
+// === TDF2 (float) ===
+SPEC_INLINE void tdf2_body_f(float *x, float *y, float *b, float *a, int N, const int K) {
+    float bc[K], ac[K], w[K - 1];
+    SPEC_UNROLL
+    for (int i = 0; i < K; ++i) {
+        bc[i] = b[i];
+        ac[i] = a[i];
+    }
+    SPEC_UNROLL
+    for (int i = 0; i < K - 1; ++i)
+        w[i] = 0.0f;
+
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float yn = w[0] + bc[0] * xn;
+        SPEC_UNROLL
+        for (int i = 0; i < K - 2; ++i)
+            w[i] = w[i + 1] + bc[i + 1] * xn - ac[i + 1] * yn;
+        w[K - 2] = bc[K - 1] * xn - ac[K - 1] * yn;
+        y[n] = yn;
+    }
+}
+
+void DF1_o2_f(float *x, float *y, float *b, float *a, int N) { df1_body_f(x, y, b, a, N, 3); }
+void DF1_o4_f(float *x, float *y, float *b, float *a, int N) { df1_body_f(x, y, b, a, N, 5); }
+void DF1_o6_f(float *x, float *y, float *b, float *a, int N) { df1_body_f(x, y, b, a, N, 7); }
+void DF1_o8_f(float *x, float *y, float *b, float *a, int N) { df1_body_f(x, y, b, a, N, 9); }
+
+void DF1_spec_f(float *x, float *y, float *b, float *a, int N, int order) {
+    switch (order) {
+        case 3: DF1_o2_f(x, y, b, a, N); break;
+        case 5: DF1_o4_f(x, y, b, a, N); break;
+        case 7: DF1_o6_f(x, y, b, a, N); break;
+        case 9: DF1_o8_f(x, y, b, a, N); break;
+        default: DF1_f(x, y, b, a, N, order); break;
+    }
+}
+
+void DF2_o2_f(float *x, float *y, float *b, float *a, int N) { df2_body_f(x, y, b, a, N, 3); }
+void DF2_o4_f(float *x, float *y, float *b, float *a, int N) { df2_body_f(x, y, b, a, N, 5); }
+void DF2_o6_f(float *x, float *y, float *b, float *a, int N) { df2_body_f(x, y, b, a, N, 7); }
+void DF2_o8_f(float *x, float *y, float *b, float *a, int N) { df2_body_f(x, y, b, a, N, 9); }
+
+void DF2_spec_f(float *x, float *y, float *b, float *a, int N, int order) {
+    switch (order) {
+        case 3: DF2_o2_f(x, y, b, a, N); break;
+        case 5: DF2_o4_f(x, y, b, a, N); break;
+        case 7: DF2_o6_f(x, y, b, a, N); break;
+        case 9: DF2_o8_f(x, y, b, a, N); break;
+        default: DF2_f(x, y, b, a, N, order); break;
+    }
+}
+
+void TDF2_o2_f(float *x, float *y, float *b, float *a, int N) { tdf2_body_f(x, y, b, a, N, 3); }
+void TDF2_o4_f(float *x, float *y, float *b, float *a, int N) { tdf2_body_f(x, y, b, a, N, 5); }
+void TDF2_o6_f(float *x, float *y, float *b, float *a, int N) { tdf2_body_f(x, y, b, a, N, 7); }
+void TDF2_o8_f(float *x, float *y, float *b, float *a, int N) { tdf2_body_f(x, y, b, a, N, 9); }
+
+void TDF2_spec_f(float *x, float *y, float *b, float *a, int N, int order) {
+    switch (order) {
+        case 3: TDF2_o2_f(x, y, b, a, N); break;
+        case 5: TDF2_o4_f(x, y, b, a, N); break;
+        case 7: TDF2_o6_f(x, y, b, a, N); break;
+        case 9: TDF2_o8_f(x, y, b, a, N); break;
+        default: TDF2_f(x, y, b, a, N, order); break;
+    }
+}
+
+// === DF1 (double) ===
+SPEC_INLINE void df1_body_d(double *x, double *y, double *b, double *a, int N, const int K) {
+    double bc[K], ac[K];
+    SPEC_UNROLL
+    for (int i = 0; i < K; ++i) {
+        bc[i] = b[i];
+        ac[i] = a[i];
+    }
+
+    // Prolog: próbki bez pełnej historii, dokładnie jak w DF1_d
+    int n0 = (N < K - 1) ? N : K - 1;
+    for (int n = 0; n < n0; ++n) {
+        double yn = 0.0;
+        for (int i = 0; i <= n; ++i) {
+            yn += bc[i] * x[n - i];
+            if (i > 0) yn -= ac[i] * y[n - i];
+        }
+        y[n] = yn;
+    }
+    if (n0 < K - 1) return;
+
+    // Historia w rejestrach: xh[i] = x[n - i], yh[i] = y[n - i]
+    double xh[K], yh[K];
+    yh[0] = 0.0;  // nieużywane, ale przesuwane do yh[1] przed nadpisaniem
+    SPEC_UNROLL
+    for (int i = 1; i < K; ++i) {
+        xh[i] = x[K - 1 - i];
+        yh[i] = y[K - 1 - i];
+    }
+
+    for (int n = K - 1; n < N; ++n) {
+        xh[0] = x[n];
+        double yn = 0.0;
+        SPEC_UNROLL
+        for (int i = 0; i < K; ++i) {
+            yn += bc[i] * xh[i];
+            if (i > 0) yn -= ac[i] * yh[i];
+        }
+        y[n] = yn;
+        SPEC_UNROLL
+        for (int i = K - 1; i > 0; --i) {
+            xh[i] = xh[i - 1];
+            yh[i] = yh[i - 1];
+        }
+        yh[1] = yn;
+    }
+}
+
+// === DF2 (double) ===
+SPEC_INLINE void df2_body_d(double *x, double *y, double *b, double *a, int N, const int K) {
+    double bc[K], ac[K], w[K];
+    SPEC_UNROLL
+    for (int i = 0; i < K; ++i) {
+        bc[i] = b[i];
+        ac[i] = a[i];
+        w[i] = 0.0;
+    }
+
+    for (int n = 0; n < N; ++n) {
+        w[0] = x[n];
+        SPEC_UNROLL
+        for (int i = 1; i < K; ++i)
+            w[0] -= ac[i] * w[i];
+        double yn = 0.0;
+        SPEC_UNROLL
+        for (int i = 0; i < K; ++i)
+            yn += bc[i] * w[i];
+        y[n] = yn;
+        SPEC_UNROLL
+        for (int i = K - 1; i > 0; --i)
+            w[i] = w[i - 1];
+    }
+}
+
+// === TDF2 (double) ===
+SPEC_INLINE void tdf2_body_d(double *x, double *y, double *b, double *a, int N, const int K) {
+    double bc[K], ac[K], w[K - 1];
+    SPEC_UNROLL
+    for (int i = 0; i < K; ++i) {
+        bc[i] = b[i];
+        ac[i] = a[i];
+    }
+    SPEC_UNROLL
+    for (int i = 0; i < K - 1; ++i)
+        w[i] = 0.0;
+
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = w[0] + bc[0] * xn;
+        SPEC_UNROLL
+        for (int i = 0; i < K - 2; ++i)
+            w[i] = w[i + 1] + bc[i + 1] * xn - ac[i + 1] * yn;
+        w[K - 2] = bc[K - 1] * xn - ac[K - 1] * yn;
+        y[n] = yn;
+    }
+}
+
+void DF1_o2_d(double *x, double *y, double *b, double *a, int N) { df1_body_d(x, y, b, a, N, 3); }
+void DF1_o4_d(double *x, double *y, double *b, double *a, int N) { df1_body_d(x, y, b, a, N, 5); }
+void DF1_o6_d(double *x, double *y, double *b, double *a, int N) { df1_body_d(x, y, b, a, N, 7); }
+void DF1_o8_d(double *x, double *y, double *b, double *a, int N) { df1_body_d(x, y, b, a, N, 9); }
+
+void DF1_spec_d(double *x, double *y, double *b, double *a, int N, int order) {
+    switch (order) {
+        case 3: DF1_o2_d(x, y, b, a, N); break;
+        case 5: DF1_o4_d(x, y, b, a, N); break;
+        case 7: DF1_o6_d(x, y, b, a, N); break;
+        case 9: DF1_o8_d(x, y, b, a, N); break;
+        default: DF1_d(x, y, b, a, N, order); break;
+    }
+}
+
+void DF2_o2_d(double *x, double *y, double *b, double *a, int N) { df2_body_d(x, y, b, a, N, 3); }
+void DF2_o4_d(double *x, double *y, double *b, double *a, int N) { df2_body_d(x, y, b, a, N, 5); }
+void DF2_o6_d(double *x, double *y, double *b, double *a, int N) { df2_body_d(x, y, b, a, N, 7); }
+void DF2_o8_d(double *x, double *y, double *b, double *a, int N) { df2_body_d(x, y, b, a, N, 9); }
+
+void DF2_spec_d(double *x, double *y, double *b, double *a, int N, int order) {
+    switch (order) {
+        case 3: DF2_o2_d(x, y, b, a, N); break;
+        case 5: DF2_o4_d(x, y, b, a, N); break;
+        case 7: DF2_o6_d(x, y, b, a, N); break;
+        case 9: DF2_o8_d(x, y, b, a, N); break;
+        default: DF2_d(x, y, b, a, N, order); break;
+    }
+}
+
+void TDF2_o2_d(double *x, double *y, double *b, double *a, int N) { tdf2_body_d(x, y, b, a, N, 3); }
+void TDF2_o4_d(double *x, double *y, double *b, double *a, int N) { tdf2_body_d(x, y, b, a, N, 5); }
+void TDF2_o6_d(double *x, double *y, double *b, double *a, int N) { tdf2_body_d(x, y, b, a, N, 7); }
+void TDF2_o8_d(double *x, double *y, double *b, double *a, int N) { tdf2_body_d(x, y, b, a, N, 9); }
+
+void TDF2_spec_d(double *x, double *y, double *b, double *a, int N, int order) {
+    switch (order) {
+        case 3: TDF2_o2_d(x, y, b, a, N); break;
+        case 5: TDF2_o4_d(x, y, b, a, N); break;
+        case 7: TDF2_o6_d(x, y, b, a, N); break;
+        case 9: TDF2_o8_d(x, y, b, a, N); break;
+        default: TDF2_d(x, y, b, a, N, order); break;
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef SPECIALIZED_H
+#define SPECIALIZED_H
+
+#include <stddef.h>
+
+// Wersje DF1/DF2/TDF2 wyspecjalizowane dla rzędów 2/4/6/8 (3/5/7/9 współczynników).
+// Liczba współczynników jest stałą kompilacji, więc pętle są w pełni rozwinięte,
+// a stan filtra trzymany jest w rejestrach zamiast w w[64]. DF1 ma wydzielony
+// prolog (pierwsze order - 1 próbek) i pętlę ustaloną bez warunków.
+// Kolejność działań jak w DF1_f/DF2_f/TDF2_f - wyniki bitowo identyczne przy
+// -ffp-contract=off (z kontrakcją do FMA mogą różnić się na poziomie zaokrągleń).
+// Funkcje *_spec_* wybierają specjalizację na podstawie order (konwencja jak
+// w structures.h); dla innych rzędów wywołują wersję ogólną.
+
+// === float ===
+void DF1_o2_f(float *x, float *y, float *b, float *a, int N);
+void DF1_o4_f(float *x, float *y, float *b, float *a, int N);
+void DF1_o6_f(float *x, float *y, float *b, float *a, int N);
+void DF1_o8_f(float *x, float *y, float *b, float *a, int N);
+void DF1_spec_f(float *x, float *y, float *b, float *a, int N, int order);
+
+void DF2_o2_f(float *x, float *y, float *b, float *a, int N);
+void DF2_o4_f(float *x, float *y, float *b, float *a, int N);
+void DF2_o6_f(float *x, float *y, float *b, float *a, int N);
+void DF2_o8_f(float *x, float *y, float *b, float *a, int N);
+void DF2_spec_f(float *x, float *y, float *b, float *a, int N, int order);
+
+void TDF2_o2_f(float *x, float *y, float *b, float *a, int N);
+void TDF2_o4_f(float *x, float *y, float *b, float *a, int N);
+void TDF2_o6_f(float *x, float *y, float *b, float *a, int N);
+void TDF2_o8_f(float *x, float *y, float *b, float *a, int N);
+void TDF2_spec_f(float *x, float *y, float *b, float *a, int N, int order);
+
+// === double ===
+void DF1_o2_d(double *x, double *y, double *b, double *a, int N);
+void DF1_o4_d(double *x, double *y, double *b, double *a, int N);
+void DF1_o6_d(double *x, double *y, double *b, double *a, int N);
+void DF1_o8_d(double *x, double *y, double *b, double *a, int N);
+void DF1_spec_d(double *x, double *y, double *b, double *a, int N, int order);
+
+void DF2_o2_d(double *x, double *y, double *b, double *a, int N);
+void DF2_o4_d(double *x, double *y, double *b, double *a, int N);
+void DF2_o6_d(double *x, double *y, double *b, double *a, int N);
+void DF2_o8_d(double *x, double *y, double *b, double *a, int N);
+void DF2_spec_d(double *x, double *y, double *b, double *a, int N, int order);
+
+void TDF2_o2_d(double *x, double *y, double *b, double *a, int N);
+void TDF2_o4_d(double *x, double *y, double *b, double *a, int N);
+void TDF2_o6_d(double *x, double *y, double *b, double *a, int N);
+void TDF2_o8_d(double *x, double *y, double *b, double *a, int N);
+void TDF2_spec_d(double *x, double *y, double *b, double *a, int N, int order);
+
+#endif // SPECIALIZED_H
@@ -0,0 +1,375 @@
+#include "streaming.h"
+#include <stddef.h>
+#include <string.h>
+
+// Wzmocnienie filtru dla składowej stałej: H(1) = sum(b) / sum(a)
+static double dc_gain_f(float *b, float *a, int order) {
+    double sb = 0.0, sa = 0.0;
+    for (int i = 0; i < order; ++i) {
+        sb += b[i];
+        sa += a[i];
+    }
+    return sb / sa;
+}
+
+static double dc_gain_d(double *b, double *a, int order) {
+    double sb = 0.0, sa = 0.0;
+    for (int i = 0; i < order; ++i) {
+        sb += b[i];
+        sa += a[i];
+    }
+    return sb / sa;
+}
+
+// === DF1 (float) ===
+void DF1_init_f(DF1_state_f *st, float *b, float *a, int order) {
+    st->b = b;
+    st->a = a;
+    st->order = order;
+    DF1_reset_f(st);
+}
+
+void DF1_reset_f(DF1_state_f *st) {
+    memset(st->xh, 0, sizeof(st->xh));
+    memset(st->yh, 0, sizeof(st->yh));
+}
+
+// Stan ustalony dla stałego wejścia x0 (brak stanu przejściowego na starcie)
+void DF1_steady_f(DF1_state_f *st, float x0) {
+    float y0 = (float)(dc_gain_f(st->b, st->a, st->order) * x0);
+    for (int i = 0; i < st->order; ++i) {
+        st->xh[i] = x0;
+        st->yh[i] = y0;
+    }
+}
+
+void DF1_block_f(DF1_state_f *st, float *x, float *y, int N) {
+    float *b = st->b, *a = st->a;
+    float *xh = st->xh, *yh = st->yh;
+    int order = st->order;
+
+    for (int n = 0; n < N; ++n) {
+        for (int i = order - 1; i > 0; --i)
+            xh[i] = xh[i - 1];
+        xh[0] = x[n];
+
+        float yn = 0.0f;
+        for (int i = 0; i < order; ++i) {
+            yn += b[i] * xh[i];
+            if (i > 0) yn -= a[i] * yh[i];
+        }
+
+        for (int i = order - 1; i > 1; --i)
+            yh[i] = yh[i - 1];
+        yh[1] = yn;
+        y[n] = yn;
+    }
+}
+
+// === DF2 (float) ===
+void DF2_init_f(DF2_state_f *st, float *b, float *a, int order) {
+    st->b = b;
+    st->a = a;
+    st->order = order;
+    DF2_reset_f(st);
+}
+
+void DF2_reset_f(DF2_state_f *st) {
+    memset(st->w, 0, sizeof(st->w));
+}
+
+void DF2_steady_f(DF2_state_f *st, float x0) {
+    double sa = 0.0;
+    for (int i = 0; i < st->order; ++i)
+        sa += st->a[i];
+    for (int i = 0; i < st->order; ++i)
+        st->w[i] = (float)(x0 / sa);
+}
+
+void DF2_block_f(DF2_state_f *st, float *x, float *y, int N) {
+    float *b = st->b, *a = st->a;
+    int order = st->order;
+    // Kopia lokalna jak w[64] w DF2_f: bez aliasingu z a kompilator mnoży a[i] * w[i]
+    // wektorowo i odejmuje bez FMA - tak samo jak w DF2_f, więc wynik bit w bit
+    float w[STREAM_MAX_ORDER];
+    memcpy(w, st->w, sizeof(w));
+
+    for (int n = 0; n < N; ++n) {
+        w[0] = x[n];
+        for (int i = 1; i < order; ++i)
+            w[0] -= a[i] * w[i];
+        y[n] = 0.0f;
+        for (int i = 0; i < order; ++i)
+            y[n] += b[i] * w[i];
+        for (int i = order - 1; i > 0; --i)
+            w[i] = w[i - 1];
+    }
+
+    memcpy(st->w, w, sizeof(w));
+}
+
+// === TDF2 (float) ===
+void TDF2_init_f(TDF2_state_f *st, float *b, float *a, int order) {
+    st->b = b;
+    st->a = a;
+    st->order = order;
+    TDF2_reset_f(st);
+}
+
+void TDF2_reset_f(TDF2_state_f *st) {
+    memset(st->w, 0, sizeof(st->w));
+}
+
+// w[k] = sum_{j>k} (b[j] * x0 - a[j] * y0)
+void TDF2_steady_f(TDF2_state_f *st, float x0) {
+    int order = st->order;
+    double y0 = dc_gain_f(st->b, st->a, order) * x0;
+    double acc = 0.0;
+    for (int k = order - 2; k >= 0; --k) {
+        acc += st->b[k + 1] * (double)x0 - st->a[k + 1] * y0;
+        st->w[k] = (float)acc;
+    }
+}
+
+void TDF2_block_f(TDF2_state_f *st, float *x, float *y, int N) {
+    float *b = st->b, *a = st->a, *w = st->w;
+    int order = st->order;
+
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float yn = w[0] + b[0] * xn;
+
+        for (int i = 0; i < order - 2; ++i) {
+            w[i] = w[i + 1] + b[i + 1] * xn - a[i + 1] * yn;
+        }
+
+        w[order - 2] = b[order - 1] * xn - a[order - 1] * yn;
+
+        y[n] = yn;
+    }
+}
+
+// === CASCADE (float) ===
+void CASCADE_init_f(CASCADE_state_f *st, float *sos, int sections) {
+    st->sos = sos;
+    st->sections = sections;
+    CASCADE_reset_f(st);
+}
+
+void CASCADE_reset_f(CASCADE_state_f *st) {
+    memset(st->w1, 0, sizeof(st->w1));
+    memset(st->w2, 0, sizeof(st->w2));
+}
+
+void CASCADE_steady_f(CASCADE_state_f *st, float x0) {
+    double u = x0;
+    for (int s = 0; s < st->sections; ++s) {
+        float *c = st->sos + s * 6;
+        double w = u / (1.0 + c[4] + c[5]);
+        st->w1[s] = (float)w;
+        st->w2[s] = (float)w;
+        u = (c[0] + c[1] + c[2]) * w;
+    }
+}
+
+// Sekcje przetwarzane kolejno na bloku; kolejne sekcje pracują w miejscu na y
+void CASCADE_block_f(CASCADE_state_f *st, float *x, float *y, int N) {
+    float *in = x;
+
+    for (int s = 0; s < st->sections; ++s) {
+        float b0 = st->sos[s * 6 + 0];
+        float b1 = st->sos[s * 6 + 1];
+        float b2 = st->sos[s * 6 + 2];
+        float a1 = st->sos[s * 6 + 4];
+        float a2 = st->sos[s * 6 + 5];
+        float w1 = st->w1[s], w2 = st->w2[s];
+
+        for (int n = 0; n < N; ++n) {
+            float wn = in[n] - a1 * w1 - a2 * w2;
+            y[n] = b0 * wn + b1 * w1 + b2 * w2;
+            w2 = w1;
+            w1 = wn;
+        }
+
+        st->w1[s] = w1;
+        st->w2[s] = w2;
+        in = y;
+    }
+
+    if (in != y) for (int i = 0; i < N; ++i) y[i] = in[i];
+}
+
+// === DF1 (double) ===
+void DF1_init_d(DF1_state_d *st, double *b, double *a, int order) {
+    st->b = b;
+    st->a = a;
+    st->order = order;
+    DF1_reset_d(st);
+}
+
+void DF1_reset_d(DF1_state_d *st) {
+    memset(st->xh, 0, sizeof(st->xh));
+    memset(st->yh, 0, sizeof(st->yh));
+}
+
+void DF1_steady_d(DF1_state_d *st, double x0) {
+    double y0 = dc_gain_d(st->b, st->a, st->order) * x0;
+    for (int i = 0; i < st->order; ++i) {
+        st->xh[i] = x0;
+        st->yh[i] = y0;
+    }
+}
+
+void DF1_block_d(DF1_state_d *st, double *x, double *y, int N) {
+    double *b = st->b, *a = st->a;
+    double *xh = st->xh, *yh = st->yh;
+    int order = st->order;
+
+    for (int n = 0; n < N; ++n) {
+        for (int i = order - 1; i > 0; --i)
+            xh[i] = xh[i - 1];
+        xh[0] = x[n];
+
+        double yn = 0.0;
+        for (int i = 0; i < order; ++i) {
+            yn += b[i] * xh[i];
+            if (i > 0) yn -= a[i] * yh[i];
+        }
+
+        for (int i = order - 1; i > 1; --i)
+            yh[i] = yh[i - 1];
+        yh[1] = yn;
+        y[n] = yn;
+    }
+}
+
+// === DF2 (double) ===
+void DF2_init_d(DF2_state_d *st, double *b, double *a, int order) {
+    st->b = b;
+    st->a = a;
+    st->order = order;
+    DF2_reset_d(st);
+}
+
+void DF2_reset_d(DF2_state_d *st) {
+    memset(st->w, 0, sizeof(st->w));
+}
+
+void DF2_steady_d(DF2_state_d *st, double x0) {
+    double sa = 0.0;
+    for (int i = 0; i < st->order; ++i)
+        sa += st->a[i];
+    for (int i = 0; i < st->order; ++i)
+        st->w[i] = x0 / sa;
+}
+
+void DF2_block_d(DF2_state_d *st, double *x, double *y, int N) {
+    double *b = st->b, *a = st->a;
+    int order = st->order;
+    // Kopia lokalna jak w[64] w DF2_d: bez aliasingu z a kompilator mnoży a[i] * w[i]
+    // wektorowo i odejmuje bez FMA - tak samo jak w DF2_d, więc wynik bit w bit
+    double w[STREAM_MAX_ORDER];
+    memcpy(w, st->w, sizeof(w));
+
+    for (int n = 0; n < N; ++n) {
+        w[0] = x[n];
+        for (int i = 1; i < order; ++i)
+            w[0] -= a[i] * w[i];
+        y[n] = 0.0;
+        for (int i = 0; i < order; ++i)
+            y[n] += b[i] * w[i];
+        for (int i = order - 1; i > 0; --i)
+            w[i] = w[i - 1];
+    }
+
+    memcpy(st->w, w, sizeof(w));
+}
+
+// === TDF2 (double) ===
+void TDF2_init_d(TDF2_state_d *st, double *b, double *a, int order) {
+    st->b = b;
+    st->a = a;
+    st->order = order;
+    TDF2_reset_d(st);
+}
+
+void TDF2_reset_d(TDF2_state_d *st) {
+    memset(st->w, 0, sizeof(st->w));
+}
+
+void TDF2_steady_d(TDF2_state_d *st, double x0) {
+    int order = st->order;
+    double y0 = dc_gain_d(st->b, st->a, order) * x0;
+    double acc = 0.0;
+    for (int k = order - 2; k >= 0; --k) {
+        acc += st->b[k + 1] * x0 - st->a[k + 1] * y0;
+        st->w[k] = acc;
+    }
+}
+
+void TDF2_block_d(TDF2_state_d *st, double *x, double *y, int N) {
+    double *b = st->b, *a = st->a, *w = st->w;
+    int order = st->order;
+
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = w[0] + b[0] * xn;
+
+        for (int i = 0; i < order - 2; ++i) {
+            w[i] = w[i + 1] + b[i + 1] * xn - a[i + 1] * yn;
+        }
+
+        w[order - 2] = b[order - 1] * xn - a[order - 1] * yn;
+
+        y[n] = yn;
+    }
+}
+
+// === CASCADE (double) ===
+void CASCADE_init_d(CASCADE_state_d *st, double *sos, int sections) {
+    st->sos = sos;
+    st->sections = sections;
+    CASCADE_reset_d(st);
+}
+
+void CASCADE_reset_d(CASCADE_state_d *st) {
+    memset(st->w1, 0, sizeof(st->w1));
+    memset(st->w2, 0, sizeof(st->w2));
+}
+
+void CASCADE_steady_d(CASCADE_state_d *st, double x0) {
+    double u = x0;
+    for (int s = 0; s < st->sections; ++s) {
+        double *c = st->sos + s * 6;
+        double w = u / (1.0 + c[4] + c[5]);
+        st->w1[s] = w;
+        st->w2[s] = w;
+        u = (c[0] + c[1] + c[2]) * w;
+    }
+}
+
+void CASCADE_block_d(CASCADE_state_d *st, double *x, double *y, int N) {
+    double *in = x;
+
+    for (int s = 0; s < st->sections; ++s) {
+        double b0 = st->sos[s * 6 + 0];
+        double b1 = st->sos[s * 6 + 1];
+        double b2 = st->sos[s * 6 + 2];
+        double a1 = st->sos[s * 6 + 4];
+        double a2 = st->sos[s * 6 + 5];
+        double w1 = st->w1[s], w2 = st->w2[s];
+
+        for (int n = 0; n < N; ++n) {
+            double wn = in[n] - a1 * w1 - a2 * w2;
+            y[n] = b0 * wn + b1 * w1 + b2 * w2;
+            w2 = w1;
+            w1 = wn;
+        }
+
+        st->w1[s] = w1;
+        st->w2[s] = w2;
+        in = y;
+    }
+
+    if (in != y) for (int i = 0; i < N; ++i) y[i] = in[i];
+}
@@ -0,0 +1,113 @@
+#ifndef STREAMING_H
+#define STREAMING_H
+
+#include <stddef.h>
+
+// Strumieniowe (blokowe) wersje struktur z structures.h.
+// Stan filtra przechowywany jest w obiekcie, dzięki czemu sygnał można
+// podawać w dowolnych blokach - wynik jest bitowo identyczny z jednym
+// wywołaniem DF1_f/DF2_f/TDF2_f/CASCADE_f na całym sygnale.
+// Pętle zapisane jak w structures.c, żeby kompilator tak samo łączył mnożenia
+// i dodawania w FMA (sprawdzone dla -O0..-O3, -march=native/haswell); inny kompilator
+// lub flagi mogą to rozróżnić na poziomie zaokrągleń - pewna zgodność przy
+// -ffp-contract=off. Tryb latency programu TimeAnalysis zlicza różne próbki.
+// Konwencja parametru order jak w structures.h (liczba współczynników = rząd + 1).
+
+#define STREAM_MAX_ORDER    64  // jak w[64] w structures.c
+#define STREAM_MAX_SECTIONS 32
+
+// === float ===
+typedef struct {
+    float *b, *a;
+    int order;
+    float xh[STREAM_MAX_ORDER];  // xh[i] = x[n - i]
+    float yh[STREAM_MAX_ORDER];  // yh[i] = y[n - i], yh[0] nieużywane
+} DF1_state_f;
+
+typedef struct {
+    float *b, *a;
+    int order;
+    float w[STREAM_MAX_ORDER];
+} DF2_state_f;
+
+typedef struct {
+    float *b, *a;
+    int order;
+    float w[STREAM_MAX_ORDER];
+} TDF2_state_f;
+
+typedef struct {
+    float *sos;
+    int sections;
+    float w1[STREAM_MAX_SECTIONS];
+    float w2[STREAM_MAX_SECTIONS];
+} CASCADE_state_f;
+
+void DF1_init_f(DF1_state_f *st, float *b, float *a, int order);
+void DF1_reset_f(DF1_state_f *st);
+void DF1_steady_f(DF1_state_f *st, float x0);
+void DF1_block_f(DF1_state_f *st, float *x, float *y, int N);
+
+void DF2_init_f(DF2_state_f *st, float *b, float *a, int order);
+void DF2_reset_f(DF2_state_f *st);
+void DF2_steady_f(DF2_state_f *st, float x0);
+void DF2_block_f(DF2_state_f *st, float *x, float *y, int N);
+
+void TDF2_init_f(TDF2_state_f *st, float *b, float *a, int order);
+void TDF2_reset_f(TDF2_state_f *st);
+void TDF2_steady_f(TDF2_state_f *st, float x0);
+void TDF2_block_f(TDF2_state_f *st, float *x, float *y, int N);
+
+void CASCADE_init_f(CASCADE_state_f *st, float *sos, int sections);
+void CASCADE_reset_f(CASCADE_state_f *st);
+void CASCADE_steady_f(CASCADE_state_f *st, float x0);
+void CASCADE_block_f(CASCADE_state_f *st, float *x, float *y, int N);
+
+// === double ===
+typedef struct {
+    double *b, *a;
+    int order;
+    double xh[STREAM_MAX_ORDER];
+    double yh[STREAM_MAX_ORDER];
+} DF1_state_d;
+
+typedef struct {
+    double *b, *a;
+    int order;
+    double w[STREAM_MAX_ORDER];
+} DF2_state_d;
+
+typedef struct {
+    double *b, *a;
+    int order;
+    double w[STREAM_MAX_ORDER];
+} TDF2_state_d;
+
+typedef struct {
+    double *sos;
+    int sections;
+    double w1[STREAM_MAX_SECTIONS];
+    double w2[STREAM_MAX_SECTIONS];
+} CASCADE_state_d;
+
+void DF1_init_d(DF1_state_d *st, double *b, double *a, int order);
+void DF1_reset_d(DF1_state_d *st);
+void DF1_steady_d(DF1_state_d *st, double x0);
+void DF1_block_d(DF1_state_d *st, double *x, double *y, int N);
+
+void DF2_init_d(DF2_state_d *st, double *b, double *a, int order);
+void DF2_reset_d(DF2_state_d *st);
+void DF2_steady_d(DF2_state_d *st, double x0);
+void DF2_block_d(DF2_state_d *st, double *x, double *y, int N);
+
+void TDF2_init_d(TDF2_state_d *st, double *b, double *a, int order);
+void TDF2_reset_d(TDF2_state_d *st);
+void TDF2_steady_d(TDF2_state_d *st, double x0);
+void TDF2_block_d(TDF2_state_d *st, double *x, double *y, int N);
+
+void CASCADE_init_d(CASCADE_state_d *st, double *sos, int sections);
+void CASCADE_reset_d(CASCADE_state_d *st);
+void CASCADE_steady_d(CASCADE_state_d *st, double x0);
+void CASCADE_block_d(CASCADE_state_d *st, double *x, double *y, int N);
+
+#endif // STREAMING_H
@@ -71,6 +71,214 @@ void CASCADE_f(float *x, float *y, float *sos, int N, int sections) {
     free(temp);
 }
 
+// Wariant bez alokacji: bufor roboczy (N próbek) podaje wywołujący.
+// Kolejność ping-pong dobrana tak, by ostatnia sekcja zapisywała do y,
+// więc x nie jest nadpisywane, a końcowa kopia nie jest potrzebna.
+void CASCADE_ws_f(float *x, float *y, float *sos, int N, int sections, float *work) {
+    float *in = x;
+
+    for (int s = 0; s < sections; ++s) {
+        float b0 = sos[s * 6 + 0];
+        float b1 = sos[s * 6 + 1];
+        float b2 = sos[s * 6 + 2];
+        float a1 = sos[s * 6 + 4];
+        float a2 = sos[s * 6 + 5];
+        float w1 = 0.0f, w2 = 0.0f;
+        float *out = ((sections - 1 - s) % 2 == 0) ? y : work;
+
+        for (int n = 0; n < N; ++n) {
+            float wn = in[n] - a1 * w1 - a2 * w2;
+            out[n] = b0 * wn + b1 * w1 + b2 * w2;
+            w2 = w1;
+            w1 = wn;
+        }
+        in = out;
+    }
+
+    if (in != y) for (int i = 0; i < N; ++i) y[i] = in[i];
+}
+
+// Wariant w miejscu: pierwsza sekcja x -> y, kolejne pracują na y (dozwolone x == y)
+void CASCADE_ip_f(float *x, float *y, float *sos, int N, int sections) {
+    float *in = x;
+
+    for (int s = 0; s < sections; ++s) {
+        float b0 = sos[s * 6 + 0];
+        float b1 = sos[s * 6 + 1];
+        float b2 = sos[s * 6 + 2];
+        float a1 = sos[s * 6 + 4];
+        float a2 = sos[s * 6 + 5];
+        float w1 = 0.0f, w2 = 0.0f;
+
+        for (int n = 0; n < N; ++n) {
+            float wn = in[n] - a1 * w1 - a2 * w2;
+            y[n] = b0 * wn + b1 * w1 + b2 * w2;
+            w2 = w1;
+            w1 = wn;
+        }
+        in = y;
+    }
+
+    if (in != y) for (int i = 0; i < N; ++i) y[i] = in[i];
+}
+
+// Wariant kafelkowy: każdy kafel (tile próbek, najlepiej mieszczący się w L1)
+// przechodzi przez wszystkie sekcje, zanim zostanie pobrany następny.
+// Stan w1/w2 sekcji przenoszony jest między kaflami; wynik identyczny z CASCADE_f.
+void CASCADE_tiled_f(float *x, float *y, float *sos, int N, int sections, int tile) {
+    float w1[32] = {0.0f}, w2[32] = {0.0f};  // zakładamy max 32 sekcje
+
+    if (tile <= 0) tile = N;
+
+    for (int t = 0; t < N; t += tile) {
+        int end = (t + tile < N) ? t + tile : N;
+        float *in = x;
+
+        for (int s = 0; s < sections; ++s) {
+            float b0 = sos[s * 6 + 0];
+            float b1 = sos[s * 6 + 1];
+            float b2 = sos[s * 6 + 2];
+            float a1 = sos[s * 6 + 4];
+            float a2 = sos[s * 6 + 5];
+            float s1 = w1[s], s2 = w2[s];
+
+            for (int n = t; n < end; ++n) {
+                float wn = in[n] - a1 * s1 - a2 * s2;
+                y[n] = b0 * wn + b1 * s1 + b2 * s2;
+                s2 = s1;
+                s1 = wn;
+            }
+
+            w1[s] = s1;
+            w2[s] = s2;
+            in = y;
+        }
+
+        if (in != y) for (int i = t; i < end; ++i) y[i] = in[i];
+    }
+}
+
+// === BLOCKSS: blokowa postać przestrzeni stanów sekcji biquad ===
+// Stan s = [w1, w2] jak w CASCADE. Dla bloku BLOCKSS_M próbek wejścia u:
+//   y = P * s + T * u,   s' = A^M * s + Q * u
+// gdzie T to dolnotrójkątna macierz Toeplitza odpowiedzi impulsowej sekcji.
+// Wszystkie wyjścia bloku liczone są iloczynami macierz-wektor bez zależności
+// szeregowej między próbkami, więc pętle się wektoryzują. Macierze wyznaczane są
+// w double, a zaokrąglenia sumowania po bloku zmieniają błąd względem CASCADE.
+#define BLOCKSS_M 8
+
+typedef struct {
+    double P[2][BLOCKSS_M];          // P[i][k] = (C * A^k)[i]
+    double T[BLOCKSS_M][BLOCKSS_M];  // T[j][k] = h[k - j] dla k >= j, inaczej 0
+    double Q[2][BLOCKSS_M];          // Q[i][j] = (A^(M-1-j) * B)[i]
+    double AM[2][2];                 // A^M
+} blockss_mat;
+
+static void blockss_build(double b0, double b1, double b2, double a1, double a2, blockss_mat *m) {
+    double r0 = b1 - b0 * a1, r1 = b2 - b0 * a2;  // C
+    double h[BLOCKSS_M];
+    h[0] = b0;
+    for (int k = 0; k < BLOCKSS_M; ++k) {
+        m->P[0][k] = r0;
+        m->P[1][k] = r1;
+        if (k + 1 < BLOCKSS_M) h[k + 1] = r0;  // C * A^k * B
+        double t = -a1 * r0 + r1;
+        r1 = -a2 * r0;
+        r0 = t;
+    }
+    for (int j = 0; j < BLOCKSS_M; ++j)
+        for (int k = 0; k < BLOCKSS_M; ++k)
+            m->T[j][k] = (k >= j) ? h[k - j] : 0.0;
+
+    double v0 = 1.0, v1 = 0.0;  // A^m * B
+    for (int j = BLOCKSS_M - 1; j >= 0; --j) {
+        m->Q[0][j] = v0;
+        m->Q[1][j] = v1;
+        double t = -a1 * v0 - a2 * v1;
+        v1 = v0;
+        v0 = t;
+    }
+
+    for (int c = 0; c < 2; ++c) {  // kolumny A^M
+        double e0 = (c == 0), e1 = (c == 1);
+        for (int k = 0; k < BLOCKSS_M; ++k) {
+            double t = -a1 * e0 - a2 * e1;
+            e1 = e0;
+            e0 = t;
+        }
+        m->AM[0][c] = e0;
+        m->AM[1][c] = e1;
+    }
+}
+
+// Sekcja 1 czyta x, kolejne pracują w miejscu na y; końcówka N % BLOCKSS_M rekurencyjnie
+void BLOCKSS_f(float *x, float *y, float *sos, int N, int sections) {
+    float *in = x;
+
+    for (int s = 0; s < sections; ++s) {
+        float b0 = sos[s * 6 + 0];
+        float b1 = sos[s * 6 + 1];
+        float b2 = sos[s * 6 + 2];
+        float a1 = sos[s * 6 + 4];
+        float a2 = sos[s * 6 + 5];
+
+        blockss_mat md;
+        blockss_build(b0, b1, b2, a1, a2, &md);
+        float P[2][BLOCKSS_M], T[BLOCKSS_M][BLOCKSS_M], Q[2][BLOCKSS_M], AM[2][2];
+        for (int k = 0; k < BLOCKSS_M; ++k) {
+            P[0][k] = (float)md.P[0][k];
+            P[1][k] = (float)md.P[1][k];
+            Q[0][k] = (float)md.Q[0][k];
+            Q[1][k] = (float)md.Q[1][k];
+            for (int j = 0; j < BLOCKSS_M; ++j)
+                T[j][k] = (float)md.T[j][k];
+        }
+        for (int i = 0; i < 2; ++i)
+            for (int c = 0; c < 2; ++c)
+                AM[i][c] = (float)md.AM[i][c];
+
+        float w1 = 0.0f, w2 = 0.0f;
+        int n = 0;
+
+        for (; n + BLOCKSS_M <= N; n += BLOCKSS_M) {
+            float u[BLOCKSS_M], acc[BLOCKSS_M];
+            for (int k = 0; k < BLOCKSS_M; ++k)
+                u[k] = in[n + k];
+            // Część zależna od wejścia nie zależy od stanu, więc sąsiednie bloki
+            // mogą się nakładać; łańcuch zależności przez stan to tylko A^M * s.
+            for (int k = 0; k < BLOCKSS_M; ++k)
+                acc[k] = T[0][k] * u[0];
+            for (int j = 1; j < BLOCKSS_M; ++j)
+                for (int k = 0; k < BLOCKSS_M; ++k)
+                    acc[k] += T[j][k] * u[j];
+
+            float q1 = 0.0f, q2 = 0.0f;
+            for (int j = 0; j < BLOCKSS_M; ++j) {
+                q1 += Q[0][j] * u[j];
+                q2 += Q[1][j] * u[j];
+            }
+
+            for (int k = 0; k < BLOCKSS_M; ++k)
+                y[n + k] = acc[k] + (P[0][k] * w1 + P[1][k] * w2);
+
+            float t1 = q1 + (AM[0][0] * w1 + AM[0][1] * w2);
+            float t2 = q2 + (AM[1][0] * w1 + AM[1][1] * w2);
+            w1 = t1;
+            w2 = t2;
+        }
+
+        for (; n < N; ++n) {
+            float wn = in[n] - a1 * w1 - a2 * w2;
+            y[n] = b0 * wn + b1 * w1 + b2 * w2;
+            w2 = w1;
+            w1 = wn;
+        }
+        in = y;
+    }
+
+    if (in != y) for (int i = 0; i < N; ++i) y[i] = in[i];
+}
+
 void DF1_d(double *x, double *y, double *b, double *a, int N, int order) {
     for (int n = 0; n < N; ++n) {
         y[n] = 0.0;
@@ -139,3 +347,151 @@ void CASCADE_d(double *x, double *y, double *sos, int N, int sections) {
     if (in != y) for (int i = 0; i < N; ++i) y[i] = in[i];
     free(temp);
 }
+
+// Wariant bez alokacji: bufor roboczy (N próbek) podaje wywołujący.
+// Kolejność ping-pong dobrana tak, by ostatnia sekcja zapisywała do y,
+// więc x nie jest nadpisywane, a końcowa kopia nie jest potrzebna.
+void CASCADE_ws_d(double *x, double *y, double *sos, int N, int sections, double *work) {
+    double *in = x;
+
+    for (int s = 0; s < sections; ++s) {
+        double b0 = sos[s * 6 + 0];
+        double b1 = sos[s * 6 + 1];
+        double b2 = sos[s * 6 + 2];
+        double a1 = sos[s * 6 + 4];
+        double a2 = sos[s * 6 + 5];
+        double w1 = 0.0, w2 = 0.0;
+        double *out = ((sections - 1 - s) % 2 == 0) ? y : work;
+
+        for (int n = 0; n < N; ++n) {
+            double wn = in[n] - a1 * w1 - a2 * w2;
+            out[n] = b0 * wn + b1 * w1 + b2 * w2;
+            w2 = w1;
+            w1 = wn;
+        }
+        in = out;
+    }
+
+    if (in != y) for (int i = 0; i < N; ++i) y[i] = in[i];
+}
+
+// Wariant w miejscu: pierwsza sekcja x -> y, kolejne pracują na y (dozwolone x == y)
+void CASCADE_ip_d(double *x, double *y, double *sos, int N, int sections) {
+    double *in = x;
+
+    for (int s = 0; s < sections; ++s) {
+        double b0 = sos[s * 6 + 0];
+        double b1 = sos[s * 6 + 1];
+        double b2 = sos[s * 6 + 2];
+        double a1 = sos[s * 6 + 4];
+        double a2 = sos[s * 6 + 5];
+        double w1 = 0.0, w2 = 0.0;
+
+        for (int n = 0; n < N; ++n) {
+            double wn = in[n] - a1 * w1 - a2 * w2;
+            y[n] = b0 * wn + b1 * w1 + b2 * w2;
+            w2 = w1;
+            w1 = wn;
+        }
+        in = y;
+    }
+
+    if (in != y) for (int i = 0; i < N; ++i) y[i] = in[i];
+}
+
+// Wariant kafelkowy: każdy kafel (tile próbek, najlepiej mieszczący się w L1)
+// przechodzi przez wszystkie sekcje, zanim zostanie pobrany następny.
+// Stan w1/w2 sekcji przenoszony jest między kaflami; wynik identyczny z CASCADE_d.
+void CASCADE_tiled_d(double *x, double *y, double *sos, int N, int sections, int tile) {
+    double w1[32] = {0.0}, w2[32] = {0.0};  // zakładamy max 32 sekcje
+
+    if (tile <= 0) tile = N;
+
+    for (int t = 0; t < N; t += tile) {
+        int end = (t + tile < N) ? t + tile : N;
+        double *in = x;
+
+        for (int s = 0; s < sections; ++s) {
+            double b0 = sos[s * 6 + 0];
+            double b1 = sos[s * 6 + 1];
+            double b2 = sos[s * 6 + 2];
+            double a1 = sos[s * 6 + 4];
+            double a2 = sos[s * 6 + 5];
+            double s1 = w1[s], s2 = w2[s];
+
+            for (int n = t; n < end; ++n) {
+                double wn = in[n] - a1 * s1 - a2 * s2;
+                y[n] = b0 * wn + b1 * s1 + b2 * s2;
+                s2 = s1;
+                s1 = wn;
+            }
+
+            w1[s] = s1;
+            w2[s] = s2;
+            in = y;
+        }
+
+        if (in != y) for (int i = t; i < end; ++i) y[i] = in[i];
+    }
+}
+
+// Sekcja 1 czyta x, kolejne pracują w miejscu na y; końcówka N % BLOCKSS_M rekurencyjnie
+void BLOCKSS_d(double *x, double *y, double *sos, int N, int sections) {
+    double *in = x;
+
+    for (int s = 0; s < sections; ++s) {
+        double b0 = sos[s * 6 + 0];
+        double b1 = sos[s * 6 + 1];
+        double b2 = sos[s * 6 + 2];
+        double a1 = sos[s * 6 + 4];
+        double a2 = sos[s * 6 + 5];
+
+        blockss_mat md;
+        blockss_build(b0, b1, b2, a1, a2, &md);
+        // Macierze już w double - bez kopii, tylko krótsze nazwy
+        double (*P)[BLOCKSS_M] = md.P;
+        double (*T)[BLOCKSS_M] = md.T;
+        double (*Q)[BLOCKSS_M] = md.Q;
+        double (*AM)[2] = md.AM;
+
+        double w1 = 0.0, w2 = 0.0;
+        int n = 0;
+
+        for (; n + BLOCKSS_M <= N; n += BLOCKSS_M) {
+            double u[BLOCKSS_M], acc[BLOCKSS_M];
+            for (int k = 0; k < BLOCKSS_M; ++k)
+                u[k] = in[n + k];
+            // Część zależna od wejścia nie zależy od stanu, więc sąsiednie bloki
+            // mogą się nakładać; łańcuch zależności przez stan to tylko A^M * s.
+            for (int k = 0; k < BLOCKSS_M; ++k)
+                acc[k] = T[0][k] * u[0];
+            for (int j = 1; j < BLOCKSS_M; ++j)
+                for (int k = 0; k < BLOCKSS_M; ++k)
+                    acc[k] += T[j][k] * u[j];
+
+            double q1 = 0.0, q2 = 0.0;
+            for (int j = 0; j < BLOCKSS_M; ++j) {
+                q1 += Q[0][j] * u[j];
+                q2 += Q[1][j] * u[j];
+            }
+
+            for (int k = 0; k < BLOCKSS_M; ++k)
+                y[n + k] = acc[k] + (P[0][k] * w1 + P[1][k] * w2);
+
+            double t1 = q1 + (AM[0][0] * w1 + AM[0][1] * w2);
+            double t2 = q2 + (AM[1][0] * w1 + AM[1][1] * w2);
+            w1 = t1;
+            w2 = t2;
+        }
+
+        for (; n < N; ++n) {
+            double wn = in[n] - a1 * w1 - a2 * w2;
+            y[n] = b0 * wn + b1 * w1 + b2 * w2;
+            w2 = w1;
+            w1 = wn;
+        }
+        in = y;
+    }
+
+    if (in != y) for (int i = 0; i < N; ++i) y[i] = in[i];
+}
@@ -7,11 +7,19 @@ void DF1_f(float *x, float *y, float *b, float *a, int N, int order);
 void DF2_f(float *x, float *y, float *b, float *a, int N, int order);
 void TDF2_f(float *x, float *y, float *b, float *a, int N, int order);
 void CASCADE_f(float *x, float *y, float *sos, int N, int sections);
+void CASCADE_ws_f(float *x, float *y, float *sos, int N, int sections, float *work);
+void CASCADE_ip_f(float *x, float *y, float *sos, int N, int sections);
+void CASCADE_tiled_f(float *x, float *y, float *sos, int N, int sections, int tile);
+void BLOCKSS_f(float *x, float *y, float *sos, int N, int sections);
 
 void DF1_d(double *x, double *y, double *b, double *a, int N, int order);
 void DF2_d(double *x, double *y, double *b, double *a, int N, int order);
 void TDF2_d(double *x, double *y, double *b, double *a, int N, int order);
 void CASCADE_d(double *x, double *y, double *sos, int N, int sections);
+void CASCADE_ws_d(double *x, double *y, double *sos, int N, int sections, double *work);
+void CASCADE_ip_d(double *x, double *y, double *sos, int N, int sections);
+void CASCADE_tiled_d(double *x, double *y, double *sos, int N, int sections, int tile);
+void BLOCKSS_d(double *x, double *y, double *sos, int N, int sections);
 
 
 #endif // STRUCTURES_H
\ No newline at end of file
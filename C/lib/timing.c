@@ -0,0 +1,110 @@
+#include <stdio.h>
+#include "timing.h"
+
+#ifdef TIMING_HAVE_TSC
+#include <cpuid.h>
+#endif
+
+#define TIMING_CALIBRATE_NS 50000000ull  // 50 ms kalibracji TSC
+#define TIMING_OVERHEAD_TRIES 10000
+
+timing_source timing_src = TIMING_SRC_CLOCK;
+
+static double timing_hz = 1e9;
+static timing_t timing_overhead = 0;
+static double timing_resolution = 0.0;
+
+// === TSC ===
+#ifdef TIMING_HAVE_TSC
+static timing_t clock_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (timing_t)ts.tv_sec * 1000000000u + (timing_t)ts.tv_nsec;
+}
+
+static int tsc_invariant(void) {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) || eax < 0x80000007)
+        return 0;
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    return (edx >> 8) & 1;
+}
+
+// Liczba ticków TSC na sekundę względem CLOCK_MONOTONIC_RAW
+static double tsc_calibrate(void) {
+    unsigned int aux;
+    timing_t c0 = clock_ns();
+    timing_t t0 = __rdtscp(&aux);
+    timing_t c1;
+    do {
+        c1 = clock_ns();
+    } while (c1 - c0 < TIMING_CALIBRATE_NS);
+    timing_t t1 = __rdtscp(&aux);
+    return (double)(t1 - t0) * 1e9 / (double)(c1 - c0);
+}
+#endif
+
+// === Inicjalizacja ===
+void timing_init(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER f;
+    QueryPerformanceFrequency(&f);
+    timing_hz = (double)f.QuadPart;
+    timing_src = TIMING_SRC_QPC;
+#elif defined(TIMING_HAVE_TSC)
+    if (tsc_invariant()) {
+        timing_hz = tsc_calibrate();
+        timing_src = TIMING_SRC_TSC;
+    }
+#endif
+
+    // Narzut: minimum z pustych pomiarów (ta sama sekwencja co wokół mierzonego kodu)
+    timing_t min_overhead = UINT64_MAX;
+    for (int i = 0; i < TIMING_OVERHEAD_TRIES; ++i) {
+        timing_t start = timing_now();
+        timing_t end = timing_now();
+        if (end - start < min_overhead) min_overhead = end - start;
+    }
+    timing_overhead = min_overhead;
+
+    // Rozdzielczość: okres ticka (tsc, qpc) albo deklarowana przez zegar (clock)
+    timing_resolution = 1e9 / timing_hz;
+#ifndef _WIN32
+    if (timing_src == TIMING_SRC_CLOCK) {
+        struct timespec res;
+        if (clock_getres(CLOCK_MONOTONIC_RAW, &res) == 0)
+            timing_resolution = res.tv_sec * 1e9 + res.tv_nsec;
+    }
+#endif
+}
+
+// === Pomiary ===
+double timing_seconds(timing_t start, timing_t end) {
+    timing_t d = end - start;
+    d = (d > timing_overhead) ? d - timing_overhead : 0;
+    return (double)d / timing_hz;
+}
+
+double timing_ns(timing_t start, timing_t end) {
+    return timing_seconds(start, end) * 1e9;
+}
+
+const char *timing_source_name(void) {
+    switch (timing_src) {
+    case TIMING_SRC_TSC: return "tsc";
+    case TIMING_SRC_QPC: return "qpc";
+    default: return "clock";
+    }
+}
+
+double timing_frequency(void) {
+    return timing_hz;
+}
+
+double timing_overhead_ns(void) {
+    return (double)timing_overhead * 1e9 / timing_hz;
+}
+
+double timing_resolution_ns(void) {
+    return timing_resolution;
+}
@@ -0,0 +1,65 @@
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <stdint.h>
+
+// Przenośny pomiar czasu dla programów TimeAnalysis (zamiast QueryPerformanceCounter).
+// Źródła:
+//   tsc   - niezmienny TSC (x86, CPUID 0x80000007 EDX[8]), rdtscp otoczony lfence;
+//           częstotliwość kalibrowana względem CLOCK_MONOTONIC_RAW przy timing_init()
+//   clock - clock_gettime(CLOCK_MONOTONIC_RAW), ticki w nanosekundach
+//   qpc   - QueryPerformanceCounter (Windows)
+// Domyślnie tsc, gdy procesor go udostępnia; -DTIMING_CLOCK wymusza clock.
+// timing_init() mierzy też narzut pary odczytów (minimum z wielu prób), który
+// timing_seconds() / timing_ns() odejmują od każdego pomiaru.
+// Przed timing_init() działa źródło clock (bez odejmowania narzutu).
+
+typedef uint64_t timing_t;
+
+typedef enum { TIMING_SRC_CLOCK, TIMING_SRC_TSC, TIMING_SRC_QPC } timing_source;
+
+extern timing_source timing_src;
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(TIMING_CLOCK)
+#include <x86intrin.h>
+#define TIMING_HAVE_TSC 1
+#endif
+#endif
+
+static inline timing_t timing_now(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER t;
+    QueryPerformanceCounter(&t);
+    return (timing_t)t.QuadPart;
+#else
+#ifdef TIMING_HAVE_TSC
+    if (timing_src == TIMING_SRC_TSC) {
+        unsigned int aux;
+        _mm_lfence();
+        timing_t t = __rdtscp(&aux);
+        _mm_lfence();
+        return t;
+    }
+#endif
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (timing_t)ts.tv_sec * 1000000000u + (timing_t)ts.tv_nsec;
+#endif
+}
+
+void timing_init(void);
+
+// Czas między odczytami po odjęciu narzutu (nie mniej niż 0)
+double timing_seconds(timing_t start, timing_t end);
+double timing_ns(timing_t start, timing_t end);
+
+const char *timing_source_name(void);
+double timing_frequency(void);     // ticki na sekundę
+double timing_overhead_ns(void);   // narzut pary odczytów
+double timing_resolution_ns(void); // okres ticka źródła
+
+#endif // TIMING_H
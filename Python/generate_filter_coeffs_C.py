@@ -16,6 +16,8 @@ structures = ['DF1', 'DF2', 'TDF2', 'CASCADE']
 
 HEADER_PATH = "filtercoeffs.h"
 SOURCE_PATH = "filtercoeffs.c"
+KERNEL_HEADER_PATH = "filterkernels.h"
+KERNEL_SOURCE_PATH = "filterkernels.c"
 
 def format_coeff(val, dtype):
     if dtype == np.float32:
@@ -44,8 +46,179 @@ def write_array(name, array, dtype, file):
     array_str += "};\n\n"
     file.write(array_str)
 
+# === Kernele ze współczynnikami jako stałymi (filterkernels.c/.h) ===
+# Każdy projekt dostaje własną funkcję NAZWA_kernel(x, y, N) ze współczynnikami
+# wpisanymi w kod i stanem w zmiennych lokalnych. Symetryczne liczniki (b[i] == b[K-1-i])
+# są składane parami, a gdy b[i] / b[0] to liczby całkowite (np. Butterworth: {b0, 2b0, b0}),
+# b0 wyciągane jest przed nawias i zostają dodawania.
+
+def c_type(dtype):
+    return 'float' if dtype == np.float32 else 'double'
+
+def format_int(c, dtype):
+    return f"{c}.0f" if dtype == np.float32 else f"{c}.0"
+
+def is_symmetric(b):
+    return all(b[i] == b[len(b) - 1 - i] for i in range(len(b)))
+
+def integer_ratios(b):
+    b0 = float(b[0])
+    if b0 == 0.0 or not is_symmetric(b):
+        return None
+    r = [float(v) / b0 for v in b]
+    if all(c.is_integer() and c != 0.0 for c in r):
+        return [int(c) for c in r]
+    return None
+
+def scaled(c, term, dtype):
+    return term if c == 1.0 else f"{format_coeff(c, dtype)} * {term}"
+
+def folded_sum(b, terms, dtype):
+    K = len(b)
+    if not is_symmetric(b):
+        return " + ".join(scaled(b[i], terms[i], dtype) for i in range(K))
+    groups = []
+    for i in range((K + 1) // 2):
+        j = K - 1 - i
+        groups.append((i, f"({terms[i]} + {terms[j]})" if i != j else terms[i]))
+    ints = integer_ratios(b)
+    if ints:
+        inner = " + ".join(g if ints[i] == 1 else f"{format_int(ints[i], dtype)} * {g}" for i, g in groups)
+        return f"{format_coeff(b[0], dtype)} * ({inner})"
+    return " + ".join(scaled(b[i], g, dtype) for i, g in groups)
+
+def feedback_terms(a, terms, dtype):
+    out = ""
+    for i in range(1, len(a)):
+        if a[i] < 0:
+            out += f" + {format_coeff(-a[i], dtype)} * {terms[i]}"
+        else:
+            out += f" - {format_coeff(a[i], dtype)} * {terms[i]}"
+    return out
+
+def zero_decl(T, names):
+    return f"    {T} " + ", ".join(f"{n} = 0" for n in names) + ";\n"
+
+def kernel_df1(name, b, a, dtype):
+    T, K = c_type(dtype), len(b)
+    xs = [f"x{i}" for i in range(K)]
+    ys = ["yn"] + [f"y{i}" for i in range(1, K)]
+    code = f"void {name}_kernel({T} *x, {T} *y, int N) {{\n"
+    code += zero_decl(T, xs[1:] + ys[1:])
+    code += "    for (int n = 0; n < N; ++n) {\n"
+    code += f"        {T} x0 = x[n];\n"
+    code += f"        {T} yn = {folded_sum(b, xs, dtype)}{feedback_terms(a, ys, dtype)};\n"
+    for i in range(K - 1, 0, -1):
+        code += f"        {xs[i]} = {xs[i - 1]};\n"
+    for i in range(K - 1, 0, -1):
+        code += f"        {ys[i]} = {ys[i - 1]};\n"
+    code += "        y[n] = yn;\n    }\n}\n\n"
+    return code
+
+def kernel_df2(name, b, a, dtype):
+    T, K = c_type(dtype), len(b)
+    ws = [f"w{i}" for i in range(K)]
+    code = f"void {name}_kernel({T} *x, {T} *y, int N) {{\n"
+    code += zero_decl(T, ws[1:])
+    code += "    for (int n = 0; n < N; ++n) {\n"
+    code += f"        {T} w0 = x[n]{feedback_terms(a, ws, dtype)};\n"
+    code += f"        y[n] = {folded_sum(b, ws, dtype)};\n"
+    for i in range(K - 1, 0, -1):
+        code += f"        {ws[i]} = {ws[i - 1]};\n"
+    code += "    }\n}\n\n"
+    return code
+
+def kernel_tdf2(name, b, a, dtype):
+    T, K = c_type(dtype), len(b)
+    M = K - 1
+    ss = [f"s{i}" for i in range(M)]
+    code = f"void {name}_kernel({T} *x, {T} *y, int N) {{\n"
+    code += zero_decl(T, ss)
+    code += "    for (int n = 0; n < N; ++n) {\n"
+    code += f"        {T} xn = x[n];\n"
+    ints = integer_ratios(b)
+    if ints:
+        code += f"        {T} bx = {format_coeff(b[0], dtype)} * xn;\n"
+        p = ["bx" if c == 1 else f"{format_int(c, dtype)} * bx" for c in ints]
+    elif is_symmetric(b):
+        for i in range((K + 1) // 2):
+            code += f"        {T} p{i} = {format_coeff(b[i], dtype)} * xn;\n"
+        p = [f"p{min(i, K - 1 - i)}" for i in range(K)]
+    else:
+        p = [f"{format_coeff(b[i], dtype)} * xn" for i in range(K)]
+    code += f"        {T} yn = s0 + {p[0]};\n"
+    for i in range(M):
+        nxt = f"{ss[i + 1]} + " if i + 1 < M else ""
+        fb = feedback_terms([0, a[i + 1]], ["", "yn"], dtype)
+        code += f"        {ss[i]} = {nxt}{p[i + 1]}{fb};\n"
+    code += "        y[n] = yn;\n    }\n}\n\n"
+    return code
+
+def kernel_cascade(name, sos, dtype):
+    T, S = c_type(dtype), len(sos)
+    code = f"void {name}_kernel({T} *x, {T} *y, int N) {{\n"
+    code += zero_decl(T, [f"w1_{k}" for k in range(S)] + [f"w2_{k}" for k in range(S)])
+    code += "    for (int n = 0; n < N; ++n) {\n"
+    code += f"        {T} v = x[n];\n"
+    for k in range(S):
+        b, a = list(sos[k][:3]), list(sos[k][3:])
+        code += f"        {T} wn{k} = v{feedback_terms(a, ['', f'w1_{k}', f'w2_{k}'], dtype)};\n"
+        code += f"        v = {folded_sum(b, [f'wn{k}', f'w1_{k}', f'w2_{k}'], dtype)};\n"
+        code += f"        w2_{k} = w1_{k};\n"
+        code += f"        w1_{k} = wn{k};\n"
+    code += "        y[n] = v;\n    }\n}\n\n"
+    return code
+
+def write_kernel(name_base, structure, coeffs, dtype, kfile, khfile, registry):
+    T = c_type(dtype)
+    if structure == 'CASCADE':
+        array = name_base + "_sos"
+        kfile.write(kernel_cascade(name_base, coeffs, dtype))
+        registry[dtype].append(f'    {{"{array}", "CASCADE", {len(coeffs)}, NULL, NULL, *{array}, {name_base}_kernel}},\n')
+    else:
+        b, a = coeffs
+        array = name_base + "_ba"
+        gen = {'DF1': kernel_df1, 'DF2': kernel_df2, 'TDF2': kernel_tdf2}[structure]
+        kfile.write(gen(name_base, b, a, dtype))
+        registry[dtype].append(f'    {{"{array}", "{structure}", {len(b)}, {array}[0], {array}[1], NULL, {name_base}_kernel}},\n')
+    khfile.write(f"void {name_base}_kernel({T} *x, {T} *y, int N);\n")
+
+def write_kernel_header_start(khfile, kfile):
+    khfile.write("// Auto-generated coefficient-baked filter kernels\n")
+    khfile.write("#ifndef FILTERKERNELS_H\n")
+    khfile.write("#define FILTERKERNELS_H\n\n")
+    khfile.write("#include <stddef.h>\n\n")
+    for T, s in [('float', 'f'), ('double', 'd')]:
+        khfile.write("typedef struct {\n")
+        khfile.write("    const char *name;       // nazwa tablicy współczynników w filtercoeffs.h\n")
+        khfile.write("    const char *structure;  // DF1 / DF2 / TDF2 / CASCADE\n")
+        khfile.write("    int order;              // liczba współczynników (BA) lub liczba sekcji (SOS)\n")
+        khfile.write(f"    {T} *b, *a, *sos;       // te same współczynniki dla kerneli ogólnych\n")
+        khfile.write(f"    void (*kernel)({T} *x, {T} *y, int N);\n")
+        khfile.write(f"}} baked_kernel_{s};\n\n")
+    khfile.write("extern baked_kernel_f baked_kernels_f[];\n")
+    khfile.write("extern const int NUM_BAKED_KERNELS_F;\n")
+    khfile.write("extern baked_kernel_d baked_kernels_d[];\n")
+    khfile.write("extern const int NUM_BAKED_KERNELS_D;\n\n")
+
+    kfile.write("// Auto-generated coefficient-baked filter kernels\n\n")
+    kfile.write('#include "filterkernels.h"\n')
+    kfile.write('#include "filtercoeffs.h"\n\n')
+
+def write_kernel_registry(kfile, khfile, registry):
+    for dtype, s in [(np.float32, 'f'), (np.float64, 'd')]:
+        kfile.write(f"baked_kernel_{s} baked_kernels_{s}[] = {{\n")
+        kfile.write("".join(registry[dtype]))
+        kfile.write("};\n")
+        kfile.write(f"const int NUM_BAKED_KERNELS_{s.upper()} = (int)(sizeof(baked_kernels_{s}) / sizeof(baked_kernels_{s}[0]));\n\n")
+    khfile.write("\n#endif // FILTERKERNELS_H\n")
+
 def main():
-    with open(HEADER_PATH, "w") as hfile, open(SOURCE_PATH, "w") as cfile:
+    registry = {np.float32: [], np.float64: []}
+    with open(HEADER_PATH, "w") as hfile, open(SOURCE_PATH, "w") as cfile, \
+         open(KERNEL_HEADER_PATH, "w") as khfile, open(KERNEL_SOURCE_PATH, "w") as kfile:
+        write_kernel_header_start(khfile, kfile)
+
         # Nagłówek H
         hfile.write("// Auto-generated filter coefficient header\n")
         hfile.write("#ifndef FILTERCOEFFS_H\n")
@@ -84,15 +257,18 @@ def main():
                                     sos = signal.tf2sos(b, a).astype(dtype)
                                     write_array(name_base + "_sos", sos, dtype, cfile)
                                     hfile.write(f"extern {'float' if dtype==np.float32 else 'double'} {name_base}_sos[{sos.shape[0]}][6];\n")
+                                    write_kernel(name_base, structure, sos, dtype, kfile, khfile, registry)
                                 else:
                                     ba = np.vstack((b, a))
                                     write_array(name_base + "_ba", ba, dtype, cfile)
                                     hfile.write(f"extern {'float' if dtype==np.float32 else 'double'} {name_base}_ba[2][{len(b)}];\n")
+                                    write_kernel(name_base, structure, (b, a), dtype, kfile, khfile, registry)
 
                             except Exception as e:
                                 print(f"Błąd: {ftype} {order} {cutoff} {dtype} {structure}: {e}")
 
         hfile.write("\n#endif // FILTER_COEFFS_H\n")
+        write_kernel_registry(kfile, khfile, registry)
 
 if __name__ == "__main__":
     main()
@@ -22,7 +22,14 @@ structure_alias = {
     "DF1": "DF I",
     "DF2": "DF II",
     "TDF2": "TDF II",
-    "CASCADE": "Cascade"
+    "CASCADE": "Cascade",
+    "BLOCKSS": "Block SS",
+    "DF1_ACC": "DF I (akumulator)",
+    "DF2_ACC": "DF II (akumulator)",
+    "TDF2_ACC": "TDF II (akumulator)",
+    "CASCADE_ACC": "Cascade (akumulator)",
+    "CASCADE_EF1": "Cascade (EF 1. rzędu)",
+    "CASCADE_EF2": "Cascade (EF 2. rzędu)"
 }
 
 filter_name_alias = {
@@ -36,6 +43,7 @@ filter_name_alias = {
 type_alias = {
     "q12": "Q4.12",
     "q24": "Q8.24",
+    "bfp16": "BFP16 (blokowy)",
     "float": "float",
     "float16": "np.float16",
     "float32": "np.float32"
@@ -26,11 +26,20 @@ files = [
     path+"python_time_results.csv",
     path+"c_floating_time_results.csv",
     path+"c_fixed_time_results.csv",
-    path+"java_time_results.csv"
+    path+"java_time_results.csv",
+    path+"c_floating_latency_hist.csv",
+    path+"c_fixed_latency_hist.csv"
 ]
 
 data = load_data(files)
 
+# Histogramy z trybu latency (C) mają jeden wiersz na kubełek: time_seconds to środek
+# kubełka, count jego liczebność; zwykłe wyniki to pojedyncze pomiary (count = 1)
+if "count" not in data.columns:
+    data["count"] = 1
+data["count"] = data["count"].fillna(1)
+FIT_MAX = 1000000  # tyle wartości najwyżej trafia do dopasowań rozkładów
+
 st.title("Histogram czasu filtrowania")
 
 source = st.multiselect("Źródło danych (język)", sorted(data["source_file"].unique()))
@@ -39,6 +48,9 @@ ftype = st.multiselect("Type", sorted(data["type"].unique()))
 structure = st.multiselect("Structure", sorted(data["structure"].unique()))
 cutoff = st.multiselect("Cutoff", sorted(map(str, data["cutoff"].unique())))
 order = st.multiselect("Order", sorted(map(str, data["order"].unique())))
+block = []
+if "block" in data.columns:
+    block = st.multiselect("Block", sorted(map(str, data["block"].dropna().astype(int).unique())))
 
 bins = st.slider("Bins", min_value=5, max_value=100, value=10, step=1)
 
@@ -56,18 +68,29 @@ if cutoff:
     df = df[df["cutoff"].isin(map(int, cutoff))]
 if order:
     df = df[df["order"].isin(map(int, order))]
+if block:
+    df = df[df["block"].isin(map(int, block))]
 
 times = df["time_seconds"].values
+weights = df["count"].values
 
 eps = 1e-9
 times = times + np.random.normal(0, eps, size=len(times))
 
+# Do dopasowań rozkładów: wartości rozwinięte według liczebności (lub losowane z wagami)
+n_values = int(weights.sum())
+if n_values <= FIT_MAX:
+    times_fit = np.repeat(times, weights.astype(int))
+else:
+    times_fit = np.random.choice(times, size=FIT_MAX, p=weights / weights.sum())
+
 if df.empty:
     st.warning("Brak danych dla wybranych filtrów")
 else:
     fig, ax = plt.subplots(figsize=(12,7))
     sns.histplot(
-        times,
+        x=times,
+        weights=weights,
         bins=bins,
         kde=True,
         edgecolor="none",
@@ -81,7 +104,7 @@ else:
     ax.set_facecolor("none")
     ax.grid(True, alpha=0.3)
     st.pyplot(fig)
-    st.caption(f"Liczba wartości użytych do histogramu: {len(df)}")
+    st.caption(f"Liczba wartości użytych do histogramu: {n_values}")
     
     buf_png = io.BytesIO()
     fig.savefig(buf_png, format="png")
@@ -106,22 +129,22 @@ else:
     )
     
     # --- Analiza dopasowania do rozkładu Rayleigha ---
-    if len(times) > 0:
+    if len(times_fit) > 0:
         
         st.subheader("Dopasowanie rozkładu Weibull'a")
 
         # Dopasowanie MLE do weibull_min
-        c, loc, scale = stats.weibull_min.fit(times)
+        c, loc, scale = stats.weibull_min.fit(times_fit)
         st.write(f"Parametry Weibull: c={c:.6f}, loc={loc:.6f}, scale={scale:.6f}")
 
         # Test Kolmogorova-Smirnova
-        D, p_value = stats.kstest(times, 'weibull_min', args=(c, loc, scale))
+        D, p_value = stats.kstest(times_fit, 'weibull_min', args=(c, loc, scale))
         st.write(f"Test Kołmogorowa-Smirnowa: D = {D:.4f}, p-value = {p_value:.6f}")
 
         # Histogram + PDF
         fig_weib, ax_weib = plt.subplots(figsize=(12,7))
-        sns.histplot(times, bins=bins, stat="density", kde=False, edgecolor="none", color="#4682B4", alpha=0.7, ax=ax_weib)
-        x = np.linspace(times.min(), times.max(), 500)
+        sns.histplot(times_fit, bins=bins, stat="density", kde=False, edgecolor="none", color="#4682B4", alpha=0.7, ax=ax_weib)
+        x = np.linspace(times_fit.min(), times_fit.max(), 500)
         pdf = stats.weibull_min.pdf(x, c, loc, scale)
         ax_weib.plot(x, pdf, 'b-', lw=2, label=f"Dopasowana funkcja gęstości rozkładu Weibull'a \n (k={c:.4f}, loc={loc:.4f}, scale={scale:.4f})")
         ax_weib.set_xlabel("Czas filtrowania [s]")
@@ -149,7 +172,7 @@ else:
         n_best = st.slider("Pokaż najlepsze N dopasowań", min_value=1, max_value=5, value=5)
         
         with st.spinner("Dopasowywanie rozkładów..."):
-            f = Fitter(times, distributions=['rayleigh','cauchy','laplace', 'weibull_min'])
+            f = Fitter(times_fit, distributions=['rayleigh','cauchy','laplace', 'weibull_min'])
             f.fit()
             
             # Ranking najlepszych N
@@ -162,10 +185,10 @@ else:
             # Wykres
             fig4, ax4 = plt.subplots(figsize=(12,7))
             if show_hist:
-                ax4.hist(times, bins=bins, density=True, color="#4682B4", edgecolor="none", alpha=0.5, label="Histogram")
+                ax4.hist(times_fit, bins=bins, density=True, color="#4682B4", edgecolor="none", alpha=0.5, label="Histogram")
             
             best_distributions = best.index.tolist()
-            x = np.linspace(times.min(), times.max(), 500)
+            x = np.linspace(times_fit.min(), times_fit.max(), 500)
             for dist_name in best_distributions:
                 params = f.fitted_param[dist_name]
                 pdf = getattr(stats, dist_name).pdf(x, *params)
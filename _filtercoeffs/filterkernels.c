@@ -0,0 +1,8450 @@
+// Auto-generated coefficient-baked filter kernels
+
+#include "filterkernels.h"
+#include "filtercoeffs.h"
+
+void butter_df1_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.0039161266605473692 * ((x0 + x2) + 2.0 * x1) + 1.815341082704568 * y1 - 0.8310055893467575 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.815341082704568 * w1 - 0.8310055893467575 * w2;
+        y[n] = 0.0039161266605473692 * ((w0 + w2) + 2.0 * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 0.0039161266605473692 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 2.0 * bx + 1.815341082704568 * yn;
+        s1 = bx - 0.8310055893467575 * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.8153410827045682 * w1_0 - 0.83100558934675761 * w2_0;
+        v = 0.0039161266605473692 * ((wn0 + w2_0) + 2.0 * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.003916126676f * ((x0 + x2) + 2.0f * x1) + 1.815341115f * y1 - 0.8310055733f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.815341115f * w1 - 0.8310055733f * w2;
+        y[n] = 0.003916126676f * ((w0 + w2) + 2.0f * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float bx = 0.003916126676f * xn;
+        float yn = s0 + bx;
+        s0 = s1 + 2.0f * bx + 1.815341115f * yn;
+        s1 = bx - 0.8310055733f * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.815341115f * w1_0 - 0.8310055733f * w2_0;
+        v = 0.003916126676f * ((wn0 + w2_0) + 2.0f * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.014401440346511215 * ((x0 + x2) + 2.0 * x1) + 1.6329931618554521 * y1 - 0.69059892324149685 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.6329931618554521 * w1 - 0.69059892324149685 * w2;
+        y[n] = 0.014401440346511215 * ((w0 + w2) + 2.0 * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 0.014401440346511215 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 2.0 * bx + 1.6329931618554521 * yn;
+        s1 = bx - 0.69059892324149685 * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.6329931618554523 * w1_0 - 0.69059892324149696 * w2_0;
+        v = 0.014401440346511215 * ((wn0 + w2_0) + 2.0 * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.01440144051f * ((x0 + x2) + 2.0f * x1) + 1.632993221f * y1 - 0.6905989051f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.632993221f * w1 - 0.6905989051f * w2;
+        y[n] = 0.01440144051f * ((w0 + w2) + 2.0f * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float bx = 0.01440144051f * xn;
+        float yn = s0 + bx;
+        s0 = s1 + 2.0f * bx + 1.632993221f * yn;
+        s1 = bx - 0.6905989051f * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.632993221f * w1_0 - 0.6905989051f * w2_0;
+        v = 0.01440144051f * ((wn0 + w2_0) + 2.0f * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.072230875325753174 * ((x0 + x2) + 2.0 * x1) + 1.1092287926184268 * y1 - 0.39815229392143947 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.1092287926184268 * w1 - 0.39815229392143947 * w2;
+        y[n] = 0.072230875325753174 * ((w0 + w2) + 2.0 * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 0.072230875325753174 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 2.0 * bx + 1.1092287926184268 * yn;
+        s1 = bx - 0.39815229392143947 * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.1092287926184268 * w1_0 - 0.39815229392143942 * w2_0;
+        v = 0.072230875325753174 * ((wn0 + w2_0) + 2.0 * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.07223087549f * ((x0 + x2) + 2.0f * x1) + 1.109228849f * y1 - 0.3981522918f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.109228849f * w1 - 0.3981522918f * w2;
+        y[n] = 0.07223087549f * ((w0 + w2) + 2.0f * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float bx = 0.07223087549f * xn;
+        float yn = s0 + bx;
+        s0 = s1 + 2.0f * bx + 1.109228849f * yn;
+        s1 = bx - 0.3981522918f * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.109228849f * w1_0 - 0.3981522918f * w2_0;
+        v = 0.07223087549f * ((wn0 + w2_0) + 2.0f * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 1.5551721780891759e-05 * ((x0 + x4) + 4.0 * (x1 + x3) + 6.0 * x2) + 3.658060302401883 * y1 - 5.0314335333676059 * y2 + 3.0832283017588149 * y3 - 0.7101038983415866 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.658060302401883 * w1 - 5.0314335333676059 * w2 + 3.0832283017588149 * w3 - 0.7101038983415866 * w4;
+        y[n] = 1.5551721780891759e-05 * ((w0 + w4) + 4.0 * (w1 + w3) + 6.0 * w2);
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 1.5551721780891759e-05 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 4.0 * bx + 3.658060302401883 * yn;
+        s1 = s2 + 6.0 * bx - 5.0314335333676059 * yn;
+        s2 = s3 + 4.0 * bx + 3.0832283017588149 * yn;
+        s3 = bx - 0.7101038983415866 * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.7695043485123332 * w1_0 - 0.78477333178217501 * w2_0;
+        v = 1.5551721780891759e-05 * wn0 + 3.1103443040122618e-05 * w1_0 + 1.5551722006026127e-05 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.8885559538895507 * w1_1 - 0.90485222876901461 * w2_1;
+        v = wn1 + 2.0000000335436159 * w1_1 + 0.99999998552351244 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 1.555172094e-05f * (x0 + x4) + 6.220688374e-05f * (x1 + x3) + 9.331032925e-05f * x2 + 3.658060312f * y1 - 5.031433582f * y2 + 3.08322835f * y3 - 0.7101038694f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.658060312f * w1 - 5.031433582f * w2 + 3.08322835f * w3 - 0.7101038694f * w4;
+        y[n] = 1.555172094e-05f * (w0 + w4) + 6.220688374e-05f * (w1 + w3) + 9.331032925e-05f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 1.555172094e-05f * xn;
+        float p1 = 6.220688374e-05f * xn;
+        float p2 = 9.331032925e-05f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.658060312f * yn;
+        s1 = s2 + p2 - 5.031433582f * yn;
+        s2 = s3 + p1 + 3.08322835f * yn;
+        s3 = p0 - 0.7101038694f * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.769522786f * w1_0 - 0.7847872376f * w2_0;
+        v = 1.555172094e-05f * ((wn0 + w2_0) + 2.0f * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.888537526f * w1_1 - 0.9048361778f * w2_1;
+        v = wn1 + 2.0f * w1_1 + 0.9999999404f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.00021313872697507864 * ((x0 + x4) + 4.0 * (x1 + x3) + 6.0 * x2) + 3.3168079106244175 * y1 - 4.1742455500765727 * y2 + 2.3574027805622575 * y3 - 0.50337536074170408 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.3168079106244175 * w1 - 4.1742455500765727 * w2 + 2.3574027805622575 * w3 - 0.50337536074170408 * w4;
+        y[n] = 0.00021313872697507864 * ((w0 + w4) + 4.0 * (w1 + w3) + 6.0 * w2);
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 0.00021313872697507864 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 4.0 * bx + 3.3168079106244175 * yn;
+        s1 = s2 + 6.0 * bx - 4.1742455500765727 * yn;
+        s2 = s3 + 4.0 * bx + 2.3574027805622575 * yn;
+        s3 = bx - 0.50337536074170408 * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.5590543011416254 * w1_0 - 0.61405178193784049 * w2_0;
+        v = 0.00021313872697507864 * wn0 + 0.00042627744680071483 * w1_0 + 0.00021313873006057962 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.7577536094827906 * w1_1 - 0.81976044292736772 * w2_1;
+        v = wn1 + 2.0000000335436159 * w1_1 + 0.99999998552351244 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.00021313873f * (x0 + x4) + 0.0008525549201f * (x1 + x3) + 0.001278832322f * x2 + 3.316807985f * y1 - 4.174245358f * y2 + 2.357402802f * y3 - 0.5033753514f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.316807985f * w1 - 4.174245358f * w2 + 2.357402802f * w3 - 0.5033753514f * w4;
+        y[n] = 0.00021313873f * (w0 + w4) + 0.0008525549201f * (w1 + w3) + 0.001278832322f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.00021313873f * xn;
+        float p1 = 0.0008525549201f * xn;
+        float p2 = 0.001278832322f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.316807985f * yn;
+        s1 = s2 + p2 - 4.174245358f * yn;
+        s2 = s3 + p1 + 2.357402802f * yn;
+        s3 = p0 - 0.5033753514f * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.559074759f * w1_0 - 0.6140648127f * w2_0;
+        v = 0.00021313873f * wn0 + 0.000426130282f * w1_0 + 0.0002131387155f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.757733226f * w1_1 - 0.8197430372f * w2_1;
+        v = (wn1 + w2_1) + 2.00069046f * w1_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.0055417683320328568 * (x0 + x4) + 0.022167073328131427 * (x1 + x3) + 0.033250609992197144 * x2 + 2.3024482658687369 * y1 - 2.2090801109022586 * y2 + 0.99219365650392721 * y3 - 0.17423010478293127 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 2.3024482658687369 * w1 - 2.2090801109022586 * w2 + 0.99219365650392721 * w3 - 0.17423010478293127 * w4;
+        y[n] = 0.0055417683320328568 * (w0 + w4) + 0.022167073328131427 * (w1 + w3) + 0.033250609992197144 * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 0.0055417683320328568 * xn;
+        double p1 = 0.022167073328131427 * xn;
+        double p2 = 0.033250609992197144 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 2.3024482658687369 * yn;
+        s1 = s2 + p2 - 2.2090801109022586 * yn;
+        s2 = s3 + p1 + 0.99219365650392721 * yn;
+        s3 = p0 - 0.17423010478293127 * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.0155428255941781 * w1_0 - 0.28006371690749715 * w2_0;
+        v = 0.0055417683320328568 * wn0 + 0.01108502346837946 * w1_0 + 0.005543255335824321 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.2869054402745566 * w1_1 - 0.6221088069058146 * w2_1;
+        v = wn1 + 1.9997317094066998 * w1_1 + 0.99973174539122356 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.005541768391f * (x0 + x4) + 0.02216707356f * (x1 + x3) + 0.03325061128f * x2 + 2.302448273f * y1 - 2.209080219f * y2 + 0.9921936393f * y3 - 0.1742300987f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 2.302448273f * w1 - 2.209080219f * w2 + 0.9921936393f * w3 - 0.1742300987f * w4;
+        y[n] = 0.005541768391f * (w0 + w4) + 0.02216707356f * (w1 + w3) + 0.03325061128f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.005541768391f * xn;
+        float p1 = 0.02216707356f * xn;
+        float p2 = 0.03325061128f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 2.302448273f * yn;
+        s1 = s2 + p2 - 2.209080219f * yn;
+        s2 = s3 + p1 + 0.9921936393f * yn;
+        s3 = p0 - 0.1742300987f * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.01554203f * w1_0 - 0.2800634205f * w2_0;
+        v = 0.005541768391f * wn0 + 0.01108353678f * w1_0 + 0.005541768856f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.286906242f * w1_1 - 0.6221094131f * w2_1;
+        v = wn1 + 2.0f * w1_1 + 0.9999999404f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 6.1553518473114324e-08 * ((x0 + x6) + 6.0 * (x1 + x5) + 15.0 * (x2 + x4) + 20.0 * x3) + 5.4943129217709537 * y1 - 12.597841466689353 * y2 + 15.428526790327474 * y3 - 10.643677005530419 * y4 + 3.9214469676674621 * y5 - 0.60277214697129811 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 5.4943129217709537 * w1 - 12.597841466689353 * w2 + 15.428526790327474 * w3 - 10.643677005530419 * w4 + 3.9214469676674621 * w5 - 0.60277214697129811 * w6;
+        y[n] = 6.1553518473114324e-08 * ((w0 + w6) + 6.0 * (w1 + w5) + 15.0 * (w2 + w4) + 20.0 * w3);
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 6.1553518473114324e-08 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 6.0 * bx + 5.4943129217709537 * yn;
+        s1 = s2 + 15.0 * bx - 12.597841466689353 * yn;
+        s2 = s3 + 20.0 * bx + 15.428526790327474 * yn;
+        s3 = s4 + 15.0 * bx - 10.643677005530419 * yn;
+        s4 = s5 + 6.0 * bx + 3.9214469676674621 * yn;
+        s5 = bx - 0.60277214697129811 * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.7608803575133565 * w1_0 - 0.77607492464905914 * w2_0;
+        v = 6.1553518473114324e-08 * wn0 + 1.2347089057558311e-07 * w1_0 + 6.1918090903327916e-08 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.8153410823495535 * w1_1 - 0.83100558902228672 * w2_1;
+        v = wn1 + 1.999969278309516 * w1_1 + 0.99998086546169862 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.9180914819080415 * w1_2 - 0.93464261770367674 * w2_2;
+        v = wn2 + 1.9941195465313726 * w1_2 + 0.99413104305675626 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 6.155352139e-08f * (x0 + x6) + 3.693210999e-07f * (x1 + x5) + 9.23302764e-07f * (x2 + x4) + 1.231070314e-06f * x3 + 5.494312763f * y1 - 12.59784126f * y2 + 15.42852688f * y3 - 10.64367676f * y4 + 3.921447039f * y5 - 0.6027721763f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 5.494312763f * w1 - 12.59784126f * w2 + 15.42852688f * w3 - 10.64367676f * w4 + 3.921447039f * w5 - 0.6027721763f * w6;
+        y[n] = 6.155352139e-08f * (w0 + w6) + 3.693210999e-07f * (w1 + w5) + 9.23302764e-07f * (w2 + w4) + 1.231070314e-06f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 6.155352139e-08f * xn;
+        float p1 = 3.693210999e-07f * xn;
+        float p2 = 9.23302764e-07f * xn;
+        float p3 = 1.231070314e-06f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 5.494312763f * yn;
+        s1 = s2 + p2 - 12.59784126f * yn;
+        s2 = s3 + p3 + 15.42852688f * yn;
+        s3 = s4 + p2 - 10.64367676f * yn;
+        s4 = s5 + p1 + 3.921447039f * yn;
+        s5 = p0 - 0.6027721763f * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.784893632f * w1_0 - 0.8045092225f * w2_0;
+        v = 6.155352139e-08f * wn0 + 1.339862905e-07f * w1_0 + 7.309408545e-08f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.786421299f * w1_1 - 0.7967151403f * w2_1;
+        v = wn1 + 1.990188956f * w1_1 + 0.9999999404f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.922997832f * w1_2 - 0.9404140115f * w2_2;
+        v = wn2 + 1.833066106f * w1_2 + 0.8421136141f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 3.1342045900215476e-06 * ((x0 + x6) + 6.0 * (x1 + x5) + 15.0 * (x2 + x4) + 20.0 * x3) + 4.9890411663931182 * y1 - 10.443635915034815 * y2 + 11.732629887151303 * y3 - 7.4561922590937506 * y4 + 2.5402874993135729 * y5 - 0.36233096782319085 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 4.9890411663931182 * w1 - 10.443635915034815 * w2 + 11.732629887151303 * w3 - 7.4561922590937506 * w4 + 2.5402874993135729 * w5 - 0.36233096782319085 * w6;
+        y[n] = 3.1342045900215476e-06 * ((w0 + w6) + 6.0 * (w1 + w5) + 15.0 * (w2 + w4) + 20.0 * w3);
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 3.1342045900215476e-06 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 6.0 * bx + 4.9890411663931182 * yn;
+        s1 = s2 + 15.0 * bx - 10.443635915034815 * yn;
+        s2 = s3 + 20.0 * bx + 11.732629887151303 * yn;
+        s3 = s4 + 15.0 * bx - 7.4561922590937506 * yn;
+        s4 = s5 + 6.0 * bx + 2.5402874993135729 * yn;
+        s5 = bx - 0.36233096782319085 * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.5454813220562713 * w1_0 - 0.59999999999592946 * w2_0;
+        v = 3.1342045900215476e-06 * wn0 + 6.2869360123592179e-06 * w1_0 + 3.1527680225029876e-06 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.6329931618636362 * w1_1 - 0.69059892324774874 * w2_1;
+        v = wn1 + 1.999969278309516 * w1_1 + 0.99998086546169862 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.8105666824732134 * w1_2 - 0.87443655940865528 * w2_2;
+        v = wn2 + 1.9941195465313726 * w1_2 + 0.99413104305675626 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 3.13420469e-06f * (x0 + x6) + 1.880522723e-05f * (x1 + x5) + 4.701306898e-05f * (x2 + x4) + 6.268409197e-05f * x3 + 4.989041328f * y1 - 10.44363594f * y2 + 11.73262978f * y3 - 7.456192493f * y4 + 2.540287495f * y5 - 0.3623309731f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 4.989041328f * w1 - 10.44363594f * w2 + 11.73262978f * w3 - 7.456192493f * w4 + 2.540287495f * w5 - 0.3623309731f * w6;
+        y[n] = 3.13420469e-06f * (w0 + w6) + 1.880522723e-05f * (w1 + w5) + 4.701306898e-05f * (w2 + w4) + 6.268409197e-05f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 3.13420469e-06f * xn;
+        float p1 = 1.880522723e-05f * xn;
+        float p2 = 4.701306898e-05f * xn;
+        float p3 = 6.268409197e-05f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 4.989041328f * yn;
+        s1 = s2 + p2 - 10.44363594f * yn;
+        s2 = s3 + p3 + 11.73262978f * yn;
+        s3 = s4 + p2 - 7.456192493f * yn;
+        s4 = s5 + p1 + 2.540287495f * yn;
+        s5 = p0 - 0.3623309731f * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.544573426f * w1_0 - 0.5993853211f * w2_0;
+        v = 3.13420469e-06f * wn0 + 6.822311207e-06f * w1_0 + 3.721835355e-06f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.634102225f * w1_1 - 0.691493392f * w2_1;
+        v = wn1 + 1.990221262f * w1_1 + 0.9999999404f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.810365558f * w1_2 - 0.8742009997f * w2_2;
+        v = wn2 + 1.83305037f * w1_2 + 0.8421127796f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.00041948939301750265 * (x0 + x6) + 0.0025169363581050161 * (x1 + x5) + 0.0062923408952625399 * (x2 + x4) + 0.0083897878603500526 * x3 + 3.479137768356285 * y1 - 5.3837312013768539 * y2 + 4.6406075716362167 * y3 - 2.3282307726358571 * y4 + 0.6405433446158314 * y5 - 0.075174031748743236 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.479137768356285 * w1 - 5.3837312013768539 * w2 + 4.6406075716362167 * w3 - 2.3282307726358571 * w4 + 0.6405433446158314 * w5 - 0.075174031748743236 * w6;
+        y[n] = 0.00041948939301750265 * (w0 + w6) + 0.0025169363581050161 * (w1 + w5) + 0.0062923408952625399 * (w2 + w4) + 0.0083897878603500526 * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 0.00041948939301750265 * xn;
+        double p1 = 0.0025169363581050161 * xn;
+        double p2 = 0.0062923408952625399 * xn;
+        double p3 = 0.0083897878603500526 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 3.479137768356285 * yn;
+        s1 = s2 + p2 - 5.3837312013768539 * yn;
+        s2 = s3 + p3 + 4.6406075716362167 * yn;
+        s3 = s4 + p2 - 2.3282307726358571 * yn;
+        s4 = s5 + p1 + 0.6405433446158314 * yn;
+        s5 = p0 - 0.075174031748743236 * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 0.99917399838878396 * w1_0 - 0.25943126176543124 * w2_0;
+        v = 0.00041948939301750265 * wn0 + 0.00084084960145557346 * w1_0 + 0.00042136859417355967 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.1092287926184647 * w1_1 - 0.39815229392146223 * w2_1;
+        v = wn1 + 1.9955252159921426 * w1_1 + 0.99554513914628995 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.370734977349032 * w1_2 - 0.72777362586743832 * w2_2;
+        v = wn2 + 2.0000150397289644 * w1_2 + 0.99999508285363126 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.0004194893991f * (x0 + x6) + 0.002516936278f * (x1 + x5) + 0.006292340811f * (x2 + x4) + 0.008389787748f * x3 + 3.479137659f * y1 - 5.383731365f * y2 + 4.640607357f * y3 - 2.328230858f * y4 + 0.6405433416f * y5 - 0.07517403364f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.479137659f * w1 - 5.383731365f * w2 + 4.640607357f * w3 - 2.328230858f * w4 + 0.6405433416f * w5 - 0.07517403364f * w6;
+        y[n] = 0.0004194893991f * (w0 + w6) + 0.002516936278f * (w1 + w5) + 0.006292340811f * (w2 + w4) + 0.008389787748f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.0004194893991f * xn;
+        float p1 = 0.002516936278f * xn;
+        float p2 = 0.006292340811f * xn;
+        float p3 = 0.008389787748f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.479137659f * yn;
+        s1 = s2 + p2 - 5.383731365f * yn;
+        s2 = s3 + p3 + 4.640607357f * yn;
+        s3 = s4 + p2 - 2.328230858f * yn;
+        s4 = s5 + p1 + 0.6405433416f * yn;
+        s5 = p0 - 0.07517403364f * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 0.9991535544f * w1_0 - 0.2594229579f * w2_0;
+        v = 0.0004194893991f * wn0 + 0.0009131143452f * w1_0 + 0.0004981392995f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.109245181f * w1_1 - 0.3981659114f * w2_1;
+        v = wn1 + 1.990221262f * w1_1 + 0.9999999404f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.370738864f * w1_2 - 0.7277719378f * w2_2;
+        v = wn2 + 1.83305037f * w1_2 + 0.8421127796f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 2.4344490194428555e-10 * ((x0 + x8) + 8.0 * (x1 + x7) + 28.0 * (x2 + x6) + 56.0 * (x3 + x5) + 70.0 * x4) + 7.3290813169226885 * y1 - 23.526619474531746 * y2 + 43.201356343023683 * y3 - 49.63245808844124 * y4 + 36.530051737556022 * y5 - 16.820442260556739 * y6 + 4.4299248895920309 * y7 - 0.51089452588659834 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 7.3290813169226885 * w1 - 23.526619474531746 * w2 + 43.201356343023683 * w3 - 49.63245808844124 * w4 + 36.530051737556022 * w5 - 16.820442260556739 * w6 + 4.4299248895920309 * w7 - 0.51089452588659834 * w8;
+        y[n] = 2.4344490194428555e-10 * ((w0 + w8) + 8.0 * (w1 + w7) + 28.0 * (w2 + w6) + 56.0 * (w3 + w5) + 70.0 * w4);
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 2.4344490194428555e-10 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 8.0 * bx + 7.3290813169226885 * yn;
+        s1 = s2 + 28.0 * bx - 23.526619474531746 * yn;
+        s2 = s3 + 56.0 * bx + 43.201356343023683 * yn;
+        s3 = s4 + 70.0 * bx - 49.63245808844124 * yn;
+        s4 = s5 + 56.0 * bx + 36.530051737556022 * yn;
+        s5 = s6 + 28.0 * bx - 16.820442260556739 * yn;
+        s6 = s7 + 8.0 * bx + 4.4299248895920309 * yn;
+        s7 = bx - 0.51089452588659834 * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.7578527936420358 * w1_0 - 0.77302121305616533 * w2_0;
+        v = 2.4344490194428555e-10 * wn0 + 4.9439700947496984e-10 * w1_0 + 2.5106923952361766e-10 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.7887581982491274 * w1_1 - 0.80419333474279675 * w2_1;
+        v = wn1 + 1.9996365905853206 * w1_1 + 1.0001120965713541 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.8488198270021758 * w1_2 - 0.8647732296085261 * w2_2;
+        v = wn2 + 1.96916256905117 * w1_2 + 0.96963250539233625 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.9336504980293419 * w1_3 - 0.95033589067369506 * w2_3;
+        v = wn3 + 2.0003634495352691 * w1_3 + 0.99988794144980309 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 2.434449031e-10f * (x0 + x8) + 1.947559225e-09f * (x1 + x7) + 6.816457176e-09f * (x2 + x6) + 1.363291435e-08f * (x3 + x5) + 1.704114361e-08f * x4 + 7.329081535f * y1 - 23.52661896f * y2 + 43.20135498f * y3 - 49.63245773f * y4 + 36.53005219f * y5 - 16.8204422f * y6 + 4.429924965f * y7 - 0.510894537f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 7.329081535f * w1 - 23.52661896f * w2 + 43.20135498f * w3 - 49.63245773f * w4 + 36.53005219f * w5 - 16.8204422f * w6 + 4.429924965f * w7 - 0.510894537f * w8;
+        y[n] = 2.434449031e-10f * (w0 + w8) + 1.947559225e-09f * (w1 + w7) + 6.816457176e-09f * (w2 + w6) + 1.363291435e-08f * (w3 + w5) + 1.704114361e-08f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 2.434449031e-10f * xn;
+        float p1 = 1.947559225e-09f * xn;
+        float p2 = 6.816457176e-09f * xn;
+        float p3 = 1.363291435e-08f * xn;
+        float p4 = 1.704114361e-08f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 7.329081535f * yn;
+        s1 = s2 + p2 - 23.52661896f * yn;
+        s2 = s3 + p3 + 43.20135498f * yn;
+        s3 = s4 + p4 - 49.63245773f * yn;
+        s4 = s5 + p3 + 36.53005219f * yn;
+        s5 = s6 + p2 - 16.8204422f * yn;
+        s6 = s7 + p1 + 4.429924965f * yn;
+        s7 = p0 - 0.510894537f * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.649336696f * w1_0 - 0.6920862794f * w2_0;
+        v = 2.434449031e-10f * wn0 + 4.943969678e-10f * w1_0 + 2.51069221e-10f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.837656498f * w1_1 - 0.8720950484f * w2_1;
+        v = wn1 + 1.99963665f * w1_1 + 1.000112176f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.827708483f * w1_2 - 0.8191613555f * w2_2;
+        v = wn2 + 1.969162583f * w1_2 + 0.9696325064f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 2.01437974f * w1_3 - 1.033326864f * w2_3;
+        v = wn3 + 2.00036335f * w1_3 + 0.9998879433f * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 4.6020257625916006e-08 * ((x0 + x8) + 8.0 * (x1 + x7) + 28.0 * (x2 + x6) + 56.0 * (x3 + x5) + 70.0 * x4) + 6.6584638094073263 * y1 - 19.493049779200803 * y2 + 32.759919646457028 * y3 - 34.557722135559885 * y4 + 23.424371684081176 * y5 - 9.961089584272262 * y6 + 2.429129963271814 * y7 - 0.26003538537035475 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 6.6584638094073263 * w1 - 19.493049779200803 * w2 + 32.759919646457028 * w3 - 34.557722135559885 * w4 + 23.424371684081176 * w5 - 9.961089584272262 * w6 + 2.429129963271814 * w7 - 0.26003538537035475 * w8;
+        y[n] = 4.6020257625916006e-08 * ((w0 + w8) + 8.0 * (w1 + w7) + 28.0 * (w2 + w6) + 56.0 * (w3 + w5) + 70.0 * w4);
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 4.6020257625916006e-08 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 8.0 * bx + 6.6584638094073263 * yn;
+        s1 = s2 + 28.0 * bx - 19.493049779200803 * yn;
+        s2 = s3 + 56.0 * bx + 32.759919646457028 * yn;
+        s3 = s4 + 70.0 * bx - 34.557722135559885 * yn;
+        s4 = s5 + 56.0 * bx + 23.424371684081176 * yn;
+        s5 = s6 + 28.0 * bx - 9.961089584272262 * yn;
+        s6 = s7 + 8.0 * bx + 2.429129963271814 * yn;
+        s7 = bx - 0.26003538537035475 * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.5407408812414833 * w1_0 - 0.59509233471064571 * w2_0;
+        v = 4.6020257625916006e-08 * wn0 + 9.3459659922258722e-08 * w1_0 + 4.7461544655652681e-08 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.5897394514400802 * w1_1 - 0.64581938699492936 * w2_1;
+        v = wn1 + 1.9996365905853206 * w1_1 + 1.0001120965713541 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.6889883711459186 * w1_2 - 0.74856942959120709 * w2_2;
+        v = wn2 + 1.96916256905117 * w1_2 + 0.96963250539233625 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.838995105579847 * w1_3 - 0.90386782871373361 * w2_3;
+        v = wn3 + 2.0003634495352691 * w1_3 + 0.99988794144980309 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 4.602025783e-08f * (x0 + x8) + 3.681620626e-07f * (x1 + x7) + 1.288567205e-06f * (x2 + x6) + 2.57713441e-06f * (x3 + x5) + 3.221417956e-06f * x4 + 6.658463955f * y1 - 19.49304962f * y2 + 32.75991821f * y3 - 34.557724f * y4 + 23.42437172f * y5 - 9.961089134f * y6 + 2.429130077f * y7 - 0.2600353956f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 6.658463955f * w1 - 19.49304962f * w2 + 32.75991821f * w3 - 34.557724f * w4 + 23.42437172f * w5 - 9.961089134f * w6 + 2.429130077f * w7 - 0.2600353956f * w8;
+        y[n] = 4.602025783e-08f * (w0 + w8) + 3.681620626e-07f * (w1 + w7) + 1.288567205e-06f * (w2 + w6) + 2.57713441e-06f * (w3 + w5) + 3.221417956e-06f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 4.602025783e-08f * xn;
+        float p1 = 3.681620626e-07f * xn;
+        float p2 = 1.288567205e-06f * xn;
+        float p3 = 2.57713441e-06f * xn;
+        float p4 = 3.221417956e-06f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 6.658463955f * yn;
+        s1 = s2 + p2 - 19.49304962f * yn;
+        s2 = s3 + p3 + 32.75991821f * yn;
+        s3 = s4 + p4 - 34.557724f * yn;
+        s4 = s5 + p3 + 23.42437172f * yn;
+        s5 = s6 + p2 - 9.961089134f * yn;
+        s6 = s7 + p1 + 2.429130077f * yn;
+        s7 = p0 - 0.2600353956f * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.448373199f * w1_0 - 0.5281766057f * w2_0;
+        v = 4.602025783e-08f * wn0 + 9.345965424e-08f * w1_0 + 4.746154048e-08f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.564298391f * w1_1 - 0.64355582f * w2_1;
+        v = wn1 + 1.99963665f * w1_1 + 1.000112176f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.838083744f * w1_2 - 0.8689403534f * w2_2;
+        v = wn2 + 1.969162583f * w1_2 + 0.9696325064f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 1.807708502f * w1_3 - 0.8803939223f * w2_3;
+        v = wn3 + 2.00036335f * w1_3 + 0.9998879433f * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 3.1647230428616052e-05 * ((x0 + x8) + 8.0 * (x1 + x7) + 28.0 * (x2 + x6) + 56.0 * (x3 + x5) + 70.0 * x4) + 4.6509499639553544 * y1 - 9.9209459988621678 * y2 + 12.53000872116149 * y3 - 10.181755566928816 * y4 + 5.4264052070762334 * y5 - 1.8462454728094388 * y6 + 0.36570484657967306 * y7 - 0.032223391162053423 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 4.6509499639553544 * w1 - 9.9209459988621678 * w2 + 12.53000872116149 * w3 - 10.181755566928816 * w4 + 5.4264052070762334 * w5 - 1.8462454728094388 * w6 + 0.36570484657967306 * w7 - 0.032223391162053423 * w8;
+        y[n] = 3.1647230428616052e-05 * ((w0 + w8) + 8.0 * (w1 + w7) + 28.0 * (w2 + w6) + 56.0 * (w3 + w5) + 70.0 * w4);
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 3.1647230428616052e-05 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 8.0 * bx + 4.6509499639553544 * yn;
+        s1 = s2 + 28.0 * bx - 9.9209459988621678 * yn;
+        s2 = s3 + 56.0 * bx + 12.53000872116149 * yn;
+        s3 = s4 + 70.0 * bx - 10.181755566928816 * yn;
+        s4 = s5 + 56.0 * bx + 5.4264052070762334 * yn;
+        s5 = s6 + 28.0 * bx - 1.8462454728094388 * yn;
+        s6 = s7 + 8.0 * bx + 0.36570484657967306 * yn;
+        s7 = bx - 0.032223391162053423 * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 0.9935146201705749 * w1_0 - 0.25229777164048806 * w2_0;
+        v = 3.1647230428616052e-05 * wn0 + 6.4270378870590736e-05 * w1_0 + 3.2638375309086382e-05 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.0534735331727809 * w1_1 - 0.32787432745461664 * w2_1;
+        v = wn1 + 1.9996365905853206 * w1_1 + 1.0001120965713541 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.1856935771991368 * w1_2 - 0.49453404552883384 * w2_2;
+        v = wn2 + 1.96916256905117 * w1_2 + 0.96963250539233625 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.4182682334128582 * w1_3 - 0.78768798388385375 * w2_3;
+        v = wn3 + 2.0003634495352691 * w1_3 + 0.99988794144980309 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void butter_df1_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 3.164722875e-05f * (x0 + x8) + 0.00025317783f * (x1 + x7) + 0.0008861224633f * (x2 + x6) + 0.001772244927f * (x3 + x5) + 0.002215306042f * x4 + 4.650949955f * y1 - 9.920946121f * y2 + 12.53000832f * y3 - 10.18175602f * y4 + 5.42640543f * y5 - 1.846245527f * y6 + 0.3657048345f * y7 - 0.03222339228f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void butter_df2_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 4.650949955f * w1 - 9.920946121f * w2 + 12.53000832f * w3 - 10.18175602f * w4 + 5.42640543f * w5 - 1.846245527f * w6 + 0.3657048345f * w7 - 0.03222339228f * w8;
+        y[n] = 3.164722875e-05f * (w0 + w8) + 0.00025317783f * (w1 + w7) + 0.0008861224633f * (w2 + w6) + 0.001772244927f * (w3 + w5) + 0.002215306042f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void butter_tdf2_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 3.164722875e-05f * xn;
+        float p1 = 0.00025317783f * xn;
+        float p2 = 0.0008861224633f * xn;
+        float p3 = 0.001772244927f * xn;
+        float p4 = 0.002215306042f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 4.650949955f * yn;
+        s1 = s2 + p2 - 9.920946121f * yn;
+        s2 = s3 + p3 + 12.53000832f * yn;
+        s3 = s4 + p4 - 10.18175602f * yn;
+        s4 = s5 + p3 + 5.42640543f * yn;
+        s5 = s6 + p2 - 1.846245527f * yn;
+        s6 = s7 + p1 + 0.3657048345f * yn;
+        s7 = p0 - 0.03222339228f * yn;
+        y[n] = yn;
+    }
+}
+
+void butter_cascade_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 0.9933511615f * w1_0 - 0.2522268295f * w2_0;
+        v = 3.164722875e-05f * wn0 + 7.27212464e-05f * w1_0 + 4.269919737e-05f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.053552389f * w1_1 - 0.3279512823f * w2_1;
+        v = wn1 + 1.955331087f * w1_1 + 1.000000119f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.185813904f * w1_2 - 0.4945843816f * w2_2;
+        v = wn2 + 1.703105688f * w1_2 + 0.7411668301f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 1.41823256f * w1_3 - 0.7876445651f * w2_3;
+        v = (wn3 + w2_3) + 2.04369235f * w1_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.0039205997985470595 * ((x0 + x2) + 2.0 * x1) + 1.8487544456429137 * y1 - 0.86635038694652322 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.8487544456429137 * w1 - 0.86635038694652322 * w2;
+        y[n] = 0.0039205997985470595 * ((w0 + w2) + 2.0 * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 0.0039205997985470595 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 2.0 * bx + 1.8487544456429137 * yn;
+        s1 = bx - 0.86635038694652322 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.8487544456429135 * w1_0 - 0.86635038694652311 * w2_0;
+        v = 0.0039205997985470595 * ((wn0 + w2_0) + 2.0 * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.003920599818f * ((x0 + x2) + 2.0f * x1) + 1.848754406f * y1 - 0.8663504124f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.848754406f * w1 - 0.8663504124f * w2;
+        y[n] = 0.003920599818f * ((w0 + w2) + 2.0f * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float bx = 0.003920599818f * xn;
+        float yn = s0 + bx;
+        s0 = s1 + 2.0f * bx + 1.848754406f * yn;
+        s1 = bx - 0.8663504124f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.848754406f * w1_0 - 0.8663504124f * w2_0;
+        v = 0.003920599818f * ((wn0 + w2_0) + 2.0f * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.014636137703877339 * ((x0 + x2) + 2.0 * x1) + 1.6859174428162653 * y1 - 0.75160550923008584 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.6859174428162653 * w1 - 0.75160550923008584 * w2;
+        y[n] = 0.014636137703877339 * ((w0 + w2) + 2.0 * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 0.014636137703877339 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 2.0 * bx + 1.6859174428162653 * yn;
+        s1 = bx - 0.75160550923008584 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.6859174428162653 * w1_0 - 0.75160550923008596 * w2_0;
+        v = 0.014636137703877339 * ((wn0 + w2_0) + 2.0 * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.01463613752f * ((x0 + x2) + 2.0f * x1) + 1.685917497f * y1 - 0.7516055107f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.685917497f * w1 - 0.7516055107f * w2;
+        y[n] = 0.01463613752f * ((w0 + w2) + 2.0f * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float bx = 0.01463613752f * xn;
+        float yn = s0 + bx;
+        s0 = s1 + 2.0f * bx + 1.685917497f * yn;
+        s1 = bx - 0.7516055107f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.685917497f * w1_0 - 0.7516055107f * w2_0;
+        v = 0.01463613752f * ((wn0 + w2_0) + 2.0f * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.075500341509472255 * ((x0 + x2) + 2.0 * x1) + 1.1641994270367633 * y1 - 0.50305053295567714 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.1641994270367633 * w1 - 0.50305053295567714 * w2;
+        y[n] = 0.075500341509472255 * ((w0 + w2) + 2.0 * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 0.075500341509472255 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 2.0 * bx + 1.1641994270367633 * yn;
+        s1 = bx - 0.50305053295567714 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.1641994270367633 * w1_0 - 0.50305053295567714 * w2_0;
+        v = 0.075500341509472255 * ((wn0 + w2_0) + 2.0 * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.07550033927f * ((x0 + x2) + 2.0f * x1) + 1.164199471f * y1 - 0.5030505061f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.164199471f * w1 - 0.5030505061f * w2;
+        y[n] = 0.07550033927f * ((w0 + w2) + 2.0f * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float bx = 0.07550033927f * xn;
+        float yn = s0 + bx;
+        s0 = s1 + 2.0f * bx + 1.164199471f * yn;
+        s1 = bx - 0.5030505061f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.164199471f * w1_0 - 0.5030505061f * w2_0;
+        v = 0.07550033927f * ((wn0 + w2_0) + 2.0f * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 4.2412978278766116e-06 * ((x0 + x4) + 4.0 * (x1 + x3) + 6.0 * x2) + 3.8585659848348284 * y1 - 5.6015328626915046 * y2 + 3.6256505297802941 * y3 - 0.88275979295454565 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.8585659848348284 * w1 - 5.6015328626915046 * w2 + 3.6256505297802941 * w3 - 0.88275979295454565 * w4;
+        y[n] = 4.2412978278766116e-06 * ((w0 + w4) + 4.0 * (w1 + w3) + 6.0 * w2);
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 4.2412978278766116e-06 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 4.0 * bx + 3.8585659848348284 * yn;
+        s1 = s2 + 6.0 * bx - 5.6015328626915046 * yn;
+        s2 = s3 + 4.0 * bx + 3.6256505297802941 * yn;
+        s3 = bx - 0.88275979295454565 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.9109210355830362 * w1_0 - 0.91551382495324951 * w2_0;
+        v = 4.2412978278766116e-06 * wn0 + 8.4825955134847799e-06 * w1_0 + 4.2412978892757234e-06 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.9476449492517927 * w1_1 - 0.96422333436595009 * w2_1;
+        v = wn1 + 2.0000000335436159 * w1_1 + 0.99999998552351244 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 4.241298029e-06f * (x0 + x4) + 1.696519212e-05f * (x1 + x3) + 2.544778727e-05f * x2 + 3.858566046f * y1 - 5.601532936f * y2 + 3.625650644f * y3 - 0.8827598095f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.858566046f * w1 - 5.601532936f * w2 + 3.625650644f * w3 - 0.8827598095f * w4;
+        y[n] = 4.241298029e-06f * (w0 + w4) + 1.696519212e-05f * (w1 + w3) + 2.544778727e-05f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 4.241298029e-06f * xn;
+        float p1 = 1.696519212e-05f * xn;
+        float p2 = 2.544778727e-05f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.858566046f * yn;
+        s1 = s2 + p2 - 5.601532936f * yn;
+        s2 = s3 + p1 + 3.625650644f * yn;
+        s3 = p0 - 0.8827598095f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.910946488f * w1_0 - 0.9155325294f * w2_0;
+        v = 4.241298029e-06f * ((wn0 + w2_0) + 2.0f * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.947619557f * w1_1 - 0.9642036557f * w2_1;
+        v = wn1 + 2.0f * w1_1 + 0.9999999404f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 6.4036753689559827e-05 * ((x0 + x4) + 4.0 * (x1 + x3) + 6.0 * x2) + 3.6854354846302466 * y1 - 5.1631442343115008 * y2 + 3.2559193762161889 * y3 - 0.77936023324522741 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.6854354846302466 * w1 - 5.1631442343115008 * w2 + 3.2559193762161889 * w3 - 0.77936023324522741 * w4;
+        y[n] = 6.4036753689559827e-05 * ((w0 + w4) + 4.0 * (w1 + w3) + 6.0 * w2);
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 6.4036753689559827e-05 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 4.0 * bx + 3.6854354846302466 * yn;
+        s1 = s2 + 6.0 * bx - 5.1631442343115008 * yn;
+        s2 = s3 + 4.0 * bx + 3.2559193762161889 * yn;
+        s3 = bx - 0.77936023324522741 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.8200622721369968 * w1_0 - 0.83777584326068888 * w2_0;
+        v = 6.4036753689559827e-05 * wn0 + 0.00012807350523109573 * w1_0 + 6.4036754616587352e-05 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.8653732124932532 * w1_1 - 0.93027298353685928 * w2_1;
+        v = wn1 + 2.0000000335436159 * w1_1 + 0.99999998552351244 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 6.40367507e-05f * (x0 + x4) + 0.0002561470028f * (x1 + x3) + 0.0003842205333f * x2 + 3.685435534f * y1 - 5.163144112f * y2 + 3.255919456f * y3 - 0.7793602347f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.685435534f * w1 - 5.163144112f * w2 + 3.255919456f * w3 - 0.7793602347f * w4;
+        y[n] = 6.40367507e-05f * (w0 + w4) + 0.0002561470028f * (w1 + w3) + 0.0003842205333f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 6.40367507e-05f * xn;
+        float p1 = 0.0002561470028f * xn;
+        float p2 = 0.0003842205333f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.685435534f * yn;
+        s1 = s2 + p2 - 5.163144112f * yn;
+        s2 = s3 + p1 + 3.255919456f * yn;
+        s3 = p0 - 0.7793602347f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.820074081f * w1_0 - 0.8377826214f * w2_0;
+        v = 6.40367507e-05f * wn0 + 0.0001304530742f * w1_0 + 6.646136899e-05f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.865361452f * w1_1 - 0.9302654266f * w2_1;
+        v = wn1 + 1.962840438f * w1_1 + 0.9635182619f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.0021406940034960492 * ((x0 + x4) + 4.0 * (x1 + x3) + 6.0 * x2) + 3.0020374504545559 * y1 - 3.732343733269031 * y2 + 2.2292013547944984 * y3 - 0.53732544281100125 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.0020374504545559 * w1 - 3.732343733269031 * w2 + 2.2292013547944984 * w3 - 0.53732544281100125 * w4;
+        y[n] = 0.0021406940034960492 * ((w0 + w4) + 4.0 * (w1 + w3) + 6.0 * w2);
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 0.0021406940034960492 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 4.0 * bx + 3.0020374504545559 * yn;
+        s1 = s2 + 6.0 * bx - 3.732343733269031 * yn;
+        s2 = s3 + 4.0 * bx + 2.2292013547944984 * yn;
+        s3 = bx - 0.53732544281100125 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.5351040012549348 * w1_0 - 0.63723693773182766 * w2_0;
+        v = 0.0021406940034960492 * wn0 + 0.0042813879351854926 * w1_0 + 0.0021406940344857878 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.466933449199622 * w1_1 - 0.84321138809616225 * w2_1;
+        v = wn1 + 2.0000000335436159 * w1_1 + 0.99999998552351244 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.002140694065f * (x0 + x4) + 0.00856277626f * (x1 + x3) + 0.01284416392f * x2 + 3.002037525f * y1 - 3.732343674f * y2 + 2.229201317f * y3 - 0.5373254418f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.002037525f * w1 - 3.732343674f * w2 + 2.229201317f * w3 - 0.5373254418f * w4;
+        y[n] = 0.002140694065f * (w0 + w4) + 0.00856277626f * (w1 + w3) + 0.01284416392f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.002140694065f * xn;
+        float p1 = 0.00856277626f * xn;
+        float p2 = 0.01284416392f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.002037525f * yn;
+        s1 = s2 + p2 - 3.732343674f * yn;
+        s2 = s3 + p1 + 2.229201317f * yn;
+        s3 = p0 - 0.5373254418f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.535104632f * w1_0 - 0.6372373104f * w2_0;
+        v = 0.002140694065f * ((wn0 + w2_0) + 2.0f * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.466932893f * w1_1 - 0.8432109356f * w2_1;
+        v = wn1 + 2.0f * w1_1 + 0.9999999404f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 4.552621650531584e-09 * (x0 + x6) + 2.7315729903189505e-08 * (x1 + x5) + 6.8289324757973753e-08 * (x2 + x4) + 9.1052433010631676e-08 * x3 + 5.853169656722744 * y1 - 14.301072470196102 * y2 + 18.669514057559493 * y3 - 13.734092279306779 * y4 + 5.398071888306931 * y5 - 0.88559118000631909 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 5.853169656722744 * w1 - 14.301072470196102 * w2 + 18.669514057559493 * w3 - 13.734092279306779 * w4 + 5.398071888306931 * w5 - 0.88559118000631909 * w6;
+        y[n] = 4.552621650531584e-09 * (w0 + w6) + 2.7315729903189505e-08 * (w1 + w5) + 6.8289324757973753e-08 * (w2 + w4) + 9.1052433010631676e-08 * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 4.552621650531584e-09 * xn;
+        double p1 = 2.7315729903189505e-08 * xn;
+        double p2 = 6.8289324757973753e-08 * xn;
+        double p3 = 9.1052433010631676e-08 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 5.853169656722744 * yn;
+        s1 = s2 + p2 - 14.301072470196102 * yn;
+        s2 = s3 + p3 + 18.669514057559493 * yn;
+        s3 = s4 + p2 - 13.734092279306779 * yn;
+        s4 = s5 + p1 + 5.398071888306931 * yn;
+        s5 = p0 - 0.88559118000631909 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.9389074695961286 * w1_0 - 0.94098606055893641 * w2_0;
+        v = 4.552621650531584e-09 * wn0 + 9.1317102473631035e-09 * w1_0 + 4.5791400163415998e-09 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.9471805274295781 * w1_1 - 0.9565335648066855 * w2_1;
+        v = wn1 + 1.9999705008234789 * w1_1 + 0.99998170979165124 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.9670816596970351 * w1_2 - 0.98389754862707524 * w2_2;
+        v = wn2 + 1.9942159376000068 * w1_2 + 0.99422706102147329 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 4.552621835e-09f * (x0 + x6) + 2.731573012e-08f * (x1 + x5) + 6.828932442e-08f * (x2 + x4) + 9.105243493e-08f * x3 + 5.853169441f * y1 - 14.30107212f * y2 + 18.6695137f * y3 - 13.73409271f * y4 + 5.398071766f * y5 - 0.8855912089f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 5.853169441f * w1 - 14.30107212f * w2 + 18.6695137f * w3 - 13.73409271f * w4 + 5.398071766f * w5 - 0.8855912089f * w6;
+        y[n] = 4.552621835e-09f * (w0 + w6) + 2.731573012e-08f * (w1 + w5) + 6.828932442e-08f * (w2 + w4) + 9.105243493e-08f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 4.552621835e-09f * xn;
+        float p1 = 2.731573012e-08f * xn;
+        float p2 = 6.828932442e-08f * xn;
+        float p3 = 9.105243493e-08f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 5.853169441f * yn;
+        s1 = s2 + p2 - 14.30107212f * yn;
+        s2 = s3 + p3 + 18.6695137f * yn;
+        s3 = s4 + p2 - 13.73409271f * yn;
+        s4 = s5 + p1 + 5.398071766f * yn;
+        s5 = p0 - 0.8855912089f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.863363981f * w1_0 - 0.8721451163f * w2_0;
+        v = 4.552621835e-09f * wn0 + 9.581328619e-09f * w1_0 + 5.088334198e-09f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 2.03551054f * w1_1 - 1.041854262f * w2_1;
+        v = wn1 + 1.882999182f * w1_1 + 0.8947176337f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.954294801f * w1_2 - 0.9746249318f * w2_2;
+        v = (wn2 + w2_2) + 2.01242733f * w1_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 2.759703907912456e-07 * ((x0 + x6) + 6.0 * (x1 + x5) + 15.0 * (x2 + x4) + 20.0 * x3) + 5.6572756438361305 * y1 - 13.436597254952861 * y2 + 17.146012271341739 * y3 - 12.39601916674493 * y4 + 4.8136174607051512 * y5 - 0.78430877139299071 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 5.6572756438361305 * w1 - 13.436597254952861 * w2 + 17.146012271341739 * w3 - 12.39601916674493 * w4 + 4.8136174607051512 * w5 - 0.78430877139299071 * w6;
+        y[n] = 2.759703907912456e-07 * ((w0 + w6) + 6.0 * (w1 + w5) + 15.0 * (w2 + w4) + 20.0 * w3);
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 2.759703907912456e-07 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 6.0 * bx + 5.6572756438361305 * yn;
+        s1 = s2 + 15.0 * bx - 13.436597254952861 * yn;
+        s2 = s3 + 20.0 * bx + 17.146012271341739 * yn;
+        s3 = s4 + 15.0 * bx - 12.39601916674493 * yn;
+        s4 = s5 + 6.0 * bx + 4.8136174607051512 * yn;
+        s5 = bx - 0.78430877139299071 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.8769333536954353 * w1_0 - 0.88506478957655466 * w2_0;
+        v = 2.759703907912456e-07 * wn0 + 5.5357209090118796e-07 * w1_0 + 2.7760492279743309e-07 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.8784823903475043 * w1_1 - 0.91515398617361299 * w2_1;
+        v = wn1 + 1.999969278309516 * w1_1 + 0.99998086546169862 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.9018598997931901 * w1_2 - 0.96831761578266273 * w2_2;
+        v = wn2 + 1.9941195465313726 * w1_2 + 0.99413104305675626 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 2.759703932e-07f * (x0 + x6) + 1.655822302e-06f * (x1 + x5) + 4.13955604e-06f * (x2 + x4) + 5.51940775e-06f * x3 + 5.657275677f * y1 - 13.43659687f * y2 + 17.14601135f * y3 - 12.39601898f * y4 + 4.813617229f * y5 - 0.7843087912f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 5.657275677f * w1 - 13.43659687f * w2 + 17.14601135f * w3 - 12.39601898f * w4 + 4.813617229f * w5 - 0.7843087912f * w6;
+        y[n] = 2.759703932e-07f * (w0 + w6) + 1.655822302e-06f * (w1 + w5) + 4.13955604e-06f * (w2 + w4) + 5.51940775e-06f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 2.759703932e-07f * xn;
+        float p1 = 1.655822302e-06f * xn;
+        float p2 = 4.13955604e-06f * xn;
+        float p3 = 5.51940775e-06f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 5.657275677f * yn;
+        s1 = s2 + p2 - 13.43659687f * yn;
+        s2 = s3 + p3 + 17.14601135f * yn;
+        s3 = s4 + p2 - 12.39601898f * yn;
+        s4 = s5 + p1 + 4.813617229f * yn;
+        s5 = p0 - 0.7843087912f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.876236796f * w1_0 - 0.8847121596f * w2_0;
+        v = 2.759703932e-07f * wn0 + 6.068789276e-07f * w1_0 + 3.34681431e-07f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.879966497f * w1_1 - 0.9160151482f * w2_1;
+        v = (wn1 + w2_1) + 1.987624049f * w1_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.901072383f * w1_2 - 0.9677928686f * w2_2;
+        v = wn2 + 1.813303351f * w1_2 + 0.8245763779f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 5.8778519749170452e-05 * ((x0 + x6) + 6.0 * (x1 + x5) + 15.0 * (x2 + x4) + 20.0 * x3) + 4.8007012225079837 * y1 - 10.139044371590472 * y2 + 11.984357055510571 * y3 - 8.3357465234071242 * y4 + 3.230724532597125 * y5 - 0.54521275298609506 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 4.8007012225079837 * w1 - 10.139044371590472 * w2 + 11.984357055510571 * w3 - 8.3357465234071242 * w4 + 3.230724532597125 * w5 - 0.54521275298609506 * w6;
+        y[n] = 5.8778519749170452e-05 * ((w0 + w6) + 6.0 * (w1 + w5) + 15.0 * (w2 + w4) + 20.0 * w3);
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 5.8778519749170452e-05 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 6.0 * bx + 4.8007012225079837 * yn;
+        s1 = s2 + 15.0 * bx - 10.139044371590472 * yn;
+        s2 = s3 + 20.0 * bx + 11.984357055510571 * yn;
+        s3 = s4 + 15.0 * bx - 8.3357465234071242 * yn;
+        s4 = s5 + 6.0 * bx + 3.230724532597125 * yn;
+        s5 = bx - 0.54521275298609506 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.6820785713662285 * w1_0 - 0.73112589205936551 * w2_0;
+        v = 5.8778519749170452e-05 * wn0 + 0.0001179044896241718 * w1_0 + 5.9126656270377962e-05 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.5865287215765769 * w1_1 - 0.80445206643978895 * w2_1;
+        v = wn1 + 1.999969278309516 * w1_1 + 0.99998086546169862 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.5320939295651805 * w1_2 - 0.92698705602015341 * w2_2;
+        v = wn2 + 1.9941195465313726 * w1_2 + 0.99413104305675626 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 5.8778518e-05f * (x0 + x6) + 0.000352671108f * (x1 + x5) + 0.0008816777845f * (x2 + x4) + 0.001175570418f * x3 + 4.800701141f * y1 - 10.13904476f * y2 + 11.98435688f * y3 - 8.335746765f * y4 + 3.230724573f * y5 - 0.5452127457f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 4.800701141f * w1 - 10.13904476f * w2 + 11.98435688f * w3 - 8.335746765f * w4 + 3.230724573f * w5 - 0.5452127457f * w6;
+        y[n] = 5.8778518e-05f * (w0 + w6) + 0.000352671108f * (w1 + w5) + 0.0008816777845f * (w2 + w4) + 0.001175570418f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 5.8778518e-05f * xn;
+        float p1 = 0.000352671108f * xn;
+        float p2 = 0.0008816777845f * xn;
+        float p3 = 0.001175570418f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 4.800701141f * yn;
+        s1 = s2 + p2 - 10.13904476f * yn;
+        s2 = s3 + p3 + 11.98435688f * yn;
+        s3 = s4 + p2 - 8.335746765f * yn;
+        s4 = s5 + p1 + 3.230724573f * yn;
+        s5 = p0 - 0.5452127457f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.682051182f * w1_0 - 0.7311116457f * w2_0;
+        v = 5.8778518e-05f * wn0 + 0.0001237179822f * w1_0 + 6.571019185e-05f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.586575866f * w1_1 - 0.8044829369f * w2_1;
+        v = wn1 + 1.882782221f * w1_1 + 0.8945114613f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.532074094f * w1_2 - 0.9269695282f * w2_2;
+        v = (wn2 + w2_2) + 2.012401581f * w1_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 4.8816661469934779e-12 * ((x0 + x8) + 8.0 * (x1 + x7) + 28.0 * (x2 + x6) + 56.0 * (x3 + x5) + 70.0 * x4) + 7.8456959709493157 * y1 - 26.964761773702833 * y2 + 53.024380048377978 * y3 - 65.250423725532457 * y4 + 51.453733585688887 * y5 - 25.390650036417902 * y6 + 7.1685927493179955 * y7 - 0.88656682008318455 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 7.8456959709493157 * w1 - 26.964761773702833 * w2 + 53.024380048377978 * w3 - 65.250423725532457 * w4 + 51.453733585688887 * w5 - 25.390650036417902 * w6 + 7.1685927493179955 * w7 - 0.88656682008318455 * w8;
+        y[n] = 4.8816661469934779e-12 * ((w0 + w8) + 8.0 * (w1 + w7) + 28.0 * (w2 + w6) + 56.0 * (w3 + w5) + 70.0 * w4);
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 4.8816661469934779e-12 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 8.0 * bx + 7.8456959709493157 * yn;
+        s1 = s2 + 28.0 * bx - 26.964761773702833 * yn;
+        s2 = s3 + 56.0 * bx + 53.024380048377978 * yn;
+        s3 = s4 + 70.0 * bx - 65.250423725532457 * yn;
+        s4 = s5 + 56.0 * bx + 51.453733585688887 * yn;
+        s5 = s6 + 28.0 * bx - 25.390650036417902 * yn;
+        s6 = s7 + 8.0 * bx + 7.1685927493179955 * yn;
+        s7 = bx - 0.88656682008318455 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.9537318932544738 * w1_0 - 0.9549116827974431 * w2_0;
+        v = 4.8816661469934779e-12 * wn0 + 9.9138701408547858e-12 * w1_0 + 5.0345527770153858e-12 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.9559514427738995 * w1_1 - 0.9616880653291584 * w2_1;
+        v = wn1 + 1.9996365905853206 * w1_1 + 1.0001120965713541 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.9620432955672378 * w1_2 - 0.97427858988604854 * w2_2;
+        v = wn2 + 1.96916256905117 * w1_2 + 0.96963250539233625 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.9739693393536977 * w1_3 - 0.99090240320393985 * w2_3;
+        v = wn3 + 2.0003634495352691 * w1_3 + 0.99988794144980309 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 4.881666252e-12f * (x0 + x8) + 3.905333001e-11f * (x1 + x7) + 1.366866481e-10f * (x2 + x6) + 2.733732962e-10f * (x3 + x5) + 3.417166272e-10f * x4 + 7.845695972f * y1 - 26.96476173f * y2 + 53.02437973f * y3 - 65.25042725f * y4 + 51.45373535f * y5 - 25.3906498f * y6 + 7.16859293f * y7 - 0.8865668178f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 7.845695972f * w1 - 26.96476173f * w2 + 53.02437973f * w3 - 65.25042725f * w4 + 51.45373535f * w5 - 25.3906498f * w6 + 7.16859293f * w7 - 0.8865668178f * w8;
+        y[n] = 4.881666252e-12f * (w0 + w8) + 3.905333001e-11f * (w1 + w7) + 1.366866481e-10f * (w2 + w6) + 2.733732962e-10f * (w3 + w5) + 3.417166272e-10f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 4.881666252e-12f * xn;
+        float p1 = 3.905333001e-11f * xn;
+        float p2 = 1.366866481e-10f * xn;
+        float p3 = 2.733732962e-10f * xn;
+        float p4 = 3.417166272e-10f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 7.845695972f * yn;
+        s1 = s2 + p2 - 26.96476173f * yn;
+        s2 = s3 + p3 + 53.02437973f * yn;
+        s3 = s4 + p4 - 65.25042725f * yn;
+        s4 = s5 + p3 + 51.45373535f * yn;
+        s5 = s6 + p2 - 25.3906498f * yn;
+        s6 = s7 + p1 + 7.16859293f * yn;
+        s7 = p0 - 0.8865668178f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 2.299443483f * w1_0 - 1.331866622f * w2_0;
+        v = 4.881666252e-12f * wn0 + 1.181240349e-11f * w1_0 + 7.190536794e-12f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.694944024f * w1_1 - 0.7219103575f * w2_1;
+        v = wn1 + 2.129532814f * w1_1 + 1.177872777f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.801157951f * w1_2 - 0.8413719535f * w2_2;
+        v = wn2 + 1.807948112f * w1_2 + 0.8489881158f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 2.050150633f * w1_3 - 1.095921516f * w2_3;
+        v = wn3 + 1.642770767f * w1_3 + 0.6789014935f * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 1.1868468687987785e-09 * ((x0 + x8) + 8.0 * (x1 + x7) + 28.0 * (x2 + x6) + 56.0 * (x3 + x5) + 70.0 * x4) + 7.6251530296123002 * y1 - 25.571400791057865 * y2 + 49.256552059569252 * y3 - 59.60247841901559 * y4 + 46.390706630555698 * y5 - 22.680130179857962 * y6 + 6.3676179539307531 * y7 - 0.78602062464259959 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 7.6251530296123002 * w1 - 25.571400791057865 * w2 + 49.256552059569252 * w3 - 59.60247841901559 * w4 + 46.390706630555698 * w5 - 22.680130179857962 * w6 + 6.3676179539307531 * w7 - 0.78602062464259959 * w8;
+        y[n] = 1.1868468687987785e-09 * ((w0 + w8) + 8.0 * (w1 + w7) + 28.0 * (w2 + w6) + 56.0 * (w3 + w5) + 70.0 * w4);
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 1.1868468687987785e-09 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 8.0 * bx + 7.6251530296123002 * yn;
+        s1 = s2 + 28.0 * bx - 25.571400791057865 * yn;
+        s2 = s3 + 56.0 * bx + 49.256552059569252 * yn;
+        s3 = s4 + 70.0 * bx - 59.60247841901559 * yn;
+        s4 = s5 + 56.0 * bx + 46.390706630555698 * yn;
+        s5 = s6 + 28.0 * bx - 22.680130179857962 * yn;
+        s6 = s7 + 8.0 * bx + 6.3676179539307531 * yn;
+        s7 = bx - 0.78602062464259959 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.9068752945298364 * w1_0 - 0.91152531948131943 * w2_0;
+        v = 1.1868468687987785e-09 * wn0 + 2.4102929983439787e-09 * w1_0 + 1.2240171734978109e-09 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.9022152969028094 * w1_1 - 0.92482507666946057 * w2_1;
+        v = wn1 + 1.9996365905853206 * w1_1 + 1.0001120965713541 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.9011704306334023 * w1_2 - 0.94946009799202236 * w2_2;
+        v = wn2 + 1.96916256905117 * w1_2 + 0.96963250539233625 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.9148920075462508 * w1_3 - 0.98203935018155208 * w2_3;
+        v = wn3 + 2.0003634495352691 * w1_3 + 0.99988794144980309 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 1.186846843e-09f * (x0 + x8) + 9.494774744e-09f * (x1 + x7) + 3.323171072e-08f * (x2 + x6) + 6.646342143e-08f * (x3 + x5) + 8.307927857e-08f * x4 + 7.625153065f * y1 - 25.5714016f * y2 + 49.25655365f * y3 - 59.60247803f * y4 + 46.39070511f * y5 - 22.68013f * y6 + 6.367618084f * y7 - 0.7860206366f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 7.625153065f * w1 - 25.5714016f * w2 + 49.25655365f * w3 - 59.60247803f * w4 + 46.39070511f * w5 - 22.68013f * w6 + 6.367618084f * w7 - 0.7860206366f * w8;
+        y[n] = 1.186846843e-09f * (w0 + w8) + 9.494774744e-09f * (w1 + w7) + 3.323171072e-08f * (w2 + w6) + 6.646342143e-08f * (w3 + w5) + 8.307927857e-08f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 1.186846843e-09f * xn;
+        float p1 = 9.494774744e-09f * xn;
+        float p2 = 3.323171072e-08f * xn;
+        float p3 = 6.646342143e-08f * xn;
+        float p4 = 8.307927857e-08f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 7.625153065f * yn;
+        s1 = s2 + p2 - 25.5714016f * yn;
+        s2 = s3 + p3 + 49.25655365f * yn;
+        s3 = s4 + p4 - 59.60247803f * yn;
+        s4 = s5 + p3 + 46.39070511f * yn;
+        s5 = s6 + p2 - 22.68013f * yn;
+        s6 = s7 + p1 + 6.367618084f * yn;
+        s7 = p0 - 0.7860206366f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.87446475f * w1_0 - 0.8944644928f * w2_0;
+        v = 1.186846843e-09f * wn0 + 2.410292854e-09f * w1_0 + 1.224016999e-09f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.924311638f * w1_1 - 0.9294191003f * w2_1;
+        v = wn1 + 1.99963665f * w1_1 + 1.000112176f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.895674586f * w1_2 - 0.9585186839f * w2_2;
+        v = wn2 + 1.969162583f * w1_2 + 0.9696325064f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 1.93070209f * w1_3 - 0.9864127636f * w2_3;
+        v = wn3 + 2.00036335f * w1_3 + 0.9998879433f * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 1.6062735915279173e-06 * (x0 + x8) + 1.2850188732223338e-05 * (x1 + x7) + 4.4975660562781688e-05 * (x2 + x6) + 8.9951321125563376e-05 * (x3 + x5) + 0.00011243915140695421 * x4 + 6.592352076009659 * y1 - 19.735586193511619 * y2 + 34.947287120849687 * y3 - 39.965871481921553 * y4 + 30.194007737385775 * y5 - 14.709339619004741 * y6 + 4.2246787201600409 * y7 - 0.54798974073199869 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 6.592352076009659 * w1 - 19.735586193511619 * w2 + 34.947287120849687 * w3 - 39.965871481921553 * w4 + 30.194007737385775 * w5 - 14.709339619004741 * w6 + 4.2246787201600409 * w7 - 0.54798974073199869 * w8;
+        y[n] = 1.6062735915279173e-06 * (w0 + w8) + 1.2850188732223338e-05 * (w1 + w7) + 4.4975660562781688e-05 * (w2 + w6) + 8.9951321125563376e-05 * (w3 + w5) + 0.00011243915140695421 * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 1.6062735915279173e-06 * xn;
+        double p1 = 1.2850188732223338e-05 * xn;
+        double p2 = 4.4975660562781688e-05 * xn;
+        double p3 = 8.9951321125563376e-05 * xn;
+        double p4 = 0.00011243915140695421 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 6.592352076009659 * yn;
+        s1 = s2 + p2 - 19.735586193511619 * yn;
+        s2 = s3 + p3 + 34.947287120849687 * yn;
+        s3 = s4 + p4 - 39.965871481921553 * yn;
+        s4 = s5 + p3 + 30.194007737385775 * yn;
+        s5 = s6 + p2 - 14.709339619004741 * yn;
+        s6 = s7 + p1 + 4.2246787201600409 * yn;
+        s7 = p0 - 0.54798974073199869 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.759345384893086 * w1_0 - 0.78806572803019947 * w2_0;
+        v = 1.6062735915279173e-06 * wn0 + 3.2569251029533986e-06 * w1_0 + 1.6512753629247065e-06 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.6846324666580994 * w1_1 - 0.82237705847427534 * w2_1;
+        v = wn1 + 1.9995200325039777 * w1_1 + 0.99990173947553884 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.5926695765042624 * w1_2 - 0.88239714978308292 * w2_2;
+        v = wn2 + 1.9723721471370803 * w1_2 + 0.97274726938574518 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.5557046479542169 * w1_3 - 0.95824134151550711 * w2_3;
+        v = wn3 + 2.000479949159633 * w1_3 + 1.0000982647257308 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void cheby1_df1_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 1.606273599e-06f * (x0 + x8) + 1.28501888e-05f * (x1 + x7) + 4.497565897e-05f * (x2 + x6) + 8.995131793e-05f * (x3 + x5) + 0.0001124391492f * x4 + 6.592351913f * y1 - 19.73558617f * y2 + 34.94728851f * y3 - 39.9658699f * y4 + 30.19400787f * y5 - 14.7093401f * y6 + 4.224678516f * y7 - 0.5479897261f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_df2_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 6.592351913f * w1 - 19.73558617f * w2 + 34.94728851f * w3 - 39.9658699f * w4 + 30.19400787f * w5 - 14.7093401f * w6 + 4.224678516f * w7 - 0.5479897261f * w8;
+        y[n] = 1.606273599e-06f * (w0 + w8) + 1.28501888e-05f * (w1 + w7) + 4.497565897e-05f * (w2 + w6) + 8.995131793e-05f * (w3 + w5) + 0.0001124391492f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby1_tdf2_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 1.606273599e-06f * xn;
+        float p1 = 1.28501888e-05f * xn;
+        float p2 = 4.497565897e-05f * xn;
+        float p3 = 8.995131793e-05f * xn;
+        float p4 = 0.0001124391492f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 6.592351913f * yn;
+        s1 = s2 + p2 - 19.73558617f * yn;
+        s2 = s3 + p3 + 34.94728851f * yn;
+        s3 = s4 + p4 - 39.9658699f * yn;
+        s4 = s5 + p3 + 30.19400787f * yn;
+        s5 = s6 + p2 - 14.7093401f * yn;
+        s6 = s7 + p1 + 4.224678516f * yn;
+        s7 = p0 - 0.5479897261f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby1_cascade_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.759927154f * w1_0 - 0.7884431481f * w2_0;
+        v = 1.606273599e-06f * wn0 + 3.886777904e-06f * w1_0 + 2.365989076e-06f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.683268905f * w1_1 - 0.8213779926f * w2_1;
+        v = wn1 + 2.129532814f * w1_1 + 1.177872777f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.593872309f * w1_2 - 0.8835068941f * w2_2;
+        v = wn2 + 1.807948112f * w1_2 + 0.8489881158f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 1.555283546f * w1_3 - 0.9577429891f * w2_3;
+        v = wn3 + 1.642770767f * w1_3 + 0.6789014935f * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.75594092840262728 * x0 + -1.4861233229763315 * x1 + 0.75594092840262717 * x2 + 1.8742531858443288 * y1 - 0.90001171967325155 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.8742531858443288 * w1 - 0.90001171967325155 * w2;
+        y[n] = 0.75594092840262728 * w0 + -1.4861233229763315 * w1 + 0.75594092840262717 * w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.75594092840262728 * xn;
+        s0 = s1 + -1.4861233229763315 * xn + 1.8742531858443288 * yn;
+        s1 = 0.75594092840262717 * xn - 0.90001171967325155 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.8742531858443288 * w1_0 - 0.90001171967325155 * w2_0;
+        v = 0.75594092840262728 * wn0 + -1.4861233229763315 * w1_0 + 0.75594092840262705 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.7559409142f * (x0 + x2) + -1.486123323f * x1 + 1.874253154f * y1 - 0.9000117183f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.874253154f * w1 - 0.9000117183f * w2;
+        y[n] = 0.7559409142f * (w0 + w2) + -1.486123323f * w1;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.7559409142f * xn;
+        float p1 = -1.486123323f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 1.874253154f * yn;
+        s1 = p0 - 0.9000117183f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.874253154f * w1_0 - 0.9000117183f * w2_0;
+        v = 0.7559409142f * (wn0 + w2_0) + -1.486123323f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.72477229877549809 * (x0 + x2) + -1.3524153285065244 * x1 + 1.7151646423491236 * y1 - 0.81229391139359552 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.7151646423491236 * w1 - 0.81229391139359552 * w2;
+        y[n] = 0.72477229877549809 * (w0 + w2) + -1.3524153285065244 * w1;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 0.72477229877549809 * xn;
+        double p1 = -1.3524153285065244 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 1.7151646423491236 * yn;
+        s1 = p0 - 0.81229391139359552 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.7151646423491234 * w1_0 - 0.8122939113935953 * w2_0;
+        v = 0.72477229877549809 * wn0 + -1.3524153285065244 * w1_0 + 0.72477229877549798 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.7247722745f * (x0 + x2) + -1.352415323f * x1 + 1.715164661f * y1 - 0.8122938871f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.715164661f * w1 - 0.8122938871f * w2;
+        y[n] = 0.7247722745f * (w0 + w2) + -1.352415323f * w1;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.7247722745f * xn;
+        float p1 = -1.352415323f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 1.715164661f * yn;
+        s1 = p0 - 0.8122938871f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.715164661f * w1_0 - 0.8122938871f * w2_0;
+        v = 0.7247722745f * (wn0 + w2_0) + -1.352415323f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.67060637375166865 * x0 + -0.8388085533185573 * x1 + 0.67060637375166876 * x2 + 1.1210400098362399 * y1 - 0.62344420402101997 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.1210400098362399 * w1 - 0.62344420402101997 * w2;
+        y[n] = 0.67060637375166865 * w0 + -0.8388085533185573 * w1 + 0.67060637375166876 * w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.67060637375166865 * xn;
+        s0 = s1 + -0.8388085533185573 * xn + 1.1210400098362399 * yn;
+        s1 = 0.67060637375166876 * xn - 0.62344420402101997 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.1210400098362396 * w1_0 - 0.62344420402101985 * w2_0;
+        v = 0.67060637375166865 * wn0 + -0.83880855331855753 * w1_0 + 0.67060637375166876 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.6706063747f * (x0 + x2) + -0.8388085365f * x1 + 1.121039987f * y1 - 0.6234441996f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.121039987f * w1 - 0.6234441996f * w2;
+        y[n] = 0.6706063747f * (w0 + w2) + -0.8388085365f * w1;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.6706063747f * xn;
+        float p1 = -0.8388085365f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 1.121039987f * yn;
+        s1 = p0 - 0.6234441996f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.121039987f * w1_0 - 0.6234441996f * w2_0;
+        v = 0.6706063747f * (wn0 + w2_0) + -0.8388085365f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.70726872048881018 * (x0 + x4) + -2.7342828596725233 * (x1 + x3) + 4.0556432878350579 * x2 + 3.6658990070258426 * y1 - 5.1127282691745704 * y2 + 3.2188264266198168 * y3 - 0.77361217393872073 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.6658990070258426 * w1 - 5.1127282691745704 * w2 + 3.2188264266198168 * w3 - 0.77361217393872073 * w4;
+        y[n] = 0.70726872048881018 * (w0 + w4) + -2.7342828596725233 * (w1 + w3) + 4.0556432878350579 * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 0.70726872048881018 * xn;
+        double p1 = -2.7342828596725233 * xn;
+        double p2 = 4.0556432878350579 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 3.6658990070258426 * yn;
+        s1 = s2 + p2 - 5.1127282691745704 * yn;
+        s2 = s3 + p1 + 3.2188264266198168 * yn;
+        s3 = p0 - 0.77361217393872073 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.7048213697120382 * w1_0 - 0.78923044133757636 * w2_0;
+        v = 0.70726872048881018 * wn0 + -1.3339128849935622 * w1_0 + 0.7072687204888074 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.9610776373138075 * w1_1 - 0.98021076408002938 * w2_1;
+        v = wn1 + -1.9799687645045767 * w1_1 + 1.0000000000000047 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.7072687149f * (x0 + x4) + -2.73428297f * (x1 + x3) + 4.055643082f * x2 + 3.665899038f * y1 - 5.112728119f * y2 + 3.218826532f * y3 - 0.7736122012f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.665899038f * w1 - 5.112728119f * w2 + 3.218826532f * w3 - 0.7736122012f * w4;
+        y[n] = 0.7072687149f * (w0 + w4) + -2.73428297f * (w1 + w3) + 4.055643082f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.7072687149f * xn;
+        float p1 = -2.73428297f * xn;
+        float p2 = 4.055643082f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.665899038f * yn;
+        s1 = s2 + p2 - 5.112728119f * yn;
+        s2 = s3 + p1 + 3.218826532f * yn;
+        s3 = p0 - 0.7736122012f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.704828262f * w1_0 - 0.7892387509f * w2_0;
+        v = 0.7072687149f * (wn0 + w2_0) + -1.333910346f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.961070776f * w1_1 - 0.9802005291f * w2_1;
+        v = (wn1 + w2_1) + -1.979972482f * w1_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.65063632895538037 * x0 + -2.2753276208914905 * x1 + 3.2713083773805183 * x2 + -2.2753276208914905 * x3 + 0.65063632895538048 * x4 + 3.2331192805309223 * y1 - 4.1402055680977936 * y2 + 2.498654816220526 * y3 - 0.61349432216195199 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.2331192805309223 * w1 - 4.1402055680977936 * w2 + 2.498654816220526 * w3 - 0.61349432216195199 * w4;
+        y[n] = 0.65063632895538037 * w0 + -2.2753276208914905 * w1 + 3.2713083773805183 * w2 + -2.2753276208914905 * w3 + 0.65063632895538048 * w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.65063632895538037 * xn;
+        s0 = s1 + -2.2753276208914905 * xn + 3.2331192805309223 * yn;
+        s1 = s2 + 3.2713083773805183 * xn - 4.1402055680977936 * yn;
+        s2 = s3 + -2.2753276208914905 * xn + 2.498654816220526 * yn;
+        s3 = 0.65063632895538048 * xn - 0.61349432216195199 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.3472667639179252 * w1_0 - 0.63825799394825378 * w2_0;
+        v = 0.65063632895538037 * wn0 + -1.0258508542592695 * w1_0 + 0.65063632895537571 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.8858525166129945 * w1_1 - 0.9612011568658696 * w2_1;
+        v = wn1 + -1.9203919471239774 * w1_1 + 1.0000000000000049 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.6506363153f * (x0 + x4) + -2.275327682f * (x1 + x3) + 3.271308422f * x2 + 3.233119249f * y1 - 4.140205383f * y2 + 2.498654842f * y3 - 0.6134943366f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.233119249f * w1 - 4.140205383f * w2 + 2.498654842f * w3 - 0.6134943366f * w4;
+        y[n] = 0.6506363153f * (w0 + w4) + -2.275327682f * (w1 + w3) + 3.271308422f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.6506363153f * xn;
+        float p1 = -2.275327682f * xn;
+        float p2 = 3.271308422f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.233119249f * yn;
+        s1 = s2 + p2 - 4.140205383f * yn;
+        s2 = s3 + p1 + 2.498654842f * yn;
+        s3 = p0 - 0.6134943366f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.347267151f * w1_0 - 0.6382587552f * w2_0;
+        v = 0.6506363153f * wn0 + -1.025851011f * w1_0 + 0.650636375f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.885852098f * w1_1 - 0.9612000585f * w2_1;
+        v = (wn1 + w2_1) + -1.920391798f * w1_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.59953994513020714 * x0 + -1.0568852407616651 * x1 + 1.4171179321770671 * x2 + -1.0568852407616653 * x3 + 0.59953994513020714 * x4 + 1.7812114952350941 * y1 - 1.8179886192206118 * y2 + 0.94491348172644229 * y3 - 0.4105636986550758 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.7812114952350941 * w1 - 1.8179886192206118 * w2 + 0.94491348172644229 * w3 - 0.4105636986550758 * w4;
+        y[n] = 0.59953994513020714 * w0 + -1.0568852407616651 * w1 + 1.4171179321770671 * w2 + -1.0568852407616653 * w3 + 0.59953994513020714 * w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.59953994513020714 * xn;
+        s0 = s1 + -1.0568852407616651 * xn + 1.7812114952350941 * yn;
+        s1 = s2 + 1.4171179321770671 * xn - 1.8179886192206118 * yn;
+        s2 = s3 + -1.0568852407616653 * xn + 0.94491348172644229 * yn;
+        s3 = 0.59953994513020714 * xn - 0.4105636986550758 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 0.30976366727175275 * w1_0 - 0.45017164762401585 * w2_0;
+        v = 0.59953994513020714 * wn0 + -0.14304790408602791 * w1_0 + 0.5995399451302057 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.4714478279633425 * w1_1 - 0.91201589620761703 * w2_1;
+        v = wn1 + -1.5242309442403728 * w1_1 + 0.99999999999999911 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.5995399356f * (x0 + x4) + -1.056885242f * (x1 + x3) + 1.417117953f * x2 + 1.781211495f * y1 - 1.817988634f * y2 + 0.9449135065f * y3 - 0.4105637074f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.781211495f * w1 - 1.817988634f * w2 + 0.9449135065f * w3 - 0.4105637074f * w4;
+        y[n] = 0.5995399356f * (w0 + w4) + -1.056885242f * (w1 + w3) + 1.417117953f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.5995399356f * xn;
+        float p1 = -1.056885242f * xn;
+        float p2 = 1.417117953f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 1.781211495f * yn;
+        s1 = s2 + p2 - 1.817988634f * yn;
+        s2 = s3 + p1 + 0.9449135065f * yn;
+        s3 = p0 - 0.4105637074f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 0.30976367f * w1_0 - 0.4501716495f * w2_0;
+        v = 0.5995399356f * (wn0 + w2_0) + -0.143047899f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.471447825f * w1_1 - 0.9120158553f * w2_1;
+        v = (wn1 + w2_1) + -1.524230957f * w1_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.66632910489439612 * x0 + -3.8024261469139491 * x1 + 9.2215770520353537 * x2 + -12.170859676473073 * x3 + 9.2215770520353537 * x4 + -3.8024261469139491 * x5 + 0.66632910489439623 * x6 + 5.4301391948279232 * y1 - 12.421863010087559 * y2 + 15.342066121826896 * y3 - 10.807022809821451 * y4 + 4.1239540098277754 * y5 - 0.66737385013211148 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 5.4301391948279232 * w1 - 12.421863010087559 * w2 + 15.342066121826896 * w3 - 10.807022809821451 * w4 + 4.1239540098277754 * w5 - 0.66737385013211148 * w6;
+        y[n] = 0.66632910489439612 * w0 + -3.8024261469139491 * w1 + 9.2215770520353537 * w2 + -12.170859676473073 * w3 + 9.2215770520353537 * w4 + -3.8024261469139491 * w5 + 0.66632910489439623 * w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.66632910489439612 * xn;
+        s0 = s1 + -3.8024261469139491 * xn + 5.4301391948279232 * yn;
+        s1 = s2 + 9.2215770520353537 * xn - 12.421863010087559 * yn;
+        s2 = s3 + -12.170859676473073 * xn + 15.342066121826896 * yn;
+        s3 = s4 + 9.2215770520353537 * xn - 10.807022809821451 * yn;
+        s4 = s5 + -3.8024261469139491 * xn + 4.1239540098277754 * yn;
+        s5 = 0.66632910489439623 * xn - 0.66737385013211148 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.5302356447864911 * w1_0 - 0.70196847473140378 * w2_0;
+        v = 0.66632910489439612 * wn0 + -1.1720306408977961 * w1_0 + 0.66632910489423258 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.9262594493285035 * w1_1 - 0.95873814775552779 * w2_1;
+        v = wn1 + -1.9659252028047498 * w1_1 + 1.0000000000038511 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.9736441007129275 * w1_2 - 0.99163436548811501 * w2_2;
+        v = wn2 + -1.9816668904943016 * w1_2 + 0.99999999999639277 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.6663290858f * (x0 + x6) + -3.8024261f * (x1 + x5) + 9.221576691f * (x2 + x4) + -12.17085934f * x3 + 5.430139065f * y1 - 12.4218626f * y2 + 15.34206581f * y3 - 10.80702305f * y4 + 4.123953819f * y5 - 0.667373836f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 5.430139065f * w1 - 12.4218626f * w2 + 15.34206581f * w3 - 10.80702305f * w4 + 4.123953819f * w5 - 0.667373836f * w6;
+        y[n] = 0.6663290858f * (w0 + w6) + -3.8024261f * (w1 + w5) + 9.221576691f * (w2 + w4) + -12.17085934f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.6663290858f * xn;
+        float p1 = -3.8024261f * xn;
+        float p2 = 9.221576691f * xn;
+        float p3 = -12.17085934f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 5.430139065f * yn;
+        s1 = s2 + p2 - 12.4218626f * yn;
+        s2 = s3 + p3 + 15.34206581f * yn;
+        s3 = s4 + p2 - 10.80702305f * yn;
+        s4 = s5 + p1 + 4.123953819f * yn;
+        s5 = p0 - 0.667373836f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.530279994f * w1_0 - 0.7019976377f * w2_0;
+        v = 0.6663290858f * (wn0 + w2_0) + -1.172028065f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.925395846f * w1_1 - 0.9577736259f * w2_1;
+        v = (wn1 + w2_1) + -1.965956211f * w1_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.974463224f * w1_2 - 0.9925917387f * w2_2;
+        v = wn2 + -1.981639624f * w1_2 + 0.9999999404f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.601603583789034 * x0 + -2.9904584657396325 * x1 + 6.6556590581129607 * x2 + -8.528772365936268 * x3 + 6.6556590581129615 * x4 + -2.9904584657396329 * x5 + 0.60160358378903411 * x6 + 4.6990365374861325 * y1 - 9.5457905753619237 * y2 + 10.792523485197711 * y3 - 7.2440689639878757 * y4 + 2.7756826309539737 * y5 - 0.482219100676476 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 4.6990365374861325 * w1 - 9.5457905753619237 * w2 + 10.792523485197711 * w3 - 7.2440689639878757 * w4 + 2.7756826309539737 * w5 - 0.482219100676476 * w6;
+        y[n] = 0.601603583789034 * w0 + -2.9904584657396325 * w1 + 6.6556590581129607 * w2 + -8.528772365936268 * w3 + 6.6556590581129615 * w4 + -2.9904584657396329 * w5 + 0.60160358378903411 * w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.601603583789034 * xn;
+        s0 = s1 + -2.9904584657396325 * xn + 4.6990365374861325 * yn;
+        s1 = s2 + 6.6556590581129607 * xn - 9.5457905753619237 * yn;
+        s2 = s3 + -8.528772365936268 * xn + 10.792523485197711 * yn;
+        s3 = s4 + 6.6556590581129615 * xn - 7.2440689639878757 * yn;
+        s4 = s5 + -2.9904584657396329 * xn + 2.7756826309539737 * yn;
+        s5 = 0.60160358378903411 * xn - 0.482219100676476 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 0.99147261372712414 * w1_0 - 0.53253072541959057 * w2_0;
+        v = 0.601603583789034 * wn0 + -0.70855528012208224 * w1_0 + 0.60160358378904011 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.7953816716614133 * w1_1 - 0.92072328306598705 * w2_1;
+        v = wn1 + -1.8659865047151722 * w1_1 + 0.99999999999984635 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.9121822520975975 * w1_2 - 0.98349150453434941 * w2_2;
+        v = wn2 + -1.9270480567573789 * w1_2 + 1.0000000000001452 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.6016035676f * (x0 + x6) + -2.990458488f * (x1 + x5) + 6.655659199f * (x2 + x4) + -8.528772354f * x3 + 4.699036598f * y1 - 9.545790672f * y2 + 10.79252338f * y3 - 7.244069099f * y4 + 2.775682688f * y5 - 0.4822191f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 4.699036598f * w1 - 9.545790672f * w2 + 10.79252338f * w3 - 7.244069099f * w4 + 2.775682688f * w5 - 0.4822191f * w6;
+        y[n] = 0.6016035676f * (w0 + w6) + -2.990458488f * (w1 + w5) + 6.655659199f * (w2 + w4) + -8.528772354f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.6016035676f * xn;
+        float p1 = -2.990458488f * xn;
+        float p2 = 6.655659199f * xn;
+        float p3 = -8.528772354f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 4.699036598f * yn;
+        s1 = s2 + p2 - 9.545790672f * yn;
+        s2 = s3 + p3 + 10.79252338f * yn;
+        s3 = s4 + p2 - 7.244069099f * yn;
+        s4 = s5 + p1 + 2.775682688f * yn;
+        s5 = p0 - 0.4822191f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 0.9914731979f * w1_0 - 0.5325314403f * w2_0;
+        v = 0.6016035676f * (wn0 + w2_0) + -0.7085548043f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.795372009f * w1_1 - 0.920707047f * w2_1;
+        v = wn1 + -1.866007686f * w1_1 + 0.9999999404f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.912191391f * w1_2 - 0.983507514f * w2_2;
+        v = (wn2 + w2_2) + -1.927027702f * w1_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.57915907995435889 * x0 + -1.3214183698787583 * x1 + 2.0057215434998317 * x2 + -2.0443334341327128 * x3 + 2.0057215434998312 * x4 + -1.321418369878758 * x5 + 0.579159079954359 * x6 + 2.447404352556446 * y1 - 3.339112524633558 * y2 + 2.6736369090335255 * y3 - 1.7574545471216731 * y4 + 0.84223392587883372 * y5 - 0.34929918873172561 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 2.447404352556446 * w1 - 3.339112524633558 * w2 + 2.6736369090335255 * w3 - 1.7574545471216731 * w4 + 0.84223392587883372 * w5 - 0.34929918873172561 * w6;
+        y[n] = 0.57915907995435889 * w0 + -1.3214183698787583 * w1 + 2.0057215434998317 * w2 + -2.0443334341327128 * w3 + 2.0057215434998312 * w4 + -1.321418369878758 * w5 + 0.579159079954359 * w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.57915907995435889 * xn;
+        s0 = s1 + -1.3214183698787583 * xn + 2.447404352556446 * yn;
+        s1 = s2 + 2.0057215434998317 * xn - 3.339112524633558 * yn;
+        s2 = s3 + -2.0443334341327128 * xn + 2.6736369090335255 * yn;
+        s3 = s4 + 2.0057215434998312 * xn - 1.7574545471216731 * yn;
+        s4 = s5 + -1.321418369878758 * xn + 0.84223392587883372 * yn;
+        s5 = 0.579159079954359 * xn - 0.34929918873172561 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v - 0.25154616635486049 * w1_0 - 0.43489593130818077 * w2_0;
+        v = 0.57915907995435889 * wn0 + 0.30666523822943248 * w1_0 + 0.57915907995435911 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.1628406443954042 * w1_1 - 0.83509560237697134 * w2_1;
+        v = wn1 + -1.2508210272829543 * w1_1 + 1.0000000000000004 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.5361098745159039 * w1_2 - 0.96178065081779174 * w2_2;
+        v = wn2 + -1.5602954076635478 * w1_2 + 1.0000000000000027 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.579159081f * (x0 + x6) + -1.321418405f * (x1 + x5) + 2.005721569f * (x2 + x4) + -2.044333458f * x3 + 2.447404385f * y1 - 3.33911252f * y2 + 2.673636913f * y3 - 1.757454515f * y4 + 0.8422338963f * y5 - 0.3492991924f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 2.447404385f * w1 - 3.33911252f * w2 + 2.673636913f * w3 - 1.757454515f * w4 + 0.8422338963f * w5 - 0.3492991924f * w6;
+        y[n] = 0.579159081f * (w0 + w6) + -1.321418405f * (w1 + w5) + 2.005721569f * (w2 + w4) + -2.044333458f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.579159081f * xn;
+        float p1 = -1.321418405f * xn;
+        float p2 = 2.005721569f * xn;
+        float p3 = -2.044333458f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 2.447404385f * yn;
+        s1 = s2 + p2 - 3.33911252f * yn;
+        s2 = s3 + p3 + 2.673636913f * yn;
+        s3 = s4 + p2 - 1.757454515f * yn;
+        s4 = s5 + p1 + 0.8422338963f * yn;
+        s5 = p0 - 0.3492991924f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v - 0.2515461743f * w1_0 - 0.4348958731f * w2_0;
+        v = 0.579159081f * (wn0 + w2_0) + 0.3066652417f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.162840486f * w1_1 - 0.8350955844f * w2_1;
+        v = (wn1 + w2_1) + -1.250820994f * w1_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.536110044f * w1_2 - 0.9617807269f * w2_2;
+        v = (wn2 + w2_2) + -1.560295701f * w1_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.63296353240264691 * x0 + -4.7452694212463369 * x1 + 15.839110706210569 * x2 + -30.775707414385284 * x3 + 38.097811388304073 * x4 + -30.775707414385284 * x5 + 15.839110706210571 * x6 + -4.7452694212463378 * x7 + 0.63296353240264736 * x8 + 7.1767542257243404 * y1 - 22.731975970869293 * y2 + 41.555753117565892 * y3 - 48.022853183267635 * y4 + 35.982465640236875 * y5 - 17.100884138252663 * y6 + 4.7215485986567707 * y7 - 0.58081448406156133 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 7.1767542257243404 * w1 - 22.731975970869293 * w2 + 41.555753117565892 * w3 - 48.022853183267635 * w4 + 35.982465640236875 * w5 - 17.100884138252663 * w6 + 4.7215485986567707 * w7 - 0.58081448406156133 * w8;
+        y[n] = 0.63296353240264691 * w0 + -4.7452694212463369 * w1 + 15.839110706210569 * w2 + -30.775707414385284 * w3 + 38.097811388304073 * w4 + -30.775707414385284 * w5 + 15.839110706210571 * w6 + -4.7452694212463378 * w7 + 0.63296353240264736 * w8;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.63296353240264691 * xn;
+        s0 = s1 + -4.7452694212463369 * xn + 7.1767542257243404 * yn;
+        s1 = s2 + 15.839110706210569 * xn - 22.731975970869293 * yn;
+        s2 = s3 + -30.775707414385284 * xn + 41.555753117565892 * yn;
+        s3 = s4 + 38.097811388304073 * xn - 48.022853183267635 * yn;
+        s4 = s5 + -30.775707414385284 * xn + 35.982465640236875 * yn;
+        s5 = s6 + 15.839110706210571 * xn - 17.100884138252663 * yn;
+        s6 = s7 + -4.7452694212463378 * xn + 4.7215485986567707 * yn;
+        s7 = 0.63296353240264736 * xn - 0.58081448406156133 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.3515261604891524 * w1_0 - 0.63100794949682015 * w2_0;
+        v = 0.63296353240264691 * wn0 + -1.0091355508083975 * w1_0 + 0.63296353240280712 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.8897638503757752 * w1_1 - 0.94177987754558312 * w2_1;
+        v = wn1 + -1.9450917084308128 * w1_1 + 0.99999999994652267 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.9576879953643007 * w1_2 - 0.98189568953204387 * w2_2;
+        v = wn2 + -1.9752977979671913 * w1_2 + 1.000000000273173 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.9777762194951225 * w1_3 - 0.99537756320251292 * w2_3;
+        v = wn3 + -1.9822157452127311 * w1_3 + 0.99999999978006004 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.6329635382f * (x0 + x8) + -4.745269299f * (x1 + x7) + 15.83911037f * (x2 + x6) + -30.77570724f * (x3 + x5) + 38.09781265f * x4 + 7.176753998f * y1 - 22.73197556f * y2 + 41.5557518f * y3 - 48.02285385f * y4 + 35.98246384f * y5 - 17.10088348f * y6 + 4.721548557f * y7 - 0.5808144808f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 7.176753998f * w1 - 22.73197556f * w2 + 41.5557518f * w3 - 48.02285385f * w4 + 35.98246384f * w5 - 17.10088348f * w6 + 4.721548557f * w7 - 0.5808144808f * w8;
+        y[n] = 0.6329635382f * (w0 + w8) + -4.745269299f * (w1 + w7) + 15.83911037f * (w2 + w6) + -30.77570724f * (w3 + w5) + 38.09781265f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.6329635382f * xn;
+        float p1 = -4.745269299f * xn;
+        float p2 = 15.83911037f * xn;
+        float p3 = -30.77570724f * xn;
+        float p4 = 38.09781265f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 7.176753998f * yn;
+        s1 = s2 + p2 - 22.73197556f * yn;
+        s2 = s3 + p3 + 41.5557518f * yn;
+        s3 = s4 + p4 - 48.02285385f * yn;
+        s4 = s5 + p3 + 35.98246384f * yn;
+        s5 = s6 + p2 - 17.10088348f * yn;
+        s6 = s7 + p1 + 4.721548557f * yn;
+        s7 = p0 - 0.5808144808f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.351358652f * w1_0 - 0.6309102178f * w2_0;
+        v = 0.6329635382f * (wn0 + w2_0) + -1.009162068f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.845293283f * w1_1 - 0.8711329103f * w2_1;
+        v = wn1 + -1.894723773f * w1_1 + 0.9163606763f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 2.076993704f * w1_2 - 1.098592401f * w2_2;
+        v = wn2 + -2.067661524f * w1_2 + 1.091273308f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 1.903108478f * w1_3 - 0.9619420767f * w2_3;
+        v = (wn3 + w2_3) + -1.940177798f * w1_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.570865964988166 * x0 + -3.6347592676959803 * x1 + 10.688100726945587 * x2 + -19.14201179386043 * x3 + 23.036661185567354 * x4 + -19.142011793860437 * x5 + 10.688100726945587 * x6 + -3.6347592676959817 * x7 + 0.570865964988166 * x8 + 6.1481032847685526 * y1 - 16.96764856857385 * y2 + 27.586425432509593 * y3 - 29.147411587165429 * y4 + 20.737946073359527 * y5 - 9.8346706647986704 * y6 + 2.8761732379338034 * y7 - 0.39996965435556364 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 6.1481032847685526 * w1 - 16.96764856857385 * w2 + 27.586425432509593 * w3 - 29.147411587165429 * w4 + 20.737946073359527 * w5 - 9.8346706647986704 * w6 + 2.8761732379338034 * w7 - 0.39996965435556364 * w8;
+        y[n] = 0.570865964988166 * w0 + -3.6347592676959803 * w1 + 10.688100726945587 * w2 + -19.14201179386043 * w3 + 23.036661185567354 * w4 + -19.142011793860437 * w5 + 10.688100726945587 * w6 + -3.6347592676959817 * w7 + 0.570865964988166 * w8;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.570865964988166 * xn;
+        s0 = s1 + -3.6347592676959803 * xn + 6.1481032847685526 * yn;
+        s1 = s2 + 10.688100726945587 * xn - 16.96764856857385 * yn;
+        s2 = s3 + -19.14201179386043 * xn + 27.586425432509593 * yn;
+        s3 = s4 + 23.036661185567354 * xn - 29.147411587165429 * yn;
+        s4 = s5 + -19.142011793860437 * xn + 20.737946073359527 * yn;
+        s5 = s6 + 10.688100726945587 * xn - 9.8346706647986704 * yn;
+        s6 = s7 + -3.6347592676959817 * xn + 2.8761732379338034 * yn;
+        s7 = 0.570865964988166 * xn - 0.39996965435556364 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 0.66337103231076289 * w1_0 - 0.46988089365462521 * w2_0;
+        v = 0.570865964988166 * wn0 + -0.42723480027837801 * w1_0 + 0.57086596498815634 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.6942375327242689 * w1_1 - 0.8905874823123624 * w2_1;
+        v = wn1 + -1.7873266686649227 * w1_1 + 1.000000000001305 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.869553701460231 * w1_2 - 0.96460826957481849 * w2_2;
+        v = wn2 + -1.9021700936346742 * w1_2 + 0.99999999999357581 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.9209410182732833 * w1_3 - 0.99085861400568986 * w2_3;
+        v = wn3 + -1.9292030098686261 * w1_3 + 1.0000000000051315 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.5708659887f * (x0 + x8) + -3.634759188f * (x1 + x7) + 10.68810081f * (x2 + x6) + -19.14201164f * (x3 + x5) + 23.03666115f * x4 + 6.148103237f * y1 - 16.96764946f * y2 + 27.58642578f * y3 - 29.14741135f * y4 + 20.73794556f * y5 - 9.834671021f * y6 + 2.876173258f * y7 - 0.3999696672f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 6.148103237f * w1 - 16.96764946f * w2 + 27.58642578f * w3 - 29.14741135f * w4 + 20.73794556f * w5 - 9.834671021f * w6 + 2.876173258f * w7 - 0.3999696672f * w8;
+        y[n] = 0.5708659887f * (w0 + w8) + -3.634759188f * (w1 + w7) + 10.68810081f * (w2 + w6) + -19.14201164f * (w3 + w5) + 23.03666115f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.5708659887f * xn;
+        float p1 = -3.634759188f * xn;
+        float p2 = 10.68810081f * xn;
+        float p3 = -19.14201164f * xn;
+        float p4 = 23.03666115f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 6.148103237f * yn;
+        s1 = s2 + p2 - 16.96764946f * yn;
+        s2 = s3 + p3 + 27.58642578f * yn;
+        s3 = s4 + p4 - 29.14741135f * yn;
+        s4 = s5 + p3 + 20.73794556f * yn;
+        s5 = s6 + p2 - 9.834671021f * yn;
+        s6 = s7 + p1 + 2.876173258f * yn;
+        s7 = p0 - 0.3999696672f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 0.6633707285f * w1_0 - 0.4698815346f * w2_0;
+        v = 0.5708659887f * (wn0 + w2_0) + -0.4272348285f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.694316745f * w1_1 - 0.8907088637f * w2_1;
+        v = (wn1 + w2_1) + -1.787306428f * w1_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.869024277f * w1_2 - 0.9637042284f * w2_2;
+        v = (wn2 + w2_2) + -1.902329922f * w1_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 1.921391606f * w1_3 - 0.9916516542f * w2_3;
+        v = (wn3 + w2_3) + -1.929062724f * w1_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.57380776072331974 * x0 + -1.6677463749088537 * x1 + 2.8944518570235931 * x2 + -3.2997157345500883 * x3 + 3.4571457152535929 * x4 + -3.2997157345500892 * x5 + 2.8944518570235918 * x6 + -1.6677463749088528 * x7 + 0.57380776072331974 * x8 + 3.1406429361307486 * y1 - 5.3787062959187573 * y2 + 5.6467853273518909 * y3 - 4.4712114263905427 * y4 + 2.8520044532039646 * y5 - 1.8425978715902447 * y6 + 0.92728566320631778 * y7 - 0.33294351782291104 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.1406429361307486 * w1 - 5.3787062959187573 * w2 + 5.6467853273518909 * w3 - 4.4712114263905427 * w4 + 2.8520044532039646 * w5 - 1.8425978715902447 * w6 + 0.92728566320631778 * w7 - 0.33294351782291104 * w8;
+        y[n] = 0.57380776072331974 * w0 + -1.6677463749088537 * w1 + 2.8944518570235931 * w2 + -3.2997157345500883 * w3 + 3.4571457152535929 * w4 + -3.2997157345500892 * w5 + 2.8944518570235918 * w6 + -1.6677463749088528 * w7 + 0.57380776072331974 * w8;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.57380776072331974 * xn;
+        s0 = s1 + -1.6677463749088537 * xn + 3.1406429361307486 * yn;
+        s1 = s2 + 2.8944518570235931 * xn - 5.3787062959187573 * yn;
+        s2 = s3 + -3.2997157345500883 * xn + 5.6467853273518909 * yn;
+        s3 = s4 + 3.4571457152535929 * xn - 4.4712114263905427 * yn;
+        s4 = s5 + -3.2997157345500892 * xn + 2.8520044532039646 * yn;
+        s5 = s6 + 2.8944518570235918 * xn - 1.8425978715902447 * yn;
+        s6 = s7 + -1.6677463749088528 * xn + 0.92728566320631778 * yn;
+        s7 = 0.57380776072331974 * xn - 0.33294351782291104 * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v - 0.63127296173306702 * w1_0 - 0.4654849808625553 * w2_0;
+        v = 0.57380776072331974 * wn0 + 0.57773257938871603 * w1_0 + 0.57380776072332029 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 0.83581770180049175 * w1_1 - 0.79311426050782297 * w2_1;
+        v = wn1 + -0.91264356765893706 * w1_1 + 0.99999999999999623 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.3777098087061117 * w1_2 - 0.92147814352549817 * w2_2;
+        v = wn2 + -1.4285477325021079 * w1_2 + 1.0000000000000011 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.5583883873572151 * w1_3 - 0.97868761774546975 * w2_3;
+        v = wn3 + -1.5721035487392285 * w1_3 + 1.0000000000000004 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void cheby2_df1_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.573807776f * (x0 + x8) + -1.667746425f * (x1 + x7) + 2.894451857f * (x2 + x6) + -3.299715757f * (x3 + x5) + 3.457145691f * x4 + 3.140642881f * y1 - 5.378706455f * y2 + 5.646785259f * y3 - 4.471211433f * y4 + 2.852004528f * y5 - 1.842597842f * y6 + 0.9272856712f * y7 - 0.3329435289f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_df2_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.140642881f * w1 - 5.378706455f * w2 + 5.646785259f * w3 - 4.471211433f * w4 + 2.852004528f * w5 - 1.842597842f * w6 + 0.9272856712f * w7 - 0.3329435289f * w8;
+        y[n] = 0.573807776f * (w0 + w8) + -1.667746425f * (w1 + w7) + 2.894451857f * (w2 + w6) + -3.299715757f * (w3 + w5) + 3.457145691f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void cheby2_tdf2_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.573807776f * xn;
+        float p1 = -1.667746425f * xn;
+        float p2 = 2.894451857f * xn;
+        float p3 = -3.299715757f * xn;
+        float p4 = 3.457145691f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.140642881f * yn;
+        s1 = s2 + p2 - 5.378706455f * yn;
+        s2 = s3 + p3 + 5.646785259f * yn;
+        s3 = s4 + p4 - 4.471211433f * yn;
+        s4 = s5 + p3 + 2.852004528f * yn;
+        s5 = s6 + p2 - 1.842597842f * yn;
+        s6 = s7 + p1 + 0.9272856712f * yn;
+        s7 = p0 - 0.3329435289f * yn;
+        y[n] = yn;
+    }
+}
+
+void cheby2_cascade_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v - 0.6312729716f * w1_0 - 0.4654849768f * w2_0;
+        v = 0.573807776f * (wn0 + w2_0) + 0.5777326226f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 0.8358170986f * w1_1 - 0.7931137085f * w2_1;
+        v = (wn1 + w2_1) + -0.9126433134f * w1_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.377713919f * w1_2 - 0.9214814901f * w2_2;
+        v = (wn2 + w2_2) + -1.428547859f * w1_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 1.558384895f * w1_3 - 0.9786849022f * w2_3;
+        v = (wn3 + w2_3) + -1.57210362f * w1_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.097362461699325692 * x0 + -0.17825812659606871 * x1 + 0.097362461699325664 * x2 + 1.8556772250257305 * y1 - 0.87415327492146877 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.8556772250257305 * w1 - 0.87415327492146877 * w2;
+        y[n] = 0.097362461699325692 * w0 + -0.17825812659606871 * w1 + 0.097362461699325664 * w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.097362461699325692 * xn;
+        s0 = s1 + -0.17825812659606871 * xn + 1.8556772250257305 * yn;
+        s1 = 0.097362461699325664 * xn - 0.87415327492146877 * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.8556772250257305 * w1_0 - 0.87415327492146866 * w2_0;
+        v = 0.097362461699325692 * wn0 + -0.17825812659606871 * w1_0 + 0.097362461699325664 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.09736245871f * (x0 + x2) + -0.178258121f * x1 + 1.855677247f * y1 - 0.8741532564f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.855677247f * w1 - 0.8741532564f * w2;
+        y[n] = 0.09736245871f * (w0 + w2) + -0.178258121f * w1;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.09736245871f * xn;
+        float p1 = -0.178258121f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 1.855677247f * yn;
+        s1 = p0 - 0.8741532564f * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.855677247f * w1_0 - 0.8741532564f * w2_0;
+        v = 0.09736245871f * (wn0 + w2_0) + -0.178258121f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.10195515222020145 * x0 + -0.14225107615158283 * x1 + 0.10195515222020148 * x2 + 1.6962155069508904 * y1 - 0.76539829896896427 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.6962155069508904 * w1 - 0.76539829896896427 * w2;
+        y[n] = 0.10195515222020145 * w0 + -0.14225107615158283 * w1 + 0.10195515222020148 * w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.10195515222020145 * xn;
+        s0 = s1 + -0.14225107615158283 * xn + 1.6962155069508904 * yn;
+        s1 = 0.10195515222020148 * xn - 0.76539829896896427 * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.6962155069508902 * w1_0 - 0.76539829896896416 * w2_0;
+        v = 0.10195515222020145 * (wn0 + w2_0) + -0.14225107615158281 * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.101955153f * (x0 + x2) + -0.1422510743f * x1 + 1.69621551f * y1 - 0.7653983235f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.69621551f * w1 - 0.7653983235f * w2;
+        y[n] = 0.101955153f * (w0 + w2) + -0.1422510743f * w1;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.101955153f * xn;
+        float p1 = -0.1422510743f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 1.69621551f * yn;
+        s1 = p0 - 0.7653983235f * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.69621551f * w1_0 - 0.7653983235f * w2_0;
+        v = 0.101955153f * (wn0 + w2_0) + -0.1422510743f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.14734599075262717 * (x0 + x2) + 0.024851813156251089 * x1 + 1.1699338244610717 * y1 - 0.52846785902895799 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.1699338244610717 * w1 - 0.52846785902895799 * w2;
+        y[n] = 0.14734599075262717 * (w0 + w2) + 0.024851813156251089 * w1;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 0.14734599075262717 * xn;
+        double p1 = 0.024851813156251089 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 1.1699338244610717 * yn;
+        s1 = p0 - 0.52846785902895799 * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.1699338244610717 * w1_0 - 0.52846785902895799 * w2_0;
+        v = 0.14734599075262717 * wn0 + 0.024851813156251075 * w1_0 + 0.14734599075262711 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.1473459899f * (x0 + x2) + 0.02485181391f * x1 + 1.169933796f * y1 - 0.528467834f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.169933796f * w1 - 0.528467834f * w2;
+        y[n] = 0.1473459899f * (w0 + w2) + 0.02485181391f * w1;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.1473459899f * xn;
+        float p1 = 0.02485181391f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 1.169933796f * yn;
+        s1 = p0 - 0.528467834f * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.169933796f * w1_0 - 0.528467834f * w2_0;
+        v = 0.1473459899f * wn0 + 0.02485181391f * w1_0 + 0.147345975f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.095940281740766659 * (x0 + x4) + -0.37495393411018807 * (x1 + x3) + 0.55817279790552321 * x2 + 3.8604692331819344 * y1 - 5.6114120872392892 * y2 + 3.6392552918462151 * y3 - 0.88847568380685082 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.8604692331819344 * w1 - 5.6114120872392892 * w2 + 3.6392552918462151 * w3 - 0.88847568380685082 * w4;
+        y[n] = 0.095940281740766659 * (w0 + w4) + -0.37495393411018807 * (w1 + w3) + 0.55817279790552321 * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 0.095940281740766659 * xn;
+        double p1 = -0.37495393411018807 * xn;
+        double p2 = 0.55817279790552321 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 3.8604692331819344 * yn;
+        s1 = s2 + p2 - 5.6114120872392892 * yn;
+        s2 = s3 + p1 + 3.6392552918462151 * yn;
+        s3 = p0 - 0.88847568380685082 * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.8910165961183787 * w1_0 - 0.90052720499353867 * w2_0;
+        v = 0.095940281740766659 * wn0 + -0.1851460860876715 * w1_0 + 0.095940281740763425 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.9694526370635559 * w1_1 - 0.98661726028946106 * w2_1;
+        v = wn1 + -1.9783957747318595 * w1_1 + 1.0000000000000369 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.09594028443f * (x0 + x4) + -0.3749539256f * (x1 + x3) + 0.558172822f * x2 + 3.860469341f * y1 - 5.611412048f * y2 + 3.639255285f * y3 - 0.8884756565f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.860469341f * w1 - 5.611412048f * w2 + 3.639255285f * w3 - 0.8884756565f * w4;
+        y[n] = 0.09594028443f * (w0 + w4) + -0.3749539256f * (w1 + w3) + 0.558172822f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.09594028443f * xn;
+        float p1 = -0.3749539256f * xn;
+        float p2 = 0.558172822f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.860469341f * yn;
+        s1 = s2 + p2 - 5.611412048f * yn;
+        s2 = s3 + p1 + 3.639255285f * yn;
+        s3 = p0 - 0.8884756565f * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.891102076f * w1_0 - 0.9005995393f * w2_0;
+        v = 0.09594028443f * wn0 + -0.1851467192f * w1_0 + 0.09594029188f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.969367266f * w1_1 - 0.986537993f * w2_1;
+        v = wn1 + -1.978389144f * w1_1 + 0.9999999404f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.09524889580998061 * (x0 + x4) + -0.34721598623699851 * (x1 + x3) + 0.50613056048317429 * x2 + 3.6804803092240013 * y1 - 5.1668738292993792 * y2 + 3.2735891244233706 * y3 - 0.78965998282453864 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.6804803092240013 * w1 - 5.1668738292993792 * w2 + 3.2735891244233706 * w3 - 0.78965998282453864 * w4;
+        y[n] = 0.09524889580998061 * (w0 + w4) + -0.34721598623699851 * (w1 + w3) + 0.50613056048317429 * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 0.09524889580998061 * xn;
+        double p1 = -0.34721598623699851 * xn;
+        double p2 = 0.50613056048317429 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 3.6804803092240013 * yn;
+        s1 = s2 + p2 - 5.1668738292993792 * yn;
+        s2 = s3 + p1 + 3.2735891244233706 * yn;
+        s3 = p0 - 0.78965998282453864 * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.7747496893879475 * w1_0 - 0.8110388024198425 * w2_0;
+        v = 0.09524889580998061 * wn0 + -0.16488660796675736 * w1_0 + 0.095248895809979639 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.9057306198360513 * w1_1 - 0.97364020126840034 * w2_1;
+        v = wn1 + -1.9142413853698006 * w1_1 + 1.0000000000000093 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.0952488929f * (x0 + x4) + -0.3472159803f * (x1 + x3) + 0.5061305761f * x2 + 3.680480242f * y1 - 5.166873932f * y2 + 3.273589134f * y3 - 0.789659977f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.680480242f * w1 - 5.166873932f * w2 + 3.273589134f * w3 - 0.789659977f * w4;
+        y[n] = 0.0952488929f * (w0 + w4) + -0.3472159803f * (w1 + w3) + 0.5061305761f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.0952488929f * xn;
+        float p1 = -0.3472159803f * xn;
+        float p2 = 0.5061305761f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.680480242f * yn;
+        s1 = s2 + p2 - 5.166873932f * yn;
+        s2 = s3 + p1 + 3.273589134f * yn;
+        s3 = p0 - 0.789659977f * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.774738193f * w1_0 - 0.8110301495f * w2_0;
+        v = 0.0952488929f * wn0 + -0.1648866087f * w1_0 + 0.09524888545f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.905742049f * w1_1 - 0.9736505747f * w2_1;
+        v = wn1 + -1.914241433f * w1_1 + 1.000000119f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.10990852397903407 * x0 + -0.24133399518650248 * x1 + 0.33527216223667655 * x2 + -0.24133399518650239 * x3 + 0.10990852397903403 * x4 + 2.9279624470792189 * y1 - 3.6714655506519955 * y2 + 2.2201945831979906 * y3 - 0.55794942474826492 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 2.9279624470792189 * w1 - 3.6714655506519955 * w2 + 2.2201945831979906 * w3 - 0.55794942474826492 * w4;
+        y[n] = 0.10990852397903407 * w0 + -0.24133399518650248 * w1 + 0.33527216223667655 * w2 + -0.24133399518650239 * w3 + 0.10990852397903403 * w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.10990852397903407 * xn;
+        s0 = s1 + -0.24133399518650248 * xn + 2.9279624470792189 * yn;
+        s1 = s2 + 0.33527216223667655 * xn - 3.6714655506519955 * yn;
+        s2 = s3 + -0.24133399518650239 * xn + 2.2201945831979906 * yn;
+        s3 = 0.10990852397903403 * xn - 0.55794942474826492 * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.3931235593105968 * w1_0 - 0.59410921764220315 * w2_0;
+        v = 0.10990852397903407 * wn0 + -0.077411672927065633 * w1_0 + 0.10990852397903442 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.5348388877686228 * w1_1 - 0.93913611871325298 * w2_1;
+        v = wn1 + -1.4914432140923513 * w1_1 + 0.99999999999999734 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.1099085212f * (x0 + x4) + -0.2413339913f * (x1 + x3) + 0.3352721632f * x2 + 2.927962542f * y1 - 3.671465635f * y2 + 2.220194578f * y3 - 0.5579494238f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 2.927962542f * w1 - 3.671465635f * w2 + 2.220194578f * w3 - 0.5579494238f * w4;
+        y[n] = 0.1099085212f * (w0 + w4) + -0.2413339913f * (w1 + w3) + 0.3352721632f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.1099085212f * xn;
+        float p1 = -0.2413339913f * xn;
+        float p2 = 0.3352721632f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 2.927962542f * yn;
+        s1 = s2 + p2 - 3.671465635f * yn;
+        s2 = s3 + p1 + 2.220194578f * yn;
+        s3 = p0 - 0.5579494238f * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.393123507f * w1_0 - 0.5941092968f * w2_0;
+        v = 0.1099085212f * wn0 + -0.07741167396f * w1_0 + 0.1099085137f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.534839034f * w1_1 - 0.9391360283f * w2_1;
+        v = wn1 + -1.491443157f * w1_1 + 0.9999999404f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.095881373817680846 * x0 + -0.56548816821003356 * x1 + 1.3992855108212174 * x2 + -1.8593552789208814 * x3 + 1.3992855108212172 * x4 + -0.56548816821003345 * x5 + 0.095881373817680832 * x6 + 5.8462583409510982 * y1 - 14.278920262362504 * y2 + 18.648319259158296 * y3 - 13.734676228397428 * y4 + 5.4087481146063361 * y5 - 0.88973164071268851 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 5.8462583409510982 * w1 - 14.278920262362504 * w2 + 18.648319259158296 * w3 - 13.734676228397428 * w4 + 5.4087481146063361 * w5 - 0.88973164071268851 * w6;
+        y[n] = 0.095881373817680846 * w0 + -0.56548816821003356 * w1 + 1.3992855108212174 * w2 + -1.8593552789208814 * w3 + 1.3992855108212172 * w4 + -0.56548816821003345 * w5 + 0.095881373817680832 * w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.095881373817680846 * xn;
+        s0 = s1 + -0.56548816821003356 * xn + 5.8462583409510982 * yn;
+        s1 = s2 + 1.3992855108212174 * xn - 14.278920262362504 * yn;
+        s2 = s3 + -1.8593552789208814 * xn + 18.648319259158296 * yn;
+        s3 = s4 + 1.3992855108212172 * xn - 13.734676228397428 * yn;
+        s4 = s5 + -0.56548816821003345 * xn + 5.4087481146063361 * yn;
+        s5 = 0.095881373817680832 * xn - 0.88973164071268851 * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.8951599168759148 * w1_0 - 0.90398696610381202 * w2_0;
+        v = 0.095881373817680846 * wn0 + -0.18553526161066622 * w1_0 + 0.095881373817556514 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.9696074133916428 * w1_1 - 0.98560370636885886 * w2_1;
+        v = wn1 + -1.98026950192369 * w1_1 + 1.0000000000285598 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.9814910106835426 * w1_2 - 0.99860684473975159 * w2_2;
+        v = wn2 + -1.9824699903352547 * w1_2 + 0.99999999997273514 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.09588137269f * (x0 + x6) + -0.5654881597f * (x1 + x5) + 1.399285555f * (x2 + x4) + -1.85935533f * x3 + 5.846258163f * y1 - 14.27892017f * y2 + 18.64831924f * y3 - 13.73467636f * y4 + 5.40874815f * y5 - 0.8897316456f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 5.846258163f * w1 - 14.27892017f * w2 + 18.64831924f * w3 - 13.73467636f * w4 + 5.40874815f * w5 - 0.8897316456f * w6;
+        y[n] = 0.09588137269f * (w0 + w6) + -0.5654881597f * (w1 + w5) + 1.399285555f * (w2 + w4) + -1.85935533f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.09588137269f * xn;
+        float p1 = -0.5654881597f * xn;
+        float p2 = 1.399285555f * xn;
+        float p3 = -1.85935533f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 5.846258163f * yn;
+        s1 = s2 + p2 - 14.27892017f * yn;
+        s2 = s3 + p3 + 18.64831924f * yn;
+        s3 = s4 + p2 - 13.73467636f * yn;
+        s4 = s5 + p1 + 5.40874815f * yn;
+        s5 = p0 - 0.8897316456f * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.88490355f * w1_0 - 0.8944767714f * w2_0;
+        v = 0.09588137269f * (wn0 + w2_0) + -0.1855611801f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.961834192f * w1_1 - 0.9814783335f * w2_1;
+        v = (wn1 + w2_1) + -1.977626801f * w1_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.999520421f * w1_2 - 1.01346612f * w2_2;
+        v = (wn2 + w2_2) + -1.98484242f * w1_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.094899890743338378 * x0 + -0.53163211456641135 * x1 + 1.2764620227884085 * x2 + -1.6793298550354725 * x3 + 1.2764620227884087 * x4 + -0.53163211456641146 * x5 + 0.094899890743338419 * x6 + 5.620906020632229 * y1 - 13.31141491707154 * y2 + 16.990512691619386 * y3 - 12.323401362692231 * y4 + 4.815098056946379 * y5 - 0.79184606335695662 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 5.620906020632229 * w1 - 13.31141491707154 * w2 + 16.990512691619386 * w3 - 12.323401362692231 * w4 + 4.815098056946379 * w5 - 0.79184606335695662 * w6;
+        y[n] = 0.094899890743338378 * w0 + -0.53163211456641135 * w1 + 1.2764620227884085 * w2 + -1.6793298550354725 * w3 + 1.2764620227884087 * w4 + -0.53163211456641146 * w5 + 0.094899890743338419 * w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.094899890743338378 * xn;
+        s0 = s1 + -0.53163211456641135 * xn + 5.620906020632229 * yn;
+        s1 = s2 + 1.2764620227884085 * xn - 13.31141491707154 * yn;
+        s2 = s3 + -1.6793298550354725 * xn + 16.990512691619386 * yn;
+        s3 = s4 + 1.2764620227884087 * xn - 12.323401362692231 * yn;
+        s4 = s5 + -0.53163211456641146 * xn + 4.815098056946379 * yn;
+        s5 = 0.094899890743338419 * xn - 0.79184606335695662 * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.7834666629075746 * w1_0 - 0.8172198052783346 * w2_0;
+        v = 0.094899890743338378 * wn0 + -0.16609943373241157 * w1_0 + 0.094899890743304724 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.9083228525350311 * w1_1 - 0.97163338229782359 * w2_1;
+        v = wn1 + -1.9215695104076023 * w1_1 + 1.0000000000078275 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.9291165051896202 * w1_2 - 0.99723945200813358 * w2_2;
+        v = wn2 + -1.9302018453951282 * w1_2 + 0.99999999999252287 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.09489989281f * (x0 + x6) + -0.5316321254f * (x1 + x5) + 1.276462078f * (x2 + x4) + -1.679329872f * x3 + 5.620905876f * y1 - 13.31141472f * y2 + 16.99051285f * y3 - 12.32340145f * y4 + 4.815098286f * y5 - 0.7918460369f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 5.620905876f * w1 - 13.31141472f * w2 + 16.99051285f * w3 - 12.32340145f * w4 + 4.815098286f * w5 - 0.7918460369f * w6;
+        y[n] = 0.09489989281f * (w0 + w6) + -0.5316321254f * (w1 + w5) + 1.276462078f * (w2 + w4) + -1.679329872f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.09489989281f * xn;
+        float p1 = -0.5316321254f * xn;
+        float p2 = 1.276462078f * xn;
+        float p3 = -1.679329872f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 5.620905876f * yn;
+        s1 = s2 + p2 - 13.31141472f * yn;
+        s2 = s3 + p3 + 16.99051285f * yn;
+        s3 = s4 + p2 - 12.32340145f * yn;
+        s4 = s5 + p1 + 4.815098286f * yn;
+        s5 = p0 - 0.7918460369f * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.784207582f * w1_0 - 0.8178204894f * w2_0;
+        v = 0.09489989281f * (wn0 + w2_0) + -0.1660987735f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.904765129f * w1_1 - 0.9679466486f * w2_1;
+        v = (wn1 + w2_1) + -1.921812773f * w1_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.931933165f * w1_2 - 1.000302434f * w2_2;
+        v = (wn2 + w2_2) + -1.929965496f * w1_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.10761536736333593 * x0 + -0.41762305010495343 * x1 + 0.84109887598475974 * x2 + -1.0359895715279972 * x3 + 0.84109887598475963 * x4 + -0.41762305010495337 * x5 + 0.10761536736333589 * x6 + 4.5531505804273902 * y1 - 9.4348535990020093 * y2 + 11.133360710289487 * y3 - 7.8619968647112097 * y4 + 3.1421150905772253 * y5 - 0.56116473933419853 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 4.5531505804273902 * w1 - 9.4348535990020093 * w2 + 11.133360710289487 * w3 - 7.8619968647112097 * w4 + 3.1421150905772253 * w5 - 0.56116473933419853 * w6;
+        y[n] = 0.10761536736333593 * w0 + -0.41762305010495343 * w1 + 0.84109887598475974 * w2 + -1.0359895715279972 * w3 + 0.84109887598475963 * w4 + -0.41762305010495337 * w5 + 0.10761536736333589 * w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.10761536736333593 * xn;
+        s0 = s1 + -0.41762305010495343 * xn + 4.5531505804273902 * yn;
+        s1 = s2 + 0.84109887598475974 * xn - 9.4348535990020093 * yn;
+        s2 = s3 + -1.0359895715279972 * xn + 11.133360710289487 * yn;
+        s3 = s4 + 0.84109887598475963 * xn - 7.8619968647112097 * yn;
+        s4 = s5 + -0.41762305010495337 * xn + 3.1421150905772253 * yn;
+        s5 = 0.10761536736333589 * xn - 0.56116473933419853 * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.4163326890783132 * w1_0 - 0.60459970055487833 * w2_0;
+        v = 0.10761536736333593 * wn0 + -0.083136653339515601 * w1_0 + 0.10761536736333624 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.5556315326210182 * w1_1 - 0.93421316537859422 * w2_1;
+        v = wn1 + -1.5305668391105705 * w1_1 + 0.99999999999990208 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.5811863587280559 * w1_2 - 0.99351965527756336 * w2_2;
+        v = wn2 + -1.5775988900099707 * w1_2 + 1.0000000000000904 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.1076153666f * (x0 + x6) + -0.4176230431f * (x1 + x5) + 0.8410989046f * (x2 + x4) + -1.035989523f * x3 + 4.553150654f * y1 - 9.434853554f * y2 + 11.13336086f * y3 - 7.861996651f * y4 + 3.142115116f * y5 - 0.5611647367f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 4.553150654f * w1 - 9.434853554f * w2 + 11.13336086f * w3 - 7.861996651f * w4 + 3.142115116f * w5 - 0.5611647367f * w6;
+        y[n] = 0.1076153666f * (w0 + w6) + -0.4176230431f * (w1 + w5) + 0.8410989046f * (w2 + w4) + -1.035989523f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.1076153666f * xn;
+        float p1 = -0.4176230431f * xn;
+        float p2 = 0.8410989046f * xn;
+        float p3 = -1.035989523f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 4.553150654f * yn;
+        s1 = s2 + p2 - 9.434853554f * yn;
+        s2 = s3 + p3 + 11.13336086f * yn;
+        s3 = s4 + p2 - 7.861996651f * yn;
+        s4 = s5 + p1 + 3.142115116f * yn;
+        s5 = p0 - 0.5611647367f * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.416343927f * w1_0 - 0.6046072245f * w2_0;
+        v = 0.1076153666f * wn0 + -0.08313652128f * w1_0 + 0.107615374f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.555590391f * w1_1 - 0.9341534376f * w2_1;
+        v = wn1 + -1.530600309f * w1_1 + 0.9999999404f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.581216335f * w1_2 - 0.993570745f * w2_2;
+        v = (wn2 + w2_2) + -1.577566624f * w1_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.095875831110193294 * x0 + -0.75564284841590879 * x1 + 2.6167679566614028 * x2 + -5.2002929159895368 * x3 + 6.4865839892824111 * x4 + -5.200292915989535 * x5 + 2.6167679566614011 * x6 + -0.75564284841590834 * x7 + 0.095875831110193224 * x8 + 7.8295732452975475 * y1 - 26.874037278130555 * y2 + 52.815024695777993 * y3 - 65.001164943142143 * y4 + 51.299967569701671 * y5 - 25.353653022218044 * y6 + 7.1741499371895907 * y7 - 0.88986024488522564 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 7.8295732452975475 * w1 - 26.874037278130555 * w2 + 52.815024695777993 * w3 - 65.001164943142143 * w4 + 51.299967569701671 * w5 - 25.353653022218044 * w6 + 7.1741499371895907 * w7 - 0.88986024488522564 * w8;
+        y[n] = 0.095875831110193294 * w0 + -0.75564284841590879 * w1 + 2.6167679566614028 * w2 + -5.2002929159895368 * w3 + 6.4865839892824111 * w4 + -5.200292915989535 * w5 + 2.6167679566614011 * w6 + -0.75564284841590834 * w7 + 0.095875831110193224 * w8;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.095875831110193294 * xn;
+        s0 = s1 + -0.75564284841590879 * xn + 7.8295732452975475 * yn;
+        s1 = s2 + 2.6167679566614028 * xn - 26.874037278130555 * yn;
+        s2 = s3 + -5.2002929159895368 * xn + 52.815024695777993 * yn;
+        s3 = s4 + 6.4865839892824111 * xn - 65.001164943142143 * yn;
+        s4 = s5 + -5.200292915989535 * xn + 51.299967569701671 * yn;
+        s5 = s6 + 2.6167679566614011 * xn - 25.353653022218044 * yn;
+        s6 = s7 + -0.75564284841590834 * xn + 7.1741499371895907 * yn;
+        s7 = 0.095875831110193224 * xn - 0.88986024488522564 * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.89559255820267 * w1_0 - 0.90435082315574855 * w2_0;
+        v = 0.095875831110193294 * wn0 + -0.18557371127276398 * w1_0 + 0.095875831136942244 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.9697742053398977 * w1_1 - 0.98564452822620019 * w2_1;
+        v = wn1 + -1.9804296444599969 * w1_1 + 0.99999987768772469 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.9814620415407034 * w1_2 - 0.99845168638314186 * w2_2;
+        v = wn2 + -1.9826346399750787 * w1_2 + 1.0000013181972542 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.9827444402142862 * w1_3 - 0.99985609062739667 * w2_3;
+        v = wn3 + -1.9828464893442552 * w1_3 + 0.99999880383762729 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.09587582946f * (x0 + x8) + -0.7556428313f * (x1 + x7) + 2.616767883f * (x2 + x6) + -5.200293064f * (x3 + x5) + 6.486584187f * x4 + 7.829573154f * y1 - 26.87403679f * y2 + 52.81502533f * y3 - 65.0011673f * y4 + 51.29996872f * y5 - 25.35365295f * y6 + 7.17414999f * y7 - 0.8898602724f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 7.829573154f * w1 - 26.87403679f * w2 + 52.81502533f * w3 - 65.0011673f * w4 + 51.29996872f * w5 - 25.35365295f * w6 + 7.17414999f * w7 - 0.8898602724f * w8;
+        y[n] = 0.09587582946f * (w0 + w8) + -0.7556428313f * (w1 + w7) + 2.616767883f * (w2 + w6) + -5.200293064f * (w3 + w5) + 6.486584187f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.09587582946f * xn;
+        float p1 = -0.7556428313f * xn;
+        float p2 = 2.616767883f * xn;
+        float p3 = -5.200293064f * xn;
+        float p4 = 6.486584187f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 7.829573154f * yn;
+        s1 = s2 + p2 - 26.87403679f * yn;
+        s2 = s3 + p3 + 52.81502533f * yn;
+        s3 = s4 + p4 - 65.0011673f * yn;
+        s4 = s5 + p3 + 51.29996872f * yn;
+        s5 = s6 + p2 - 25.35365295f * yn;
+        s6 = s7 + p1 + 7.17414999f * yn;
+        s7 = p0 - 0.8898602724f * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.821153164f * w1_0 - 0.8335534334f * w2_0;
+        v = 0.09587582946f * (wn0 + w2_0) + -0.1854581982f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 2.107574224f * w1_1 - 1.118342757f * w2_1;
+        v = 1.0f * ((wn1 + w2_1) + -2.0f * w1_1);
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.87136066f * w1_2 - 0.8998892307f * w2_2;
+        v = wn2 + -1.874722242f * w1_2 + 0.9046171308f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 2.029484987f * w1_3 - 1.060777545f * w2_3;
+        v = wn3 + -2.072392941f * w1_3 + 1.105439901f * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.094865979138646139 * x0 + -0.71499227625473083 * x1 + 2.399158708967664 * x2 + -4.6791625716065335 * x3 + 5.8002689622473094 * x4 + -4.6791625716065326 * x5 + 2.399158708967664 * x6 + -0.71499227625473094 * x7 + 0.094865979138646181 * x8 + 7.5541415542831256 * y1 - 25.178235434202939 * y2 + 48.347135013477867 * y3 - 58.485322054561337 * y4 + 45.634557073723656 * y5 - 22.427517193723716 * y6 + 6.3473016807621425 * y7 - 0.79207033706966512 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 7.5541415542831256 * w1 - 25.178235434202939 * w2 + 48.347135013477867 * w3 - 58.485322054561337 * w4 + 45.634557073723656 * w5 - 22.427517193723716 * w6 + 6.3473016807621425 * w7 - 0.79207033706966512 * w8;
+        y[n] = 0.094865979138646139 * w0 + -0.71499227625473083 * w1 + 2.399158708967664 * w2 + -4.6791625716065335 * w3 + 5.8002689622473094 * w4 + -4.6791625716065326 * w5 + 2.399158708967664 * w6 + -0.71499227625473094 * w7 + 0.094865979138646181 * w8;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.094865979138646139 * xn;
+        s0 = s1 + -0.71499227625473083 * xn + 7.5541415542831256 * yn;
+        s1 = s2 + 2.399158708967664 * xn - 25.178235434202939 * yn;
+        s2 = s3 + -4.6791625716065335 * xn + 48.347135013477867 * yn;
+        s3 = s4 + 5.8002689622473094 * xn - 58.485322054561337 * yn;
+        s4 = s5 + -4.6791625716065326 * xn + 45.634557073723656 * yn;
+        s5 = s6 + 2.399158708967664 * xn - 22.427517193723716 * yn;
+        s6 = s7 + -0.71499227625473094 * xn + 6.3473016807621425 * yn;
+        s7 = 0.094865979138646181 * xn - 0.79207033706966512 * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.7843742385770065 * w1_0 - 0.81787184031306392 * w2_0;
+        v = 0.094865979138646139 * wn0 + -0.1662184525864539 * w1_0 + 0.094865979139274623 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.9088913776756498 * w1_1 - 0.97171010729206508 * w2_1;
+        v = wn1 + -1.922196816723575 * w1_1 + 0.99999999684378849 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.9293085656312337 * w1_2 - 0.99693403573278583 * w2_2;
+        v = wn2 + -1.9308485071011114 * w1_2 + 1.0000000344980473 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.931567372399229 * w1_3 - 0.99971302509001569 * w2_3;
+        v = wn3 + -1.9316820215416319 * w1_3 + 0.99999996865153951 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.09486597776f * (x0 + x8) + -0.7149922848f * (x1 + x7) + 2.399158716f * (x2 + x6) + -4.679162502f * (x3 + x5) + 5.800269127f * x4 + 7.554141521f * y1 - 25.17823601f * y2 + 48.34713364f * y3 - 58.48532104f * y4 + 45.63455582f * y5 - 22.42751694f * y6 + 6.347301483f * y7 - 0.7920703292f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 7.554141521f * w1 - 25.17823601f * w2 + 48.34713364f * w3 - 58.48532104f * w4 + 45.63455582f * w5 - 22.42751694f * w6 + 6.347301483f * w7 - 0.7920703292f * w8;
+        y[n] = 0.09486597776f * (w0 + w8) + -0.7149922848f * (w1 + w7) + 2.399158716f * (w2 + w6) + -4.679162502f * (w3 + w5) + 5.800269127f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.09486597776f * xn;
+        float p1 = -0.7149922848f * xn;
+        float p2 = 2.399158716f * xn;
+        float p3 = -4.679162502f * xn;
+        float p4 = 5.800269127f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 7.554141521f * yn;
+        s1 = s2 + p2 - 25.17823601f * yn;
+        s2 = s3 + p3 + 48.34713364f * yn;
+        s3 = s4 + p4 - 58.48532104f * yn;
+        s4 = s5 + p3 + 45.63455582f * yn;
+        s5 = s6 + p2 - 22.42751694f * yn;
+        s6 = s7 + p1 + 6.347301483f * yn;
+        s7 = p0 - 0.7920703292f * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.745318055f * w1_0 - 0.7812182307f * w2_0;
+        v = 0.09486597776f * (wn0 + w2_0) + -0.1662892401f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.805236936f * w1_1 - 0.8844558001f * w2_1;
+        v = wn1 + -1.849119306f * w1_1 + 0.9075187445f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 2.046750784f * w1_2 - 1.091313958f * w2_2;
+        v = wn2 + -2.037554979f * w1_2 + 1.101905584f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 1.956835866f * w1_3 - 1.050426245f * w2_3;
+        v = (wn3 + w2_3) + -1.897307038f * w1_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.10738940946817829 * x0 + -0.5885222220610169 * x1 + 1.6139611265740617 * x2 + -2.7950572485826162 * x3 + 3.3350567829663751 * x4 + -2.7950572485826162 * x5 + 1.6139611265740621 * x6 + -0.58852222206101701 * x7 + 0.10738940946817833 * x8 + 6.1466296691686164 * y1 - 17.690586653890897 * y2 + 30.723080644693447 * y3 - 35.043163866689319 * y4 + 26.810523700884971 * y5 - 13.435280816385561 * y6 + 4.0384038785180882 * y7 - 0.56149873313765197 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 6.1466296691686164 * w1 - 17.690586653890897 * w2 + 30.723080644693447 * w3 - 35.043163866689319 * w4 + 26.810523700884971 * w5 - 13.435280816385561 * w6 + 4.0384038785180882 * w7 - 0.56149873313765197 * w8;
+        y[n] = 0.10738940946817829 * w0 + -0.5885222220610169 * w1 + 1.6139611265740617 * w2 + -2.7950572485826162 * w3 + 3.3350567829663751 * w4 + -2.7950572485826162 * w5 + 1.6139611265740621 * w6 + -0.58852222206101701 * w7 + 0.10738940946817833 * w8;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double yn = s0 + 0.10738940946817829 * xn;
+        s0 = s1 + -0.5885222220610169 * xn + 6.1466296691686164 * yn;
+        s1 = s2 + 1.6139611265740617 * xn - 17.690586653890897 * yn;
+        s2 = s3 + -2.7950572485826162 * xn + 30.723080644693447 * yn;
+        s3 = s4 + 3.3350567829663751 * xn - 35.043163866689319 * yn;
+        s4 = s5 + -2.7950572485826162 * xn + 26.810523700884971 * yn;
+        s5 = s6 + 1.6139611265740621 * xn - 13.435280816385561 * yn;
+        s6 = s7 + -0.58852222206101701 * xn + 4.0384038785180882 * yn;
+        s7 = 0.10738940946817833 * xn - 0.56149873313765197 * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.4187416338487213 * w1_0 - 0.60572063107212126 * w2_0;
+        v = 0.10738940946817829 * wn0 + -0.083697231265407956 * w1_0 + 0.10738940946817553 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.5584504158701473 * w1_1 - 0.93434650609959302 * w2_1;
+        v = wn1 + -1.5339498250715371 * w1_1 + 1.000000000008521 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.5833059807349612 * w1_2 - 0.99279988349777848 * w2_2;
+        v = wn2 + -1.581164129748357 * w1_2 + 0.99999999990864974 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.5861316387147908 * w1_3 - 0.99932495142182232 * w2_3;
+        v = wn3 + -1.5857684999364947 * w1_3 + 1.0000000000828586 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void ellip_df1_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.1073894128f * (x0 + x8) + -0.5885221958f * (x1 + x7) + 1.613961101f * (x2 + x6) + -2.795057297f * (x3 + x5) + 3.335056782f * x4 + 6.14662981f * y1 - 17.69058609f * y2 + 30.72308159f * y3 - 35.0431633f * y4 + 26.81052399f * y5 - 13.4352808f * y6 + 4.038403988f * y7 - 0.5614987612f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_df2_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 6.14662981f * w1 - 17.69058609f * w2 + 30.72308159f * w3 - 35.0431633f * w4 + 26.81052399f * w5 - 13.4352808f * w6 + 4.038403988f * w7 - 0.5614987612f * w8;
+        y[n] = 0.1073894128f * (w0 + w8) + -0.5885221958f * (w1 + w7) + 1.613961101f * (w2 + w6) + -2.795057297f * (w3 + w5) + 3.335056782f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void ellip_tdf2_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.1073894128f * xn;
+        float p1 = -0.5885221958f * xn;
+        float p2 = 1.613961101f * xn;
+        float p3 = -2.795057297f * xn;
+        float p4 = 3.335056782f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 6.14662981f * yn;
+        s1 = s2 + p2 - 17.69058609f * yn;
+        s2 = s3 + p3 + 30.72308159f * yn;
+        s3 = s4 + p4 - 35.0431633f * yn;
+        s4 = s5 + p3 + 26.81052399f * yn;
+        s5 = s6 + p2 - 13.4352808f * yn;
+        s6 = s7 + p1 + 4.038403988f * yn;
+        s7 = p0 - 0.5614987612f * yn;
+        y[n] = yn;
+    }
+}
+
+void ellip_cascade_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.418821931f * w1_0 - 0.6058074832f * w2_0;
+        v = 0.1073894128f * (wn0 + w2_0) + -0.083696872f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.562714815f * w1_1 - 0.9352456927f * w2_1;
+        v = (wn1 + w2_1) + -1.534679413f * w1_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.563821435f * w1_2 - 0.9767261147f * w2_2;
+        v = (wn2 + w2_2) + -1.577010989f * w1_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 1.601271629f * w1_3 - 1.014648557f * w2_3;
+        v = (wn3 + w2_3) + -1.589195132f * w1_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.003843144148178366 * ((x0 + x2) + 2.0 * x1) + 1.7815096557598817 * y1 - 0.79688223235259514 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.7815096557598817 * w1 - 0.79688223235259514 * w2;
+        y[n] = 0.003843144148178366 * ((w0 + w2) + 2.0 * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 0.003843144148178366 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 2.0 * bx + 1.7815096557598817 * yn;
+        s1 = bx - 0.79688223235259514 * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order2_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.7815096557598817 * w1_0 - 0.79688223235259514 * w2_0;
+        v = 0.003843144148178366 * ((wn0 + w2_0) + 2.0 * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.003843144048f * ((x0 + x2) + 2.0f * x1) + 1.781509638f * y1 - 0.7968822122f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.781509638f * w1 - 0.7968822122f * w2;
+        y[n] = 0.003843144048f * ((w0 + w2) + 2.0f * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float bx = 0.003843144048f * xn;
+        float yn = s0 + bx;
+        s0 = s1 + 2.0f * bx + 1.781509638f * yn;
+        s1 = bx - 0.7968822122f * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order2_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.781509638f * w1_0 - 0.7968822122f * w2_0;
+        v = 0.003843144048f * ((wn0 + w2_0) + 2.0f * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.01391755274869467 * ((x0 + x2) + 2.0 * x1) + 1.5781246820833925 * y1 - 0.63379489307817116 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.5781246820833925 * w1 - 0.63379489307817116 * w2;
+        y[n] = 0.01391755274869467 * ((w0 + w2) + 2.0 * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 0.01391755274869467 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 2.0 * bx + 1.5781246820833925 * yn;
+        s1 = bx - 0.63379489307817116 * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order2_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.5781246820833927 * w1_0 - 0.63379489307817138 * w2_0;
+        v = 0.01391755274869467 * ((wn0 + w2_0) + 2.0 * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.01391755231f * ((x0 + x2) + 2.0f * x1) + 1.578124642f * y1 - 0.6337949038f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.578124642f * w1 - 0.6337949038f * w2;
+        y[n] = 0.01391755231f * ((w0 + w2) + 2.0f * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float bx = 0.01391755231f * xn;
+        float yn = s0 + bx;
+        s0 = s1 + 2.0f * bx + 1.578124642f * yn;
+        s1 = bx - 0.6337949038f * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order2_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.578124642f * w1_0 - 0.6337949038f * w2_0;
+        v = 0.01391755231f * ((wn0 + w2_0) + 2.0f * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.067655275144215238 * ((x0 + x2) + 2.0 * x1) + 1.0389626156964038 * y1 - 0.30958371627326464 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 1.0389626156964038 * w1 - 0.30958371627326464 * w2;
+        y[n] = 0.067655275144215238 * ((w0 + w2) + 2.0 * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 0.067655275144215238 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 2.0 * bx + 1.0389626156964038 * yn;
+        s1 = bx - 0.30958371627326464 * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order2_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.0389626156964038 * w1_0 - 0.30958371627326464 * w2_0;
+        v = 0.067655275144215238 * ((wn0 + w2_0) + 2.0 * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.06765527278f * ((x0 + x2) + 2.0f * x1) + 1.038962603f * y1 - 0.3095837235f * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 1.038962603f * w1 - 0.3095837235f * w2;
+        y[n] = 0.06765527278f * ((w0 + w2) + 2.0f * w1);
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float bx = 0.06765527278f * xn;
+        float yn = s0 + bx;
+        s0 = s1 + 2.0f * bx + 1.038962603f * yn;
+        s1 = bx - 0.3095837235f * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order2_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w2_0 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.038962603f * w1_0 - 0.3095837235f * w2_0;
+        v = 0.06765527278f * ((wn0 + w2_0) + 2.0f * w1_0);
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 1.507109246668479e-05 * (x0 + x4) + 6.0284369866739159e-05 * (x1 + x3) + 9.0426554800108745e-05 * x2 + 3.599419396907642 * y1 - 4.8690785840186601 * y2 + 2.9335282296855412 * y3 - 0.66411018005398925 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.599419396907642 * w1 - 4.8690785840186601 * w2 + 2.9335282296855412 * w3 - 0.66411018005398925 * w4;
+        y[n] = 1.507109246668479e-05 * (w0 + w4) + 6.0284369866739159e-05 * (w1 + w3) + 9.0426554800108745e-05 * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 1.507109246668479e-05 * xn;
+        double p1 = 6.0284369866739159e-05 * xn;
+        double p2 = 9.0426554800108745e-05 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 3.599419396907642 * yn;
+        s1 = s2 + p2 - 4.8690785840186601 * yn;
+        s2 = s3 + p1 + 2.9335282296855412 * yn;
+        s3 = p0 - 0.66411018005398925 * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order4_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.7750141314415018 * w1_0 - 0.78866988654701731 * w2_0;
+        v = 1.507109246668479e-05 * wn0 + 3.0146228365709181e-05 * w1_0 + 1.5075136441513173e-05 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.8244052654661385 * w1_1 - 0.84206356979295893 * w2_1;
+        v = wn1 + 1.9997317094066998 * w1_1 + 0.99973174539122356 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 1.507109209e-05f * (x0 + x4) + 6.028436837e-05f * (x1 + x3) + 9.042655438e-05f * x2 + 3.599419355f * y1 - 4.869078636f * y2 + 2.933528185f * y3 - 0.6641101837f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.599419355f * w1 - 4.869078636f * w2 + 2.933528185f * w3 - 0.6641101837f * w4;
+        y[n] = 1.507109209e-05f * (w0 + w4) + 6.028436837e-05f * (w1 + w3) + 9.042655438e-05f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 1.507109209e-05f * xn;
+        float p1 = 6.028436837e-05f * xn;
+        float p2 = 9.042655438e-05f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.599419355f * yn;
+        s1 = s2 + p2 - 4.869078636f * yn;
+        s2 = s3 + p1 + 2.933528185f * yn;
+        s3 = p0 - 0.6641101837f * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order4_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.774930239f * w1_0 - 0.7886068821f * w2_0;
+        v = 1.507109209e-05f * wn0 + 3.014218419e-05f * w1_0 + 1.5071093e-05f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.824489117f * w1_1 - 0.8421308398f * w2_1;
+        v = wn1 + 2.0f * w1_1 + 0.9999999404f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.00020094470875221473 * (x0 + x4) + 0.00080377883500885893 * (x1 + x3) + 0.0012056682525132885 * x2 + 3.2152197758317471 * y1 - 3.9127683691103115 * y2 + 2.1343599599641268 * y3 - 0.44002648202559813 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.2152197758317471 * w1 - 3.9127683691103115 * w2 + 2.1343599599641268 * w3 - 0.44002648202559813 * w4;
+        y[n] = 0.00020094470875221473 * (w0 + w4) + 0.00080377883500885893 * (w1 + w3) + 0.0012056682525132885 * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 0.00020094470875221473 * xn;
+        double p1 = 0.00080377883500885893 * xn;
+        double p2 = 0.0012056682525132885 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 3.2152197758317471 * yn;
+        s1 = s2 + p2 - 3.9127683691103115 * yn;
+        s2 = s3 + p1 + 2.1343599599641268 * yn;
+        s3 = p0 - 0.44002648202559813 * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order4_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.5706299692109544 * w1_0 - 0.61995718268909006 * w2_0;
+        v = 0.00020094470875221473 * wn0 + 0.0004019433290795616 * w1_0 + 0.00020099862756041575 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.6445898066207891 * w1_1 - 0.70976914908375566 * w2_1;
+        v = wn1 + 1.9997317094066998 * w1_1 + 0.99973174539122356 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.0002009447053f * (x0 + x4) + 0.0008037788211f * (x1 + x3) + 0.001205668203f * x2 + 3.215219736f * y1 - 3.912768364f * y2 + 2.134360075f * y3 - 0.4400264919f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.215219736f * w1 - 3.912768364f * w2 + 2.134360075f * w3 - 0.4400264919f * w4;
+        y[n] = 0.0002009447053f * (w0 + w4) + 0.0008037788211f * (w1 + w3) + 0.001205668203f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.0002009447053f * xn;
+        float p1 = 0.0008037788211f * xn;
+        float p2 = 0.001205668203f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.215219736f * yn;
+        s1 = s2 + p2 - 3.912768364f * yn;
+        s2 = s3 + p1 + 2.134360075f * yn;
+        s3 = p0 - 0.4400264919f * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order4_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.570636153f * w1_0 - 0.6199600697f * w2_0;
+        v = 0.0002009447053f * wn0 + 0.0004018894106f * w1_0 + 0.0002009447198f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.644583583f * w1_1 - 0.7097659111f * w2_1;
+        v = wn1 + 2.0f * w1_1 + 0.9999999404f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.0049086779358643818 * ((x0 + x4) + 4.0 * (x1 + x3) + 6.0 * x2) + 2.1506202277025972 * y1 - 1.8734476462778435 * y2 + 0.76764252562186364 * y3 - 0.12335395402044681 * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 2.1506202277025972 * w1 - 1.8734476462778435 * w2 + 0.76764252562186364 * w3 - 0.12335395402044681 * w4;
+        y[n] = 0.0049086779358643818 * ((w0 + w4) + 4.0 * (w1 + w3) + 6.0 * w2);
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 0.0049086779358643818 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 4.0 * bx + 2.1506202277025972 * yn;
+        s1 = s2 + 6.0 * bx - 1.8734476462778435 * yn;
+        s2 = s3 + 4.0 * bx + 0.76764252562186364 * yn;
+        s3 = bx - 0.12335395402044681 * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order4_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.0450797026659919 * w1_0 - 0.28452267192115793 * w2_0;
+        v = 0.0049086779358643818 * wn0 + 0.0098173557070739825 * w1_0 + 0.0049086780069248163 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.1055405250366055 * w1_1 - 0.43354701116622635 * w2_1;
+        v = wn1 + 2.0000000335436159 * w1_1 + 0.99999998552351244 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.004908678122f * (x0 + x4) + 0.01963471249f * (x1 + x3) + 0.02945206687f * x2 + 2.150620222f * y1 - 1.873447657f * y2 + 0.767642498f * y3 - 0.1233539507f * y4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 2.150620222f * w1 - 1.873447657f * w2 + 0.767642498f * w3 - 0.1233539507f * w4;
+        y[n] = 0.004908678122f * (w0 + w4) + 0.01963471249f * (w1 + w3) + 0.02945206687f * w2;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.004908678122f * xn;
+        float p1 = 0.01963471249f * xn;
+        float p2 = 0.02945206687f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 2.150620222f * yn;
+        s1 = s2 + p2 - 1.873447657f * yn;
+        s2 = s3 + p1 + 0.767642498f * yn;
+        s3 = p0 - 0.1233539507f * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order4_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w2_0 = 0, w2_1 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.045079231f * w1_0 - 0.2845225334f * w2_0;
+        v = 0.004908678122f * (wn0 + w2_0) + 0.00981396623f * w1_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.105540991f * w1_1 - 0.433547169f * w2_1;
+        v = (wn1 + w2_1) + 2.00069046f * w1_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 5.9181980482124325e-08 * (x0 + x6) + 3.5509188289274592e-07 * (x1 + x5) + 8.8772970723186486e-07 * (x2 + x4) + 1.1836396096424865e-06 * x3 + 5.4199850406891352 * y1 - 12.257974559197379 * y2 + 14.806547504387707 * y3 - 10.074183828349316 * y4 + 3.660551830391102 * y5 - 0.55492977556800061 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 5.4199850406891352 * w1 - 12.257974559197379 * w2 + 14.806547504387707 * w3 - 10.074183828349316 * w4 + 3.660551830391102 * w5 - 0.55492977556800061 * w6;
+        y[n] = 5.9181980482124325e-08 * (w0 + w6) + 3.5509188289274592e-07 * (w1 + w5) + 8.8772970723186486e-07 * (w2 + w4) + 1.1836396096424865e-06 * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 5.9181980482124325e-08 * xn;
+        double p1 = 3.5509188289274592e-07 * xn;
+        double p2 = 8.8772970723186486e-07 * xn;
+        double p3 = 1.1836396096424865e-06 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 5.4199850406891352 * yn;
+        s1 = s2 + p2 - 12.257974559197379 * yn;
+        s2 = s3 + p3 + 14.806547504387707 * yn;
+        s3 = s4 + p2 - 10.074183828349316 * yn;
+        s4 = s5 + p1 + 3.660551830391102 * yn;
+        s5 = p0 - 0.55492977556800061 * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order6_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.7744949895473205 * w1_0 - 0.78767804996004009 * w2_0;
+        v = 5.9181980482124325e-08 * wn0 + 1.1871535595042337e-07 * w1_0 + 5.9534071474767653e-08 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.7961391015766184 * w1_1 - 0.81094512437477539 * w2_1;
+        v = wn1 + 1.9999909253548824 * w1_1 + 1.000002658806896 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.8493509495651983 * w1_2 - 0.8687560016149144 * w2_2;
+        v = wn2 + 1.9940715412386329 * w1_2 + 0.99408324784519175 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 5.918198198e-08f * (x0 + x6) + 3.550918848e-07f * (x1 + x5) + 8.877296978e-07f * (x2 + x4) + 1.183639597e-06f * x3 + 5.419984818f * y1 - 12.25797462f * y2 + 14.80654716f * y3 - 10.07418346f * y4 + 3.660551786f * y5 - 0.5549297929f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 5.419984818f * w1 - 12.25797462f * w2 + 14.80654716f * w3 - 10.07418346f * w4 + 3.660551786f * w5 - 0.5549297929f * w6;
+        y[n] = 5.918198198e-08f * (w0 + w6) + 3.550918848e-07f * (w1 + w5) + 8.877296978e-07f * (w2 + w4) + 1.183639597e-06f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 5.918198198e-08f * xn;
+        float p1 = 3.550918848e-07f * xn;
+        float p2 = 8.877296978e-07f * xn;
+        float p3 = 1.183639597e-06f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 5.419984818f * yn;
+        s1 = s2 + p2 - 12.25797462f * yn;
+        s2 = s3 + p3 + 14.80654716f * yn;
+        s3 = s4 + p2 - 10.07418346f * yn;
+        s4 = s5 + p1 + 3.660551786f * yn;
+        s5 = p0 - 0.5549297929f * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order6_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.730358601f * w1_0 - 0.7502191067f * w2_0;
+        v = 5.918198198e-08f * wn0 + 1.245528409e-07f * w1_0 + 6.614599357e-08f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.835976601f * w1_1 - 0.8562656045f * w2_1;
+        v = wn1 + 1.882999182f * w1_1 + 0.8947176337f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.853649616f * w1_2 - 0.8638561368f * w2_2;
+        v = (wn2 + w2_2) + 2.01242733f * w1_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 2.9089322078858472e-06 * ((x0 + x6) + 6.0 * (x1 + x5) + 15.0 * (x2 + x4) + 20.0 * x3) + 4.8571388385297389 * y1 - 9.8917059912438621 * y2 + 10.807398800419122 * y3 - 6.6789435710648268 * y4 + 2.2129588715727095 * y5 - 0.30703311987418613 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 4.8571388385297389 * w1 - 9.8917059912438621 * w2 + 10.807398800419122 * w3 - 6.6789435710648268 * w4 + 2.2129588715727095 * w5 - 0.30703311987418613 * w6;
+        y[n] = 2.9089322078858472e-06 * ((w0 + w6) + 6.0 * (w1 + w5) + 15.0 * (w2 + w4) + 20.0 * w3);
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 2.9089322078858472e-06 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 6.0 * bx + 4.8571388385297389 * yn;
+        s1 = s2 + 15.0 * bx - 9.8917059912438621 * yn;
+        s2 = s3 + 20.0 * bx + 10.807398800419122 * yn;
+        s3 = s4 + 15.0 * bx - 6.6789435710648268 * yn;
+        s4 = s5 + 6.0 * bx + 2.2129588715727095 * yn;
+        s5 = bx - 0.30703311987418613 * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order6_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.5706082076777781 * w1_0 - 0.61822192156706923 * w2_0;
+        v = 2.9089322078858472e-06 * wn0 + 5.8350596235785015e-06 * w1_0 + 2.926161385204423e-06 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.6028492700600401 * w1_1 - 0.65683223528732138 * w2_1;
+        v = wn1 + 1.999969278309516 * w1_1 + 0.99998086546169862 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.6836813607919168 * w1_2 - 0.75611241062993073 * w2_2;
+        v = wn2 + 1.9941195465313726 * w1_2 + 0.99413104305675626 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 2.908932174e-06f * (x0 + x6) + 1.745359259e-05f * (x1 + x5) + 4.36339833e-05f * (x2 + x4) + 5.817864439e-05f * x3 + 4.857138634f * y1 - 9.891706467f * y2 + 10.8073988f * y3 - 6.678943634f * y4 + 2.212958813f * y5 - 0.3070331216f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 4.857138634f * w1 - 9.891706467f * w2 + 10.8073988f * w3 - 6.678943634f * w4 + 2.212958813f * w5 - 0.3070331216f * w6;
+        y[n] = 2.908932174e-06f * (w0 + w6) + 1.745359259e-05f * (w1 + w5) + 4.36339833e-05f * (w2 + w4) + 5.817864439e-05f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 2.908932174e-06f * xn;
+        float p1 = 1.745359259e-05f * xn;
+        float p2 = 4.36339833e-05f * xn;
+        float p3 = 5.817864439e-05f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 4.857138634f * yn;
+        s1 = s2 + p2 - 9.891706467f * yn;
+        s2 = s3 + p3 + 10.8073988f * yn;
+        s3 = s4 + p2 - 6.678943634f * yn;
+        s4 = s5 + p1 + 2.212958813f * yn;
+        s5 = p0 - 0.3070331216f * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order6_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.565772891f * w1_0 - 0.6149018407f * w2_0;
+        v = 2.908932174e-06f * wn0 + 5.835059255e-06f * w1_0 + 2.926161187e-06f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.608783126f * w1_1 - 0.6612731814f * w2_1;
+        v = wn1 + 1.999969244f * w1_1 + 0.9999808073f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.682582617f * w1_2 - 0.7550897002f * w2_2;
+        v = wn2 + 1.994119525f * w1_2 + 0.9941310287f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 0.00035811113221839887 * ((x0 + x6) + 6.0 * (x1 + x5) + 15.0 * (x2 + x4) + 20.0 * x3) + 3.2685180735419204 * y1 - 4.6969445550000701 * y2 + 3.7593114472996363 * y3 - 1.7549483242656394 * y4 + 0.45068352769748943 * y5 - 0.049539281735314855 * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 3.2685180735419204 * w1 - 4.6969445550000701 * w2 + 3.7593114472996363 * w3 - 1.7549483242656394 * w4 + 0.45068352769748943 * w5 - 0.049539281735314855 * w6;
+        y[n] = 0.00035811113221839887 * ((w0 + w6) + 6.0 * (w1 + w5) + 15.0 * (w2 + w4) + 20.0 * w3);
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 0.00035811113221839887 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 6.0 * bx + 3.2685180735419204 * yn;
+        s1 = s2 + 15.0 * bx - 4.6969445550000701 * yn;
+        s2 = s3 + 20.0 * bx + 3.7593114472996363 * yn;
+        s3 = s4 + 15.0 * bx - 1.7549483242656394 * yn;
+        s4 = s5 + 6.0 * bx + 0.45068352769748943 * yn;
+        s5 = bx - 0.049539281735314855 * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order6_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.049401657518783 * w1_0 - 0.28070433997026989 * w2_0;
+        v = 0.00035811113221839887 * wn0 + 0.00071833912206576995 * w1_0 + 0.00036023217174624368 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.0767148761420886 * w1_1 - 0.34314002148459338 * w2_1;
+        v = wn1 + 1.999969278309516 * w1_1 + 0.99998086546169862 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.1424015398810483 * w1_2 - 0.5143150158258305 * w2_2;
+        v = wn2 + 1.9941195465313726 * w1_2 + 0.99413104305675626 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 0.0003581111378f * (x0 + x6) + 0.002148666885f * (x1 + x5) + 0.005371666979f * (x2 + x4) + 0.007162222639f * x3 + 3.268517971f * y1 - 4.696944714f * y2 + 3.759311438f * y3 - 1.754948378f * y4 + 0.4506835341f * y5 - 0.04953928292f * y6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 3.268517971f * w1 - 4.696944714f * w2 + 3.759311438f * w3 - 1.754948378f * w4 + 0.4506835341f * w5 - 0.04953928292f * w6;
+        y[n] = 0.0003581111378f * (w0 + w6) + 0.002148666885f * (w1 + w5) + 0.005371666979f * (w2 + w4) + 0.007162222639f * w3;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 0.0003581111378f * xn;
+        float p1 = 0.002148666885f * xn;
+        float p2 = 0.005371666979f * xn;
+        float p3 = 0.007162222639f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 3.268517971f * yn;
+        s1 = s2 + p2 - 4.696944714f * yn;
+        s2 = s3 + p3 + 3.759311438f * yn;
+        s3 = s4 + p2 - 1.754948378f * yn;
+        s4 = s5 + p1 + 0.4506835341f * yn;
+        s5 = p0 - 0.04953928292f * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order6_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.04937768f * w1_0 - 0.2806947231f * w2_0;
+        v = 0.0003581111378f * wn0 + 0.0007183391135f * w1_0 + 0.0003602321667f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.076740623f * w1_1 - 0.3431542516f * w2_1;
+        v = wn1 + 1.999969244f * w1_1 + 0.9999808073f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.142399669f * w1_2 - 0.5143113136f * w2_2;
+        v = wn2 + 1.994119525f * w1_2 + 0.9941310287f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 2.3248866592560041e-10 * ((x0 + x8) + 8.0 * (x1 + x7) + 28.0 * (x2 + x6) + 56.0 * (x3 + x5) + 70.0 * x4) + 7.2413192662782091 * y1 - 22.966156237350727 * y2 + 41.66634317593514 * y3 - 47.295187301665329 * y4 + 34.393253317486064 * y5 - 15.647500099344519 * y6 + 4.0719731063611926 * y7 - 0.46404528721712535 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 7.2413192662782091 * w1 - 22.966156237350727 * w2 + 41.66634317593514 * w3 - 47.295187301665329 * w4 + 34.393253317486064 * w5 - 15.647500099344519 * w6 + 4.0719731063611926 * w7 - 0.46404528721712535 * w8;
+        y[n] = 2.3248866592560041e-10 * ((w0 + w8) + 8.0 * (w1 + w7) + 28.0 * (w2 + w6) + 56.0 * (w3 + w5) + 70.0 * w4);
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double bx = 2.3248866592560041e-10 * xn;
+        double yn = s0 + bx;
+        s0 = s1 + 8.0 * bx + 7.2413192662782091 * yn;
+        s1 = s2 + 28.0 * bx - 22.966156237350727 * yn;
+        s2 = s3 + 56.0 * bx + 41.66634317593514 * yn;
+        s3 = s4 + 70.0 * bx - 47.295187301665329 * yn;
+        s4 = s5 + 56.0 * bx + 34.393253317486064 * yn;
+        s5 = s6 + 28.0 * bx - 15.647500099344519 * yn;
+        s6 = s7 + 8.0 * bx + 4.0719731063611926 * yn;
+        s7 = bx - 0.46404528721712535 * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order8_cut1000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.7746375083831425 * w1_0 - 0.7876064091416195 * w2_0;
+        v = 2.3248866592560041e-10 * wn0 + 4.7214667570548491e-10 * w1_0 + 2.3976987024833873e-10 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.7868917199427337 * w1_1 - 0.80075303089060046 * w2_1;
+        v = wn1 + 1.9996365905853206 * w1_1 + 1.0001120965713541 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.8141363470607272 * w1_2 - 0.83013911855105205 * w2_2;
+        v = wn2 + 1.96916256905117 * w1_2 + 0.96963250539233625 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.8656536908916013 * w1_3 - 0.88634266319374544 * w2_3;
+        v = wn3 + 2.0003634495352691 * w1_3 + 0.99988794144980309 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 2.324886672e-10f * (x0 + x8) + 1.859909338e-09f * (x1 + x7) + 6.509682571e-09f * (x2 + x6) + 1.301936514e-08f * (x3 + x5) + 1.627420687e-08f * x4 + 7.24131918f * y1 - 22.96615601f * y2 + 41.66634369f * y3 - 47.2951889f * y4 + 34.39325333f * y5 - 15.64750004f * y6 + 4.071973324f * y7 - 0.4640452862f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 7.24131918f * w1 - 22.96615601f * w2 + 41.66634369f * w3 - 47.2951889f * w4 + 34.39325333f * w5 - 15.64750004f * w6 + 4.071973324f * w7 - 0.4640452862f * w8;
+        y[n] = 2.324886672e-10f * (w0 + w8) + 1.859909338e-09f * (w1 + w7) + 6.509682571e-09f * (w2 + w6) + 1.301936514e-08f * (w3 + w5) + 1.627420687e-08f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 2.324886672e-10f * xn;
+        float p1 = 1.859909338e-09f * xn;
+        float p2 = 6.509682571e-09f * xn;
+        float p3 = 1.301936514e-08f * xn;
+        float p4 = 1.627420687e-08f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 7.24131918f * yn;
+        s1 = s2 + p2 - 22.96615601f * yn;
+        s2 = s3 + p3 + 41.66634369f * yn;
+        s3 = s4 + p4 - 47.2951889f * yn;
+        s4 = s5 + p3 + 34.39325333f * yn;
+        s5 = s6 + p2 - 15.64750004f * yn;
+        s6 = s7 + p1 + 4.071973324f * yn;
+        s7 = p0 - 0.4640452862f * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order8_cut1000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.567563176f * w1_0 - 0.6171920896f * w2_0;
+        v = 2.324886672e-10f * wn0 + 4.721466551e-10f * w1_0 + 2.397698429e-10f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.68369329f * w1_1 - 0.7315115333f * w2_1;
+        v = wn1 + 1.99963665f * w1_1 + 1.000112176f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 2.086767435f * w1_2 - 1.095368505f * w2_2;
+        v = wn2 + 1.969162583f * w1_2 + 0.9696325064f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 1.903295279f * w1_3 - 0.9383364916f * w2_3;
+        v = wn3 + 2.00036335f * w1_3 + 0.9998879433f * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 4.2142568367843384e-08 * (x0 + x8) + 3.3714054694274707e-07 * (x1 + x7) + 1.1799919142996149e-06 * (x2 + x6) + 2.3599838285992297e-06 * (x3 + x5) + 2.9499797857490367e-06 * x4 + 6.5004829433182927 * y1 - 18.574714686567091 * y2 + 30.46631462702782 * y3 - 31.366778149984537 * y4 + 20.753475968570921 * y5 - 8.6160232949782323 * y6 + 2.0517708251132891 * y7 - 0.21453902099796354 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 6.5004829433182927 * w1 - 18.574714686567091 * w2 + 30.46631462702782 * w3 - 31.366778149984537 * w4 + 20.753475968570921 * w5 - 8.6160232949782323 * w6 + 2.0517708251132891 * w7 - 0.21453902099796354 * w8;
+        y[n] = 4.2142568367843384e-08 * (w0 + w8) + 3.3714054694274707e-07 * (w1 + w7) + 1.1799919142996149e-06 * (w2 + w6) + 2.3599838285992297e-06 * (w3 + w5) + 2.9499797857490367e-06 * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 4.2142568367843384e-08 * xn;
+        double p1 = 3.3714054694274707e-07 * xn;
+        double p2 = 1.1799919142996149e-06 * xn;
+        double p3 = 2.3599838285992297e-06 * xn;
+        double p4 = 2.9499797857490367e-06 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 6.5004829433182927 * yn;
+        s1 = s2 + p2 - 18.574714686567091 * yn;
+        s2 = s3 + p3 + 30.46631462702782 * yn;
+        s3 = s4 + p4 - 31.366778149984537 * yn;
+        s4 = s5 + p3 + 20.753475968570921 * yn;
+        s5 = s6 + p2 - 8.6160232949782323 * yn;
+        s6 = s7 + p1 + 2.0517708251132891 * yn;
+        s7 = p0 - 0.21453902099796354 * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order8_cut2000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.5712026591542236 * w1_0 - 0.6180487018892572 * w2_0;
+        v = 4.2142568367843384e-08 * wn0 + 8.5449446186561074e-08 * w1_0 + 4.3323245332070425e-08 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.589436935206564 * w1_1 - 0.63977359246369347 * w2_1;
+        v = wn1 + 1.9995200325039777 * w1_1 + 0.99990173947553884 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.6303956585896189 * w1_2 - 0.68920833249736368 * w2_2;
+        v = wn2 + 1.9723721471370803 * w1_2 + 0.97274726938574518 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.7094476903678821 * w1_3 - 0.78723929992281583 * w2_3;
+        v = wn3 + 2.000479949159633 * w1_3 + 1.0000982647257308 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 4.214256677e-08f * (x0 + x8) + 3.371405342e-07f * (x1 + x7) + 1.179991955e-06f * (x2 + x6) + 2.35998391e-06f * (x3 + x5) + 2.949979717e-06f * x4 + 6.500483036f * y1 - 18.57471466f * y2 + 30.46631432f * y3 - 31.36677742f * y4 + 20.75347519f * y5 - 8.616023064f * y6 + 2.051770926f * y7 - 0.2145390213f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 6.500483036f * w1 - 18.57471466f * w2 + 30.46631432f * w3 - 31.36677742f * w4 + 20.75347519f * w5 - 8.616023064f * w6 + 2.051770926f * w7 - 0.2145390213f * w8;
+        y[n] = 4.214256677e-08f * (w0 + w8) + 3.371405342e-07f * (w1 + w7) + 1.179991955e-06f * (w2 + w6) + 2.35998391e-06f * (w3 + w5) + 2.949979717e-06f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 4.214256677e-08f * xn;
+        float p1 = 3.371405342e-07f * xn;
+        float p2 = 1.179991955e-06f * xn;
+        float p3 = 2.35998391e-06f * xn;
+        float p4 = 2.949979717e-06f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 6.500483036f * yn;
+        s1 = s2 + p2 - 18.57471466f * yn;
+        s2 = s3 + p3 + 30.46631432f * yn;
+        s3 = s4 + p4 - 31.36677742f * yn;
+        s4 = s5 + p3 + 20.75347519f * yn;
+        s5 = s6 + p2 - 8.616023064f * yn;
+        s6 = s7 + p1 + 2.051770926f * yn;
+        s7 = p0 - 0.2145390213f * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order8_cut2000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.557685137f * w1_0 - 0.6186563969f * w2_0;
+        v = 4.214256677e-08f * wn0 + 9.683817837e-08f * w1_0 + 5.685975779e-08f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.648380995f * w1_1 - 0.7037421465f * w2_1;
+        v = wn1 + 1.955331087f * w1_1 + 1.000000119f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.58599937f * w1_2 - 0.6267057657f * w2_2;
+        v = wn2 + 1.703105688f * w1_2 + 0.7411668301f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 1.708417654f * w1_3 - 0.7862843275f * w2_3;
+        v = (wn3 + w2_3) + 2.04369235f * w1_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double x0 = x[n];
+        double yn = 2.6168112174018756e-05 * (x0 + x8) + 0.00020934489739215004 * (x1 + x7) + 0.00073270714087252521 * (x2 + x6) + 0.0014654142817450504 * (x3 + x5) + 0.0018317678521813129 * x4 + 4.3882429088593158 * y1 - 8.7794182694766754 * y2 + 10.394279101179917 * y3 - 7.9279528897519098 * y4 + 3.974414435674146 * y5 - 1.2751034469020412 * y6 + 0.23878076542261573 * y7 - 0.019941641721915468 * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        double w0 = x[n] + 4.3882429088593158 * w1 - 8.7794182694766754 * w2 + 10.394279101179917 * w3 - 7.9279528897519098 * w4 + 3.974414435674146 * w5 - 1.2751034469020412 * w6 + 0.23878076542261573 * w7 - 0.019941641721915468 * w8;
+        y[n] = 2.6168112174018756e-05 * (w0 + w8) + 0.00020934489739215004 * (w1 + w7) + 0.00073270714087252521 * (w2 + w6) + 0.0014654142817450504 * (w3 + w5) + 0.0018317678521813129 * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        double xn = x[n];
+        double p0 = 2.6168112174018756e-05 * xn;
+        double p1 = 0.00020934489739215004 * xn;
+        double p2 = 0.00073270714087252521 * xn;
+        double p3 = 0.0014654142817450504 * xn;
+        double p4 = 0.0018317678521813129 * xn;
+        double yn = s0 + p0;
+        s0 = s1 + p1 + 4.3882429088593158 * yn;
+        s1 = s2 + p2 - 8.7794182694766754 * yn;
+        s2 = s3 + p3 + 10.394279101179917 * yn;
+        s3 = s4 + p4 - 7.9279528897519098 * yn;
+        s4 = s5 + p3 + 3.974414435674146 * yn;
+        s5 = s6 + p2 - 1.2751034469020412 * yn;
+        s6 = s7 + p1 + 0.23878076542261573 * yn;
+        s7 = p0 - 0.019941641721915468 * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order8_cut5000_f64_kernel(double *x, double *y, int N) {
+    double w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        double v = x[n];
+        double wn0 = v + 1.0521484470692863 * w1_0 - 0.27987951171375802 * w2_0;
+        v = 2.6168112174018756e-05 * wn0 + 5.3059193580710037e-05 * w1_0 + 2.6901244691512592e-05 * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        double wn1 = v + 1.0678121151073543 * w1_1 - 0.31471751291789257 * w2_1;
+        v = wn1 + 1.9995200325039777 * w1_1 + 0.99990173947553884 * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        double wn2 = v + 1.1023677645977497 * w1_2 - 0.39672241846792689 * w2_2;
+        v = wn2 + 1.9723721471370803 * w1_2 + 0.97274726938574518 * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        double wn3 = v + 1.1659145820849277 * w1_3 - 0.5706661972915017 * w2_3;
+        v = wn3 + 2.000479949159633 * w1_3 + 1.0000982647257308 * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+void bessel_df1_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, y1 = 0, y2 = 0, y3 = 0, y4 = 0, y5 = 0, y6 = 0, y7 = 0, y8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float x0 = x[n];
+        float yn = 2.616811253e-05f * (x0 + x8) + 0.0002093449002f * (x1 + x7) + 0.0007327071507f * (x2 + x6) + 0.001465414301f * (x3 + x5) + 0.001831767848f * x4 + 4.388242722f * y1 - 8.779417992f * y2 + 10.39427948f * y3 - 7.927952766f * y4 + 3.974414349f * y5 - 1.27510345f * y6 + 0.2387807667f * y7 - 0.01994164102f * y8;
+        x8 = x7;
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        y8 = y7;
+        y7 = y6;
+        y6 = y5;
+        y5 = y4;
+        y4 = y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_df2_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1 = 0, w2 = 0, w3 = 0, w4 = 0, w5 = 0, w6 = 0, w7 = 0, w8 = 0;
+    for (int n = 0; n < N; ++n) {
+        float w0 = x[n] + 4.388242722f * w1 - 8.779417992f * w2 + 10.39427948f * w3 - 7.927952766f * w4 + 3.974414349f * w5 - 1.27510345f * w6 + 0.2387807667f * w7 - 0.01994164102f * w8;
+        y[n] = 2.616811253e-05f * (w0 + w8) + 0.0002093449002f * (w1 + w7) + 0.0007327071507f * (w2 + w6) + 0.001465414301f * (w3 + w5) + 0.001831767848f * w4;
+        w8 = w7;
+        w7 = w6;
+        w6 = w5;
+        w5 = w4;
+        w4 = w3;
+        w3 = w2;
+        w2 = w1;
+        w1 = w0;
+    }
+}
+
+void bessel_tdf2_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int n = 0; n < N; ++n) {
+        float xn = x[n];
+        float p0 = 2.616811253e-05f * xn;
+        float p1 = 0.0002093449002f * xn;
+        float p2 = 0.0007327071507f * xn;
+        float p3 = 0.001465414301f * xn;
+        float p4 = 0.001831767848f * xn;
+        float yn = s0 + p0;
+        s0 = s1 + p1 + 4.388242722f * yn;
+        s1 = s2 + p2 - 8.779417992f * yn;
+        s2 = s3 + p3 + 10.39427948f * yn;
+        s3 = s4 + p4 - 7.927952766f * yn;
+        s4 = s5 + p3 + 3.974414349f * yn;
+        s5 = s6 + p2 - 1.27510345f * yn;
+        s6 = s7 + p1 + 0.2387807667f * yn;
+        s7 = p0 - 0.01994164102f * yn;
+        y[n] = yn;
+    }
+}
+
+void bessel_cascade_order8_cut5000_f32_kernel(float *x, float *y, int N) {
+    float w1_0 = 0, w1_1 = 0, w1_2 = 0, w1_3 = 0, w2_0 = 0, w2_1 = 0, w2_2 = 0, w2_3 = 0;
+    for (int n = 0; n < N; ++n) {
+        float v = x[n];
+        float wn0 = v + 1.052507162f * w1_0 - 0.2800447643f * w2_0;
+        v = 2.616811253e-05f * wn0 + 5.314317968e-05f * w1_0 + 2.698765638e-05f * w2_0;
+        w2_0 = w1_0;
+        w1_0 = wn0;
+        float wn1 = v + 1.067424655f * w1_1 - 0.3144766986f * w2_1;
+        v = wn1 + 1.99963665f * w1_1 + 1.000112176f * w2_1;
+        w2_1 = w1_1;
+        w1_1 = wn1;
+        float wn2 = v + 1.102353096f * w1_2 - 0.3967812955f * w2_2;
+        v = wn2 + 1.969162583f * w1_2 + 0.9696325064f * w2_2;
+        w2_2 = w1_2;
+        w1_2 = wn2;
+        float wn3 = v + 1.165957808f * w1_3 - 0.5706815124f * w2_3;
+        v = wn3 + 2.00036335f * w1_3 + 0.9998879433f * w2_3;
+        w2_3 = w1_3;
+        w1_3 = wn3;
+        y[n] = v;
+    }
+}
+
+baked_kernel_f baked_kernels_f[] = {
+    {"butter_df1_order2_cut1000_f32_ba", "DF1", 3, butter_df1_order2_cut1000_f32_ba[0], butter_df1_order2_cut1000_f32_ba[1], NULL, butter_df1_order2_cut1000_f32_kernel},
+    {"butter_df2_order2_cut1000_f32_ba", "DF2", 3, butter_df2_order2_cut1000_f32_ba[0], butter_df2_order2_cut1000_f32_ba[1], NULL, butter_df2_order2_cut1000_f32_kernel},
+    {"butter_tdf2_order2_cut1000_f32_ba", "TDF2", 3, butter_tdf2_order2_cut1000_f32_ba[0], butter_tdf2_order2_cut1000_f32_ba[1], NULL, butter_tdf2_order2_cut1000_f32_kernel},
+    {"butter_cascade_order2_cut1000_f32_sos", "CASCADE", 1, NULL, NULL, *butter_cascade_order2_cut1000_f32_sos, butter_cascade_order2_cut1000_f32_kernel},
+    {"butter_df1_order2_cut2000_f32_ba", "DF1", 3, butter_df1_order2_cut2000_f32_ba[0], butter_df1_order2_cut2000_f32_ba[1], NULL, butter_df1_order2_cut2000_f32_kernel},
+    {"butter_df2_order2_cut2000_f32_ba", "DF2", 3, butter_df2_order2_cut2000_f32_ba[0], butter_df2_order2_cut2000_f32_ba[1], NULL, butter_df2_order2_cut2000_f32_kernel},
+    {"butter_tdf2_order2_cut2000_f32_ba", "TDF2", 3, butter_tdf2_order2_cut2000_f32_ba[0], butter_tdf2_order2_cut2000_f32_ba[1], NULL, butter_tdf2_order2_cut2000_f32_kernel},
+    {"butter_cascade_order2_cut2000_f32_sos", "CASCADE", 1, NULL, NULL, *butter_cascade_order2_cut2000_f32_sos, butter_cascade_order2_cut2000_f32_kernel},
+    {"butter_df1_order2_cut5000_f32_ba", "DF1", 3, butter_df1_order2_cut5000_f32_ba[0], butter_df1_order2_cut5000_f32_ba[1], NULL, butter_df1_order2_cut5000_f32_kernel},
+    {"butter_df2_order2_cut5000_f32_ba", "DF2", 3, butter_df2_order2_cut5000_f32_ba[0], butter_df2_order2_cut5000_f32_ba[1], NULL, butter_df2_order2_cut5000_f32_kernel},
+    {"butter_tdf2_order2_cut5000_f32_ba", "TDF2", 3, butter_tdf2_order2_cut5000_f32_ba[0], butter_tdf2_order2_cut5000_f32_ba[1], NULL, butter_tdf2_order2_cut5000_f32_kernel},
+    {"butter_cascade_order2_cut5000_f32_sos", "CASCADE", 1, NULL, NULL, *butter_cascade_order2_cut5000_f32_sos, butter_cascade_order2_cut5000_f32_kernel},
+    {"butter_df1_order4_cut1000_f32_ba", "DF1", 5, butter_df1_order4_cut1000_f32_ba[0], butter_df1_order4_cut1000_f32_ba[1], NULL, butter_df1_order4_cut1000_f32_kernel},
+    {"butter_df2_order4_cut1000_f32_ba", "DF2", 5, butter_df2_order4_cut1000_f32_ba[0], butter_df2_order4_cut1000_f32_ba[1], NULL, butter_df2_order4_cut1000_f32_kernel},
+    {"butter_tdf2_order4_cut1000_f32_ba", "TDF2", 5, butter_tdf2_order4_cut1000_f32_ba[0], butter_tdf2_order4_cut1000_f32_ba[1], NULL, butter_tdf2_order4_cut1000_f32_kernel},
+    {"butter_cascade_order4_cut1000_f32_sos", "CASCADE", 2, NULL, NULL, *butter_cascade_order4_cut1000_f32_sos, butter_cascade_order4_cut1000_f32_kernel},
+    {"butter_df1_order4_cut2000_f32_ba", "DF1", 5, butter_df1_order4_cut2000_f32_ba[0], butter_df1_order4_cut2000_f32_ba[1], NULL, butter_df1_order4_cut2000_f32_kernel},
+    {"butter_df2_order4_cut2000_f32_ba", "DF2", 5, butter_df2_order4_cut2000_f32_ba[0], butter_df2_order4_cut2000_f32_ba[1], NULL, butter_df2_order4_cut2000_f32_kernel},
+    {"butter_tdf2_order4_cut2000_f32_ba", "TDF2", 5, butter_tdf2_order4_cut2000_f32_ba[0], butter_tdf2_order4_cut2000_f32_ba[1], NULL, butter_tdf2_order4_cut2000_f32_kernel},
+    {"butter_cascade_order4_cut2000_f32_sos", "CASCADE", 2, NULL, NULL, *butter_cascade_order4_cut2000_f32_sos, butter_cascade_order4_cut2000_f32_kernel},
+    {"butter_df1_order4_cut5000_f32_ba", "DF1", 5, butter_df1_order4_cut5000_f32_ba[0], butter_df1_order4_cut5000_f32_ba[1], NULL, butter_df1_order4_cut5000_f32_kernel},
+    {"butter_df2_order4_cut5000_f32_ba", "DF2", 5, butter_df2_order4_cut5000_f32_ba[0], butter_df2_order4_cut5000_f32_ba[1], NULL, butter_df2_order4_cut5000_f32_kernel},
+    {"butter_tdf2_order4_cut5000_f32_ba", "TDF2", 5, butter_tdf2_order4_cut5000_f32_ba[0], butter_tdf2_order4_cut5000_f32_ba[1], NULL, butter_tdf2_order4_cut5000_f32_kernel},
+    {"butter_cascade_order4_cut5000_f32_sos", "CASCADE", 2, NULL, NULL, *butter_cascade_order4_cut5000_f32_sos, butter_cascade_order4_cut5000_f32_kernel},
+    {"butter_df1_order6_cut1000_f32_ba", "DF1", 7, butter_df1_order6_cut1000_f32_ba[0], butter_df1_order6_cut1000_f32_ba[1], NULL, butter_df1_order6_cut1000_f32_kernel},
+    {"butter_df2_order6_cut1000_f32_ba", "DF2", 7, butter_df2_order6_cut1000_f32_ba[0], butter_df2_order6_cut1000_f32_ba[1], NULL, butter_df2_order6_cut1000_f32_kernel},
+    {"butter_tdf2_order6_cut1000_f32_ba", "TDF2", 7, butter_tdf2_order6_cut1000_f32_ba[0], butter_tdf2_order6_cut1000_f32_ba[1], NULL, butter_tdf2_order6_cut1000_f32_kernel},
+    {"butter_cascade_order6_cut1000_f32_sos", "CASCADE", 3, NULL, NULL, *butter_cascade_order6_cut1000_f32_sos, butter_cascade_order6_cut1000_f32_kernel},
+    {"butter_df1_order6_cut2000_f32_ba", "DF1", 7, butter_df1_order6_cut2000_f32_ba[0], butter_df1_order6_cut2000_f32_ba[1], NULL, butter_df1_order6_cut2000_f32_kernel},
+    {"butter_df2_order6_cut2000_f32_ba", "DF2", 7, butter_df2_order6_cut2000_f32_ba[0], butter_df2_order6_cut2000_f32_ba[1], NULL, butter_df2_order6_cut2000_f32_kernel},
+    {"butter_tdf2_order6_cut2000_f32_ba", "TDF2", 7, butter_tdf2_order6_cut2000_f32_ba[0], butter_tdf2_order6_cut2000_f32_ba[1], NULL, butter_tdf2_order6_cut2000_f32_kernel},
+    {"butter_cascade_order6_cut2000_f32_sos", "CASCADE", 3, NULL, NULL, *butter_cascade_order6_cut2000_f32_sos, butter_cascade_order6_cut2000_f32_kernel},
+    {"butter_df1_order6_cut5000_f32_ba", "DF1", 7, butter_df1_order6_cut5000_f32_ba[0], butter_df1_order6_cut5000_f32_ba[1], NULL, butter_df1_order6_cut5000_f32_kernel},
+    {"butter_df2_order6_cut5000_f32_ba", "DF2", 7, butter_df2_order6_cut5000_f32_ba[0], butter_df2_order6_cut5000_f32_ba[1], NULL, butter_df2_order6_cut5000_f32_kernel},
+    {"butter_tdf2_order6_cut5000_f32_ba", "TDF2", 7, butter_tdf2_order6_cut5000_f32_ba[0], butter_tdf2_order6_cut5000_f32_ba[1], NULL, butter_tdf2_order6_cut5000_f32_kernel},
+    {"butter_cascade_order6_cut5000_f32_sos", "CASCADE", 3, NULL, NULL, *butter_cascade_order6_cut5000_f32_sos, butter_cascade_order6_cut5000_f32_kernel},
+    {"butter_df1_order8_cut1000_f32_ba", "DF1", 9, butter_df1_order8_cut1000_f32_ba[0], butter_df1_order8_cut1000_f32_ba[1], NULL, butter_df1_order8_cut1000_f32_kernel},
+    {"butter_df2_order8_cut1000_f32_ba", "DF2", 9, butter_df2_order8_cut1000_f32_ba[0], butter_df2_order8_cut1000_f32_ba[1], NULL, butter_df2_order8_cut1000_f32_kernel},
+    {"butter_tdf2_order8_cut1000_f32_ba", "TDF2", 9, butter_tdf2_order8_cut1000_f32_ba[0], butter_tdf2_order8_cut1000_f32_ba[1], NULL, butter_tdf2_order8_cut1000_f32_kernel},
+    {"butter_cascade_order8_cut1000_f32_sos", "CASCADE", 4, NULL, NULL, *butter_cascade_order8_cut1000_f32_sos, butter_cascade_order8_cut1000_f32_kernel},
+    {"butter_df1_order8_cut2000_f32_ba", "DF1", 9, butter_df1_order8_cut2000_f32_ba[0], butter_df1_order8_cut2000_f32_ba[1], NULL, butter_df1_order8_cut2000_f32_kernel},
+    {"butter_df2_order8_cut2000_f32_ba", "DF2", 9, butter_df2_order8_cut2000_f32_ba[0], butter_df2_order8_cut2000_f32_ba[1], NULL, butter_df2_order8_cut2000_f32_kernel},
+    {"butter_tdf2_order8_cut2000_f32_ba", "TDF2", 9, butter_tdf2_order8_cut2000_f32_ba[0], butter_tdf2_order8_cut2000_f32_ba[1], NULL, butter_tdf2_order8_cut2000_f32_kernel},
+    {"butter_cascade_order8_cut2000_f32_sos", "CASCADE", 4, NULL, NULL, *butter_cascade_order8_cut2000_f32_sos, butter_cascade_order8_cut2000_f32_kernel},
+    {"butter_df1_order8_cut5000_f32_ba", "DF1", 9, butter_df1_order8_cut5000_f32_ba[0], butter_df1_order8_cut5000_f32_ba[1], NULL, butter_df1_order8_cut5000_f32_kernel},
+    {"butter_df2_order8_cut5000_f32_ba", "DF2", 9, butter_df2_order8_cut5000_f32_ba[0], butter_df2_order8_cut5000_f32_ba[1], NULL, butter_df2_order8_cut5000_f32_kernel},
+    {"butter_tdf2_order8_cut5000_f32_ba", "TDF2", 9, butter_tdf2_order8_cut5000_f32_ba[0], butter_tdf2_order8_cut5000_f32_ba[1], NULL, butter_tdf2_order8_cut5000_f32_kernel},
+    {"butter_cascade_order8_cut5000_f32_sos", "CASCADE", 4, NULL, NULL, *butter_cascade_order8_cut5000_f32_sos, butter_cascade_order8_cut5000_f32_kernel},
+    {"cheby1_df1_order2_cut1000_f32_ba", "DF1", 3, cheby1_df1_order2_cut1000_f32_ba[0], cheby1_df1_order2_cut1000_f32_ba[1], NULL, cheby1_df1_order2_cut1000_f32_kernel},
+    {"cheby1_df2_order2_cut1000_f32_ba", "DF2", 3, cheby1_df2_order2_cut1000_f32_ba[0], cheby1_df2_order2_cut1000_f32_ba[1], NULL, cheby1_df2_order2_cut1000_f32_kernel},
+    {"cheby1_tdf2_order2_cut1000_f32_ba", "TDF2", 3, cheby1_tdf2_order2_cut1000_f32_ba[0], cheby1_tdf2_order2_cut1000_f32_ba[1], NULL, cheby1_tdf2_order2_cut1000_f32_kernel},
+    {"cheby1_cascade_order2_cut1000_f32_sos", "CASCADE", 1, NULL, NULL, *cheby1_cascade_order2_cut1000_f32_sos, cheby1_cascade_order2_cut1000_f32_kernel},
+    {"cheby1_df1_order2_cut2000_f32_ba", "DF1", 3, cheby1_df1_order2_cut2000_f32_ba[0], cheby1_df1_order2_cut2000_f32_ba[1], NULL, cheby1_df1_order2_cut2000_f32_kernel},
+    {"cheby1_df2_order2_cut2000_f32_ba", "DF2", 3, cheby1_df2_order2_cut2000_f32_ba[0], cheby1_df2_order2_cut2000_f32_ba[1], NULL, cheby1_df2_order2_cut2000_f32_kernel},
+    {"cheby1_tdf2_order2_cut2000_f32_ba", "TDF2", 3, cheby1_tdf2_order2_cut2000_f32_ba[0], cheby1_tdf2_order2_cut2000_f32_ba[1], NULL, cheby1_tdf2_order2_cut2000_f32_kernel},
+    {"cheby1_cascade_order2_cut2000_f32_sos", "CASCADE", 1, NULL, NULL, *cheby1_cascade_order2_cut2000_f32_sos, cheby1_cascade_order2_cut2000_f32_kernel},
+    {"cheby1_df1_order2_cut5000_f32_ba", "DF1", 3, cheby1_df1_order2_cut5000_f32_ba[0], cheby1_df1_order2_cut5000_f32_ba[1], NULL, cheby1_df1_order2_cut5000_f32_kernel},
+    {"cheby1_df2_order2_cut5000_f32_ba", "DF2", 3, cheby1_df2_order2_cut5000_f32_ba[0], cheby1_df2_order2_cut5000_f32_ba[1], NULL, cheby1_df2_order2_cut5000_f32_kernel},
+    {"cheby1_tdf2_order2_cut5000_f32_ba", "TDF2", 3, cheby1_tdf2_order2_cut5000_f32_ba[0], cheby1_tdf2_order2_cut5000_f32_ba[1], NULL, cheby1_tdf2_order2_cut5000_f32_kernel},
+    {"cheby1_cascade_order2_cut5000_f32_sos", "CASCADE", 1, NULL, NULL, *cheby1_cascade_order2_cut5000_f32_sos, cheby1_cascade_order2_cut5000_f32_kernel},
+    {"cheby1_df1_order4_cut1000_f32_ba", "DF1", 5, cheby1_df1_order4_cut1000_f32_ba[0], cheby1_df1_order4_cut1000_f32_ba[1], NULL, cheby1_df1_order4_cut1000_f32_kernel},
+    {"cheby1_df2_order4_cut1000_f32_ba", "DF2", 5, cheby1_df2_order4_cut1000_f32_ba[0], cheby1_df2_order4_cut1000_f32_ba[1], NULL, cheby1_df2_order4_cut1000_f32_kernel},
+    {"cheby1_tdf2_order4_cut1000_f32_ba", "TDF2", 5, cheby1_tdf2_order4_cut1000_f32_ba[0], cheby1_tdf2_order4_cut1000_f32_ba[1], NULL, cheby1_tdf2_order4_cut1000_f32_kernel},
+    {"cheby1_cascade_order4_cut1000_f32_sos", "CASCADE", 2, NULL, NULL, *cheby1_cascade_order4_cut1000_f32_sos, cheby1_cascade_order4_cut1000_f32_kernel},
+    {"cheby1_df1_order4_cut2000_f32_ba", "DF1", 5, cheby1_df1_order4_cut2000_f32_ba[0], cheby1_df1_order4_cut2000_f32_ba[1], NULL, cheby1_df1_order4_cut2000_f32_kernel},
+    {"cheby1_df2_order4_cut2000_f32_ba", "DF2", 5, cheby1_df2_order4_cut2000_f32_ba[0], cheby1_df2_order4_cut2000_f32_ba[1], NULL, cheby1_df2_order4_cut2000_f32_kernel},
+    {"cheby1_tdf2_order4_cut2000_f32_ba", "TDF2", 5, cheby1_tdf2_order4_cut2000_f32_ba[0], cheby1_tdf2_order4_cut2000_f32_ba[1], NULL, cheby1_tdf2_order4_cut2000_f32_kernel},
+    {"cheby1_cascade_order4_cut2000_f32_sos", "CASCADE", 2, NULL, NULL, *cheby1_cascade_order4_cut2000_f32_sos, cheby1_cascade_order4_cut2000_f32_kernel},
+    {"cheby1_df1_order4_cut5000_f32_ba", "DF1", 5, cheby1_df1_order4_cut5000_f32_ba[0], cheby1_df1_order4_cut5000_f32_ba[1], NULL, cheby1_df1_order4_cut5000_f32_kernel},
+    {"cheby1_df2_order4_cut5000_f32_ba", "DF2", 5, cheby1_df2_order4_cut5000_f32_ba[0], cheby1_df2_order4_cut5000_f32_ba[1], NULL, cheby1_df2_order4_cut5000_f32_kernel},
+    {"cheby1_tdf2_order4_cut5000_f32_ba", "TDF2", 5, cheby1_tdf2_order4_cut5000_f32_ba[0], cheby1_tdf2_order4_cut5000_f32_ba[1], NULL, cheby1_tdf2_order4_cut5000_f32_kernel},
+    {"cheby1_cascade_order4_cut5000_f32_sos", "CASCADE", 2, NULL, NULL, *cheby1_cascade_order4_cut5000_f32_sos, cheby1_cascade_order4_cut5000_f32_kernel},
+    {"cheby1_df1_order6_cut1000_f32_ba", "DF1", 7, cheby1_df1_order6_cut1000_f32_ba[0], cheby1_df1_order6_cut1000_f32_ba[1], NULL, cheby1_df1_order6_cut1000_f32_kernel},
+    {"cheby1_df2_order6_cut1000_f32_ba", "DF2", 7, cheby1_df2_order6_cut1000_f32_ba[0], cheby1_df2_order6_cut1000_f32_ba[1], NULL, cheby1_df2_order6_cut1000_f32_kernel},
+    {"cheby1_tdf2_order6_cut1000_f32_ba", "TDF2", 7, cheby1_tdf2_order6_cut1000_f32_ba[0], cheby1_tdf2_order6_cut1000_f32_ba[1], NULL, cheby1_tdf2_order6_cut1000_f32_kernel},
+    {"cheby1_cascade_order6_cut1000_f32_sos", "CASCADE", 3, NULL, NULL, *cheby1_cascade_order6_cut1000_f32_sos, cheby1_cascade_order6_cut1000_f32_kernel},
+    {"cheby1_df1_order6_cut2000_f32_ba", "DF1", 7, cheby1_df1_order6_cut2000_f32_ba[0], cheby1_df1_order6_cut2000_f32_ba[1], NULL, cheby1_df1_order6_cut2000_f32_kernel},
+    {"cheby1_df2_order6_cut2000_f32_ba", "DF2", 7, cheby1_df2_order6_cut2000_f32_ba[0], cheby1_df2_order6_cut2000_f32_ba[1], NULL, cheby1_df2_order6_cut2000_f32_kernel},
+    {"cheby1_tdf2_order6_cut2000_f32_ba", "TDF2", 7, cheby1_tdf2_order6_cut2000_f32_ba[0], cheby1_tdf2_order6_cut2000_f32_ba[1], NULL, cheby1_tdf2_order6_cut2000_f32_kernel},
+    {"cheby1_cascade_order6_cut2000_f32_sos", "CASCADE", 3, NULL, NULL, *cheby1_cascade_order6_cut2000_f32_sos, cheby1_cascade_order6_cut2000_f32_kernel},
+    {"cheby1_df1_order6_cut5000_f32_ba", "DF1", 7, cheby1_df1_order6_cut5000_f32_ba[0], cheby1_df1_order6_cut5000_f32_ba[1], NULL, cheby1_df1_order6_cut5000_f32_kernel},
+    {"cheby1_df2_order6_cut5000_f32_ba", "DF2", 7, cheby1_df2_order6_cut5000_f32_ba[0], cheby1_df2_order6_cut5000_f32_ba[1], NULL, cheby1_df2_order6_cut5000_f32_kernel},
+    {"cheby1_tdf2_order6_cut5000_f32_ba", "TDF2", 7, cheby1_tdf2_order6_cut5000_f32_ba[0], cheby1_tdf2_order6_cut5000_f32_ba[1], NULL, cheby1_tdf2_order6_cut5000_f32_kernel},
+    {"cheby1_cascade_order6_cut5000_f32_sos", "CASCADE", 3, NULL, NULL, *cheby1_cascade_order6_cut5000_f32_sos, cheby1_cascade_order6_cut5000_f32_kernel},
+    {"cheby1_df1_order8_cut1000_f32_ba", "DF1", 9, cheby1_df1_order8_cut1000_f32_ba[0], cheby1_df1_order8_cut1000_f32_ba[1], NULL, cheby1_df1_order8_cut1000_f32_kernel},
+    {"cheby1_df2_order8_cut1000_f32_ba", "DF2", 9, cheby1_df2_order8_cut1000_f32_ba[0], cheby1_df2_order8_cut1000_f32_ba[1], NULL, cheby1_df2_order8_cut1000_f32_kernel},
+    {"cheby1_tdf2_order8_cut1000_f32_ba", "TDF2", 9, cheby1_tdf2_order8_cut1000_f32_ba[0], cheby1_tdf2_order8_cut1000_f32_ba[1], NULL, cheby1_tdf2_order8_cut1000_f32_kernel},
+    {"cheby1_cascade_order8_cut1000_f32_sos", "CASCADE", 4, NULL, NULL, *cheby1_cascade_order8_cut1000_f32_sos, cheby1_cascade_order8_cut1000_f32_kernel},
+    {"cheby1_df1_order8_cut2000_f32_ba", "DF1", 9, cheby1_df1_order8_cut2000_f32_ba[0], cheby1_df1_order8_cut2000_f32_ba[1], NULL, cheby1_df1_order8_cut2000_f32_kernel},
+    {"cheby1_df2_order8_cut2000_f32_ba", "DF2", 9, cheby1_df2_order8_cut2000_f32_ba[0], cheby1_df2_order8_cut2000_f32_ba[1], NULL, cheby1_df2_order8_cut2000_f32_kernel},
+    {"cheby1_tdf2_order8_cut2000_f32_ba", "TDF2", 9, cheby1_tdf2_order8_cut2000_f32_ba[0], cheby1_tdf2_order8_cut2000_f32_ba[1], NULL, cheby1_tdf2_order8_cut2000_f32_kernel},
+    {"cheby1_cascade_order8_cut2000_f32_sos", "CASCADE", 4, NULL, NULL, *cheby1_cascade_order8_cut2000_f32_sos, cheby1_cascade_order8_cut2000_f32_kernel},
+    {"cheby1_df1_order8_cut5000_f32_ba", "DF1", 9, cheby1_df1_order8_cut5000_f32_ba[0], cheby1_df1_order8_cut5000_f32_ba[1], NULL, cheby1_df1_order8_cut5000_f32_kernel},
+    {"cheby1_df2_order8_cut5000_f32_ba", "DF2", 9, cheby1_df2_order8_cut5000_f32_ba[0], cheby1_df2_order8_cut5000_f32_ba[1], NULL, cheby1_df2_order8_cut5000_f32_kernel},
+    {"cheby1_tdf2_order8_cut5000_f32_ba", "TDF2", 9, cheby1_tdf2_order8_cut5000_f32_ba[0], cheby1_tdf2_order8_cut5000_f32_ba[1], NULL, cheby1_tdf2_order8_cut5000_f32_kernel},
+    {"cheby1_cascade_order8_cut5000_f32_sos", "CASCADE", 4, NULL, NULL, *cheby1_cascade_order8_cut5000_f32_sos, cheby1_cascade_order8_cut5000_f32_kernel},
+    {"cheby2_df1_order2_cut1000_f32_ba", "DF1", 3, cheby2_df1_order2_cut1000_f32_ba[0], cheby2_df1_order2_cut1000_f32_ba[1], NULL, cheby2_df1_order2_cut1000_f32_kernel},
+    {"cheby2_df2_order2_cut1000_f32_ba", "DF2", 3, cheby2_df2_order2_cut1000_f32_ba[0], cheby2_df2_order2_cut1000_f32_ba[1], NULL, cheby2_df2_order2_cut1000_f32_kernel},
+    {"cheby2_tdf2_order2_cut1000_f32_ba", "TDF2", 3, cheby2_tdf2_order2_cut1000_f32_ba[0], cheby2_tdf2_order2_cut1000_f32_ba[1], NULL, cheby2_tdf2_order2_cut1000_f32_kernel},
+    {"cheby2_cascade_order2_cut1000_f32_sos", "CASCADE", 1, NULL, NULL, *cheby2_cascade_order2_cut1000_f32_sos, cheby2_cascade_order2_cut1000_f32_kernel},
+    {"cheby2_df1_order2_cut2000_f32_ba", "DF1", 3, cheby2_df1_order2_cut2000_f32_ba[0], cheby2_df1_order2_cut2000_f32_ba[1], NULL, cheby2_df1_order2_cut2000_f32_kernel},
+    {"cheby2_df2_order2_cut2000_f32_ba", "DF2", 3, cheby2_df2_order2_cut2000_f32_ba[0], cheby2_df2_order2_cut2000_f32_ba[1], NULL, cheby2_df2_order2_cut2000_f32_kernel},
+    {"cheby2_tdf2_order2_cut2000_f32_ba", "TDF2", 3, cheby2_tdf2_order2_cut2000_f32_ba[0], cheby2_tdf2_order2_cut2000_f32_ba[1], NULL, cheby2_tdf2_order2_cut2000_f32_kernel},
+    {"cheby2_cascade_order2_cut2000_f32_sos", "CASCADE", 1, NULL, NULL, *cheby2_cascade_order2_cut2000_f32_sos, cheby2_cascade_order2_cut2000_f32_kernel},
+    {"cheby2_df1_order2_cut5000_f32_ba", "DF1", 3, cheby2_df1_order2_cut5000_f32_ba[0], cheby2_df1_order2_cut5000_f32_ba[1], NULL, cheby2_df1_order2_cut5000_f32_kernel},
+    {"cheby2_df2_order2_cut5000_f32_ba", "DF2", 3, cheby2_df2_order2_cut5000_f32_ba[0], cheby2_df2_order2_cut5000_f32_ba[1], NULL, cheby2_df2_order2_cut5000_f32_kernel},
+    {"cheby2_tdf2_order2_cut5000_f32_ba", "TDF2", 3, cheby2_tdf2_order2_cut5000_f32_ba[0], cheby2_tdf2_order2_cut5000_f32_ba[1], NULL, cheby2_tdf2_order2_cut5000_f32_kernel},
+    {"cheby2_cascade_order2_cut5000_f32_sos", "CASCADE", 1, NULL, NULL, *cheby2_cascade_order2_cut5000_f32_sos, cheby2_cascade_order2_cut5000_f32_kernel},
+    {"cheby2_df1_order4_cut1000_f32_ba", "DF1", 5, cheby2_df1_order4_cut1000_f32_ba[0], cheby2_df1_order4_cut1000_f32_ba[1], NULL, cheby2_df1_order4_cut1000_f32_kernel},
+    {"cheby2_df2_order4_cut1000_f32_ba", "DF2", 5, cheby2_df2_order4_cut1000_f32_ba[0], cheby2_df2_order4_cut1000_f32_ba[1], NULL, cheby2_df2_order4_cut1000_f32_kernel},
+    {"cheby2_tdf2_order4_cut1000_f32_ba", "TDF2", 5, cheby2_tdf2_order4_cut1000_f32_ba[0], cheby2_tdf2_order4_cut1000_f32_ba[1], NULL, cheby2_tdf2_order4_cut1000_f32_kernel},
+    {"cheby2_cascade_order4_cut1000_f32_sos", "CASCADE", 2, NULL, NULL, *cheby2_cascade_order4_cut1000_f32_sos, cheby2_cascade_order4_cut1000_f32_kernel},
+    {"cheby2_df1_order4_cut2000_f32_ba", "DF1", 5, cheby2_df1_order4_cut2000_f32_ba[0], cheby2_df1_order4_cut2000_f32_ba[1], NULL, cheby2_df1_order4_cut2000_f32_kernel},
+    {"cheby2_df2_order4_cut2000_f32_ba", "DF2", 5, cheby2_df2_order4_cut2000_f32_ba[0], cheby2_df2_order4_cut2000_f32_ba[1], NULL, cheby2_df2_order4_cut2000_f32_kernel},
+    {"cheby2_tdf2_order4_cut2000_f32_ba", "TDF2", 5, cheby2_tdf2_order4_cut2000_f32_ba[0], cheby2_tdf2_order4_cut2000_f32_ba[1], NULL, cheby2_tdf2_order4_cut2000_f32_kernel},
+    {"cheby2_cascade_order4_cut2000_f32_sos", "CASCADE", 2, NULL, NULL, *cheby2_cascade_order4_cut2000_f32_sos, cheby2_cascade_order4_cut2000_f32_kernel},
+    {"cheby2_df1_order4_cut5000_f32_ba", "DF1", 5, cheby2_df1_order4_cut5000_f32_ba[0], cheby2_df1_order4_cut5000_f32_ba[1], NULL, cheby2_df1_order4_cut5000_f32_kernel},
+    {"cheby2_df2_order4_cut5000_f32_ba", "DF2", 5, cheby2_df2_order4_cut5000_f32_ba[0], cheby2_df2_order4_cut5000_f32_ba[1], NULL, cheby2_df2_order4_cut5000_f32_kernel},
+    {"cheby2_tdf2_order4_cut5000_f32_ba", "TDF2", 5, cheby2_tdf2_order4_cut5000_f32_ba[0], cheby2_tdf2_order4_cut5000_f32_ba[1], NULL, cheby2_tdf2_order4_cut5000_f32_kernel},
+    {"cheby2_cascade_order4_cut5000_f32_sos", "CASCADE", 2, NULL, NULL, *cheby2_cascade_order4_cut5000_f32_sos, cheby2_cascade_order4_cut5000_f32_kernel},
+    {"cheby2_df1_order6_cut1000_f32_ba", "DF1", 7, cheby2_df1_order6_cut1000_f32_ba[0], cheby2_df1_order6_cut1000_f32_ba[1], NULL, cheby2_df1_order6_cut1000_f32_kernel},
+    {"cheby2_df2_order6_cut1000_f32_ba", "DF2", 7, cheby2_df2_order6_cut1000_f32_ba[0], cheby2_df2_order6_cut1000_f32_ba[1], NULL, cheby2_df2_order6_cut1000_f32_kernel},
+    {"cheby2_tdf2_order6_cut1000_f32_ba", "TDF2", 7, cheby2_tdf2_order6_cut1000_f32_ba[0], cheby2_tdf2_order6_cut1000_f32_ba[1], NULL, cheby2_tdf2_order6_cut1000_f32_kernel},
+    {"cheby2_cascade_order6_cut1000_f32_sos", "CASCADE", 3, NULL, NULL, *cheby2_cascade_order6_cut1000_f32_sos, cheby2_cascade_order6_cut1000_f32_kernel},
+    {"cheby2_df1_order6_cut2000_f32_ba", "DF1", 7, cheby2_df1_order6_cut2000_f32_ba[0], cheby2_df1_order6_cut2000_f32_ba[1], NULL, cheby2_df1_order6_cut2000_f32_kernel},
+    {"cheby2_df2_order6_cut2000_f32_ba", "DF2", 7, cheby2_df2_order6_cut2000_f32_ba[0], cheby2_df2_order6_cut2000_f32_ba[1], NULL, cheby2_df2_order6_cut2000_f32_kernel},
+    {"cheby2_tdf2_order6_cut2000_f32_ba", "TDF2", 7, cheby2_tdf2_order6_cut2000_f32_ba[0], cheby2_tdf2_order6_cut2000_f32_ba[1], NULL, cheby2_tdf2_order6_cut2000_f32_kernel},
+    {"cheby2_cascade_order6_cut2000_f32_sos", "CASCADE", 3, NULL, NULL, *cheby2_cascade_order6_cut2000_f32_sos, cheby2_cascade_order6_cut2000_f32_kernel},
+    {"cheby2_df1_order6_cut5000_f32_ba", "DF1", 7, cheby2_df1_order6_cut5000_f32_ba[0], cheby2_df1_order6_cut5000_f32_ba[1], NULL, cheby2_df1_order6_cut5000_f32_kernel},
+    {"cheby2_df2_order6_cut5000_f32_ba", "DF2", 7, cheby2_df2_order6_cut5000_f32_ba[0], cheby2_df2_order6_cut5000_f32_ba[1], NULL, cheby2_df2_order6_cut5000_f32_kernel},
+    {"cheby2_tdf2_order6_cut5000_f32_ba", "TDF2", 7, cheby2_tdf2_order6_cut5000_f32_ba[0], cheby2_tdf2_order6_cut5000_f32_ba[1], NULL, cheby2_tdf2_order6_cut5000_f32_kernel},
+    {"cheby2_cascade_order6_cut5000_f32_sos", "CASCADE", 3, NULL, NULL, *cheby2_cascade_order6_cut5000_f32_sos, cheby2_cascade_order6_cut5000_f32_kernel},
+    {"cheby2_df1_order8_cut1000_f32_ba", "DF1", 9, cheby2_df1_order8_cut1000_f32_ba[0], cheby2_df1_order8_cut1000_f32_ba[1], NULL, cheby2_df1_order8_cut1000_f32_kernel},
+    {"cheby2_df2_order8_cut1000_f32_ba", "DF2", 9, cheby2_df2_order8_cut1000_f32_ba[0], cheby2_df2_order8_cut1000_f32_ba[1], NULL, cheby2_df2_order8_cut1000_f32_kernel},
+    {"cheby2_tdf2_order8_cut1000_f32_ba", "TDF2", 9, cheby2_tdf2_order8_cut1000_f32_ba[0], cheby2_tdf2_order8_cut1000_f32_ba[1], NULL, cheby2_tdf2_order8_cut1000_f32_kernel},
+    {"cheby2_cascade_order8_cut1000_f32_sos", "CASCADE", 4, NULL, NULL, *cheby2_cascade_order8_cut1000_f32_sos, cheby2_cascade_order8_cut1000_f32_kernel},
+    {"cheby2_df1_order8_cut2000_f32_ba", "DF1", 9, cheby2_df1_order8_cut2000_f32_ba[0], cheby2_df1_order8_cut2000_f32_ba[1], NULL, cheby2_df1_order8_cut2000_f32_kernel},
+    {"cheby2_df2_order8_cut2000_f32_ba", "DF2", 9, cheby2_df2_order8_cut2000_f32_ba[0], cheby2_df2_order8_cut2000_f32_ba[1], NULL, cheby2_df2_order8_cut2000_f32_kernel},
+    {"cheby2_tdf2_order8_cut2000_f32_ba", "TDF2", 9, cheby2_tdf2_order8_cut2000_f32_ba[0], cheby2_tdf2_order8_cut2000_f32_ba[1], NULL, cheby2_tdf2_order8_cut2000_f32_kernel},
+    {"cheby2_cascade_order8_cut2000_f32_sos", "CASCADE", 4, NULL, NULL, *cheby2_cascade_order8_cut2000_f32_sos, cheby2_cascade_order8_cut2000_f32_kernel},
+    {"cheby2_df1_order8_cut5000_f32_ba", "DF1", 9, cheby2_df1_order8_cut5000_f32_ba[0], cheby2_df1_order8_cut5000_f32_ba[1], NULL, cheby2_df1_order8_cut5000_f32_kernel},
+    {"cheby2_df2_order8_cut5000_f32_ba", "DF2", 9, cheby2_df2_order8_cut5000_f32_ba[0], cheby2_df2_order8_cut5000_f32_ba[1], NULL, cheby2_df2_order8_cut5000_f32_kernel},
+    {"cheby2_tdf2_order8_cut5000_f32_ba", "TDF2", 9, cheby2_tdf2_order8_cut5000_f32_ba[0], cheby2_tdf2_order8_cut5000_f32_ba[1], NULL, cheby2_tdf2_order8_cut5000_f32_kernel},
+    {"cheby2_cascade_order8_cut5000_f32_sos", "CASCADE", 4, NULL, NULL, *cheby2_cascade_order8_cut5000_f32_sos, cheby2_cascade_order8_cut5000_f32_kernel},
+    {"ellip_df1_order2_cut1000_f32_ba", "DF1", 3, ellip_df1_order2_cut1000_f32_ba[0], ellip_df1_order2_cut1000_f32_ba[1], NULL, ellip_df1_order2_cut1000_f32_kernel},
+    {"ellip_df2_order2_cut1000_f32_ba", "DF2", 3, ellip_df2_order2_cut1000_f32_ba[0], ellip_df2_order2_cut1000_f32_ba[1], NULL, ellip_df2_order2_cut1000_f32_kernel},
+    {"ellip_tdf2_order2_cut1000_f32_ba", "TDF2", 3, ellip_tdf2_order2_cut1000_f32_ba[0], ellip_tdf2_order2_cut1000_f32_ba[1], NULL, ellip_tdf2_order2_cut1000_f32_kernel},
+    {"ellip_cascade_order2_cut1000_f32_sos", "CASCADE", 1, NULL, NULL, *ellip_cascade_order2_cut1000_f32_sos, ellip_cascade_order2_cut1000_f32_kernel},
+    {"ellip_df1_order2_cut2000_f32_ba", "DF1", 3, ellip_df1_order2_cut2000_f32_ba[0], ellip_df1_order2_cut2000_f32_ba[1], NULL, ellip_df1_order2_cut2000_f32_kernel},
+    {"ellip_df2_order2_cut2000_f32_ba", "DF2", 3, ellip_df2_order2_cut2000_f32_ba[0], ellip_df2_order2_cut2000_f32_ba[1], NULL, ellip_df2_order2_cut2000_f32_kernel},
+    {"ellip_tdf2_order2_cut2000_f32_ba", "TDF2", 3, ellip_tdf2_order2_cut2000_f32_ba[0], ellip_tdf2_order2_cut2000_f32_ba[1], NULL, ellip_tdf2_order2_cut2000_f32_kernel},
+    {"ellip_cascade_order2_cut2000_f32_sos", "CASCADE", 1, NULL, NULL, *ellip_cascade_order2_cut2000_f32_sos, ellip_cascade_order2_cut2000_f32_kernel},
+    {"ellip_df1_order2_cut5000_f32_ba", "DF1", 3, ellip_df1_order2_cut5000_f32_ba[0], ellip_df1_order2_cut5000_f32_ba[1], NULL, ellip_df1_order2_cut5000_f32_kernel},
+    {"ellip_df2_order2_cut5000_f32_ba", "DF2", 3, ellip_df2_order2_cut5000_f32_ba[0], ellip_df2_order2_cut5000_f32_ba[1], NULL, ellip_df2_order2_cut5000_f32_kernel},
+    {"ellip_tdf2_order2_cut5000_f32_ba", "TDF2", 3, ellip_tdf2_order2_cut5000_f32_ba[0], ellip_tdf2_order2_cut5000_f32_ba[1], NULL, ellip_tdf2_order2_cut5000_f32_kernel},
+    {"ellip_cascade_order2_cut5000_f32_sos", "CASCADE", 1, NULL, NULL, *ellip_cascade_order2_cut5000_f32_sos, ellip_cascade_order2_cut5000_f32_kernel},
+    {"ellip_df1_order4_cut1000_f32_ba", "DF1", 5, ellip_df1_order4_cut1000_f32_ba[0], ellip_df1_order4_cut1000_f32_ba[1], NULL, ellip_df1_order4_cut1000_f32_kernel},
+    {"ellip_df2_order4_cut1000_f32_ba", "DF2", 5, ellip_df2_order4_cut1000_f32_ba[0], ellip_df2_order4_cut1000_f32_ba[1], NULL, ellip_df2_order4_cut1000_f32_kernel},
+    {"ellip_tdf2_order4_cut1000_f32_ba", "TDF2", 5, ellip_tdf2_order4_cut1000_f32_ba[0], ellip_tdf2_order4_cut1000_f32_ba[1], NULL, ellip_tdf2_order4_cut1000_f32_kernel},
+    {"ellip_cascade_order4_cut1000_f32_sos", "CASCADE", 2, NULL, NULL, *ellip_cascade_order4_cut1000_f32_sos, ellip_cascade_order4_cut1000_f32_kernel},
+    {"ellip_df1_order4_cut2000_f32_ba", "DF1", 5, ellip_df1_order4_cut2000_f32_ba[0], ellip_df1_order4_cut2000_f32_ba[1], NULL, ellip_df1_order4_cut2000_f32_kernel},
+    {"ellip_df2_order4_cut2000_f32_ba", "DF2", 5, ellip_df2_order4_cut2000_f32_ba[0], ellip_df2_order4_cut2000_f32_ba[1], NULL, ellip_df2_order4_cut2000_f32_kernel},
+    {"ellip_tdf2_order4_cut2000_f32_ba", "TDF2", 5, ellip_tdf2_order4_cut2000_f32_ba[0], ellip_tdf2_order4_cut2000_f32_ba[1], NULL, ellip_tdf2_order4_cut2000_f32_kernel},
+    {"ellip_cascade_order4_cut2000_f32_sos", "CASCADE", 2, NULL, NULL, *ellip_cascade_order4_cut2000_f32_sos, ellip_cascade_order4_cut2000_f32_kernel},
+    {"ellip_df1_order4_cut5000_f32_ba", "DF1", 5, ellip_df1_order4_cut5000_f32_ba[0], ellip_df1_order4_cut5000_f32_ba[1], NULL, ellip_df1_order4_cut5000_f32_kernel},
+    {"ellip_df2_order4_cut5000_f32_ba", "DF2", 5, ellip_df2_order4_cut5000_f32_ba[0], ellip_df2_order4_cut5000_f32_ba[1], NULL, ellip_df2_order4_cut5000_f32_kernel},
+    {"ellip_tdf2_order4_cut5000_f32_ba", "TDF2", 5, ellip_tdf2_order4_cut5000_f32_ba[0], ellip_tdf2_order4_cut5000_f32_ba[1], NULL, ellip_tdf2_order4_cut5000_f32_kernel},
+    {"ellip_cascade_order4_cut5000_f32_sos", "CASCADE", 2, NULL, NULL, *ellip_cascade_order4_cut5000_f32_sos, ellip_cascade_order4_cut5000_f32_kernel},
+    {"ellip_df1_order6_cut1000_f32_ba", "DF1", 7, ellip_df1_order6_cut1000_f32_ba[0], ellip_df1_order6_cut1000_f32_ba[1], NULL, ellip_df1_order6_cut1000_f32_kernel},
+    {"ellip_df2_order6_cut1000_f32_ba", "DF2", 7, ellip_df2_order6_cut1000_f32_ba[0], ellip_df2_order6_cut1000_f32_ba[1], NULL, ellip_df2_order6_cut1000_f32_kernel},
+    {"ellip_tdf2_order6_cut1000_f32_ba", "TDF2", 7, ellip_tdf2_order6_cut1000_f32_ba[0], ellip_tdf2_order6_cut1000_f32_ba[1], NULL, ellip_tdf2_order6_cut1000_f32_kernel},
+    {"ellip_cascade_order6_cut1000_f32_sos", "CASCADE", 3, NULL, NULL, *ellip_cascade_order6_cut1000_f32_sos, ellip_cascade_order6_cut1000_f32_kernel},
+    {"ellip_df1_order6_cut2000_f32_ba", "DF1", 7, ellip_df1_order6_cut2000_f32_ba[0], ellip_df1_order6_cut2000_f32_ba[1], NULL, ellip_df1_order6_cut2000_f32_kernel},
+    {"ellip_df2_order6_cut2000_f32_ba", "DF2", 7, ellip_df2_order6_cut2000_f32_ba[0], ellip_df2_order6_cut2000_f32_ba[1], NULL, ellip_df2_order6_cut2000_f32_kernel},
+    {"ellip_tdf2_order6_cut2000_f32_ba", "TDF2", 7, ellip_tdf2_order6_cut2000_f32_ba[0], ellip_tdf2_order6_cut2000_f32_ba[1], NULL, ellip_tdf2_order6_cut2000_f32_kernel},
+    {"ellip_cascade_order6_cut2000_f32_sos", "CASCADE", 3, NULL, NULL, *ellip_cascade_order6_cut2000_f32_sos, ellip_cascade_order6_cut2000_f32_kernel},
+    {"ellip_df1_order6_cut5000_f32_ba", "DF1", 7, ellip_df1_order6_cut5000_f32_ba[0], ellip_df1_order6_cut5000_f32_ba[1], NULL, ellip_df1_order6_cut5000_f32_kernel},
+    {"ellip_df2_order6_cut5000_f32_ba", "DF2", 7, ellip_df2_order6_cut5000_f32_ba[0], ellip_df2_order6_cut5000_f32_ba[1], NULL, ellip_df2_order6_cut5000_f32_kernel},
+    {"ellip_tdf2_order6_cut5000_f32_ba", "TDF2", 7, ellip_tdf2_order6_cut5000_f32_ba[0], ellip_tdf2_order6_cut5000_f32_ba[1], NULL, ellip_tdf2_order6_cut5000_f32_kernel},
+    {"ellip_cascade_order6_cut5000_f32_sos", "CASCADE", 3, NULL, NULL, *ellip_cascade_order6_cut5000_f32_sos, ellip_cascade_order6_cut5000_f32_kernel},
+    {"ellip_df1_order8_cut1000_f32_ba", "DF1", 9, ellip_df1_order8_cut1000_f32_ba[0], ellip_df1_order8_cut1000_f32_ba[1], NULL, ellip_df1_order8_cut1000_f32_kernel},
+    {"ellip_df2_order8_cut1000_f32_ba", "DF2", 9, ellip_df2_order8_cut1000_f32_ba[0], ellip_df2_order8_cut1000_f32_ba[1], NULL, ellip_df2_order8_cut1000_f32_kernel},
+    {"ellip_tdf2_order8_cut1000_f32_ba", "TDF2", 9, ellip_tdf2_order8_cut1000_f32_ba[0], ellip_tdf2_order8_cut1000_f32_ba[1], NULL, ellip_tdf2_order8_cut1000_f32_kernel},
+    {"ellip_cascade_order8_cut1000_f32_sos", "CASCADE", 4, NULL, NULL, *ellip_cascade_order8_cut1000_f32_sos, ellip_cascade_order8_cut1000_f32_kernel},
+    {"ellip_df1_order8_cut2000_f32_ba", "DF1", 9, ellip_df1_order8_cut2000_f32_ba[0], ellip_df1_order8_cut2000_f32_ba[1], NULL, ellip_df1_order8_cut2000_f32_kernel},
+    {"ellip_df2_order8_cut2000_f32_ba", "DF2", 9, ellip_df2_order8_cut2000_f32_ba[0], ellip_df2_order8_cut2000_f32_ba[1], NULL, ellip_df2_order8_cut2000_f32_kernel},
+    {"ellip_tdf2_order8_cut2000_f32_ba", "TDF2", 9, ellip_tdf2_order8_cut2000_f32_ba[0], ellip_tdf2_order8_cut2000_f32_ba[1], NULL, ellip_tdf2_order8_cut2000_f32_kernel},
+    {"ellip_cascade_order8_cut2000_f32_sos", "CASCADE", 4, NULL, NULL, *ellip_cascade_order8_cut2000_f32_sos, ellip_cascade_order8_cut2000_f32_kernel},
+    {"ellip_df1_order8_cut5000_f32_ba", "DF1", 9, ellip_df1_order8_cut5000_f32_ba[0], ellip_df1_order8_cut5000_f32_ba[1], NULL, ellip_df1_order8_cut5000_f32_kernel},
+    {"ellip_df2_order8_cut5000_f32_ba", "DF2", 9, ellip_df2_order8_cut5000_f32_ba[0], ellip_df2_order8_cut5000_f32_ba[1], NULL, ellip_df2_order8_cut5000_f32_kernel},
+    {"ellip_tdf2_order8_cut5000_f32_ba", "TDF2", 9, ellip_tdf2_order8_cut5000_f32_ba[0], ellip_tdf2_order8_cut5000_f32_ba[1], NULL, ellip_tdf2_order8_cut5000_f32_kernel},
+    {"ellip_cascade_order8_cut5000_f32_sos", "CASCADE", 4, NULL, NULL, *ellip_cascade_order8_cut5000_f32_sos, ellip_cascade_order8_cut5000_f32_kernel},
+    {"bessel_df1_order2_cut1000_f32_ba", "DF1", 3, bessel_df1_order2_cut1000_f32_ba[0], bessel_df1_order2_cut1000_f32_ba[1], NULL, bessel_df1_order2_cut1000_f32_kernel},
+    {"bessel_df2_order2_cut1000_f32_ba", "DF2", 3, bessel_df2_order2_cut1000_f32_ba[0], bessel_df2_order2_cut1000_f32_ba[1], NULL, bessel_df2_order2_cut1000_f32_kernel},
+    {"bessel_tdf2_order2_cut1000_f32_ba", "TDF2", 3, bessel_tdf2_order2_cut1000_f32_ba[0], bessel_tdf2_order2_cut1000_f32_ba[1], NULL, bessel_tdf2_order2_cut1000_f32_kernel},
+    {"bessel_cascade_order2_cut1000_f32_sos", "CASCADE", 1, NULL, NULL, *bessel_cascade_order2_cut1000_f32_sos, bessel_cascade_order2_cut1000_f32_kernel},
+    {"bessel_df1_order2_cut2000_f32_ba", "DF1", 3, bessel_df1_order2_cut2000_f32_ba[0], bessel_df1_order2_cut2000_f32_ba[1], NULL, bessel_df1_order2_cut2000_f32_kernel},
+    {"bessel_df2_order2_cut2000_f32_ba", "DF2", 3, bessel_df2_order2_cut2000_f32_ba[0], bessel_df2_order2_cut2000_f32_ba[1], NULL, bessel_df2_order2_cut2000_f32_kernel},
+    {"bessel_tdf2_order2_cut2000_f32_ba", "TDF2", 3, bessel_tdf2_order2_cut2000_f32_ba[0], bessel_tdf2_order2_cut2000_f32_ba[1], NULL, bessel_tdf2_order2_cut2000_f32_kernel},
+    {"bessel_cascade_order2_cut2000_f32_sos", "CASCADE", 1, NULL, NULL, *bessel_cascade_order2_cut2000_f32_sos, bessel_cascade_order2_cut2000_f32_kernel},
+    {"bessel_df1_order2_cut5000_f32_ba", "DF1", 3, bessel_df1_order2_cut5000_f32_ba[0], bessel_df1_order2_cut5000_f32_ba[1], NULL, bessel_df1_order2_cut5000_f32_kernel},
+    {"bessel_df2_order2_cut5000_f32_ba", "DF2", 3, bessel_df2_order2_cut5000_f32_ba[0], bessel_df2_order2_cut5000_f32_ba[1], NULL, bessel_df2_order2_cut5000_f32_kernel},
+    {"bessel_tdf2_order2_cut5000_f32_ba", "TDF2", 3, bessel_tdf2_order2_cut5000_f32_ba[0], bessel_tdf2_order2_cut5000_f32_ba[1], NULL, bessel_tdf2_order2_cut5000_f32_kernel},
+    {"bessel_cascade_order2_cut5000_f32_sos", "CASCADE", 1, NULL, NULL, *bessel_cascade_order2_cut5000_f32_sos, bessel_cascade_order2_cut5000_f32_kernel},
+    {"bessel_df1_order4_cut1000_f32_ba", "DF1", 5, bessel_df1_order4_cut1000_f32_ba[0], bessel_df1_order4_cut1000_f32_ba[1], NULL, bessel_df1_order4_cut1000_f32_kernel},
+    {"bessel_df2_order4_cut1000_f32_ba", "DF2", 5, bessel_df2_order4_cut1000_f32_ba[0], bessel_df2_order4_cut1000_f32_ba[1], NULL, bessel_df2_order4_cut1000_f32_kernel},
+    {"bessel_tdf2_order4_cut1000_f32_ba", "TDF2", 5, bessel_tdf2_order4_cut1000_f32_ba[0], bessel_tdf2_order4_cut1000_f32_ba[1], NULL, bessel_tdf2_order4_cut1000_f32_kernel},
+    {"bessel_cascade_order4_cut1000_f32_sos", "CASCADE", 2, NULL, NULL, *bessel_cascade_order4_cut1000_f32_sos, bessel_cascade_order4_cut1000_f32_kernel},
+    {"bessel_df1_order4_cut2000_f32_ba", "DF1", 5, bessel_df1_order4_cut2000_f32_ba[0], bessel_df1_order4_cut2000_f32_ba[1], NULL, bessel_df1_order4_cut2000_f32_kernel},
+    {"bessel_df2_order4_cut2000_f32_ba", "DF2", 5, bessel_df2_order4_cut2000_f32_ba[0], bessel_df2_order4_cut2000_f32_ba[1], NULL, bessel_df2_order4_cut2000_f32_kernel},
+    {"bessel_tdf2_order4_cut2000_f32_ba", "TDF2", 5, bessel_tdf2_order4_cut2000_f32_ba[0], bessel_tdf2_order4_cut2000_f32_ba[1], NULL, bessel_tdf2_order4_cut2000_f32_kernel},
+    {"bessel_cascade_order4_cut2000_f32_sos", "CASCADE", 2, NULL, NULL, *bessel_cascade_order4_cut2000_f32_sos, bessel_cascade_order4_cut2000_f32_kernel},
+    {"bessel_df1_order4_cut5000_f32_ba", "DF1", 5, bessel_df1_order4_cut5000_f32_ba[0], bessel_df1_order4_cut5000_f32_ba[1], NULL, bessel_df1_order4_cut5000_f32_kernel},
+    {"bessel_df2_order4_cut5000_f32_ba", "DF2", 5, bessel_df2_order4_cut5000_f32_ba[0], bessel_df2_order4_cut5000_f32_ba[1], NULL, bessel_df2_order4_cut5000_f32_kernel},
+    {"bessel_tdf2_order4_cut5000_f32_ba", "TDF2", 5, bessel_tdf2_order4_cut5000_f32_ba[0], bessel_tdf2_order4_cut5000_f32_ba[1], NULL, bessel_tdf2_order4_cut5000_f32_kernel},
+    {"bessel_cascade_order4_cut5000_f32_sos", "CASCADE", 2, NULL, NULL, *bessel_cascade_order4_cut5000_f32_sos, bessel_cascade_order4_cut5000_f32_kernel},
+    {"bessel_df1_order6_cut1000_f32_ba", "DF1", 7, bessel_df1_order6_cut1000_f32_ba[0], bessel_df1_order6_cut1000_f32_ba[1], NULL, bessel_df1_order6_cut1000_f32_kernel},
+    {"bessel_df2_order6_cut1000_f32_ba", "DF2", 7, bessel_df2_order6_cut1000_f32_ba[0], bessel_df2_order6_cut1000_f32_ba[1], NULL, bessel_df2_order6_cut1000_f32_kernel},
+    {"bessel_tdf2_order6_cut1000_f32_ba", "TDF2", 7, bessel_tdf2_order6_cut1000_f32_ba[0], bessel_tdf2_order6_cut1000_f32_ba[1], NULL, bessel_tdf2_order6_cut1000_f32_kernel},
+    {"bessel_cascade_order6_cut1000_f32_sos", "CASCADE", 3, NULL, NULL, *bessel_cascade_order6_cut1000_f32_sos, bessel_cascade_order6_cut1000_f32_kernel},
+    {"bessel_df1_order6_cut2000_f32_ba", "DF1", 7, bessel_df1_order6_cut2000_f32_ba[0], bessel_df1_order6_cut2000_f32_ba[1], NULL, bessel_df1_order6_cut2000_f32_kernel},
+    {"bessel_df2_order6_cut2000_f32_ba", "DF2", 7, bessel_df2_order6_cut2000_f32_ba[0], bessel_df2_order6_cut2000_f32_ba[1], NULL, bessel_df2_order6_cut2000_f32_kernel},
+    {"bessel_tdf2_order6_cut2000_f32_ba", "TDF2", 7, bessel_tdf2_order6_cut2000_f32_ba[0], bessel_tdf2_order6_cut2000_f32_ba[1], NULL, bessel_tdf2_order6_cut2000_f32_kernel},
+    {"bessel_cascade_order6_cut2000_f32_sos", "CASCADE", 3, NULL, NULL, *bessel_cascade_order6_cut2000_f32_sos, bessel_cascade_order6_cut2000_f32_kernel},
+    {"bessel_df1_order6_cut5000_f32_ba", "DF1", 7, bessel_df1_order6_cut5000_f32_ba[0], bessel_df1_order6_cut5000_f32_ba[1], NULL, bessel_df1_order6_cut5000_f32_kernel},
+    {"bessel_df2_order6_cut5000_f32_ba", "DF2", 7, bessel_df2_order6_cut5000_f32_ba[0], bessel_df2_order6_cut5000_f32_ba[1], NULL, bessel_df2_order6_cut5000_f32_kernel},
+    {"bessel_tdf2_order6_cut5000_f32_ba", "TDF2", 7, bessel_tdf2_order6_cut5000_f32_ba[0], bessel_tdf2_order6_cut5000_f32_ba[1], NULL, bessel_tdf2_order6_cut5000_f32_kernel},
+    {"bessel_cascade_order6_cut5000_f32_sos", "CASCADE", 3, NULL, NULL, *bessel_cascade_order6_cut5000_f32_sos, bessel_cascade_order6_cut5000_f32_kernel},
+    {"bessel_df1_order8_cut1000_f32_ba", "DF1", 9, bessel_df1_order8_cut1000_f32_ba[0], bessel_df1_order8_cut1000_f32_ba[1], NULL, bessel_df1_order8_cut1000_f32_kernel},
+    {"bessel_df2_order8_cut1000_f32_ba", "DF2", 9, bessel_df2_order8_cut1000_f32_ba[0], bessel_df2_order8_cut1000_f32_ba[1], NULL, bessel_df2_order8_cut1000_f32_kernel},
+    {"bessel_tdf2_order8_cut1000_f32_ba", "TDF2", 9, bessel_tdf2_order8_cut1000_f32_ba[0], bessel_tdf2_order8_cut1000_f32_ba[1], NULL, bessel_tdf2_order8_cut1000_f32_kernel},
+    {"bessel_cascade_order8_cut1000_f32_sos", "CASCADE", 4, NULL, NULL, *bessel_cascade_order8_cut1000_f32_sos, bessel_cascade_order8_cut1000_f32_kernel},
+    {"bessel_df1_order8_cut2000_f32_ba", "DF1", 9, bessel_df1_order8_cut2000_f32_ba[0], bessel_df1_order8_cut2000_f32_ba[1], NULL, bessel_df1_order8_cut2000_f32_kernel},
+    {"bessel_df2_order8_cut2000_f32_ba", "DF2", 9, bessel_df2_order8_cut2000_f32_ba[0], bessel_df2_order8_cut2000_f32_ba[1], NULL, bessel_df2_order8_cut2000_f32_kernel},
+    {"bessel_tdf2_order8_cut2000_f32_ba", "TDF2", 9, bessel_tdf2_order8_cut2000_f32_ba[0], bessel_tdf2_order8_cut2000_f32_ba[1], NULL, bessel_tdf2_order8_cut2000_f32_kernel},
+    {"bessel_cascade_order8_cut2000_f32_sos", "CASCADE", 4, NULL, NULL, *bessel_cascade_order8_cut2000_f32_sos, bessel_cascade_order8_cut2000_f32_kernel},
+    {"bessel_df1_order8_cut5000_f32_ba", "DF1", 9, bessel_df1_order8_cut5000_f32_ba[0], bessel_df1_order8_cut5000_f32_ba[1], NULL, bessel_df1_order8_cut5000_f32_kernel},
+    {"bessel_df2_order8_cut5000_f32_ba", "DF2", 9, bessel_df2_order8_cut5000_f32_ba[0], bessel_df2_order8_cut5000_f32_ba[1], NULL, bessel_df2_order8_cut5000_f32_kernel},
+    {"bessel_tdf2_order8_cut5000_f32_ba", "TDF2", 9, bessel_tdf2_order8_cut5000_f32_ba[0], bessel_tdf2_order8_cut5000_f32_ba[1], NULL, bessel_tdf2_order8_cut5000_f32_kernel},
+    {"bessel_cascade_order8_cut5000_f32_sos", "CASCADE", 4, NULL, NULL, *bessel_cascade_order8_cut5000_f32_sos, bessel_cascade_order8_cut5000_f32_kernel},
+};
+const int NUM_BAKED_KERNELS_F = (int)(sizeof(baked_kernels_f) / sizeof(baked_kernels_f[0]));
+
+baked_kernel_d baked_kernels_d[] = {
+    {"butter_df1_order2_cut1000_f64_ba", "DF1", 3, butter_df1_order2_cut1000_f64_ba[0], butter_df1_order2_cut1000_f64_ba[1], NULL, butter_df1_order2_cut1000_f64_kernel},
+    {"butter_df2_order2_cut1000_f64_ba", "DF2", 3, butter_df2_order2_cut1000_f64_ba[0], butter_df2_order2_cut1000_f64_ba[1], NULL, butter_df2_order2_cut1000_f64_kernel},
+    {"butter_tdf2_order2_cut1000_f64_ba", "TDF2", 3, butter_tdf2_order2_cut1000_f64_ba[0], butter_tdf2_order2_cut1000_f64_ba[1], NULL, butter_tdf2_order2_cut1000_f64_kernel},
+    {"butter_cascade_order2_cut1000_f64_sos", "CASCADE", 1, NULL, NULL, *butter_cascade_order2_cut1000_f64_sos, butter_cascade_order2_cut1000_f64_kernel},
+    {"butter_df1_order2_cut2000_f64_ba", "DF1", 3, butter_df1_order2_cut2000_f64_ba[0], butter_df1_order2_cut2000_f64_ba[1], NULL, butter_df1_order2_cut2000_f64_kernel},
+    {"butter_df2_order2_cut2000_f64_ba", "DF2", 3, butter_df2_order2_cut2000_f64_ba[0], butter_df2_order2_cut2000_f64_ba[1], NULL, butter_df2_order2_cut2000_f64_kernel},
+    {"butter_tdf2_order2_cut2000_f64_ba", "TDF2", 3, butter_tdf2_order2_cut2000_f64_ba[0], butter_tdf2_order2_cut2000_f64_ba[1], NULL, butter_tdf2_order2_cut2000_f64_kernel},
+    {"butter_cascade_order2_cut2000_f64_sos", "CASCADE", 1, NULL, NULL, *butter_cascade_order2_cut2000_f64_sos, butter_cascade_order2_cut2000_f64_kernel},
+    {"butter_df1_order2_cut5000_f64_ba", "DF1", 3, butter_df1_order2_cut5000_f64_ba[0], butter_df1_order2_cut5000_f64_ba[1], NULL, butter_df1_order2_cut5000_f64_kernel},
+    {"butter_df2_order2_cut5000_f64_ba", "DF2", 3, butter_df2_order2_cut5000_f64_ba[0], butter_df2_order2_cut5000_f64_ba[1], NULL, butter_df2_order2_cut5000_f64_kernel},
+    {"butter_tdf2_order2_cut5000_f64_ba", "TDF2", 3, butter_tdf2_order2_cut5000_f64_ba[0], butter_tdf2_order2_cut5000_f64_ba[1], NULL, butter_tdf2_order2_cut5000_f64_kernel},
+    {"butter_cascade_order2_cut5000_f64_sos", "CASCADE", 1, NULL, NULL, *butter_cascade_order2_cut5000_f64_sos, butter_cascade_order2_cut5000_f64_kernel},
+    {"butter_df1_order4_cut1000_f64_ba", "DF1", 5, butter_df1_order4_cut1000_f64_ba[0], butter_df1_order4_cut1000_f64_ba[1], NULL, butter_df1_order4_cut1000_f64_kernel},
+    {"butter_df2_order4_cut1000_f64_ba", "DF2", 5, butter_df2_order4_cut1000_f64_ba[0], butter_df2_order4_cut1000_f64_ba[1], NULL, butter_df2_order4_cut1000_f64_kernel},
+    {"butter_tdf2_order4_cut1000_f64_ba", "TDF2", 5, butter_tdf2_order4_cut1000_f64_ba[0], butter_tdf2_order4_cut1000_f64_ba[1], NULL, butter_tdf2_order4_cut1000_f64_kernel},
+    {"butter_cascade_order4_cut1000_f64_sos", "CASCADE", 2, NULL, NULL, *butter_cascade_order4_cut1000_f64_sos, butter_cascade_order4_cut1000_f64_kernel},
+    {"butter_df1_order4_cut2000_f64_ba", "DF1", 5, butter_df1_order4_cut2000_f64_ba[0], butter_df1_order4_cut2000_f64_ba[1], NULL, butter_df1_order4_cut2000_f64_kernel},
+    {"butter_df2_order4_cut2000_f64_ba", "DF2", 5, butter_df2_order4_cut2000_f64_ba[0], butter_df2_order4_cut2000_f64_ba[1], NULL, butter_df2_order4_cut2000_f64_kernel},
+    {"butter_tdf2_order4_cut2000_f64_ba", "TDF2", 5, butter_tdf2_order4_cut2000_f64_ba[0], butter_tdf2_order4_cut2000_f64_ba[1], NULL, butter_tdf2_order4_cut2000_f64_kernel},
+    {"butter_cascade_order4_cut2000_f64_sos", "CASCADE", 2, NULL, NULL, *butter_cascade_order4_cut2000_f64_sos, butter_cascade_order4_cut2000_f64_kernel},
+    {"butter_df1_order4_cut5000_f64_ba", "DF1", 5, butter_df1_order4_cut5000_f64_ba[0], butter_df1_order4_cut5000_f64_ba[1], NULL, butter_df1_order4_cut5000_f64_kernel},
+    {"butter_df2_order4_cut5000_f64_ba", "DF2", 5, butter_df2_order4_cut5000_f64_ba[0], butter_df2_order4_cut5000_f64_ba[1], NULL, butter_df2_order4_cut5000_f64_kernel},
+    {"butter_tdf2_order4_cut5000_f64_ba", "TDF2", 5, butter_tdf2_order4_cut5000_f64_ba[0], butter_tdf2_order4_cut5000_f64_ba[1], NULL, butter_tdf2_order4_cut5000_f64_kernel},
+    {"butter_cascade_order4_cut5000_f64_sos", "CASCADE", 2, NULL, NULL, *butter_cascade_order4_cut5000_f64_sos, butter_cascade_order4_cut5000_f64_kernel},
+    {"butter_df1_order6_cut1000_f64_ba", "DF1", 7, butter_df1_order6_cut1000_f64_ba[0], butter_df1_order6_cut1000_f64_ba[1], NULL, butter_df1_order6_cut1000_f64_kernel},
+    {"butter_df2_order6_cut1000_f64_ba", "DF2", 7, butter_df2_order6_cut1000_f64_ba[0], butter_df2_order6_cut1000_f64_ba[1], NULL, butter_df2_order6_cut1000_f64_kernel},
+    {"butter_tdf2_order6_cut1000_f64_ba", "TDF2", 7, butter_tdf2_order6_cut1000_f64_ba[0], butter_tdf2_order6_cut1000_f64_ba[1], NULL, butter_tdf2_order6_cut1000_f64_kernel},
+    {"butter_cascade_order6_cut1000_f64_sos", "CASCADE", 3, NULL, NULL, *butter_cascade_order6_cut1000_f64_sos, butter_cascade_order6_cut1000_f64_kernel},
+    {"butter_df1_order6_cut2000_f64_ba", "DF1", 7, butter_df1_order6_cut2000_f64_ba[0], butter_df1_order6_cut2000_f64_ba[1], NULL, butter_df1_order6_cut2000_f64_kernel},
+    {"butter_df2_order6_cut2000_f64_ba", "DF2", 7, butter_df2_order6_cut2000_f64_ba[0], butter_df2_order6_cut2000_f64_ba[1], NULL, butter_df2_order6_cut2000_f64_kernel},
+    {"butter_tdf2_order6_cut2000_f64_ba", "TDF2", 7, butter_tdf2_order6_cut2000_f64_ba[0], butter_tdf2_order6_cut2000_f64_ba[1], NULL, butter_tdf2_order6_cut2000_f64_kernel},
+    {"butter_cascade_order6_cut2000_f64_sos", "CASCADE", 3, NULL, NULL, *butter_cascade_order6_cut2000_f64_sos, butter_cascade_order6_cut2000_f64_kernel},
+    {"butter_df1_order6_cut5000_f64_ba", "DF1", 7, butter_df1_order6_cut5000_f64_ba[0], butter_df1_order6_cut5000_f64_ba[1], NULL, butter_df1_order6_cut5000_f64_kernel},
+    {"butter_df2_order6_cut5000_f64_ba", "DF2", 7, butter_df2_order6_cut5000_f64_ba[0], butter_df2_order6_cut5000_f64_ba[1], NULL, butter_df2_order6_cut5000_f64_kernel},
+    {"butter_tdf2_order6_cut5000_f64_ba", "TDF2", 7, butter_tdf2_order6_cut5000_f64_ba[0], butter_tdf2_order6_cut5000_f64_ba[1], NULL, butter_tdf2_order6_cut5000_f64_kernel},
+    {"butter_cascade_order6_cut5000_f64_sos", "CASCADE", 3, NULL, NULL, *butter_cascade_order6_cut5000_f64_sos, butter_cascade_order6_cut5000_f64_kernel},
+    {"butter_df1_order8_cut1000_f64_ba", "DF1", 9, butter_df1_order8_cut1000_f64_ba[0], butter_df1_order8_cut1000_f64_ba[1], NULL, butter_df1_order8_cut1000_f64_kernel},
+    {"butter_df2_order8_cut1000_f64_ba", "DF2", 9, butter_df2_order8_cut1000_f64_ba[0], butter_df2_order8_cut1000_f64_ba[1], NULL, butter_df2_order8_cut1000_f64_kernel},
+    {"butter_tdf2_order8_cut1000_f64_ba", "TDF2", 9, butter_tdf2_order8_cut1000_f64_ba[0], butter_tdf2_order8_cut1000_f64_ba[1], NULL, butter_tdf2_order8_cut1000_f64_kernel},
+    {"butter_cascade_order8_cut1000_f64_sos", "CASCADE", 4, NULL, NULL, *butter_cascade_order8_cut1000_f64_sos, butter_cascade_order8_cut1000_f64_kernel},
+    {"butter_df1_order8_cut2000_f64_ba", "DF1", 9, butter_df1_order8_cut2000_f64_ba[0], butter_df1_order8_cut2000_f64_ba[1], NULL, butter_df1_order8_cut2000_f64_kernel},
+    {"butter_df2_order8_cut2000_f64_ba", "DF2", 9, butter_df2_order8_cut2000_f64_ba[0], butter_df2_order8_cut2000_f64_ba[1], NULL, butter_df2_order8_cut2000_f64_kernel},
+    {"butter_tdf2_order8_cut2000_f64_ba", "TDF2", 9, butter_tdf2_order8_cut2000_f64_ba[0], butter_tdf2_order8_cut2000_f64_ba[1], NULL, butter_tdf2_order8_cut2000_f64_kernel},
+    {"butter_cascade_order8_cut2000_f64_sos", "CASCADE", 4, NULL, NULL, *butter_cascade_order8_cut2000_f64_sos, butter_cascade_order8_cut2000_f64_kernel},
+    {"butter_df1_order8_cut5000_f64_ba", "DF1", 9, butter_df1_order8_cut5000_f64_ba[0], butter_df1_order8_cut5000_f64_ba[1], NULL, butter_df1_order8_cut5000_f64_kernel},
+    {"butter_df2_order8_cut5000_f64_ba", "DF2", 9, butter_df2_order8_cut5000_f64_ba[0], butter_df2_order8_cut5000_f64_ba[1], NULL, butter_df2_order8_cut5000_f64_kernel},
+    {"butter_tdf2_order8_cut5000_f64_ba", "TDF2", 9, butter_tdf2_order8_cut5000_f64_ba[0], butter_tdf2_order8_cut5000_f64_ba[1], NULL, butter_tdf2_order8_cut5000_f64_kernel},
+    {"butter_cascade_order8_cut5000_f64_sos", "CASCADE", 4, NULL, NULL, *butter_cascade_order8_cut5000_f64_sos, butter_cascade_order8_cut5000_f64_kernel},
+    {"cheby1_df1_order2_cut1000_f64_ba", "DF1", 3, cheby1_df1_order2_cut1000_f64_ba[0], cheby1_df1_order2_cut1000_f64_ba[1], NULL, cheby1_df1_order2_cut1000_f64_kernel},
+    {"cheby1_df2_order2_cut1000_f64_ba", "DF2", 3, cheby1_df2_order2_cut1000_f64_ba[0], cheby1_df2_order2_cut1000_f64_ba[1], NULL, cheby1_df2_order2_cut1000_f64_kernel},
+    {"cheby1_tdf2_order2_cut1000_f64_ba", "TDF2", 3, cheby1_tdf2_order2_cut1000_f64_ba[0], cheby1_tdf2_order2_cut1000_f64_ba[1], NULL, cheby1_tdf2_order2_cut1000_f64_kernel},
+    {"cheby1_cascade_order2_cut1000_f64_sos", "CASCADE", 1, NULL, NULL, *cheby1_cascade_order2_cut1000_f64_sos, cheby1_cascade_order2_cut1000_f64_kernel},
+    {"cheby1_df1_order2_cut2000_f64_ba", "DF1", 3, cheby1_df1_order2_cut2000_f64_ba[0], cheby1_df1_order2_cut2000_f64_ba[1], NULL, cheby1_df1_order2_cut2000_f64_kernel},
+    {"cheby1_df2_order2_cut2000_f64_ba", "DF2", 3, cheby1_df2_order2_cut2000_f64_ba[0], cheby1_df2_order2_cut2000_f64_ba[1], NULL, cheby1_df2_order2_cut2000_f64_kernel},
+    {"cheby1_tdf2_order2_cut2000_f64_ba", "TDF2", 3, cheby1_tdf2_order2_cut2000_f64_ba[0], cheby1_tdf2_order2_cut2000_f64_ba[1], NULL, cheby1_tdf2_order2_cut2000_f64_kernel},
+    {"cheby1_cascade_order2_cut2000_f64_sos", "CASCADE", 1, NULL, NULL, *cheby1_cascade_order2_cut2000_f64_sos, cheby1_cascade_order2_cut2000_f64_kernel},
+    {"cheby1_df1_order2_cut5000_f64_ba", "DF1", 3, cheby1_df1_order2_cut5000_f64_ba[0], cheby1_df1_order2_cut5000_f64_ba[1], NULL, cheby1_df1_order2_cut5000_f64_kernel},
+    {"cheby1_df2_order2_cut5000_f64_ba", "DF2", 3, cheby1_df2_order2_cut5000_f64_ba[0], cheby1_df2_order2_cut5000_f64_ba[1], NULL, cheby1_df2_order2_cut5000_f64_kernel},
+    {"cheby1_tdf2_order2_cut5000_f64_ba", "TDF2", 3, cheby1_tdf2_order2_cut5000_f64_ba[0], cheby1_tdf2_order2_cut5000_f64_ba[1], NULL, cheby1_tdf2_order2_cut5000_f64_kernel},
+    {"cheby1_cascade_order2_cut5000_f64_sos", "CASCADE", 1, NULL, NULL, *cheby1_cascade_order2_cut5000_f64_sos, cheby1_cascade_order2_cut5000_f64_kernel},
+    {"cheby1_df1_order4_cut1000_f64_ba", "DF1", 5, cheby1_df1_order4_cut1000_f64_ba[0], cheby1_df1_order4_cut1000_f64_ba[1], NULL, cheby1_df1_order4_cut1000_f64_kernel},
+    {"cheby1_df2_order4_cut1000_f64_ba", "DF2", 5, cheby1_df2_order4_cut1000_f64_ba[0], cheby1_df2_order4_cut1000_f64_ba[1], NULL, cheby1_df2_order4_cut1000_f64_kernel},
+    {"cheby1_tdf2_order4_cut1000_f64_ba", "TDF2", 5, cheby1_tdf2_order4_cut1000_f64_ba[0], cheby1_tdf2_order4_cut1000_f64_ba[1], NULL, cheby1_tdf2_order4_cut1000_f64_kernel},
+    {"cheby1_cascade_order4_cut1000_f64_sos", "CASCADE", 2, NULL, NULL, *cheby1_cascade_order4_cut1000_f64_sos, cheby1_cascade_order4_cut1000_f64_kernel},
+    {"cheby1_df1_order4_cut2000_f64_ba", "DF1", 5, cheby1_df1_order4_cut2000_f64_ba[0], cheby1_df1_order4_cut2000_f64_ba[1], NULL, cheby1_df1_order4_cut2000_f64_kernel},
+    {"cheby1_df2_order4_cut2000_f64_ba", "DF2", 5, cheby1_df2_order4_cut2000_f64_ba[0], cheby1_df2_order4_cut2000_f64_ba[1], NULL, cheby1_df2_order4_cut2000_f64_kernel},
+    {"cheby1_tdf2_order4_cut2000_f64_ba", "TDF2", 5, cheby1_tdf2_order4_cut2000_f64_ba[0], cheby1_tdf2_order4_cut2000_f64_ba[1], NULL, cheby1_tdf2_order4_cut2000_f64_kernel},
+    {"cheby1_cascade_order4_cut2000_f64_sos", "CASCADE", 2, NULL, NULL, *cheby1_cascade_order4_cut2000_f64_sos, cheby1_cascade_order4_cut2000_f64_kernel},
+    {"cheby1_df1_order4_cut5000_f64_ba", "DF1", 5, cheby1_df1_order4_cut5000_f64_ba[0], cheby1_df1_order4_cut5000_f64_ba[1], NULL, cheby1_df1_order4_cut5000_f64_kernel},
+    {"cheby1_df2_order4_cut5000_f64_ba", "DF2", 5, cheby1_df2_order4_cut5000_f64_ba[0], cheby1_df2_order4_cut5000_f64_ba[1], NULL, cheby1_df2_order4_cut5000_f64_kernel},
+    {"cheby1_tdf2_order4_cut5000_f64_ba", "TDF2", 5, cheby1_tdf2_order4_cut5000_f64_ba[0], cheby1_tdf2_order4_cut5000_f64_ba[1], NULL, cheby1_tdf2_order4_cut5000_f64_kernel},
+    {"cheby1_cascade_order4_cut5000_f64_sos", "CASCADE", 2, NULL, NULL, *cheby1_cascade_order4_cut5000_f64_sos, cheby1_cascade_order4_cut5000_f64_kernel},
+    {"cheby1_df1_order6_cut1000_f64_ba", "DF1", 7, cheby1_df1_order6_cut1000_f64_ba[0], cheby1_df1_order6_cut1000_f64_ba[1], NULL, cheby1_df1_order6_cut1000_f64_kernel},
+    {"cheby1_df2_order6_cut1000_f64_ba", "DF2", 7, cheby1_df2_order6_cut1000_f64_ba[0], cheby1_df2_order6_cut1000_f64_ba[1], NULL, cheby1_df2_order6_cut1000_f64_kernel},
+    {"cheby1_tdf2_order6_cut1000_f64_ba", "TDF2", 7, cheby1_tdf2_order6_cut1000_f64_ba[0], cheby1_tdf2_order6_cut1000_f64_ba[1], NULL, cheby1_tdf2_order6_cut1000_f64_kernel},
+    {"cheby1_cascade_order6_cut1000_f64_sos", "CASCADE", 3, NULL, NULL, *cheby1_cascade_order6_cut1000_f64_sos, cheby1_cascade_order6_cut1000_f64_kernel},
+    {"cheby1_df1_order6_cut2000_f64_ba", "DF1", 7, cheby1_df1_order6_cut2000_f64_ba[0], cheby1_df1_order6_cut2000_f64_ba[1], NULL, cheby1_df1_order6_cut2000_f64_kernel},
+    {"cheby1_df2_order6_cut2000_f64_ba", "DF2", 7, cheby1_df2_order6_cut2000_f64_ba[0], cheby1_df2_order6_cut2000_f64_ba[1], NULL, cheby1_df2_order6_cut2000_f64_kernel},
+    {"cheby1_tdf2_order6_cut2000_f64_ba", "TDF2", 7, cheby1_tdf2_order6_cut2000_f64_ba[0], cheby1_tdf2_order6_cut2000_f64_ba[1], NULL, cheby1_tdf2_order6_cut2000_f64_kernel},
+    {"cheby1_cascade_order6_cut2000_f64_sos", "CASCADE", 3, NULL, NULL, *cheby1_cascade_order6_cut2000_f64_sos, cheby1_cascade_order6_cut2000_f64_kernel},
+    {"cheby1_df1_order6_cut5000_f64_ba", "DF1", 7, cheby1_df1_order6_cut5000_f64_ba[0], cheby1_df1_order6_cut5000_f64_ba[1], NULL, cheby1_df1_order6_cut5000_f64_kernel},
+    {"cheby1_df2_order6_cut5000_f64_ba", "DF2", 7, cheby1_df2_order6_cut5000_f64_ba[0], cheby1_df2_order6_cut5000_f64_ba[1], NULL, cheby1_df2_order6_cut5000_f64_kernel},
+    {"cheby1_tdf2_order6_cut5000_f64_ba", "TDF2", 7, cheby1_tdf2_order6_cut5000_f64_ba[0], cheby1_tdf2_order6_cut5000_f64_ba[1], NULL, cheby1_tdf2_order6_cut5000_f64_kernel},
+    {"cheby1_cascade_order6_cut5000_f64_sos", "CASCADE", 3, NULL, NULL, *cheby1_cascade_order6_cut5000_f64_sos, cheby1_cascade_order6_cut5000_f64_kernel},
+    {"cheby1_df1_order8_cut1000_f64_ba", "DF1", 9, cheby1_df1_order8_cut1000_f64_ba[0], cheby1_df1_order8_cut1000_f64_ba[1], NULL, cheby1_df1_order8_cut1000_f64_kernel},
+    {"cheby1_df2_order8_cut1000_f64_ba", "DF2", 9, cheby1_df2_order8_cut1000_f64_ba[0], cheby1_df2_order8_cut1000_f64_ba[1], NULL, cheby1_df2_order8_cut1000_f64_kernel},
+    {"cheby1_tdf2_order8_cut1000_f64_ba", "TDF2", 9, cheby1_tdf2_order8_cut1000_f64_ba[0], cheby1_tdf2_order8_cut1000_f64_ba[1], NULL, cheby1_tdf2_order8_cut1000_f64_kernel},
+    {"cheby1_cascade_order8_cut1000_f64_sos", "CASCADE", 4, NULL, NULL, *cheby1_cascade_order8_cut1000_f64_sos, cheby1_cascade_order8_cut1000_f64_kernel},
+    {"cheby1_df1_order8_cut2000_f64_ba", "DF1", 9, cheby1_df1_order8_cut2000_f64_ba[0], cheby1_df1_order8_cut2000_f64_ba[1], NULL, cheby1_df1_order8_cut2000_f64_kernel},
+    {"cheby1_df2_order8_cut2000_f64_ba", "DF2", 9, cheby1_df2_order8_cut2000_f64_ba[0], cheby1_df2_order8_cut2000_f64_ba[1], NULL, cheby1_df2_order8_cut2000_f64_kernel},
+    {"cheby1_tdf2_order8_cut2000_f64_ba", "TDF2", 9, cheby1_tdf2_order8_cut2000_f64_ba[0], cheby1_tdf2_order8_cut2000_f64_ba[1], NULL, cheby1_tdf2_order8_cut2000_f64_kernel},
+    {"cheby1_cascade_order8_cut2000_f64_sos", "CASCADE", 4, NULL, NULL, *cheby1_cascade_order8_cut2000_f64_sos, cheby1_cascade_order8_cut2000_f64_kernel},
+    {"cheby1_df1_order8_cut5000_f64_ba", "DF1", 9, cheby1_df1_order8_cut5000_f64_ba[0], cheby1_df1_order8_cut5000_f64_ba[1], NULL, cheby1_df1_order8_cut5000_f64_kernel},
+    {"cheby1_df2_order8_cut5000_f64_ba", "DF2", 9, cheby1_df2_order8_cut5000_f64_ba[0], cheby1_df2_order8_cut5000_f64_ba[1], NULL, cheby1_df2_order8_cut5000_f64_kernel},
+    {"cheby1_tdf2_order8_cut5000_f64_ba", "TDF2", 9, cheby1_tdf2_order8_cut5000_f64_ba[0], cheby1_tdf2_order8_cut5000_f64_ba[1], NULL, cheby1_tdf2_order8_cut5000_f64_kernel},
+    {"cheby1_cascade_order8_cut5000_f64_sos", "CASCADE", 4, NULL, NULL, *cheby1_cascade_order8_cut5000_f64_sos, cheby1_cascade_order8_cut5000_f64_kernel},
+    {"cheby2_df1_order2_cut1000_f64_ba", "DF1", 3, cheby2_df1_order2_cut1000_f64_ba[0], cheby2_df1_order2_cut1000_f64_ba[1], NULL, cheby2_df1_order2_cut1000_f64_kernel},
+    {"cheby2_df2_order2_cut1000_f64_ba", "DF2", 3, cheby2_df2_order2_cut1000_f64_ba[0], cheby2_df2_order2_cut1000_f64_ba[1], NULL, cheby2_df2_order2_cut1000_f64_kernel},
+    {"cheby2_tdf2_order2_cut1000_f64_ba", "TDF2", 3, cheby2_tdf2_order2_cut1000_f64_ba[0], cheby2_tdf2_order2_cut1000_f64_ba[1], NULL, cheby2_tdf2_order2_cut1000_f64_kernel},
+    {"cheby2_cascade_order2_cut1000_f64_sos", "CASCADE", 1, NULL, NULL, *cheby2_cascade_order2_cut1000_f64_sos, cheby2_cascade_order2_cut1000_f64_kernel},
+    {"cheby2_df1_order2_cut2000_f64_ba", "DF1", 3, cheby2_df1_order2_cut2000_f64_ba[0], cheby2_df1_order2_cut2000_f64_ba[1], NULL, cheby2_df1_order2_cut2000_f64_kernel},
+    {"cheby2_df2_order2_cut2000_f64_ba", "DF2", 3, cheby2_df2_order2_cut2000_f64_ba[0], cheby2_df2_order2_cut2000_f64_ba[1], NULL, cheby2_df2_order2_cut2000_f64_kernel},
+    {"cheby2_tdf2_order2_cut2000_f64_ba", "TDF2", 3, cheby2_tdf2_order2_cut2000_f64_ba[0], cheby2_tdf2_order2_cut2000_f64_ba[1], NULL, cheby2_tdf2_order2_cut2000_f64_kernel},
+    {"cheby2_cascade_order2_cut2000_f64_sos", "CASCADE", 1, NULL, NULL, *cheby2_cascade_order2_cut2000_f64_sos, cheby2_cascade_order2_cut2000_f64_kernel},
+    {"cheby2_df1_order2_cut5000_f64_ba", "DF1", 3, cheby2_df1_order2_cut5000_f64_ba[0], cheby2_df1_order2_cut5000_f64_ba[1], NULL, cheby2_df1_order2_cut5000_f64_kernel},
+    {"cheby2_df2_order2_cut5000_f64_ba", "DF2", 3, cheby2_df2_order2_cut5000_f64_ba[0], cheby2_df2_order2_cut5000_f64_ba[1], NULL, cheby2_df2_order2_cut5000_f64_kernel},
+    {"cheby2_tdf2_order2_cut5000_f64_ba", "TDF2", 3, cheby2_tdf2_order2_cut5000_f64_ba[0], cheby2_tdf2_order2_cut5000_f64_ba[1], NULL, cheby2_tdf2_order2_cut5000_f64_kernel},
+    {"cheby2_cascade_order2_cut5000_f64_sos", "CASCADE", 1, NULL, NULL, *cheby2_cascade_order2_cut5000_f64_sos, cheby2_cascade_order2_cut5000_f64_kernel},
+    {"cheby2_df1_order4_cut1000_f64_ba", "DF1", 5, cheby2_df1_order4_cut1000_f64_ba[0], cheby2_df1_order4_cut1000_f64_ba[1], NULL, cheby2_df1_order4_cut1000_f64_kernel},
+    {"cheby2_df2_order4_cut1000_f64_ba", "DF2", 5, cheby2_df2_order4_cut1000_f64_ba[0], cheby2_df2_order4_cut1000_f64_ba[1], NULL, cheby2_df2_order4_cut1000_f64_kernel},
+    {"cheby2_tdf2_order4_cut1000_f64_ba", "TDF2", 5, cheby2_tdf2_order4_cut1000_f64_ba[0], cheby2_tdf2_order4_cut1000_f64_ba[1], NULL, cheby2_tdf2_order4_cut1000_f64_kernel},
+    {"cheby2_cascade_order4_cut1000_f64_sos", "CASCADE", 2, NULL, NULL, *cheby2_cascade_order4_cut1000_f64_sos, cheby2_cascade_order4_cut1000_f64_kernel},
+    {"cheby2_df1_order4_cut2000_f64_ba", "DF1", 5, cheby2_df1_order4_cut2000_f64_ba[0], cheby2_df1_order4_cut2000_f64_ba[1], NULL, cheby2_df1_order4_cut2000_f64_kernel},
+    {"cheby2_df2_order4_cut2000_f64_ba", "DF2", 5, cheby2_df2_order4_cut2000_f64_ba[0], cheby2_df2_order4_cut2000_f64_ba[1], NULL, cheby2_df2_order4_cut2000_f64_kernel},
+    {"cheby2_tdf2_order4_cut2000_f64_ba", "TDF2", 5, cheby2_tdf2_order4_cut2000_f64_ba[0], cheby2_tdf2_order4_cut2000_f64_ba[1], NULL, cheby2_tdf2_order4_cut2000_f64_kernel},
+    {"cheby2_cascade_order4_cut2000_f64_sos", "CASCADE", 2, NULL, NULL, *cheby2_cascade_order4_cut2000_f64_sos, cheby2_cascade_order4_cut2000_f64_kernel},
+    {"cheby2_df1_order4_cut5000_f64_ba", "DF1", 5, cheby2_df1_order4_cut5000_f64_ba[0], cheby2_df1_order4_cut5000_f64_ba[1], NULL, cheby2_df1_order4_cut5000_f64_kernel},
+    {"cheby2_df2_order4_cut5000_f64_ba", "DF2", 5, cheby2_df2_order4_cut5000_f64_ba[0], cheby2_df2_order4_cut5000_f64_ba[1], NULL, cheby2_df2_order4_cut5000_f64_kernel},
+    {"cheby2_tdf2_order4_cut5000_f64_ba", "TDF2", 5, cheby2_tdf2_order4_cut5000_f64_ba[0], cheby2_tdf2_order4_cut5000_f64_ba[1], NULL, cheby2_tdf2_order4_cut5000_f64_kernel},
+    {"cheby2_cascade_order4_cut5000_f64_sos", "CASCADE", 2, NULL, NULL, *cheby2_cascade_order4_cut5000_f64_sos, cheby2_cascade_order4_cut5000_f64_kernel},
+    {"cheby2_df1_order6_cut1000_f64_ba", "DF1", 7, cheby2_df1_order6_cut1000_f64_ba[0], cheby2_df1_order6_cut1000_f64_ba[1], NULL, cheby2_df1_order6_cut1000_f64_kernel},
+    {"cheby2_df2_order6_cut1000_f64_ba", "DF2", 7, cheby2_df2_order6_cut1000_f64_ba[0], cheby2_df2_order6_cut1000_f64_ba[1], NULL, cheby2_df2_order6_cut1000_f64_kernel},
+    {"cheby2_tdf2_order6_cut1000_f64_ba", "TDF2", 7, cheby2_tdf2_order6_cut1000_f64_ba[0], cheby2_tdf2_order6_cut1000_f64_ba[1], NULL, cheby2_tdf2_order6_cut1000_f64_kernel},
+    {"cheby2_cascade_order6_cut1000_f64_sos", "CASCADE", 3, NULL, NULL, *cheby2_cascade_order6_cut1000_f64_sos, cheby2_cascade_order6_cut1000_f64_kernel},
+    {"cheby2_df1_order6_cut2000_f64_ba", "DF1", 7, cheby2_df1_order6_cut2000_f64_ba[0], cheby2_df1_order6_cut2000_f64_ba[1], NULL, cheby2_df1_order6_cut2000_f64_kernel},
+    {"cheby2_df2_order6_cut2000_f64_ba", "DF2", 7, cheby2_df2_order6_cut2000_f64_ba[0], cheby2_df2_order6_cut2000_f64_ba[1], NULL, cheby2_df2_order6_cut2000_f64_kernel},
+    {"cheby2_tdf2_order6_cut2000_f64_ba", "TDF2", 7, cheby2_tdf2_order6_cut2000_f64_ba[0], cheby2_tdf2_order6_cut2000_f64_ba[1], NULL, cheby2_tdf2_order6_cut2000_f64_kernel},
+    {"cheby2_cascade_order6_cut2000_f64_sos", "CASCADE", 3, NULL, NULL, *cheby2_cascade_order6_cut2000_f64_sos, cheby2_cascade_order6_cut2000_f64_kernel},
+    {"cheby2_df1_order6_cut5000_f64_ba", "DF1", 7, cheby2_df1_order6_cut5000_f64_ba[0], cheby2_df1_order6_cut5000_f64_ba[1], NULL, cheby2_df1_order6_cut5000_f64_kernel},
+    {"cheby2_df2_order6_cut5000_f64_ba", "DF2", 7, cheby2_df2_order6_cut5000_f64_ba[0], cheby2_df2_order6_cut5000_f64_ba[1], NULL, cheby2_df2_order6_cut5000_f64_kernel},
+    {"cheby2_tdf2_order6_cut5000_f64_ba", "TDF2", 7, cheby2_tdf2_order6_cut5000_f64_ba[0], cheby2_tdf2_order6_cut5000_f64_ba[1], NULL, cheby2_tdf2_order6_cut5000_f64_kernel},
+    {"cheby2_cascade_order6_cut5000_f64_sos", "CASCADE", 3, NULL, NULL, *cheby2_cascade_order6_cut5000_f64_sos, cheby2_cascade_order6_cut5000_f64_kernel},
+    {"cheby2_df1_order8_cut1000_f64_ba", "DF1", 9, cheby2_df1_order8_cut1000_f64_ba[0], cheby2_df1_order8_cut1000_f64_ba[1], NULL, cheby2_df1_order8_cut1000_f64_kernel},
+    {"cheby2_df2_order8_cut1000_f64_ba", "DF2", 9, cheby2_df2_order8_cut1000_f64_ba[0], cheby2_df2_order8_cut1000_f64_ba[1], NULL, cheby2_df2_order8_cut1000_f64_kernel},
+    {"cheby2_tdf2_order8_cut1000_f64_ba", "TDF2", 9, cheby2_tdf2_order8_cut1000_f64_ba[0], cheby2_tdf2_order8_cut1000_f64_ba[1], NULL, cheby2_tdf2_order8_cut1000_f64_kernel},
+    {"cheby2_cascade_order8_cut1000_f64_sos", "CASCADE", 4, NULL, NULL, *cheby2_cascade_order8_cut1000_f64_sos, cheby2_cascade_order8_cut1000_f64_kernel},
+    {"cheby2_df1_order8_cut2000_f64_ba", "DF1", 9, cheby2_df1_order8_cut2000_f64_ba[0], cheby2_df1_order8_cut2000_f64_ba[1], NULL, cheby2_df1_order8_cut2000_f64_kernel},
+    {"cheby2_df2_order8_cut2000_f64_ba", "DF2", 9, cheby2_df2_order8_cut2000_f64_ba[0], cheby2_df2_order8_cut2000_f64_ba[1], NULL, cheby2_df2_order8_cut2000_f64_kernel},
+    {"cheby2_tdf2_order8_cut2000_f64_ba", "TDF2", 9, cheby2_tdf2_order8_cut2000_f64_ba[0], cheby2_tdf2_order8_cut2000_f64_ba[1], NULL, cheby2_tdf2_order8_cut2000_f64_kernel},
+    {"cheby2_cascade_order8_cut2000_f64_sos", "CASCADE", 4, NULL, NULL, *cheby2_cascade_order8_cut2000_f64_sos, cheby2_cascade_order8_cut2000_f64_kernel},
+    {"cheby2_df1_order8_cut5000_f64_ba", "DF1", 9, cheby2_df1_order8_cut5000_f64_ba[0], cheby2_df1_order8_cut5000_f64_ba[1], NULL, cheby2_df1_order8_cut5000_f64_kernel},
+    {"cheby2_df2_order8_cut5000_f64_ba", "DF2", 9, cheby2_df2_order8_cut5000_f64_ba[0], cheby2_df2_order8_cut5000_f64_ba[1], NULL, cheby2_df2_order8_cut5000_f64_kernel},
+    {"cheby2_tdf2_order8_cut5000_f64_ba", "TDF2", 9, cheby2_tdf2_order8_cut5000_f64_ba[0], cheby2_tdf2_order8_cut5000_f64_ba[1], NULL, cheby2_tdf2_order8_cut5000_f64_kernel},
+    {"cheby2_cascade_order8_cut5000_f64_sos", "CASCADE", 4, NULL, NULL, *cheby2_cascade_order8_cut5000_f64_sos, cheby2_cascade_order8_cut5000_f64_kernel},
+    {"ellip_df1_order2_cut1000_f64_ba", "DF1", 3, ellip_df1_order2_cut1000_f64_ba[0], ellip_df1_order2_cut1000_f64_ba[1], NULL, ellip_df1_order2_cut1000_f64_kernel},
+    {"ellip_df2_order2_cut1000_f64_ba", "DF2", 3, ellip_df2_order2_cut1000_f64_ba[0], ellip_df2_order2_cut1000_f64_ba[1], NULL, ellip_df2_order2_cut1000_f64_kernel},
+    {"ellip_tdf2_order2_cut1000_f64_ba", "TDF2", 3, ellip_tdf2_order2_cut1000_f64_ba[0], ellip_tdf2_order2_cut1000_f64_ba[1], NULL, ellip_tdf2_order2_cut1000_f64_kernel},
+    {"ellip_cascade_order2_cut1000_f64_sos", "CASCADE", 1, NULL, NULL, *ellip_cascade_order2_cut1000_f64_sos, ellip_cascade_order2_cut1000_f64_kernel},
+    {"ellip_df1_order2_cut2000_f64_ba", "DF1", 3, ellip_df1_order2_cut2000_f64_ba[0], ellip_df1_order2_cut2000_f64_ba[1], NULL, ellip_df1_order2_cut2000_f64_kernel},
+    {"ellip_df2_order2_cut2000_f64_ba", "DF2", 3, ellip_df2_order2_cut2000_f64_ba[0], ellip_df2_order2_cut2000_f64_ba[1], NULL, ellip_df2_order2_cut2000_f64_kernel},
+    {"ellip_tdf2_order2_cut2000_f64_ba", "TDF2", 3, ellip_tdf2_order2_cut2000_f64_ba[0], ellip_tdf2_order2_cut2000_f64_ba[1], NULL, ellip_tdf2_order2_cut2000_f64_kernel},
+    {"ellip_cascade_order2_cut2000_f64_sos", "CASCADE", 1, NULL, NULL, *ellip_cascade_order2_cut2000_f64_sos, ellip_cascade_order2_cut2000_f64_kernel},
+    {"ellip_df1_order2_cut5000_f64_ba", "DF1", 3, ellip_df1_order2_cut5000_f64_ba[0], ellip_df1_order2_cut5000_f64_ba[1], NULL, ellip_df1_order2_cut5000_f64_kernel},
+    {"ellip_df2_order2_cut5000_f64_ba", "DF2", 3, ellip_df2_order2_cut5000_f64_ba[0], ellip_df2_order2_cut5000_f64_ba[1], NULL, ellip_df2_order2_cut5000_f64_kernel},
+    {"ellip_tdf2_order2_cut5000_f64_ba", "TDF2", 3, ellip_tdf2_order2_cut5000_f64_ba[0], ellip_tdf2_order2_cut5000_f64_ba[1], NULL, ellip_tdf2_order2_cut5000_f64_kernel},
+    {"ellip_cascade_order2_cut5000_f64_sos", "CASCADE", 1, NULL, NULL, *ellip_cascade_order2_cut5000_f64_sos, ellip_cascade_order2_cut5000_f64_kernel},
+    {"ellip_df1_order4_cut1000_f64_ba", "DF1", 5, ellip_df1_order4_cut1000_f64_ba[0], ellip_df1_order4_cut1000_f64_ba[1], NULL, ellip_df1_order4_cut1000_f64_kernel},
+    {"ellip_df2_order4_cut1000_f64_ba", "DF2", 5, ellip_df2_order4_cut1000_f64_ba[0], ellip_df2_order4_cut1000_f64_ba[1], NULL, ellip_df2_order4_cut1000_f64_kernel},
+    {"ellip_tdf2_order4_cut1000_f64_ba", "TDF2", 5, ellip_tdf2_order4_cut1000_f64_ba[0], ellip_tdf2_order4_cut1000_f64_ba[1], NULL, ellip_tdf2_order4_cut1000_f64_kernel},
+    {"ellip_cascade_order4_cut1000_f64_sos", "CASCADE", 2, NULL, NULL, *ellip_cascade_order4_cut1000_f64_sos, ellip_cascade_order4_cut1000_f64_kernel},
+    {"ellip_df1_order4_cut2000_f64_ba", "DF1", 5, ellip_df1_order4_cut2000_f64_ba[0], ellip_df1_order4_cut2000_f64_ba[1], NULL, ellip_df1_order4_cut2000_f64_kernel},
+    {"ellip_df2_order4_cut2000_f64_ba", "DF2", 5, ellip_df2_order4_cut2000_f64_ba[0], ellip_df2_order4_cut2000_f64_ba[1], NULL, ellip_df2_order4_cut2000_f64_kernel},
+    {"ellip_tdf2_order4_cut2000_f64_ba", "TDF2", 5, ellip_tdf2_order4_cut2000_f64_ba[0], ellip_tdf2_order4_cut2000_f64_ba[1], NULL, ellip_tdf2_order4_cut2000_f64_kernel},
+    {"ellip_cascade_order4_cut2000_f64_sos", "CASCADE", 2, NULL, NULL, *ellip_cascade_order4_cut2000_f64_sos, ellip_cascade_order4_cut2000_f64_kernel},
+    {"ellip_df1_order4_cut5000_f64_ba", "DF1", 5, ellip_df1_order4_cut5000_f64_ba[0], ellip_df1_order4_cut5000_f64_ba[1], NULL, ellip_df1_order4_cut5000_f64_kernel},
+    {"ellip_df2_order4_cut5000_f64_ba", "DF2", 5, ellip_df2_order4_cut5000_f64_ba[0], ellip_df2_order4_cut5000_f64_ba[1], NULL, ellip_df2_order4_cut5000_f64_kernel},
+    {"ellip_tdf2_order4_cut5000_f64_ba", "TDF2", 5, ellip_tdf2_order4_cut5000_f64_ba[0], ellip_tdf2_order4_cut5000_f64_ba[1], NULL, ellip_tdf2_order4_cut5000_f64_kernel},
+    {"ellip_cascade_order4_cut5000_f64_sos", "CASCADE", 2, NULL, NULL, *ellip_cascade_order4_cut5000_f64_sos, ellip_cascade_order4_cut5000_f64_kernel},
+    {"ellip_df1_order6_cut1000_f64_ba", "DF1", 7, ellip_df1_order6_cut1000_f64_ba[0], ellip_df1_order6_cut1000_f64_ba[1], NULL, ellip_df1_order6_cut1000_f64_kernel},
+    {"ellip_df2_order6_cut1000_f64_ba", "DF2", 7, ellip_df2_order6_cut1000_f64_ba[0], ellip_df2_order6_cut1000_f64_ba[1], NULL, ellip_df2_order6_cut1000_f64_kernel},
+    {"ellip_tdf2_order6_cut1000_f64_ba", "TDF2", 7, ellip_tdf2_order6_cut1000_f64_ba[0], ellip_tdf2_order6_cut1000_f64_ba[1], NULL, ellip_tdf2_order6_cut1000_f64_kernel},
+    {"ellip_cascade_order6_cut1000_f64_sos", "CASCADE", 3, NULL, NULL, *ellip_cascade_order6_cut1000_f64_sos, ellip_cascade_order6_cut1000_f64_kernel},
+    {"ellip_df1_order6_cut2000_f64_ba", "DF1", 7, ellip_df1_order6_cut2000_f64_ba[0], ellip_df1_order6_cut2000_f64_ba[1], NULL, ellip_df1_order6_cut2000_f64_kernel},
+    {"ellip_df2_order6_cut2000_f64_ba", "DF2", 7, ellip_df2_order6_cut2000_f64_ba[0], ellip_df2_order6_cut2000_f64_ba[1], NULL, ellip_df2_order6_cut2000_f64_kernel},
+    {"ellip_tdf2_order6_cut2000_f64_ba", "TDF2", 7, ellip_tdf2_order6_cut2000_f64_ba[0], ellip_tdf2_order6_cut2000_f64_ba[1], NULL, ellip_tdf2_order6_cut2000_f64_kernel},
+    {"ellip_cascade_order6_cut2000_f64_sos", "CASCADE", 3, NULL, NULL, *ellip_cascade_order6_cut2000_f64_sos, ellip_cascade_order6_cut2000_f64_kernel},
+    {"ellip_df1_order6_cut5000_f64_ba", "DF1", 7, ellip_df1_order6_cut5000_f64_ba[0], ellip_df1_order6_cut5000_f64_ba[1], NULL, ellip_df1_order6_cut5000_f64_kernel},
+    {"ellip_df2_order6_cut5000_f64_ba", "DF2", 7, ellip_df2_order6_cut5000_f64_ba[0], ellip_df2_order6_cut5000_f64_ba[1], NULL, ellip_df2_order6_cut5000_f64_kernel},
+    {"ellip_tdf2_order6_cut5000_f64_ba", "TDF2", 7, ellip_tdf2_order6_cut5000_f64_ba[0], ellip_tdf2_order6_cut5000_f64_ba[1], NULL, ellip_tdf2_order6_cut5000_f64_kernel},
+    {"ellip_cascade_order6_cut5000_f64_sos", "CASCADE", 3, NULL, NULL, *ellip_cascade_order6_cut5000_f64_sos, ellip_cascade_order6_cut5000_f64_kernel},
+    {"ellip_df1_order8_cut1000_f64_ba", "DF1", 9, ellip_df1_order8_cut1000_f64_ba[0], ellip_df1_order8_cut1000_f64_ba[1], NULL, ellip_df1_order8_cut1000_f64_kernel},
+    {"ellip_df2_order8_cut1000_f64_ba", "DF2", 9, ellip_df2_order8_cut1000_f64_ba[0], ellip_df2_order8_cut1000_f64_ba[1], NULL, ellip_df2_order8_cut1000_f64_kernel},
+    {"ellip_tdf2_order8_cut1000_f64_ba", "TDF2", 9, ellip_tdf2_order8_cut1000_f64_ba[0], ellip_tdf2_order8_cut1000_f64_ba[1], NULL, ellip_tdf2_order8_cut1000_f64_kernel},
+    {"ellip_cascade_order8_cut1000_f64_sos", "CASCADE", 4, NULL, NULL, *ellip_cascade_order8_cut1000_f64_sos, ellip_cascade_order8_cut1000_f64_kernel},
+    {"ellip_df1_order8_cut2000_f64_ba", "DF1", 9, ellip_df1_order8_cut2000_f64_ba[0], ellip_df1_order8_cut2000_f64_ba[1], NULL, ellip_df1_order8_cut2000_f64_kernel},
+    {"ellip_df2_order8_cut2000_f64_ba", "DF2", 9, ellip_df2_order8_cut2000_f64_ba[0], ellip_df2_order8_cut2000_f64_ba[1], NULL, ellip_df2_order8_cut2000_f64_kernel},
+    {"ellip_tdf2_order8_cut2000_f64_ba", "TDF2", 9, ellip_tdf2_order8_cut2000_f64_ba[0], ellip_tdf2_order8_cut2000_f64_ba[1], NULL, ellip_tdf2_order8_cut2000_f64_kernel},
+    {"ellip_cascade_order8_cut2000_f64_sos", "CASCADE", 4, NULL, NULL, *ellip_cascade_order8_cut2000_f64_sos, ellip_cascade_order8_cut2000_f64_kernel},
+    {"ellip_df1_order8_cut5000_f64_ba", "DF1", 9, ellip_df1_order8_cut5000_f64_ba[0], ellip_df1_order8_cut5000_f64_ba[1], NULL, ellip_df1_order8_cut5000_f64_kernel},
+    {"ellip_df2_order8_cut5000_f64_ba", "DF2", 9, ellip_df2_order8_cut5000_f64_ba[0], ellip_df2_order8_cut5000_f64_ba[1], NULL, ellip_df2_order8_cut5000_f64_kernel},
+    {"ellip_tdf2_order8_cut5000_f64_ba", "TDF2", 9, ellip_tdf2_order8_cut5000_f64_ba[0], ellip_tdf2_order8_cut5000_f64_ba[1], NULL, ellip_tdf2_order8_cut5000_f64_kernel},
+    {"ellip_cascade_order8_cut5000_f64_sos", "CASCADE", 4, NULL, NULL, *ellip_cascade_order8_cut5000_f64_sos, ellip_cascade_order8_cut5000_f64_kernel},
+    {"bessel_df1_order2_cut1000_f64_ba", "DF1", 3, bessel_df1_order2_cut1000_f64_ba[0], bessel_df1_order2_cut1000_f64_ba[1], NULL, bessel_df1_order2_cut1000_f64_kernel},
+    {"bessel_df2_order2_cut1000_f64_ba", "DF2", 3, bessel_df2_order2_cut1000_f64_ba[0], bessel_df2_order2_cut1000_f64_ba[1], NULL, bessel_df2_order2_cut1000_f64_kernel},
+    {"bessel_tdf2_order2_cut1000_f64_ba", "TDF2", 3, bessel_tdf2_order2_cut1000_f64_ba[0], bessel_tdf2_order2_cut1000_f64_ba[1], NULL, bessel_tdf2_order2_cut1000_f64_kernel},
+    {"bessel_cascade_order2_cut1000_f64_sos", "CASCADE", 1, NULL, NULL, *bessel_cascade_order2_cut1000_f64_sos, bessel_cascade_order2_cut1000_f64_kernel},
+    {"bessel_df1_order2_cut2000_f64_ba", "DF1", 3, bessel_df1_order2_cut2000_f64_ba[0], bessel_df1_order2_cut2000_f64_ba[1], NULL, bessel_df1_order2_cut2000_f64_kernel},
+    {"bessel_df2_order2_cut2000_f64_ba", "DF2", 3, bessel_df2_order2_cut2000_f64_ba[0], bessel_df2_order2_cut2000_f64_ba[1], NULL, bessel_df2_order2_cut2000_f64_kernel},
+    {"bessel_tdf2_order2_cut2000_f64_ba", "TDF2", 3, bessel_tdf2_order2_cut2000_f64_ba[0], bessel_tdf2_order2_cut2000_f64_ba[1], NULL, bessel_tdf2_order2_cut2000_f64_kernel},
+    {"bessel_cascade_order2_cut2000_f64_sos", "CASCADE", 1, NULL, NULL, *bessel_cascade_order2_cut2000_f64_sos, bessel_cascade_order2_cut2000_f64_kernel},
+    {"bessel_df1_order2_cut5000_f64_ba", "DF1", 3, bessel_df1_order2_cut5000_f64_ba[0], bessel_df1_order2_cut5000_f64_ba[1], NULL, bessel_df1_order2_cut5000_f64_kernel},
+    {"bessel_df2_order2_cut5000_f64_ba", "DF2", 3, bessel_df2_order2_cut5000_f64_ba[0], bessel_df2_order2_cut5000_f64_ba[1], NULL, bessel_df2_order2_cut5000_f64_kernel},
+    {"bessel_tdf2_order2_cut5000_f64_ba", "TDF2", 3, bessel_tdf2_order2_cut5000_f64_ba[0], bessel_tdf2_order2_cut5000_f64_ba[1], NULL, bessel_tdf2_order2_cut5000_f64_kernel},
+    {"bessel_cascade_order2_cut5000_f64_sos", "CASCADE", 1, NULL, NULL, *bessel_cascade_order2_cut5000_f64_sos, bessel_cascade_order2_cut5000_f64_kernel},
+    {"bessel_df1_order4_cut1000_f64_ba", "DF1", 5, bessel_df1_order4_cut1000_f64_ba[0], bessel_df1_order4_cut1000_f64_ba[1], NULL, bessel_df1_order4_cut1000_f64_kernel},
+    {"bessel_df2_order4_cut1000_f64_ba", "DF2", 5, bessel_df2_order4_cut1000_f64_ba[0], bessel_df2_order4_cut1000_f64_ba[1], NULL, bessel_df2_order4_cut1000_f64_kernel},
+    {"bessel_tdf2_order4_cut1000_f64_ba", "TDF2", 5, bessel_tdf2_order4_cut1000_f64_ba[0], bessel_tdf2_order4_cut1000_f64_ba[1], NULL, bessel_tdf2_order4_cut1000_f64_kernel},
+    {"bessel_cascade_order4_cut1000_f64_sos", "CASCADE", 2, NULL, NULL, *bessel_cascade_order4_cut1000_f64_sos, bessel_cascade_order4_cut1000_f64_kernel},
+    {"bessel_df1_order4_cut2000_f64_ba", "DF1", 5, bessel_df1_order4_cut2000_f64_ba[0], bessel_df1_order4_cut2000_f64_ba[1], NULL, bessel_df1_order4_cut2000_f64_kernel},
+    {"bessel_df2_order4_cut2000_f64_ba", "DF2", 5, bessel_df2_order4_cut2000_f64_ba[0], bessel_df2_order4_cut2000_f64_ba[1], NULL, bessel_df2_order4_cut2000_f64_kernel},
+    {"bessel_tdf2_order4_cut2000_f64_ba", "TDF2", 5, bessel_tdf2_order4_cut2000_f64_ba[0], bessel_tdf2_order4_cut2000_f64_ba[1], NULL, bessel_tdf2_order4_cut2000_f64_kernel},
+    {"bessel_cascade_order4_cut2000_f64_sos", "CASCADE", 2, NULL, NULL, *bessel_cascade_order4_cut2000_f64_sos, bessel_cascade_order4_cut2000_f64_kernel},
+    {"bessel_df1_order4_cut5000_f64_ba", "DF1", 5, bessel_df1_order4_cut5000_f64_ba[0], bessel_df1_order4_cut5000_f64_ba[1], NULL, bessel_df1_order4_cut5000_f64_kernel},
+    {"bessel_df2_order4_cut5000_f64_ba", "DF2", 5, bessel_df2_order4_cut5000_f64_ba[0], bessel_df2_order4_cut5000_f64_ba[1], NULL, bessel_df2_order4_cut5000_f64_kernel},
+    {"bessel_tdf2_order4_cut5000_f64_ba", "TDF2", 5, bessel_tdf2_order4_cut5000_f64_ba[0], bessel_tdf2_order4_cut5000_f64_ba[1], NULL, bessel_tdf2_order4_cut5000_f64_kernel},
+    {"bessel_cascade_order4_cut5000_f64_sos", "CASCADE", 2, NULL, NULL, *bessel_cascade_order4_cut5000_f64_sos, bessel_cascade_order4_cut5000_f64_kernel},
+    {"bessel_df1_order6_cut1000_f64_ba", "DF1", 7, bessel_df1_order6_cut1000_f64_ba[0], bessel_df1_order6_cut1000_f64_ba[1], NULL, bessel_df1_order6_cut1000_f64_kernel},
+    {"bessel_df2_order6_cut1000_f64_ba", "DF2", 7, bessel_df2_order6_cut1000_f64_ba[0], bessel_df2_order6_cut1000_f64_ba[1], NULL, bessel_df2_order6_cut1000_f64_kernel},
+    {"bessel_tdf2_order6_cut1000_f64_ba", "TDF2", 7, bessel_tdf2_order6_cut1000_f64_ba[0], bessel_tdf2_order6_cut1000_f64_ba[1], NULL, bessel_tdf2_order6_cut1000_f64_kernel},
+    {"bessel_cascade_order6_cut1000_f64_sos", "CASCADE", 3, NULL, NULL, *bessel_cascade_order6_cut1000_f64_sos, bessel_cascade_order6_cut1000_f64_kernel},
+    {"bessel_df1_order6_cut2000_f64_ba", "DF1", 7, bessel_df1_order6_cut2000_f64_ba[0], bessel_df1_order6_cut2000_f64_ba[1], NULL, bessel_df1_order6_cut2000_f64_kernel},
+    {"bessel_df2_order6_cut2000_f64_ba", "DF2", 7, bessel_df2_order6_cut2000_f64_ba[0], bessel_df2_order6_cut2000_f64_ba[1], NULL, bessel_df2_order6_cut2000_f64_kernel},
+    {"bessel_tdf2_order6_cut2000_f64_ba", "TDF2", 7, bessel_tdf2_order6_cut2000_f64_ba[0], bessel_tdf2_order6_cut2000_f64_ba[1], NULL, bessel_tdf2_order6_cut2000_f64_kernel},
+    {"bessel_cascade_order6_cut2000_f64_sos", "CASCADE", 3, NULL, NULL, *bessel_cascade_order6_cut2000_f64_sos, bessel_cascade_order6_cut2000_f64_kernel},
+    {"bessel_df1_order6_cut5000_f64_ba", "DF1", 7, bessel_df1_order6_cut5000_f64_ba[0], bessel_df1_order6_cut5000_f64_ba[1], NULL, bessel_df1_order6_cut5000_f64_kernel},
+    {"bessel_df2_order6_cut5000_f64_ba", "DF2", 7, bessel_df2_order6_cut5000_f64_ba[0], bessel_df2_order6_cut5000_f64_ba[1], NULL, bessel_df2_order6_cut5000_f64_kernel},
+    {"bessel_tdf2_order6_cut5000_f64_ba", "TDF2", 7, bessel_tdf2_order6_cut5000_f64_ba[0], bessel_tdf2_order6_cut5000_f64_ba[1], NULL, bessel_tdf2_order6_cut5000_f64_kernel},
+    {"bessel_cascade_order6_cut5000_f64_sos", "CASCADE", 3, NULL, NULL, *bessel_cascade_order6_cut5000_f64_sos, bessel_cascade_order6_cut5000_f64_kernel},
+    {"bessel_df1_order8_cut1000_f64_ba", "DF1", 9, bessel_df1_order8_cut1000_f64_ba[0], bessel_df1_order8_cut1000_f64_ba[1], NULL, bessel_df1_order8_cut1000_f64_kernel},
+    {"bessel_df2_order8_cut1000_f64_ba", "DF2", 9, bessel_df2_order8_cut1000_f64_ba[0], bessel_df2_order8_cut1000_f64_ba[1], NULL, bessel_df2_order8_cut1000_f64_kernel},
+    {"bessel_tdf2_order8_cut1000_f64_ba", "TDF2", 9, bessel_tdf2_order8_cut1000_f64_ba[0], bessel_tdf2_order8_cut1000_f64_ba[1], NULL, bessel_tdf2_order8_cut1000_f64_kernel},
+    {"bessel_cascade_order8_cut1000_f64_sos", "CASCADE", 4, NULL, NULL, *bessel_cascade_order8_cut1000_f64_sos, bessel_cascade_order8_cut1000_f64_kernel},
+    {"bessel_df1_order8_cut2000_f64_ba", "DF1", 9, bessel_df1_order8_cut2000_f64_ba[0], bessel_df1_order8_cut2000_f64_ba[1], NULL, bessel_df1_order8_cut2000_f64_kernel},
+    {"bessel_df2_order8_cut2000_f64_ba", "DF2", 9, bessel_df2_order8_cut2000_f64_ba[0], bessel_df2_order8_cut2000_f64_ba[1], NULL, bessel_df2_order8_cut2000_f64_kernel},
+    {"bessel_tdf2_order8_cut2000_f64_ba", "TDF2", 9, bessel_tdf2_order8_cut2000_f64_ba[0], bessel_tdf2_order8_cut2000_f64_ba[1], NULL, bessel_tdf2_order8_cut2000_f64_kernel},
+    {"bessel_cascade_order8_cut2000_f64_sos", "CASCADE", 4, NULL, NULL, *bessel_cascade_order8_cut2000_f64_sos, bessel_cascade_order8_cut2000_f64_kernel},
+    {"bessel_df1_order8_cut5000_f64_ba", "DF1", 9, bessel_df1_order8_cut5000_f64_ba[0], bessel_df1_order8_cut5000_f64_ba[1], NULL, bessel_df1_order8_cut5000_f64_kernel},
+    {"bessel_df2_order8_cut5000_f64_ba", "DF2", 9, bessel_df2_order8_cut5000_f64_ba[0], bessel_df2_order8_cut5000_f64_ba[1], NULL, bessel_df2_order8_cut5000_f64_kernel},
+    {"bessel_tdf2_order8_cut5000_f64_ba", "TDF2", 9, bessel_tdf2_order8_cut5000_f64_ba[0], bessel_tdf2_order8_cut5000_f64_ba[1], NULL, bessel_tdf2_order8_cut5000_f64_kernel},
+    {"bessel_cascade_order8_cut5000_f64_sos", "CASCADE", 4, NULL, NULL, *bessel_cascade_order8_cut5000_f64_sos, bessel_cascade_order8_cut5000_f64_kernel},
+};
+const int NUM_BAKED_KERNELS_D = (int)(sizeof(baked_kernels_d) / sizeof(baked_kernels_d[0]));
+
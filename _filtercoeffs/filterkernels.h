@@ -0,0 +1,509 @@
+// Auto-generated coefficient-baked filter kernels
+#ifndef FILTERKERNELS_H
+#define FILTERKERNELS_H
+
+#include <stddef.h>
+
+typedef struct {
+    const char *name;       // nazwa tablicy współczynników w filtercoeffs.h
+    const char *structure;  // DF1 / DF2 / TDF2 / CASCADE
+    int order;              // liczba współczynników (BA) lub liczba sekcji (SOS)
+    float *b, *a, *sos;       // te same współczynniki dla kerneli ogólnych
+    void (*kernel)(float *x, float *y, int N);
+} baked_kernel_f;
+
+typedef struct {
+    const char *name;       // nazwa tablicy współczynników w filtercoeffs.h
+    const char *structure;  // DF1 / DF2 / TDF2 / CASCADE
+    int order;              // liczba współczynników (BA) lub liczba sekcji (SOS)
+    double *b, *a, *sos;       // te same współczynniki dla kerneli ogólnych
+    void (*kernel)(double *x, double *y, int N);
+} baked_kernel_d;
+
+extern baked_kernel_f baked_kernels_f[];
+extern const int NUM_BAKED_KERNELS_F;
+extern baked_kernel_d baked_kernels_d[];
+extern const int NUM_BAKED_KERNELS_D;
+
+void butter_df1_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_df2_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_tdf2_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_cascade_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_df1_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_df2_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_tdf2_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_cascade_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_df1_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_df2_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_tdf2_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_cascade_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_df1_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_df2_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_tdf2_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_cascade_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_df1_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_df2_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_tdf2_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_cascade_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_df1_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_df2_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_tdf2_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_cascade_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_df1_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_df2_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_tdf2_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_cascade_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_df1_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_df2_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_tdf2_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_cascade_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_df1_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_df2_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_tdf2_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_cascade_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_df1_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_df2_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_tdf2_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_cascade_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_df1_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_df2_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_tdf2_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_cascade_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_df1_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_df2_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_tdf2_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_cascade_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_df1_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_df2_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_tdf2_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_cascade_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_df1_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_df2_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_tdf2_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_cascade_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_df1_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_df2_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_tdf2_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_cascade_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_df1_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_df2_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_tdf2_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_cascade_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_df1_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_df2_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_tdf2_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_cascade_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_df1_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_df2_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_tdf2_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_cascade_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_df1_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_df2_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_tdf2_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_cascade_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void butter_df1_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_df2_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_tdf2_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_cascade_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void butter_df1_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_df2_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_tdf2_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_cascade_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void butter_df1_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_df2_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_tdf2_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_cascade_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void butter_df1_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_df2_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_tdf2_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_cascade_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void butter_df1_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_df2_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_tdf2_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void butter_cascade_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_df1_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_df2_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_tdf2_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_cascade_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_df1_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_df2_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_tdf2_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_cascade_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_df1_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_df2_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_tdf2_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_cascade_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_df1_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_df2_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_tdf2_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_cascade_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_df1_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_df2_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_tdf2_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_cascade_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_df1_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_df2_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_tdf2_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_cascade_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_df1_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_df2_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_tdf2_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_cascade_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_df1_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_df2_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_tdf2_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_cascade_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_df1_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_df2_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_tdf2_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_cascade_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_df1_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_df2_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_tdf2_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_cascade_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_df1_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_df2_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_tdf2_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_cascade_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_df1_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_df2_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_tdf2_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_cascade_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_df1_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_df2_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_tdf2_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_cascade_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_df1_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_df2_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_tdf2_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_cascade_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_df1_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_df2_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_tdf2_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_cascade_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_df1_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_df2_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_tdf2_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_cascade_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_df1_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_df2_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_tdf2_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_cascade_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_df1_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_df2_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_tdf2_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_cascade_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_df1_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_df2_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_tdf2_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_cascade_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby1_df1_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_df2_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_tdf2_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_cascade_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby1_df1_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_df2_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_tdf2_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_cascade_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby1_df1_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_df2_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_tdf2_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_cascade_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby1_df1_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_df2_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_tdf2_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_cascade_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby1_df1_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_df2_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_tdf2_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby1_cascade_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_df1_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_df2_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_tdf2_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_cascade_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_df1_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_df2_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_tdf2_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_cascade_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_df1_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_df2_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_tdf2_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_cascade_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_df1_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_df2_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_tdf2_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_cascade_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_df1_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_df2_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_tdf2_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_cascade_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_df1_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_df2_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_tdf2_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_cascade_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_df1_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_df2_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_tdf2_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_cascade_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_df1_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_df2_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_tdf2_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_cascade_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_df1_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_df2_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_tdf2_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_cascade_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_df1_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_df2_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_tdf2_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_cascade_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_df1_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_df2_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_tdf2_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_cascade_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_df1_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_df2_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_tdf2_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_cascade_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_df1_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_df2_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_tdf2_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_cascade_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_df1_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_df2_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_tdf2_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_cascade_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_df1_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_df2_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_tdf2_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_cascade_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_df1_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_df2_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_tdf2_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_cascade_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_df1_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_df2_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_tdf2_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_cascade_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_df1_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_df2_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_tdf2_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_cascade_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_df1_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_df2_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_tdf2_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_cascade_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void cheby2_df1_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_df2_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_tdf2_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_cascade_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void cheby2_df1_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_df2_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_tdf2_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_cascade_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void cheby2_df1_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_df2_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_tdf2_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_cascade_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void cheby2_df1_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_df2_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_tdf2_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_cascade_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void cheby2_df1_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_df2_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_tdf2_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void cheby2_cascade_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_df1_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_df2_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_tdf2_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_cascade_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_df1_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_df2_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_tdf2_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_cascade_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_df1_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_df2_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_tdf2_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_cascade_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_df1_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_df2_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_tdf2_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_cascade_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_df1_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_df2_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_tdf2_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_cascade_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_df1_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_df2_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_tdf2_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_cascade_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_df1_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_df2_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_tdf2_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_cascade_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_df1_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_df2_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_tdf2_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_cascade_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_df1_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_df2_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_tdf2_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_cascade_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_df1_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_df2_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_tdf2_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_cascade_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_df1_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_df2_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_tdf2_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_cascade_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_df1_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_df2_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_tdf2_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_cascade_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_df1_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_df2_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_tdf2_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_cascade_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_df1_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_df2_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_tdf2_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_cascade_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_df1_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_df2_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_tdf2_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_cascade_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_df1_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_df2_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_tdf2_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_cascade_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_df1_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_df2_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_tdf2_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_cascade_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_df1_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_df2_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_tdf2_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_cascade_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_df1_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_df2_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_tdf2_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_cascade_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void ellip_df1_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_df2_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_tdf2_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_cascade_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void ellip_df1_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_df2_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_tdf2_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_cascade_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void ellip_df1_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_df2_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_tdf2_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_cascade_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void ellip_df1_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_df2_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_tdf2_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_cascade_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void ellip_df1_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_df2_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_tdf2_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void ellip_cascade_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_df1_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_df2_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_tdf2_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_cascade_order2_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_df1_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_df2_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_tdf2_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_cascade_order2_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_df1_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_df2_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_tdf2_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_cascade_order2_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_df1_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_df2_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_tdf2_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_cascade_order2_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_df1_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_df2_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_tdf2_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_cascade_order2_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_df1_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_df2_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_tdf2_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_cascade_order2_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_df1_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_df2_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_tdf2_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_cascade_order4_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_df1_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_df2_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_tdf2_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_cascade_order4_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_df1_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_df2_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_tdf2_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_cascade_order4_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_df1_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_df2_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_tdf2_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_cascade_order4_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_df1_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_df2_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_tdf2_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_cascade_order4_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_df1_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_df2_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_tdf2_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_cascade_order4_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_df1_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_df2_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_tdf2_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_cascade_order6_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_df1_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_df2_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_tdf2_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_cascade_order6_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_df1_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_df2_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_tdf2_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_cascade_order6_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_df1_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_df2_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_tdf2_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_cascade_order6_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_df1_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_df2_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_tdf2_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_cascade_order6_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_df1_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_df2_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_tdf2_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_cascade_order6_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_df1_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_df2_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_tdf2_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_cascade_order8_cut1000_f64_kernel(double *x, double *y, int N);
+void bessel_df1_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_df2_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_tdf2_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_cascade_order8_cut1000_f32_kernel(float *x, float *y, int N);
+void bessel_df1_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_df2_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_tdf2_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_cascade_order8_cut2000_f64_kernel(double *x, double *y, int N);
+void bessel_df1_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_df2_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_tdf2_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_cascade_order8_cut2000_f32_kernel(float *x, float *y, int N);
+void bessel_df1_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_df2_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_tdf2_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_cascade_order8_cut5000_f64_kernel(double *x, double *y, int N);
+void bessel_df1_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_df2_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_tdf2_order8_cut5000_f32_kernel(float *x, float *y, int N);
+void bessel_cascade_order8_cut5000_f32_kernel(float *x, float *y, int N);
+
+#endif // FILTERKERNELS_H